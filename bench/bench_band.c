@@ -0,0 +1,171 @@
+/*
+ * Throughput of the band routines over a sweep of bandwidths.
+ *
+ * usage: bench_band [-n size] [k ...]
+ *
+ * Runs BLAS_{d,z}gbmv_x (kl = ku = k), BLAS_dgbmv2_x, BLAS_{d,z}sbmv_x,
+ * BLAS_zhbmv_x and BLAS_{d,z}tbsv_x on n by n matrices (default n =
+ * 4000, k = 8 .. 200) in both storage orders, in double and extra
+ * precision, and prints one CSV line per routine, order, precision and
+ * bandwidth.  The last column is the extra/double time ratio.  A
+ * complex multiply-add is counted as 8 flops, a symmetric band element
+ * as two multiply-adds.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "blas_extended.h"
+
+static double wall(void)
+{
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static void fill(double *p, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    p[i] = rand() / (double) RAND_MAX - 0.5;
+}
+
+enum band_routine {
+  band_dgbmv, band_zgbmv, band_dgbmv2, band_dsbmv, band_zsbmv, band_zhbmv,
+  band_dtbsv, band_ztbsv, band_count
+};
+
+static const char *const band_names[band_count] = {
+  "BLAS_dgbmv_x", "BLAS_zgbmv_x", "BLAS_dgbmv2_x", "BLAS_dsbmv_x",
+  "BLAS_zsbmv_x", "BLAS_zhbmv_x", "BLAS_dtbsv_x", "BLAS_ztbsv_x"
+};
+
+/* One call of routine r on the n by n band of bandwidth k in a. */
+static void call(enum band_routine r, enum blas_order_type order, int n,
+		 int k, const double *a, int lda, double *x,
+		 const double *y0, double *y, enum blas_prec_type prec)
+{
+  static const double alpha[2] = { 1.5, -0.5 }, beta[2] = { 0.5, 0.25 };
+
+  switch (r) {
+  case band_dgbmv:
+    BLAS_dgbmv_x(order, blas_no_trans, n, n, k, k, alpha[0], a, lda, x, 1,
+		 beta[0], y, 1, prec);
+    break;
+  case band_zgbmv:
+    BLAS_zgbmv_x(order, blas_no_trans, n, n, k, k, alpha, a, lda, x, 1,
+		 beta, y, 1, prec);
+    break;
+  case band_dgbmv2:
+    BLAS_dgbmv2_x(order, blas_no_trans, n, n, k, k, alpha[0], a, lda, x,
+		  y0, 1, beta[0], y, 1, prec);
+    break;
+  case band_dsbmv:
+    BLAS_dsbmv_x(order, blas_lower, n, k, alpha[0], a, lda, x, 1, beta[0],
+		 y, 1, prec);
+    break;
+  case band_zsbmv:
+    BLAS_zsbmv_x(order, blas_lower, n, k, alpha, a, lda, x, 1, beta, y, 1,
+		 prec);
+    break;
+  case band_zhbmv:
+    BLAS_zhbmv_x(order, blas_lower, n, k, alpha, a, lda, x, 1, beta, y, 1,
+		 prec);
+    break;
+  case band_dtbsv:
+    BLAS_dtbsv_x(order, blas_lower, blas_no_trans, blas_non_unit_diag, n,
+		 k, alpha[0], a, lda, y, 1, prec);
+    break;
+  default:
+    BLAS_ztbsv_x(order, blas_lower, blas_no_trans, blas_non_unit_diag, n,
+		 k, alpha, a, lda, y, 1, prec);
+    break;
+  }
+}
+
+/* Seconds per call of one routine, order, precision and bandwidth. */
+static double run(enum band_routine r, enum blas_order_type order, int n,
+		  int k, enum blas_prec_type prec)
+{
+  int is_complex = (r == band_zgbmv || r == band_zsbmv || r == band_zhbmv
+		    || r == band_ztbsv);
+  int w = is_complex ? 2 : 1;
+  int gb = (r == band_dgbmv || r == band_zgbmv || r == band_dgbmv2);
+  int lda = gb ? 2 * k + 1 : k + 1;
+  int len = lda * n * w;
+  double *a = (double *) malloc(len * sizeof(double));
+  double *x = (double *) malloc(n * w * sizeof(double));
+  double *y0 = (double *) malloc(n * w * sizeof(double));
+  double *y = (double *) malloc(n * w * sizeof(double));
+  double t0, t;
+  int reps = 0, i;
+
+  fill(a, len);
+  fill(x, n * w);
+  fill(y0, n * w);
+  if (r == band_dtbsv || r == band_ztbsv) {
+    /* A dominant diagonal keeps the solves bounded: it is the first
+       slot of each column-major line, the last of each row-major one. */
+    for (i = 0; i < len; i++)
+      a[i] /= k + 1;
+    for (i = 0; i < n; i++)
+      a[w * (i * lda + (order == blas_colmajor ? 0 : k))] += 1.0;
+  }
+
+  t0 = wall();
+  do {
+    memcpy(y, y0, n * w * sizeof(double));
+    call(r, order, n, k, a, lda, x, y0, y, prec);
+    reps++;
+    t = wall() - t0;
+  } while (t < 0.2);
+  t /= reps;
+
+  free(a);
+  free(x);
+  free(y0);
+  free(y);
+  return t;
+}
+
+int main(int argc, char **argv)
+{
+  static const int default_ks[] = { 8, 16, 32, 64, 100, 200 };
+  int ks[64], nk = 0, n = 4000, i, o, r;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      n = atoi(argv[++i]);
+    else if (nk < 64)
+      ks[nk++] = atoi(argv[i]);
+  }
+  if (nk == 0)
+    for (nk = 0; nk < 6; nk++)
+      ks[nk] = default_ks[nk];
+
+  printf("routine,order,prec,n,k,gflops,extra_over_double\n");
+  for (r = 0; r < band_count; r++)
+    for (o = 0; o < 2; o++)
+      for (i = 0; i < nk; i++) {
+	enum blas_order_type order = o ? blas_rowmajor : blas_colmajor;
+	int k = ks[i] < n ? ks[i] : n - 1;
+	int is_complex = (r == band_zgbmv || r == band_zsbmv
+			  || r == band_zhbmv || r == band_ztbsv);
+	double per = (r == band_dtbsv || r == band_ztbsv) ? k + 1.0
+	  : 2.0 * k + 1.0;
+	double flops = (is_complex ? 8.0 : 2.0) * n * per
+	  * (r == band_dgbmv2 ? 2.0 : 1.0);
+	double td = run(r, order, n, k, blas_prec_double);
+	double tx = run(r, order, n, k, blas_prec_extra);
+
+	printf("%s,%s,double,%d,%d,%.3f,\n", band_names[r],
+	       o ? "row" : "col", n, k, flops / td * 1e-9);
+	printf("%s,%s,extra,%d,%d,%.3f,%.2f\n", band_names[r],
+	       o ? "row" : "col", n, k, flops / tx * 1e-9, tx / td);
+	fflush(stdout);
+      }
+  return 0;
+}
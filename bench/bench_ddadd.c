@@ -0,0 +1,290 @@
+/*
+ * The lazily renormalized double-double add against the full one.
+ *
+ * usage: bench_ddadd [-r repeats] [n ...]
+ *
+ * The extra-precision inner loops of DOT, GEMV, GBMV, SYMV, SPMV, TRSV
+ * and their kin add each product to their sums with blas_dd_add_lazy;
+ * before, they used blas_dd_add.  The library is built with one of the
+ * two only, so this program runs the loop shapes of those families on
+ * both: a real dot (DOT, and the rows of GEMV, GBMV, TRMV), a complex
+ * dot (the z and c routines), GEMV by rows of a row-major A, GEMV by
+ * columns, with a sum per row (the column sweeps of GEMV, SYMV, SPMV,
+ * SBMV), and a lower triangular solve (TRSV, TBSV).  The vectors of the
+ * dots have n * n elements and the matrices are n by n (default n =
+ * 250, 500, 1000, 2000).  Prints one CSV line per loop and size: the
+ * seconds of each add, the speedup, and the largest difference of the
+ * two double-double results relative to the full one, which stays near
+ * 2^-106 (or 2^-53 for the solution of TRSV, rounded to double).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "blas_extended.h"
+#include "blas_dd_private.h"
+
+static double wall(void)
+{
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static void fill(double *p, long n)
+{
+  long i;
+
+  for (i = 0; i < n; i++)
+    p[i] = rand() / (double) RAND_MAX - 0.5;
+}
+
+/* (head, tail) += (head_b, tail_b) by the add under test.  Each loop
+   below is inlined into a full and a lazy copy, with lazy a constant. */
+static inline void dd_add(int lazy, double *head, double *tail,
+			  double head_b, double tail_b)
+{
+  if (lazy)
+    blas_dd_add_lazy(*head, *tail, head_b, tail_b, head, tail);
+  else
+    blas_dd_add(*head, *tail, head_b, tail_b, head, tail);
+}
+
+static inline void dot(int lazy, long len, const double *x,
+		       const double *y, double *r)
+{
+  double head = 0.0, tail = 0.0, head_p, tail_p;
+  long i;
+
+  for (i = 0; i < len; i++) {
+    blas_dd_two_prod(x[i], y[i], &head_p, &tail_p);
+    dd_add(lazy, &head, &tail, head_p, tail_p);
+  }
+  r[0] = head;
+  r[1] = tail;
+}
+
+static inline void zdot(int lazy, long len, const double *x,
+			const double *y, double *r)
+{
+  double head[2] = { 0.0, 0.0 }, tail[2] = { 0.0, 0.0 };
+  double head_p[2], tail_p[2], head_t, tail_t;
+  long i;
+
+  for (i = 0; i < len; i++) {
+    const double *a = x + 2 * i, *b = y + 2 * i;
+
+    blas_dd_two_prod(a[0], b[0], &head_p[0], &tail_p[0]);
+    blas_dd_two_prod(a[1], b[1], &head_t, &tail_t);
+    dd_add(lazy, &head_p[0], &tail_p[0], -head_t, -tail_t);
+    blas_dd_two_prod(a[1], b[0], &head_p[1], &tail_p[1]);
+    blas_dd_two_prod(a[0], b[1], &head_t, &tail_t);
+    dd_add(lazy, &head_p[1], &tail_p[1], head_t, tail_t);
+    dd_add(lazy, &head[0], &tail[0], head_p[0], tail_p[0]);
+    dd_add(lazy, &head[1], &tail[1], head_p[1], tail_p[1]);
+  }
+  r[0] = head[0];
+  r[1] = tail[0];
+  r[2] = head[1];
+  r[3] = tail[1];
+}
+
+/* r <- A x, A n by n row-major. */
+static inline void gemv_rows(int lazy, int n, const double *a,
+			     const double *x, double *r)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    dot(lazy, n, a + (long) i * n, x, r + 2 * i);
+}
+
+/* r <- A x, A n by n column-major, a sum per row kept in head and
+   tail. */
+static inline void gemv_cols(int lazy, int n, const double *a,
+			     const double *x, double *r, double *head,
+			     double *tail)
+{
+  double head_p, tail_p;
+  int i, j;
+
+  for (i = 0; i < n; i++)
+    head[i] = tail[i] = 0.0;
+  for (j = 0; j < n; j++) {
+    const double *col = a + (long) j * n;
+
+    for (i = 0; i < n; i++) {
+      blas_dd_two_prod(col[i], x[j], &head_p, &tail_p);
+      dd_add(lazy, &head[i], &tail[i], head_p, tail_p);
+    }
+  }
+  for (i = 0; i < n; i++) {
+    r[2 * i] = head[i];
+    r[2 * i + 1] = tail[i];
+  }
+}
+
+/* r <- L^-1 b, L the lower triangle of the row-major a with a diagonal
+   made dominant; the solution is rounded to double, as TRSV leaves it. */
+static inline void trsv(int lazy, int n, const double *a, const double *b,
+			double *r)
+{
+  double head, tail, head_p, tail_p;
+  int i, j;
+
+  for (i = 0; i < n; i++) {
+    const double *row = a + (long) i * n;
+
+    head = b[i];
+    tail = 0.0;
+    for (j = 0; j < i; j++) {
+      blas_dd_two_prod(-row[j], r[2 * j], &head_p, &tail_p);
+      dd_add(lazy, &head, &tail, head_p, tail_p);
+    }
+    r[2 * i] = (head + tail) / (row[i] + n);
+    r[2 * i + 1] = 0.0;
+  }
+}
+
+enum loop {
+  loop_dot, loop_zdot, loop_gemv_rows, loop_gemv_cols, loop_trsv,
+  loop_count
+};
+
+static const char *const loop_names[loop_count] = {
+  "dot", "zdot", "gemv-rows", "gemv-cols", "trsv"
+};
+
+struct data {
+  int n;
+  double *a, *x, *y, *head, *tail;
+};
+
+/* One run of loop l with the full (lazy = 0) or the lazy add; returns
+   the number of results left in r, each as head and tail. */
+static int run(enum loop l, int lazy, const struct data *d, double *r)
+{
+  long nn = (long) d->n * d->n;
+
+  switch (l) {
+  case loop_dot:
+    if (lazy)
+      dot(1, nn, d->a, d->y, r);
+    else
+      dot(0, nn, d->a, d->y, r);
+    return 1;
+  case loop_zdot:
+    if (lazy)
+      zdot(1, nn / 2, d->a, d->y, r);
+    else
+      zdot(0, nn / 2, d->a, d->y, r);
+    return 2;
+  case loop_gemv_rows:
+    if (lazy)
+      gemv_rows(1, d->n, d->a, d->x, r);
+    else
+      gemv_rows(0, d->n, d->a, d->x, r);
+    return d->n;
+  case loop_gemv_cols:
+    if (lazy)
+      gemv_cols(1, d->n, d->a, d->x, r, d->head, d->tail);
+    else
+      gemv_cols(0, d->n, d->a, d->x, r, d->head, d->tail);
+    return d->n;
+  default:
+    if (lazy)
+      trsv(1, d->n, d->a, d->x, r);
+    else
+      trsv(0, d->n, d->a, d->x, r);
+    return d->n;
+  }
+}
+
+/* Best time of repeats runs. */
+static double best(enum loop l, int lazy, const struct data *d, double *r,
+		   int repeats)
+{
+  double t, t_min = 0.0;
+  int k;
+
+  for (k = 0; k < repeats; k++) {
+    t = wall();
+    run(l, lazy, d, r);
+    t = wall() - t;
+    if (k == 0 || t < t_min)
+      t_min = t;
+  }
+  return t_min;
+}
+
+int main(int argc, char **argv)
+{
+  static const int default_sizes[] = { 250, 500, 1000, 2000 };
+  int sizes[64], nsizes = 0, repeats = 3, i, s, l, cnt;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+      repeats = atoi(argv[++i]);
+    else if (nsizes < 64)
+      sizes[nsizes++] = atoi(argv[i]);
+  }
+  if (nsizes == 0)
+    for (; nsizes < 4; nsizes++)
+      sizes[nsizes] = default_sizes[nsizes];
+  if (repeats < 1)
+    repeats = 1;
+
+  printf("loop,n,full_s,lazy_s,speedup,max_rel_diff\n");
+  for (s = 0; s < nsizes; s++) {
+    struct data d;
+    long nn = (long) sizes[s] * sizes[s];
+    double *r_full, *r_lazy;
+
+    d.n = sizes[s];
+    if (d.n <= 0)
+      continue;
+    d.a = (double *) malloc(nn * sizeof(double));
+    d.y = (double *) malloc(nn * sizeof(double));
+    d.x = (double *) malloc(d.n * sizeof(double));
+    d.head = (double *) malloc(d.n * sizeof(double));
+    d.tail = (double *) malloc(d.n * sizeof(double));
+    /* Room for the complex dot as well. */
+    r_full = (double *) malloc(MAX(2 * d.n, 4) * sizeof(double));
+    r_lazy = (double *) malloc(MAX(2 * d.n, 4) * sizeof(double));
+    if (d.a == NULL || d.y == NULL || d.x == NULL || d.head == NULL
+	|| d.tail == NULL || r_full == NULL || r_lazy == NULL) {
+      fprintf(stderr, "bench_ddadd: out of memory at n = %d\n", d.n);
+      return 1;
+    }
+    fill(d.a, nn);
+    fill(d.y, nn);
+    fill(d.x, d.n);
+
+    for (l = 0; l < loop_count; l++) {
+      double t_full, t_lazy, diff = 0.0;
+
+      t_full = best((enum loop) l, 0, &d, r_full, repeats);
+      t_lazy = best((enum loop) l, 1, &d, r_lazy, repeats);
+      cnt = run((enum loop) l, 0, &d, r_full);
+      run((enum loop) l, 1, &d, r_lazy);
+      for (i = 0; i < cnt; i++)
+	if (r_full[2 * i] != 0.0)
+	  diff = MAX(diff, fabs((r_lazy[2 * i] - r_full[2 * i])
+				+ (r_lazy[2 * i + 1] - r_full[2 * i + 1]))
+		     / fabs(r_full[2 * i]));
+      printf("%s,%d,%.4f,%.4f,%.2f,%.2e\n", loop_names[l], d.n, t_full,
+	     t_lazy, t_lazy > 0.0 ? t_full / t_lazy : 0.0, diff);
+    }
+
+    free(d.a);
+    free(d.y);
+    free(d.x);
+    free(d.head);
+    free(d.tail);
+    free(r_full);
+    free(r_lazy);
+  }
+  return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * Throughput of BLAS_{s,d,c,z}gemm_x in each internal precision.
+ *
+ * usage: bench_gemm [n ...]
+ *
+ * Runs square column-major problems (default n = 64 .. 1024) and prints
+ * one CSV line per routine, precision and size.  Extra precision is run
+ * once with the double-double micro-kernels (extra-dd) and once by the
+ * Ozaki scheme (extra-ozaki); a last line per routine gives the
+ * smallest n at which the scheme was the faster, which is what
+ * BLAS_GEMM_OZAKI_MIN_DIM should be on this machine.  A complex
+ * multiply-add is counted as 8 flops.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "blas_extended.h"
+#include "blas_gemm_engine.h"
+
+static double wall(void)
+{
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static void fill(void *p, int n, int is_float)
+{
+  int i;
+
+  for (i = 0; i < n; i++) {
+    double v = rand() / (double) RAND_MAX - 0.5;
+    if (is_float)
+      ((float *) p)[i] = v;
+    else
+      ((double *) p)[i] = v;
+  }
+}
+
+static const char *prec_name(enum blas_prec_type prec,
+			     enum blas_gemm_extra_method method)
+{
+  switch (prec) {
+  case blas_prec_single:
+    return "single";
+  case blas_prec_double:
+    return "double";
+  default:
+    return method == blas_gemm_extra_ozaki ? "extra-ozaki" : "extra-dd";
+  }
+}
+
+/* GFLOP/s of one routine, precision and size. */
+static double run(char type, int n, enum blas_prec_type prec,
+		  enum blas_gemm_extra_method method)
+{
+  int is_float = (type == 's' || type == 'c');
+  int is_complex = (type == 'c' || type == 'z');
+  int len = n * n * (is_complex ? 2 : 1);
+  size_t elt = is_float ? sizeof(float) : sizeof(double);
+  void *a = malloc(len * elt), *b = malloc(len * elt), *c = malloc(len * elt);
+  double alpha[2] = { 1.5, -0.5 }, beta[2] = { 0.5, 0.25 };
+  float alpha_f[2] = { 1.5f, -0.5f }, beta_f[2] = { 0.5f, 0.25f };
+  double flops = (is_complex ? 8.0 : 2.0) * n * n * n;
+  double t0, t;
+  int reps = 0;
+
+  fill(a, len, is_float);
+  fill(b, len, is_float);
+  fill(c, len, is_float);
+  BLAS_set_gemm_extra_method(method);
+
+  t0 = wall();
+  do {
+    switch (type) {
+    case 's':
+      BLAS_sgemm_x(blas_colmajor, blas_no_trans, blas_no_trans, n, n, n,
+		   alpha_f[0], a, n, b, n, beta_f[0], c, n, prec);
+      break;
+    case 'd':
+      BLAS_dgemm_x(blas_colmajor, blas_no_trans, blas_no_trans, n, n, n,
+		   alpha[0], a, n, b, n, beta[0], c, n, prec);
+      break;
+    case 'c':
+      BLAS_cgemm_x(blas_colmajor, blas_no_trans, blas_no_trans, n, n, n,
+		   alpha_f, a, n, b, n, beta_f, c, n, prec);
+      break;
+    default:
+      BLAS_zgemm_x(blas_colmajor, blas_no_trans, blas_no_trans, n, n, n,
+		   alpha, a, n, b, n, beta, c, n, prec);
+      break;
+    }
+    reps++;
+    t = wall() - t0;
+  } while (t < 0.2);
+
+  printf("BLAS_%cgemm_x,%s,%d,%.3f\n", type, prec_name(prec, method), n,
+	 flops * reps / t * 1e-9);
+  fflush(stdout);
+
+  free(a);
+  free(b);
+  free(c);
+  return flops * reps / t * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+  static const int default_sizes[] = { 64, 128, 256, 512, 1024 };
+  static const char types[] = { 's', 'd', 'c', 'z' };
+  static const enum blas_prec_type precs[] = {
+    blas_prec_single, blas_prec_double, blas_prec_extra
+  };
+  int nsizes = argc > 1 ? argc - 1 : 5;
+  int crossover[4] = { 0, 0, 0, 0 };
+  int i, t, p;
+
+  printf("routine,prec,n,gflops\n");
+  for (i = 0; i < nsizes; i++) {
+    int n = argc > 1 ? atoi(argv[i + 1]) : default_sizes[i];
+    for (t = 0; t < 4; t++) {
+      double dd, ozaki;
+
+      for (p = 0; p < 2; p++)
+	run(types[t], n, precs[p], blas_gemm_extra_dd);
+      dd = run(types[t], n, blas_prec_extra, blas_gemm_extra_dd);
+      ozaki = run(types[t], n, blas_prec_extra, blas_gemm_extra_ozaki);
+      if (ozaki > dd && (crossover[t] == 0 || n < crossover[t]))
+	crossover[t] = n;
+    }
+  }
+  for (t = 0; t < 4; t++) {
+    if (crossover[t] > 0)
+      printf("BLAS_%cgemm_x,ozaki-faster-from,%d,\n", types[t],
+	     crossover[t]);
+    else
+      printf("BLAS_%cgemm_x,ozaki-faster-from,none,\n", types[t]);
+  }
+  return 0;
+}
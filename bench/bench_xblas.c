@@ -0,0 +1,550 @@
+/*
+ * Throughput of every _x routine in each internal precision.
+ *
+ * usage: bench_xblas [-t seconds] [-n size ...] [family ...]
+ *
+ * Times each routine of the named families (default: all), every type
+ * and mixed-type variant, over a sweep of sizes from cache-resident to
+ * memory-bound, in single, double and extra precision.  Each call is
+ * repeated for at least 'seconds' (default 0.05).  Each -n replaces the
+ * sweep with the sizes given, e.g. -n 4096 -n 8192 -n 16384 symv hemv
+ * for the memory-bound SYMV and HEMV; building the library with
+ * -DBLAS_SYMV_LINES_MIN_N=2147483647 keeps their extra precision on the
+ * row loops, to compare against the single sweep.  One CSV line is
+ * printed per routine, precision and size:
+ *
+ *   routine,family,prec,n,seconds,gflops,gbs,extra_over_double
+ *
+ * seconds is the time per call; gbs counts each operand read once and
+ * each output read and written once; extra_over_double is the time of
+ * the extra-precision call over the double one, the same on all three
+ * lines.  Flops are 2 per real multiply-add and 8 per complex one.
+ * Matrices are column-major and untransposed, band matrices have
+ * BENCH_BAND off-diagonals, and the in-place routines (trmv, tpmv,
+ * trsv, tbsv, trsm) restore x or B before each call, inside the
+ * timing.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "blas_extended.h"
+
+#define BENCH_BAND 16
+
+enum family {
+  fam_dot, fam_sum, fam_axpby, fam_waxpby, fam_gemv, fam_gemv2,
+  fam_ge_sum_mv, fam_gbmv, fam_gbmv2, fam_symv, fam_symv2, fam_spmv,
+  fam_sbmv, fam_hemv, fam_hemv2, fam_hpmv, fam_hbmv, fam_trmv, fam_tpmv,
+  fam_trsv, fam_tbsv, fam_gemm, fam_symm, fam_hemm, fam_trsm, fam_syrk,
+  fam_herk, fam_syr2k, fam_her2k, fam_count
+};
+
+static const char *const family_names[fam_count] = {
+  "dot", "sum", "axpby", "waxpby", "gemv", "gemv2",
+  "ge_sum_mv", "gbmv", "gbmv2", "symv", "symv2", "spmv",
+  "sbmv", "hemv", "hemv2", "hpmv", "hbmv", "trmv", "tpmv",
+  "trsv", "tbsv", "gemm", "symm", "hemm", "trsm", "syrk",
+  "herk", "syr2k", "her2k"
+};
+
+/* Operands of one problem.  in1 has the first input type of the
+   routine's name (x, A or T), in2 and in4 the second (y, x or B, and
+   the tail of x), in3 the first again (B of ge_sum_mv), and out the
+   output type.  save holds the starting x of the in-place routines. */
+struct bench {
+  int n, k;
+  void *in1, *in2, *in3, *in4, *out, *save;
+  float alpha_s, beta_s, alpha_c[2], beta_c[2];
+  double alpha_d, beta_d, alpha_z[2], beta_z[2];
+};
+
+#define ALPHA_s(b) (b)->alpha_s
+#define ALPHA_d(b) (b)->alpha_d
+#define ALPHA_c(b) (b)->alpha_c
+#define ALPHA_z(b) (b)->alpha_z
+#define BETA_s(b) (b)->beta_s
+#define BETA_d(b) (b)->beta_d
+#define BETA_c(b) (b)->beta_c
+#define BETA_z(b) (b)->beta_z
+/* The real alpha and beta of HERK and HER2K. */
+#define RALPHA_c(b) (b)->alpha_s
+#define RALPHA_z(b) (b)->alpha_d
+#define RBETA_c(b) (b)->beta_s
+#define RBETA_z(b) (b)->beta_d
+
+#define CM blas_colmajor
+#define NT blas_no_trans
+
+/* The variants of each family: F(output, first input, second input,
+   name suffix). */
+#define VARIANTS_16(F, fam)						\
+  F(fam, s, s, s, ) F(fam, d, d, d, ) F(fam, c, c, c, ) F(fam, z, z, z, ) \
+  F(fam, d, d, s, _d_s) F(fam, d, s, d, _s_d) F(fam, d, s, s, _s_s)	\
+  F(fam, z, z, c, _z_c) F(fam, z, c, z, _c_z) F(fam, z, c, c, _c_c)	\
+  F(fam, c, c, s, _c_s) F(fam, c, s, c, _s_c) F(fam, c, s, s, _s_s)	\
+  F(fam, z, z, d, _z_d) F(fam, z, d, z, _d_z) F(fam, z, d, d, _d_d)
+#define VARIANTS_HERM(F, fam)						\
+  F(fam, c, c, c, ) F(fam, z, z, z, )					\
+  F(fam, z, z, c, _z_c) F(fam, z, c, z, _c_z) F(fam, z, c, c, _c_c)	\
+  F(fam, c, c, s, _c_s) F(fam, z, z, d, _z_d)
+#define VARIANTS_8(F, fam)						\
+  F(fam, s, s, s, ) F(fam, d, d, d, ) F(fam, c, c, c, ) F(fam, z, z, z, ) \
+  F(fam, d, s, s, _s) F(fam, z, c, c, _c) F(fam, c, s, s, _s)		\
+  F(fam, z, d, d, _d)
+#define VARIANTS_8_2(F, fam)						\
+  F(fam, s, s, s, ) F(fam, d, d, d, ) F(fam, c, c, c, ) F(fam, z, z, z, ) \
+  F(fam, d, s, s, _s_s) F(fam, z, c, c, _c_c) F(fam, c, s, s, _s_s)	\
+  F(fam, z, d, d, _d_d)
+#define VARIANTS_HERK(F, fam)						\
+  F(fam, c, c, c, ) F(fam, z, z, z, ) F(fam, z, c, c, _c)
+#define VARIANTS_HER2K(F, fam)						\
+  F(fam, c, c, c, ) F(fam, z, z, z, ) F(fam, z, c, c, _c_c)
+#define VARIANTS_4(F, fam)						\
+  F(fam, s, s, s, ) F(fam, d, d, d, ) F(fam, c, c, c, ) F(fam, z, z, z, )
+
+/* Calls of each family on a struct bench *b in precision p. */
+#define CALL_dot(o, s)							\
+  BLAS_##o##dot##s##_x(blas_no_conj, b->n, ALPHA_##o(b), b->in1, 1,	\
+		       BETA_##o(b), b->in2, 1, b->out, p)
+#define CALL_sum(o, s)							\
+  BLAS_##o##sum##s##_x(b->n, b->in1, 1, b->out, p)
+#define CALL_axpby(o, s)						\
+  BLAS_##o##axpby##s##_x(b->n, ALPHA_##o(b), b->in1, 1, BETA_##o(b),	\
+			 b->out, 1, p)
+#define CALL_waxpby(o, s)						\
+  BLAS_##o##waxpby##s##_x(b->n, ALPHA_##o(b), b->in1, 1, BETA_##o(b),	\
+			  b->in2, 1, b->out, 1, p)
+#define CALL_gemv(o, s)							\
+  BLAS_##o##gemv##s##_x(CM, NT, b->n, b->n, ALPHA_##o(b), b->in1, b->n, \
+			b->in2, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_gemv2(o, s)						\
+  BLAS_##o##gemv2##s##_x(CM, NT, b->n, b->n, ALPHA_##o(b), b->in1,	\
+			 b->n, b->in2, b->in4, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_ge_sum_mv(o, s)						\
+  BLAS_##o##ge_sum_mv##s##_x(CM, b->n, b->n, ALPHA_##o(b), b->in1,	\
+			     b->n, b->in2, 1, BETA_##o(b), b->in3, b->n, \
+			     b->out, 1, p)
+#define CALL_gbmv(o, s)							\
+  BLAS_##o##gbmv##s##_x(CM, NT, b->n, b->n, b->k, b->k, ALPHA_##o(b),	\
+			b->in1, 2 * b->k + 1, b->in2, 1, BETA_##o(b),	\
+			b->out, 1, p)
+#define CALL_gbmv2(o, s)						\
+  BLAS_##o##gbmv2##s##_x(CM, NT, b->n, b->n, b->k, b->k, ALPHA_##o(b),	\
+			 b->in1, 2 * b->k + 1, b->in2, b->in4, 1,	\
+			 BETA_##o(b), b->out, 1, p)
+#define CALL_symv(o, s)							\
+  BLAS_##o##symv##s##_x(CM, blas_upper, b->n, ALPHA_##o(b), b->in1,	\
+			b->n, b->in2, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_symv2(o, s)						\
+  BLAS_##o##symv2##s##_x(CM, blas_upper, b->n, ALPHA_##o(b), b->in1,	\
+			 b->n, b->in2, b->in4, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_spmv(o, s)							\
+  BLAS_##o##spmv##s##_x(CM, blas_upper, b->n, ALPHA_##o(b), b->in1,	\
+			b->in2, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_sbmv(o, s)							\
+  BLAS_##o##sbmv##s##_x(CM, blas_upper, b->n, b->k, ALPHA_##o(b),	\
+			b->in1, b->k + 1, b->in2, 1, BETA_##o(b),	\
+			b->out, 1, p)
+#define CALL_hemv(o, s)							\
+  BLAS_##o##hemv##s##_x(CM, blas_upper, b->n, ALPHA_##o(b), b->in1,	\
+			b->n, b->in2, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_hemv2(o, s)						\
+  BLAS_##o##hemv2##s##_x(CM, blas_upper, b->n, ALPHA_##o(b), b->in1,	\
+			 b->n, b->in2, b->in4, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_hpmv(o, s)							\
+  BLAS_##o##hpmv##s##_x(CM, blas_upper, b->n, ALPHA_##o(b), b->in1,	\
+			b->in2, 1, BETA_##o(b), b->out, 1, p)
+#define CALL_hbmv(o, s)							\
+  BLAS_##o##hbmv##s##_x(CM, blas_upper, b->n, b->k, ALPHA_##o(b),	\
+			b->in1, b->k + 1, b->in2, 1, BETA_##o(b),	\
+			b->out, 1, p)
+#define CALL_trmv(o, s)							\
+  BLAS_##o##trmv##s##_x(CM, blas_upper, NT, blas_non_unit_diag, b->n,	\
+			ALPHA_##o(b), b->in1, b->n, b->out, 1, p)
+#define CALL_tpmv(o, s)							\
+  BLAS_##o##tpmv##s##_x(CM, blas_upper, NT, blas_non_unit_diag, b->n,	\
+			ALPHA_##o(b), b->in1, b->out, 1, p)
+#define CALL_trsv(o, s)							\
+  BLAS_##o##trsv##s##_x(CM, blas_upper, NT, blas_unit_diag, b->n,	\
+			ALPHA_##o(b), b->in1, b->n, b->out, 1, p)
+#define CALL_tbsv(o, s)							\
+  BLAS_##o##tbsv##s##_x(CM, blas_upper, NT, blas_unit_diag, b->n, b->k, \
+			ALPHA_##o(b), b->in1, b->k + 1, b->out, 1, p)
+#define CALL_gemm(o, s)							\
+  BLAS_##o##gemm##s##_x(CM, NT, NT, b->n, b->n, b->n, ALPHA_##o(b),	\
+			b->in1, b->n, b->in2, b->n, BETA_##o(b), b->out, \
+			b->n, p)
+#define CALL_symm(o, s)							\
+  BLAS_##o##symm##s##_x(CM, blas_left_side, blas_upper, b->n, b->n,	\
+			ALPHA_##o(b), b->in1, b->n, b->in2, b->n,	\
+			BETA_##o(b), b->out, b->n, p)
+#define CALL_hemm(o, s)							\
+  BLAS_##o##hemm##s##_x(CM, blas_left_side, blas_upper, b->n, b->n,	\
+			ALPHA_##o(b), b->in1, b->n, b->in2, b->n,	\
+			BETA_##o(b), b->out, b->n, p)
+#define CALL_trsm(o, s)							\
+  BLAS_##o##trsm##s##_x(CM, blas_left_side, blas_upper, NT,		\
+			blas_unit_diag, b->n, b->n, ALPHA_##o(b), b->in1, \
+			b->n, b->out, b->n, p)
+#define CALL_syrk(o, s)							\
+  BLAS_##o##syrk##s##_x(CM, blas_upper, NT, b->n, b->n, ALPHA_##o(b),	\
+			b->in1, b->n, BETA_##o(b), b->out, b->n, p)
+#define CALL_herk(o, s)							\
+  BLAS_##o##herk##s##_x(CM, blas_upper, NT, b->n, b->n, RALPHA_##o(b), \
+			b->in1, b->n, RBETA_##o(b), b->out, b->n, p)
+#define CALL_syr2k(o, s)						\
+  BLAS_##o##syr2k##s##_x(CM, blas_upper, NT, b->n, b->n, ALPHA_##o(b), \
+			 b->in1, b->n, b->in2, b->n, BETA_##o(b), b->out, \
+			 b->n, p)
+#define CALL_her2k(o, s)						\
+  BLAS_##o##her2k##s##_x(CM, blas_upper, NT, b->n, b->n, ALPHA_##o(b), \
+			 b->in1, b->n, b->in2, b->n, RBETA_##o(b), b->out, \
+			 b->n, p)
+
+#define WRAPPER(fam, o, a, c, s)					\
+  static void run_##o##fam##s(struct bench *b, enum blas_prec_type p)	\
+  {									\
+    CALL_##fam(o, s);							\
+  }
+
+#define ENTRY(fam, o, a, c, s)						\
+  { "BLAS_" #o #fam #s "_x", fam_##fam, #o, #a, #c, run_##o##fam##s },
+
+#define ALL_ROUTINES(F)							\
+  VARIANTS_16(F, dot) VARIANTS_4(F, sum) VARIANTS_8(F, axpby)		\
+  VARIANTS_16(F, waxpby) VARIANTS_16(F, gemv) VARIANTS_16(F, gemv2)	\
+  VARIANTS_16(F, ge_sum_mv) VARIANTS_16(F, gbmv) VARIANTS_16(F, gbmv2)	\
+  VARIANTS_16(F, symv) VARIANTS_16(F, symv2) VARIANTS_16(F, spmv)	\
+  VARIANTS_16(F, sbmv) VARIANTS_HERM(F, hemv) VARIANTS_HERM(F, hemv2)	\
+  VARIANTS_HERM(F, hpmv) VARIANTS_HERM(F, hbmv) VARIANTS_8(F, trmv)	\
+  VARIANTS_8(F, tpmv) VARIANTS_8(F, trsv) VARIANTS_8(F, tbsv)		\
+  VARIANTS_16(F, gemm) VARIANTS_16(F, symm) VARIANTS_HERM(F, hemm)	\
+  VARIANTS_8(F, trsm) VARIANTS_8(F, syrk) VARIANTS_HERK(F, herk)	\
+  VARIANTS_8_2(F, syr2k) VARIANTS_HER2K(F, her2k)
+
+ALL_ROUTINES(WRAPPER)
+
+struct routine {
+  const char *name;
+  enum family fam;
+  const char *out, *in1, *in2;	/* type letters s, d, c, z */
+  void (*run) (struct bench *b, enum blas_prec_type p);
+};
+
+static const struct routine routines[] = {
+  ALL_ROUTINES(ENTRY)
+};
+
+static double wall(void)
+{
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static size_t elt_size(char type)
+{
+  return (type == 's') ? 4 : (type == 'd' || type == 'c') ? 8 : 16;
+}
+
+/* Fills n elements of the given type with values in [-scale, scale]/2. */
+static void fill(void *p, size_t n, char type, double scale)
+{
+  size_t i, len = (type == 'c' || type == 'z') ? 2 * n : n;
+
+  for (i = 0; i < len; i++) {
+    double v = scale * (rand() / (double) RAND_MAX - 0.5);
+    if (type == 's' || type == 'c')
+      ((float *) p)[i] = v;
+    else
+      ((double *) p)[i] = v;
+  }
+}
+
+static int level(enum family fam)
+{
+  return (fam <= fam_waxpby) ? 1 : (fam >= fam_gemm) ? 3 : 2;
+}
+
+/* Elements of the first operand: a vector, full, packed or band matrix. */
+static size_t in1_elts(enum family fam, size_t n, size_t k)
+{
+  switch (fam) {
+  case fam_spmv:
+  case fam_hpmv:
+  case fam_tpmv:
+    return n * (n + 1) / 2;
+  case fam_gbmv:
+  case fam_gbmv2:
+    return (2 * k + 1) * n;
+  case fam_sbmv:
+  case fam_hbmv:
+  case fam_tbsv:
+    return (k + 1) * n;
+  default:
+    return (level(fam) == 1) ? n : n * n;
+  }
+}
+
+/* Elements of in1 actually read: triangles of full symmetric and
+   triangular matrices count half. */
+static double in1_read(enum family fam, double n, double k)
+{
+  switch (fam) {
+  case fam_symv:
+  case fam_symv2:
+  case fam_hemv:
+  case fam_hemv2:
+  case fam_trmv:
+  case fam_trsv:
+  case fam_symm:
+  case fam_hemm:
+  case fam_trsm:
+    return n * (n + 1) / 2;
+  default:
+    return in1_elts(fam, n, k);
+  }
+}
+
+/* Real multiply-adds, or complex ones for a complex output. */
+static double madds(enum family fam, double n, double k)
+{
+  switch (fam) {
+  case fam_dot:
+  case fam_sum:
+    return n;
+  case fam_axpby:
+  case fam_waxpby:
+    return 2 * n;
+  case fam_ge_sum_mv:
+    return 2 * n * n;
+  case fam_gbmv:
+  case fam_gbmv2:
+    return (2 * k + 1) * n;
+  case fam_sbmv:
+  case fam_hbmv:
+    return (2 * k + 1) * n;
+  case fam_trmv:
+  case fam_tpmv:
+  case fam_trsv:
+    return n * (n + 1) / 2;
+  case fam_tbsv:
+    return (k + 1) * n;
+  case fam_trsm:
+  case fam_syrk:
+  case fam_herk:
+    return n * n * (n + 1) / 2;
+  case fam_syr2k:
+  case fam_her2k:
+    return n * n * (n + 1);
+  case fam_gemm:
+  case fam_symm:
+  case fam_hemm:
+    return n * n * n;
+  default:
+    return n * n;
+  }
+}
+
+static double bytes(const struct routine *r, double n, double k)
+{
+  double s1 = elt_size(r->in1[0]), s2 = elt_size(r->in2[0]);
+  double so = elt_size(r->out[0]);
+  double m = (level(r->fam) == 3) ? n * n : n;
+  double t = in1_read(r->fam, n, k) * s1;
+
+  switch (r->fam) {
+  case fam_sum:
+    return t;
+  case fam_dot:
+    return t + n * s2;
+  case fam_axpby:
+  case fam_trmv:
+  case fam_tpmv:
+  case fam_trsv:
+  case fam_tbsv:
+  case fam_trsm:
+    return t + 2 * m * so;
+  case fam_syrk:
+  case fam_herk:
+    return t + n * (n + 1) * so;
+  case fam_syr2k:
+  case fam_her2k:
+    return t + m * s2 + n * (n + 1) * so;
+  case fam_ge_sum_mv:
+    return 2 * t + n * s2 + 2 * n * so;
+  case fam_gemv2:
+  case fam_gbmv2:
+  case fam_symv2:
+  case fam_hemv2:
+    return t + 2 * n * s2 + 2 * n * so;
+  case fam_waxpby:
+    return t + n * s2 + n * so;
+  default:
+    return t + m * s2 + 2 * m * so;
+  }
+}
+
+static const char *prec_name(enum blas_prec_type prec)
+{
+  switch (prec) {
+  case blas_prec_single:
+    return "single";
+  case blas_prec_double:
+    return "double";
+  default:
+    return "extra";
+  }
+}
+
+static double min_time = 0.05;
+
+/* Seconds per call of r on b in precision p. */
+static double time_call(const struct routine *r, struct bench *b,
+			enum blas_prec_type p, size_t save_bytes)
+{
+  double t0, t;
+  long reps = 0;
+
+  /* One untimed call to fault in the operands and the code. */
+  if (save_bytes > 0)
+    memcpy(b->out, b->save, save_bytes);
+  r->run(b, p);
+
+  t0 = wall();
+  do {
+    if (save_bytes > 0)
+      memcpy(b->out, b->save, save_bytes);
+    r->run(b, p);
+    reps++;
+    t = wall() - t0;
+  } while (t < min_time);
+  return t / reps;
+}
+
+static void run(const struct routine *r, int n)
+{
+  static const enum blas_prec_type precs[3] = {
+    blas_prec_single, blas_prec_double, blas_prec_extra
+  };
+  struct bench b;
+  int k = (n - 1 < BENCH_BAND) ? n - 1 : BENCH_BAND;
+  int in_place = ((r->fam >= fam_trmv && r->fam <= fam_tbsv)
+		  || r->fam == fam_trsm);
+  size_t vec = (level(r->fam) == 3) ? (size_t) n * n : (size_t) n;
+  size_t mat = in1_elts(r->fam, n, k);
+  size_t sum_mat = (r->fam == fam_ge_sum_mv) ? mat : 1;
+  double scale = 1.0, t[3], flops;
+  int i;
+
+  /* Keep the solves from growing x without bound. */
+  if (r->fam == fam_trsv || r->fam == fam_trsm)
+    scale = 1.0 / n;
+  else if (r->fam == fam_tbsv)
+    scale = 1.0 / (k + 1);
+
+  b.n = n;
+  b.k = k;
+  b.alpha_s = 1.5f;
+  b.beta_s = 0.5f;
+  b.alpha_d = 1.5;
+  b.beta_d = 0.5;
+  b.alpha_c[0] = 1.5f;
+  b.alpha_c[1] = -0.5f;
+  b.beta_c[0] = 0.5f;
+  b.beta_c[1] = 0.25f;
+  b.alpha_z[0] = 1.5;
+  b.alpha_z[1] = -0.5;
+  b.beta_z[0] = 0.5;
+  b.beta_z[1] = 0.25;
+  b.in1 = malloc(mat * elt_size(r->in1[0]));
+  b.in2 = malloc(vec * elt_size(r->in2[0]));
+  b.in3 = malloc(sum_mat * elt_size(r->in1[0]));
+  b.in4 = malloc(vec * elt_size(r->in2[0]));
+  b.out = malloc(vec * elt_size(r->out[0]));
+  b.save = malloc(vec * elt_size(r->out[0]));
+  if (!b.in1 || !b.in2 || !b.in3 || !b.in4 || !b.out || !b.save) {
+    fprintf(stderr, "%s: out of memory at n = %d\n", r->name, n);
+    exit(1);
+  }
+  fill(b.in1, mat, r->in1[0], scale);
+  fill(b.in2, vec, r->in2[0], 1.0);
+  fill(b.in3, sum_mat, r->in1[0], 1.0);
+  fill(b.in4, vec, r->in2[0], 1e-16);
+  fill(b.out, vec, r->out[0], 1.0);
+  memcpy(b.save, b.out, vec * elt_size(r->out[0]));
+
+  for (i = 0; i < 3; i++)
+    t[i] = time_call(r, &b, precs[i],
+		     in_place ? vec * elt_size(r->out[0]) : 0);
+
+  flops = madds(r->fam, n, k);
+  flops *= (r->out[0] == 'c' || r->out[0] == 'z') ? 8 : 2;
+  for (i = 0; i < 3; i++)
+    printf("%s,%s,%s,%d,%.3e,%.3f,%.3f,%.2f\n", r->name,
+	   family_names[r->fam], prec_name(precs[i]), n, t[i],
+	   flops / t[i] * 1e-9, bytes(r, n, k) / t[i] * 1e-9,
+	   t[2] / t[1]);
+  fflush(stdout);
+
+  free(b.in1);
+  free(b.in2);
+  free(b.in3);
+  free(b.in4);
+  free(b.out);
+  free(b.save);
+}
+
+int main(int argc, char **argv)
+{
+  static const int sizes[4][6] = {
+    {0},
+    {256, 4096, 65536, 1 << 20, 1 << 22, 0},
+    {32, 128, 512, 2048, 0},
+    {32, 96, 256, 512, 0}
+  };
+  int want[fam_count], user_sizes[16];
+  int i, f, nfam = 0, nsizes = 0;
+  size_t j;
+
+  for (f = 0; f < fam_count; f++)
+    want[f] = 0;
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      min_time = atof(argv[++i]);
+      continue;
+    }
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc && nsizes < 15) {
+      user_sizes[nsizes++] = atoi(argv[++i]);
+      continue;
+    }
+    for (f = 0; f < fam_count; f++)
+      if (strcmp(argv[i], family_names[f]) == 0)
+	break;
+    if (f == fam_count) {
+      fprintf(stderr, "usage: %s [-t seconds] [-n size ...] [family ...]\n",
+	      argv[0]);
+      return 1;
+    }
+    want[f] = 1;
+    nfam++;
+  }
+
+  printf("routine,family,prec,n,seconds,gflops,gbs,extra_over_double\n");
+  for (j = 0; j < sizeof(routines) / sizeof(routines[0]); j++) {
+    const struct routine *r = &routines[j];
+
+    if (nfam > 0 && !want[r->fam])
+      continue;
+    if (nsizes > 0) {
+      for (i = 0; i < nsizes; i++)
+	run(r, user_sizes[i]);
+    } else {
+      for (i = 0; sizes[level(r->fam)][i] != 0; i++)
+	run(r, sizes[level(r->fam)][i]);
+    }
+  }
+  return 0;
+}
@@ -104,6 +104,7 @@ void		BLAS_caxpby_s_x(int n, const void *alpha, const float *x, int incx,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 void		BLAS_saxpby_x(int n, float alpha, const float *x, int incx,
 		    		float		beta  , float *y,
 	     		int		incy    , enum blas_prec_type prec)
@@ -94,6 +95,7 @@ void		BLAS_saxpby_x(int n, float alpha, const float *x, int incx,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -172,44 +174,52 @@ void		BLAS_saxpby_x(int n, float alpha, const float *x, int incx,
       if (incy < 0)
 	iy = (-n + 1) * incy;
 
-      for (i = 0; i < n; ++i) {
-	x_ii = x_i[ix];
-	y_ii = y_i[iy];
-	head_tmpx = (double)alpha_i *x_ii;
-	tail_tmpx = 0.0;	/* tmpx  = alpha * x[ix] */
-	head_tmpy = (double)beta_i *y_ii;
-	tail_tmpy = 0.0;	/* tmpy = beta * y[iy] */
-	{
-	  /* Compute double-double = double-double + double-double. */
-	  double	  bv;
-	  double	  s1    , s2, t1, t2;
-
-	  /* Add two hi words. */
-	  s1 = head_tmpy + head_tmpx;
-	  bv = s1 - head_tmpy;
-	  s2 = ((head_tmpx - bv) + (head_tmpy - (s1 - bv)));
-
-	  /* Add two lo words. */
-	  t1 = tail_tmpy + tail_tmpx;
-	  bv = t1 - tail_tmpy;
-	  t2 = ((tail_tmpx - bv) + (tail_tmpy - (t1 - bv)));
-
-	  s2 += t1;
-
-	  /* Renormalize (s1, s2)  to  (t1, s2) */
-	  t1 = s1 + s2;
-	  s2 = s2 - (t1 - s1);
-
-	  t2 += s2;
-
-	  /* Renormalize (t1, t2)  */
-	  head_tmpy = t1 + t2;
-	  tail_tmpy = t2 - (head_tmpy - t1);
-	}
-	y_i[iy] = head_tmpy;
-	ix += incx;
-	iy += incy;
-      }				/* endfor */
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 1 && incy == 1 && blas_dd_vec_enabled()) {
+	double alpha_d = alpha_i, beta_d = beta_i;
+
+	blas_waxpby_x_kernel(n, &alpha_d, x_i, 1, &beta_d, y_i, 1,
+			     y_i, 1, 0);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii = x_i[ix];
+	  y_ii = y_i[iy];
+	  head_tmpx = (double)alpha_i *x_ii;
+	  tail_tmpx = 0.0;	/* tmpx  = alpha * x[ix] */
+	  head_tmpy = (double)beta_i *y_ii;
+	  tail_tmpy = 0.0;	/* tmpy = beta * y[iy] */
+	  {
+	    /* Compute double-double = double-double + double-double. */
+	    double	  bv;
+	    double	  s1    , s2, t1, t2;
+
+	    /* Add two hi words. */
+	    s1 = head_tmpy + head_tmpx;
+	    bv = s1 - head_tmpy;
+	    s2 = ((head_tmpx - bv) + (head_tmpy - (s1 - bv)));
+
+	    /* Add two lo words. */
+	    t1 = tail_tmpy + tail_tmpx;
+	    bv = t1 - tail_tmpy;
+	    t2 = ((tail_tmpx - bv) + (tail_tmpy - (t1 - bv)));
+
+	    s2 += t1;
+
+	    /* Renormalize (s1, s2)  to  (t1, s2) */
+	    t1 = s1 + s2;
+	    s2 = s2 - (t1 - s1);
+
+	    t2 += s2;
+
+	    /* Renormalize (t1, t2)  */
+	    head_tmpy = t1 + t2;
+	    tail_tmpy = t2 - (head_tmpy - t1);
+	  }
+	  y_i[iy] = head_tmpy;
+	  ix += incx;
+	  iy += incy;
+	}				/* endfor */
+      }
 
       FPU_FIX_STOP;
     }
@@ -28,6 +28,8 @@ int BLAS_fpinfo_x(enum blas_cmach_type cmach, enum blas_prec_type prec)
  *        = blas_prec_extra : anything at least 1.5 times as accurate
  *                            than double, and wider than 80-bits.
  *                            We use double-double in our implementation.
+ *        = blas_prec_reproducible: double precision, reproducibly
+ *                            summed.
  *
  */
 {
@@ -52,6 +54,7 @@ int BLAS_fpinfo_x(enum blas_cmach_type cmach, enum blas_prec_type prec)
 
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     if (cmach == blas_base) {
       rmach = 2;
     } else if (cmach == blas_t) {
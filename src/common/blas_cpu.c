@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include <string.h>
+#include "blas_cpu.h"
+
+#define BLAS_KERNEL_TABLE(isa, lanes, gemm_isa)				\
+  { blas_isa_##isa, #isa, lanes,					\
+    blas_dot_lanes_##isa, blas_dot_dd_lanes_##isa,			\
+    blas_gemv_dd_cols_##isa, blas_symv_dd_lines_##isa,			\
+    blas_zgemv_dd_cols_##isa, blas_zsymv_dd_lines_##isa,		\
+    blas_sum_lanes_##isa, blas_waxpby_##isa,				\
+    blas_repro_max_##isa, blas_repro_deposit_##isa,			\
+    blas_gemm_kernel_d_##gemm_isa, blas_gemm_kernel_dd_##gemm_isa,	\
+    blas_gemm_kernel_dd_exact_##gemm_isa }
+
+/* Indexed by enum blas_cpu_isa. */
+static const struct blas_kernel_table kernel_tables[BLAS_ISA_COUNT] = {
+  BLAS_KERNEL_TABLE(scalar, 2, scalar),
+#ifdef BLAS_CPU_X86
+  BLAS_KERNEL_TABLE(sse2, 2, sse2),
+  BLAS_KERNEL_TABLE(avx2, 4, avx2),
+  BLAS_KERNEL_TABLE(avx512, 8, avx2),
+#endif
+};
+
+static const struct blas_kernel_table *volatile active_table = NULL;
+
+/* Widest instruction set the running CPU supports. */
+static enum blas_cpu_isa detect_isa(void)
+{
+  enum blas_cpu_isa isa = blas_isa_scalar;
+
+#ifdef BLAS_CPU_X86
+  /* The checks include OS support for the wider register files. */
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2"))
+    isa = blas_isa_sse2;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    isa = blas_isa_avx2;
+  if (isa == blas_isa_avx2 && __builtin_cpu_supports("avx512f"))
+    isa = blas_isa_avx512;
+#endif
+  return isa;
+}
+
+static void select_table(void)
+{
+  enum blas_cpu_isa isa = detect_isa();
+  const char *cap = getenv(BLAS_ISA_ENV);
+  int i;
+
+  if (cap != NULL) {
+    for (i = 0; i < BLAS_ISA_COUNT; i++)
+      if (kernel_tables[i].name != NULL
+	  && strcmp(cap, kernel_tables[i].name) == 0 && (int) isa > i)
+	isa = (enum blas_cpu_isa) i;
+  }
+  active_table = &kernel_tables[isa];
+}
+
+#ifdef __GNUC__
+/* Pick the table when the library is loaded, before any thread can race
+   on it; blas_kernels() still covers toolchains without constructors. */
+__attribute__((constructor)) static void blas_cpu_init(void)
+{
+  select_table();
+}
+#endif
+
+const struct blas_kernel_table *blas_kernels(void)
+{
+  if (active_table == NULL)
+    select_table();
+  return active_table;
+}
+
+enum blas_cpu_isa BLAS_get_isa(void)
+{
+  return blas_kernels()->isa;
+}
+
+const char *BLAS_get_isa_name(void)
+{
+  return blas_kernels()->name;
+}
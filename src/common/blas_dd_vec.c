@@ -0,0 +1,698 @@
+#include <math.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_cpu.h"
+#include "blas_threads.h"
+#include "blas_repro.h"
+
+#ifdef BLAS_CPU_X86
+#include <immintrin.h>
+#endif
+
+/* Most lanes any instruction set uses. */
+#define VW_MAX 8
+
+static double vec_elt(const void *p, int single, int j)
+{
+  return single ? (double) ((const float *) p)[j] : ((const double *) p)[j];
+}
+
+#ifdef BLAS_CPU_X86
+
+/* SSE2: two lanes, Dekker products. */
+#define V		__m128d
+#define VW		2
+#define VHAVE_FMA	0
+#define VTARGET		__attribute__((target("sse2")))
+#define VNAME(f)	blas_##f##_sse2
+#define VADD		_mm_add_pd
+#define VSUB		_mm_sub_pd
+#define VMAX		_mm_max_pd
+#define VABS(v)		_mm_andnot_pd(_mm_set1_pd(-0.0), v)
+#define VMUL		_mm_mul_pd
+#define VSET1		_mm_set1_pd
+#define VSETPAIR(a, b)	_mm_set_pd(b, a)
+#define VZERO		_mm_setzero_pd
+#define VLOAD		_mm_loadu_pd
+#define VLOADF(p)	_mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd((const double *) (p))))
+#define VSTORE		_mm_storeu_pd
+#define VSTOREF(p, v)	_mm_store_sd((double *) (p), _mm_castps_pd(_mm_cvtpd_ps(v)))
+#define VSWAP(v)	_mm_shuffle_pd(v, v, 1)
+#define VDUPRE(v)	_mm_unpacklo_pd(v, v)
+#define VDUPIM(v)	_mm_unpackhi_pd(v, v)
+#include "blas_dd_vec_body.h"
+#undef V
+#undef VW
+#undef VHAVE_FMA
+#undef VTARGET
+#undef VNAME
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VABS
+#undef VMUL
+#undef VSET1
+#undef VSETPAIR
+#undef VZERO
+#undef VLOAD
+#undef VLOADF
+#undef VSTORE
+#undef VSTOREF
+#undef VSWAP
+#undef VDUPRE
+#undef VDUPIM
+
+/* AVX2 + FMA: four lanes. */
+#define V		__m256d
+#define VW		4
+#define VHAVE_FMA	1
+#define VTARGET		__attribute__((target("avx2,fma")))
+#define VNAME(f)	blas_##f##_avx2
+#define VADD		_mm256_add_pd
+#define VSUB		_mm256_sub_pd
+#define VMAX		_mm256_max_pd
+#define VABS(v)		_mm256_andnot_pd(_mm256_set1_pd(-0.0), v)
+#define VMUL		_mm256_mul_pd
+#define VFMS		_mm256_fmsub_pd
+#define VSET1		_mm256_set1_pd
+#define VSETPAIR(a, b)	_mm256_set_pd(b, a, b, a)
+#define VZERO		_mm256_setzero_pd
+#define VLOAD		_mm256_loadu_pd
+#define VLOADF(p)	_mm256_cvtps_pd(_mm_loadu_ps(p))
+#define VSTORE		_mm256_storeu_pd
+#define VSTOREF(p, v)	_mm_storeu_ps(p, _mm256_cvtpd_ps(v))
+#define VSWAP(v)	_mm256_permute_pd(v, 0x5)
+#define VDUPRE(v)	_mm256_movedup_pd(v)
+#define VDUPIM(v)	_mm256_permute_pd(v, 0xf)
+#include "blas_dd_vec_body.h"
+#undef V
+#undef VW
+#undef VHAVE_FMA
+#undef VTARGET
+#undef VNAME
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VABS
+#undef VMUL
+#undef VFMS
+#undef VSET1
+#undef VSETPAIR
+#undef VZERO
+#undef VLOAD
+#undef VLOADF
+#undef VSTORE
+#undef VSTOREF
+#undef VSWAP
+#undef VDUPRE
+#undef VDUPIM
+
+/* AVX-512F: eight lanes. */
+#define V		__m512d
+#define VW		8
+#define VHAVE_FMA	1
+#define VTARGET		__attribute__((target("avx512f")))
+#define VNAME(f)	blas_##f##_avx512
+#define VADD		_mm512_add_pd
+#define VSUB		_mm512_sub_pd
+#define VMAX		_mm512_max_pd
+#define VABS(v)		_mm512_abs_pd(v)
+#define VMUL		_mm512_mul_pd
+#define VFMS		_mm512_fmsub_pd
+#define VSET1		_mm512_set1_pd
+#define VSETPAIR(a, b)	_mm512_set_pd(b, a, b, a, b, a, b, a)
+#define VZERO		_mm512_setzero_pd
+#define VLOAD		_mm512_loadu_pd
+#define VLOADF(p)	_mm512_cvtps_pd(_mm256_loadu_ps(p))
+#define VSTORE		_mm512_storeu_pd
+#define VSTOREF(p, v)	_mm256_storeu_ps(p, _mm512_cvtpd_ps(v))
+#define VSWAP(v)	_mm512_permute_pd(v, 0x55)
+#define VDUPRE(v)	_mm512_movedup_pd(v)
+#define VDUPIM(v)	_mm512_permute_pd(v, 0xff)
+#include "blas_dd_vec_body.h"
+#undef V
+#undef VW
+#undef VHAVE_FMA
+#undef VTARGET
+#undef VNAME
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VABS
+#undef VMUL
+#undef VFMS
+#undef VSET1
+#undef VSETPAIR
+#undef VZERO
+#undef VLOAD
+#undef VLOADF
+#undef VSTORE
+#undef VSTOREF
+#undef VSWAP
+#undef VDUPRE
+#undef VDUPIM
+
+#endif /* BLAS_CPU_X86 */
+
+/* Scalar entries of the table: two lanes, split by the parity of the
+   index, so complex data keeps its real and imaginary parts apart. */
+void blas_dot_lanes_scalar(int len, const void *x, int x_single,
+			   const void *y, int y_single, int is_complex,
+			   double *hl, double *tl, double *gl, double *ul)
+{
+  int j;
+
+  hl[0] = hl[1] = tl[0] = tl[1] = 0.0;
+  gl[0] = gl[1] = ul[0] = ul[1] = 0.0;
+  if (x_single && y_single) {
+    /* Exact products. */
+    const float *xf = (const float *) x, *yf = (const float *) y;
+
+    for (j = 0; j < len; j++) {
+      blas_dd_add_d(hl[j & 1], tl[j & 1], (double) xf[j] * yf[j],
+		    &hl[j & 1], &tl[j & 1]);
+      if (is_complex)
+	blas_dd_add_d(gl[j & 1], ul[j & 1], (double) xf[j] * yf[j ^ 1],
+		      &gl[j & 1], &ul[j & 1]);
+    }
+    return;
+  }
+  for (j = 0; j < len; j++) {
+    double head_prod, tail_prod;
+    double xv = vec_elt(x, x_single, j);
+
+    blas_dd_two_prod(xv, vec_elt(y, y_single, j), &head_prod, &tail_prod);
+    blas_dd_add_lazy(hl[j & 1], tl[j & 1], head_prod, tail_prod,
+		     &hl[j & 1], &tl[j & 1]);
+    if (is_complex) {
+      blas_dd_two_prod(xv, vec_elt(y, y_single, j ^ 1),
+		       &head_prod, &tail_prod);
+      blas_dd_add_lazy(gl[j & 1], ul[j & 1], head_prod, tail_prod,
+		       &gl[j & 1], &ul[j & 1]);
+    }
+  }
+}
+
+void blas_dot_dd_lanes_scalar(int len, const void *t, int t_single,
+			      const double *head_x, const double *tail_x,
+			      double *hl, double *tl)
+{
+  int j;
+
+  hl[0] = hl[1] = tl[0] = tl[1] = 0.0;
+  for (j = 0; j < len; j++) {
+    double head_prod, tail_prod;
+
+    blas_dd_mul_d(head_x[j], tail_x[j], vec_elt(t, t_single, j),
+		  &head_prod, &tail_prod);
+    blas_dd_add_lazy(hl[j & 1], tl[j & 1], head_prod, tail_prod,
+		     &hl[j & 1], &tl[j & 1]);
+  }
+}
+
+void blas_gemv_dd_cols_scalar(int len, int ncols, const void *t,
+			      int t_single, int ldt,
+			      const double *head_x, const double *tail_x,
+			      int x_single, double *hu, double *tu)
+{
+  int r, c;
+
+  for (c = 0; c < ncols; c++) {
+    for (r = 0; r < len; r++) {
+      double head_prod, tail_prod;
+
+      if (t_single && x_single) {
+	blas_dd_add_d(hu[r], tu[r],
+		      ((const float *) t)[r + c * ldt] * head_x[c],
+		      &hu[r], &tu[r]);
+	continue;
+      }
+      blas_dd_mul_d(head_x[c], tail_x[c], vec_elt(t, t_single, r + c * ldt),
+		    &head_prod, &tail_prod);
+      blas_dd_add_lazy(hu[r], tu[r], head_prod, tail_prod, &hu[r], &tu[r]);
+    }
+  }
+}
+
+void blas_symv_dd_lines_scalar(int len, int ncols, const void *t,
+			       int t_single, int ldt, const double *xr,
+			       const double *xc, int x_single,
+			       double *hu, double *tu, double *hl, double *tl)
+{
+  int r, c;
+
+  for (c = 0; c < 2 * ncols; c++)
+    hl[c] = tl[c] = 0.0;
+  for (r = 0; r < len; r++) {
+    for (c = 0; c < ncols; c++) {
+      double head_prod, tail_prod;
+      double tv = vec_elt(t, t_single, r + c * ldt);
+      int l = 2 * c + (r & 1);
+
+      if (t_single && x_single) {
+	blas_dd_add_d(hu[r], tu[r], tv * xc[c], &hu[r], &tu[r]);
+	blas_dd_add_d(hl[l], tl[l], tv * xr[r], &hl[l], &tl[l]);
+	continue;
+      }
+      blas_dd_two_prod(tv, xc[c], &head_prod, &tail_prod);
+      blas_dd_add_lazy(hu[r], tu[r], head_prod, tail_prod, &hu[r], &tu[r]);
+      blas_dd_two_prod(tv, xr[r], &head_prod, &tail_prod);
+      blas_dd_add_lazy(hl[l], tl[l], head_prod, tail_prod, &hl[l], &tl[l]);
+    }
+  }
+}
+
+void blas_zgemv_dd_cols_scalar(int len, int ncols, const void *t,
+			       int t_single, int ldt, const double *x,
+			       int conj, int exact, double *hu, double *tu)
+{
+  int r, c, k;
+
+  for (c = 0; c < ncols; c++) {
+    for (r = 0; r < len; r++) {
+      double head_prod[2], tail_prod[2];
+      long off = 2 * (r + (long) c * ldt);
+      double a1 = vec_elt(t, t_single, off + 1);
+
+      blas_dd_cmul(vec_elt(t, t_single, off), conj ? -a1 : a1, x[2 * c],
+		   x[2 * c + 1], exact, head_prod, tail_prod);
+      for (k = 0; k < 2; k++)
+	blas_dd_add_lazy(hu[2 * r + k], tu[2 * r + k], head_prod[k],
+			 tail_prod[k], &hu[2 * r + k], &tu[2 * r + k]);
+    }
+  }
+}
+
+void blas_zsymv_dd_lines_scalar(int len, int ncols, const void *t,
+				int t_single, int ldt, const double *xr,
+				const double *xc, int conj_row,
+				int conj_line, int exact, double *hu,
+				double *tu, double *hl, double *tl)
+{
+  int r, c, k;
+
+  for (c = 0; c < 2 * ncols; c++)
+    hl[c] = tl[c] = 0.0;
+  for (r = 0; r < len; r++) {
+    for (c = 0; c < ncols; c++) {
+      double head_prod[2], tail_prod[2];
+      long off = 2 * (r + (long) c * ldt);
+      double a0 = vec_elt(t, t_single, off), a1 = vec_elt(t, t_single,
+							    off + 1);
+
+      blas_dd_cmul(a0, conj_row ? -a1 : a1, xc[2 * c], xc[2 * c + 1],
+		   exact, head_prod, tail_prod);
+      for (k = 0; k < 2; k++)
+	blas_dd_add_lazy(hu[2 * r + k], tu[2 * r + k], head_prod[k],
+			 tail_prod[k], &hu[2 * r + k], &tu[2 * r + k]);
+      blas_dd_cmul(a0, conj_line ? -a1 : a1, xr[2 * r], xr[2 * r + 1],
+		   exact, head_prod, tail_prod);
+      for (k = 0; k < 2; k++)
+	blas_dd_add_lazy(hl[2 * c + k], tl[2 * c + k], head_prod[k],
+			 tail_prod[k], &hl[2 * c + k], &tl[2 * c + k]);
+    }
+  }
+}
+
+void blas_sum_lanes_scalar(int len, const void *x, int x_single,
+			   double *hl, double *tl)
+{
+  int j;
+
+  hl[0] = hl[1] = tl[0] = tl[1] = 0.0;
+  for (j = 0; j < len; j++)
+    blas_dd_add_d(hl[j & 1], tl[j & 1], vec_elt(x, x_single, j),
+		  &hl[j & 1], &tl[j & 1]);
+}
+
+double blas_repro_max_scalar(int len, const double *x, const double *y,
+			     int *finite)
+{
+  double m = 0.0, z = 0.0;
+  int j;
+
+  for (j = 0; j < len; j++) {
+    double v = (y != NULL) ? x[j] * y[j] : x[j];
+
+    m = MAX(m, fabs(v));
+    z += v * 0.0;
+  }
+  *finite = (z == z);
+  return m;
+}
+
+void blas_repro_deposit_scalar(int len, const double *x, const double *y,
+			       const double *sigma, double *s)
+{
+  int j, k;
+
+  for (k = 0; k < BLAS_REPRO_FOLD; k++)
+    s[k] = 0.0;
+  for (j = 0; j < len; j++)
+    blas_repro_deposit1((y != NULL) ? x[j] * y[j] : x[j], sigma, s);
+}
+
+/* Elements [i, len) of w <- alpha * x + beta * y, as zaxpby_x does them. */
+static void waxpby_tail(int i, int len, const double *alpha,
+			const void *x, int x_single, const double *beta,
+			const void *y, int y_single, void *w, int w_single,
+			int is_complex)
+{
+  int step = is_complex ? 2 : 1;
+
+  for (; i < len; i += step) {
+    double head_x[2], tail_x[2], head_y[2], tail_y[2];
+    double head_t, tail_t;
+    double x0 = vec_elt(x, x_single, i), y0 = vec_elt(y, y_single, i);
+    int l;
+
+    blas_dd_two_prod(alpha[0], x0, &head_x[0], &tail_x[0]);
+    blas_dd_two_prod(beta[0], y0, &head_y[0], &tail_y[0]);
+    if (is_complex) {
+      double x1 = vec_elt(x, x_single, i + 1);
+      double y1 = vec_elt(y, y_single, i + 1);
+
+      blas_dd_two_prod(alpha[0], x1, &head_x[1], &tail_x[1]);
+      blas_dd_two_prod(beta[0], y1, &head_y[1], &tail_y[1]);
+
+      blas_dd_two_prod(x1, -alpha[1], &head_t, &tail_t);
+      blas_dd_add(head_x[0], tail_x[0], head_t, tail_t,
+		  &head_x[0], &tail_x[0]);
+      blas_dd_two_prod(x0, alpha[1], &head_t, &tail_t);
+      blas_dd_add(head_x[1], tail_x[1], head_t, tail_t,
+		  &head_x[1], &tail_x[1]);
+      blas_dd_two_prod(y1, -beta[1], &head_t, &tail_t);
+      blas_dd_add(head_y[0], tail_y[0], head_t, tail_t,
+		  &head_y[0], &tail_y[0]);
+      blas_dd_two_prod(y0, beta[1], &head_t, &tail_t);
+      blas_dd_add(head_y[1], tail_y[1], head_t, tail_t,
+		  &head_y[1], &tail_y[1]);
+    }
+    for (l = 0; l < step; l++) {
+      blas_dd_add(head_y[l], tail_y[l], head_x[l], tail_x[l],
+		  &head_t, &tail_t);
+      if (w_single)
+	((float *) w)[i + l] = head_t;
+      else
+	((double *) w)[i + l] = head_t;
+    }
+  }
+}
+
+int blas_waxpby_scalar(int len, const double *alpha,
+		       const void *x, int x_single,
+		       const double *beta,
+		       const void *y, int y_single,
+		       void *w, int w_single, int is_complex)
+{
+  waxpby_tail(0, len, alpha, x, x_single, beta, y, y_single,
+	      w, w_single, is_complex);
+  return len;
+}
+
+/* Lanes summed in order: even lanes into part 0 and odd lanes into
+   part 1, or all into part 0 for real data. */
+static void merge_lanes(int nl, const double *hl, const double *tl,
+			int is_complex, double *head, double *tail)
+{
+  int l;
+
+  head[0] = tail[0] = 0.0;
+  if (is_complex)
+    head[1] = tail[1] = 0.0;
+  for (l = 0; l < nl; l++) {
+    int part = is_complex ? (l & 1) : 0;
+
+    blas_dd_add(head[part], tail[part], hl[l], tl[l],
+		&head[part], &tail[part]);
+  }
+}
+
+int blas_dd_vec_enabled(void)
+{
+  return blas_kernels()->isa != blas_isa_scalar;
+}
+
+void blas_dot_x_kernel(int n, const void *x, int x_single,
+		       const void *y, int y_single, int is_complex,
+		       enum blas_conj_type conj,
+		       double *head_sum, double *tail_sum)
+{
+  const struct blas_kernel_table *kt = blas_kernels();
+  double hl[VW_MAX], tl[VW_MAX], gl[VW_MAX], ul[VW_MAX];
+
+  kt->dot_lanes(is_complex ? 2 * n : n, x, x_single, y, y_single,
+		is_complex, hl, tl, gl, ul);
+
+  if (!is_complex) {
+    merge_lanes(kt->lanes, hl, tl, 0, head_sum, tail_sum);
+  } else {
+    /* Even lanes hold xr*yr and xr*yi, odd lanes xi*yi and xi*yr. */
+    double head_re[2], tail_re[2], head_im[2], tail_im[2];
+    double sign = (conj == blas_conj) ? 1.0 : -1.0;
+
+    merge_lanes(kt->lanes, hl, tl, 1, head_re, tail_re);
+    merge_lanes(kt->lanes, gl, ul, 1, head_im, tail_im);
+    blas_dd_add(head_re[0], tail_re[0], sign * head_re[1],
+		sign * tail_re[1], &head_sum[0], &tail_sum[0]);
+    blas_dd_add(head_im[0], tail_im[0], -sign * head_im[1],
+		-sign * tail_im[1], &head_sum[1], &tail_sum[1]);
+  }
+}
+
+void blas_dot_dd_x_kernel(int n, const void *t, int t_single,
+			  const double *head_x, const double *tail_x,
+			  double *head_sum, double *tail_sum)
+{
+  const struct blas_kernel_table *kt = blas_kernels();
+  double hl[VW_MAX], tl[VW_MAX];
+
+  kt->dot_dd_lanes(n, t, t_single, head_x, tail_x, hl, tl);
+  merge_lanes(kt->lanes, hl, tl, 0, head_sum, tail_sum);
+}
+
+void blas_gemv_dd_cols_x_kernel(int m, int n, const void *t, int t_single,
+				int ldt, const double *head_x,
+				const double *tail_x, int x_single,
+				double *head_y, double *tail_y)
+{
+  blas_kernels()->gemv_dd_cols(m, n, t, t_single, ldt, head_x, tail_x,
+			       x_single, head_y, tail_y);
+}
+
+void blas_symv_dd_lines_x_kernel(int m, int ncols, const void *t,
+				 int t_single, int ldt, const double *xr,
+				 const double *xc, int x_single,
+				 double *head_y, double *tail_y,
+				 double *head_dot, double *tail_dot)
+{
+  const struct blas_kernel_table *kt = blas_kernels();
+  double hl[VW_MAX * BLAS_SYMV_DD_LINES], tl[VW_MAX * BLAS_SYMV_DD_LINES];
+  int c;
+
+  kt->symv_dd_lines(m, ncols, t, t_single, ldt, xr, xc, x_single,
+		    head_y, tail_y, hl, tl);
+  for (c = 0; c < ncols; c++)
+    merge_lanes(kt->lanes, hl + c * kt->lanes, tl + c * kt->lanes, 0,
+		&head_dot[c], &tail_dot[c]);
+}
+
+void blas_zgemv_dd_cols_x_kernel(int m, int n, const void *t, int t_single,
+				 int ldt, const double *x, int conj,
+				 int exact, double *head_y, double *tail_y)
+{
+  blas_kernels()->zgemv_dd_cols(m, n, t, t_single, ldt, x, conj, exact,
+				head_y, tail_y);
+}
+
+void blas_zsymv_dd_lines_x_kernel(int m, int ncols, const void *t,
+				  int t_single, int ldt, const double *xr,
+				  const double *xc, int conj_row,
+				  int conj_line, int exact, double *head_y,
+				  double *tail_y, double *head_dot,
+				  double *tail_dot)
+{
+  const struct blas_kernel_table *kt = blas_kernels();
+  double hl[VW_MAX * BLAS_SYMV_DD_LINES], tl[VW_MAX * BLAS_SYMV_DD_LINES];
+  int c;
+
+  kt->zsymv_dd_lines(m, ncols, t, t_single, ldt, xr, xc, conj_row,
+		     conj_line, exact, head_y, tail_y, hl, tl);
+  for (c = 0; c < ncols; c++) {
+    double head[2], tail[2];
+
+    merge_lanes(kt->lanes, hl + c * kt->lanes, tl + c * kt->lanes, 1,
+		head, tail);
+    head_dot[2 * c] = head[0];
+    head_dot[2 * c + 1] = head[1];
+    tail_dot[2 * c] = tail[0];
+    tail_dot[2 * c + 1] = tail[1];
+  }
+}
+
+void blas_sum_x_kernel(int n, const void *x, int x_single, int is_complex,
+		       double *head_sum, double *tail_sum)
+{
+  const struct blas_kernel_table *kt = blas_kernels();
+  double hl[VW_MAX], tl[VW_MAX];
+
+  kt->sum_lanes(is_complex ? 2 * n : n, x, x_single, hl, tl);
+  merge_lanes(kt->lanes, hl, tl, is_complex, head_sum, tail_sum);
+}
+
+void blas_waxpby_x_kernel(int n, const double *alpha,
+			  const void *x, int x_single,
+			  const double *beta,
+			  const void *y, int y_single,
+			  void *w, int w_single, int is_complex)
+{
+  int len = is_complex ? 2 * n : n;
+  int done;
+
+  done = blas_kernels()->waxpby(len, alpha, x, x_single, beta, y, y_single,
+				w, w_single, is_complex);
+  waxpby_tail(done, len, alpha, x, x_single, beta, y, y_single,
+	      w, w_single, is_complex);
+}
+
+/* One chunked reduction; y is NULL for a sum. */
+struct par_job {
+  int n, chunk;
+  const void *x, *y;
+  int x_single, y_single, is_complex;
+  enum blas_conj_type conj;
+  int plain;			/* summed in double, tails unused */
+  double *head, *tail;		/* two per chunk */
+};
+
+/* A chunk summed as the double loops of the routines sum it: each
+   product rounded to double and added in index order. */
+static void plain_chunk(const struct par_job *job, const void *x,
+			const void *y, int len, double *sum)
+{
+  double re = 0.0, im = 0.0, xr, xi, yr, yi;
+  int i;
+
+  for (i = 0; i < len; i++) {
+    if (!job->is_complex) {
+      xr = vec_elt(x, job->x_single, i);
+      re = re + (y == NULL ? xr : xr * vec_elt(y, job->y_single, i));
+      continue;
+    }
+    xr = vec_elt(x, job->x_single, 2 * i);
+    xi = vec_elt(x, job->x_single, 2 * i + 1);
+    if (y == NULL) {
+      re = re + xr;
+      im = im + xi;
+      continue;
+    }
+    if (job->conj == blas_conj)
+      xi = -xi;
+    yr = vec_elt(y, job->y_single, 2 * i);
+    yi = vec_elt(y, job->y_single, 2 * i + 1);
+    re = re + (xr * yr - xi * yi);
+    im = im + (xr * yi + xi * yr);
+  }
+  sum[0] = re;
+  sum[1] = im;
+}
+
+static void par_task(void *arg, int task, int worker)
+{
+  const struct par_job *job = (const struct par_job *) arg;
+  int i0 = task * job->chunk;
+  int len = MIN(job->chunk, job->n - i0);
+  size_t w = job->is_complex ? 2 : 1;
+  const char *x = (const char *) job->x
+    + i0 * w * (job->x_single ? sizeof(float) : sizeof(double));
+  FPU_FIX_DECL;
+
+  (void) worker;
+  FPU_FIX_START;
+  if (job->plain) {
+    const void *y = (job->y == NULL) ? NULL : (const char *) job->y
+      + i0 * w * (job->y_single ? sizeof(float) : sizeof(double));
+
+    plain_chunk(job, x, y, len, job->head + 2 * task);
+  } else if (job->y == NULL) {
+    blas_sum_x_kernel(len, x, job->x_single, job->is_complex,
+		      job->head + 2 * task, job->tail + 2 * task);
+  } else {
+    const char *y = (const char *) job->y
+      + i0 * w * (job->y_single ? sizeof(float) : sizeof(double));
+
+    blas_dot_x_kernel(len, x, job->x_single, y, job->y_single,
+		      job->is_complex, job->conj,
+		      job->head + 2 * task, job->tail + 2 * task);
+  }
+  FPU_FIX_STOP;
+}
+
+static void par_run(struct par_job *job, double *head_sum, double *tail_sum)
+{
+  double head[2 * BLAS_DD_PAR_MAX_CHUNKS], tail[2 * BLAS_DD_PAR_MAX_CHUNKS];
+  int nchunks, s, i, p;
+
+  /* Whole vectors per chunk, and no more chunks than partials. */
+  nchunks = (job->n + BLAS_DD_PAR_CHUNK - 1) / BLAS_DD_PAR_CHUNK;
+  if (nchunks > BLAS_DD_PAR_MAX_CHUNKS)
+    nchunks = BLAS_DD_PAR_MAX_CHUNKS;
+  job->chunk = ((job->n + nchunks - 1) / nchunks + 7) & ~7;
+  nchunks = (job->n + job->chunk - 1) / job->chunk;
+  job->plain = (tail_sum == NULL);
+  job->head = head;
+  job->tail = tail;
+
+  blas_parallel_for(nchunks, blas_parallel_workers(nchunks), par_task, job);
+
+  /* (0 + 1) + (2 + 3), and so on up the tree. */
+  for (s = 1; s < nchunks; s *= 2)
+    for (i = 0; i + s < nchunks; i += 2 * s)
+      for (p = 0; p <= job->is_complex; p++)
+	if (job->plain)
+	  head[2 * i + p] = head[2 * i + p] + head[2 * (i + s) + p];
+	else
+	  blas_dd_add(head[2 * i + p], tail[2 * i + p],
+		      head[2 * (i + s) + p], tail[2 * (i + s) + p],
+		      &head[2 * i + p], &tail[2 * i + p]);
+
+  for (p = 0; p <= job->is_complex; p++) {
+    head_sum[p] = head[p];
+    if (tail_sum != NULL)
+      tail_sum[p] = tail[p];
+  }
+}
+
+void blas_dot_x_par(int n, const void *x, int x_single,
+		    const void *y, int y_single, int is_complex,
+		    enum blas_conj_type conj,
+		    double *head_sum, double *tail_sum)
+{
+  struct par_job job;
+
+  job.n = n;
+  job.x = x;
+  job.x_single = x_single;
+  job.y = y;
+  job.y_single = y_single;
+  job.is_complex = is_complex;
+  job.conj = conj;
+  par_run(&job, head_sum, tail_sum);
+}
+
+void blas_sum_x_par(int n, const void *x, int x_single, int is_complex,
+		    double *head_sum, double *tail_sum)
+{
+  struct par_job job;
+
+  job.n = n;
+  job.x = x;
+  job.x_single = x_single;
+  job.y = NULL;
+  job.y_single = 0;
+  job.is_complex = is_complex;
+  job.conj = blas_no_conj;
+  par_run(&job, head_sum, tail_sum);
+}
@@ -0,0 +1,650 @@
+/*
+ * Vector bodies of the double-double level-1 kernels.
+ *
+ * Included by blas_dd_vec.c once per instruction set, with V (vector of
+ * VW doubles), the V* operations, VNAME() and VTARGET defined; the
+ * functions are the entries of that set's struct blas_kernel_table.  The main
+ * loops run two vectors per step so two independent accumulator sets are
+ * in flight; leftovers are folded into the matching lane with the scalar
+ * primitives, and the caller merges the lanes in a fixed order.
+ */
+
+#if VHAVE_FMA
+#define VTWO_PROD(a, b, p, e)						\
+  do {									\
+    (p) = VMUL(a, b);							\
+    (e) = VFMS(a, b, p);						\
+  } while (0)
+#else
+#define VTWO_PROD(a, b, p, e)						\
+  do {									\
+    V con_, a1_, a2_, b1_, b2_;						\
+    con_ = VMUL(a, VSET1(split));					\
+    a1_ = VSUB(con_, VSUB(con_, a));					\
+    a2_ = VSUB(a, a1_);							\
+    con_ = VMUL(b, VSET1(split));					\
+    b1_ = VSUB(con_, VSUB(con_, b));					\
+    b2_ = VSUB(b, b1_);							\
+    (p) = VMUL(a, b);							\
+    (e) = VADD(VADD(VADD(VSUB(VMUL(a1_, b1_), p), VMUL(a1_, b2_)),	\
+		    VMUL(a2_, b1_)), VMUL(a2_, b2_));			\
+  } while (0)
+#endif
+
+/* (sh, st) += (ph, pt), lane by lane, as blas_dd_add. */
+#define VDD_ADD(sh, st, ph, pt)						\
+  do {									\
+    V s1_, s2_, t1_, t2_, bv_;						\
+    s1_ = VADD(sh, ph);							\
+    bv_ = VSUB(s1_, sh);						\
+    s2_ = VADD(VSUB(ph, bv_), VSUB(sh, VSUB(s1_, bv_)));		\
+    t1_ = VADD(st, pt);							\
+    bv_ = VSUB(t1_, st);						\
+    t2_ = VADD(VSUB(pt, bv_), VSUB(st, VSUB(t1_, bv_)));		\
+    s2_ = VADD(s2_, t1_);						\
+    t1_ = VADD(s1_, s2_);						\
+    s2_ = VSUB(s2_, VSUB(t1_, s1_));					\
+    t2_ = VADD(t2_, s2_);						\
+    (sh) = VADD(t1_, t2_);						\
+    (st) = VSUB(t2_, VSUB(sh, t1_));					\
+  } while (0)
+
+/* (sh, st) += (ph, pt), lane by lane, as blas_dd_add_lazy. */
+#define VDD_ADD_LAZY(sh, st, ph, pt)					\
+  do {									\
+    V s1_, s2_, bv_;							\
+    s1_ = VADD(sh, ph);							\
+    bv_ = VSUB(s1_, sh);						\
+    s2_ = VADD(VSUB(ph, bv_), VSUB(sh, VSUB(s1_, bv_)));		\
+    s2_ = VADD(s2_, VADD(st, pt));					\
+    (sh) = VADD(s1_, s2_);						\
+    (st) = VSUB(s2_, VSUB(sh, s1_));					\
+  } while (0)
+
+/* (sh, st) += a, lane by lane (Knuth trick). */
+#define VDD_ADD_D(sh, st, a)						\
+  do {									\
+    V e_, t1_, t2_;							\
+    t1_ = VADD(sh, a);							\
+    e_ = VSUB(t1_, sh);							\
+    t2_ = VADD(VADD(VSUB(a, e_), VSUB(sh, VSUB(t1_, e_))), st);	\
+    (sh) = VADD(t1_, t2_);						\
+    (st) = VSUB(t2_, VSUB(sh, t1_));					\
+  } while (0)
+
+#define VLD_D(p, i) VLOAD((const double *) (p) + (i))
+#define VLD_S(p, i) VLOADF((const float *) (p) + (i))
+
+#define VDOT_LOOP(LX, LY)						\
+  for (; i + 2 * VW <= len; i += 2 * VW) {				\
+    V xa = LX(x, i), xb = LX(x, i + VW);				\
+    V ya = LY(y, i), yb = LY(y, i + VW);				\
+    V ph, pt;								\
+    VTWO_PROD(xa, ya, ph, pt);						\
+    VDD_ADD_LAZY(h0, t0, ph, pt);					\
+    VTWO_PROD(xb, yb, ph, pt);						\
+    VDD_ADD_LAZY(h1, t1, ph, pt);					\
+    if (is_complex) {							\
+      VTWO_PROD(xa, VSWAP(ya), ph, pt);					\
+      VDD_ADD_LAZY(g0, u0, ph, pt);					\
+      VTWO_PROD(xb, VSWAP(yb), ph, pt);					\
+      VDD_ADD_LAZY(g1, u1, ph, pt);					\
+    }									\
+  }
+
+/* Floats multiply exactly in double, so each product is added with
+   VDD_ADD_D (the sum VDD_ADD_LAZY gives it with a zero tail), four vectors
+   per step. */
+#define VDOT_EXACT_LOOP							\
+  for (; i + 4 * VW <= len; i += 4 * VW) {				\
+    V xa = VLD_S(x, i), xb = VLD_S(x, i + VW);				\
+    V xc = VLD_S(x, i + 2 * VW), xd = VLD_S(x, i + 3 * VW);		\
+    V ya = VLD_S(y, i), yb = VLD_S(y, i + VW);				\
+    V yc = VLD_S(y, i + 2 * VW), yd = VLD_S(y, i + 3 * VW);		\
+    VDD_ADD_D(h0, t0, VMUL(xa, ya));					\
+    VDD_ADD_D(h1, t1, VMUL(xb, yb));					\
+    VDD_ADD_D(h2, t2, VMUL(xc, yc));					\
+    VDD_ADD_D(h3, t3, VMUL(xd, yd));					\
+    if (is_complex) {							\
+      VDD_ADD_D(g0, u0, VMUL(xa, VSWAP(ya)));				\
+      VDD_ADD_D(g1, u1, VMUL(xb, VSWAP(yb)));				\
+      VDD_ADD_D(g2, u2, VMUL(xc, VSWAP(yc)));				\
+      VDD_ADD_D(g3, u3, VMUL(xd, VSWAP(yd)));				\
+    }									\
+  }
+
+/* Lane sums of x[j]*y[j] into (hl, tl) and, for complex data, of
+   x[j]*y[j^1] into (gl, ul); len counts doubles. */
+VTARGET void VNAME(dot_lanes) (int len, const void *x, int x_single,
+				      const void *y, int y_single,
+				      int is_complex, double *hl, double *tl,
+				      double *gl, double *ul)
+{
+  V h0 = VZERO(), t0 = VZERO(), h1 = VZERO(), t1 = VZERO();
+  V g0 = VZERO(), u0 = VZERO(), g1 = VZERO(), u1 = VZERO();
+  V h2 = VZERO(), t2 = VZERO(), h3 = VZERO(), t3 = VZERO();
+  V g2 = VZERO(), u2 = VZERO(), g3 = VZERO(), u3 = VZERO();
+  int i = 0, j;
+
+  if (!x_single && !y_single) {
+    VDOT_LOOP(VLD_D, VLD_D);
+  } else if (!x_single) {
+    VDOT_LOOP(VLD_D, VLD_S);
+  } else if (!y_single) {
+    VDOT_LOOP(VLD_S, VLD_D);
+  } else {
+    VDOT_EXACT_LOOP;
+    VDOT_LOOP(VLD_S, VLD_S);
+  }
+
+  VDD_ADD(h0, t0, h1, t1);
+  VDD_ADD(h2, t2, h3, t3);
+  VDD_ADD(h0, t0, h2, t2);
+  VDD_ADD(g0, u0, g1, u1);
+  VDD_ADD(g2, u2, g3, u3);
+  VDD_ADD(g0, u0, g2, u2);
+  VSTORE(hl, h0);
+  VSTORE(tl, t0);
+  VSTORE(gl, g0);
+  VSTORE(ul, u0);
+
+  for (j = i; j < len; j++) {
+    double head_prod, tail_prod;
+    double xv = vec_elt(x, x_single, j);
+
+    blas_dd_two_prod(xv, vec_elt(y, y_single, j), &head_prod, &tail_prod);
+    blas_dd_add_lazy(hl[j % VW], tl[j % VW], head_prod, tail_prod,
+		     &hl[j % VW], &tl[j % VW]);
+    if (is_complex) {
+      blas_dd_two_prod(xv, vec_elt(y, y_single, j ^ 1),
+		       &head_prod, &tail_prod);
+      blas_dd_add_lazy(gl[j % VW], ul[j % VW], head_prod, tail_prod,
+		       &gl[j % VW], &ul[j % VW]);
+    }
+  }
+}
+
+/* (sh, st) = (ph, pt) * b, lane by lane, as blas_dd_mul_d. */
+#define VDD_MUL_D(sh, st, ph, pt, b)					\
+  do {									\
+    V c11_, c21_, c2_, t1_, t2_;					\
+    VTWO_PROD(ph, b, c11_, c21_);					\
+    c2_ = VMUL(pt, b);							\
+    t1_ = VADD(c11_, c2_);						\
+    t2_ = VADD(VSUB(c2_, VSUB(t1_, c11_)), c21_);			\
+    (sh) = VADD(t1_, t2_);						\
+    (st) = VSUB(t2_, VSUB(sh, t1_));					\
+  } while (0)
+
+/* Lane sums of t[j] * (head_x[j], tail_x[j]) into (hl, tl). */
+VTARGET void VNAME(dot_dd_lanes) (int len, const void *t, int t_single,
+				  const double *head_x, const double *tail_x,
+				  double *hl, double *tl)
+{
+  V h0 = VZERO(), t0 = VZERO(), h1 = VZERO(), t1 = VZERO();
+  int i = 0, j;
+
+  for (; i + 2 * VW <= len; i += 2 * VW) {
+    V ta = t_single ? VLD_S(t, i) : VLD_D(t, i);
+    V tb = t_single ? VLD_S(t, i + VW) : VLD_D(t, i + VW);
+    V ph, pt;
+    VDD_MUL_D(ph, pt, VLOAD(head_x + i), VLOAD(tail_x + i), ta);
+    VDD_ADD_LAZY(h0, t0, ph, pt);
+    VDD_MUL_D(ph, pt, VLOAD(head_x + i + VW), VLOAD(tail_x + i + VW), tb);
+    VDD_ADD_LAZY(h1, t1, ph, pt);
+  }
+
+  VDD_ADD(h0, t0, h1, t1);
+  VSTORE(hl, h0);
+  VSTORE(tl, t0);
+
+  for (j = i; j < len; j++) {
+    double head_prod, tail_prod;
+
+    blas_dd_mul_d(head_x[j], tail_x[j], vec_elt(t, t_single, j),
+		  &head_prod, &tail_prod);
+    blas_dd_add_lazy(hl[j % VW], tl[j % VW], head_prod, tail_prod,
+		     &hl[j % VW], &tl[j % VW]);
+  }
+}
+
+/* (hu[r], tu[r]) += t[r + c*ldt] * (head_x[c], tail_x[c]) over the
+   columns c in order; each row keeps its sum in a register lane.
+   x_single says head_x holds floats and tail_x zeros, which with float
+   t makes every product exact. */
+VTARGET void VNAME(gemv_dd_cols) (int len, int ncols, const void *t,
+				  int t_single, int ldt,
+				  const double *head_x, const double *tail_x,
+				  int x_single, double *hu, double *tu)
+{
+  int r = 0, c;
+
+  if (t_single && x_single) {
+    for (; r + 4 * VW <= len; r += 4 * VW) {
+      V h0 = VLOAD(hu + r), t0 = VLOAD(tu + r);
+      V h1 = VLOAD(hu + r + VW), t1 = VLOAD(tu + r + VW);
+      V h2 = VLOAD(hu + r + 2 * VW), t2 = VLOAD(tu + r + 2 * VW);
+      V h3 = VLOAD(hu + r + 3 * VW), t3 = VLOAD(tu + r + 3 * VW);
+
+      for (c = 0; c < ncols; c++) {
+	V xh = VSET1(head_x[c]);
+	int off = r + c * ldt;
+
+	VDD_ADD_D(h0, t0, VMUL(VLD_S(t, off), xh));
+	VDD_ADD_D(h1, t1, VMUL(VLD_S(t, off + VW), xh));
+	VDD_ADD_D(h2, t2, VMUL(VLD_S(t, off + 2 * VW), xh));
+	VDD_ADD_D(h3, t3, VMUL(VLD_S(t, off + 3 * VW), xh));
+      }
+      VSTORE(hu + r, h0);
+      VSTORE(tu + r, t0);
+      VSTORE(hu + r + VW, h1);
+      VSTORE(tu + r + VW, t1);
+      VSTORE(hu + r + 2 * VW, h2);
+      VSTORE(tu + r + 2 * VW, t2);
+      VSTORE(hu + r + 3 * VW, h3);
+      VSTORE(tu + r + 3 * VW, t3);
+    }
+  }
+
+  for (; r + 2 * VW <= len; r += 2 * VW) {
+    V h0 = VLOAD(hu + r), t0 = VLOAD(tu + r);
+    V h1 = VLOAD(hu + r + VW), t1 = VLOAD(tu + r + VW);
+
+    for (c = 0; c < ncols; c++) {
+      V xh = VSET1(head_x[c]), xt = VSET1(tail_x[c]);
+      int off = r + c * ldt;
+      V ta = t_single ? VLD_S(t, off) : VLD_D(t, off);
+      V tb = t_single ? VLD_S(t, off + VW) : VLD_D(t, off + VW);
+      V ph, pt;
+
+      VDD_MUL_D(ph, pt, xh, xt, ta);
+      VDD_ADD_LAZY(h0, t0, ph, pt);
+      VDD_MUL_D(ph, pt, xh, xt, tb);
+      VDD_ADD_LAZY(h1, t1, ph, pt);
+    }
+    VSTORE(hu + r, h0);
+    VSTORE(tu + r, t0);
+    VSTORE(hu + r + VW, h1);
+    VSTORE(tu + r + VW, t1);
+  }
+
+  for (; r < len; r++) {
+    for (c = 0; c < ncols; c++) {
+      double head_prod, tail_prod;
+
+      blas_dd_mul_d(head_x[c], tail_x[c], vec_elt(t, t_single, r + c * ldt),
+		    &head_prod, &tail_prod);
+      blas_dd_add_lazy(hu[r], tu[r], head_prod, tail_prod, &hu[r], &tu[r]);
+    }
+  }
+}
+
+/* (hu[r], tu[r]) += t[r + c*ldt] * xc[c] over the lines c in order, as
+   gemv_dd_cols, while the same elements times xr[r] go to lane sums of
+   each line, (hl, tl) + c*VW, so every element is loaded once.  With
+   x_single, xr and xc hold floats, as for gemv_dd_cols. */
+VTARGET void VNAME(symv_dd_lines) (int len, int ncols, const void *t,
+				   int t_single, int ldt, const double *xr,
+				   const double *xc, int x_single,
+				   double *hu, double *tu,
+				   double *hl, double *tl)
+{
+  V lh[BLAS_SYMV_DD_LINES], lt[BLAS_SYMV_DD_LINES];
+  int r = 0, c;
+
+  for (c = 0; c < ncols; c++)
+    lh[c] = lt[c] = VZERO();
+
+  if (t_single && x_single) {
+    for (; r + VW <= len; r += VW) {
+      V h0 = VLOAD(hu + r), t0 = VLOAD(tu + r), xv = VLOAD(xr + r);
+
+      for (c = 0; c < ncols; c++) {
+	V ta = VLD_S(t, r + c * ldt);
+
+	VDD_ADD_D(h0, t0, VMUL(ta, VSET1(xc[c])));
+	VDD_ADD_D(lh[c], lt[c], VMUL(ta, xv));
+      }
+      VSTORE(hu + r, h0);
+      VSTORE(tu + r, t0);
+    }
+  }
+
+  for (; r + VW <= len; r += VW) {
+    V h0 = VLOAD(hu + r), t0 = VLOAD(tu + r), xv = VLOAD(xr + r);
+
+    for (c = 0; c < ncols; c++) {
+      int off = r + c * ldt;
+      V ta = t_single ? VLD_S(t, off) : VLD_D(t, off);
+      V ph, pt;
+
+      VTWO_PROD(ta, VSET1(xc[c]), ph, pt);
+      VDD_ADD_LAZY(h0, t0, ph, pt);
+      VTWO_PROD(ta, xv, ph, pt);
+      VDD_ADD_LAZY(lh[c], lt[c], ph, pt);
+    }
+    VSTORE(hu + r, h0);
+    VSTORE(tu + r, t0);
+  }
+
+  for (c = 0; c < ncols; c++) {
+    VSTORE(hl + c * VW, lh[c]);
+    VSTORE(tl + c * VW, lt[c]);
+  }
+
+  for (; r < len; r++) {
+    for (c = 0; c < ncols; c++) {
+      double head_prod, tail_prod;
+      double tv = vec_elt(t, t_single, r + c * ldt);
+      int l = c * VW + r % VW;
+
+      blas_dd_two_prod(tv, xc[c], &head_prod, &tail_prod);
+      blas_dd_add_lazy(hu[r], tu[r], head_prod, tail_prod, &hu[r], &tu[r]);
+      blas_dd_two_prod(tv, xr[r], &head_prod, &tail_prod);
+      blas_dd_add_lazy(hl[l], tl[l], head_prod, tail_prod, &hl[l], &tl[l]);
+    }
+  }
+}
+
+/* (sh, st) = a + b, lane by lane, as blas_dd_two_sum. */
+#define VTWO_SUM(sh, st, a, b)						\
+  do {									\
+    V t1_, t2_, e_;							\
+    t1_ = VADD(a, b);							\
+    e_ = VSUB(t1_, a);							\
+    t2_ = VADD(VSUB(b, e_), VSUB(a, VSUB(t1_, e_)));			\
+    (sh) = VADD(t1_, t2_);						\
+    (st) = VSUB(t2_, VSUB(sh, t1_));					\
+  } while (0)
+
+/* (ph, pt) = ta * (xre + i xim) on (re, im) lane pairs, as blas_dd_cmul:
+   ta times the real part gives a0*x0 and a1*x0, the swapped ta times the
+   imaginary part a1*x1 and a0*x1, negated in the real lanes. */
+#define VZ_PROD(ph, pt, ta, xre, xim, exact)				\
+  do {									\
+    V sw_ = VSWAP(ta), sg_ = VSETPAIR(-1.0, 1.0), q_, f_;		\
+    if (exact) {							\
+      q_ = VMUL(VMUL(sw_, xim), sg_);					\
+      VTWO_SUM(ph, pt, VMUL(ta, xre), q_);				\
+    } else {								\
+      VTWO_PROD(ta, xre, ph, pt);					\
+      VTWO_PROD(sw_, xim, q_, f_);					\
+      q_ = VMUL(q_, sg_);						\
+      f_ = VMUL(f_, sg_);						\
+      VDD_ADD_LAZY(ph, pt, q_, f_);					\
+    }									\
+  } while (0)
+
+/* (hu, tu) += t[r + c*ldt] * x[c] over the columns c in order, complex:
+   each vector holds VW / 2 rows as (re, im) pairs, and every row adds
+   the products of blas_dd_cmul in the order of the scalar sweep. */
+VTARGET void VNAME(zgemv_dd_cols) (int len, int ncols, const void *t,
+				   int t_single, int ldt, const double *x,
+				   int conj, int exact, double *hu,
+				   double *tu)
+{
+  V cj = VSETPAIR(1.0, conj ? -1.0 : 1.0);
+  int r = 0, c, k;
+
+  for (; r + 2 * VW <= 2 * len; r += 2 * VW) {
+    V h0 = VLOAD(hu + r), t0 = VLOAD(tu + r);
+    V h1 = VLOAD(hu + r + VW), t1 = VLOAD(tu + r + VW);
+
+    for (c = 0; c < ncols; c++) {
+      V xre = VSET1(x[2 * c]), xim = VSET1(x[2 * c + 1]);
+      long off = r + 2L * c * ldt;
+      V ta = VMUL(t_single ? VLD_S(t, off) : VLD_D(t, off), cj);
+      V tb = VMUL(t_single ? VLD_S(t, off + VW) : VLD_D(t, off + VW), cj);
+      V ph, pt;
+
+      VZ_PROD(ph, pt, ta, xre, xim, exact);
+      VDD_ADD_LAZY(h0, t0, ph, pt);
+      VZ_PROD(ph, pt, tb, xre, xim, exact);
+      VDD_ADD_LAZY(h1, t1, ph, pt);
+    }
+    VSTORE(hu + r, h0);
+    VSTORE(tu + r, t0);
+    VSTORE(hu + r + VW, h1);
+    VSTORE(tu + r + VW, t1);
+  }
+
+  for (; r < 2 * len; r += 2) {
+    for (c = 0; c < ncols; c++) {
+      double head_prod[2], tail_prod[2];
+      long off = r + 2L * c * ldt;
+      double a1 = vec_elt(t, t_single, off + 1);
+
+      blas_dd_cmul(vec_elt(t, t_single, off), conj ? -a1 : a1, x[2 * c],
+		   x[2 * c + 1], exact, head_prod, tail_prod);
+      for (k = 0; k < 2; k++)
+	blas_dd_add_lazy(hu[r + k], tu[r + k], head_prod[k], tail_prod[k],
+			 &hu[r + k], &tu[r + k]);
+    }
+  }
+}
+
+/* (hu, tu) += t[r + c*ldt] * xc[c] over the lines c in order, as
+   zgemv_dd_cols, while the same elements times xr[r] go to the lane
+   sums of each line, (hl, tl) + c*VW, real parts in the even lanes. */
+VTARGET void VNAME(zsymv_dd_lines) (int len, int ncols, const void *t,
+				    int t_single, int ldt, const double *xr,
+				    const double *xc, int conj_row,
+				    int conj_line, int exact, double *hu,
+				    double *tu, double *hl, double *tl)
+{
+  V lh[BLAS_SYMV_DD_LINES], lt[BLAS_SYMV_DD_LINES];
+  V cr = VSETPAIR(1.0, conj_row ? -1.0 : 1.0);
+  V cl = VSETPAIR(1.0, conj_line ? -1.0 : 1.0);
+  int r = 0, c, k;
+
+  for (c = 0; c < ncols; c++)
+    lh[c] = lt[c] = VZERO();
+
+  for (; r + VW <= 2 * len; r += VW) {
+    V h0 = VLOAD(hu + r), t0 = VLOAD(tu + r), xv = VLOAD(xr + r);
+    V xre = VDUPRE(xv), xim = VDUPIM(xv);
+
+    for (c = 0; c < ncols; c++) {
+      long off = r + 2L * c * ldt;
+      V ta = t_single ? VLD_S(t, off) : VLD_D(t, off);
+      V ph, pt;
+
+      VZ_PROD(ph, pt, VMUL(ta, cr), VSET1(xc[2 * c]), VSET1(xc[2 * c + 1]),
+	      exact);
+      VDD_ADD_LAZY(h0, t0, ph, pt);
+      VZ_PROD(ph, pt, VMUL(ta, cl), xre, xim, exact);
+      VDD_ADD_LAZY(lh[c], lt[c], ph, pt);
+    }
+    VSTORE(hu + r, h0);
+    VSTORE(tu + r, t0);
+  }
+
+  for (c = 0; c < ncols; c++) {
+    VSTORE(hl + c * VW, lh[c]);
+    VSTORE(tl + c * VW, lt[c]);
+  }
+
+  for (; r < 2 * len; r += 2) {
+    for (c = 0; c < ncols; c++) {
+      double head_prod[2], tail_prod[2];
+      long off = r + 2L * c * ldt;
+      double a0 = vec_elt(t, t_single, off), a1 = vec_elt(t, t_single,
+							    off + 1);
+      int l = c * VW + r % VW;
+
+      blas_dd_cmul(a0, conj_row ? -a1 : a1, xc[2 * c], xc[2 * c + 1],
+		   exact, head_prod, tail_prod);
+      for (k = 0; k < 2; k++)
+	blas_dd_add_lazy(hu[r + k], tu[r + k], head_prod[k], tail_prod[k],
+			 &hu[r + k], &tu[r + k]);
+      blas_dd_cmul(a0, conj_line ? -a1 : a1, xr[r], xr[r + 1], exact,
+		   head_prod, tail_prod);
+      for (k = 0; k < 2; k++)
+	blas_dd_add_lazy(hl[l + k], tl[l + k], head_prod[k], tail_prod[k],
+			 &hl[l + k], &tl[l + k]);
+    }
+  }
+}
+
+/* Lane sums of x[j] into (hl, tl); len counts doubles. */
+VTARGET void VNAME(sum_lanes) (int len, const void *x, int x_single,
+				      double *hl, double *tl)
+{
+  V h0 = VZERO(), t0 = VZERO(), h1 = VZERO(), t1 = VZERO();
+  int i = 0, j;
+
+  if (x_single) {
+    for (; i + 2 * VW <= len; i += 2 * VW) {
+      VDD_ADD_D(h0, t0, VLD_S(x, i));
+      VDD_ADD_D(h1, t1, VLD_S(x, i + VW));
+    }
+  } else {
+    for (; i + 2 * VW <= len; i += 2 * VW) {
+      VDD_ADD_D(h0, t0, VLD_D(x, i));
+      VDD_ADD_D(h1, t1, VLD_D(x, i + VW));
+    }
+  }
+
+  VDD_ADD(h0, t0, h1, t1);
+  VSTORE(hl, h0);
+  VSTORE(tl, t0);
+
+  for (j = i; j < len; j++)
+    blas_dd_add_d(hl[j % VW], tl[j % VW], vec_elt(x, x_single, j),
+		  &hl[j % VW], &tl[j % VW]);
+}
+
+#define VWAXPBY_LOOP(LX, LY)						\
+  for (; i + VW <= len; i += VW) {					\
+    V xv = LX(x, i), yv = LY(y, i);					\
+    V head_x, tail_x, head_y, tail_y, ph, pt;				\
+    VTWO_PROD(VSET1(alpha[0]), xv, head_x, tail_x);			\
+    VTWO_PROD(VSET1(beta[0]), yv, head_y, tail_y);			\
+    if (is_complex) {							\
+      VTWO_PROD(VSWAP(xv), VSETPAIR(-alpha[1], alpha[1]), ph, pt);	\
+      VDD_ADD(head_x, tail_x, ph, pt);					\
+      VTWO_PROD(VSWAP(yv), VSETPAIR(-beta[1], beta[1]), ph, pt);	\
+      VDD_ADD(head_y, tail_y, ph, pt);					\
+    }									\
+    VDD_ADD(head_y, tail_y, head_x, tail_x);				\
+    if (w_single)							\
+      VSTOREF((float *) w + i, head_y);					\
+    else								\
+      VSTORE((double *) w + i, head_y);					\
+  }
+
+/* w <- alpha * x + beta * y over len doubles; returns the number of
+   doubles done, always a whole number of elements. */
+VTARGET int VNAME(waxpby) (int len, const double *alpha,
+				  const void *x, int x_single,
+				  const double *beta,
+				  const void *y, int y_single,
+				  void *w, int w_single, int is_complex)
+{
+  int i = 0;
+
+  if (!x_single && !y_single) {
+    VWAXPBY_LOOP(VLD_D, VLD_D);
+  } else if (!x_single) {
+    VWAXPBY_LOOP(VLD_D, VLD_S);
+  } else if (!y_single) {
+    VWAXPBY_LOOP(VLD_S, VLD_D);
+  } else {
+    VWAXPBY_LOOP(VLD_S, VLD_S);
+  }
+  return i;
+}
+
+/* Value j of a reproducible sum: x[j] * y[j], or x[j] when y is NULL. */
+#define VREPRO_LD(j)							\
+  (y != NULL ? VMUL(VLOAD(x + (j)), VLOAD(y + (j))) : VLOAD(x + (j)))
+
+/* Largest magnitude of the values of a reproducible sum; *finite is
+   cleared when one of them is infinite or NaN. */
+VTARGET double VNAME(repro_max) (int len, const double *x, const double *y,
+				 int *finite)
+{
+  V m0 = VZERO(), m1 = VZERO(), z0 = VZERO(), z1 = VZERO();
+  double ml[VW], zl[VW], m = 0.0, z = 0.0;
+  int j = 0, l;
+
+  for (; j + 2 * VW <= len; j += 2 * VW) {
+    V v0 = VREPRO_LD(j), v1 = VREPRO_LD(j + VW);
+
+    m0 = VMAX(m0, VABS(v0));
+    m1 = VMAX(m1, VABS(v1));
+    /* v * 0 is NaN exactly when v is infinite or NaN. */
+    z0 = VADD(z0, VMUL(v0, VZERO()));
+    z1 = VADD(z1, VMUL(v1, VZERO()));
+  }
+  VSTORE(ml, VMAX(m0, m1));
+  VSTORE(zl, VADD(z0, z1));
+  for (l = 0; l < VW; l++) {
+    m = MAX(m, ml[l]);
+    z += zl[l];
+  }
+
+  for (; j < len; j++) {
+    double v = (y != NULL) ? x[j] * y[j] : x[j];
+
+    m = MAX(m, fabs(v));
+    z += v * 0.0;
+  }
+  *finite = (z == z);
+  return m;
+}
+
+/* s[k] <- the exact sums of the pieces of the values in the bin whose
+   rounding constant is sigma[k]. */
+VTARGET void VNAME(repro_deposit) (int len, const double *x,
+				   const double *y, const double *sigma,
+				   double *s)
+{
+  V g[BLAS_REPRO_FOLD], s0[BLAS_REPRO_FOLD], s1[BLAS_REPRO_FOLD];
+  double sl[VW];
+  int j = 0, k, l;
+
+  for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+    g[k] = VSET1(sigma[k]);
+    s0[k] = s1[k] = VZERO();
+  }
+
+  for (; j + 2 * VW <= len; j += 2 * VW) {
+    V v0 = VREPRO_LD(j), v1 = VREPRO_LD(j + VW);
+
+    for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+      V q0 = VSUB(VADD(v0, g[k]), g[k]);
+      V q1 = VSUB(VADD(v1, g[k]), g[k]);
+
+      s0[k] = VADD(s0[k], q0);
+      s1[k] = VADD(s1[k], q1);
+      v0 = VSUB(v0, q0);
+      v1 = VSUB(v1, q1);
+    }
+  }
+
+  /* Every addition is exact, so the lanes go in any order. */
+  for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+    VSTORE(sl, VADD(s0[k], s1[k]));
+    s[k] = 0.0;
+    for (l = 0; l < VW; l++)
+      s[k] += sl[l];
+  }
+
+  for (; j < len; j++)
+    blas_repro_deposit1((y != NULL) ? x[j] * y[j] : x[j], sigma, s);
+}
+
+#undef VTWO_PROD
+#undef VDD_ADD
+#undef VDD_ADD_LAZY
+#undef VDD_ADD_D
+#undef VDD_MUL_D
+#undef VTWO_SUM
+#undef VZ_PROD
+#undef VLD_D
+#undef VLD_S
+#undef VDOT_LOOP
+#undef VDOT_EXACT_LOOP
+#undef VWAXPBY_LOOP
+#undef VREPRO_LD
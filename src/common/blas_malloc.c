@@ -1,30 +1,244 @@
 #include <stdlib.h>
+#include <string.h>
 #include "blas_extended.h"
+#include "blas_malloc.h"
+
+/*
+ * Every block carries a header with its size class.  blas_free keeps
+ * blocks of up to 2^(BLAS_WS_MIN_SHIFT + BLAS_WS_CLASSES - 1) bytes on
+ * per-class free lists of the calling thread, and blas_malloc takes them
+ * back from there, so a routine called over and over with the same sizes
+ * stops going to the heap after its first call.  Larger blocks, and
+ * blocks freed while the cache is full, go straight back to free().
+ */
+
+/* Header in front of each block; 32 bytes keep malloc's alignment. */
+struct ws_block {
+  struct ws_block *next;	/* free list link while cached      */
+  size_t cls;			/* size class, or WS_LARGE          */
+  size_t cap;			/* usable bytes after the header    */
+  size_t pad;
+};
+
+#define WS_LARGE ((size_t) -1)
+
+struct ws_cache {
+  struct ws_block *free_list[BLAS_WS_CLASSES];
+  size_t cached;		/* bytes held on the free lists     */
+  size_t limit;			/* most bytes the lists may hold    */
+  unsigned long reused, heap;
+};
+
+static void cache_init(struct ws_cache *c)
+{
+  memset(c, 0, sizeof(*c));
+  c->limit = BLAS_WS_CACHE_MAX;
+}
+
+static void cache_release(struct ws_cache *c)
+{
+  int i;
+
+  for (i = 0; i < BLAS_WS_CLASSES; i++) {
+    while (c->free_list[i] != NULL) {
+      struct ws_block *b = c->free_list[i];
+
+      c->free_list[i] = b->next;
+      free(b);
+    }
+  }
+  c->cached = 0;
+}
+
+#ifndef BLAS_NO_THREADS
+
+#include <pthread.h>
+
+static pthread_key_t cache_key;
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+static int cache_ok = 0;
+
+static void cache_free(void *p)
+{
+  cache_release((struct ws_cache *) p);
+  free(p);
+}
+
+static void cache_key_init(void)
+{
+  cache_ok = (pthread_key_create(&cache_key, cache_free) == 0);
+}
+
+/* The calling thread's cache, or NULL if none can be had. */
+static struct ws_cache *thread_cache(void)
+{
+  struct ws_cache *c;
+
+  pthread_once(&cache_once, cache_key_init);
+  if (!cache_ok)
+    return NULL;
+  c = (struct ws_cache *) pthread_getspecific(cache_key);
+  if (c == NULL) {
+    c = (struct ws_cache *) malloc(sizeof(struct ws_cache));
+    if (c == NULL)
+      return NULL;
+    cache_init(c);
+    if (pthread_setspecific(cache_key, c) != 0) {
+      free(c);
+      return NULL;
+    }
+  }
+  return c;
+}
+
+#else /* BLAS_NO_THREADS */
+
+static struct ws_cache *thread_cache(void)
+{
+  static struct ws_cache c;
+  static int init = 0;
+
+  if (!init) {
+    cache_init(&c);
+    init = 1;
+  }
+  return &c;
+}
+
+#endif /* BLAS_NO_THREADS */
+
+/* Smallest class whose blocks hold 'size' bytes, or WS_LARGE. */
+static size_t size_class(size_t size)
+{
+  size_t cls = 0;
+
+  while (cls < BLAS_WS_CLASSES
+	 && ((size_t) 1 << (BLAS_WS_MIN_SHIFT + cls)) < size)
+    cls++;
+  return (cls < BLAS_WS_CLASSES) ? cls : WS_LARGE;
+}
+
+static void *block_alloc(size_t size)
+{
+  struct ws_cache *c = thread_cache();
+  size_t cls = size_class(size), cap;
+  struct ws_block *b;
+
+  if (cls != WS_LARGE && c != NULL) {
+    size_t i;
+
+    /* A block up to BLAS_WS_SPAN classes larger beats a trip to the
+       heap; it goes back to its own list when freed. */
+    for (i = cls; i < BLAS_WS_CLASSES && i <= cls + BLAS_WS_SPAN; i++) {
+      b = c->free_list[i];
+      if (b != NULL) {
+	c->free_list[i] = b->next;
+	c->cached -= b->cap;
+	c->reused++;
+	return b + 1;
+      }
+    }
+  }
+
+  cap = (cls != WS_LARGE) ? (size_t) 1 << (BLAS_WS_MIN_SHIFT + cls) : size;
+  b = (struct ws_block *) malloc(sizeof(struct ws_block) + cap);
+  if (b == NULL)
+    return NULL;
+  b->next = NULL;
+  b->cls = cls;
+  b->cap = cap;
+  if (c != NULL)
+    c->heap++;
+  return b + 1;
+}
 
 void *blas_malloc(size_t size)
 {
 #ifdef BLAS_DEBUG
-  void *ptr = malloc(size);
-  if (size % sizeof(float) == 0) {
+  void *ptr = block_alloc(size);
+  if (ptr != NULL && size % sizeof(float) == 0) {
     int n = size / sizeof(float);
     int i;
-    for (i = 0; i < n; i++) { 
+    for (i = 0; i < n; i++) {
       ((float *) ptr)[i] = 0.0 / 0.0;
     }
   }
   return ptr;
 #else
-  return (malloc(size));
+  return block_alloc(size);
 #endif
 }
 
 void blas_free(void *ptr)
 {
-  if (ptr != NULL)
-    free(ptr);
+  struct ws_block *b;
+  struct ws_cache *c;
+
+  if (ptr == NULL)
+    return;
+  b = (struct ws_block *) ptr - 1;
+  if (b->cls != WS_LARGE) {
+    c = thread_cache();
+    if (c != NULL && c->cached + b->cap <= c->limit) {
+      b->next = c->free_list[b->cls];
+      c->free_list[b->cls] = b;
+      c->cached += b->cap;
+      return;
+    }
+  }
+  free(b);
 }
 
 void *blas_realloc(void *ptr, size_t size)
 {
-  return (realloc(ptr, size));
+  void *q;
+  size_t cap;
+
+  if (ptr == NULL)
+    return blas_malloc(size);
+  cap = ((struct ws_block *) ptr - 1)->cap;
+  if (size <= cap)
+    return ptr;
+  q = blas_malloc(size);
+  if (q != NULL) {
+    memcpy(q, ptr, cap);
+    blas_free(ptr);
+  }
+  return q;
+}
+
+int BLAS_workspace_reserve(size_t bytes)
+{
+  struct ws_cache *c = thread_cache();
+  void *p;
+
+  if (c == NULL || size_class(bytes) == WS_LARGE)
+    return 0;
+  p = blas_malloc(bytes);
+  if (p == NULL)
+    return 0;
+  if (c->limit < c->cached + ((struct ws_block *) p - 1)->cap)
+    c->limit = c->cached + ((struct ws_block *) p - 1)->cap;
+  blas_free(p);
+  return 1;
+}
+
+void BLAS_workspace_release(void)
+{
+  struct ws_cache *c = thread_cache();
+
+  if (c != NULL) {
+    cache_release(c);
+    c->limit = BLAS_WS_CACHE_MAX;
+  }
+}
+
+void BLAS_workspace_counters(unsigned long *reused, unsigned long *heap)
+{
+  struct ws_cache *c = thread_cache();
+
+  if (reused != NULL)
+    *reused = (c != NULL) ? c->reused : 0;
+  if (heap != NULL)
+    *heap = (c != NULL) ? c->heap : 0;
 }
@@ -0,0 +1,694 @@
+#include <string.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_malloc.h"
+#include "blas_matrix.h"
+#include "blas_gemm_engine.h"
+
+/*
+ * Prepacked matrices.  The handle holds op(A), m by n, in elements of
+ * a_type: a row-major matrix with leading dimension n, or for a band
+ * handle (kl >= 0) the row-major band of GBMV, element (i, j) at
+ * i * ld + kl + j - i, ld = kl + ku + 1, with the slots outside the
+ * matrix zero.  Products call the GEMV, GBMV or GEMM routine of that
+ * layout; its rows are contiguous, so the _x routines take them by the
+ * dot kernel and split them over the threads.  A dense handle also
+ * keeps op(A) in the micro-panels of the GEMM engine, so that _mm_x
+ * skips the packing of A the engine would redo on every call.
+ */
+struct blas_matrix {
+  enum blas_matrix_elt_type type;	/* of the routines fed           */
+  enum blas_matrix_elt_type a_type;	/* of the packed elements        */
+  int m, n;
+  int kl, ku, ld;		/* band, or kl = -1 for dense        */
+  void *a;			/* NULL until packed                 */
+  struct blas_gemm_packed_a panels;	/* dense only, else p NULL     */
+};
+
+struct blas_matrix *BLAS_matrix_create(enum blas_matrix_elt_type type)
+{
+  static const char routine_name[] = "BLAS_matrix_create";
+  struct blas_matrix *h;
+
+  if (type < blas_matrix_elt_s || type > blas_matrix_elt_z)
+    BLAS_error(routine_name, -1, type, NULL);
+  h = (struct blas_matrix *) blas_malloc(sizeof(*h));
+  if (h == NULL)
+    return NULL;
+  h->type = type;
+  h->a_type = type;
+  h->m = h->n = 0;
+  h->kl = -1;
+  h->ku = 0;
+  h->ld = 0;
+  h->a = NULL;
+  h->panels.p = NULL;
+  return h;
+}
+
+void BLAS_matrix_destroy(struct blas_matrix *h)
+{
+  if (h == NULL)
+    return;
+  blas_free(h->a);
+  blas_gemm_packed_a_free(&h->panels);
+  blas_free(h);
+}
+
+/* Storage type for elements of type a_type in routines of type t, or -1
+   if those routines take no such A.  Float goes to double for d and z. */
+static int storage_type(enum blas_matrix_elt_type t,
+			enum blas_matrix_elt_type a_type)
+{
+  switch (t) {
+  case blas_matrix_elt_s:
+    return (a_type == blas_matrix_elt_s) ? blas_matrix_elt_s : -1;
+  case blas_matrix_elt_d:
+    return (a_type == blas_matrix_elt_s || a_type == blas_matrix_elt_d) ?
+      blas_matrix_elt_d : -1;
+  case blas_matrix_elt_c:
+    return (a_type == blas_matrix_elt_s || a_type == blas_matrix_elt_c) ?
+      (int) a_type : -1;
+  case blas_matrix_elt_z:
+    if (a_type == blas_matrix_elt_s || a_type == blas_matrix_elt_d)
+      return blas_matrix_elt_d;
+    if (a_type == blas_matrix_elt_c || a_type == blas_matrix_elt_z)
+      return blas_matrix_elt_z;
+    return -1;
+  }
+  return -1;
+}
+
+static size_t elt_size(enum blas_matrix_elt_type t)
+{
+  switch (t) {
+  case blas_matrix_elt_s:
+    return sizeof(float);
+  case blas_matrix_elt_d:
+    return sizeof(double);
+  case blas_matrix_elt_c:
+    return 2 * sizeof(float);
+  default:
+    return 2 * sizeof(double);
+  }
+}
+
+/* Frees the packed copy of h, leaving it empty. */
+static void empty_handle(struct blas_matrix *h)
+{
+  blas_free(h->a);
+  h->a = NULL;
+  blas_gemm_packed_a_free(&h->panels);
+  h->m = h->n = 0;
+  h->kl = -1;
+}
+
+/* Empties h and gives it room for an m by n op(A) of a_type, ld elements
+   to a row, zeroed.  Returns 0, or -1 with h empty.  An empty op(A) is
+   kept dense; the products handle it without calling the routines. */
+static int alloc_packed(struct blas_matrix *h,
+			enum blas_matrix_elt_type a_type, int m, int n, int kl,
+			int ku, int ld)
+{
+  int st = storage_type(h->type, a_type);
+  size_t bytes;
+
+  empty_handle(h);
+  if (st < 0)
+    return -1;
+  if (m == 0 || n == 0) {
+    kl = -1;
+    ld = n;
+  }
+  bytes = (size_t) m * ld * elt_size((enum blas_matrix_elt_type) st);
+  h->a = blas_malloc(bytes > 0 ? bytes : 1);
+  if (h->a == NULL)
+    return -1;
+  memset(h->a, 0, bytes);
+  h->a_type = (enum blas_matrix_elt_type) st;
+  h->m = m;
+  h->n = n;
+  h->kl = kl;
+  h->ku = ku;
+  h->ld = ld;
+  return 0;
+}
+
+/* Packed slot p <- element s of a (of type a_type), conjugated if conj,
+   its imaginary part dropped if real_only. */
+static void put(struct blas_matrix *h, long p, const void *a,
+		enum blas_matrix_elt_type a_type, long s, int conj,
+		int real_only)
+{
+  double re, im = 0.0;
+
+  switch (a_type) {
+  case blas_matrix_elt_s:
+    re = ((const float *) a)[s];
+    break;
+  case blas_matrix_elt_d:
+    re = ((const double *) a)[s];
+    break;
+  case blas_matrix_elt_c:
+    re = ((const float *) a)[2 * s];
+    im = ((const float *) a)[2 * s + 1];
+    break;
+  default:
+    re = ((const double *) a)[2 * s];
+    im = ((const double *) a)[2 * s + 1];
+    break;
+  }
+  if (real_only)
+    im = 0.0;
+  else if (conj)
+    im = -im;
+
+  switch (h->a_type) {
+  case blas_matrix_elt_s:
+    ((float *) h->a)[p] = (float) re;
+    break;
+  case blas_matrix_elt_d:
+    ((double *) h->a)[p] = re;
+    break;
+  case blas_matrix_elt_c:
+    ((float *) h->a)[2 * p] = (float) re;
+    ((float *) h->a)[2 * p + 1] = (float) im;
+    break;
+  default:
+    ((double *) h->a)[2 * p] = re;
+    ((double *) h->a)[2 * p + 1] = im;
+    break;
+  }
+}
+
+/* Slot of element (i, j) of op(A) in the handle. */
+static long slot(const struct blas_matrix *h, int i, int j)
+{
+  if (h->kl < 0)
+    return (long) i * h->n + j;
+  return (long) i * h->ld + h->kl + j - i;
+}
+
+int BLAS_matrix_pack_ge(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_trans_type trans, int m, int n,
+			const void *a, enum blas_matrix_elt_type a_type,
+			int lda)
+{
+  static const char routine_name[] = "BLAS_matrix_pack_ge";
+  int i, j, lenx, leny;
+  long incai, incaij;
+
+  if (order != blas_colmajor && order != blas_rowmajor)
+    BLAS_error(routine_name, -2, order, NULL);
+  if (trans != blas_no_trans && trans != blas_trans &&
+      trans != blas_conj_trans)
+    BLAS_error(routine_name, -3, trans, NULL);
+  if (m < 0)
+    BLAS_error(routine_name, -4, m, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -5, n, NULL);
+  if (lda < ((order == blas_colmajor) ? MAX(1, m) : MAX(1, n)))
+    BLAS_error(routine_name, -8, lda, NULL);
+
+  /* op(A) is leny by lenx; step through it as in GEMV. */
+  if (trans == blas_no_trans) {
+    leny = m;
+    lenx = n;
+  } else {
+    leny = n;
+    lenx = m;
+  }
+  if ((order == blas_rowmajor) == (trans == blas_no_trans)) {
+    incai = lda;
+    incaij = 1;
+  } else {
+    incai = 1;
+    incaij = lda;
+  }
+  if (alloc_packed(h, a_type, leny, lenx, -1, 0, lenx) != 0)
+    return -1;
+  for (i = 0; i < leny; i++)
+    for (j = 0; j < lenx; j++)
+      put(h, slot(h, i, j), a, a_type, i * incai + j * incaij,
+	  trans == blas_conj_trans, 0);
+  if (leny > 0 && lenx > 0) {
+    struct blas_gemm_operand op;
+
+    /* The element types of the handle and the engine number alike. */
+    blas_gemm_operand_init(&op, h->a, (enum blas_gemm_elt_type) h->a_type,
+			   blas_rowmajor, blas_no_trans, h->ld);
+    if (!blas_gemm_pack_a(&h->panels, leny, lenx, &op,
+			  (enum blas_gemm_elt_type) h->type)) {
+      empty_handle(h);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int BLAS_matrix_pack_gb(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_trans_type trans, int m, int n, int kl,
+			int ku, const void *a,
+			enum blas_matrix_elt_type a_type, int lda)
+{
+  static const char routine_name[] = "BLAS_matrix_pack_gb";
+  int i, j, lenx, leny, kl_op, ku_op;
+
+  if (order != blas_colmajor && order != blas_rowmajor)
+    BLAS_error(routine_name, -2, order, NULL);
+  if (trans != blas_no_trans && trans != blas_trans &&
+      trans != blas_conj_trans)
+    BLAS_error(routine_name, -3, trans, NULL);
+  if (m < 0)
+    BLAS_error(routine_name, -4, m, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -5, n, NULL);
+  if (kl < 0 || kl >= MAX(1, m))
+    BLAS_error(routine_name, -6, kl, NULL);
+  if (ku < 0 || ku >= MAX(1, n))
+    BLAS_error(routine_name, -7, ku, NULL);
+  if (lda < kl + ku + 1)
+    BLAS_error(routine_name, -10, lda, NULL);
+
+  if (trans == blas_no_trans) {
+    leny = m;
+    lenx = n;
+    kl_op = kl;
+    ku_op = ku;
+  } else {
+    leny = n;
+    lenx = m;
+    kl_op = ku;
+    ku_op = kl;
+  }
+  if (alloc_packed(h, a_type, leny, lenx, kl_op, ku_op, kl + ku + 1) != 0)
+    return -1;
+  for (i = 0; i < leny; i++)
+    for (j = MAX(0, i - kl_op); j <= MIN(lenx - 1, i + ku_op); j++) {
+      /* (r, c) is the element of A itself, stored as GBMV reads it. */
+      int r = (trans == blas_no_trans) ? i : j;
+      int c = (trans == blas_no_trans) ? j : i;
+      long s = (order == blas_colmajor) ?
+	(long) c * lda + ku + r - c : (long) r * lda + kl + c - r;
+
+      put(h, slot(h, i, j), a, a_type, s, trans == blas_conj_trans, 0);
+    }
+  return 0;
+}
+
+/* Element (i, j) of a symmetric or Hermitian matrix, n by n, of which
+   the uplo triangle is stored: packed (k < 0) as SPMV takes it, or as a
+   band of width k as SBMV does. */
+static void put_sym(struct blas_matrix *h, enum blas_order_type order,
+		    enum blas_uplo_type uplo, int n, int k, const void *a,
+		    enum blas_matrix_elt_type a_type, int lda, int herm,
+		    int i, int j)
+{
+  int p = MIN(i, j), q = MAX(i, j);
+  int mirrored = (uplo == blas_upper) ? (i > j) : (i < j);
+  long s;
+
+  if (k < 0) {
+    if ((order == blas_colmajor) == (uplo == blas_upper))
+      s = p + (long) q * (q + 1) / 2;
+    else
+      s = (q - p) + (long) p * (2 * n - p + 1) / 2;
+  } else {
+    if ((order == blas_colmajor) == (uplo == blas_upper))
+      s = (long) q * lda + k - (q - p);
+    else
+      s = (long) p * lda + (q - p);
+  }
+  put(h, slot(h, i, j), a, a_type, s, herm && mirrored, herm && i == j);
+}
+
+static int pack_sym(struct blas_matrix *h, const char *routine_name,
+		    enum blas_order_type order, enum blas_uplo_type uplo,
+		    int n, int k, const void *a,
+		    enum blas_matrix_elt_type a_type, int lda, int herm)
+{
+  int i, j, kb;
+
+  if (order != blas_colmajor && order != blas_rowmajor)
+    BLAS_error(routine_name, -2, order, NULL);
+  if (uplo != blas_upper && uplo != blas_lower)
+    BLAS_error(routine_name, -3, uplo, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -4, n, NULL);
+  if (herm && a_type != blas_matrix_elt_c && a_type != blas_matrix_elt_z) {
+    empty_handle(h);
+    return -1;
+  }
+
+  if (k < 0) {
+    if (alloc_packed(h, a_type, n, n, -1, 0, n) != 0)
+      return -1;
+    for (i = 0; i < n; i++)
+      for (j = 0; j < n; j++)
+	put_sym(h, order, uplo, n, -1, a, a_type, 0, herm, i, j);
+    return 0;
+  }
+
+  if (lda < k + 1)
+    BLAS_error(routine_name, -8, lda, NULL);
+  kb = MIN(k, MAX(0, n - 1));
+  if (alloc_packed(h, a_type, n, n, kb, kb, 2 * kb + 1) != 0)
+    return -1;
+  for (i = 0; i < n; i++)
+    for (j = MAX(0, i - kb); j <= MIN(n - 1, i + kb); j++)
+      put_sym(h, order, uplo, n, k, a, a_type, lda, herm, i, j);
+  return 0;
+}
+
+int BLAS_matrix_pack_sp(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, const void *ap,
+			enum blas_matrix_elt_type a_type)
+{
+  return pack_sym(h, "BLAS_matrix_pack_sp", order, uplo, n, -1, ap, a_type,
+		  0, 0);
+}
+
+int BLAS_matrix_pack_hp(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, const void *ap,
+			enum blas_matrix_elt_type a_type)
+{
+  return pack_sym(h, "BLAS_matrix_pack_hp", order, uplo, n, -1, ap, a_type,
+		  0, 1);
+}
+
+int BLAS_matrix_pack_sb(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, int k,
+			const void *a, enum blas_matrix_elt_type a_type,
+			int lda)
+{
+  if (k < 0)
+    BLAS_error("BLAS_matrix_pack_sb", -5, k, NULL);
+  return pack_sym(h, "BLAS_matrix_pack_sb", order, uplo, n, k, a, a_type,
+		  lda, 0);
+}
+
+int BLAS_matrix_pack_hb(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, int k,
+			const void *a, enum blas_matrix_elt_type a_type,
+			int lda)
+{
+  if (k < 0)
+    BLAS_error("BLAS_matrix_pack_hb", -5, k, NULL);
+  return pack_sym(h, "BLAS_matrix_pack_hb", order, uplo, n, k, a, a_type,
+		  lda, 1);
+}
+
+/* Checks that h was packed for routines of type t. */
+static int check_handle(const struct blas_matrix *h,
+			enum blas_matrix_elt_type t, const char *routine_name)
+{
+  if (h == NULL || h->type != t || h->a == NULL) {
+    BLAS_error(routine_name, -1, h == NULL ? -1 : (int) h->type, NULL);
+    return -1;
+  }
+  return 0;
+}
+
+/* y <- beta * y over len elements of type t, inc apart as in the BLAS:
+   what op(A) * x adds to y when op(A) has no columns.  y is not read
+   when beta is zero. */
+static void scale_vec(enum blas_matrix_elt_type t, const void *beta,
+		      void *y, int len, int inc)
+{
+  double br, bi = 0.0;
+  long i, iy = (inc < 0) ? (long) (1 - len) * inc : 0;
+
+  switch (t) {
+  case blas_matrix_elt_s:
+    br = *(const float *) beta;
+    break;
+  case blas_matrix_elt_d:
+    br = *(const double *) beta;
+    break;
+  case blas_matrix_elt_c:
+    br = ((const float *) beta)[0];
+    bi = ((const float *) beta)[1];
+    break;
+  default:
+    br = ((const double *) beta)[0];
+    bi = ((const double *) beta)[1];
+    break;
+  }
+  if (br == 1.0 && bi == 0.0)
+    return;
+
+  for (i = 0; i < len; i++, iy += inc) {
+    double re = 0.0, im = 0.0, yr, yi;
+
+    switch (t) {
+    case blas_matrix_elt_s:
+      if (br != 0.0)
+	re = br * ((float *) y)[iy];
+      ((float *) y)[iy] = (float) re;
+      break;
+    case blas_matrix_elt_d:
+      if (br != 0.0)
+	re = br * ((double *) y)[iy];
+      ((double *) y)[iy] = re;
+      break;
+    case blas_matrix_elt_c:
+      if (br != 0.0 || bi != 0.0) {
+	yr = ((float *) y)[2 * iy];
+	yi = ((float *) y)[2 * iy + 1];
+	re = br * yr - bi * yi;
+	im = br * yi + bi * yr;
+      }
+      ((float *) y)[2 * iy] = (float) re;
+      ((float *) y)[2 * iy + 1] = (float) im;
+      break;
+    default:
+      if (br != 0.0 || bi != 0.0) {
+	yr = ((double *) y)[2 * iy];
+	yi = ((double *) y)[2 * iy + 1];
+	re = br * yr - bi * yi;
+	im = br * yi + bi * yr;
+      }
+      ((double *) y)[2 * iy] = re;
+      ((double *) y)[2 * iy + 1] = im;
+      break;
+    }
+  }
+}
+
+/* The product of an op(A) with no rows or no columns: leaves y alone or
+   scales it by beta.  Returns 1 if it did, 0 for the routines to run. */
+static int mv_empty(const struct blas_matrix *h, const void *beta, void *y,
+		    int incy, const char *routine_name)
+{
+  if (h->m > 0 && h->n > 0)
+    return 0;
+  if (incy == 0)
+    BLAS_error(routine_name, -7, incy, NULL);
+  else
+    scale_vec(h->type, beta, y, h->m, incy);
+  return 1;
+}
+
+void BLAS_smatrix_mv_x(const struct blas_matrix *h, float alpha,
+		       const float *x, int incx, float beta, float *y,
+		       int incy, enum blas_prec_type prec)
+{
+  if (check_handle(h, blas_matrix_elt_s, "BLAS_smatrix_mv_x") != 0
+      || mv_empty(h, &beta, y, incy, "BLAS_smatrix_mv_x"))
+    return;
+  if (h->kl < 0)
+    BLAS_sgemv_x(blas_rowmajor, blas_no_trans, h->m, h->n, alpha,
+		 (const float *) h->a, h->ld, x, incx, beta, y, incy, prec);
+  else
+    BLAS_sgbmv_x(blas_rowmajor, blas_no_trans, h->m, h->n, h->kl, h->ku,
+		 alpha, (const float *) h->a, h->ld, x, incx, beta, y,
+		 incy, prec);
+}
+
+void BLAS_dmatrix_mv_x(const struct blas_matrix *h, double alpha,
+		       const double *x, int incx, double beta, double *y,
+		       int incy, enum blas_prec_type prec)
+{
+  if (check_handle(h, blas_matrix_elt_d, "BLAS_dmatrix_mv_x") != 0
+      || mv_empty(h, &beta, y, incy, "BLAS_dmatrix_mv_x"))
+    return;
+  if (h->kl < 0)
+    BLAS_dgemv_x(blas_rowmajor, blas_no_trans, h->m, h->n, alpha,
+		 (const double *) h->a, h->ld, x, incx, beta, y, incy,
+		 prec);
+  else
+    BLAS_dgbmv_x(blas_rowmajor, blas_no_trans, h->m, h->n, h->kl, h->ku,
+		 alpha, (const double *) h->a, h->ld, x, incx, beta, y,
+		 incy, prec);
+}
+
+void BLAS_cmatrix_mv_x(const struct blas_matrix *h, const void *alpha,
+		       const void *x, int incx, const void *beta, void *y,
+		       int incy, enum blas_prec_type prec)
+{
+  if (check_handle(h, blas_matrix_elt_c, "BLAS_cmatrix_mv_x") != 0
+      || mv_empty(h, beta, y, incy, "BLAS_cmatrix_mv_x"))
+    return;
+  if (h->a_type == blas_matrix_elt_s) {
+    if (h->kl < 0)
+      BLAS_cgemv_s_c_x(blas_rowmajor, blas_no_trans, h->m, h->n, alpha,
+		       (const float *) h->a, h->ld, x, incx, beta, y, incy,
+		       prec);
+    else
+      BLAS_cgbmv_s_c_x(blas_rowmajor, blas_no_trans, h->m, h->n, h->kl,
+		       h->ku, alpha, (const float *) h->a, h->ld, x, incx,
+		       beta, y, incy, prec);
+  } else if (h->kl < 0)
+    BLAS_cgemv_x(blas_rowmajor, blas_no_trans, h->m, h->n, alpha, h->a,
+		 h->ld, x, incx, beta, y, incy, prec);
+  else
+    BLAS_cgbmv_x(blas_rowmajor, blas_no_trans, h->m, h->n, h->kl, h->ku,
+		 alpha, h->a, h->ld, x, incx, beta, y, incy, prec);
+}
+
+void BLAS_zmatrix_mv_x(const struct blas_matrix *h, const void *alpha,
+		       const void *x, int incx, const void *beta, void *y,
+		       int incy, enum blas_prec_type prec)
+{
+  if (check_handle(h, blas_matrix_elt_z, "BLAS_zmatrix_mv_x") != 0
+      || mv_empty(h, beta, y, incy, "BLAS_zmatrix_mv_x"))
+    return;
+  if (h->a_type == blas_matrix_elt_d) {
+    if (h->kl < 0)
+      BLAS_zgemv_d_z_x(blas_rowmajor, blas_no_trans, h->m, h->n, alpha,
+		       (const double *) h->a, h->ld, x, incx, beta, y, incy,
+		       prec);
+    else
+      BLAS_zgbmv_d_z_x(blas_rowmajor, blas_no_trans, h->m, h->n, h->kl,
+		       h->ku, alpha, (const double *) h->a, h->ld, x, incx,
+		       beta, y, incy, prec);
+  } else if (h->kl < 0)
+    BLAS_zgemv_x(blas_rowmajor, blas_no_trans, h->m, h->n, alpha, h->a,
+		 h->ld, x, incx, beta, y, incy, prec);
+  else
+    BLAS_zgbmv_x(blas_rowmajor, blas_no_trans, h->m, h->n, h->kl, h->ku,
+		 alpha, h->a, h->ld, x, incx, beta, y, incy, prec);
+}
+
+/* Checks a dense handle for _mm_x and returns the transpose of the packed
+   A that reads it in the given order: the rows of op(A) are the columns
+   of a column-major A^T.  An op(A) with no rows or no columns is done
+   here, C scaled by beta in the latter case, and returns 1. */
+static int mm_setup(const struct blas_matrix *h, enum blas_matrix_elt_type t,
+		    enum blas_order_type order, int n, const void *beta,
+		    void *c, int ldc, const char *routine_name,
+		    enum blas_trans_type *transa)
+{
+  int j, lines, len;
+
+  if (check_handle(h, t, routine_name) != 0)
+    return -1;
+  if (h->kl >= 0) {
+    BLAS_error(routine_name, -1, h->kl, NULL);
+    return -1;
+  }
+  if (order != blas_colmajor && order != blas_rowmajor) {
+    BLAS_error(routine_name, -2, order, NULL);
+    return -1;
+  }
+  *transa = (order == blas_rowmajor) ? blas_no_trans : blas_trans;
+  if (h->m > 0 && h->n > 0)
+    return 0;
+
+  if (n < 0) {
+    BLAS_error(routine_name, -4, n, NULL);
+    return -1;
+  }
+  lines = (order == blas_colmajor) ? n : h->m;
+  len = (order == blas_colmajor) ? h->m : n;
+  if (ldc < MAX(1, len)) {
+    BLAS_error(routine_name, -10, ldc, NULL);
+    return -1;
+  }
+  if (h->m > 0)
+    for (j = 0; j < lines; j++)
+      scale_vec(t, beta, (char *) c + (size_t) j * ldc * elt_size(t), len,
+		1);
+  return 1;
+}
+
+void BLAS_smatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, float alpha,
+		       const float *b, int ldb, float beta, float *c,
+		       int ldc, enum blas_prec_type prec)
+{
+  enum blas_trans_type transa;
+
+  if (mm_setup(h, blas_matrix_elt_s, order, n, &beta, c, ldc,
+	       "BLAS_smatrix_mm_x", &transa) != 0
+      || blas_gemm_engine_packed(order, transb, n, &alpha, &h->panels, b,
+				 blas_gemm_elt_s, ldb, &beta, c,
+				 blas_gemm_elt_s, ldc, prec))
+    return;
+  BLAS_sgemm_x(order, transa, transb, h->m, n, h->n, alpha,
+	       (const float *) h->a, h->ld, b, ldb, beta, c, ldc, prec);
+}
+
+void BLAS_dmatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, double alpha,
+		       const double *b, int ldb, double beta, double *c,
+		       int ldc, enum blas_prec_type prec)
+{
+  enum blas_trans_type transa;
+
+  if (mm_setup(h, blas_matrix_elt_d, order, n, &beta, c, ldc,
+	       "BLAS_dmatrix_mm_x", &transa) != 0
+      || blas_gemm_engine_packed(order, transb, n, &alpha, &h->panels, b,
+				 blas_gemm_elt_d, ldb, &beta, c,
+				 blas_gemm_elt_d, ldc, prec))
+    return;
+  BLAS_dgemm_x(order, transa, transb, h->m, n, h->n, alpha,
+	       (const double *) h->a, h->ld, b, ldb, beta, c, ldc, prec);
+}
+
+void BLAS_cmatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, const void *alpha,
+		       const void *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec)
+{
+  enum blas_trans_type transa;
+
+  if (mm_setup(h, blas_matrix_elt_c, order, n, beta, c, ldc,
+	       "BLAS_cmatrix_mm_x", &transa) != 0
+      || blas_gemm_engine_packed(order, transb, n, alpha, &h->panels, b,
+				 blas_gemm_elt_c, ldb, beta, c,
+				 blas_gemm_elt_c, ldc, prec))
+    return;
+  if (h->a_type == blas_matrix_elt_s)
+    BLAS_cgemm_s_c_x(order, transa, transb, h->m, n, h->n, alpha,
+		     (const float *) h->a, h->ld, b, ldb, beta, c, ldc, prec);
+  else
+    BLAS_cgemm_x(order, transa, transb, h->m, n, h->n, alpha, h->a, h->ld,
+		 b, ldb, beta, c, ldc, prec);
+}
+
+void BLAS_zmatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, const void *alpha,
+		       const void *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec)
+{
+  enum blas_trans_type transa;
+
+  if (mm_setup(h, blas_matrix_elt_z, order, n, beta, c, ldc,
+	       "BLAS_zmatrix_mm_x", &transa) != 0
+      || blas_gemm_engine_packed(order, transb, n, alpha, &h->panels, b,
+				 blas_gemm_elt_z, ldb, beta, c,
+				 blas_gemm_elt_z, ldc, prec))
+    return;
+  if (h->a_type == blas_matrix_elt_d)
+    BLAS_zgemm_d_z_x(order, transa, transb, h->m, n, h->n, alpha,
+		     (const double *) h->a, h->ld, b, ldb, beta, c, ldc,
+		     prec);
+  else
+    BLAS_zgemm_x(order, transa, transb, h->m, n, h->n, alpha, h->a, h->ld,
+		 b, ldb, beta, c, ldc, prec);
+}
@@ -0,0 +1,426 @@
+#include <math.h>
+#include <float.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_cpu.h"
+#include "blas_threads.h"
+#include "blas_repro.h"
+
+/*
+ * Binned summation.  Bin b of the grid takes multiples of its ulp
+ * 2^(b * BLAS_REPRO_WIDTH + REPRO_EMIN), so bin 0 holds the subnormals.
+ * A value is split top-down: its piece in a bin is the remainder rounded
+ * to that bin's ulp by adding and subtracting the bin's constant
+ * 1.5 * 2^52 ulps, which rounds the same way whatever else the bin
+ * holds.  The top bin is the lowest one taking 2^(BLAS_REPRO_WIDTH - 1)
+ * ulps of the largest value, so the pieces of any value in bins above
+ * its own are zero and raising the top later drops exactly the bins a
+ * higher top would never have filled.
+ */
+#define REPRO_EMIN (-1074)
+
+/* Highest bin whose constant and carry unit stay finite. */
+#define REPRO_TOP_MAX ((1023 - 53 - REPRO_EMIN) / BLAS_REPRO_WIDTH)
+
+/* Values from 2^REPRO_BIG_EXP up (2^1005) go to the hi bins, scaled by
+   2^-REPRO_HI_SHIFT. */
+#define REPRO_BIG_EXP \
+  (REPRO_TOP_MAX * BLAS_REPRO_WIDTH + BLAS_REPRO_WIDTH - 1 + REPRO_EMIN)
+#define REPRO_HI_SHIFT (2 * BLAS_REPRO_WIDTH)
+
+/* Strided values are gathered this many at a time. */
+#define REPRO_GATHER 512
+
+/* Lowest bin taking values of magnitude m. */
+static int bin_for(double m)
+{
+  int e, num;
+
+  frexp(m, &e);			/* m < 2^e */
+  num = e - (BLAS_REPRO_WIDTH - 1) - REPRO_EMIN;
+  return num <= 0 ? 0 : (num + BLAS_REPRO_WIDTH - 1) / BLAS_REPRO_WIDTH;
+}
+
+/* 2^52 ulps of bin b: the rounding constant is 1.5 of these, and the
+   carries count them. */
+static double bin_unit(int b)
+{
+  return ldexp(1.0, b * BLAS_REPRO_WIDTH + REPRO_EMIN + 52);
+}
+
+/* Rounding constants of the bins of b.  Bins below 0 only ever get
+   zeros, for which any constant will do. */
+static void bins_sigma(const struct blas_repro_bins *b, double *sigma)
+{
+  int k;
+
+  for (k = 0; k < BLAS_REPRO_FOLD; k++)
+    sigma[k] = 1.5 * bin_unit(MAX(b->top - k, 0));
+}
+
+/* Makes the top bin at least t, moving the sums down. */
+static void bins_raise(struct blas_repro_bins *b, int t)
+{
+  int d = t - b->top, k;
+
+  if (d <= 0)
+    return;
+  for (k = BLAS_REPRO_FOLD - 1; k >= 0; k--) {
+    b->s[k] = (k >= d) ? b->s[k - d] : 0.0;
+    b->c[k] = (k >= d) ? b->c[k - d] : 0.0;
+  }
+  b->top = t;
+}
+
+/* Moves whole units from each sum into its carry, leaving s in
+   [-unit/2, unit/2).  Exact, and the same (s, c) for the same bin value
+   however it was reached. */
+static void bins_carry(struct blas_repro_bins *b)
+{
+  int k;
+
+  for (k = 0; k < BLAS_REPRO_FOLD && b->top - k >= 0; k++) {
+    double unit = bin_unit(b->top - k);
+    double r = floor(b->s[k] / unit);
+
+    if (b->s[k] - r * unit >= 0.5 * unit)
+      r += 1.0;
+    b->c[k] += r;
+    b->s[k] -= r * unit;
+  }
+}
+
+/* Adds the sums of one deposit.  Both halves are below 2^52 ulps, so
+   the additions are exact. */
+static void bins_add(struct blas_repro_bins *b, const double *s)
+{
+  int k;
+
+  for (k = 0; k < BLAS_REPRO_FOLD; k++)
+    b->s[k] += s[k];
+  bins_carry(b);
+}
+
+static void bins_merge(struct blas_repro_bins *a,
+		       const struct blas_repro_bins *b)
+{
+  struct blas_repro_bins t = *b;
+  int k;
+
+  if (t.top < 0)
+    return;
+  bins_raise(a, t.top);
+  bins_raise(&t, a->top);
+  for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+    a->s[k] += t.s[k];
+    a->c[k] += t.c[k];
+  }
+  bins_carry(a);
+}
+
+/* The bins summed in double-double, lowest first. */
+static void bins_value(const struct blas_repro_bins *b,
+		       double *head, double *tail)
+{
+  int k;
+
+  *head = *tail = 0.0;
+  for (k = BLAS_REPRO_FOLD - 1; k >= 0; k--) {
+    if (b->top - k < 0)
+      continue;
+    blas_dd_add_d(*head, *tail, b->s[k], head, tail);
+    blas_dd_add_d(*head, *tail, b->c[k] * bin_unit(b->top - k), head, tail);
+  }
+}
+
+/* A block with infinities, NaNs or values of 2^1005 and more: each
+   value goes to special, hi or lo by itself. */
+static void add_block_slow(struct blas_repro *acc, int len,
+			   const double *x, int incx,
+			   const double *y, int incy)
+{
+  double big = ldexp(1.0, REPRO_BIG_EXP);
+  double m_lo = 0.0, m_hi = 0.0;
+  double sigma_lo[BLAS_REPRO_FOLD], sigma_hi[BLAS_REPRO_FOLD];
+  double s_lo[BLAS_REPRO_FOLD], s_hi[BLAS_REPRO_FOLD];
+  int j, k;
+
+  for (j = 0; j < len; j++) {
+    double v = x[(long) j * incx];
+    double a;
+
+    if (y != NULL)
+      v *= y[(long) j * incy];
+    a = fabs(v);
+    if (!(a <= DBL_MAX))
+      acc->special += v;	/* the same for any order */
+    else if (a >= big)
+      m_hi = MAX(m_hi, ldexp(a, -REPRO_HI_SHIFT));
+    else
+      m_lo = MAX(m_lo, a);
+  }
+  if (m_lo > 0.0)
+    bins_raise(&acc->lo, bin_for(m_lo));
+  if (m_hi > 0.0)
+    bins_raise(&acc->hi, bin_for(m_hi));
+  bins_sigma(&acc->lo, sigma_lo);
+  bins_sigma(&acc->hi, sigma_hi);
+  for (k = 0; k < BLAS_REPRO_FOLD; k++)
+    s_lo[k] = s_hi[k] = 0.0;
+
+  for (j = 0; j < len; j++) {
+    double v = x[(long) j * incx];
+    double a;
+
+    if (y != NULL)
+      v *= y[(long) j * incy];
+    a = fabs(v);
+    if (!(a <= DBL_MAX))
+      continue;
+    else if (a >= big)
+      blas_repro_deposit1(ldexp(v, -REPRO_HI_SHIFT), sigma_hi, s_hi);
+    else
+      blas_repro_deposit1(v, sigma_lo, s_lo);
+  }
+  if (m_lo > 0.0)
+    bins_add(&acc->lo, s_lo);
+  if (m_hi > 0.0)
+    bins_add(&acc->hi, s_hi);
+}
+
+/* At most BLAS_REPRO_BLOCK contiguous values. */
+static void add_block(struct blas_repro *acc,
+		      const struct blas_kernel_table *kt, int len,
+		      const double *x, const double *y)
+{
+  double sigma[BLAS_REPRO_FOLD], s[BLAS_REPRO_FOLD];
+  int finite;
+  double m = kt->repro_max(len, x, y, &finite);
+
+  if (!finite || m >= ldexp(1.0, REPRO_BIG_EXP)) {
+    add_block_slow(acc, len, x, 1, y, 1);
+    return;
+  }
+  if (m == 0.0)
+    return;
+  bins_raise(&acc->lo, bin_for(m));
+  bins_sigma(&acc->lo, sigma);
+  kt->repro_deposit(len, x, y, sigma, s);
+  bins_add(&acc->lo, s);
+}
+
+void blas_repro_init(struct blas_repro *acc)
+{
+  int k;
+
+  acc->lo.top = acc->hi.top = -1;
+  for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+    acc->lo.s[k] = acc->lo.c[k] = 0.0;
+    acc->hi.s[k] = acc->hi.c[k] = 0.0;
+  }
+  acc->special = 0.0;
+}
+
+void blas_repro_add(struct blas_repro *acc, int n, const double *x, int incx,
+		    const double *y, int incy)
+{
+  const struct blas_kernel_table *kt = blas_kernels();
+  double buf[REPRO_GATHER];
+  int i, j, len;
+
+  if (incx == 1 && (y == NULL || incy == 1)) {
+    for (i = 0; i < n; i += len) {
+      len = MIN(BLAS_REPRO_BLOCK, n - i);
+      add_block(acc, kt, len, x + i, (y != NULL) ? y + i : NULL);
+    }
+    return;
+  }
+
+  /* Strided values are formed in a buffer, rounded as in the kernels. */
+  for (i = 0; i < n; i += len) {
+    len = MIN(REPRO_GATHER, n - i);
+    for (j = 0; j < len; j++) {
+      buf[j] = x[(long) (i + j) * incx];
+      if (y != NULL)
+	buf[j] *= y[(long) (i + j) * incy];
+    }
+    add_block(acc, kt, len, buf, NULL);
+  }
+}
+
+void blas_repro_merge(struct blas_repro *acc, const struct blas_repro *b)
+{
+  bins_merge(&acc->lo, &b->lo);
+  bins_merge(&acc->hi, &b->hi);
+  acc->special += b->special;
+}
+
+double blas_repro_value(const struct blas_repro *acc)
+{
+  double head, tail, head_hi, tail_hi, scale;
+
+  if (acc->special != 0.0)
+    return acc->special;
+  bins_value(&acc->lo, &head, &tail);
+  if (acc->hi.top >= 0) {
+    scale = ldexp(1.0, REPRO_HI_SHIFT);
+    bins_value(&acc->hi, &head_hi, &tail_hi);
+    blas_dd_add(head, tail, head_hi * scale, tail_hi * scale, &head, &tail);
+  }
+  return head;
+}
+
+/* One chunk of a long vector per task, merged afterwards. */
+struct repro_job {
+  int n, chunk;
+  const double *x, *y;
+  struct blas_repro *acc;
+};
+
+static void repro_task(void *arg, int task, int worker)
+{
+  const struct repro_job *job = (const struct repro_job *) arg;
+  int i0 = task * job->chunk;
+  FPU_FIX_DECL;
+
+  (void) worker;
+  FPU_FIX_START;
+  blas_repro_init(&job->acc[task]);
+  blas_repro_add(&job->acc[task], MIN(job->chunk, job->n - i0),
+		 job->x + i0, 1, (job->y != NULL) ? job->y + i0 : NULL, 1);
+  FPU_FIX_STOP;
+}
+
+double blas_repro_dot(int n, const double *x, int incx,
+		      const double *y, int incy)
+{
+  struct blas_repro acc;
+
+  blas_repro_init(&acc);
+  if (incx == 1 && (y == NULL || incy == 1) && n >= BLAS_DD_PAR_MIN) {
+    struct blas_repro part[BLAS_DD_PAR_MAX_CHUNKS];
+    struct repro_job job;
+    int nchunks, t;
+
+    nchunks = (n + BLAS_DD_PAR_CHUNK - 1) / BLAS_DD_PAR_CHUNK;
+    if (nchunks > BLAS_DD_PAR_MAX_CHUNKS)
+      nchunks = BLAS_DD_PAR_MAX_CHUNKS;
+    job.n = n;
+    job.chunk = (n + nchunks - 1) / nchunks;
+    job.x = x;
+    job.y = y;
+    job.acc = part;
+    nchunks = (n + job.chunk - 1) / job.chunk;
+
+    blas_parallel_for(nchunks, blas_parallel_workers(nchunks), repro_task,
+		      &job);
+    for (t = 0; t < nchunks; t++)
+      blas_repro_merge(&acc, &part[t]);
+  } else {
+    blas_repro_add(&acc, n, x, incx, y, incy);
+  }
+  return blas_repro_value(&acc);
+}
+
+/* Columns contiguous: each row keeps its own bins, and a panel of at
+   most BLAS_REPRO_BLOCK columns is read once for the row maxima and
+   once for the deposits. */
+static void gemv_cols(int m, int n, const double *a, int lda,
+		      const double *x, int incx, double *sum)
+{
+  struct blas_repro acc[BLAS_REPRO_ROWS];
+  double sigma[BLAS_REPRO_FOLD][BLAS_REPRO_ROWS], s[BLAS_REPRO_FOLD][BLAS_REPRO_ROWS];
+  double mx[BLAS_REPRO_ROWS], z[BLAS_REPRO_ROWS];
+  double big = ldexp(1.0, REPRO_BIG_EXP);
+  int r0, rows, j0, cols, r, j, k;
+
+  for (r0 = 0; r0 < m; r0 += rows) {
+    rows = MIN(BLAS_REPRO_ROWS, m - r0);
+    for (r = 0; r < rows; r++)
+      blas_repro_init(&acc[r]);
+
+    for (j0 = 0; j0 < n; j0 += cols) {
+      const double *p = a + r0 + (long) j0 * lda;
+      int slow = 0;
+
+      cols = MIN(BLAS_REPRO_BLOCK, n - j0);
+      for (r = 0; r < rows; r++)
+	mx[r] = z[r] = 0.0;
+      for (j = 0; j < cols; j++) {
+	const double *col = p + (long) j * lda;
+	double xj = x[(long) (j0 + j) * incx];
+
+	for (r = 0; r < rows; r++) {
+	  double v = col[r] * xj;
+
+	  mx[r] = MAX(mx[r], fabs(v));
+	  z[r] += v * 0.0;
+	}
+      }
+      for (r = 0; r < rows; r++)
+	if (!(z[r] == z[r]) || mx[r] >= big)
+	  slow = 1;
+      if (slow) {
+	/* Rare: leave the panel to the row-by-row code. */
+	for (r = 0; r < rows; r++)
+	  blas_repro_add(&acc[r], cols, p + r, lda, x + (long) j0 * incx,
+			 incx);
+	continue;
+      }
+
+      for (r = 0; r < rows; r++) {
+	double sig[BLAS_REPRO_FOLD];
+
+	if (mx[r] > 0.0)
+	  bins_raise(&acc[r].lo, bin_for(mx[r]));
+	bins_sigma(&acc[r].lo, sig);
+	for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+	  sigma[k][r] = sig[k];
+	  s[k][r] = 0.0;
+	}
+      }
+      for (j = 0; j < cols; j++) {
+	const double *col = p + (long) j * lda;
+	double xj = x[(long) (j0 + j) * incx];
+
+	for (r = 0; r < rows; r++) {
+	  double v = col[r] * xj;
+
+	  for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+	    double q = (v + sigma[k][r]) - sigma[k][r];
+
+	    s[k][r] += q;
+	    v -= q;
+	  }
+	}
+      }
+      for (r = 0; r < rows; r++) {
+	double sr[BLAS_REPRO_FOLD];
+
+	if (mx[r] == 0.0)
+	  continue;
+	for (k = 0; k < BLAS_REPRO_FOLD; k++)
+	  sr[k] = s[k][r];
+	bins_add(&acc[r].lo, sr);
+      }
+    }
+
+    for (r = 0; r < rows; r++)
+      sum[r0 + r] = blas_repro_value(&acc[r]);
+  }
+}
+
+void blas_repro_gemv(int m, int n, const double *a, int incai, int incaij,
+		     const double *x, int incx, double *sum)
+{
+  int i;
+
+  if (incai == 1 && incaij != 1) {
+    gemv_cols(m, n, a, incaij, x, incx, sum);
+    return;
+  }
+  for (i = 0; i < m; i++)
+    sum[i] = blas_repro_dot(n, a + (long) i * incai, incaij, x, incx);
+}
@@ -0,0 +1,236 @@
+#include <stdlib.h>
+#include "blas_malloc.h"
+#include "blas_threads.h"
+
+/* A thread's scratch block. */
+struct scratch {
+  void *p;
+  size_t len;
+};
+
+static void *scratch_grow(struct scratch *s, size_t bytes)
+{
+  if (s->len < bytes) {
+    blas_free(s->p);
+    s->p = blas_malloc(bytes);
+    s->len = (s->p != NULL) ? bytes : 0;
+  }
+  return s->p;
+}
+
+#ifndef BLAS_NO_THREADS
+
+#include <pthread.h>
+
+/* Thread count; 0 until the environment has been read. */
+static int num_threads = 0;
+
+static int threads_from_env(void)
+{
+  const char *s = getenv(BLAS_THREADS_ENV);
+  int n = (s != NULL) ? atoi(s) : 1;
+
+  if (n < 1)
+    n = 1;
+  if (n > BLAS_MAX_THREADS)
+    n = BLAS_MAX_THREADS;
+  return n;
+}
+
+/*
+ * The caller of blas_parallel_for is worker 0 and pool thread w is
+ * worker w.  Tasks are handed out from a shared counter under pool_lock;
+ * the caller returns once every task has finished, so a worker that
+ * oversleeps a whole job simply finds nothing left to do.
+ */
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cv = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cv = PTHREAD_COND_INITIALIZER;
+
+static int pool_size = 0;	/* pool threads started             */
+static int pool_busy = 0;	/* a job is in flight               */
+
+static unsigned long job_gen = 0;	/* bumped for every job     */
+static blas_task_fn job_fn;
+static void *job_arg;
+static int job_workers, job_ntasks, job_next, job_done;
+
+/* Runs tasks of job 'gen' until none are left; pool_lock is held on
+   entry and on return. */
+static void run_tasks(unsigned long gen, int worker)
+{
+  while (job_gen == gen && worker < job_workers && job_next < job_ntasks) {
+    int task = job_next++;
+    blas_task_fn fn = job_fn;
+    void *arg = job_arg;
+
+    pthread_mutex_unlock(&pool_lock);
+    fn(arg, task, worker);
+    pthread_mutex_lock(&pool_lock);
+    if (++job_done == job_ntasks)
+      pthread_cond_signal(&done_cv);
+  }
+}
+
+static void *worker_main(void *p)
+{
+  int worker = (int) (long) p;
+  unsigned long seen = 0;
+
+  pthread_mutex_lock(&pool_lock);
+  for (;;) {
+    while (job_gen == seen)
+      pthread_cond_wait(&work_cv, &pool_lock);
+    seen = job_gen;
+    run_tasks(seen, worker);
+  }
+  return NULL;
+}
+
+/* Grows the pool to n - 1 threads; returns the workers available. */
+static int pool_grow(int n)
+{
+  pthread_attr_t attr;
+  pthread_t tid;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  while (pool_size < n - 1) {
+    if (pthread_create(&tid, &attr, worker_main,
+		       (void *) (long) (pool_size + 1)) != 0)
+      break;
+    pool_size++;
+  }
+  pthread_attr_destroy(&attr);
+  return pool_size + 1;
+}
+
+void BLAS_set_num_threads(int nthreads)
+{
+  if (nthreads < 1)
+    nthreads = 1;
+  if (nthreads > BLAS_MAX_THREADS)
+    nthreads = BLAS_MAX_THREADS;
+  pthread_mutex_lock(&pool_lock);
+  num_threads = nthreads;
+  pthread_mutex_unlock(&pool_lock);
+}
+
+int BLAS_get_num_threads(void)
+{
+  int n;
+
+  pthread_mutex_lock(&pool_lock);
+  if (num_threads == 0)
+    num_threads = threads_from_env();
+  n = num_threads;
+  pthread_mutex_unlock(&pool_lock);
+  return n;
+}
+
+void blas_parallel_for(int ntasks, int nworkers, blas_task_fn fn, void *arg)
+{
+  unsigned long gen;
+  int task;
+
+  if (ntasks > 1 && nworkers > 1) {
+    pthread_mutex_lock(&pool_lock);
+    if (!pool_busy) {
+      pool_busy = 1;
+      job_fn = fn;
+      job_arg = arg;
+      job_workers = pool_grow(nworkers);
+      if (job_workers > nworkers)
+	job_workers = nworkers;
+      job_ntasks = ntasks;
+      job_next = job_done = 0;
+      gen = ++job_gen;
+      pthread_cond_broadcast(&work_cv);
+
+      run_tasks(gen, 0);
+      while (job_done < job_ntasks)
+	pthread_cond_wait(&done_cv, &pool_lock);
+      pool_busy = 0;
+      pthread_mutex_unlock(&pool_lock);
+      return;
+    }
+    pthread_mutex_unlock(&pool_lock);
+  }
+
+  for (task = 0; task < ntasks; task++)
+    fn(arg, task, 0);
+}
+
+static pthread_key_t scratch_key;
+static pthread_once_t scratch_once = PTHREAD_ONCE_INIT;
+static int scratch_ok = 0;
+
+static void scratch_free(void *p)
+{
+  struct scratch *s = (struct scratch *) p;
+
+  blas_free(s->p);
+  free(s);
+}
+
+static void scratch_init(void)
+{
+  scratch_ok = (pthread_key_create(&scratch_key, scratch_free) == 0);
+}
+
+void *blas_thread_scratch(size_t bytes)
+{
+  struct scratch *s;
+
+  pthread_once(&scratch_once, scratch_init);
+  if (!scratch_ok)
+    return NULL;
+  s = (struct scratch *) pthread_getspecific(scratch_key);
+  if (s == NULL) {
+    s = (struct scratch *) calloc(1, sizeof(struct scratch));
+    if (s == NULL)
+      return NULL;
+    if (pthread_setspecific(scratch_key, s) != 0) {
+      free(s);
+      return NULL;
+    }
+  }
+  return scratch_grow(s, bytes);
+}
+
+#else /* BLAS_NO_THREADS */
+
+/* Built without threads: the count stays at 1. */
+void BLAS_set_num_threads(int nthreads)
+{
+}
+
+int BLAS_get_num_threads(void)
+{
+  return 1;
+}
+
+void blas_parallel_for(int ntasks, int nworkers, blas_task_fn fn, void *arg)
+{
+  int task;
+
+  for (task = 0; task < ntasks; task++)
+    fn(arg, task, 0);
+}
+
+void *blas_thread_scratch(size_t bytes)
+{
+  static struct scratch s;
+
+  return scratch_grow(&s, bytes);
+}
+
+#endif /* BLAS_NO_THREADS */
+
+int blas_parallel_workers(int ntasks)
+{
+  int n = BLAS_get_num_threads();
+
+  return (ntasks < n) ? ((ntasks < 1) ? 1 : ntasks) : n;
+}
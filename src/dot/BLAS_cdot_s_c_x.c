@@ -130,6 +130,7 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -265,31 +266,22 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
 	  head_b = head_prod[0];
 	  tail_b = tail_prod[0];
 	  {
-	    /* Compute double-double = double-double + double-double. */
+	    /* Compute double-double = double-double + double-double,
+	       renormalizing once. */
 	    double	    bv;
-	    double	    s1  , s2, t1, t2;
+	    double	    s1  , s2;
 
 	    /* Add two hi words. */
 	    s1 = head_a + head_b;
 	    bv = s1 - head_a;
 	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
+	    /* Add the lo words to the error. */
+	    s2 += tail_a + tail_b;
 
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
+	    /* Renormalize (s1, s2)  */
+	    head_t = s1 + s2;
+	    tail_t = s2 - (head_t - s1);
 	  }
 	  head_sum[0] = head_t;
 	  tail_sum[0] = tail_t;
@@ -299,31 +291,22 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
 	  head_b = head_prod[1];
 	  tail_b = tail_prod[1];
 	  {
-	    /* Compute double-double = double-double + double-double. */
+	    /* Compute double-double = double-double + double-double,
+	       renormalizing once. */
 	    double	    bv;
-	    double	    s1  , s2, t1, t2;
+	    double	    s1  , s2;
 
 	    /* Add two hi words. */
 	    s1 = head_a + head_b;
 	    bv = s1 - head_a;
 	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
+	    /* Add the lo words to the error. */
+	    s2 += tail_a + tail_b;
 
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
+	    /* Renormalize (s1, s2)  */
+	    head_t = s1 + s2;
+	    tail_t = s2 - (head_t - s1);
 	  }
 	  head_sum[1] = head_t;
 	  tail_sum[1] = tail_t;
@@ -350,19 +333,10 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
 	  /* real part */
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a0 * split;
-	    a11 = con - head_a0;
-	    a11 = con - a11;
-	    a21 = head_a0 - a11;
-	    con = cd[0] * split;
-	    b1 = con - cd[0];
-	    b1 = con - b1;
-	    b2 = cd[0] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a0 * cd[0];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 	    c2 = tail_a0 * cd[0];
 	    t1 = c11 + c2;
@@ -373,19 +347,10 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a1 * split;
-	    a11 = con - head_a1;
-	    a11 = con - a11;
-	    a21 = head_a1 - a11;
-	    con = cd[1] * split;
-	    b1 = con - cd[1];
-	    b1 = con - b1;
-	    b2 = cd[1] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a1 * cd[1];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 	    c2 = tail_a1 * cd[1];
 	    t1 = c11 + c2;
@@ -428,19 +393,10 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
 	  /* imaginary part */
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a1 * split;
-	    a11 = con - head_a1;
-	    a11 = con - a11;
-	    a21 = head_a1 - a11;
-	    con = cd[0] * split;
-	    b1 = con - cd[0];
-	    b1 = con - b1;
-	    b2 = cd[0] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a1 * cd[0];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 	    c2 = tail_a1 * cd[0];
 	    t1 = c11 + c2;
@@ -451,19 +407,10 @@ void		BLAS_cdot_s_c_x(enum blas_conj_type conj, int n, const void *alpha,
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a0 * split;
-	    a11 = con - head_a0;
-	    a11 = con - a11;
-	    a21 = head_a0 - a11;
-	    con = cd[1] * split;
-	    b1 = con - cd[1];
-	    b1 = con - b1;
-	    b2 = cd[1] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a0 * cd[1];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 	    c2 = tail_a0 * cd[1];
 	    t1 = c11 + c2;
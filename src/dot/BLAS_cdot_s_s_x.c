@@ -124,6 +124,7 @@ void		BLAS_cdot_s_s_x(enum blas_conj_type conj, int n, const void *alpha,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -240,31 +241,22 @@ void		BLAS_cdot_s_s_x(enum blas_conj_type conj, int n, const void *alpha,
 	head_prod = (double)x_ii *y_ii;
 	tail_prod = 0.0;	/* prod = x[i]*y[i] */
 	{
-	  /* Compute double-double = double-double + double-double. */
+	  /* Compute double-double = double-double + double-double,
+	     renormalizing once. */
 	  double	  bv;
-	  double	  s1    , s2, t1, t2;
+	  double	  s1    , s2;
 
 	  /* Add two hi words. */
 	  s1 = head_sum + head_prod;
 	  bv = s1 - head_sum;
 	  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-	  /* Add two lo words. */
-	  t1 = tail_sum + tail_prod;
-	  bv = t1 - tail_sum;
-	  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-	  s2 += t1;
-
-	  /* Renormalize (s1, s2)  to  (t1, s2) */
-	  t1 = s1 + s2;
-	  s2 = s2 - (t1 - s1);
-
-	  t2 += s2;
+	  /* Add the lo words to the error. */
+	  s2 += tail_sum + tail_prod;
 
-	  /* Renormalize (t1, t2)  */
-	  head_sum = t1 + t2;
-	  tail_sum = t2 - (head_sum - t1);
+	  /* Renormalize (s1, s2)  */
+	  head_sum = s1 + s2;
+	  tail_sum = s2 - (head_sum - s1);
 	}			/* sum = sum+prod */
 	ix += incx;
 	iy += incy;
@@ -277,19 +269,10 @@ void		BLAS_cdot_s_s_x(enum blas_conj_type conj, int n, const void *alpha,
 	dt = (double)alpha_i[0];
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum * split;
-	  a11 = con - head_sum;
-	  a11 = con - a11;
-	  a21 = head_sum - a11;
-	  con = dt * split;
-	  b1 = con - dt;
-	  b1 = con - b1;
-	  b2 = dt - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum * dt;
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 	  c2 = tail_sum * dt;
 	  t1 = c11 + c2;
@@ -303,19 +286,10 @@ void		BLAS_cdot_s_s_x(enum blas_conj_type conj, int n, const void *alpha,
 	dt = (double)alpha_i[1];
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum * split;
-	  a11 = con - head_sum;
-	  a11 = con - a11;
-	  a21 = head_sum - a11;
-	  con = dt * split;
-	  b1 = con - dt;
-	  b1 = con - b1;
-	  b2 = dt - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum * dt;
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 	  c2 = tail_sum * dt;
 	  t1 = c11 + c2;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 void		BLAS_ddot_s_d_x(enum blas_conj_type conj, int n, double alpha,
 		  		const		float *x, int incx, double beta,
 		      		const		double *y, int incy,
@@ -55,6 +56,7 @@ void		BLAS_ddot_s_d_x(enum blas_conj_type conj, int n, double alpha,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -95,15 +97,20 @@ void		BLAS_ddot_s_d_x(enum blas_conj_type conj, int n, double alpha,
       if (incy < 0)
 	iy = (-n + 1) * incy;
 
-      for (i = 0; i < n; ++i) {
-	x_ii = x_i[ix];
-	y_ii = y_i[iy];
+      /* Long vectors are reduced in fixed chunks on the thread pool. */
+      if (incx == 1 && incy == 1 && n >= BLAS_DD_PAR_MIN) {
+	blas_dot_x_par(n, x_i, 1, y_i, 0, 0, blas_no_conj, &sum, NULL);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii = x_i[ix];
+	  y_ii = y_i[iy];
 
-	prod = x_ii * y_ii;	/* prod = x[i]*y[i] */
-	sum = sum + prod;	/* sum = sum+prod */
-	ix += incx;
-	iy += incy;
-      }				/* endfor */
+	  prod = x_ii * y_ii;	/* prod = x[i]*y[i] */
+	  sum = sum + prod;	/* sum = sum+prod */
+	  ix += incx;
+	  iy += incy;
+	}				/* endfor */
+      }
 
 
       tmp1 = sum * alpha_i;	/* tmp1 = sum*alpha */
@@ -154,76 +161,57 @@ void		BLAS_ddot_s_d_x(enum blas_conj_type conj, int n, double alpha,
       if (incy < 0)
 	iy = (-n + 1) * incy;
 
-      for (i = 0; i < n; ++i) {
-	x_ii = x_i[ix];
-	y_ii = y_i[iy];
+      /* Unit stride goes through the vector kernel, long vectors in
+	   fixed chunks on the thread pool. */
+      if (incx == 1 && incy == 1 && n >= BLAS_DD_PAR_MIN) {
+	blas_dot_x_par(n, x_i, 1, y_i, 0, 0, blas_no_conj,
+		       &head_sum, &tail_sum);
+      } else if (incx == 1 && incy == 1 && blas_dd_vec_enabled()) {
+	blas_dot_x_kernel(n, x_i, 1, y_i, 0, 0, blas_no_conj,
+			  &head_sum, &tail_sum);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii = x_i[ix];
+	  y_ii = y_i[iy];
 
-	{
-	  double	  dt = (double)x_ii;
 	  {
-	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = dt * split;
-	    a1 = con - dt;
-	    a1 = con - a1;
-	    a2 = dt - a1;
-	    con = y_ii * split;
-	    b1 = con - y_ii;
-	    b1 = con - b1;
-	    b2 = y_ii - b1;
-
-	    head_prod = dt * y_ii;
-	    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
-	  }
-	}			/* prod = x[i]*y[i] */
-	{
-	  /* Compute double-double = double-double + double-double. */
-	  double	  bv;
-	  double	  s1    , s2, t1, t2;
-
-	  /* Add two hi words. */
-	  s1 = head_sum + head_prod;
-	  bv = s1 - head_sum;
-	  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-	  /* Add two lo words. */
-	  t1 = tail_sum + tail_prod;
-	  bv = t1 - tail_sum;
-	  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-	  s2 += t1;
-
-	  /* Renormalize (s1, s2)  to  (t1, s2) */
-	  t1 = s1 + s2;
-	  s2 = s2 - (t1 - s1);
-
-	  t2 += s2;
-
-	  /* Renormalize (t1, t2)  */
-	  head_sum = t1 + t2;
-	  tail_sum = t2 - (head_sum - t1);
-	}			/* sum = sum+prod */
-	ix += incx;
-	iy += incy;
-      }				/* endfor */
+	    double	  dt = (double)x_ii;
+	    {
+	      /* Compute double_double = double * double. */
+	      head_prod = dt * y_ii;
+	      tail_prod = BLAS_TWO_PROD_ERR(dt, y_ii, head_prod);
+	    }
+	  }			/* prod = x[i]*y[i] */
+	  {
+	    /* Compute double-double = double-double + double-double,
+	       renormalizing once. */
+	    double	  bv;
+	    double	  s1    , s2;
+
+	    /* Add two hi words. */
+	    s1 = head_sum + head_prod;
+	    bv = s1 - head_sum;
+	    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+	    /* Add the lo words to the error. */
+	    s2 += tail_sum + tail_prod;
+
+	    /* Renormalize (s1, s2)  */
+	    head_sum = s1 + s2;
+	    tail_sum = s2 - (head_sum - s1);
+	  }			/* sum = sum+prod */
+	  ix += incx;
+	  iy += incy;
+	}				/* endfor */
+      }
 
 
       {
 	/* Compute double-double = double-double * double. */
-	double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	con = head_sum * split;
-	a11 = con - head_sum;
-	a11 = con - a11;
-	a21 = head_sum - a11;
-	con = alpha_i * split;
-	b1 = con - alpha_i;
-	b1 = con - b1;
-	b2 = alpha_i - b1;
+	double		c11    , c21, c2, t1, t2;
 
 	c11 = head_sum * alpha_i;
-	c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 	c2 = tail_sum * alpha_i;
 	t1 = c11 + c2;
@@ -234,19 +222,8 @@ void		BLAS_ddot_s_d_x(enum blas_conj_type conj, int n, double alpha,
       }				/* tmp1 = sum*alpha */
       {
 	/* Compute double_double = double * double. */
-	double		a1     , a2, b1, b2, con;
-
-	con = r_v * split;
-	a1 = con - r_v;
-	a1 = con - a1;
-	a2 = r_v - a1;
-	con = beta_i * split;
-	b1 = con - beta_i;
-	b1 = con - b1;
-	b2 = beta_i - b1;
-
 	head_tmp2 = r_v * beta_i;
-	tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	tail_tmp2 = BLAS_TWO_PROD_ERR(r_v, beta_i, head_tmp2);
       }				/* tmp2 = r*beta */
       {
 	/* Compute double-double = double-double + double-double. */
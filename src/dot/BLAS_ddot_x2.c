@@ -0,0 +1,87 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_batch.h"
+
+void BLAS_ddot_x2(enum blas_conj_type conj, int n, double alpha,
+		  const double *x, int incx, double beta,
+		  const double *y, int incy, double *r_head, double *r_tail)
+/*
+ * Purpose
+ * =======
+ *
+ * Computes (r_head, r_tail) <- beta * (r_head, r_tail)
+ *                              + alpha * SUM_{i=0}^{n-1} x[i] * y[i]
+ * in double-double, as BLAS_ddot_x does with blas_prec_extra, and
+ * stores the result as its two words instead of rounding it to one
+ * double.  r_head + r_tail is the value; r_tail is read only when beta
+ * is nonzero, so the result of one call can feed the next.
+ *
+ * Arguments
+ * =========
+ *
+ * conj    (input) enum blas_conj_type
+ *         When x and y are complex vectors, specifies whether vector
+ *         components x[i] are used unconjugated or conjugated.
+ *
+ * n       (input) int
+ *         The length of vectors x and y.
+ *
+ * alpha   (input) double
+ *
+ * x       (input) const double*
+ *         Array of length n.
+ *
+ * incx    (input) int
+ *         The stride used to access components x[i].
+ *
+ * beta    (input) double
+ *
+ * y       (input) const double*
+ *         Array of length n.
+ *
+ * incy    (input) int
+ *         The stride used to access components y[i].
+ *
+ * r_head  (input/output) double*
+ * r_tail  (input/output) double*
+ *         The two words of r.
+ *
+ */
+{
+  static const char routine_name[] = "BLAS_ddot_x2";
+  double head_sum = 0.0, tail_sum = 0.0;
+  FPU_FIX_DECL;
+
+  /* Test the input parameters. */
+  if (n < 0)
+    BLAS_error(routine_name, -2, n, NULL);
+  else if (incx == 0)
+    BLAS_error(routine_name, -5, incx, NULL);
+  else if (incy == 0)
+    BLAS_error(routine_name, -8, incy, NULL);
+
+  /* Immediate return. */
+  if ((beta == 1.0) && (n == 0 || (alpha == 0.0)))
+    return;
+
+  FPU_FIX_START;
+
+  if (incx < 0)
+    x += (-n + 1) * incx;
+  if (incy < 0)
+    y += (-n + 1) * incy;
+
+  if (alpha != 0.0) {
+    if (incx == 1 && incy == 1 && n >= BLAS_DD_PAR_MIN)
+      blas_dot_x_par(n, x, 0, y, 0, 0, blas_no_conj, &head_sum, &tail_sum);
+    else if (incx == 1 && incy == 1 && blas_dd_vec_enabled())
+      blas_dot_x_kernel(n, x, 0, y, 0, 0, blas_no_conj,
+			&head_sum, &tail_sum);
+    else
+      blas_batch_dot_dd(n, x, incx, y, incy, &head_sum, &tail_sum);
+  }
+  blas_dd_axpby(alpha, head_sum, tail_sum, beta, r_head, r_tail);
+
+  FPU_FIX_STOP;
+}
@@ -0,0 +1,186 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_batch.h"
+#include "blas_repro.h"
+
+/*
+ * Purpose
+ * =======
+ *
+ * Computes r[p] <- beta * r[p] + alpha * SUM_{i=0}^{n-1} x_p[i] * y_p[i]
+ * for each problem p of a batch, with the precision of BLAS_ddot_x.
+ *
+ * BLAS_ddot_x_batch takes arrays of vector pointers, x[p] and y[p].
+ * BLAS_ddot_x_batch_strided takes x_p = x + p*stridex and
+ * y_p = y + p*stridey.  Other arguments are those of BLAS_ddot_x, and
+ * r holds the batch's results contiguously.
+ *
+ * Each r[p] is the value BLAS_ddot_x would store.
+ *
+ */
+
+struct dot_batch {
+  int n;
+  double alpha, beta;
+  const double *x, *y;		/* strided bases, or NULL          */
+  const double *const *xs, *const *ys;	/* pointer arrays        */
+  long stridex, stridey;
+  int incx, incy;
+  double *r;
+  int batch, chunk;
+  enum blas_prec_type prec;
+};
+
+static void dot_one(const struct dot_batch *b, const double *x,
+		    const double *y, double *r)
+{
+  int n = b->n, incx = b->incx, incy = b->incy;
+  int unit = (incx == 1 && incy == 1);
+
+  /* Immediate return. */
+  if ((b->beta == 1.0) && (n == 0 || (b->alpha == 0.0)))
+    return;
+
+  if (incx < 0)
+    x += (-n + 1) * incx;
+  if (incy < 0)
+    y += (-n + 1) * incy;
+
+  if (b->prec == blas_prec_reproducible) {
+    *r = blas_repro_dot(n, x, incx, y, incy) * b->alpha + *r * b->beta;
+  } else if (b->prec == blas_prec_extra) {
+    double head_sum, tail_sum, head_tmp1, tail_tmp1, head_tmp2, tail_tmp2;
+
+    if (unit && n >= BLAS_DD_PAR_MIN)
+      blas_dot_x_par(n, x, 0, y, 0, 0, blas_no_conj, &head_sum, &tail_sum);
+    else if (unit && blas_dd_vec_enabled())
+      blas_dot_x_kernel(n, x, 0, y, 0, 0, blas_no_conj,
+			&head_sum, &tail_sum);
+    else
+      blas_batch_dot_dd(n, x, incx, y, incy, &head_sum, &tail_sum);
+
+    blas_dd_mul_d(head_sum, tail_sum, b->alpha, &head_tmp1, &tail_tmp1);
+    blas_dd_two_prod(*r, b->beta, &head_tmp2, &tail_tmp2);
+    blas_dd_add(head_tmp1, tail_tmp1, head_tmp2, tail_tmp2,
+		&head_tmp1, &tail_tmp1);
+    *r = head_tmp1;
+  } else {
+    double sum;
+
+    if (unit && n >= BLAS_DD_PAR_MIN)
+      blas_dot_x_par(n, x, 0, y, 0, 0, blas_no_conj, &sum, NULL);
+    else
+      sum = blas_batch_dot_d(n, x, incx, y, incy);
+    *r = sum * b->alpha + *r * b->beta;
+  }
+}
+
+static void dot_task(void *arg, int task, int worker)
+{
+  const struct dot_batch *b = (const struct dot_batch *) arg;
+  int p, p0 = task * b->chunk, p1 = p0 + b->chunk;
+  FPU_FIX_DECL;
+
+  (void) worker;
+  if (p1 > b->batch)
+    p1 = b->batch;
+  if (b->prec == blas_prec_extra || b->prec == blas_prec_reproducible) {
+    FPU_FIX_START;
+  }
+  for (p = p0; p < p1; p++) {
+    if (b->xs != NULL)
+      dot_one(b, b->xs[p], b->ys[p], &b->r[p]);
+    else
+      dot_one(b, b->x + p * b->stridex, b->y + p * b->stridey, &b->r[p]);
+  }
+  if (b->prec == blas_prec_extra || b->prec == blas_prec_reproducible) {
+    FPU_FIX_STOP;
+  }
+}
+
+static void dot_run(struct dot_batch *b)
+{
+  int ntasks;
+
+  if (b->batch <= 0)
+    return;
+  b->chunk = blas_batch_chunk(b->n);
+  ntasks = (b->batch + b->chunk - 1) / b->chunk;
+  blas_parallel_for(ntasks, blas_parallel_workers(ntasks), dot_task, b);
+}
+
+void BLAS_ddot_x_batch(enum blas_conj_type conj, int n, double alpha,
+		       const double *const *x, int incx, double beta,
+		       const double *const *y, int incy,
+		       double *r, int batch, enum blas_prec_type prec)
+{
+  static const char routine_name[] = "BLAS_ddot_x_batch";
+  struct dot_batch b;
+
+  if (!blas_batch_prec_known(prec))
+    return;
+
+  /* Test the input parameters. */
+  if (n < 0)
+    BLAS_error(routine_name, -2, n, NULL);
+  else if (incx == 0)
+    BLAS_error(routine_name, -5, incx, NULL);
+  else if (incy == 0)
+    BLAS_error(routine_name, -8, incy, NULL);
+  else if (batch < 0)
+    BLAS_error(routine_name, -10, batch, NULL);
+
+  b.n = n;
+  b.alpha = alpha;
+  b.beta = beta;
+  b.x = b.y = NULL;
+  b.xs = x;
+  b.ys = y;
+  b.stridex = b.stridey = 0;
+  b.incx = incx;
+  b.incy = incy;
+  b.r = r;
+  b.batch = batch;
+  b.prec = prec;
+  dot_run(&b);
+}
+
+void BLAS_ddot_x_batch_strided(enum blas_conj_type conj, int n,
+			       double alpha, const double *x, int incx,
+			       int stridex, double beta, const double *y,
+			       int incy, int stridey, double *r, int batch,
+			       enum blas_prec_type prec)
+{
+  static const char routine_name[] = "BLAS_ddot_x_batch_strided";
+  struct dot_batch b;
+
+  if (!blas_batch_prec_known(prec))
+    return;
+
+  /* Test the input parameters. */
+  if (n < 0)
+    BLAS_error(routine_name, -2, n, NULL);
+  else if (incx == 0)
+    BLAS_error(routine_name, -5, incx, NULL);
+  else if (incy == 0)
+    BLAS_error(routine_name, -9, incy, NULL);
+  else if (batch < 0)
+    BLAS_error(routine_name, -12, batch, NULL);
+
+  b.n = n;
+  b.alpha = alpha;
+  b.beta = beta;
+  b.x = x;
+  b.y = y;
+  b.xs = b.ys = NULL;
+  b.stridex = stridex;
+  b.stridey = stridey;
+  b.incx = incx;
+  b.incy = incy;
+  b.r = r;
+  b.batch = batch;
+  b.prec = prec;
+  dot_run(&b);
+}
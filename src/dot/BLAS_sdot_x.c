@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 void		BLAS_sdot_x(enum blas_conj_type conj, int n, float alpha,
 	       		const		float *x, int incx, float beta,
 		  		const		float *y, int incy,
@@ -114,6 +115,7 @@ void		BLAS_sdot_x(enum blas_conj_type conj, int n, float alpha,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -213,61 +215,49 @@ void		BLAS_sdot_x(enum blas_conj_type conj, int n, float alpha,
       if (incy < 0)
 	iy = (-n + 1) * incy;
 
-      for (i = 0; i < n; ++i) {
-	x_ii = x_i[ix];
-	y_ii = y_i[iy];
-
-	head_prod = (double)x_ii *y_ii;
-	tail_prod = 0.0;	/* prod = x[i]*y[i] */
-	{
-	  /* Compute double-double = double-double + double-double. */
-	  double	  bv;
-	  double	  s1    , s2, t1, t2;
-
-	  /* Add two hi words. */
-	  s1 = head_sum + head_prod;
-	  bv = s1 - head_sum;
-	  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-	  /* Add two lo words. */
-	  t1 = tail_sum + tail_prod;
-	  bv = t1 - tail_sum;
-	  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-	  s2 += t1;
-
-	  /* Renormalize (s1, s2)  to  (t1, s2) */
-	  t1 = s1 + s2;
-	  s2 = s2 - (t1 - s1);
-
-	  t2 += s2;
-
-	  /* Renormalize (t1, t2)  */
-	  head_sum = t1 + t2;
-	  tail_sum = t2 - (head_sum - t1);
-	}			/* sum = sum+prod */
-	ix += incx;
-	iy += incy;
-      }				/* endfor */
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 1 && incy == 1 && blas_dd_vec_enabled()) {
+	blas_dot_x_kernel(n, x_i, 1, y_i, 1, 0, blas_no_conj,
+			  &head_sum, &tail_sum);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii = x_i[ix];
+	  y_ii = y_i[iy];
+
+	  head_prod = (double)x_ii *y_ii;
+	  tail_prod = 0.0;	/* prod = x[i]*y[i] */
+	  {
+	    /* Compute double-double = double-double + double-double,
+	       renormalizing once. */
+	    double	  bv;
+	    double	  s1    , s2;
+
+	    /* Add two hi words. */
+	    s1 = head_sum + head_prod;
+	    bv = s1 - head_sum;
+	    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+	    /* Add the lo words to the error. */
+	    s2 += tail_sum + tail_prod;
+
+	    /* Renormalize (s1, s2)  */
+	    head_sum = s1 + s2;
+	    tail_sum = s2 - (head_sum - s1);
+	  }			/* sum = sum+prod */
+	  ix += incx;
+	  iy += incy;
+	}				/* endfor */
+      }
 
 
       {
 	double		dt = (double)alpha_i;
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum * split;
-	  a11 = con - head_sum;
-	  a11 = con - a11;
-	  a21 = head_sum - a11;
-	  con = dt * split;
-	  b1 = con - dt;
-	  b1 = con - b1;
-	  b2 = dt - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum * dt;
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 	  c2 = tail_sum * dt;
 	  t1 = c11 + c2;
@@ -55,6 +55,7 @@ void		BLAS_zdot_d_d_x(enum blas_conj_type conj, int n, const void *alpha,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -170,46 +171,26 @@ void		BLAS_zdot_d_d_x(enum blas_conj_type conj, int n, const void *alpha,
 
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = x_ii * split;
-	  a1 = con - x_ii;
-	  a1 = con - a1;
-	  a2 = x_ii - a1;
-	  con = y_ii * split;
-	  b1 = con - y_ii;
-	  b1 = con - b1;
-	  b2 = y_ii - b1;
-
 	  head_prod = x_ii * y_ii;
-	  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_prod = BLAS_TWO_PROD_ERR(x_ii, y_ii, head_prod);
 	}			/* prod = x[i]*y[i] */
 	{
-	  /* Compute double-double = double-double + double-double. */
+	  /* Compute double-double = double-double + double-double,
+	     renormalizing once. */
 	  double	  bv;
-	  double	  s1    , s2, t1, t2;
+	  double	  s1    , s2;
 
 	  /* Add two hi words. */
 	  s1 = head_sum + head_prod;
 	  bv = s1 - head_sum;
 	  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-	  /* Add two lo words. */
-	  t1 = tail_sum + tail_prod;
-	  bv = t1 - tail_sum;
-	  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-	  s2 += t1;
-
-	  /* Renormalize (s1, s2)  to  (t1, s2) */
-	  t1 = s1 + s2;
-	  s2 = s2 - (t1 - s1);
-
-	  t2 += s2;
+	  /* Add the lo words to the error. */
+	  s2 += tail_sum + tail_prod;
 
-	  /* Renormalize (t1, t2)  */
-	  head_sum = t1 + t2;
-	  tail_sum = t2 - (head_sum - t1);
+	  /* Renormalize (s1, s2)  */
+	  head_sum = s1 + s2;
+	  tail_sum = s2 - (head_sum - s1);
 	}			/* sum = sum+prod */
 	ix += incx;
 	iy += incy;
@@ -221,19 +202,10 @@ void		BLAS_zdot_d_d_x(enum blas_conj_type conj, int n, const void *alpha,
 	double		head_t , tail_t;
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum * split;
-	  a11 = con - head_sum;
-	  a11 = con - a11;
-	  a21 = head_sum - a11;
-	  con = alpha_i[0] * split;
-	  b1 = con - alpha_i[0];
-	  b1 = con - b1;
-	  b2 = alpha_i[0] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum * alpha_i[0];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i[0], c11);
 
 	  c2 = tail_sum * alpha_i[0];
 	  t1 = c11 + c2;
@@ -246,19 +218,10 @@ void		BLAS_zdot_d_d_x(enum blas_conj_type conj, int n, const void *alpha,
 	tail_tmp1[0] = tail_t;
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum * split;
-	  a11 = con - head_sum;
-	  a11 = con - a11;
-	  a21 = head_sum - a11;
-	  con = alpha_i[1] * split;
-	  b1 = con - alpha_i[1];
-	  b1 = con - b1;
-	  b2 = alpha_i[1] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum * alpha_i[1];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i[1], c11);
 
 	  c2 = tail_sum * alpha_i[1];
 	  t1 = c11 + c2;
@@ -277,35 +240,13 @@ void		BLAS_zdot_d_d_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* Real part */
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[0] * split;
-	  a1 = con - r_v[0];
-	  a1 = con - a1;
-	  a2 = r_v[0] - a1;
-	  con = beta_i[0] * split;
-	  b1 = con - beta_i[0];
-	  b1 = con - b1;
-	  b2 = beta_i[0] - b1;
-
 	  head_t1 = r_v[0] * beta_i[0];
-	  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t1 = BLAS_TWO_PROD_ERR(r_v[0], beta_i[0], head_t1);
 	}
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[1] * split;
-	  a1 = con - r_v[1];
-	  a1 = con - a1;
-	  a2 = r_v[1] - a1;
-	  con = beta_i[1] * split;
-	  b1 = con - beta_i[1];
-	  b1 = con - b1;
-	  b2 = beta_i[1] - b1;
-
 	  head_t2 = r_v[1] * beta_i[1];
-	  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t2 = BLAS_TWO_PROD_ERR(r_v[1], beta_i[1], head_t2);
 	}
 	head_t2 = -head_t2;
 	tail_t2 = -tail_t2;
@@ -341,35 +282,13 @@ void		BLAS_zdot_d_d_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* Imaginary part */
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[1] * split;
-	  a1 = con - r_v[1];
-	  a1 = con - a1;
-	  a2 = r_v[1] - a1;
-	  con = beta_i[0] * split;
-	  b1 = con - beta_i[0];
-	  b1 = con - b1;
-	  b2 = beta_i[0] - b1;
-
 	  head_t1 = r_v[1] * beta_i[0];
-	  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t1 = BLAS_TWO_PROD_ERR(r_v[1], beta_i[0], head_t1);
 	}
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[0] * split;
-	  a1 = con - r_v[0];
-	  a1 = con - a1;
-	  a2 = r_v[0] - a1;
-	  con = beta_i[1] * split;
-	  b1 = con - beta_i[1];
-	  b1 = con - b1;
-	  b2 = beta_i[1] - b1;
-
 	  head_t2 = r_v[0] * beta_i[1];
-	  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t2 = BLAS_TWO_PROD_ERR(r_v[0], beta_i[1], head_t2);
 	}
 	{
 	  /* Compute double-double = double-double + double-double. */
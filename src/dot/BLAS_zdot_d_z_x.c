@@ -55,6 +55,7 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -179,37 +180,15 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	  double	  head_t, tail_t;
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = x_ii * split;
-	    a1 = con - x_ii;
-	    a1 = con - a1;
-	    a2 = x_ii - a1;
-	    con = y_ii[0] * split;
-	    b1 = con - y_ii[0];
-	    b1 = con - b1;
-	    b2 = y_ii[0] - b1;
-
 	    head_t = x_ii * y_ii[0];
-	    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t = BLAS_TWO_PROD_ERR(x_ii, y_ii[0], head_t);
 	  }
 	  head_prod[0] = head_t;
 	  tail_prod[0] = tail_t;
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = x_ii * split;
-	    a1 = con - x_ii;
-	    a1 = con - a1;
-	    a2 = x_ii - a1;
-	    con = y_ii[1] * split;
-	    b1 = con - y_ii[1];
-	    b1 = con - b1;
-	    b2 = y_ii[1] - b1;
-
 	    head_t = x_ii * y_ii[1];
-	    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t = BLAS_TWO_PROD_ERR(x_ii, y_ii[1], head_t);
 	  }
 	  head_prod[1] = head_t;
 	  tail_prod[1] = tail_t;
@@ -224,31 +203,22 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	  head_b = head_prod[0];
 	  tail_b = tail_prod[0];
 	  {
-	    /* Compute double-double = double-double + double-double. */
+	    /* Compute double-double = double-double + double-double,
+	       renormalizing once. */
 	    double	    bv;
-	    double	    s1  , s2, t1, t2;
+	    double	    s1  , s2;
 
 	    /* Add two hi words. */
 	    s1 = head_a + head_b;
 	    bv = s1 - head_a;
 	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
+	    /* Add the lo words to the error. */
+	    s2 += tail_a + tail_b;
 
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
+	    /* Renormalize (s1, s2)  */
+	    head_t = s1 + s2;
+	    tail_t = s2 - (head_t - s1);
 	  }
 	  head_sum[0] = head_t;
 	  tail_sum[0] = tail_t;
@@ -258,31 +228,22 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	  head_b = head_prod[1];
 	  tail_b = tail_prod[1];
 	  {
-	    /* Compute double-double = double-double + double-double. */
+	    /* Compute double-double = double-double + double-double,
+	       renormalizing once. */
 	    double	    bv;
-	    double	    s1  , s2, t1, t2;
+	    double	    s1  , s2;
 
 	    /* Add two hi words. */
 	    s1 = head_a + head_b;
 	    bv = s1 - head_a;
 	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
+	    /* Add the lo words to the error. */
+	    s2 += tail_a + tail_b;
 
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
+	    /* Renormalize (s1, s2)  */
+	    head_t = s1 + s2;
+	    tail_t = s2 - (head_t - s1);
 	  }
 	  head_sum[1] = head_t;
 	  tail_sum[1] = tail_t;
@@ -305,19 +266,10 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* real part */
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a0 * split;
-	  a11 = con - head_a0;
-	  a11 = con - a11;
-	  a21 = head_a0 - a11;
-	  con = alpha_i[0] * split;
-	  b1 = con - alpha_i[0];
-	  b1 = con - b1;
-	  b2 = alpha_i[0] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a0 * alpha_i[0];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 	  c2 = tail_a0 * alpha_i[0];
 	  t1 = c11 + c2;
@@ -328,19 +280,10 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	}
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a1 * split;
-	  a11 = con - head_a1;
-	  a11 = con - a11;
-	  a21 = head_a1 - a11;
-	  con = alpha_i[1] * split;
-	  b1 = con - alpha_i[1];
-	  b1 = con - b1;
-	  b2 = alpha_i[1] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a1 * alpha_i[1];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 	  c2 = tail_a1 * alpha_i[1];
 	  t1 = c11 + c2;
@@ -383,19 +326,10 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* imaginary part */
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a1 * split;
-	  a11 = con - head_a1;
-	  a11 = con - a11;
-	  a21 = head_a1 - a11;
-	  con = alpha_i[0] * split;
-	  b1 = con - alpha_i[0];
-	  b1 = con - b1;
-	  b2 = alpha_i[0] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a1 * alpha_i[0];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 	  c2 = tail_a1 * alpha_i[0];
 	  t1 = c11 + c2;
@@ -406,19 +340,10 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	}
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a0 * split;
-	  a11 = con - head_a0;
-	  a11 = con - a11;
-	  a21 = head_a0 - a11;
-	  con = alpha_i[1] * split;
-	  b1 = con - alpha_i[1];
-	  b1 = con - b1;
-	  b2 = alpha_i[1] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a0 * alpha_i[1];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 	  c2 = tail_a0 * alpha_i[1];
 	  t1 = c11 + c2;
@@ -465,35 +390,13 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* Real part */
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[0] * split;
-	  a1 = con - r_v[0];
-	  a1 = con - a1;
-	  a2 = r_v[0] - a1;
-	  con = beta_i[0] * split;
-	  b1 = con - beta_i[0];
-	  b1 = con - b1;
-	  b2 = beta_i[0] - b1;
-
 	  head_t1 = r_v[0] * beta_i[0];
-	  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t1 = BLAS_TWO_PROD_ERR(r_v[0], beta_i[0], head_t1);
 	}
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[1] * split;
-	  a1 = con - r_v[1];
-	  a1 = con - a1;
-	  a2 = r_v[1] - a1;
-	  con = beta_i[1] * split;
-	  b1 = con - beta_i[1];
-	  b1 = con - b1;
-	  b2 = beta_i[1] - b1;
-
 	  head_t2 = r_v[1] * beta_i[1];
-	  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t2 = BLAS_TWO_PROD_ERR(r_v[1], beta_i[1], head_t2);
 	}
 	head_t2 = -head_t2;
 	tail_t2 = -tail_t2;
@@ -529,35 +432,13 @@ void		BLAS_zdot_d_z_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* Imaginary part */
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[1] * split;
-	  a1 = con - r_v[1];
-	  a1 = con - a1;
-	  a2 = r_v[1] - a1;
-	  con = beta_i[0] * split;
-	  b1 = con - beta_i[0];
-	  b1 = con - b1;
-	  b2 = beta_i[0] - b1;
-
 	  head_t1 = r_v[1] * beta_i[0];
-	  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t1 = BLAS_TWO_PROD_ERR(r_v[1], beta_i[0], head_t1);
 	}
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[0] * split;
-	  a1 = con - r_v[0];
-	  a1 = con - a1;
-	  a2 = r_v[0] - a1;
-	  con = beta_i[1] * split;
-	  b1 = con - beta_i[1];
-	  b1 = con - b1;
-	  b2 = beta_i[1] - b1;
-
 	  head_t2 = r_v[0] * beta_i[1];
-	  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t2 = BLAS_TWO_PROD_ERR(r_v[0], beta_i[1], head_t2);
 	}
 	{
 	  /* Compute double-double = double-double + double-double. */
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	 		const		void  *x, int incx, const void *beta,
 		  		const		void  *y, int incy,
@@ -55,6 +56,7 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      i    , ix = 0, iy = 0;
@@ -189,7 +191,10 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
       if (incy < 0)
 	iy = (-n + 1) * incy;
 
-      if (conj == blas_conj) {
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 2 && incy == 2 && blas_dd_vec_enabled())
+	blas_dot_x_kernel(n, x_i, 0, y_i, 0, 1, conj, head_sum, tail_sum);
+      else if (conj == blas_conj) {
 	for (i = 0; i < n; ++i) {
 	  x_ii[0] = x_i[ix];
 	  x_ii[1] = x_i[ix + 1];
@@ -203,126 +208,64 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[0] * split;
-	      a1 = con - x_ii[0];
-	      a1 = con - a1;
-	      a2 = x_ii[0] - a1;
-	      con = y_ii[0] * split;
-	      b1 = con - y_ii[0];
-	      b1 = con - b1;
-	      b2 = y_ii[0] - b1;
-
 	      head_t1 = x_ii[0] * y_ii[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(x_ii[0], y_ii[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[1] * split;
-	      a1 = con - x_ii[1];
-	      a1 = con - a1;
-	      a2 = x_ii[1] - a1;
-	      con = y_ii[1] * split;
-	      b1 = con - y_ii[1];
-	      b1 = con - b1;
-	      b2 = y_ii[1] - b1;
-
 	      head_t2 = x_ii[1] * y_ii[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(x_ii[1], y_ii[1], head_t2);
 	    }
 	    head_t2 = -head_t2;
 	    tail_t2 = -tail_t2;
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_t1 + head_t2;
 	      bv = s1 - head_t1;
 	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      /* Add the lo words to the error. */
+	      s2 += tail_t1 + tail_t2;
 
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t1 = s1 + s2;
+	      tail_t1 = s2 - (head_t1 - s1);
 	    }
 	    head_prod[0] = head_t1;
 	    tail_prod[0] = tail_t1;
 	    /* Imaginary part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[1] * split;
-	      a1 = con - x_ii[1];
-	      a1 = con - a1;
-	      a2 = x_ii[1] - a1;
-	      con = y_ii[0] * split;
-	      b1 = con - y_ii[0];
-	      b1 = con - b1;
-	      b2 = y_ii[0] - b1;
-
 	      head_t1 = x_ii[1] * y_ii[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(x_ii[1], y_ii[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[0] * split;
-	      a1 = con - x_ii[0];
-	      a1 = con - a1;
-	      a2 = x_ii[0] - a1;
-	      con = y_ii[1] * split;
-	      b1 = con - y_ii[1];
-	      b1 = con - b1;
-	      b2 = y_ii[1] - b1;
-
 	      head_t2 = x_ii[0] * y_ii[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(x_ii[0], y_ii[1], head_t2);
 	    }
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_t1 + head_t2;
 	      bv = s1 - head_t1;
 	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      /* Add the lo words to the error. */
+	      s2 += tail_t1 + tail_t2;
 
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t1 = s1 + s2;
+	      tail_t1 = s2 - (head_t1 - s1);
 	    }
 	    head_prod[1] = head_t1;
 	    tail_prod[1] = tail_t1;
@@ -337,31 +280,22 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	    head_b = head_prod[0];
 	    tail_b = tail_prod[0];
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_a + head_b;
 	      bv = s1 - head_a;
 	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
+	      /* Add the lo words to the error. */
+	      s2 += tail_a + tail_b;
 
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t = s1 + s2;
+	      tail_t = s2 - (head_t - s1);
 	    }
 	    head_sum[0] = head_t;
 	    tail_sum[0] = tail_t;
@@ -371,31 +305,22 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	    head_b = head_prod[1];
 	    tail_b = tail_prod[1];
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_a + head_b;
 	      bv = s1 - head_a;
 	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
+	      /* Add the lo words to the error. */
+	      s2 += tail_a + tail_b;
 
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t = s1 + s2;
+	      tail_t = s2 - (head_t - s1);
 	    }
 	    head_sum[1] = head_t;
 	    tail_sum[1] = tail_t;
@@ -419,126 +344,64 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[0] * split;
-	      a1 = con - x_ii[0];
-	      a1 = con - a1;
-	      a2 = x_ii[0] - a1;
-	      con = y_ii[0] * split;
-	      b1 = con - y_ii[0];
-	      b1 = con - b1;
-	      b2 = y_ii[0] - b1;
-
 	      head_t1 = x_ii[0] * y_ii[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(x_ii[0], y_ii[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[1] * split;
-	      a1 = con - x_ii[1];
-	      a1 = con - a1;
-	      a2 = x_ii[1] - a1;
-	      con = y_ii[1] * split;
-	      b1 = con - y_ii[1];
-	      b1 = con - b1;
-	      b2 = y_ii[1] - b1;
-
 	      head_t2 = x_ii[1] * y_ii[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(x_ii[1], y_ii[1], head_t2);
 	    }
 	    head_t2 = -head_t2;
 	    tail_t2 = -tail_t2;
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_t1 + head_t2;
 	      bv = s1 - head_t1;
 	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      /* Add the lo words to the error. */
+	      s2 += tail_t1 + tail_t2;
 
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t1 = s1 + s2;
+	      tail_t1 = s2 - (head_t1 - s1);
 	    }
 	    head_prod[0] = head_t1;
 	    tail_prod[0] = tail_t1;
 	    /* Imaginary part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[1] * split;
-	      a1 = con - x_ii[1];
-	      a1 = con - a1;
-	      a2 = x_ii[1] - a1;
-	      con = y_ii[0] * split;
-	      b1 = con - y_ii[0];
-	      b1 = con - b1;
-	      b2 = y_ii[0] - b1;
-
 	      head_t1 = x_ii[1] * y_ii[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(x_ii[1], y_ii[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_ii[0] * split;
-	      a1 = con - x_ii[0];
-	      a1 = con - a1;
-	      a2 = x_ii[0] - a1;
-	      con = y_ii[1] * split;
-	      b1 = con - y_ii[1];
-	      b1 = con - b1;
-	      b2 = y_ii[1] - b1;
-
 	      head_t2 = x_ii[0] * y_ii[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(x_ii[0], y_ii[1], head_t2);
 	    }
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_t1 + head_t2;
 	      bv = s1 - head_t1;
 	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      /* Add the lo words to the error. */
+	      s2 += tail_t1 + tail_t2;
 
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t1 = s1 + s2;
+	      tail_t1 = s2 - (head_t1 - s1);
 	    }
 	    head_prod[1] = head_t1;
 	    tail_prod[1] = tail_t1;
@@ -553,31 +416,22 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	    head_b = head_prod[0];
 	    tail_b = tail_prod[0];
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_a + head_b;
 	      bv = s1 - head_a;
 	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      /* Add the lo words to the error. */
+	      s2 += tail_a + tail_b;
 
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t = s1 + s2;
+	      tail_t = s2 - (head_t - s1);
 	    }
 	    head_sum[0] = head_t;
 	    tail_sum[0] = tail_t;
@@ -587,31 +441,22 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	    head_b = head_prod[1];
 	    tail_b = tail_prod[1];
 	    {
-	      /* Compute double-double = double-double + double-double. */
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
 	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	      s1, s2;
 
 	      /* Add two hi words. */
 	      s1 = head_a + head_b;
 	      bv = s1 - head_a;
 	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      /* Add the lo words to the error. */
+	      s2 += tail_a + tail_b;
 
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      /* Renormalize (s1, s2)  */
+	      head_t = s1 + s2;
+	      tail_t = s2 - (head_t - s1);
 	    }
 	    head_sum[1] = head_t;
 	    tail_sum[1] = tail_t;
@@ -634,19 +479,10 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* real part */
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a0 * split;
-	  a11 = con - head_a0;
-	  a11 = con - a11;
-	  a21 = head_a0 - a11;
-	  con = alpha_i[0] * split;
-	  b1 = con - alpha_i[0];
-	  b1 = con - b1;
-	  b2 = alpha_i[0] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a0 * alpha_i[0];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 	  c2 = tail_a0 * alpha_i[0];
 	  t1 = c11 + c2;
@@ -657,19 +493,10 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	}
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a1 * split;
-	  a11 = con - head_a1;
-	  a11 = con - a11;
-	  a21 = head_a1 - a11;
-	  con = alpha_i[1] * split;
-	  b1 = con - alpha_i[1];
-	  b1 = con - b1;
-	  b2 = alpha_i[1] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a1 * alpha_i[1];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 	  c2 = tail_a1 * alpha_i[1];
 	  t1 = c11 + c2;
@@ -712,19 +539,10 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* imaginary part */
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a1 * split;
-	  a11 = con - head_a1;
-	  a11 = con - a11;
-	  a21 = head_a1 - a11;
-	  con = alpha_i[0] * split;
-	  b1 = con - alpha_i[0];
-	  b1 = con - b1;
-	  b2 = alpha_i[0] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a1 * alpha_i[0];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 	  c2 = tail_a1 * alpha_i[0];
 	  t1 = c11 + c2;
@@ -735,19 +553,10 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	}
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_a0 * split;
-	  a11 = con - head_a0;
-	  a11 = con - a11;
-	  a21 = head_a0 - a11;
-	  con = alpha_i[1] * split;
-	  b1 = con - alpha_i[1];
-	  b1 = con - b1;
-	  b2 = alpha_i[1] - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_a0 * alpha_i[1];
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 	  c2 = tail_a0 * alpha_i[1];
 	  t1 = c11 + c2;
@@ -794,35 +603,13 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* Real part */
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[0] * split;
-	  a1 = con - r_v[0];
-	  a1 = con - a1;
-	  a2 = r_v[0] - a1;
-	  con = beta_i[0] * split;
-	  b1 = con - beta_i[0];
-	  b1 = con - b1;
-	  b2 = beta_i[0] - b1;
-
 	  head_t1 = r_v[0] * beta_i[0];
-	  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t1 = BLAS_TWO_PROD_ERR(r_v[0], beta_i[0], head_t1);
 	}
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[1] * split;
-	  a1 = con - r_v[1];
-	  a1 = con - a1;
-	  a2 = r_v[1] - a1;
-	  con = beta_i[1] * split;
-	  b1 = con - beta_i[1];
-	  b1 = con - b1;
-	  b2 = beta_i[1] - b1;
-
 	  head_t2 = r_v[1] * beta_i[1];
-	  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t2 = BLAS_TWO_PROD_ERR(r_v[1], beta_i[1], head_t2);
 	}
 	head_t2 = -head_t2;
 	tail_t2 = -tail_t2;
@@ -858,35 +645,13 @@ void		BLAS_zdot_x(enum blas_conj_type conj, int n, const void *alpha,
 	/* Imaginary part */
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[1] * split;
-	  a1 = con - r_v[1];
-	  a1 = con - a1;
-	  a2 = r_v[1] - a1;
-	  con = beta_i[0] * split;
-	  b1 = con - beta_i[0];
-	  b1 = con - b1;
-	  b2 = beta_i[0] - b1;
-
 	  head_t1 = r_v[1] * beta_i[0];
-	  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t1 = BLAS_TWO_PROD_ERR(r_v[1], beta_i[0], head_t1);
 	}
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = r_v[0] * split;
-	  a1 = con - r_v[0];
-	  a1 = con - a1;
-	  a2 = r_v[0] - a1;
-	  con = beta_i[1] * split;
-	  b1 = con - beta_i[1];
-	  b1 = con - b1;
-	  b2 = beta_i[1] - b1;
-
 	  head_t2 = r_v[0] * beta_i[1];
-	  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_t2 = BLAS_TWO_PROD_ERR(r_v[0], beta_i[1], head_t2);
 	}
 	{
 	  /* Compute double-double = double-double + double-double. */
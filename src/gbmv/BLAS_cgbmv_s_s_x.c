@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		       		int		m       , int n, int kl, int ku, const void *alpha,
        		const		float *a, int lda, const float *x, int incx,
@@ -268,6 +269,7 @@ void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      ky   , iy, kx, jx, j, i, rbound, lbound, ra, la, lenx,
@@ -445,6 +447,7 @@ void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
       float	      a_elem;
       float	      x_elem;
       float	      y_elem[2];
+      double         *row_sum;
       FPU_FIX_DECL;
 
       if (order != blas_colmajor && order != blas_rowmajor)
@@ -538,48 +541,51 @@ void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
       ky *= 2;
 
 
+      /* The row sums of the band, by columns or rows. */
+      row_sum = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	row_sum = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				   blas_gemm_elt_s, lda, x_i + kx,
+				   blas_gemm_elt_s, incx);
+
       la = 0;
       ai = astart;
       iy = ky;
       for (i = 0; i < leny; i++) {
-	head_sum = tail_sum = 0.0;
-	aij = ai;
-	jx = kx;
-
-	for (j = ra - la; j >= 0; j--) {
-	  x_elem = x_i[jx];
-	  a_elem = a_i[aij];
-	  head_prod = (double)x_elem *a_elem;
-	  tail_prod = 0.0;
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum + head_prod;
-	    bv = s1 - head_sum;
-	    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum + tail_prod;
-	    bv = t1 - tail_sum;
-	    t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum = t1 + t2;
-	    tail_sum = t2 - (head_sum - t1);
+	if (row_sum != NULL) {
+	  head_sum = row_sum[2 * i];
+	  tail_sum = row_sum[2 * i + 1];
+	} else {
+	  head_sum = tail_sum = 0.0;
+	  aij = ai;
+	  jx = kx;
+
+	  for (j = ra - la; j >= 0; j--) {
+	    x_elem = x_i[jx];
+	    a_elem = a_i[aij];
+	    head_prod = (double)x_elem *a_elem;
+	    tail_prod = 0.0;
+	    {
+	      /* Compute double-double = double-double + double-double,
+		 renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum + head_prod;
+	      bv = s1 - head_sum;
+	      s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum + tail_prod;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum = s1 + s2;
+	      tail_sum = s2 - (head_sum - s1);
+	    }
+	    aij += incaij;
+	    jx += incx;
 	  }
-	  aij += incaij;
-	  jx += incx;
 	}
 
 
@@ -589,19 +595,10 @@ void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	  dt = (double)alpha_i[0];
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_sum * split;
-	    a11 = con - head_sum;
-	    a11 = con - a11;
-	    a21 = head_sum - a11;
-	    con = dt * split;
-	    b1 = con - dt;
-	    b1 = con - b1;
-	    b2 = dt - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_sum * dt;
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 	    c2 = tail_sum * dt;
 	    t1 = c11 + c2;
@@ -615,19 +612,10 @@ void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	  dt = (double)alpha_i[1];
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_sum * split;
-	    a11 = con - head_sum;
-	    a11 = con - a11;
-	    a21 = head_sum - a11;
-	    con = dt * split;
-	    b1 = con - dt;
-	    b1 = con - b1;
-	    b2 = dt - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_sum * dt;
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 	    c2 = tail_sum * dt;
 	    t1 = c11 + c2;
@@ -763,6 +751,7 @@ void		BLAS_cgbmv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(row_sum);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 					int		m       , int n, int kl, int ku, const void *alpha,
       		const		float *a, int lda, const void *head_x,
@@ -292,6 +293,7 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      iy0  , iy, ix0, jx, j, i, rbound, lbound, ra, la, lenx,
@@ -490,6 +492,8 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
       float	      a_elem;
       float	      x_elem[2];
       float	      y_elem[2];
+      double         *row_sum1;
+      double         *row_sum2;
       FPU_FIX_DECL;
 
       if (order != blas_colmajor && order != blas_rowmajor)
@@ -575,181 +579,167 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
       iy0 *= 2;
       ix0 *= 2;
 
+      /* The row sums of the band, by columns or rows. */
+      row_sum1 = row_sum2 = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	row_sum1 = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				    blas_gemm_elt_s, lda, head_x_i + ix0,
+				    blas_gemm_elt_c, incx / 2);
+	row_sum2 = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				    blas_gemm_elt_s, lda, tail_x_i + ix0,
+				    blas_gemm_elt_c, incx / 2);
+      }
+
       la = 0;
       ai = astart;
       iy = iy0;
       for (i = 0; i < leny; i++) {
-	head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
-	head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-	aij = ai;
-	jx = ix0;
-
-	for (j = ra - la; j >= 0; j--) {
-	  x_elem[0] = head_x_i[jx];
-	  x_elem[1] = head_x_i[jx + 1];
-	  a_elem = a_i[aij];
-	  {
-	    head_prod[0] = (double)x_elem[0] * a_elem;
-	    tail_prod[0] = 0.0;
-	    head_prod[1] = (double)x_elem[1] * a_elem;
-	    tail_prod[1] = 0.0;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum1[0];
-	    tail_a = tail_sum1[0];
-	    head_b = head_prod[0];
-	    tail_b = tail_prod[0];
+	if (row_sum1 != NULL && row_sum2 != NULL) {
+	  head_sum1[0] = row_sum1[4 * i];
+	  head_sum1[1] = row_sum1[4 * i + 1];
+	  tail_sum1[0] = row_sum1[4 * i + 2];
+	  tail_sum1[1] = row_sum1[4 * i + 3];
+	  head_sum2[0] = row_sum2[4 * i];
+	  head_sum2[1] = row_sum2[4 * i + 1];
+	  tail_sum2[0] = row_sum2[4 * i + 2];
+	  tail_sum2[1] = row_sum2[4 * i + 3];
+	} else {
+	  head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
+	  head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+	  aij = ai;
+	  jx = ix0;
+
+	  for (j = ra - la; j >= 0; j--) {
+	    x_elem[0] = head_x_i[jx];
+	    x_elem[1] = head_x_i[jx + 1];
+	    a_elem = a_i[aij];
 	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      head_prod[0] = (double)x_elem[0] * a_elem;
+	      tail_prod[0] = 0.0;
+	      head_prod[1] = (double)x_elem[1] * a_elem;
+	      tail_prod[1] = 0.0;
 	    }
-	    head_sum1[0] = head_t;
-	    tail_sum1[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum1[1];
-	    tail_a = tail_sum1[1];
-	    head_b = head_prod[1];
-	    tail_b = tail_prod[1];
 	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
+	      /* Real part */
+	      head_a = head_sum1[0];
+	      tail_a = tail_sum1[0];
+	      head_b = head_prod[0];
+	      tail_b = tail_prod[0];
+	      {
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
+		double	      bv;
+		double	      s1, s2;
+
+		/* Add two hi words. */
+		s1 = head_a + head_b;
+		bv = s1 - head_a;
+		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		/* Add the lo words to the error. */
+		s2 += tail_a + tail_b;
+
+		/* Renormalize (s1, s2)  */
+		head_t = s1 + s2;
+		tail_t = s2 - (head_t - s1);
+	      }
+	      head_sum1[0] = head_t;
+	      tail_sum1[0] = tail_t;
+	      /* Imaginary part */
+	      head_a = head_sum1[1];
+	      tail_a = tail_sum1[1];
+	      head_b = head_prod[1];
+	      tail_b = tail_prod[1];
+	      {
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
+		double	      bv;
+		double	      s1, s2;
+
+		/* Add two hi words. */
+		s1 = head_a + head_b;
+		bv = s1 - head_a;
+		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		/* Add the lo words to the error. */
+		s2 += tail_a + tail_b;
+
+		/* Renormalize (s1, s2)  */
+		head_t = s1 + s2;
+		tail_t = s2 - (head_t - s1);
+	      }
+	      head_sum1[1] = head_t;
+	      tail_sum1[1] = tail_t;
 	    }
-	    head_sum1[1] = head_t;
-	    tail_sum1[1] = tail_t;
-	  }
-	  x_elem[0] = tail_x_i[jx];
-	  x_elem[1] = tail_x_i[jx + 1];
-	  {
-	    head_prod[0] = (double)x_elem[0] * a_elem;
-	    tail_prod[0] = 0.0;
-	    head_prod[1] = (double)x_elem[1] * a_elem;
-	    tail_prod[1] = 0.0;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum2[0];
-	    tail_a = tail_sum2[0];
-	    head_b = head_prod[0];
-	    tail_b = tail_prod[0];
+	    x_elem[0] = tail_x_i[jx];
+	    x_elem[1] = tail_x_i[jx + 1];
 	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      head_prod[0] = (double)x_elem[0] * a_elem;
+	      tail_prod[0] = 0.0;
+	      head_prod[1] = (double)x_elem[1] * a_elem;
+	      tail_prod[1] = 0.0;
 	    }
-	    head_sum2[0] = head_t;
-	    tail_sum2[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum2[1];
-	    tail_a = tail_sum2[1];
-	    head_b = head_prod[1];
-	    tail_b = tail_prod[1];
 	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
+	      /* Real part */
+	      head_a = head_sum2[0];
+	      tail_a = tail_sum2[0];
+	      head_b = head_prod[0];
+	      tail_b = tail_prod[0];
+	      {
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
+		double	      bv;
+		double	      s1, s2;
+
+		/* Add two hi words. */
+		s1 = head_a + head_b;
+		bv = s1 - head_a;
+		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		/* Add the lo words to the error. */
+		s2 += tail_a + tail_b;
+
+		/* Renormalize (s1, s2)  */
+		head_t = s1 + s2;
+		tail_t = s2 - (head_t - s1);
+	      }
+	      head_sum2[0] = head_t;
+	      tail_sum2[0] = tail_t;
+	      /* Imaginary part */
+	      head_a = head_sum2[1];
+	      tail_a = tail_sum2[1];
+	      head_b = head_prod[1];
+	      tail_b = tail_prod[1];
+	      {
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
+		double	      bv;
+		double	      s1, s2;
+
+		/* Add two hi words. */
+		s1 = head_a + head_b;
+		bv = s1 - head_a;
+		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		/* Add the lo words to the error. */
+		s2 += tail_a + tail_b;
+
+		/* Renormalize (s1, s2)  */
+		head_t = s1 + s2;
+		tail_t = s2 - (head_t - s1);
+	      }
+	      head_sum2[1] = head_t;
+	      tail_sum2[1] = tail_t;
 	    }
-	    head_sum2[1] = head_t;
-	    tail_sum2[1] = tail_t;
+	    aij += incaij;
+	    jx += incx;
 	  }
-	  aij += incaij;
-	  jx += incx;
 	}
 
 
@@ -770,19 +760,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    /* real part */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = cd[0] * split;
-	      b1 = con - cd[0];
-	      b1 = con - b1;
-	      b2 = cd[0] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a0 * cd[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 	      c2 = tail_a0 * cd[0];
 	      t1 = c11 + c2;
@@ -793,19 +774,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = cd[1] * split;
-	      b1 = con - cd[1];
-	      b1 = con - b1;
-	      b2 = cd[1] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a1 * cd[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 	      c2 = tail_a1 * cd[1];
 	      t1 = c11 + c2;
@@ -848,19 +820,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    /* imaginary part */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = cd[0] * split;
-	      b1 = con - cd[0];
-	      b1 = con - b1;
-	      b2 = cd[0] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a1 * cd[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 	      c2 = tail_a1 * cd[0];
 	      t1 = c11 + c2;
@@ -871,19 +834,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = cd[1] * split;
-	      b1 = con - cd[1];
-	      b1 = con - b1;
-	      b2 = cd[1] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a0 * cd[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 	      c2 = tail_a0 * cd[1];
 	      t1 = c11 + c2;
@@ -941,19 +895,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    /* real part */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = cd[0] * split;
-	      b1 = con - cd[0];
-	      b1 = con - b1;
-	      b2 = cd[0] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a0 * cd[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 	      c2 = tail_a0 * cd[0];
 	      t1 = c11 + c2;
@@ -964,19 +909,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = cd[1] * split;
-	      b1 = con - cd[1];
-	      b1 = con - b1;
-	      b2 = cd[1] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a1 * cd[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 	      c2 = tail_a1 * cd[1];
 	      t1 = c11 + c2;
@@ -1019,19 +955,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    /* imaginary part */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = cd[0] * split;
-	      b1 = con - cd[0];
-	      b1 = con - b1;
-	      b2 = cd[0] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a1 * cd[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 	      c2 = tail_a1 * cd[0];
 	      t1 = c11 + c2;
@@ -1042,19 +969,10 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = cd[1] * split;
-	      b1 = con - cd[1];
-	      b1 = con - b1;
-	      b2 = cd[1] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a0 * cd[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 	      c2 = tail_a0 * cd[1];
 	      t1 = c11 + c2;
@@ -1293,6 +1211,8 @@ void		BLAS_cgbmv2_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(row_sum1);
+      blas_free(row_sum2);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 					int		m       , int n, int kl, int ku, double alpha,
     		const		float *a, int lda, const double *head_x,
@@ -113,6 +114,7 @@ void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      iy0  , iy, ix0, jx, j, i, rbound, lbound, ra, la, lenx,
@@ -288,6 +290,8 @@ void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
       float	      a_elem;
       double	      x_elem;
       double	      y_elem;
+      double         *row_sum1;
+      double         *row_sum2;
       FPU_FIX_DECL;
 
       if (order != blas_colmajor && order != blas_rowmajor)
@@ -373,131 +377,100 @@ void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 
 
 
+      /* The row sums of the band, by columns or rows. */
+      row_sum1 = row_sum2 = NULL;
+      if (alpha_i != 0.0) {
+	row_sum1 = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				    blas_gemm_elt_s, lda, head_x_i + ix0,
+				    blas_gemm_elt_d, incx);
+	row_sum2 = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				    blas_gemm_elt_s, lda, tail_x_i + ix0,
+				    blas_gemm_elt_d, incx);
+      }
+
       la = 0;
       ai = astart;
       iy = iy0;
       for (i = 0; i < leny; i++) {
-	head_sum1 = tail_sum1 = 0.0;
-	head_sum2 = tail_sum2 = 0.0;
-	aij = ai;
-	jx = ix0;
-
-	for (j = ra - la; j >= 0; j--) {
-	  x_elem = head_x_i[jx];
-	  a_elem = a_i[aij];
-	  {
-	    double	    dt = (double)a_elem;
+	if (row_sum1 != NULL && row_sum2 != NULL) {
+	  head_sum1 = row_sum1[2 * i];
+	  tail_sum1 = row_sum1[2 * i + 1];
+	  head_sum2 = row_sum2[2 * i];
+	  tail_sum2 = row_sum2[2 * i + 1];
+	} else {
+	  head_sum1 = tail_sum1 = 0.0;
+	  head_sum2 = tail_sum2 = 0.0;
+	  aij = ai;
+	  jx = ix0;
+
+	  for (j = ra - la; j >= 0; j--) {
+	    x_elem = head_x_i[jx];
+	    a_elem = a_i[aij];
 	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_elem * split;
-	      a1 = con - x_elem;
-	      a1 = con - a1;
-	      a2 = x_elem - a1;
-	      con = dt * split;
-	      b1 = con - dt;
-	      b1 = con - b1;
-	      b2 = dt - b1;
-
-	      head_prod = x_elem * dt;
-	      tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+	      double	    dt = (double)a_elem;
+	      {
+		/* Compute double_double = double * double. */
+		head_prod = x_elem * dt;
+		tail_prod = BLAS_TWO_PROD_ERR(x_elem, dt, head_prod);
+	      }
 	    }
-	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum1 + head_prod;
-	    bv = s1 - head_sum1;
-	    s2 = ((head_prod - bv) + (head_sum1 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum1 + tail_prod;
-	    bv = t1 - tail_sum1;
-	    t2 = ((tail_prod - bv) + (tail_sum1 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum1 = t1 + t2;
-	    tail_sum1 = t2 - (head_sum1 - t1);
-	  }
-	  x_elem = tail_x_i[jx];
-	  {
-	    double	    dt = (double)a_elem;
 	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_elem * split;
-	      a1 = con - x_elem;
-	      a1 = con - a1;
-	      a2 = x_elem - a1;
-	      con = dt * split;
-	      b1 = con - dt;
-	      b1 = con - b1;
-	      b2 = dt - b1;
-
-	      head_prod = x_elem * dt;
-	      tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+	      /* Compute double-double = double-double + double-double,
+		 renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum1 + head_prod;
+	      bv = s1 - head_sum1;
+	      s2 = ((head_prod - bv) + (head_sum1 - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum1 + tail_prod;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum1 = s1 + s2;
+	      tail_sum1 = s2 - (head_sum1 - s1);
 	    }
+	    x_elem = tail_x_i[jx];
+	    {
+	      double	    dt = (double)a_elem;
+	      {
+		/* Compute double_double = double * double. */
+		head_prod = x_elem * dt;
+		tail_prod = BLAS_TWO_PROD_ERR(x_elem, dt, head_prod);
+	      }
+	    }
+	    {
+	      /* Compute double-double = double-double + double-double,
+		 renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum2 + head_prod;
+	      bv = s1 - head_sum2;
+	      s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum2 + tail_prod;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum2 = s1 + s2;
+	      tail_sum2 = s2 - (head_sum2 - s1);
+	    }
+	    aij += incaij;
+	    jx += incx;
 	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum2 + head_prod;
-	    bv = s1 - head_sum2;
-	    s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum2 + tail_prod;
-	    bv = t1 - tail_sum2;
-	    t2 = ((tail_prod - bv) + (tail_sum2 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum2 = t1 + t2;
-	    tail_sum2 = t2 - (head_sum2 - t1);
-	  }
-	  aij += incaij;
-	  jx += incx;
 	}
 
 
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum1 * split;
-	  a11 = con - head_sum1;
-	  a11 = con - a11;
-	  a21 = head_sum1 - a11;
-	  con = alpha_i * split;
-	  b1 = con - alpha_i;
-	  b1 = con - b1;
-	  b2 = alpha_i - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum1 * alpha_i;
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum1, alpha_i, c11);
 
 	  c2 = tail_sum1 * alpha_i;
 	  t1 = c11 + c2;
@@ -508,19 +481,10 @@ void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum2 * split;
-	  a11 = con - head_sum2;
-	  a11 = con - a11;
-	  a21 = head_sum2 - a11;
-	  con = alpha_i * split;
-	  b1 = con - alpha_i;
-	  b1 = con - b1;
-	  b2 = alpha_i - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum2 * alpha_i;
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum2, alpha_i, c11);
 
 	  c2 = tail_sum2 * alpha_i;
 	  t1 = c11 + c2;
@@ -559,19 +523,8 @@ void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	y_elem = y_i[iy];
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = beta_i * split;
-	  a1 = con - beta_i;
-	  a1 = con - a1;
-	  a2 = beta_i - a1;
-	  con = y_elem * split;
-	  b1 = con - y_elem;
-	  b1 = con - b1;
-	  b2 = y_elem - b1;
-
 	  head_tmp4 = beta_i * y_elem;
-	  tail_tmp4 = (((a1 * b1 - head_tmp4) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_tmp4 = BLAS_TWO_PROD_ERR(beta_i, y_elem, head_tmp4);
 	}
 	{
 	  /* Compute double-double = double-double + double-double. */
@@ -614,6 +567,8 @@ void		BLAS_dgbmv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(row_sum1);
+      blas_free(row_sum2);
       FPU_FIX_STOP;
     }
     break;
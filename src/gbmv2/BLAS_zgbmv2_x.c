@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    		int		m       , int n, int kl, int ku, const void *alpha,
 	  		const		void  *a, int lda, const void *head_x,
@@ -113,6 +114,7 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
     {
       int	      iy0  , iy, ix0, jx, j, i, rbound, lbound, ra, la, lenx,
@@ -337,6 +339,8 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      a_elem[2];
       double	      x_elem[2];
       double	      y_elem[2];
+      double         *row_sum1;
+      double         *row_sum2;
       FPU_FIX_DECL;
 
       if (order != blas_colmajor && order != blas_rowmajor)
@@ -422,853 +426,555 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
       iy0 *= 2;
       ix0 *= 2;
 
+      /* The row sums of the band, by columns or rows. */
+      row_sum1 = row_sum2 = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	row_sum1 = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				    blas_gemm_elt_z, lda, head_x_i + ix0,
+				    blas_gemm_elt_z, incx / 2);
+	row_sum2 = blas_gbmv_band_x(order, trans, m, n, kl, ku, a_i,
+				    blas_gemm_elt_z, lda, tail_x_i + ix0,
+				    blas_gemm_elt_z, incx / 2);
+      }
+
       la = 0;
       ai = astart;
       iy = iy0;
       for (i = 0; i < leny; i++) {
-	head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
-	head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-	aij = ai;
-	jx = ix0;
-	if (trans != blas_conj_trans) {
-	  for (j = ra - la; j >= 0; j--) {
-	    x_elem[0] = head_x_i[jx];
-	    x_elem[1] = head_x_i[jx + 1];
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[0] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[1] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod[0] = head_t1;
-	      tail_prod[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[1] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[0] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod[1] = head_t1;
-	      tail_prod[1] = tail_t1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum1[0];
-	      tail_a = tail_sum1[0];
-	      head_b = head_prod[0];
-	      tail_b = tail_prod[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[0] = head_t;
-	      tail_sum1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum1[1];
-	      tail_a = tail_sum1[1];
-	      head_b = head_prod[1];
-	      tail_b = tail_prod[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[1] = head_t;
-	      tail_sum1[1] = tail_t;
-	    }
-	    x_elem[0] = tail_x_i[jx];
-	    x_elem[1] = tail_x_i[jx + 1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[0] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[1] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod[0] = head_t1;
-	      tail_prod[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[1] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[0] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod[1] = head_t1;
-	      tail_prod[1] = tail_t1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum2[0];
-	      tail_a = tail_sum2[0];
-	      head_b = head_prod[0];
-	      tail_b = tail_prod[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[0] = head_t;
-	      tail_sum2[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum2[1];
-	      tail_a = tail_sum2[1];
-	      head_b = head_prod[1];
-	      tail_b = tail_prod[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[1] = head_t;
-	      tail_sum2[1] = tail_t;
-	    }
-	    aij += incaij;
-	    jx += incx;
-	  }
-
+	if (row_sum1 != NULL && row_sum2 != NULL) {
+	  head_sum1[0] = row_sum1[4 * i];
+	  head_sum1[1] = row_sum1[4 * i + 1];
+	  tail_sum1[0] = row_sum1[4 * i + 2];
+	  tail_sum1[1] = row_sum1[4 * i + 3];
+	  head_sum2[0] = row_sum2[4 * i];
+	  head_sum2[1] = row_sum2[4 * i + 1];
+	  tail_sum2[0] = row_sum2[4 * i + 2];
+	  tail_sum2[1] = row_sum2[4 * i + 3];
 	} else {
-	  for (j = ra - la; j >= 0; j--) {
-	    x_elem[0] = head_x_i[jx];
-	    x_elem[1] = head_x_i[jx + 1];
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    a_elem[1] = -a_elem[1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
+	  head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
+	  head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+	  aij = ai;
+	  jx = ix0;
+	  if (trans != blas_conj_trans) {
+	    for (j = ra - la; j >= 0; j--) {
+	      x_elem[0] = head_x_i[jx];
+	      x_elem[1] = head_x_i[jx + 1];
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
 	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[0] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[0] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[1] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[0] = head_t1;
+		tail_prod[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[1] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[0] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[1] = head_t1;
+		tail_prod[1] = tail_t1;
 	      }
 	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[1] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod[0];
+		tail_b = tail_prod[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod[1];
+		tail_b = tail_prod[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
 	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
+	      x_elem[0] = tail_x_i[jx];
+	      x_elem[1] = tail_x_i[jx + 1];
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod[0] = head_t1;
-	      tail_prod[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[1] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[0] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[1] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[0] = head_t1;
+		tail_prod[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[1] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[0] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[1] = head_t1;
+		tail_prod[1] = tail_t1;
 	      }
 	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[0] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod[0];
+		tail_b = tail_prod[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod[1];
+		tail_b = tail_prod[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
 	      }
-	      head_prod[1] = head_t1;
-	      tail_prod[1] = tail_t1;
+	      aij += incaij;
+	      jx += incx;
 	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum1[0];
-	      tail_a = tail_sum1[0];
-	      head_b = head_prod[0];
-	      tail_b = tail_prod[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[0] = head_t;
-	      tail_sum1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum1[1];
-	      tail_a = tail_sum1[1];
-	      head_b = head_prod[1];
-	      tail_b = tail_prod[1];
+	  } else {
+	    for (j = ra - la; j >= 0; j--) {
+	      x_elem[0] = head_x_i[jx];
+	      x_elem[1] = head_x_i[jx + 1];
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      a_elem[1] = -a_elem[1];
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[0] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[1] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[0] = head_t1;
+		tail_prod[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[1] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[0] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[1] = head_t1;
+		tail_prod[1] = tail_t1;
 	      }
-	      head_sum1[1] = head_t;
-	      tail_sum1[1] = tail_t;
-	    }
-	    x_elem[0] = tail_x_i[jx];
-	    x_elem[1] = tail_x_i[jx + 1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
 	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[0] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod[0];
+		tail_b = tail_prod[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod[1];
+		tail_b = tail_prod[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
 	      }
+	      x_elem[0] = tail_x_i[jx];
+	      x_elem[1] = tail_x_i[jx + 1];
 	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[1] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[0] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[1] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[0] = head_t1;
+		tail_prod[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = x_elem[1] * a_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], a_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = x_elem[0] * a_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], a_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod[1] = head_t1;
+		tail_prod[1] = tail_t1;
 	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod[0] = head_t1;
-	      tail_prod[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[1] * split;
-		a1 = con - x_elem[1];
-		a1 = con - a1;
-		a2 = x_elem[1] - a1;
-		con = a_elem[0] * split;
-		b1 = con - a_elem[0];
-		b1 = con - b1;
-		b2 = a_elem[0] - b1;
-
-		head_t1 = x_elem[1] * a_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = x_elem[0] * split;
-		a1 = con - x_elem[0];
-		a1 = con - a1;
-		a2 = x_elem[0] - a1;
-		con = a_elem[1] * split;
-		b1 = con - a_elem[1];
-		b1 = con - b1;
-		b2 = a_elem[1] - b1;
-
-		head_t2 = x_elem[0] * a_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod[0];
+		tail_b = tail_prod[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod[1];
+		tail_b = tail_prod[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
 	      }
-	      head_prod[1] = head_t1;
-	      tail_prod[1] = tail_t1;
+	      aij += incaij;
+	      jx += incx;
 	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum2[0];
-	      tail_a = tail_sum2[0];
-	      head_b = head_prod[0];
-	      tail_b = tail_prod[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[0] = head_t;
-	      tail_sum2[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum2[1];
-	      tail_a = tail_sum2[1];
-	      head_b = head_prod[1];
-	      tail_b = tail_prod[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[1] = head_t;
-	      tail_sum2[1] = tail_t;
-	    }
-	    aij += incaij;
-	    jx += incx;
 	  }
 	}
 
@@ -1285,19 +991,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  /* real part */
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a0 * split;
-	    a11 = con - head_a0;
-	    a11 = con - a11;
-	    a21 = head_a0 - a11;
-	    con = alpha_i[0] * split;
-	    b1 = con - alpha_i[0];
-	    b1 = con - b1;
-	    b2 = alpha_i[0] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a0 * alpha_i[0];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 	    c2 = tail_a0 * alpha_i[0];
 	    t1 = c11 + c2;
@@ -1308,19 +1005,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a1 * split;
-	    a11 = con - head_a1;
-	    a11 = con - a11;
-	    a21 = head_a1 - a11;
-	    con = alpha_i[1] * split;
-	    b1 = con - alpha_i[1];
-	    b1 = con - b1;
-	    b2 = alpha_i[1] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a1 * alpha_i[1];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 	    c2 = tail_a1 * alpha_i[1];
 	    t1 = c11 + c2;
@@ -1363,19 +1051,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  /* imaginary part */
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a1 * split;
-	    a11 = con - head_a1;
-	    a11 = con - a11;
-	    a21 = head_a1 - a11;
-	    con = alpha_i[0] * split;
-	    b1 = con - alpha_i[0];
-	    b1 = con - b1;
-	    b2 = alpha_i[0] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a1 * alpha_i[0];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 	    c2 = tail_a1 * alpha_i[0];
 	    t1 = c11 + c2;
@@ -1386,19 +1065,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a0 * split;
-	    a11 = con - head_a0;
-	    a11 = con - a11;
-	    a21 = head_a0 - a11;
-	    con = alpha_i[1] * split;
-	    b1 = con - alpha_i[1];
-	    b1 = con - b1;
-	    b2 = alpha_i[1] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a0 * alpha_i[1];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 	    c2 = tail_a0 * alpha_i[1];
 	    t1 = c11 + c2;
@@ -1451,19 +1121,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  /* real part */
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a0 * split;
-	    a11 = con - head_a0;
-	    a11 = con - a11;
-	    a21 = head_a0 - a11;
-	    con = alpha_i[0] * split;
-	    b1 = con - alpha_i[0];
-	    b1 = con - b1;
-	    b2 = alpha_i[0] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a0 * alpha_i[0];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 	    c2 = tail_a0 * alpha_i[0];
 	    t1 = c11 + c2;
@@ -1474,19 +1135,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a1 * split;
-	    a11 = con - head_a1;
-	    a11 = con - a11;
-	    a21 = head_a1 - a11;
-	    con = alpha_i[1] * split;
-	    b1 = con - alpha_i[1];
-	    b1 = con - b1;
-	    b2 = alpha_i[1] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a1 * alpha_i[1];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 	    c2 = tail_a1 * alpha_i[1];
 	    t1 = c11 + c2;
@@ -1529,19 +1181,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  /* imaginary part */
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a1 * split;
-	    a11 = con - head_a1;
-	    a11 = con - a11;
-	    a21 = head_a1 - a11;
-	    con = alpha_i[0] * split;
-	    b1 = con - alpha_i[0];
-	    b1 = con - b1;
-	    b2 = alpha_i[0] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a1 * alpha_i[0];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 	    c2 = tail_a1 * alpha_i[0];
 	    t1 = c11 + c2;
@@ -1552,19 +1195,10 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_a0 * split;
-	    a11 = con - head_a0;
-	    a11 = con - a11;
-	    a21 = head_a0 - a11;
-	    con = alpha_i[1] * split;
-	    b1 = con - alpha_i[1];
-	    b1 = con - b1;
-	    b2 = alpha_i[1] - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_a0 * alpha_i[1];
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 	    c2 = tail_a0 * alpha_i[1];
 	    t1 = c11 + c2;
@@ -1686,35 +1320,13 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  /* Real part */
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[0] * split;
-	    a1 = con - beta_i[0];
-	    a1 = con - a1;
-	    a2 = beta_i[0] - a1;
-	    con = y_elem[0] * split;
-	    b1 = con - y_elem[0];
-	    b1 = con - b1;
-	    b2 = y_elem[0] - b1;
-
 	    head_t1 = beta_i[0] * y_elem[0];
-	    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], y_elem[0], head_t1);
 	  }
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[1] * split;
-	    a1 = con - beta_i[1];
-	    a1 = con - a1;
-	    a2 = beta_i[1] - a1;
-	    con = y_elem[1] * split;
-	    b1 = con - y_elem[1];
-	    b1 = con - b1;
-	    b2 = y_elem[1] - b1;
-
 	    head_t2 = beta_i[1] * y_elem[1];
-	    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], y_elem[1], head_t2);
 	  }
 	  head_t2 = -head_t2;
 	  tail_t2 = -tail_t2;
@@ -1750,35 +1362,13 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	  /* Imaginary part */
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[1] * split;
-	    a1 = con - beta_i[1];
-	    a1 = con - a1;
-	    a2 = beta_i[1] - a1;
-	    con = y_elem[0] * split;
-	    b1 = con - y_elem[0];
-	    b1 = con - b1;
-	    b2 = y_elem[0] - b1;
-
 	    head_t1 = beta_i[1] * y_elem[0];
-	    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], y_elem[0], head_t1);
 	  }
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[0] * split;
-	    a1 = con - beta_i[0];
-	    a1 = con - a1;
-	    a2 = beta_i[0] - a1;
-	    con = y_elem[1] * split;
-	    b1 = con - y_elem[1];
-	    b1 = con - b1;
-	    b2 = y_elem[1] - b1;
-
 	    head_t2 = beta_i[0] * y_elem[1];
-	    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], y_elem[1], head_t2);
 	  }
 	  {
 	    /* Compute double-double = double-double + double-double. */
@@ -1892,6 +1482,8 @@ void		BLAS_zgbmv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(row_sum1);
+      blas_free(row_sum2);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	   		const		void  *alpha, const void *a, int lda,
 			    		const		float *x, int incx,
@@ -475,6 +476,7 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
     }
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     {
       int	      i    , j;
       int	      xi   , yi;
@@ -910,6 +912,8 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
       double	      head_sumB[2], tail_sumB[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sumA;
+      double         *col_sumB;
 
       FPU_FIX_DECL;
 
@@ -971,6 +975,28 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 
       FPU_FIX_START;
 
+      /* Columns of A and B contiguous: sweep them into row sums. */
+      col_sumA = col_sumB = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_cols_x(m, n, a_i, blas_gemm_elt_c, incaij / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi);
+      if (incbi == 2 && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_cols_x(m, n, b_i, blas_gemm_elt_c, incbij / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi);
+
+      /* Rows of A and B contiguous: on several threads, sum them in
+         panels. */
+      if (col_sumA == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_rows_x(m, n, a_i, blas_gemm_elt_c, incai / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi, 0);
+      if (col_sumB == NULL
+	  && incbij == 2
+	  && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_rows_x(m, n, b_i, blas_gemm_elt_c, incbi / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi, 0);
+
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	  /* alpha, beta are 0.0 */
@@ -987,91 +1013,80 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		head_prod[0] = (double)b_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)b_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)b_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)b_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumB[0];
@@ -1088,91 +1103,80 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		head_prod[0] = (double)b_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)b_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)b_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)b_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -1192,20 +1196,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -1216,20 +1210,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -1272,20 +1256,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -1296,20 +1270,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -1366,91 +1330,80 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		head_prod[0] = (double)a_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)a_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)a_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)a_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
+		aij += incaij;
 
+	      }
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumA[0];
@@ -1468,172 +1421,147 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		head_prod[0] = (double)a_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)a_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)a_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)a_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		head_prod[0] = (double)b_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)b_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)b_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)b_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1732,172 +1660,147 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		head_prod[0] = (double)a_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)a_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)a_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)a_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		head_prod[0] = (double)b_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)b_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)b_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)b_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1921,20 +1824,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -1945,20 +1838,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -2001,20 +1884,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -2025,20 +1898,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -2168,91 +2031,80 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		head_prod[0] = (double)a_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)a_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)a_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)a_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
+		aij += incaij;
 
+	      }
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2272,20 +2124,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -2296,20 +2138,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -2352,20 +2184,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -2376,20 +2198,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -2445,172 +2257,147 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		head_prod[0] = (double)a_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)a_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)a_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)a_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		head_prod[0] = (double)b_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)b_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)b_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)b_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2630,20 +2417,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -2654,20 +2431,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -2710,20 +2477,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -2734,20 +2491,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -2880,172 +2627,147 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		head_prod[0] = (double)a_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)a_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)a_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)a_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		head_prod[0] = (double)b_elem[0] * x_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)b_elem[1] * x_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)b_elem[0] * x_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)b_elem[1] * x_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -3065,20 +2787,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -3089,20 +2801,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -3145,20 +2847,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -3169,20 +2861,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -3240,20 +2922,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -3264,20 +2936,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -3320,20 +2982,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -3344,20 +2996,10 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -3478,6 +3120,8 @@ void		BLAS_cge_sum_mv_c_s_x(enum blas_order_type order, int m, int n,
 	  }
 	}
       }
+      blas_free(col_sumA);
+      blas_free(col_sumB);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	  		const		void  *alpha, const float *a, int lda,
 			    		const		void  *x, int incx,
@@ -471,6 +472,7 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
     }
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     {
       int	      i    , j;
       int	      xi   , yi;
@@ -902,6 +904,8 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
       double	      head_sumB[2], tail_sumB[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sumA;
+      double         *col_sumB;
 
       FPU_FIX_DECL;
 
@@ -963,6 +967,32 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 
       FPU_FIX_START;
 
+      /* Columns of A and B contiguous: sweep them into row sums. */
+      col_sumA = col_sumB = NULL;
+      if (incai == 1 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_cols_x(m, n, a_i, blas_gemm_elt_s, incaij, 0,
+				    x_i + x_starti, blas_gemm_elt_c,
+				    incxi / 2);
+      if (incbi == 1 && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_cols_x(m, n, b_i, blas_gemm_elt_s, incbij, 0,
+				    x_i + x_starti, blas_gemm_elt_c,
+				    incxi / 2);
+
+      /* Rows of A and B contiguous: on several threads, sum them in
+         panels. */
+      if (col_sumA == NULL
+	  && incaij == 1
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_rows_x(m, n, a_i, blas_gemm_elt_s, incai, 0,
+				    x_i + x_starti, blas_gemm_elt_c, incxi / 2,
+				    0);
+      if (col_sumB == NULL
+	  && incbij == 1
+	  && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_rows_x(m, n, b_i, blas_gemm_elt_s, incbi, 0,
+				    x_i + x_starti, blas_gemm_elt_c, incxi / 2,
+				    0);
+
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	  /* alpha, beta are 0.0 */
@@ -979,91 +1009,80 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem = b_i[bij];
-	      {
-		head_prod[0] = (double)x_elem[0] * b_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * b_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * b_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * b_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumB[0];
@@ -1080,91 +1099,80 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem = b_i[bij];
-	      {
-		head_prod[0] = (double)x_elem[0] * b_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * b_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * b_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * b_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -1184,20 +1192,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -1208,20 +1206,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -1264,20 +1252,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -1288,20 +1266,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -1358,91 +1326,80 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
+		aij += incaij;
 
+	      }
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumA[0];
@@ -1460,171 +1417,146 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		head_prod[0] = (double)x_elem[0] * b_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * b_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * b_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * b_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1723,171 +1655,146 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		head_prod[0] = (double)x_elem[0] * b_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * b_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * b_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * b_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1911,20 +1818,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -1935,20 +1832,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -1991,20 +1878,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -2015,20 +1892,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -2158,91 +2025,80 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
+		aij += incaij;
 
+	      }
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2262,20 +2118,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -2286,20 +2132,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -2342,20 +2178,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -2366,20 +2192,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -2435,171 +2251,146 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		head_prod[0] = (double)x_elem[0] * b_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * b_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * b_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * b_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2619,20 +2410,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -2643,20 +2424,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -2699,20 +2470,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -2723,20 +2484,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -2869,171 +2620,146 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		head_prod[0] = (double)x_elem[0] * b_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * b_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * b_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * b_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -3053,20 +2779,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -3077,20 +2793,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -3133,20 +2839,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -3157,20 +2853,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -3228,20 +2914,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -3252,20 +2928,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -3308,20 +2974,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -3332,20 +2988,10 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -3466,6 +3112,8 @@ void		BLAS_cge_sum_mv_s_c_x(enum blas_order_type order, int m, int n,
 	  }
 	}
       }
+      blas_free(col_sumA);
+      blas_free(col_sumB);
       FPU_FIX_STOP;
     }
     break;
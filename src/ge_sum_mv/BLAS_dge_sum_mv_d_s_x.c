@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 		       		double	alpha , const double *a, int lda,
 			    		const		float *x, int incx,
@@ -64,6 +65,7 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
   case blas_prec_single:
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     {
       int	      i    , j;
       int	      xi   , yi;
@@ -404,6 +406,8 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
       double	      head_sumB, tail_sumB;
       double	      head_tmp1, tail_tmp1;
       double	      head_tmp2, tail_tmp2;
+      double         *col_sumA;
+      double         *col_sumB;
 
       FPU_FIX_DECL;
 
@@ -465,6 +469,24 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 
       FPU_FIX_START;
 
+      /* Columns of A and B contiguous: sweep them into row sums. */
+      col_sumA = col_sumB = NULL;
+      if (incai == 1 && alpha_i != 0.0)
+	col_sumA = blas_gemv_cols_x(m, n, a_i, blas_gemm_elt_d, incaij, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi);
+      if (incbi == 1 && beta_i != 0.0)
+	col_sumB = blas_gemv_cols_x(m, n, b_i, blas_gemm_elt_d, incbij, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi);
+
+      /* Rows of A and B contiguous: on several threads, sum them in
+         panels. */
+      if (col_sumA == NULL && incaij == 1 && alpha_i != 0.0)
+	col_sumA = blas_gemv_rows_x(m, n, a_i, blas_gemm_elt_d, incai, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi, 0);
+      if (col_sumB == NULL && incbij == 1 && beta_i != 0.0)
+	col_sumB = blas_gemv_rows_x(m, n, b_i, blas_gemm_elt_d, incbi, 0,
+				    x_i + x_starti, blas_gemm_elt_s, incxi, 0);
+
       if (alpha_i == 0.0) {
 	if (beta_i == 0.0) {
 	  /* alpha, beta are 0.0 */
@@ -480,57 +502,42 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB = tail_sumB = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-
-	      b_elem = b_i[bij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumB != NULL) {
+	      head_sumB = col_sumB[2 * i];
+	      tail_sumB = col_sumB[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = b_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = b_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(b_elem, dt, head_prod);
+		  }
 		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumB + head_prod;
+		  bv = s1 - head_sumB;
+		  s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumB + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumB = s1 + s2;
+		  tail_sumB = s2 - (head_sumB - s1);
+		}
+		bij += incbij;
 	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumB + head_prod;
-		bv = s1 - head_sumB;
-		s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumB + tail_prod;
-		bv = t1 - tail_sumB;
-		t2 = ((tail_prod - bv) + (tail_sumB - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumB = t1 + t2;
-		tail_sumB = t2 - (head_sumB - t1);
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumB;
@@ -546,74 +553,50 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB = tail_sumB = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-
-	      b_elem = b_i[bij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumB != NULL) {
+	      head_sumB = col_sumB[2 * i];
+	      tail_sumB = col_sumB[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = b_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = b_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(b_elem, dt, head_prod);
+		  }
 		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumB + head_prod;
+		  bv = s1 - head_sumB;
+		  s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumB + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumB = s1 + s2;
+		  tail_sumB = s2 - (head_sumB - s1);
+		}
+		bij += incbij;
 	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumB + head_prod;
-		bv = s1 - head_sumB;
-		s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumB + tail_prod;
-		bv = t1 - tail_sumB;
-		t2 = ((tail_prod - bv) + (tail_sumB - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumB = t1 + t2;
-		tail_sumB = t2 - (head_sumB - t1);
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sumB * split;
-	      a11 = con - head_sumB;
-	      a11 = con - a11;
-	      a21 = head_sumB - a11;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sumB * beta_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sumB, beta_i, c11);
 
 	      c2 = tail_sumB * beta_i;
 	      t1 = c11 + c2;
@@ -637,57 +620,42 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    head_sumA = tail_sumA = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem = a_i[aij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumA != NULL) {
+	      head_sumA = col_sumA[2 * i];
+	      tail_sumA = col_sumA[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumA + head_prod;
-		bv = s1 - head_sumA;
-		s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumA + tail_prod;
-		bv = t1 - tail_sumA;
-		t2 = ((tail_prod - bv) + (tail_sumA - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumA + head_prod;
+		  bv = s1 - head_sumA;
+		  s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumA + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumA = s1 + s2;
+		  tail_sumA = s2 - (head_sumA - s1);
+		}
+		aij += incaij;
 
-		/* Renormalize (t1, t2)  */
-		head_sumA = t1 + t2;
-		tail_sumA = t2 - (head_sumA - t1);
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumA;
@@ -704,104 +672,71 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB = tail_sumB = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem = a_i[aij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA = col_sumA[2 * i];
+	      tail_sumA = col_sumA[2 * i + 1];
+	      head_sumB = col_sumB[2 * i];
+	      tail_sumB = col_sumB[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumA + head_prod;
-		bv = s1 - head_sumA;
-		s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumA + tail_prod;
-		bv = t1 - tail_sumA;
-		t2 = ((tail_prod - bv) + (tail_sumA - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumA = t1 + t2;
-		tail_sumA = t2 - (head_sumA - t1);
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		double		dt = (double)x_elem;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = b_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumA + head_prod;
+		  bv = s1 - head_sumA;
+		  s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumA + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumA = s1 + s2;
+		  tail_sumA = s2 - (head_sumA - s1);
 		}
+		aij += incaij;
+		b_elem = b_i[bij];
+		{
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = b_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(b_elem, dt, head_prod);
+		  }
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumB + head_prod;
+		  bv = s1 - head_sumB;
+		  s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumB + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumB = s1 + s2;
+		  tail_sumB = s2 - (head_sumB - s1);
+		}
+		bij += incbij;
 	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumB + head_prod;
-		bv = s1 - head_sumB;
-		s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumB + tail_prod;
-		bv = t1 - tail_sumB;
-		t2 = ((tail_prod - bv) + (tail_sumB - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumB = t1 + t2;
-		tail_sumB = t2 - (head_sumB - t1);
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1 = head_sumA;
@@ -849,123 +784,81 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB = tail_sumB = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem = a_i[aij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA = col_sumA[2 * i];
+	      tail_sumA = col_sumA[2 * i + 1];
+	      head_sumB = col_sumB[2 * i];
+	      tail_sumB = col_sumB[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumA + head_prod;
-		bv = s1 - head_sumA;
-		s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumA + tail_prod;
-		bv = t1 - tail_sumA;
-		t2 = ((tail_prod - bv) + (tail_sumA - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumA = t1 + t2;
-		tail_sumA = t2 - (head_sumA - t1);
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		double		dt = (double)x_elem;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = b_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumA + head_prod;
+		  bv = s1 - head_sumA;
+		  s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumA + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumA = s1 + s2;
+		  tail_sumA = s2 - (head_sumA - s1);
 		}
+		aij += incaij;
+		b_elem = b_i[bij];
+		{
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = b_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(b_elem, dt, head_prod);
+		  }
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumB + head_prod;
+		  bv = s1 - head_sumB;
+		  s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumB + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumB = s1 + s2;
+		  tail_sumB = s2 - (head_sumB - s1);
+		}
+		bij += incbij;
 	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumB + head_prod;
-		bv = s1 - head_sumB;
-		s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumB + tail_prod;
-		bv = t1 - tail_sumB;
-		t2 = ((tail_prod - bv) + (tail_sumB - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumB = t1 + t2;
-		tail_sumB = t2 - (head_sumB - t1);
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1 = head_sumA;
 	    tail_tmp1 = tail_sumA;
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sumB * split;
-	      a11 = con - head_sumB;
-	      a11 = con - a11;
-	      a21 = head_sumB - a11;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sumB * beta_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sumB, beta_i, c11);
 
 	      c2 = tail_sumB * beta_i;
 	      t1 = c11 + c2;
@@ -1016,74 +909,50 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    head_sumA = tail_sumA = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem = a_i[aij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumA != NULL) {
+	      head_sumA = col_sumA[2 * i];
+	      tail_sumA = col_sumA[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumA + head_prod;
-		bv = s1 - head_sumA;
-		s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumA + tail_prod;
-		bv = t1 - tail_sumA;
-		t2 = ((tail_prod - bv) + (tail_sumA - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumA + head_prod;
+		  bv = s1 - head_sumA;
+		  s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumA + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumA = s1 + s2;
+		  tail_sumA = s2 - (head_sumA - s1);
+		}
+		aij += incaij;
 
-		/* Renormalize (t1, t2)  */
-		head_sumA = t1 + t2;
-		tail_sumA = t2 - (head_sumA - t1);
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sumA * split;
-	      a11 = con - head_sumA;
-	      a11 = con - a11;
-	      a21 = head_sumA - a11;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sumA * alpha_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sumA, alpha_i, c11);
 
 	      c2 = tail_sumA * alpha_i;
 	      t1 = c11 + c2;
@@ -1106,121 +975,79 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB = tail_sumB = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem = a_i[aij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA = col_sumA[2 * i];
+	      tail_sumA = col_sumA[2 * i + 1];
+	      head_sumB = col_sumB[2 * i];
+	      tail_sumB = col_sumB[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumA + head_prod;
-		bv = s1 - head_sumA;
-		s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumA + tail_prod;
-		bv = t1 - tail_sumA;
-		t2 = ((tail_prod - bv) + (tail_sumA - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumA = t1 + t2;
-		tail_sumA = t2 - (head_sumA - t1);
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		double		dt = (double)x_elem;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = b_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumA + head_prod;
+		  bv = s1 - head_sumA;
+		  s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumA + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumA = s1 + s2;
+		  tail_sumA = s2 - (head_sumA - s1);
 		}
+		aij += incaij;
+		b_elem = b_i[bij];
+		{
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = b_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(b_elem, dt, head_prod);
+		  }
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumB + head_prod;
+		  bv = s1 - head_sumB;
+		  s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumB + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumB = s1 + s2;
+		  tail_sumB = s2 - (head_sumB - s1);
+		}
+		bij += incbij;
 	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumB + head_prod;
-		bv = s1 - head_sumB;
-		s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumB + tail_prod;
-		bv = t1 - tail_sumB;
-		t2 = ((tail_prod - bv) + (tail_sumB - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumB = t1 + t2;
-		tail_sumB = t2 - (head_sumB - t1);
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sumA * split;
-	      a11 = con - head_sumA;
-	      a11 = con - a11;
-	      a21 = head_sumA - a11;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sumA * alpha_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sumA, alpha_i, c11);
 
 	      c2 = tail_sumA * alpha_i;
 	      t1 = c11 + c2;
@@ -1272,121 +1099,79 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB = tail_sumB = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem = x_i[xi];
-	      a_elem = a_i[aij];
-	      {
-		double		dt = (double)x_elem;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA = col_sumA[2 * i];
+	      tail_sumA = col_sumA[2 * i + 1];
+	      head_sumB = col_sumB[2 * i];
+	      tail_sumB = col_sumB[2 * i + 1];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem = x_i[xi];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumA + head_prod;
-		bv = s1 - head_sumA;
-		s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumA + tail_prod;
-		bv = t1 - tail_sumA;
-		t2 = ((tail_prod - bv) + (tail_sumA - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumA = t1 + t2;
-		tail_sumA = t2 - (head_sumA - t1);
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		double		dt = (double)x_elem;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = b_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumA + head_prod;
+		  bv = s1 - head_sumA;
+		  s2 = ((head_prod - bv) + (head_sumA - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumA + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumA = s1 + s2;
+		  tail_sumA = s2 - (head_sumA - s1);
 		}
+		aij += incaij;
+		b_elem = b_i[bij];
+		{
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = b_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(b_elem, dt, head_prod);
+		  }
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sumB + head_prod;
+		  bv = s1 - head_sumB;
+		  s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sumB + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sumB = s1 + s2;
+		  tail_sumB = s2 - (head_sumB - s1);
+		}
+		bij += incbij;
 	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sumB + head_prod;
-		bv = s1 - head_sumB;
-		s2 = ((head_prod - bv) + (head_sumB - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sumB + tail_prod;
-		bv = t1 - tail_sumB;
-		t2 = ((tail_prod - bv) + (tail_sumB - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sumB = t1 + t2;
-		tail_sumB = t2 - (head_sumB - t1);
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sumA * split;
-	      a11 = con - head_sumA;
-	      a11 = con - a11;
-	      a21 = head_sumA - a11;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sumA * alpha_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sumA, alpha_i, c11);
 
 	      c2 = tail_sumA * alpha_i;
 	      t1 = c11 + c2;
@@ -1397,19 +1182,10 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sumB * split;
-	      a11 = con - head_sumB;
-	      a11 = con - a11;
-	      a21 = head_sumB - a11;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sumB * beta_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sumB, beta_i, c11);
 
 	      c2 = tail_sumB * beta_i;
 	      t1 = c11 + c2;
@@ -1451,6 +1227,8 @@ void		BLAS_dge_sum_mv_d_s_x(enum blas_order_type order, int m, int n,
 	  }
 	}
       }
+      blas_free(col_sumA);
+      blas_free(col_sumB);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	   		const		void  *alpha, const void *a, int lda,
 			    		const		void  *x, int incx,
@@ -64,6 +65,7 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
   case blas_prec_single:
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     {
       int	      i    , j;
       int	      xi   , yi;
@@ -507,6 +509,8 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
       double	      head_sumB[2], tail_sumB[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sumA;
+      double         *col_sumB;
 
       FPU_FIX_DECL;
 
@@ -568,6 +572,32 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 
       FPU_FIX_START;
 
+      /* Columns of A and B contiguous: sweep them into row sums. */
+      col_sumA = col_sumB = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_cols_x(m, n, a_i, blas_gemm_elt_c, incaij / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_c,
+				    incxi / 2);
+      if (incbi == 2 && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_cols_x(m, n, b_i, blas_gemm_elt_c, incbij / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_c,
+				    incxi / 2);
+
+      /* Rows of A and B contiguous: on several threads, sum them in
+         panels. */
+      if (col_sumA == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_rows_x(m, n, a_i, blas_gemm_elt_c, incai / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_c, incxi / 2,
+				    0);
+      if (col_sumB == NULL
+	  && incbij == 2
+	  && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_rows_x(m, n, b_i, blas_gemm_elt_c, incbi / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_c, incxi / 2,
+				    0);
+
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	  /* alpha, beta are 0.0 */
@@ -584,127 +614,116 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)b_elem[0] * x_elem[0];
-		d2 = (double)-b_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)b_elem[0] * x_elem[1];
-		d2 = (double)b_elem[1] * x_elem[0];
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)b_elem[0] * x_elem[0];
+		  d2 = (double)-b_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)b_elem[0] * x_elem[1];
+		  d2 = (double)b_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumB[0];
@@ -721,127 +740,116 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)b_elem[0] * x_elem[0];
-		d2 = (double)-b_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)b_elem[0] * x_elem[1];
-		d2 = (double)b_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)b_elem[0] * x_elem[0];
+		  d2 = (double)-b_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)b_elem[0] * x_elem[1];
+		  d2 = (double)b_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -857,19 +865,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -880,19 +879,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -935,19 +925,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -958,19 +939,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -1026,127 +998,116 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		aij += incaij;
 
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumA[0];
@@ -1164,243 +1125,218 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)b_elem[0] * x_elem[0];
-		d2 = (double)-b_elem[1] * x_elem[1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)b_elem[0] * x_elem[1];
-		d2 = (double)b_elem[1] * x_elem[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)b_elem[0] * x_elem[0];
+		  d2 = (double)-b_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)b_elem[0] * x_elem[1];
+		  d2 = (double)b_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1499,243 +1435,218 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)b_elem[0] * x_elem[0];
+		  d2 = (double)-b_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)b_elem[0] * x_elem[1];
+		  d2 = (double)b_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
+		bij += incbij;
 	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)b_elem[0] * x_elem[0];
-		d2 = (double)-b_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)b_elem[0] * x_elem[1];
-		d2 = (double)b_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1755,19 +1666,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -1778,19 +1680,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -1833,19 +1726,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -1856,19 +1740,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -1997,127 +1872,116 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
+		aij += incaij;
 
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2133,19 +1997,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2156,19 +2011,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2211,19 +2057,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2234,19 +2071,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2301,243 +2129,218 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)b_elem[0] * x_elem[0];
+		  d2 = (double)-b_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)b_elem[0] * x_elem[1];
+		  d2 = (double)b_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
+		bij += incbij;
 	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)b_elem[0] * x_elem[0];
-		d2 = (double)-b_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)b_elem[0] * x_elem[1];
-		d2 = (double)b_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2553,19 +2356,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2576,19 +2370,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2631,19 +2416,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2654,19 +2430,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2798,243 +2565,218 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)b_elem[0] * x_elem[0];
+		  d2 = (double)-b_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)b_elem[0] * x_elem[1];
+		  d2 = (double)b_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
+		bij += incbij;
 	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)b_elem[0] * x_elem[0];
-		d2 = (double)-b_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)b_elem[0] * x_elem[1];
-		d2 = (double)b_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -3050,19 +2792,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -3073,19 +2806,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3128,19 +2852,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -3151,19 +2866,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3216,19 +2922,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -3239,19 +2936,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -3294,19 +2982,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -3317,19 +2996,10 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -3449,6 +3119,8 @@ void		BLAS_zge_sum_mv_c_c_x(enum blas_order_type order, int m, int n,
 	  }
 	}
       }
+      blas_free(col_sumA);
+      blas_free(col_sumB);
       FPU_FIX_STOP;
     }
     break;
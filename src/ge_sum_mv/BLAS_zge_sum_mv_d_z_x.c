@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	 		const		void  *alpha, const double *a, int lda,
 			    		const		void  *x, int incx,
@@ -64,6 +65,7 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
   case blas_prec_single:
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     {
       int	      i    , j;
       int	      xi   , yi;
@@ -495,6 +497,8 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
       double	      head_sumB[2], tail_sumB[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sumA;
+      double         *col_sumB;
 
       FPU_FIX_DECL;
 
@@ -556,6 +560,32 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 
       FPU_FIX_START;
 
+      /* Columns of A and B contiguous: sweep them into row sums. */
+      col_sumA = col_sumB = NULL;
+      if (incai == 1 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_cols_x(m, n, a_i, blas_gemm_elt_d, incaij, 0,
+				    x_i + x_starti, blas_gemm_elt_z,
+				    incxi / 2);
+      if (incbi == 1 && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_cols_x(m, n, b_i, blas_gemm_elt_d, incbij, 0,
+				    x_i + x_starti, blas_gemm_elt_z,
+				    incxi / 2);
+
+      /* Rows of A and B contiguous: on several threads, sum them in
+         panels. */
+      if (col_sumA == NULL
+	  && incaij == 1
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_rows_x(m, n, a_i, blas_gemm_elt_d, incai, 0,
+				    x_i + x_starti, blas_gemm_elt_z, incxi / 2,
+				    0);
+      if (col_sumB == NULL
+	  && incbij == 1
+	  && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_rows_x(m, n, b_i, blas_gemm_elt_d, incbi, 0,
+				    x_i + x_starti, blas_gemm_elt_z, incxi / 2,
+				    0);
+
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	  /* alpha, beta are 0.0 */
@@ -572,125 +602,92 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem = b_i[bij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = b_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = b_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumB[0];
@@ -707,125 +704,92 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem = b_i[bij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = b_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = b_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -841,19 +805,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -864,19 +819,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -919,19 +865,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -942,19 +879,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -1010,125 +938,92 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
+		aij += incaij;
 
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumA[0];
@@ -1146,239 +1041,170 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = b_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = b_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1477,239 +1303,170 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = b_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = b_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1729,19 +1486,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -1752,19 +1500,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -1807,19 +1546,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -1830,19 +1560,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -1971,125 +1692,92 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		aij += incaij;
 
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2105,19 +1793,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2128,19 +1807,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2183,19 +1853,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2206,19 +1867,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2273,239 +1925,170 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = b_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = b_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2521,19 +2104,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2544,19 +2118,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2599,19 +2164,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2622,19 +2178,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2766,239 +2313,170 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem = a_i[aij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem = a_i[aij];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem = b_i[bij];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = b_elem * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
 		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
+		aij += incaij;
+		b_elem = b_i[bij];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = b_elem * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = b_elem * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
 		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
 		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -3014,19 +2492,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -3037,19 +2506,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3092,19 +2552,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -3115,19 +2566,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3180,19 +2622,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -3203,19 +2636,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -3258,19 +2682,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -3281,19 +2696,10 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -3413,6 +2819,8 @@ void		BLAS_zge_sum_mv_d_z_x(enum blas_order_type order, int m, int n,
 	  }
 	}
       }
+      blas_free(col_sumA);
+      blas_free(col_sumB);
       FPU_FIX_STOP;
     }
     break;
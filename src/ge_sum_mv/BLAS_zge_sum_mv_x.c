@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
        		const		void  *alpha, const void *a, int lda,
 					const		void  *x, int incx,
@@ -64,6 +65,7 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
   case blas_prec_single:
   case blas_prec_indigenous:
   case blas_prec_double:
+  case blas_prec_reproducible:
     {
       int	      i    , j;
       int	      xi   , yi;
@@ -507,6 +509,8 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
       double	      head_sumB[2], tail_sumB[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sumA;
+      double         *col_sumB;
 
       FPU_FIX_DECL;
 
@@ -568,6 +572,32 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 
       FPU_FIX_START;
 
+      /* Columns of A and B contiguous: sweep them into row sums. */
+      col_sumA = col_sumB = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_cols_x(m, n, a_i, blas_gemm_elt_z, incaij / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_z,
+				    incxi / 2);
+      if (incbi == 2 && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_cols_x(m, n, b_i, blas_gemm_elt_z, incbij / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_z,
+				    incxi / 2);
+
+      /* Rows of A and B contiguous: on several threads, sum them in
+         panels. */
+      if (col_sumA == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sumA = blas_gemv_rows_x(m, n, a_i, blas_gemm_elt_z, incai / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_z, incxi / 2,
+				    0);
+      if (col_sumB == NULL
+	  && incbij == 2
+	  && !(beta_i[0] == 0.0 && beta_i[1] == 0.0))
+	col_sumB = blas_gemv_rows_x(m, n, b_i, blas_gemm_elt_z, incbi / 2, 0,
+				    x_i + x_starti, blas_gemm_elt_z, incxi / 2,
+				    0);
+
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	  /* alpha, beta are 0.0 */
@@ -584,217 +614,144 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
+		}
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumB[0];
@@ -811,217 +768,144 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
+	    if (col_sumB != NULL) {
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
+		}
+		bij += incbij;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -1037,19 +921,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -1060,19 +935,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -1115,19 +981,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -1138,19 +995,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -1206,217 +1054,144 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
 	    aij = ai;
 
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
+		}
+		aij += incaij;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    y_i[yi] = head_sumA[0];
@@ -1434,423 +1209,274 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
+		}
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
+		}
+		bij += incbij;
 	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -1949,423 +1575,274 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
+		}
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
+		}
+		bij += incbij;
 	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
-	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    head_tmp1[0] = head_sumA[0];
@@ -2385,19 +1862,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -2408,19 +1876,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -2463,19 +1922,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -2486,19 +1936,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -2577,267 +2018,194 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      head_tmp1[0] = head_t;
 	      tail_tmp1[0] = tail_t;
 	      /* Imaginary part */
-	      head_a = head_tmp1[1];
-	      tail_a = tail_tmp1[1];
-	      head_b = head_tmp2[1];
-	      tail_b = tail_tmp2[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_tmp1[1] = head_t;
-	      tail_tmp1[1] = tail_t;
-	    }
-	    y_i[yi] = head_tmp1[0];
-	    y_i[yi + 1] = head_tmp1[1];
-	    ai += incai;
-	    bi += incbi;
-	  }
-	}
-      } else {
-	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-	  /* alpha is other, beta is 0.0 */
-
-	  ai = 0;
-
-	  for (i = 0, yi = y_starti; i < m; i++, yi += incyi) {
-	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
-	    aij = ai;
-
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
+	      head_a = head_tmp1[1];
+	      tail_a = tail_tmp1[1];
+	      head_b = head_tmp2[1];
+	      tail_b = tail_tmp2[1];
 	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		/* Compute double-double = double-double + double-double. */
+		double		bv;
+		double		s1     , s2, t1, t2;
 
-		  s2 += t1;
+		/* Add two hi words. */
+		s1 = head_a + head_b;
+		bv = s1 - head_a;
+		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
+		/* Add two lo words. */
+		t1 = tail_a + tail_b;
+		bv = t1 - tail_a;
+		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		  t2 += s2;
+		s2 += t1;
 
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		/* Renormalize (s1, s2)  to  (t1, s2) */
+		t1 = s1 + s2;
+		s2 = s2 - (t1 - s1);
 
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		t2 += s2;
 
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		/* Renormalize (t1, t2)  */
+		head_t = t1 + t2;
+		tail_t = t2 - (head_t - t1);
+	      }
+	      head_tmp1[1] = head_t;
+	      tail_tmp1[1] = tail_t;
+	    }
+	    y_i[yi] = head_tmp1[0];
+	    y_i[yi + 1] = head_tmp1[1];
+	    ai += incai;
+	    bi += incbi;
+	  }
+	}
+      } else {
+	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+	  /* alpha is other, beta is 0.0 */
 
-		  s2 += t1;
+	  ai = 0;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
+	  for (i = 0, yi = y_starti; i < m; i++, yi += incyi) {
+	    head_sumA[0] = head_sumA[1] = tail_sumA[0] = tail_sumA[1] = 0.0;
+	    aij = ai;
 
-		  t2 += s2;
+	    if (col_sumA != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
+		}
+		aij += incaij;
 
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
 	      }
-	      aij += incaij;
-
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -2853,19 +2221,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2876,19 +2235,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -2931,19 +2281,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -2954,19 +2295,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3021,423 +2353,274 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
+		}
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
+		}
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -3453,19 +2636,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -3476,19 +2650,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3531,19 +2696,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -3554,19 +2710,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -3698,423 +2845,274 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	    aij = ai;
 	    head_sumB[0] = head_sumB[1] = tail_sumB[0] = tail_sumB[1] = 0.0;
 	    bij = bi;
-	    for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      a_elem[0] = a_i[aij];
-	      a_elem[1] = a_i[aij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[1] * split;
-		  a1 = con - a_elem[1];
-		  a1 = con - a1;
-		  a2 = a_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = a_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = a_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumA[0];
-		tail_a = tail_sumA[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[0] = head_t;
-		tail_sumA[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumA[1];
-		tail_a = tail_sumA[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumA[1] = head_t;
-		tail_sumA[1] = tail_t;
-	      }
-	      aij += incaij;
-	      b_elem[0] = b_i[bij];
-	      b_elem[1] = b_i[bij + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[0] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[1] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[0] = head_t1;
-		tail_prod[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[1] * split;
-		  a1 = con - b_elem[1];
-		  a1 = con - a1;
-		  a2 = b_elem[1] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t1 = b_elem[1] * x_elem[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem[0] * split;
-		  a1 = con - b_elem[0];
-		  a1 = con - a1;
-		  a2 = b_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t2 = b_elem[0] * x_elem[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_prod[1] = head_t1;
-		tail_prod[1] = tail_t1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sumB[0];
-		tail_a = tail_sumB[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[0] = head_t;
-		tail_sumB[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sumB[1];
-		tail_a = tail_sumB[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sumB[1] = head_t;
-		tail_sumB[1] = tail_t;
+	    if (col_sumA != NULL && col_sumB != NULL) {
+	      head_sumA[0] = col_sumA[4 * i];
+	      head_sumA[1] = col_sumA[4 * i + 1];
+	      tail_sumA[0] = col_sumA[4 * i + 2];
+	      tail_sumA[1] = col_sumA[4 * i + 3];
+	      head_sumB[0] = col_sumB[4 * i];
+	      head_sumB[1] = col_sumB[4 * i + 1];
+	      tail_sumB[0] = col_sumB[4 * i + 2];
+	      tail_sumB[1] = col_sumB[4 * i + 3];
+	    } else {
+	      for (j = 0, xi = x_starti; j < n; j++, xi += incxi) {
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		a_elem[1] = a_i[aij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = a_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = a_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumA[0];
+		  tail_a = tail_sumA[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[0] = head_t;
+		  tail_sumA[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumA[1];
+		  tail_a = tail_sumA[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumA[1] = head_t;
+		  tail_sumA[1] = tail_t;
+		}
+		aij += incaij;
+		b_elem[0] = b_i[bij];
+		b_elem[1] = b_i[bij + 1];
+		{
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double		head_t1, tail_t1;
+		  double		head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[0] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[1] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[0] = head_t1;
+		  tail_prod[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = b_elem[1] * x_elem[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(b_elem[1], x_elem[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = b_elem[0] * x_elem[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(b_elem[0], x_elem[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
+		  }
+		  head_prod[1] = head_t1;
+		  tail_prod[1] = tail_t1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sumB[0];
+		  tail_a = tail_sumB[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[0] = head_t;
+		  tail_sumB[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sumB[1];
+		  tail_a = tail_sumB[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sumB[1] = head_t;
+		  tail_sumB[1] = tail_t;
+		}
+		bij += incbij;
 	      }
-	      bij += incbij;
 	    }
 	    /* now put the result into y_i */
 	    {
@@ -4130,19 +3128,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -4153,19 +3142,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -4208,19 +3188,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -4231,19 +3202,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -4296,19 +3258,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[0], c11);
 
 		c2 = tail_a0 * beta_i[0];
 		t1 = c11 + c2;
@@ -4319,19 +3272,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[1], c11);
 
 		c2 = tail_a1 * beta_i[1];
 		t1 = c11 + c2;
@@ -4374,19 +3318,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * beta_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, beta_i[0], c11);
 
 		c2 = tail_a1 * beta_i[0];
 		t1 = c11 + c2;
@@ -4397,19 +3332,10 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * beta_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, beta_i[1], c11);
 
 		c2 = tail_a0 * beta_i[1];
 		t1 = c11 + c2;
@@ -4529,6 +3455,8 @@ void		BLAS_zge_sum_mv_x(enum blas_order_type order, int m, int n,
 	  }
 	}
       }
+      blas_free(col_sumA);
+      blas_free(col_sumB);
       FPU_FIX_STOP;
     }
     break;
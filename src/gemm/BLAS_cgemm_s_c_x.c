@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
        		enum		blas_trans_type transb, int m, int n, int k,
 		       		const		void  *alpha, const float *a, int lda, const void *b, int ldb,
@@ -70,6 +71,13 @@ void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
  */
 {
   static const char routine_name[] = "BLAS_cgemm_s_c_x";
+
+  /* Large problems go through the packed engine. */
+  if (blas_gemm_engine(order, transa, transb, m, n, k, alpha,
+		       a, blas_gemm_elt_s, lda, b, blas_gemm_elt_c, ldb,
+		       beta, c, blas_gemm_elt_c, ldc, prec))
+    return;
+
   switch (prec) {
 
   case blas_prec_single:{
@@ -394,6 +402,7 @@ void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
 
@@ -1389,20 +1398,10 @@ void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -1413,20 +1412,10 @@ void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -1469,20 +1458,10 @@ void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -1493,20 +1472,10 @@ void		BLAS_cgemm_s_c_x(enum blas_order_type order, enum blas_trans_type transa,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
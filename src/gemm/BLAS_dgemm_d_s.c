@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_dgemm_d_s(enum blas_order_type order, enum blas_trans_type transa,
      		enum		blas_trans_type transb, int m, int n, int k,
 		     		double	alpha , const double *a, int lda, const float *b, int ldb,
@@ -97,6 +98,12 @@ void		BLAS_dgemm_d_s(enum blas_order_type order, enum blas_trans_type transa,
 
 
 
+  /* Large problems go through the packed engine. */
+  if (blas_gemm_engine(order, transa, transb, m, n, k, &alpha,
+		       a, blas_gemm_elt_d, lda, b, blas_gemm_elt_s, ldb,
+		       &beta, c, blas_gemm_elt_d, ldc, blas_prec_double))
+    return;
+
   /* Test for error conditions */
   if (m < 0)
     BLAS_error(routine_name, -4, m, NULL);
@@ -0,0 +1,149 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_batch.h"
+#include "blas_gemm_engine.h"
+
+void BLAS_dgemm_x2(enum blas_order_type order, enum blas_trans_type transa,
+		   enum blas_trans_type transb, int m, int n, int k,
+		   double alpha, const double *a, int lda, const double *b,
+		   int ldb, double beta, double *c_head, double *c_tail,
+		   int ldc)
+/*
+ * Purpose
+ * =======
+ *
+ * This routine computes the matrix product:
+ *
+ *      (C_head, C_tail)  <-  alpha * op(A) * op(B)
+ *                            +  beta * (C_head, C_tail)
+ *
+ * in double-double, as BLAS_dgemm_x does with blas_prec_extra, and
+ * stores each element of C as its two words instead of rounding it to
+ * one double.  C_head + C_tail is the value; C_tail is read only when
+ * beta is nonzero, so the result of one call can feed the next.
+ *
+ * Arguments
+ * =========
+ *
+ * order   (input) enum blas_order_type
+ *         Storage format of input matrices A, B, and C.
+ *
+ * transa  (input) enum blas_trans_type
+ *         Operation to be done on matrix A before multiplication.
+ *
+ * transb  (input) enum blas_trans_type
+ *         Operation to be done on matrix B before multiplication.
+ *
+ * m n k   (input) int
+ *         The dimensions of matrices A, B, and C.
+ *         Matrix C is m-by-n matrix.
+ *         Matrix A is m-by-k if A is not transposed,
+ *                     k-by-m otherwise.
+ *         Matrix B is k-by-n if B is not transposed,
+ *                     n-by-k otherwise.
+ *
+ * alpha   (input) double
+ *
+ * a       (input) const double*
+ *         matrix A.
+ *
+ * lda     (input) int
+ *         leading dimension of A.
+ *
+ * b       (input) const double*
+ *         matrix B
+ *
+ * ldb     (input) int
+ *         leading dimension of B.
+ *
+ * beta    (input) double
+ *
+ * c_head  (input/output) double*
+ * c_tail  (input/output) double*
+ *         The two words of matrix C, both with leading dimension ldc.
+ *
+ * ldc     (input) int
+ *         leading dimension of C.
+ *
+ */
+{
+  static const char routine_name[] = "BLAS_dgemm_x2";
+  int i, j, h, incci, inccij, incai, incaih, incbj, incbhj;
+  FPU_FIX_DECL;
+
+  /* Test for error conditions */
+  if (m < 0)
+    BLAS_error(routine_name, -4, m, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -5, n, NULL);
+  if (k < 0)
+    BLAS_error(routine_name, -6, k, NULL);
+  if (ldc < ((order == blas_colmajor) ? m : n))
+    BLAS_error(routine_name, -15, ldc, NULL);
+  if (lda < (((order == blas_colmajor) == (transa == blas_no_trans)) ?
+	     m : k))
+    BLAS_error(routine_name, -9, lda, NULL);
+  if (ldb < (((order == blas_colmajor) == (transb == blas_no_trans)) ?
+	     k : n))
+    BLAS_error(routine_name, -11, ldb, NULL);
+
+  /* Test for no-op */
+  if (m == 0 || n == 0)
+    return;
+  if ((alpha == 0.0 || k == 0) && beta == 1.0)
+    return;
+
+  /* Everything else goes through the packed engine. */
+  if (blas_gemm_engine_x2(order, transa, transb, m, n, k, &alpha,
+			  a, blas_gemm_elt_d, lda, b, blas_gemm_elt_d, ldb,
+			  &beta, c_head, c_tail, blas_gemm_elt_d, ldc))
+    return;
+
+  /* alpha or k zero, or no memory for the engine: the element loops. */
+  if (order == blas_colmajor) {
+    incci = 1;
+    inccij = ldc;
+  } else {
+    incci = ldc;
+    inccij = 1;
+  }
+  if ((order == blas_colmajor) == (transa == blas_no_trans)) {
+    incai = 1;
+    incaih = lda;
+  } else {
+    incai = lda;
+    incaih = 1;
+  }
+  if ((order == blas_colmajor) == (transb == blas_no_trans)) {
+    incbhj = 1;
+    incbj = ldb;
+  } else {
+    incbhj = ldb;
+    incbj = 1;
+  }
+
+  FPU_FIX_START;
+
+  for (i = 0; i < m; i++) {
+    for (j = 0; j < n; j++) {
+      long cij = (long) i * incci + (long) j * inccij;
+      double head_sum = 0.0, tail_sum = 0.0;
+
+      if (alpha != 0.0) {
+	for (h = 0; h < k; h++) {
+	  double head_prod, tail_prod;
+
+	  blas_dd_two_prod(a[(long) i * incai + (long) h * incaih],
+			   b[(long) h * incbhj + (long) j * incbj],
+			   &head_prod, &tail_prod);
+	  blas_dd_add(head_sum, tail_sum, head_prod, tail_prod,
+		      &head_sum, &tail_sum);
+	}
+      }
+      blas_dd_axpby(alpha, head_sum, tail_sum, beta, &c_head[cij],
+		    &c_tail[cij]);
+    }
+  }
+
+  FPU_FIX_STOP;
+}
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_sgemm_x(enum blas_order_type order, enum blas_trans_type transa,
    		enum		blas_trans_type transb, int m, int n, int k,
 		   		float		alpha , const float *a, int lda, const float *b, int ldb,
@@ -70,6 +71,13 @@ void		BLAS_sgemm_x(enum blas_order_type order, enum blas_trans_type transa,
  */
 {
   static const char routine_name[] = "BLAS_sgemm_x";
+
+  /* Large problems go through the packed engine. */
+  if (blas_gemm_engine(order, transa, transb, m, n, k, &alpha,
+		       a, blas_gemm_elt_s, lda, b, blas_gemm_elt_s, ldb,
+		       &beta, c, blas_gemm_elt_s, ldc, prec))
+    return;
+
   switch (prec) {
 
   case blas_prec_single:{
@@ -356,6 +364,7 @@ void		BLAS_sgemm_x(enum blas_order_type order, enum blas_trans_type transa,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
 
@@ -1023,19 +1032,10 @@ void		BLAS_sgemm_x(enum blas_order_type order, enum blas_trans_type transa,
 	      double	      dt = (double)alpha_i;
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = dt * split;
-		b1 = con - dt;
-		b1 = con - b1;
-		b2 = dt - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * dt;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		c2 = tail_sum * dt;
 		t1 = c11 + c2;
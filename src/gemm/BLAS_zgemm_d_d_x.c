@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
        		enum		blas_trans_type transb, int m, int n, int k,
 		       		const		void  *alpha, const double *a, int lda, const double *b, int ldb,
@@ -70,10 +71,18 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
  */
 {
   static const char routine_name[] = "BLAS_zgemm_d_d_x";
+
+  /* Large problems go through the packed engine. */
+  if (blas_gemm_engine(order, transa, transb, m, n, k, alpha,
+		       a, blas_gemm_elt_d, lda, b, blas_gemm_elt_d, ldb,
+		       beta, c, blas_gemm_elt_z, ldc, prec))
+    return;
+
   switch (prec) {
 
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
 
@@ -545,35 +554,13 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -609,35 +596,13 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -705,19 +670,8 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 
 		} {
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem * split;
-		  b1 = con - b_elem;
-		  b1 = con - b1;
-		  b2 = b_elem - b1;
-
 		  head_prod = a_elem * b_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -785,19 +739,8 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 
 		} {
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem * split;
-		  b1 = con - b_elem;
-		  b1 = con - b1;
-		  b2 = b_elem - b1;
-
 		  head_prod = a_elem * b_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -837,35 +780,13 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[0] * split;
-		  a1 = con - c_elem[0];
-		  a1 = con - a1;
-		  a2 = c_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = c_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[1] * split;
-		  a1 = con - c_elem[1];
-		  a1 = con - a1;
-		  a2 = c_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = c_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -901,35 +822,13 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[1] * split;
-		  a1 = con - c_elem[1];
-		  a1 = con - a1;
-		  a2 = c_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = c_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[0] * split;
-		  a1 = con - c_elem[0];
-		  a1 = con - a1;
-		  a2 = c_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = c_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1070,19 +969,8 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 
 	      } {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem * split;
-		a1 = con - a_elem;
-		a1 = con - a1;
-		a2 = a_elem - a1;
-		con = b_elem * split;
-		b1 = con - b_elem;
-		b1 = con - b1;
-		b2 = b_elem - b1;
-
 		head_prod = a_elem * b_elem;
-		tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -1118,19 +1006,10 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 	      double	      head_t, tail_t;
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i[0], c11);
 
 		c2 = tail_sum * alpha_i[0];
 		t1 = c11 + c2;
@@ -1143,19 +1022,10 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 	      tail_tmp1[0] = tail_t;
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i[1], c11);
 
 		c2 = tail_sum * alpha_i[1];
 		t1 = c11 + c2;
@@ -1176,35 +1046,13 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -1240,35 +1088,13 @@ void		BLAS_zgemm_d_d_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
        		enum		blas_trans_type transb, int m, int n, int k,
 		       		const		void  *alpha, const double *a, int lda, const void *b, int ldb,
@@ -70,10 +71,18 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
  */
 {
   static const char routine_name[] = "BLAS_zgemm_d_z_x";
+
+  /* Large problems go through the packed engine. */
+  if (blas_gemm_engine(order, transa, transb, m, n, k, alpha,
+		       a, blas_gemm_elt_d, lda, b, blas_gemm_elt_z, ldb,
+		       beta, c, blas_gemm_elt_z, ldc, prec))
+    return;
+
   switch (prec) {
 
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
 
@@ -555,35 +564,13 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -619,35 +606,13 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -719,37 +684,15 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 		  double	  head_t, tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem * split;
-		    a1 = con - a_elem;
-		    a1 = con - a1;
-		    a2 = a_elem - a1;
-		    con = b_elem[0] * split;
-		    b1 = con - b_elem[0];
-		    b1 = con - b1;
-		    b2 = b_elem[0] - b1;
-
 		    head_t = a_elem * b_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, b_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem * split;
-		    a1 = con - a_elem;
-		    a1 = con - a1;
-		    a2 = a_elem - a1;
-		    con = b_elem[1] * split;
-		    b1 = con - b_elem[1];
-		    b1 = con - b1;
-		    b2 = b_elem[1] - b1;
-
 		    head_t = a_elem * b_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, b_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
@@ -867,37 +810,15 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 		  double	  head_t, tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem * split;
-		    a1 = con - a_elem;
-		    a1 = con - a1;
-		    a2 = a_elem - a1;
-		    con = b_elem[0] * split;
-		    b1 = con - b_elem[0];
-		    b1 = con - b1;
-		    b2 = b_elem[0] - b1;
-
 		    head_t = a_elem * b_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, b_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem * split;
-		    a1 = con - a_elem;
-		    a1 = con - a1;
-		    a2 = a_elem - a1;
-		    con = b_elem[1] * split;
-		    b1 = con - b_elem[1];
-		    b1 = con - b1;
-		    b2 = b_elem[1] - b1;
-
 		    head_t = a_elem * b_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem, b_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
@@ -986,35 +907,13 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[0] * split;
-		  a1 = con - c_elem[0];
-		  a1 = con - a1;
-		  a2 = c_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = c_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[1] * split;
-		  a1 = con - c_elem[1];
-		  a1 = con - a1;
-		  a2 = c_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = c_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1050,35 +949,13 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[1] * split;
-		  a1 = con - c_elem[1];
-		  a1 = con - a1;
-		  a2 = c_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = c_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[0] * split;
-		  a1 = con - c_elem[0];
-		  a1 = con - a1;
-		  a2 = c_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = c_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1224,37 +1101,15 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 		double		head_t , tail_t;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem[0] * split;
-		  b1 = con - b_elem[0];
-		  b1 = con - b1;
-		  b2 = b_elem[0] - b1;
-
 		  head_t = a_elem * b_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t = BLAS_TWO_PROD_ERR(a_elem, b_elem[0], head_t);
 		}
 		head_prod[0] = head_t;
 		tail_prod[0] = tail_t;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem[1] * split;
-		  b1 = con - b_elem[1];
-		  b1 = con - b1;
-		  b2 = b_elem[1] - b1;
-
 		  head_t = a_elem * b_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t = BLAS_TWO_PROD_ERR(a_elem, b_elem[1], head_t);
 		}
 		head_prod[1] = head_t;
 		tail_prod[1] = tail_t;
@@ -1347,19 +1202,10 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -1370,19 +1216,10 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -1425,19 +1262,10 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -1448,19 +1276,10 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -1509,35 +1328,13 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -1573,35 +1370,13 @@ void		BLAS_zgemm_d_z_x(enum blas_order_type order, enum blas_trans_type transa,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -0,0 +1,1541 @@
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_gemm_engine.h"
+#include "blas_cpu.h"
+#include "blas_threads.h"
+
+/*
+ * Packed GEMM engine.
+ *
+ * Loop nest (outermost first), after Goto & van de Geijn:
+ *
+ *   jc : NC columns of C            B panel KC x NC packed per (jc,ib,pc)
+ *   ib : MB rows of C               accumulators for an MB x NC block
+ *   pc : KC steps of the inner dim
+ *   ic : MC rows                    A block MC x KC packed
+ *   jr, ir : MR x NR micro-kernel   runs over KC with C in registers
+ *
+ * The accumulators are kept in a workspace (double, or head/tail for
+ * blas_prec_extra) across the pc loop and alpha/beta are applied once per
+ * element at the end, in the same order as the reference loops.  Each
+ * accumulator sees its products in increasing h, so the real kernels
+ * round exactly like the i/j/h loops they replace.
+ *
+ * The micro-kernels are in blas_gemm_kernel.c, built once per instruction
+ * set and called through the table of blas_kernels().
+ *
+ * With more than one thread, C is cut into tiles and each tile runs the
+ * loop nest above on its own, with its worker's packing buffers and
+ * accumulators.  The inner dimension is never split, so every element
+ * of C sees the same products in the same order for any tiling, and the
+ * result is bitwise independent of the thread count.
+ */
+
+enum gemm_view {
+  view_real,			/* real operand, used as is              */
+  view_split,			/* complex: re/im as rows (A) or cols (B) */
+  view_block,			/* complex A against complex B: 2x2 block */
+  view_stack			/* complex B against complex A: [re; im]  */
+};
+
+void blas_gemm_operand_init(struct blas_gemm_operand *x, const void *p,
+			    enum blas_gemm_elt_type type,
+			    enum blas_order_type order,
+			    enum blas_trans_type trans, int ld)
+{
+  x->p = p;
+  x->type = type;
+  x->conj = (trans == blas_conj_trans);
+  x->shape = blas_gemm_general;
+  x->diag_conj = 0;
+  if ((order == blas_colmajor) == (trans == blas_no_trans)) {
+    x->rs = 1;
+    x->cs = ld;
+  } else {
+    x->rs = ld;
+    x->cs = 1;
+  }
+}
+
+void blas_gemm_operand_init_sym(struct blas_gemm_operand *x, const void *p,
+				enum blas_gemm_elt_type type,
+				enum blas_gemm_shape shape,
+				enum blas_order_type order,
+				enum blas_side_type side,
+				enum blas_uplo_type uplo, int ld)
+{
+  int herm = (shape == blas_gemm_hermitian);
+
+  x->p = p;
+  x->type = type;
+  x->shape = shape;
+  /* A lower triangle is the upper triangle of the transpose. */
+  if ((order == blas_colmajor) == (uplo == blas_upper)) {
+    x->rs = 1;
+    x->cs = ld;
+  } else {
+    x->rs = ld;
+    x->cs = 1;
+  }
+  x->conj = herm && uplo == blas_lower;
+  /* The reference loops take the diagonal with the half they read it
+     with, which is conjugated unless A is upper on the left or lower on
+     the right. */
+  x->diag_conj = herm && !((side == blas_left_side && uplo == blas_upper)
+			   || (side == blas_right_side
+			       && uplo == blas_lower));
+}
+
+/* Offset of element (i, j); *neg says whether to negate its imaginary
+   part. */
+static long elt_off(const struct blas_gemm_operand *x, int i, int j,
+		    int *neg)
+{
+  *neg = x->conj;
+  if (x->shape != blas_gemm_general && i >= j) {
+    if (i > j) {
+      int t = i;
+
+      i = j;
+      j = t;
+      if (x->shape == blas_gemm_hermitian)
+	*neg = !x->conj;
+    } else if (x->shape == blas_gemm_hermitian) {
+      *neg = x->diag_conj;
+    }
+  }
+  return (long) i * x->rs + (long) j * x->cs;
+}
+
+static double elt_re(const struct blas_gemm_operand *x, int i, int j)
+{
+  int neg;
+  long off = elt_off(x, i, j, &neg);
+
+  switch (x->type) {
+  case blas_gemm_elt_s:
+    return ((const float *) x->p)[off];
+  case blas_gemm_elt_d:
+    return ((const double *) x->p)[off];
+  case blas_gemm_elt_c:
+    return ((const float *) x->p)[2 * off];
+  default:
+    return ((const double *) x->p)[2 * off];
+  }
+}
+
+static double elt_im(const struct blas_gemm_operand *x, int i, int j)
+{
+  int neg;
+  long off = elt_off(x, i, j, &neg);
+  double v;
+
+  switch (x->type) {
+  case blas_gemm_elt_c:
+    v = ((const float *) x->p)[2 * off + 1];
+    break;
+  case blas_gemm_elt_z:
+    v = ((const double *) x->p)[2 * off + 1];
+    break;
+  default:
+    return 0.0;
+  }
+  return neg ? -v : v;
+}
+
+static double view_a(const struct blas_gemm_operand *a, enum gemm_view mode,
+		     int I, int P)
+{
+  switch (mode) {
+  case view_real:
+    return elt_re(a, I, P);
+  case view_split:
+    return (I & 1) ? elt_im(a, I >> 1, P) : elt_re(a, I >> 1, P);
+  default:
+    if ((I & 1) == (P & 1))
+      return elt_re(a, I >> 1, P >> 1);
+    return (I & 1) ? elt_im(a, I >> 1, P >> 1) : -elt_im(a, I >> 1, P >> 1);
+  }
+}
+
+static double view_b(const struct blas_gemm_operand *b, enum gemm_view mode,
+		     int P, int J)
+{
+  switch (mode) {
+  case view_real:
+    return elt_re(b, P, J);
+  case view_split:
+    return (J & 1) ? elt_im(b, P, J >> 1) : elt_re(b, P, J >> 1);
+  default:
+    return (P & 1) ? elt_im(b, P >> 1, J) : elt_re(b, P >> 1, J);
+  }
+}
+
+/* n elements of x from offset off on, inc apart, into re and im (zero
+   for real types), negating im when neg is set. */
+static void load_run(const struct blas_gemm_operand *x, long off, long inc,
+		     int n, int neg, double *re, double *im)
+{
+  double sign = neg ? -1.0 : 1.0;
+  int t;
+
+  switch (x->type) {
+  case blas_gemm_elt_s:
+    for (t = 0; t < n; t++, off += inc) {
+      re[t] = ((const float *) x->p)[off];
+      im[t] = 0.0;
+    }
+    break;
+  case blas_gemm_elt_d:
+    for (t = 0; t < n; t++, off += inc) {
+      re[t] = ((const double *) x->p)[off];
+      im[t] = 0.0;
+    }
+    break;
+  case blas_gemm_elt_c:
+    for (t = 0; t < n; t++, off += inc) {
+      re[t] = ((const float *) x->p)[2 * off];
+      im[t] = sign * ((const float *) x->p)[2 * off + 1];
+    }
+    break;
+  default:
+    for (t = 0; t < n; t++, off += inc) {
+      re[t] = ((const double *) x->p)[2 * off];
+      im[t] = sign * ((const double *) x->p)[2 * off + 1];
+    }
+    break;
+  }
+}
+
+/* len elements of a line of x into re and im: along row 'fixed' from
+   column 'start' on (along_row), or along column 'fixed' from row
+   'start' on.  A symmetric or Hermitian x is read in at most three runs,
+   before, on and after the diagonal, so the block comes out expanded to
+   full with the same values elt_re and elt_im give, but without their
+   per-element tests. */
+static void load_line(const struct blas_gemm_operand *x, int fixed,
+		      int start, int along_row, int len, double *re,
+		      double *im)
+{
+  int herm = (x->shape == blas_gemm_hermitian);
+  int d, n;
+
+  if (x->shape == blas_gemm_general) {
+    if (along_row)
+      load_run(x, (long) fixed * x->rs + (long) start * x->cs, x->cs, len,
+	       x->conj, re, im);
+    else
+      load_run(x, (long) start * x->rs + (long) fixed * x->cs, x->rs, len,
+	       x->conj, re, im);
+    return;
+  }
+
+  /* Before the diagonal the line runs down a stored column (mirrored
+     along a row), after it along a stored row (mirrored down a
+     column). */
+  d = fixed - start;
+  n = MAX(0, MIN(d, len));
+  load_run(x, (long) start * x->rs + (long) fixed * x->cs, x->rs, n,
+	   (herm && along_row) ? !x->conj : x->conj, re, im);
+  if (d >= 0 && d < len)
+    load_run(x, (long) fixed * (x->rs + x->cs), 0, 1,
+	     herm ? x->diag_conj : x->conj, re + d, im + d);
+  n = MAX(0, d + 1);
+  if (n < len)
+    load_run(x, (long) fixed * x->rs + (long) (start + n) * x->cs, x->cs,
+	     len - n, (herm && !along_row) ? !x->conj : x->conj, re + n,
+	     im + n);
+}
+
+/* Pack rows [i0, i0+mc) x cols [p0, p0+kc) of the A view as MR-row
+   micro-panels, zero-padding the last one.  Each view row is read as one
+   line of A. */
+static void pack_a(const struct blas_gemm_operand *a, enum gemm_view mode,
+		   int i0, int mc, int p0, int kc, double *buf)
+{
+  double re[BLAS_GEMM_KC + 1], im[BLAS_GEMM_KC + 1];
+  int ir, r, p, I, e0;
+
+  for (ir = 0; ir < mc; ir += BLAS_GEMM_MR) {
+    for (r = 0; r < BLAS_GEMM_MR; r++) {
+      double *out = buf + r;
+
+      I = i0 + ir + r;
+      if (ir + r >= mc) {
+	for (p = 0; p < kc; p++)
+	  out[p * BLAS_GEMM_MR] = 0.0;
+	continue;
+      }
+      switch (mode) {
+      case view_real:
+	load_line(a, I, p0, 1, kc, re, im);
+	for (p = 0; p < kc; p++)
+	  out[p * BLAS_GEMM_MR] = re[p];
+	break;
+      case view_split:
+	load_line(a, I >> 1, p0, 1, kc, re, im);
+	for (p = 0; p < kc; p++)
+	  out[p * BLAS_GEMM_MR] = (I & 1) ? im[p] : re[p];
+	break;
+      default:
+	/* [re -im; im re]: element columns e0 on cover P = p0.. */
+	e0 = p0 >> 1;
+	load_line(a, I >> 1, e0, 1, ((p0 + kc + 1) >> 1) - e0, re, im);
+	for (p = 0; p < kc; p++) {
+	  int P = p0 + p, e = (P >> 1) - e0;
+
+	  if ((I & 1) == (P & 1))
+	    out[p * BLAS_GEMM_MR] = re[e];
+	  else
+	    out[p * BLAS_GEMM_MR] = (I & 1) ? im[e] : -im[e];
+	}
+	break;
+      }
+    }
+    buf += (long) kc * BLAS_GEMM_MR;
+  }
+}
+
+/* Pack rows [p0, p0+kc) x cols [j0, j0+nc) of the B view as NR-column
+   micro-panels, zero-padding the last one.  Each view column is read as
+   one line of B. */
+static void pack_b(const struct blas_gemm_operand *b, enum gemm_view mode,
+		   int p0, int kc, int j0, int nc, double *buf)
+{
+  double re[BLAS_GEMM_KC + 1], im[BLAS_GEMM_KC + 1];
+  int jr, r, p, J, e0;
+
+  for (jr = 0; jr < nc; jr += BLAS_GEMM_NR) {
+    for (r = 0; r < BLAS_GEMM_NR; r++) {
+      double *out = buf + r;
+
+      J = j0 + jr + r;
+      if (jr + r >= nc) {
+	for (p = 0; p < kc; p++)
+	  out[p * BLAS_GEMM_NR] = 0.0;
+	continue;
+      }
+      switch (mode) {
+      case view_real:
+	load_line(b, J, p0, 0, kc, re, im);
+	for (p = 0; p < kc; p++)
+	  out[p * BLAS_GEMM_NR] = re[p];
+	break;
+      case view_split:
+	load_line(b, J >> 1, p0, 0, kc, re, im);
+	for (p = 0; p < kc; p++)
+	  out[p * BLAS_GEMM_NR] = (J & 1) ? im[p] : re[p];
+	break;
+      default:
+	/* [re; im]: element rows e0 on cover P = p0.. */
+	e0 = p0 >> 1;
+	load_line(b, J, e0, 0, ((p0 + kc + 1) >> 1) - e0, re, im);
+	for (p = 0; p < kc; p++) {
+	  int P = p0 + p, e = (P >> 1) - e0;
+
+	  out[p * BLAS_GEMM_NR] = (P & 1) ? im[e] : re[e];
+	}
+	break;
+      }
+    }
+    buf += (long) kc * BLAS_GEMM_NR;
+  }
+}
+
+/* Scalar of C's type, widened to double. */
+static void load_scalar(const void *s, enum blas_gemm_elt_type type,
+			double v[2])
+{
+  switch (type) {
+  case blas_gemm_elt_s:
+    v[0] = *(const float *) s;
+    v[1] = 0.0;
+    break;
+  case blas_gemm_elt_d:
+    v[0] = *(const double *) s;
+    v[1] = 0.0;
+    break;
+  case blas_gemm_elt_c:
+    v[0] = ((const float *) s)[0];
+    v[1] = ((const float *) s)[1];
+    break;
+  default:
+    v[0] = ((const double *) s)[0];
+    v[1] = ((const double *) s)[1];
+    break;
+  }
+}
+
+/* Accumulator tile and how its rows/columns map onto C. */
+struct gemm_acc {
+  double *head, *tail;
+  int ldt;
+  int tm, tn;			/* view rows/cols per element of C */
+  int di, dj;			/* offset of the imaginary part     */
+  int has_im;
+};
+
+/* Element off of a double or double complex C kept as head and tail
+   words <- alpha * sum + beta * C, left unrounded; C is not read when
+   beta is zero. */
+static void store_x2(const double head_sum[2], const double tail_sum[2],
+		     int has_im, const double alpha[2], const double beta[2],
+		     double *c_head, double *c_tail, long off, int is_complex)
+{
+  double head_tmp1[2], tail_tmp1[2];
+  double head_tmp2[2], tail_tmp2[2];
+  double head_t, tail_t;
+
+  if (!is_complex) {
+    blas_dd_axpby(alpha[0], head_sum[0], tail_sum[0], beta[0],
+		  &c_head[off], &c_tail[off]);
+    return;
+  }
+
+  if (alpha[0] == 1.0 && alpha[1] == 0.0) {
+    head_tmp1[0] = head_sum[0];
+    tail_tmp1[0] = tail_sum[0];
+    head_tmp1[1] = head_sum[1];
+    tail_tmp1[1] = tail_sum[1];
+  } else if (has_im) {
+    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[0],
+		  &head_tmp1[0], &tail_tmp1[0]);
+    blas_dd_mul_d(head_sum[1], tail_sum[1], alpha[1], &head_t, &tail_t);
+    blas_dd_add(head_tmp1[0], tail_tmp1[0], -head_t, -tail_t,
+		&head_tmp1[0], &tail_tmp1[0]);
+    blas_dd_mul_d(head_sum[1], tail_sum[1], alpha[0],
+		  &head_tmp1[1], &tail_tmp1[1]);
+    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[1], &head_t, &tail_t);
+    blas_dd_add(head_tmp1[1], tail_tmp1[1], head_t, tail_t,
+		&head_tmp1[1], &tail_tmp1[1]);
+  } else {
+    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[0],
+		  &head_tmp1[0], &tail_tmp1[0]);
+    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[1],
+		  &head_tmp1[1], &tail_tmp1[1]);
+  }
+
+  if (beta[0] != 0.0 || beta[1] != 0.0) {
+    double *h = c_head + 2 * off, *t = c_tail + 2 * off;
+
+    /* real part */
+    blas_dd_mul_d(h[0], t[0], beta[0], &head_tmp2[0], &tail_tmp2[0]);
+    blas_dd_mul_d(h[1], t[1], beta[1], &head_t, &tail_t);
+    blas_dd_add(head_tmp2[0], tail_tmp2[0], -head_t, -tail_t,
+		&head_tmp2[0], &tail_tmp2[0]);
+    /* imaginary part */
+    blas_dd_mul_d(h[1], t[1], beta[0], &head_tmp2[1], &tail_tmp2[1]);
+    blas_dd_mul_d(h[0], t[0], beta[1], &head_t, &tail_t);
+    blas_dd_add(head_tmp2[1], tail_tmp2[1], head_t, tail_t,
+		&head_tmp2[1], &tail_tmp2[1]);
+
+    blas_dd_add(head_tmp1[0], tail_tmp1[0], head_tmp2[0], tail_tmp2[0],
+		&head_tmp1[0], &tail_tmp1[0]);
+    blas_dd_add(head_tmp1[1], tail_tmp1[1], head_tmp2[1], tail_tmp2[1],
+		&head_tmp1[1], &tail_tmp1[1]);
+  }
+  c_head[2 * off] = head_tmp1[0];
+  c_head[2 * off + 1] = head_tmp1[1];
+  c_tail[2 * off] = tail_tmp1[0];
+  c_tail[2 * off + 1] = tail_tmp1[1];
+}
+
+/* C[i0.., j0..] <- alpha * T + beta * C for an mb x nb block of C
+   elements, rounding each double-double result once, or with c_tail
+   set (extra only) keeping it as C's head and c_tail. */
+static void epilogue(const struct gemm_acc *acc, int i0, int mb, int j0,
+		     int nb, const double alpha[2], const double beta[2],
+		     void *c, double *c_tail, enum blas_gemm_elt_type c_type,
+		     int c_rs, int c_cs, int extra)
+{
+  int is_complex = BLAS_GEMM_ELT_IS_COMPLEX(c_type);
+  int alpha_one = (alpha[0] == 1.0 && alpha[1] == 0.0);
+  int beta_zero = (beta[0] == 0.0 && beta[1] == 0.0);
+  int i, j;
+
+  for (j = 0; j < nb; j++) {
+    for (i = 0; i < mb; i++) {
+      long t_re = (long) (j * acc->tn) * acc->ldt + i * acc->tm;
+      long t_im = t_re + (long) acc->dj * acc->ldt + acc->di;
+      long off = (long) (i0 + i) * c_rs + (long) (j0 + j) * c_cs;
+      double c_elem[2] = { 0.0, 0.0 }, r[2] = { 0.0, 0.0 };
+
+      if (c_tail != NULL) {
+	double head_sum[2], tail_sum[2];
+
+	head_sum[0] = acc->head[t_re];
+	tail_sum[0] = acc->tail[t_re];
+	head_sum[1] = acc->has_im ? acc->head[t_im] : 0.0;
+	tail_sum[1] = acc->has_im ? acc->tail[t_im] : 0.0;
+	store_x2(head_sum, tail_sum, acc->has_im, alpha, beta,
+		 (double *) c, c_tail, off, is_complex);
+	continue;
+      }
+
+      switch (c_type) {
+      case blas_gemm_elt_s:
+	c_elem[0] = ((float *) c)[off];
+	break;
+      case blas_gemm_elt_d:
+	c_elem[0] = ((double *) c)[off];
+	break;
+      case blas_gemm_elt_c:
+	c_elem[0] = ((float *) c)[2 * off];
+	c_elem[1] = ((float *) c)[2 * off + 1];
+	break;
+      default:
+	c_elem[0] = ((double *) c)[2 * off];
+	c_elem[1] = ((double *) c)[2 * off + 1];
+	break;
+      }
+
+      if (!extra) {
+	double sum[2], tmp1[2], tmp2[2];
+
+	sum[0] = acc->head[t_re];
+	sum[1] = acc->has_im ? acc->head[t_im] : 0.0;
+
+	if (!is_complex) {
+	  if (alpha_one && beta_zero) {
+	    r[0] = sum[0];
+	  } else if (alpha_one) {
+	    tmp2[0] = c_elem[0] * beta[0];
+	    r[0] = tmp2[0] + sum[0];
+	  } else {
+	    tmp1[0] = sum[0] * alpha[0];
+	    tmp2[0] = c_elem[0] * beta[0];
+	    r[0] = tmp1[0] + tmp2[0];
+	  }
+	} else if (alpha_one && beta_zero) {
+	  r[0] = sum[0];
+	  r[1] = sum[1];
+	} else {
+	  if (alpha_one) {
+	    tmp1[0] = sum[0];
+	    tmp1[1] = sum[1];
+	  } else if (acc->has_im) {
+	    tmp1[0] = sum[0] * alpha[0] - sum[1] * alpha[1];
+	    tmp1[1] = sum[0] * alpha[1] + sum[1] * alpha[0];
+	  } else {
+	    tmp1[0] = sum[0] * alpha[0];
+	    tmp1[1] = sum[0] * alpha[1];
+	  }
+	  tmp2[0] = c_elem[0] * beta[0] - c_elem[1] * beta[1];
+	  tmp2[1] = c_elem[0] * beta[1] + c_elem[1] * beta[0];
+	  r[0] = tmp1[0] + tmp2[0];
+	  r[1] = tmp1[1] + tmp2[1];
+	}
+      } else {
+	double head_sum[2], tail_sum[2];
+	double head_tmp1[2], tail_tmp1[2];
+	double head_tmp2[2], tail_tmp2[2];
+	double head_t, tail_t;
+
+	head_sum[0] = acc->head[t_re];
+	tail_sum[0] = acc->tail[t_re];
+	head_sum[1] = acc->has_im ? acc->head[t_im] : 0.0;
+	tail_sum[1] = acc->has_im ? acc->tail[t_im] : 0.0;
+
+	if (!is_complex) {
+	  if (alpha_one && beta_zero) {
+	    head_tmp1[0] = head_sum[0];
+	  } else {
+	    if (alpha_one) {
+	      head_tmp1[0] = head_sum[0];
+	      tail_tmp1[0] = tail_sum[0];
+	    } else {
+	      blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[0],
+			    &head_tmp1[0], &tail_tmp1[0]);
+	    }
+	    blas_dd_two_prod(c_elem[0], beta[0], &head_tmp2[0], &tail_tmp2[0]);
+	    blas_dd_add(head_tmp1[0], tail_tmp1[0], head_tmp2[0], tail_tmp2[0],
+			&head_tmp1[0], &tail_tmp1[0]);
+	  }
+	  r[0] = head_tmp1[0];
+	} else if (alpha_one && beta_zero) {
+	  r[0] = head_sum[0];
+	  r[1] = head_sum[1];
+	} else {
+	  if (alpha_one) {
+	    head_tmp1[0] = head_sum[0];
+	    tail_tmp1[0] = tail_sum[0];
+	    head_tmp1[1] = head_sum[1];
+	    tail_tmp1[1] = tail_sum[1];
+	  } else if (acc->has_im) {
+	    /* real part */
+	    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[0],
+			  &head_tmp1[0], &tail_tmp1[0]);
+	    blas_dd_mul_d(head_sum[1], tail_sum[1], alpha[1], &head_t, &tail_t);
+	    blas_dd_add(head_tmp1[0], tail_tmp1[0], -head_t, -tail_t,
+			&head_tmp1[0], &tail_tmp1[0]);
+	    /* imaginary part */
+	    blas_dd_mul_d(head_sum[1], tail_sum[1], alpha[0],
+			  &head_tmp1[1], &tail_tmp1[1]);
+	    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[1], &head_t, &tail_t);
+	    blas_dd_add(head_tmp1[1], tail_tmp1[1], head_t, tail_t,
+			&head_tmp1[1], &tail_tmp1[1]);
+	  } else {
+	    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[0],
+			  &head_tmp1[0], &tail_tmp1[0]);
+	    blas_dd_mul_d(head_sum[0], tail_sum[0], alpha[1],
+			  &head_tmp1[1], &tail_tmp1[1]);
+	  }
+	  /* real part */
+	  blas_dd_two_prod(c_elem[0], beta[0], &head_tmp2[0], &tail_tmp2[0]);
+	  blas_dd_two_prod(c_elem[1], beta[1], &head_t, &tail_t);
+	  blas_dd_add(head_tmp2[0], tail_tmp2[0], -head_t, -tail_t,
+		      &head_tmp2[0], &tail_tmp2[0]);
+	  /* imaginary part */
+	  blas_dd_two_prod(c_elem[1], beta[0], &head_tmp2[1], &tail_tmp2[1]);
+	  blas_dd_two_prod(c_elem[0], beta[1], &head_t, &tail_t);
+	  blas_dd_add(head_tmp2[1], tail_tmp2[1], head_t, tail_t,
+		      &head_tmp2[1], &tail_tmp2[1]);
+
+	  blas_dd_add(head_tmp1[0], tail_tmp1[0], head_tmp2[0], tail_tmp2[0],
+		      &head_tmp1[0], &tail_tmp1[0]);
+	  blas_dd_add(head_tmp1[1], tail_tmp1[1], head_tmp2[1], tail_tmp2[1],
+		      &head_tmp1[1], &tail_tmp1[1]);
+	  r[0] = head_tmp1[0];
+	  r[1] = head_tmp1[1];
+	}
+      }
+
+      switch (c_type) {
+      case blas_gemm_elt_s:
+	((float *) c)[off] = r[0];
+	break;
+      case blas_gemm_elt_d:
+	((double *) c)[off] = r[0];
+	break;
+      case blas_gemm_elt_c:
+	((float *) c)[2 * off] = r[0];
+	((float *) c)[2 * off + 1] = r[1];
+	break;
+      default:
+	((double *) c)[2 * off] = r[0];
+	((double *) c)[2 * off + 1] = r[1];
+	break;
+      }
+    }
+  }
+}
+
+/* Packing buffers and accumulators of one worker. */
+struct gemm_ws {
+  double *apack, *bpack, *head, *tail;
+};
+
+/* One call of the engine, cut into tile_m x tile_n tiles of C. */
+struct gemm_job {
+  const struct blas_gemm_operand *a, *b;
+  const double *apanels;	/* A prepacked, or NULL              */
+  long apanel_rows;		/* view rows of apanels, MR-rounded  */
+  enum gemm_view amode, bmode;
+  struct gemm_acc shape;	/* head and tail come from the worker */
+  int m, n, K;
+  int tile_m, tile_n, tiles_n;
+  double alpha[2], beta[2];
+  void *c;
+  double *c_tail;		/* _x2: C's tail words, or NULL      */
+  enum blas_gemm_elt_type c_type;
+  int c_rs, c_cs;
+  int extra;
+  int exact;			/* extra, with float A and B */
+  const struct blas_kernel_table *kt;
+  struct gemm_ws *ws;
+};
+
+static void ws_free(struct gemm_ws *ws)
+{
+  blas_free(ws->apack);
+  blas_free(ws->bpack);
+  blas_free(ws->head);
+  blas_free(ws->tail);
+}
+
+static int ws_alloc(struct gemm_ws *ws, int extra)
+{
+  ws->apack = (double *) blas_malloc(BLAS_GEMM_MC * BLAS_GEMM_KC *
+				     sizeof(double));
+  ws->bpack = (double *) blas_malloc(BLAS_GEMM_KC * BLAS_GEMM_NC *
+				     sizeof(double));
+  ws->head = (double *) blas_malloc(BLAS_GEMM_MB * BLAS_GEMM_NC *
+				    sizeof(double));
+  ws->tail = extra ? (double *) blas_malloc(BLAS_GEMM_MB * BLAS_GEMM_NC *
+					     sizeof(double)) : NULL;
+  if (ws->apack == NULL || ws->bpack == NULL || ws->head == NULL
+      || (extra && ws->tail == NULL)) {
+    ws_free(ws);
+    return 0;
+  }
+  return 1;
+}
+
+/* The loop nest over the mi x nj block of C at (i0, j0). */
+static void gemm_tile(const struct gemm_job *job, const struct gemm_ws *ws,
+		      int i0, int mi, int j0, int nj)
+{
+  const struct blas_kernel_table *kt = job->kt;
+  struct gemm_acc acc = job->shape;
+  int I0 = i0 * acc.tm, M = mi * acc.tm;
+  int J0 = j0 * acc.tn, N = nj * acc.tn;
+  int K = job->K;
+  int jc, ib, pc, ic, jr, ir;
+
+  acc.head = ws->head;
+  acc.tail = ws->tail;
+
+  for (jc = 0; jc < N; jc += BLAS_GEMM_NC) {
+    int nc = MIN(BLAS_GEMM_NC, N - jc);
+
+    for (ib = 0; ib < M; ib += BLAS_GEMM_MB) {
+      int mb = MIN(BLAS_GEMM_MB, M - ib);
+
+      for (pc = 0; pc < K; pc += BLAS_GEMM_KC) {
+	int kc = MIN(BLAS_GEMM_KC, K - pc);
+
+	pack_b(job->b, job->bmode, pc, kc, J0 + jc, nc, ws->bpack);
+
+	for (ic = 0; ic < mb; ic += BLAS_GEMM_MC) {
+	  int mc = MIN(BLAS_GEMM_MC, mb - ic);
+	  const double *apack = ws->apack;
+
+	  /* Prepacked tiles start on a panel, so a block is a slice. */
+	  if (job->apanels != NULL)
+	    apack = job->apanels + pc * job->apanel_rows
+	      + (long) (I0 + ib + ic) * kc;
+	  else
+	    pack_a(job->a, job->amode, I0 + ib + ic, mc, pc, kc, ws->apack);
+
+	  for (jr = 0; jr < nc; jr += BLAS_GEMM_NR) {
+	    for (ir = 0; ir < mc; ir += BLAS_GEMM_MR) {
+	      long t = (long) jr * acc.ldt + ic + ir;
+
+	      if (job->exact)
+		kt->gemm_kernel_dd_exact(kc, apack + ir * kc,
+					 ws->bpack + jr * kc, acc.head + t,
+					 acc.tail + t, acc.ldt, pc == 0);
+	      else if (job->extra)
+		kt->gemm_kernel_dd(kc, apack + ir * kc,
+				   ws->bpack + jr * kc, acc.head + t,
+				   acc.tail + t, acc.ldt, pc == 0);
+	      else
+		kt->gemm_kernel_d(kc, apack + ir * kc,
+				  ws->bpack + jr * kc, acc.head + t,
+				  acc.ldt, pc == 0);
+	    }
+	  }
+	}
+      }
+
+      epilogue(&acc, i0 + ib / acc.tm, mb / acc.tm, j0 + jc / acc.tn,
+	       nc / acc.tn, job->alpha, job->beta, job->c, job->c_tail,
+	       job->c_type, job->c_rs, job->c_cs, job->extra);
+    }
+  }
+}
+
+static void gemm_task(void *arg, int task, int worker)
+{
+  const struct gemm_job *job = (const struct gemm_job *) arg;
+  int i0 = (task / job->tiles_n) * job->tile_m;
+  int j0 = (task % job->tiles_n) * job->tile_n;
+  FPU_FIX_DECL;
+
+  if (job->extra) {
+    FPU_FIX_START;
+  }
+
+  gemm_tile(job, &job->ws[worker], i0, MIN(job->tile_m, job->m - i0),
+	    j0, MIN(job->tile_n, job->n - j0));
+
+  if (job->extra) {
+    FPU_FIX_STOP;
+  }
+}
+
+/*
+ * Ozaki scheme for blas_prec_extra.
+ *
+ * The real views of A and B are split into slices, A = A_0 + A_1 + ...
+ * by rows and B = B_0 + B_1 + ... by columns, each slice holding at most
+ * 'bits' significant bits per element below the largest element of its
+ * row (column) of what is left.  With 2*bits + log2(K) <= 53 every
+ * A_s * B_t is exact in double, so it runs on the double micro-kernels,
+ * and the products are summed in double-double, smallest first.  The
+ * slices go on until nothing of A and B is left, so the number of them
+ * follows the exponent range of each row and column, and every pair is
+ * summed: the only rounding is that of the double-double sums, which
+ * keeps the XBLAS error bound.  When a row or column needs more than
+ * OZAKI_MAX_SLICES slices the scheme gives up and the double-double
+ * kernels run.
+ */
+
+/* Most slices of A or B; past it the double-double kernels are faster. */
+#define OZAKI_MAX_SLICES 6
+/* Largest |log2| of a slice; beyond it products of slices could leave
+   the normal range. */
+#define OZAKI_MAX_EXP 450
+
+static int method_from_env(void)
+{
+  const char *s = getenv(BLAS_GEMM_EXTRA_ENV);
+
+  if (s != NULL && strcmp(s, "ozaki") == 0)
+    return blas_gemm_extra_ozaki;
+  if (s != NULL && strcmp(s, "auto") == 0)
+    return blas_gemm_extra_auto;
+  return blas_gemm_extra_dd;
+}
+
+#ifndef BLAS_NO_THREADS
+
+#include <pthread.h>
+
+/* The method of all threads, read from the environment once, and the
+   key of the per-thread ones, stored as method + 1 so that NULL is
+   none. */
+static pthread_once_t method_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t method_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t method_key;
+static int method_key_ok = 0;
+static int extra_method;
+
+static void method_init(void)
+{
+  extra_method = method_from_env();
+  method_key_ok = (pthread_key_create(&method_key, NULL) == 0);
+}
+
+void BLAS_set_gemm_extra_method(enum blas_gemm_extra_method method)
+{
+  pthread_once(&method_once, method_init);
+  pthread_mutex_lock(&method_lock);
+  extra_method = method;
+  pthread_mutex_unlock(&method_lock);
+}
+
+int BLAS_set_thread_gemm_extra_method(enum blas_gemm_extra_method method)
+{
+  pthread_once(&method_once, method_init);
+  if (!method_key_ok
+      || pthread_setspecific(method_key, (void *) ((long) method + 1)) != 0)
+    return -1;
+  return 0;
+}
+
+void BLAS_clear_thread_gemm_extra_method(void)
+{
+  pthread_once(&method_once, method_init);
+  if (method_key_ok)
+    pthread_setspecific(method_key, NULL);
+}
+
+enum blas_gemm_extra_method BLAS_get_gemm_extra_method(void)
+{
+  long v = 0;
+  int method;
+
+  pthread_once(&method_once, method_init);
+  if (method_key_ok)
+    v = (long) pthread_getspecific(method_key);
+  if (v != 0)
+    return (enum blas_gemm_extra_method) (v - 1);
+  pthread_mutex_lock(&method_lock);
+  method = extra_method;
+  pthread_mutex_unlock(&method_lock);
+  return (enum blas_gemm_extra_method) method;
+}
+
+#else /* BLAS_NO_THREADS */
+
+/* -1 until the environment has been read or a method set. */
+static int extra_method = -1;
+static int thread_method = -1;
+
+void BLAS_set_gemm_extra_method(enum blas_gemm_extra_method method)
+{
+  extra_method = method;
+}
+
+int BLAS_set_thread_gemm_extra_method(enum blas_gemm_extra_method method)
+{
+  thread_method = method;
+  return 0;
+}
+
+void BLAS_clear_thread_gemm_extra_method(void)
+{
+  thread_method = -1;
+}
+
+enum blas_gemm_extra_method BLAS_get_gemm_extra_method(void)
+{
+  if (thread_method >= 0)
+    return (enum blas_gemm_extra_method) thread_method;
+  if (extra_method < 0)
+    extra_method = method_from_env();
+  return (enum blas_gemm_extra_method) extra_method;
+}
+
+#endif /* BLAS_NO_THREADS */
+
+static int ozaki_wanted(const struct gemm_job *job)
+{
+  switch (BLAS_get_gemm_extra_method()) {
+  case blas_gemm_extra_dd:
+    return 0;
+  case blas_gemm_extra_ozaki:
+    return 1;
+  default:
+    /* Products of floats are exact already, and the direct kernels
+       add them faster. */
+    return !job->exact
+      && job->m * job->shape.tm >= BLAS_GEMM_OZAKI_MIN_DIM
+      && job->n * job->shape.tn >= BLAS_GEMM_OZAKI_MIN_DIM
+      && job->K >= BLAS_GEMM_OZAKI_MIN_DIM;
+  }
+}
+
+/* Splits x, nl lines of len elements with element e of line l at
+   x[l*ls + e*es], into slices of 'bits' bits, slice s at
+   slices + s*size, until x is all zero.  Returns the number of slices,
+   or -1 for an infinity, a NaN, a slice out of range or more than ns
+   slices. */
+static int ozaki_split(double *x, int nl, int len, long ls, long es,
+		       int bits, int ns, double *slices, long size)
+{
+  int s, l, e;
+
+  for (s = 0;; s++) {
+    double *slice = slices + s * size;
+    int live = 0;
+
+    for (l = 0; l < nl; l++) {
+      double *line = x + l * ls, *out = slice + l * ls;
+      double mu = 0.0, sigma;
+      int ex;
+
+      for (e = 0; e < len; e++) {
+	double v = fabs(line[e * es]);
+
+	if (!(v <= DBL_MAX))
+	  return -1;
+	mu = MAX(mu, v);
+      }
+      if (mu == 0.0) {
+	if (s < ns)
+	  for (e = 0; e < len; e++)
+	    out[e * es] = 0.0;
+	continue;
+      }
+      frexp(mu, &ex);
+      if (s == ns || ex > OZAKI_MAX_EXP || ex < -OZAKI_MAX_EXP)
+	return -1;
+      live = 1;
+
+      /* (v + sigma) - sigma rounds v to a multiple of 2^(ex - bits). */
+      sigma = ldexp(0.75, ex - bits + 53);
+      for (e = 0; e < len; e++) {
+	double v = line[e * es], hi = (v + sigma) - sigma;
+
+	out[e * es] = hi;
+	line[e * es] = v - hi;
+      }
+    }
+    if (!live)
+      return s;
+  }
+}
+
+/* The Ozaki product of complex A and complex B, three real products
+   per pair of slices instead of the four of the real views:
+
+     Re C = Ar Br - Ai Bi,   Im C = (Ar + Ai) (Br + Bi) - Ar Br - Ai Bi.
+
+   The real and imaginary parts of a row of A (column of B) are split on
+   one grid, so the sums of their slices are exact, and with a bit less
+   per slice so are the products of the sums.  The Gauss form is safe
+   only here: the double-double kernels would round Ar + Ai to double.
+   Returns as gemm_ozaki. */
+static int gemm_ozaki_3m(const struct gemm_job *job)
+{
+  int m = job->m, n = job->n, k = job->K / 2;
+  long mk = (long) m * k, kn = (long) k * n, mn = (long) m * n, i;
+  struct blas_gemm_operand a_op, b_op;
+  struct gemm_acc acc = job->shape;
+  double one = 1.0, zero = 0.0;
+  double *a, *b, *as, *bs, *asum, *bsum, *prod, *head, *tail;
+  int lg = 0, bits, ns, sa, sb, d, s, t, r, c, p, q, ok = 0;
+  FPU_FIX_DECL;
+
+  while ((1L << lg) < k)
+    lg++;
+  bits = (53 - lg) / 2 - 1;
+  ns = OZAKI_MAX_SLICES;
+
+  /* A as m lines of Ar then Ai, B as n lines of Br then Bi. */
+  a = (double *) blas_malloc(2 * mk * sizeof(double));
+  b = (double *) blas_malloc(2 * kn * sizeof(double));
+  as = (double *) blas_malloc(3 * ns * mk * sizeof(double));
+  bs = (double *) blas_malloc(3 * ns * kn * sizeof(double));
+  prod = (double *) blas_malloc(mn * sizeof(double));
+  head = (double *) blas_malloc(2 * mn * sizeof(double));
+  tail = (double *) blas_malloc(2 * mn * sizeof(double));
+  if (a == NULL || b == NULL || as == NULL || bs == NULL || prod == NULL
+      || head == NULL || tail == NULL)
+    goto done;
+  asum = as + 2 * ns * mk;
+  bsum = bs + 2 * ns * kn;
+
+  for (p = 0; p < k; p++)
+    for (r = 0; r < m; r++) {
+      a[r + (long) p * m] = elt_re(job->a, r, p);
+      a[r + (long) (k + p) * m] = elt_im(job->a, r, p);
+    }
+  for (c = 0; c < n; c++)
+    for (p = 0; p < k; p++) {
+      b[p + (long) c * 2 * k] = elt_re(job->b, p, c);
+      b[k + p + (long) c * 2 * k] = elt_im(job->b, p, c);
+    }
+  sa = ozaki_split(a, m, 2 * k, 1, m, bits, ns, as, 2 * mk);
+  sb = ozaki_split(b, n, 2 * k, 2 * k, 1, bits, ns, bs, 2 * kn);
+  if (sa < 0 || sb < 0)
+    goto done;
+  for (s = 0; s < sa; s++)
+    for (i = 0; i < mk; i++)
+      asum[s * mk + i] = as[2 * s * mk + i] + as[2 * s * mk + mk + i];
+  for (t = 0; t < sb; t++)
+    for (c = 0; c < n; c++)
+      for (p = 0; p < k; p++)
+	bsum[t * kn + p + (long) c * k] = bs[2 * t * kn + p + (long) c * 2 * k]
+	  + bs[2 * t * kn + k + p + (long) c * 2 * k];
+
+  for (i = 0; i < 2 * mn; i++)
+    head[i] = tail[i] = 0.0;
+
+  FPU_FIX_START;
+  ok = 1;
+  for (d = sa + sb - 2; ok && d >= 0; d--) {
+    for (s = MAX(0, d - sb + 1); ok && s <= MIN(d, sa - 1); s++) {
+      t = d - s;
+      /* Ar Br into both parts, Ai Bi out of both, the product of the
+	 sums into the imaginary part. */
+      for (q = 0; ok && q < 3; q++) {
+	if (q < 2) {
+	  blas_gemm_operand_init(&a_op, as + (2 * s + q) * mk,
+				 blas_gemm_elt_d, blas_colmajor,
+				 blas_no_trans, m);
+	  blas_gemm_operand_init(&b_op, bs + 2 * t * kn + q * k,
+				 blas_gemm_elt_d, blas_colmajor,
+				 blas_no_trans, 2 * k);
+	} else {
+	  blas_gemm_operand_init(&a_op, asum + s * mk, blas_gemm_elt_d,
+				 blas_colmajor, blas_no_trans, m);
+	  blas_gemm_operand_init(&b_op, bsum + t * kn, blas_gemm_elt_d,
+				 blas_colmajor, blas_no_trans, k);
+	}
+	ok = blas_gemm_engine_op(m, n, k, &one, &a_op, &b_op, &zero, prod,
+				 blas_gemm_elt_d, 1, m, blas_prec_double);
+	for (i = 0; ok && i < mn; i++) {
+	  if (q < 2)
+	    blas_dd_add_d(head[2 * i], tail[2 * i],
+			  q == 0 ? prod[i] : -prod[i], &head[2 * i],
+			  &tail[2 * i]);
+	  blas_dd_add_d(head[2 * i + 1], tail[2 * i + 1],
+			q == 2 ? prod[i] : -prod[i], &head[2 * i + 1],
+			&tail[2 * i + 1]);
+	}
+      }
+    }
+  }
+  if (ok) {
+    acc.head = head;
+    acc.tail = tail;
+    acc.ldt = 2 * m;
+    epilogue(&acc, 0, m, 0, n, job->alpha, job->beta, job->c, job->c_tail,
+	     job->c_type, job->c_rs, job->c_cs, 1);
+  }
+  FPU_FIX_STOP;
+
+done:
+  blas_free(a);
+  blas_free(b);
+  blas_free(as);
+  blas_free(bs);
+  blas_free(prod);
+  blas_free(head);
+  blas_free(tail);
+  return ok;
+}
+
+/* The whole product of the job by the Ozaki scheme.  Returns 0, leaving
+   C untouched, when memory runs out or the data is out of range or
+   needs too many slices. */
+static int gemm_ozaki(const struct gemm_job *job)
+{
+  int M = job->m * job->shape.tm, N = job->n * job->shape.tn, K = job->K;
+  long mk = (long) M * K, kn = (long) K * N, mn = (long) M * N, i;
+  struct blas_gemm_operand a_op, b_op;
+  struct gemm_acc acc = job->shape;
+  double one = 1.0, zero = 0.0;
+  double *a, *b, *as, *bs, *prod, *head, *tail;
+  int lg = 0, bits, ns, sa, sb, d, s, r, c, p, ok = 0;
+  FPU_FIX_DECL;
+
+  if (job->amode == view_block)
+    return gemm_ozaki_3m(job);
+
+  while ((1L << lg) < K)
+    lg++;
+  bits = (53 - lg) / 2;
+  ns = OZAKI_MAX_SLICES;
+
+  a = (double *) blas_malloc(mk * sizeof(double));
+  b = (double *) blas_malloc(kn * sizeof(double));
+  as = (double *) blas_malloc(ns * mk * sizeof(double));
+  bs = (double *) blas_malloc(ns * kn * sizeof(double));
+  prod = (double *) blas_malloc(mn * sizeof(double));
+  head = (double *) blas_malloc(mn * sizeof(double));
+  tail = (double *) blas_malloc(mn * sizeof(double));
+  if (a == NULL || b == NULL || as == NULL || bs == NULL || prod == NULL
+      || head == NULL || tail == NULL)
+    goto done;
+
+  for (p = 0; p < K; p++)
+    for (r = 0; r < M; r++)
+      a[r + (long) p * M] = view_a(job->a, job->amode, r, p);
+  for (c = 0; c < N; c++)
+    for (p = 0; p < K; p++)
+      b[p + (long) c * K] = view_b(job->b, job->bmode, p, c);
+  sa = ozaki_split(a, M, K, 1, M, bits, ns, as, mk);
+  sb = ozaki_split(b, N, K, K, 1, bits, ns, bs, kn);
+  if (sa < 0 || sb < 0)
+    goto done;
+
+  blas_gemm_operand_init(&a_op, as, blas_gemm_elt_d, blas_colmajor,
+			 blas_no_trans, M);
+  blas_gemm_operand_init(&b_op, bs, blas_gemm_elt_d, blas_colmajor,
+			 blas_no_trans, K);
+  for (i = 0; i < mn; i++)
+    head[i] = tail[i] = 0.0;
+
+  FPU_FIX_START;
+  ok = 1;
+  for (d = sa + sb - 2; ok && d >= 0; d--) {
+    for (s = MAX(0, d - sb + 1); ok && s <= MIN(d, sa - 1); s++) {
+      a_op.p = as + s * mk;
+      b_op.p = bs + (d - s) * kn;
+      ok = blas_gemm_engine_op(M, N, K, &one, &a_op, &b_op, &zero, prod,
+			       blas_gemm_elt_d, 1, M, blas_prec_double);
+      for (i = 0; ok && i < mn; i++)
+	blas_dd_add_d(head[i], tail[i], prod[i], &head[i], &tail[i]);
+    }
+  }
+  if (ok) {
+    acc.head = head;
+    acc.tail = tail;
+    acc.ldt = M;
+    epilogue(&acc, 0, job->m, 0, job->n, job->alpha, job->beta, job->c,
+	     job->c_tail, job->c_type, job->c_rs, job->c_cs, 1);
+  }
+  FPU_FIX_STOP;
+
+done:
+  blas_free(a);
+  blas_free(b);
+  blas_free(as);
+  blas_free(bs);
+  blas_free(prod);
+  blas_free(head);
+  blas_free(tail);
+  return ok;
+}
+
+static int engine_op(int m, int n, int k, const void *alpha,
+		     const struct blas_gemm_operand *a, const double *apanels,
+		     const struct blas_gemm_operand *b,
+		     const void *beta, void *c, double *c_tail,
+		     enum blas_gemm_elt_type c_type, int c_rs, int c_cs,
+		     enum blas_prec_type prec)
+{
+  int a_complex = BLAS_GEMM_ELT_IS_COMPLEX(a->type);
+  int b_complex = BLAS_GEMM_ELT_IS_COMPLEX(b->type);
+  struct gemm_job job;
+  struct gemm_acc *acc = &job.shape;
+  int nthreads, ntiles, nworkers, w;
+
+  job.a = a;
+  job.apanels = apanels;
+  job.b = b;
+  job.m = m;
+  job.n = n;
+  job.c = c;
+  job.c_tail = c_tail;
+  job.c_type = c_type;
+  job.c_rs = c_rs;
+  job.c_cs = c_cs;
+  job.extra = (prec == blas_prec_extra);
+  job.exact = job.extra
+    && (a->type == blas_gemm_elt_s || a->type == blas_gemm_elt_c)
+    && (b->type == blas_gemm_elt_s || b->type == blas_gemm_elt_c);
+  job.kt = blas_kernels();
+  load_scalar(alpha, c_type, job.alpha);
+  load_scalar(beta, c_type, job.beta);
+
+  /* Shape of the real problem and the map back onto C. */
+  job.K = k;
+  job.amode = job.bmode = view_real;
+  acc->head = acc->tail = NULL;
+  acc->ldt = BLAS_GEMM_MB;
+  acc->tm = acc->tn = 1;
+  acc->di = acc->dj = 0;
+  acc->has_im = a_complex || b_complex;
+  if (a_complex && b_complex) {
+    job.amode = view_block;
+    job.bmode = view_stack;
+    job.K = 2 * k;
+    acc->tm = 2;
+    acc->di = 1;
+  } else if (a_complex) {
+    job.amode = view_split;
+    acc->tm = 2;
+    acc->di = 1;
+  } else if (b_complex) {
+    job.bmode = view_split;
+    acc->tn = 2;
+    acc->dj = 1;
+  }
+  job.apanel_rows = ((long) m * acc->tm + BLAS_GEMM_MR - 1)
+    / BLAS_GEMM_MR * BLAS_GEMM_MR;
+
+  /* The tail words of x2 are what the scheme rounds differently, so it
+     serves only the rounded results. */
+  if (job.extra && c_tail == NULL && ozaki_wanted(&job) && gemm_ozaki(&job))
+    return 1;
+
+  /* One tile per call on one thread; otherwise enough tiles that every
+     thread gets a couple. */
+  nthreads = BLAS_get_num_threads();
+  job.tile_m = m;
+  job.tile_n = n;
+  if (nthreads > 1) {
+    job.tile_m = MIN(m, BLAS_GEMM_TILE_M);
+    job.tile_n = MIN(n, BLAS_GEMM_TILE_N);
+    while (((m + job.tile_m - 1) / job.tile_m) *
+	   ((n + job.tile_n - 1) / job.tile_n) < 2 * nthreads) {
+      if (job.tile_n >= job.tile_m && job.tile_n > BLAS_GEMM_TILE_MIN)
+	job.tile_n /= 2;
+      else if (job.tile_m > BLAS_GEMM_TILE_MIN)
+	job.tile_m /= 2;
+      else
+	break;
+    }
+    if (apanels != NULL)
+      job.tile_m = MIN(m, (job.tile_m + BLAS_GEMM_MR - 1)
+		       / BLAS_GEMM_MR * BLAS_GEMM_MR);
+  }
+  job.tiles_n = (n + job.tile_n - 1) / job.tile_n;
+  ntiles = ((m + job.tile_m - 1) / job.tile_m) * job.tiles_n;
+
+  /* All workspaces up front, so a failure leaves C untouched. */
+  nworkers = blas_parallel_workers(ntiles);
+  job.ws = (struct gemm_ws *) blas_malloc(nworkers * sizeof(struct gemm_ws));
+  if (job.ws == NULL)
+    return 0;
+  for (w = 0; w < nworkers; w++) {
+    if (!ws_alloc(&job.ws[w], job.extra)) {
+      while (w-- > 0)
+	ws_free(&job.ws[w]);
+      blas_free(job.ws);
+      return 0;
+    }
+  }
+
+  blas_parallel_for(ntiles, nworkers, gemm_task, &job);
+
+  for (w = 0; w < nworkers; w++)
+    ws_free(&job.ws[w]);
+  blas_free(job.ws);
+  return 1;
+}
+
+int blas_gemm_engine_op(int m, int n, int k, const void *alpha,
+			const struct blas_gemm_operand *a,
+			const struct blas_gemm_operand *b,
+			const void *beta, void *c,
+			enum blas_gemm_elt_type c_type, int c_rs, int c_cs,
+			enum blas_prec_type prec)
+{
+  return engine_op(m, n, k, alpha, a, NULL, b, beta, c, NULL, c_type, c_rs,
+		   c_cs, prec);
+}
+
+int blas_gemm_engine_op_x2(int m, int n, int k, const void *alpha,
+			   const struct blas_gemm_operand *a,
+			   const struct blas_gemm_operand *b,
+			   const void *beta, double *c_head, double *c_tail,
+			   enum blas_gemm_elt_type c_type, int c_rs, int c_cs)
+{
+  return engine_op(m, n, k, alpha, a, NULL, b, beta, c_head, c_tail,
+		   c_type, c_rs, c_cs, blas_prec_extra);
+}
+
+/* The precisions the switches of the callers take, blas_prec_reproducible
+   as double.  Any other value is left to them, and they ignore it. */
+static int prec_known(enum blas_prec_type prec)
+{
+  return prec == blas_prec_single || prec == blas_prec_double
+    || prec == blas_prec_indigenous || prec == blas_prec_extra
+    || prec == blas_prec_reproducible;
+}
+
+static int gemm_engine(enum blas_order_type order,
+		       enum blas_trans_type transa,
+		       enum blas_trans_type transb, int m, int n, int k,
+		       const void *alpha,
+		       const void *a, enum blas_gemm_elt_type a_type, int lda,
+		       const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		       const void *beta, void *c, double *c_tail,
+		       enum blas_gemm_elt_type c_type, int ldc,
+		       enum blas_prec_type prec)
+{
+  struct blas_gemm_operand a_op, b_op;
+  double alpha_v[2];
+  int rows_a, rows_b, rows_c;
+
+  /* Leave errors, no-ops and small problems to the reference code;
+     the _x2 routines have none and send every size here. */
+  if (m <= 0 || n <= 0 || k <= 0)
+    return 0;
+  if (c_tail == NULL && (double) m * n * k < BLAS_GEMM_ENGINE_MIN_FLOPS)
+    return 0;
+  if (!prec_known(prec))
+    return 0;
+  if (order != blas_colmajor && order != blas_rowmajor)
+    return 0;
+
+  if (order == blas_colmajor) {
+    rows_c = m;
+    rows_a = (transa == blas_no_trans) ? m : k;
+    rows_b = (transb == blas_no_trans) ? k : n;
+  } else {
+    rows_c = n;
+    rows_a = (transa == blas_no_trans) ? k : m;
+    rows_b = (transb == blas_no_trans) ? n : k;
+  }
+  if (ldc < rows_c || lda < rows_a || ldb < rows_b)
+    return 0;
+
+  load_scalar(alpha, c_type, alpha_v);
+  if (alpha_v[0] == 0.0 && alpha_v[1] == 0.0)
+    return 0;
+
+  blas_gemm_operand_init(&a_op, a, a_type, order, transa, lda);
+  blas_gemm_operand_init(&b_op, b, b_type, order, transb, ldb);
+
+  if (order == blas_colmajor)
+    return engine_op(m, n, k, alpha, &a_op, NULL, &b_op, beta, c, c_tail,
+		     c_type, 1, ldc, prec);
+  return engine_op(m, n, k, alpha, &a_op, NULL, &b_op, beta, c, c_tail,
+		   c_type, ldc, 1, prec);
+}
+
+int blas_gemm_engine(enum blas_order_type order,
+		     enum blas_trans_type transa,
+		     enum blas_trans_type transb, int m, int n, int k,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_prec_type prec)
+{
+  return gemm_engine(order, transa, transb, m, n, k, alpha, a, a_type, lda,
+		     b, b_type, ldb, beta, c, NULL, c_type, ldc, prec);
+}
+
+int blas_gemm_engine_x2(enum blas_order_type order,
+			enum blas_trans_type transa,
+			enum blas_trans_type transb, int m, int n, int k,
+			const void *alpha,
+			const void *a, enum blas_gemm_elt_type a_type,
+			int lda,
+			const void *b, enum blas_gemm_elt_type b_type,
+			int ldb, const void *beta, double *c_head,
+			double *c_tail, enum blas_gemm_elt_type c_type,
+			int ldc)
+{
+  return gemm_engine(order, transa, transb, m, n, k, alpha, a, a_type, lda,
+		     b, b_type, ldb, beta, c_head, c_tail, c_type, ldc,
+		     blas_prec_extra);
+}
+
+int blas_gemm_pack_a(struct blas_gemm_packed_a *pa, int m, int k,
+		     const struct blas_gemm_operand *a,
+		     enum blas_gemm_elt_type b_type)
+{
+  int a_complex = BLAS_GEMM_ELT_IS_COMPLEX(a->type);
+  enum gemm_view mode = view_real;
+  int M = m, K = k, pc;
+
+  /* The view engine_op takes for this A and B. */
+  pa->b_complex = BLAS_GEMM_ELT_IS_COMPLEX(b_type);
+  if (a_complex && pa->b_complex) {
+    mode = view_block;
+    M = 2 * m;
+    K = 2 * k;
+  } else if (a_complex) {
+    mode = view_split;
+    M = 2 * m;
+  }
+  pa->a = *a;
+  pa->m = m;
+  pa->k = k;
+  pa->rows = ((long) M + BLAS_GEMM_MR - 1) / BLAS_GEMM_MR * BLAS_GEMM_MR;
+  pa->p = (double *) blas_malloc(MAX(1, pa->rows * K) * sizeof(double));
+  if (pa->p == NULL)
+    return 0;
+  for (pc = 0; pc < K; pc += BLAS_GEMM_KC)
+    pack_a(a, mode, 0, M, pc, MIN(BLAS_GEMM_KC, K - pc),
+	   pa->p + pc * pa->rows);
+  return 1;
+}
+
+void blas_gemm_packed_a_free(struct blas_gemm_packed_a *pa)
+{
+  blas_free(pa->p);
+  pa->p = NULL;
+}
+
+int blas_gemm_engine_packed(enum blas_order_type order,
+			    enum blas_trans_type transb, int n,
+			    const void *alpha,
+			    const struct blas_gemm_packed_a *pa,
+			    const void *b, enum blas_gemm_elt_type b_type,
+			    int ldb, const void *beta, void *c,
+			    enum blas_gemm_elt_type c_type, int ldc,
+			    enum blas_prec_type prec)
+{
+  struct blas_gemm_operand b_op;
+  double alpha_v[2];
+  int m = pa->m, k = pa->k, rows_b, rows_c;
+
+  /* The checks of gemm_engine, op(A) being valid already. */
+  if (pa->p == NULL || BLAS_GEMM_ELT_IS_COMPLEX(b_type) != pa->b_complex)
+    return 0;
+  if (m <= 0 || n <= 0 || k <= 0)
+    return 0;
+  if ((double) m * n * k < BLAS_GEMM_ENGINE_MIN_FLOPS)
+    return 0;
+  if (!prec_known(prec))
+    return 0;
+  if (order != blas_colmajor && order != blas_rowmajor)
+    return 0;
+
+  if (order == blas_colmajor) {
+    rows_c = m;
+    rows_b = (transb == blas_no_trans) ? k : n;
+  } else {
+    rows_c = n;
+    rows_b = (transb == blas_no_trans) ? n : k;
+  }
+  if (ldc < rows_c || ldb < rows_b)
+    return 0;
+
+  load_scalar(alpha, c_type, alpha_v);
+  if (alpha_v[0] == 0.0 && alpha_v[1] == 0.0)
+    return 0;
+
+  blas_gemm_operand_init(&b_op, b, b_type, order, transb, ldb);
+
+  if (order == blas_colmajor)
+    return engine_op(m, n, k, alpha, &pa->a, pa->p, &b_op, beta, c, NULL,
+		     c_type, 1, ldc, prec);
+  return engine_op(m, n, k, alpha, &pa->a, pa->p, &b_op, beta, c, NULL,
+		   c_type, ldc, 1, prec);
+}
+
+static int symm_engine(enum blas_order_type order, enum blas_side_type side,
+		       enum blas_uplo_type uplo, int m, int n,
+		       const void *alpha,
+		       const void *a, enum blas_gemm_elt_type a_type, int lda,
+		       const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		       const void *beta,
+		       void *c, enum blas_gemm_elt_type c_type, int ldc,
+		       enum blas_gemm_shape shape, enum blas_prec_type prec)
+{
+  struct blas_gemm_operand a_op, b_op;
+  double alpha_v[2];
+  int c_rs, c_cs;
+
+  /* Leave errors, no-ops and small problems to the reference code. */
+  if (m <= 0 || n <= 0)
+    return 0;
+  if ((double) m * n * (side == blas_left_side ? m : n) <
+      BLAS_GEMM_ENGINE_MIN_FLOPS)
+    return 0;
+  if (!prec_known(prec))
+    return 0;
+  if (order != blas_colmajor && order != blas_rowmajor)
+    return 0;
+  if (side != blas_left_side && side != blas_right_side)
+    return 0;
+  if (uplo != blas_upper && uplo != blas_lower)
+    return 0;
+  if (order == blas_colmajor && (ldb < m || ldc < m))
+    return 0;
+  if (order == blas_rowmajor && (ldb < n || ldc < n))
+    return 0;
+  if (lda < (side == blas_left_side ? m : n))
+    return 0;
+
+  load_scalar(alpha, c_type, alpha_v);
+  if (alpha_v[0] == 0.0 && alpha_v[1] == 0.0)
+    return 0;
+
+  blas_gemm_operand_init_sym(&a_op, a, a_type, shape, order, side, uplo,
+			     lda);
+  blas_gemm_operand_init(&b_op, b, b_type, order, blas_no_trans, ldb);
+  c_rs = (order == blas_colmajor) ? 1 : ldc;
+  c_cs = (order == blas_colmajor) ? ldc : 1;
+
+  if (side == blas_left_side)
+    return blas_gemm_engine_op(m, n, m, alpha, &a_op, &b_op, beta,
+			       c, c_type, c_rs, c_cs, prec);
+  return blas_gemm_engine_op(m, n, n, alpha, &b_op, &a_op, beta,
+			     c, c_type, c_rs, c_cs, prec);
+}
+
+int blas_symm_engine(enum blas_order_type order, enum blas_side_type side,
+		     enum blas_uplo_type uplo, int m, int n,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_prec_type prec)
+{
+  return symm_engine(order, side, uplo, m, n, alpha, a, a_type, lda,
+		     b, b_type, ldb, beta, c, c_type, ldc,
+		     blas_gemm_symmetric, prec);
+}
+
+int blas_hemm_engine(enum blas_order_type order, enum blas_side_type side,
+		     enum blas_uplo_type uplo, int m, int n,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_prec_type prec)
+{
+  return symm_engine(order, side, uplo, m, n, alpha, a, a_type, lda,
+		     b, b_type, ldb, beta, c, c_type, ldc,
+		     blas_gemm_hermitian, prec);
+}
@@ -0,0 +1,36 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_gemm_engine.h"
+#include "blas_cpu.h"
+
+/* Baseline build: whatever CFLAGS allow. */
+#define KNAME(f)	blas_##f##_scalar
+#define KTARGET
+#define KHAVE_FMA	0
+#include "blas_gemm_kernel_body.h"
+#undef KNAME
+#undef KTARGET
+#undef KHAVE_FMA
+
+#ifdef BLAS_CPU_X86
+
+#define KNAME(f)	blas_##f##_sse2
+#define KTARGET		__attribute__((target("sse2")))
+#define KHAVE_FMA	0
+#include "blas_gemm_kernel_body.h"
+#undef KNAME
+#undef KTARGET
+#undef KHAVE_FMA
+
+#define KNAME(f)	blas_##f##_avx2
+#define KTARGET		__attribute__((target("avx2,fma")))
+#define KHAVE_FMA	1
+#include "blas_gemm_kernel_body.h"
+#undef KNAME
+#undef KTARGET
+#undef KHAVE_FMA
+
+/* No AVX-512 copy: blas_cpu.c points that table at the AVX2 kernels. */
+
+#endif /* BLAS_CPU_X86 */
@@ -0,0 +1,109 @@
+/*
+ * Micro-kernels of the packed GEMM engine.
+ *
+ * Included by blas_gemm_kernel.c once per instruction set, with KNAME()
+ * and KTARGET defined and KHAVE_FMA set when the target has a fused
+ * multiply-add.  The loops are written over whole MR x NR tiles so the
+ * compiler keeps the tile in registers and vectorizes it at the width of
+ * the target; the arithmetic, and so the rounding, is the same for
+ * every instruction set.
+ */
+
+#if KHAVE_FMA
+#define KTWO_PROD(a, b, p, e)						\
+  do {									\
+    (p) = (a) * (b);							\
+    (e) = __builtin_fma(a, b, -(p));					\
+  } while (0)
+#else
+#define KTWO_PROD(a, b, p, e) blas_dd_two_prod(a, b, &(p), &(e))
+#endif
+
+/* T[MR x NR] (+)= A_panel * B_panel in double. */
+KTARGET void KNAME(gemm_kernel_d) (int kc, const double *restrict a,
+				   const double *restrict b,
+				   double *restrict t, int ldt, int first)
+{
+  double acc[BLAS_GEMM_NR][BLAS_GEMM_MR];
+  int i, j, p;
+
+  for (j = 0; j < BLAS_GEMM_NR; j++)
+    for (i = 0; i < BLAS_GEMM_MR; i++)
+      acc[j][i] = first ? 0.0 : t[j * ldt + i];
+
+  for (p = 0; p < kc; p++, a += BLAS_GEMM_MR, b += BLAS_GEMM_NR)
+    for (j = 0; j < BLAS_GEMM_NR; j++)
+      for (i = 0; i < BLAS_GEMM_MR; i++)
+	acc[j][i] = acc[j][i] + a[i] * b[j];
+
+  for (j = 0; j < BLAS_GEMM_NR; j++)
+    for (i = 0; i < BLAS_GEMM_MR; i++)
+      t[j * ldt + i] = acc[j][i];
+}
+
+/* (T_head, T_tail)[MR x NR] (+)= A_panel * B_panel in double-double. */
+KTARGET void KNAME(gemm_kernel_dd) (int kc, const double *restrict a,
+				    const double *restrict b,
+				    double *restrict th, double *restrict tt,
+				    int ldt, int first)
+{
+  double head_acc[BLAS_GEMM_NR][BLAS_GEMM_MR];
+  double tail_acc[BLAS_GEMM_NR][BLAS_GEMM_MR];
+  int i, j, p;
+
+  for (j = 0; j < BLAS_GEMM_NR; j++)
+    for (i = 0; i < BLAS_GEMM_MR; i++) {
+      head_acc[j][i] = first ? 0.0 : th[j * ldt + i];
+      tail_acc[j][i] = first ? 0.0 : tt[j * ldt + i];
+    }
+
+  for (p = 0; p < kc; p++, a += BLAS_GEMM_MR, b += BLAS_GEMM_NR)
+    for (j = 0; j < BLAS_GEMM_NR; j++)
+      for (i = 0; i < BLAS_GEMM_MR; i++) {
+	double head_prod, tail_prod;
+
+	KTWO_PROD(a[i], b[j], head_prod, tail_prod);
+	blas_dd_add(head_acc[j][i], tail_acc[j][i], head_prod, tail_prod,
+		    &head_acc[j][i], &tail_acc[j][i]);
+      }
+
+  for (j = 0; j < BLAS_GEMM_NR; j++)
+    for (i = 0; i < BLAS_GEMM_MR; i++) {
+      th[j * ldt + i] = head_acc[j][i];
+      tt[j * ldt + i] = tail_acc[j][i];
+    }
+}
+
+/* gemm_kernel_dd when both panels hold floats: each product is exact
+   in double and is added with the Knuth trick alone, which gives the
+   sums of gemm_kernel_dd with its zero tails. */
+KTARGET void KNAME(gemm_kernel_dd_exact) (int kc, const double *restrict a,
+					  const double *restrict b,
+					  double *restrict th,
+					  double *restrict tt, int ldt,
+					  int first)
+{
+  double head_acc[BLAS_GEMM_NR][BLAS_GEMM_MR];
+  double tail_acc[BLAS_GEMM_NR][BLAS_GEMM_MR];
+  int i, j, p;
+
+  for (j = 0; j < BLAS_GEMM_NR; j++)
+    for (i = 0; i < BLAS_GEMM_MR; i++) {
+      head_acc[j][i] = first ? 0.0 : th[j * ldt + i];
+      tail_acc[j][i] = first ? 0.0 : tt[j * ldt + i];
+    }
+
+  for (p = 0; p < kc; p++, a += BLAS_GEMM_MR, b += BLAS_GEMM_NR)
+    for (j = 0; j < BLAS_GEMM_NR; j++)
+      for (i = 0; i < BLAS_GEMM_MR; i++)
+	blas_dd_add_d(head_acc[j][i], tail_acc[j][i], a[i] * b[j],
+		      &head_acc[j][i], &tail_acc[j][i]);
+
+  for (j = 0; j < BLAS_GEMM_NR; j++)
+    for (i = 0; i < BLAS_GEMM_MR; i++) {
+      th[j * ldt + i] = head_acc[j][i];
+      tt[j * ldt + i] = tail_acc[j][i];
+    }
+}
+
+#undef KTWO_PROD
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		       		int		m       , int n, const void *alpha, const float *a, int lda,
 		       		const		void  *x, int incx, const void *beta, void *y,
@@ -267,6 +268,7 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -492,6 +494,7 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -545,6 +548,20 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = NULL;
+      if (incai == 1 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_s, incaij, 0,
+				   x_i + kx, blas_gemm_elt_c, incx / 2);
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 1
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_s, incai, 0,
+				   x_i + kx, blas_gemm_elt_c, incx / 2, 0);
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -617,92 +634,81 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem[0] = x_i[jx];
-		x_elem[1] = x_i[jx + 1];
-		{
-		  head_prod[0] = (double)x_elem[0] * a_elem;
-		  tail_prod[0] = 0.0;
-		  head_prod[1] = (double)x_elem[1] * a_elem;
-		  tail_prod[1] = 0.0;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+	      if (col_sum != NULL) {
+		head_sum[0] = col_sum[4 * i];
+		head_sum[1] = col_sum[4 * i + 1];
+		tail_sum[0] = col_sum[4 * i + 2];
+		tail_sum[1] = col_sum[4 * i + 3];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem[0] = x_i[jx];
+		  x_elem[1] = x_i[jx + 1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_prod[0] = (double)x_elem[0] * a_elem;
+		    tail_prod[0] = 0.0;
+		    head_prod[1] = (double)x_elem[1] * a_elem;
+		    tail_prod[1] = 0.0;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      y_i[iy] = head_sum[0];
 	      y_i[iy + 1] = head_sum[1];
@@ -716,92 +722,81 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem[0] = x_i[jx];
-		x_elem[1] = x_i[jx + 1];
-		{
-		  head_prod[0] = (double)x_elem[0] * a_elem;
-		  tail_prod[0] = 0.0;
-		  head_prod[1] = (double)x_elem[1] * a_elem;
-		  tail_prod[1] = 0.0;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+	      if (col_sum != NULL) {
+		head_sum[0] = col_sum[4 * i];
+		head_sum[1] = col_sum[4 * i + 1];
+		tail_sum[0] = col_sum[4 * i + 2];
+		tail_sum[1] = col_sum[4 * i + 3];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem[0] = x_i[jx];
+		  x_elem[1] = x_i[jx + 1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_prod[0] = (double)x_elem[0] * a_elem;
+		    tail_prod[0] = 0.0;
+		    head_prod[1] = (double)x_elem[1] * a_elem;
+		    tail_prod[1] = 0.0;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		double		cd      [2];
@@ -820,20 +815,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -844,20 +829,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -900,20 +875,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -924,20 +889,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -992,92 +947,81 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	    head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
 	    aij = ai;
 	    jx = kx;
-	    for (j = 0; j < lenx; j++) {
-	      a_elem = a_i[aij];
+	    if (col_sum != NULL) {
+	      head_sum[0] = col_sum[4 * i];
+	      head_sum[1] = col_sum[4 * i + 1];
+	      tail_sum[0] = col_sum[4 * i + 2];
+	      tail_sum[1] = col_sum[4 * i + 3];
+	    } else {
+	      for (j = 0; j < lenx; j++) {
+		a_elem = a_i[aij];
 
-	      x_elem[0] = x_i[jx];
-	      x_elem[1] = x_i[jx + 1];
-	      {
-		head_prod[0] = (double)x_elem[0] * a_elem;
-		tail_prod[0] = 0.0;
-		head_prod[1] = (double)x_elem[1] * a_elem;
-		tail_prod[1] = 0.0;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		x_elem[0] = x_i[jx];
+		x_elem[1] = x_i[jx + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  head_prod[0] = (double)x_elem[0] * a_elem;
+		  tail_prod[0] = 0.0;
+		  head_prod[1] = (double)x_elem[1] * a_elem;
+		  tail_prod[1] = 0.0;
 		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sum[0];
+		  tail_a = tail_sum[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
 
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		  s2 += t1;
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[0] = head_t;
+		  tail_sum[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sum[1];
+		  tail_a = tail_sum[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		  t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[1] = head_t;
+		  tail_sum[1] = tail_t;
 		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
+		aij += incaij;
+		jx += incx;
 	      }
-	      aij += incaij;
-	      jx += incx;
 	    }
 	    {
 	      double	      cd [2];
@@ -1096,20 +1040,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		  c2 = tail_a0 * cd[0];
 		  t1 = c11 + c2;
@@ -1120,20 +1054,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		  c2 = tail_a1 * cd[1];
 		  t1 = c11 + c2;
@@ -1176,20 +1100,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = cd[0] * split;
-		  b1 = con - cd[0];
-		  b1 = con - b1;
-		  b2 = cd[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * cd[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		  c2 = tail_a1 * cd[0];
 		  t1 = c11 + c2;
@@ -1200,20 +1114,10 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = cd[1] * split;
-		  b1 = con - cd[1];
-		  b1 = con - b1;
-		  b2 = cd[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * cd[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		  c2 = tail_a0 * cd[1];
 		  t1 = c11 + c2;
@@ -1379,6 +1283,7 @@ void		BLAS_cgemv_s_c_x(enum blas_order_type order, enum blas_trans_type trans,
 
       }
 
+      blas_free(col_sum);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		       		int		m       , int n, const void *alpha, const float *a, int lda,
 		       		const		float *x, int incx, const void *beta, void *y,
@@ -252,6 +253,7 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -464,6 +466,7 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum, tail_sum;
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -517,6 +520,20 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = NULL;
+      if (incai == 1 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_s, incaij, 0,
+				   x_i + kx, blas_gemm_elt_s, incx);
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 1
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_s, incai, 0,
+				   x_i + kx, blas_gemm_elt_s, incx, 0);
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -589,41 +606,37 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum = tail_sum = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = x_i[jx];
-		head_prod = (double)a_elem *x_elem;
-		tail_prod = 0.0;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
+	      if (col_sum != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = x_i[jx];
+		  head_prod = (double)a_elem *x_elem;
+		  tail_prod = 0.0;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      head_tmp1[0] = head_sum;
 	      tail_tmp1[0] = tail_sum;
@@ -640,41 +653,37 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum = tail_sum = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = x_i[jx];
-		head_prod = (double)a_elem *x_elem;
-		tail_prod = 0.0;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
+	      if (col_sum != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = x_i[jx];
+		  head_prod = (double)a_elem *x_elem;
+		  tail_prod = 0.0;
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		double		head_e1, tail_e1;
@@ -682,20 +691,10 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		dt = (double)alpha_i[0];
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_sum * split;
-		  a11 = con - head_sum;
-		  a11 = con - a11;
-		  a21 = head_sum - a11;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_sum * dt;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		  c2 = tail_sum * dt;
 		  t1 = c11 + c2;
@@ -709,20 +708,10 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		dt = (double)alpha_i[1];
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_sum * split;
-		  a11 = con - head_sum;
-		  a11 = con - a11;
-		  a21 = head_sum - a11;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_sum * dt;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		  c2 = tail_sum * dt;
 		  t1 = c11 + c2;
@@ -748,41 +737,37 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	    head_sum = tail_sum = 0.0;;
 	    aij = ai;
 	    jx = kx;
-	    for (j = 0; j < lenx; j++) {
-	      a_elem = a_i[aij];
-
-	      x_elem = x_i[jx];
-	      head_prod = (double)a_elem *x_elem;
-	      tail_prod = 0.0;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
+	    if (col_sum != NULL) {
+	      head_sum = col_sum[2 * i];
+	      tail_sum = col_sum[2 * i + 1];
+	    } else {
+	      for (j = 0; j < lenx; j++) {
+		a_elem = a_i[aij];
 
-		s2 += t1;
+		x_elem = x_i[jx];
+		head_prod = (double)a_elem *x_elem;
+		tail_prod = 0.0;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		t2 += s2;
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
 
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
+		aij += incaij;
+		jx += incx;
 	      }
-	      aij += incaij;
-	      jx += incx;
 	    }
 	    {
 	      double	      head_e1, tail_e1;
@@ -790,19 +775,10 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	      dt = (double)alpha_i[0];
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = dt * split;
-		b1 = con - dt;
-		b1 = con - b1;
-		b2 = dt - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * dt;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		c2 = tail_sum * dt;
 		t1 = c11 + c2;
@@ -816,19 +792,10 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	      dt = (double)alpha_i[1];
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = dt * split;
-		b1 = con - dt;
-		b1 = con - b1;
-		b2 = dt - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * dt;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		c2 = tail_sum * dt;
 		t1 = c11 + c2;
@@ -965,6 +932,7 @@ void		BLAS_cgemv_s_s_x(enum blas_order_type order, enum blas_trans_type trans,
 
       }
 
+      blas_free(col_sum);
       FPU_FIX_STOP;
     }
     break;
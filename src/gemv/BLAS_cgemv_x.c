@@ -1,5 +1,7 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		   		int		m       , int n, const void *alpha, const void *a, int lda,
 		   		const		void  *x, int incx, const void *beta, void *y,
@@ -387,6 +389,7 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -710,6 +713,8 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       int	      lenx , leny;
       int	      ai   , aij;
       int	      incai, incaij;
+      int	      unit_stride;
+      enum blas_conj_type conj;
 
       const float    *a_i = (float *)a;
       const float    *x_i = (float *)x;
@@ -723,6 +728,7 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -776,6 +782,28 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Rows of op(A) that are contiguous go through the vector dot. */
+      unit_stride = (incaij == 2 && incx == 2 && blas_dd_vec_enabled());
+      conj = (trans == blas_conj_trans) ? blas_conj : blas_no_conj;
+
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = NULL;
+      if (incai == 2
+	  && !unit_stride
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				   incaij / 2, trans == blas_conj_trans,
+				   x_i + kx, blas_gemm_elt_c, incx / 2);
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c, incai / 2,
+				   trans == blas_conj_trans, x_i + kx,
+				   blas_gemm_elt_c, incx / 2, unit_stride);
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -849,134 +877,120 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		y_i[iy] = head_sum[0];
 		y_i[iy + 1] = head_sum[1];
@@ -990,134 +1004,120 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -1139,20 +1139,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -1163,20 +1153,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -1222,20 +1202,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -1246,20 +1216,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -1317,128 +1277,120 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem[0] = x_i[jx];
-		x_elem[1] = x_i[jx + 1];
-		{
-		  double	  head_e1, tail_e1;
-		  double	  d1;
-		  double	  d2;
-		  /* Real part */
-		  d1 = (double)a_elem[0] * x_elem[0];
-		  d2 = (double)-a_elem[1] * x_elem[1];
+	      if (col_sum != NULL) {
+		head_sum[0] = col_sum[4 * i];
+		head_sum[1] = col_sum[4 * i + 1];
+		tail_sum[0] = col_sum[4 * i + 2];
+		tail_sum[1] = col_sum[4 * i + 3];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				  head_sum, tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+		  a_elem[1] = -a_elem[1];
+		  x_elem[0] = x_i[jx];
+		  x_elem[1] = x_i[jx + 1];
 		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
+		    double	  head_e1, tail_e1;
+		    double	  d1;
+		    double	  d2;
+		    /* Real part */
+		    d1 = (double)a_elem[0] * x_elem[0];
+		    d2 = (double)-a_elem[1] * x_elem[1];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[0] = head_e1;
-		  tail_prod[0] = tail_e1;
-		  /* imaginary part */
-		  d1 = (double)a_elem[0] * x_elem[1];
-		  d2 = (double)a_elem[1] * x_elem[0];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[0] = head_e1;
+		    tail_prod[0] = tail_e1;
+		    /* imaginary part */
+		    d1 = (double)a_elem[0] * x_elem[1];
+		    d2 = (double)a_elem[1] * x_elem[0];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[1] = head_e1;
-		  tail_prod[1] = tail_e1;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[1] = head_e1;
+		    tail_prod[1] = tail_e1;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		double		cd      [2];
@@ -1457,20 +1409,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1481,20 +1423,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1537,20 +1469,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1561,20 +1483,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1750,134 +1662,120 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		y_i[iy] = head_sum[0];
 		y_i[iy + 1] = head_sum[1];
@@ -1891,134 +1789,120 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -2040,20 +1924,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2064,20 +1938,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2123,20 +1987,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2147,20 +2001,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2218,128 +2062,120 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-
-		x_elem[0] = x_i[jx];
-		x_elem[1] = x_i[jx + 1];
-		{
-		  double	  head_e1, tail_e1;
-		  double	  d1;
-		  double	  d2;
-		  /* Real part */
-		  d1 = (double)a_elem[0] * x_elem[0];
-		  d2 = (double)-a_elem[1] * x_elem[1];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[0] = head_e1;
-		  tail_prod[0] = tail_e1;
-		  /* imaginary part */
-		  d1 = (double)a_elem[0] * x_elem[1];
-		  d2 = (double)a_elem[1] * x_elem[0];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+	      if (col_sum != NULL) {
+		head_sum[0] = col_sum[4 * i];
+		head_sum[1] = col_sum[4 * i + 1];
+		tail_sum[0] = col_sum[4 * i + 2];
+		tail_sum[1] = col_sum[4 * i + 3];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				  head_sum, tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
 
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[1] = head_e1;
-		  tail_prod[1] = tail_e1;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  x_elem[0] = x_i[jx];
+		  x_elem[1] = x_i[jx + 1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    double	  head_e1, tail_e1;
+		    double	  d1;
+		    double	  d2;
+		    /* Real part */
+		    d1 = (double)a_elem[0] * x_elem[0];
+		    d2 = (double)-a_elem[1] * x_elem[1];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    s2 += t1;
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[0] = head_e1;
+		    tail_prod[0] = tail_e1;
+		    /* imaginary part */
+		    d1 = (double)a_elem[0] * x_elem[1];
+		    d2 = (double)a_elem[1] * x_elem[0];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    t2 += s2;
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[1] = head_e1;
+		    tail_prod[1] = tail_e1;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		double		cd      [2];
@@ -2358,20 +2194,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -2382,20 +2208,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -2438,20 +2254,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -2462,20 +2268,10 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -2642,6 +2438,7 @@ void		BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
       FPU_FIX_STOP;
     }
     break;
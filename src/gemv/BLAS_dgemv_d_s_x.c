@@ -1,5 +1,7 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_gemv_cols.h"
 void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		       		int		m       , int n, double alpha, const double *a, int lda,
 			const		float *x, int incx, double beta, double *y,
@@ -59,6 +61,7 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -236,6 +239,7 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
       int	      lenx , leny;
       int	      ai   , aij;
       int	      incai, incaij;
+      int	      unit_stride;
 
       const double   *a_i = a;
       const float    *x_i = x;
@@ -249,6 +253,7 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum, tail_sum;
       double	      head_tmp1, tail_tmp1;
       double	      head_tmp2, tail_tmp2;
+      double         *col_sum;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -302,6 +307,22 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Rows of op(A) that are contiguous go through the vector dot. */
+      unit_stride = (incaij == 1 && incx == 1 && blas_dd_vec_enabled());
+
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = NULL;
+      if (incai == 1 && !unit_stride && alpha_i != 0.0)
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_d, incaij, 0,
+				   x_i + kx, blas_gemm_elt_s, incx);
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL && incaij == 1 && alpha_i != 0.0)
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_d, incai, 0,
+				   x_i + kx, blas_gemm_elt_s, incx,
+				   unit_stride);
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i == 0.0) {
 	if (beta_i == 0.0) {
@@ -316,19 +337,8 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	    y_elem = y_i[iy];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem * split;
-	      a1 = con - y_elem;
-	      a1 = con - a1;
-	      a2 = y_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp1 = y_elem * beta_i;
-	      tail_tmp1 = (((a1 * b1 - head_tmp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp1 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp1);
 	    }
 	    y_i[iy] = head_tmp1;
 	    iy += incy;
@@ -346,58 +356,46 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum = tail_sum = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = x_i[jx];
-		{
-		  double	  dt = (double)x_elem;
+	      if (col_sum != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 0, x_i, 1, 0, blas_no_conj,
+				  &head_sum, &tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = x_i[jx];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem * split;
-		    a1 = con - a_elem;
-		    a1 = con - a1;
-		    a2 = a_elem - a1;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
-
-		    head_prod = a_elem * dt;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    double	  dt = (double)x_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = a_elem * dt;
+		      tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		    }
 		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      y_i[iy] = head_sum;
 	      ai += incai;
@@ -410,74 +408,53 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum = tail_sum = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = x_i[jx];
-		{
-		  double	  dt = (double)x_elem;
+	      if (col_sum != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 0, x_i, 1, 0, blas_no_conj,
+				  &head_sum, &tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = x_i[jx];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem * split;
-		    a1 = con - a_elem;
-		    a1 = con - a1;
-		    a2 = a_elem - a1;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
-
-		    head_prod = a_elem * dt;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    double	  dt = (double)x_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = a_elem * dt;
+		      tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		    }
 		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 		c2 = tail_sum * alpha_i;
 		t1 = c11 + c2;
@@ -499,74 +476,53 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	    head_sum = tail_sum = 0.0;;
 	    aij = ai;
 	    jx = kx;
-	    for (j = 0; j < lenx; j++) {
-	      a_elem = a_i[aij];
+	    if (col_sum != NULL) {
+	      head_sum = col_sum[2 * i];
+	      tail_sum = col_sum[2 * i + 1];
+	    } else if (unit_stride)
+	      blas_dot_x_kernel(lenx, a_i + ai, 0, x_i, 1, 0, blas_no_conj,
+				&head_sum, &tail_sum);
+	    else {
+	      for (j = 0; j < lenx; j++) {
+		a_elem = a_i[aij];
 
-	      x_elem = x_i[jx];
-	      {
-		double		dt = (double)x_elem;
+		x_elem = x_i[jx];
 		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
-		  head_prod = a_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  double		dt = (double)x_elem;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * dt;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, dt, head_prod);
+		  }
 		}
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		t2 += s2;
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
 
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
+		aij += incaij;
+		jx += incx;
 	      }
-	      aij += incaij;
-	      jx += incx;
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sum * split;
-	      a11 = con - head_sum;
-	      a11 = con - a11;
-	      a21 = head_sum - a11;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sum * alpha_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 	      c2 = tail_sum * alpha_i;
 	      t1 = c11 + c2;
@@ -578,19 +534,8 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	    y_elem = y_i[iy];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem * split;
-	      a1 = con - y_elem;
-	      a1 = con - a1;
-	      a2 = y_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp2 = y_elem * beta_i;
-	      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp2 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
@@ -627,6 +572,7 @@ void		BLAS_dgemv_d_s_x(enum blas_order_type order, enum blas_trans_type trans,
 
       }
 
+      blas_free(col_sum);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,8 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_gemv_cols.h"
+#include "blas_repro.h"
 void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		   		int		m       , int n, double alpha, const double *a, int lda,
    		const		double *x, int incx, double beta, double *y,
@@ -52,6 +55,9 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
  *        = blas_prec_extra : anything at least 1.5 times as accurate
  *                            than double, and wider than 80-bits.
  *                            We use double-double in our implementation.
+ *        = blas_prec_reproducible: double precision, summed so that
+ *                            the result is bitwise the same for any
+ *                            vector width, blocking or thread count.
  *
  */
 {
@@ -236,6 +242,7 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       int	      lenx , leny;
       int	      ai   , aij;
       int	      incai, incaij;
+      int	      unit_stride;
 
       const double   *a_i = a;
       const double   *x_i = x;
@@ -249,6 +256,7 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum, tail_sum;
       double	      head_tmp1, tail_tmp1;
       double	      head_tmp2, tail_tmp2;
+      double         *col_sum;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -302,6 +310,22 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Rows of op(A) that are contiguous go through the vector dot. */
+      unit_stride = (incaij == 1 && incx == 1 && blas_dd_vec_enabled());
+
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = NULL;
+      if (incai == 1 && !unit_stride && alpha_i != 0.0)
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_d, incaij, 0,
+				   x_i + kx, blas_gemm_elt_d, incx);
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL && incaij == 1 && alpha_i != 0.0)
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_d, incai, 0,
+				   x_i + kx, blas_gemm_elt_d, incx,
+				   unit_stride);
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i == 0.0) {
 	if (beta_i == 0.0) {
@@ -316,19 +340,8 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	    y_elem = y_i[iy];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem * split;
-	      a1 = con - y_elem;
-	      a1 = con - a1;
-	      a2 = y_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp1 = y_elem * beta_i;
-	      tail_tmp1 = (((a1 * b1 - head_tmp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp1 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp1);
 	    }
 	    y_i[iy] = head_tmp1;
 	    iy += incy;
@@ -346,55 +359,43 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum = tail_sum = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = x_i[jx];
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem * split;
-		  b1 = con - x_elem;
-		  b1 = con - b1;
-		  b2 = x_elem - b1;
-
-		  head_prod = a_elem * x_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+	      if (col_sum != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 0, x_i, 0, 0, blas_no_conj,
+				  &head_sum, &tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = x_i[jx];
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * x_elem;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, x_elem, head_prod);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      y_i[iy] = head_sum;
 	      ai += incai;
@@ -407,71 +408,50 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum = tail_sum = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = x_i[jx];
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = x_elem * split;
-		  b1 = con - x_elem;
-		  b1 = con - b1;
-		  b2 = x_elem - b1;
-
-		  head_prod = a_elem * x_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
+	      if (col_sum != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 0, x_i, 0, 0, blas_no_conj,
+				  &head_sum, &tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = x_i[jx];
+		  {
+		    /* Compute double_double = double * double. */
+		    head_prod = a_elem * x_elem;
+		    tail_prod = BLAS_TWO_PROD_ERR(a_elem, x_elem, head_prod);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 		c2 = tail_sum * alpha_i;
 		t1 = c11 + c2;
@@ -493,71 +473,50 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	    head_sum = tail_sum = 0.0;;
 	    aij = ai;
 	    jx = kx;
-	    for (j = 0; j < lenx; j++) {
-	      a_elem = a_i[aij];
-
-	      x_elem = x_i[jx];
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem * split;
-		a1 = con - a_elem;
-		a1 = con - a1;
-		a2 = a_elem - a1;
-		con = x_elem * split;
-		b1 = con - x_elem;
-		b1 = con - b1;
-		b2 = x_elem - b1;
-
-		head_prod = a_elem * x_elem;
-		tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
+	    if (col_sum != NULL) {
+	      head_sum = col_sum[2 * i];
+	      tail_sum = col_sum[2 * i + 1];
+	    } else if (unit_stride)
+	      blas_dot_x_kernel(lenx, a_i + ai, 0, x_i, 0, 0, blas_no_conj,
+				&head_sum, &tail_sum);
+	    else {
+	      for (j = 0; j < lenx; j++) {
+		a_elem = a_i[aij];
 
-		s2 += t1;
+		x_elem = x_i[jx];
+		{
+		  /* Compute double_double = double * double. */
+		  head_prod = a_elem * x_elem;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, x_elem, head_prod);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		t2 += s2;
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
 
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
+		aij += incaij;
+		jx += incx;
 	      }
-	      aij += incaij;
-	      jx += incx;
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sum * split;
-	      a11 = con - head_sum;
-	      a11 = con - a11;
-	      a21 = head_sum - a11;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sum * alpha_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 	      c2 = tail_sum * alpha_i;
 	      t1 = c11 + c2;
@@ -569,19 +528,8 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 	    y_elem = y_i[iy];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem * split;
-	      a1 = con - y_elem;
-	      a1 = con - a1;
-	      a2 = y_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp2 = y_elem * beta_i;
-	      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp2 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
@@ -618,8 +566,88 @@ void		BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 
       }
 
+      blas_free(col_sum);
       FPU_FIX_STOP;
     }
     break;
+  case blas_prec_reproducible:{
+
+      int	      i    , i0, rows;
+      int	      iy   , kx, ky;
+      int	      lenx , leny;
+      int	      incai, incaij;
+      double	      sum[BLAS_REPRO_ROWS];
+      FPU_FIX_DECL;
+
+      /* all error calls */
+      if (m < 0)
+	BLAS_error(routine_name, -3, m, 0);
+      else if (n <= 0)
+	BLAS_error(routine_name, -4, n, 0);
+      else if (incx == 0)
+	BLAS_error(routine_name, -9, incx, 0);
+      else if (incy == 0)
+	BLAS_error(routine_name, -12, incy, 0);
+
+      if ((order == blas_rowmajor) && (trans == blas_no_trans)) {
+	lenx = n;
+	leny = m;
+	incai = lda;
+	incaij = 1;
+      } else if ((order == blas_rowmajor) && (trans != blas_no_trans)) {
+	lenx = m;
+	leny = n;
+	incai = 1;
+	incaij = lda;
+      } else if ((order == blas_colmajor) && (trans == blas_no_trans)) {
+	lenx = n;
+	leny = m;
+	incai = 1;
+	incaij = lda;
+      } else {			/* colmajor and blas_trans */
+	lenx = m;
+	leny = n;
+	incai = lda;
+	incaij = 1;
+      }
+      if ((order == blas_colmajor && lda < m) ||
+	  (order == blas_rowmajor && lda < n))
+	BLAS_error(routine_name, -7, lda, NULL);
+
+      if (incx > 0)
+	kx = 0;
+      else
+	kx = (1 - lenx) * incx;
+      if (incy > 0)
+	ky = 0;
+      else
+	ky = (1 - leny) * incy;
+
+      /* alpha = 0 needs no sums, as in double precision */
+      if (alpha == 0.0) {
+	for (i = 0, iy = ky; i < leny; i++, iy += incy)
+	  y[iy] = (beta == 0.0) ? 0.0 : y[iy] * beta;
+	break;
+      }
+
+      FPU_FIX_START;
+
+      /* Binned row sums, a block of rows at a time. */
+      iy = ky;
+      for (i0 = 0; i0 < leny; i0 += rows) {
+	rows = MIN(BLAS_REPRO_ROWS, leny - i0);
+	blas_repro_gemv(rows, lenx, a + (long) i0 * incai, incai, incaij,
+			x + kx, incx, sum);
+	for (i = 0; i < rows; i++, iy += incy) {
+	  if (beta == 0.0)
+	    y[iy] = (alpha == 1.0) ? sum[i] : sum[i] * alpha;
+	  else
+	    y[iy] = sum[i] * alpha + y[iy] * beta;
+	}
+      }
+
+      FPU_FIX_STOP;
+      break;
+    }
   }
 }
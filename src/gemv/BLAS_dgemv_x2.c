@@ -0,0 +1,135 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_batch.h"
+#include "blas_malloc.h"
+#include "blas_gemv_cols.h"
+
+void BLAS_dgemv_x2(enum blas_order_type order, enum blas_trans_type trans,
+		   int m, int n, double alpha, const double *a, int lda,
+		   const double *x, int incx, double beta, double *y_head,
+		   double *y_tail, int incy)
+/*
+ * Purpose
+ * =======
+ *
+ * Computes (y_head, y_tail) <- alpha * op(A) * x + beta * (y_head, y_tail)
+ * in double-double, as BLAS_dgemv_x does with blas_prec_extra, and
+ * stores each y[i] as its two words instead of rounding it to one
+ * double.  y_head[i] + y_tail[i] is the value; y_tail is read only when
+ * beta is nonzero, so the result of one call can feed the next.
+ *
+ * Arguments
+ * =========
+ *
+ * order        (input) blas_order_type
+ *              Order of A; row or column major
+ *
+ * trans        (input) blas_trans_type
+ *              Transpose of A; no trans, trans, or conjugate trans
+ *
+ * m            (input) int
+ *              Dimension of A
+ *
+ * n            (input) int
+ *              Dimension of A and the length of vector x
+ *
+ * alpha        (input) double
+ *
+ * A            (input) const double*
+ *
+ * lda          (input) int
+ *              Leading dimension of A
+ *
+ * x            (input) const double*
+ *
+ * incx         (input) int
+ *              The stride for vector x.
+ *
+ * beta         (input) double
+ *
+ * y_head       (input/output) double*
+ * y_tail       (input/output) double*
+ *              The two words of y, both with stride incy.
+ *
+ * incy         (input) int
+ *              The stride for vector y.
+ *
+ */
+{
+  static const char routine_name[] = "BLAS_dgemv_x2";
+  int i, lenx, leny, incai, incaij, kx, iy;
+  double *sum = NULL;
+  FPU_FIX_DECL;
+
+  /* all error calls */
+  if (m < 0)
+    BLAS_error(routine_name, -3, m, 0);
+  else if (n <= 0)
+    BLAS_error(routine_name, -4, n, 0);
+  else if (incx == 0)
+    BLAS_error(routine_name, -9, incx, 0);
+  else if (incy == 0)
+    BLAS_error(routine_name, -13, incy, 0);
+
+  if ((order == blas_rowmajor) == (trans == blas_no_trans)) {
+    incai = lda;
+    incaij = 1;
+  } else {
+    incai = 1;
+    incaij = lda;
+  }
+  if (trans == blas_no_trans) {
+    lenx = n;
+    leny = m;
+  } else {
+    lenx = m;
+    leny = n;
+  }
+  if ((order == blas_colmajor && lda < m) ||
+      (order == blas_rowmajor && lda < n))
+    BLAS_error(routine_name, -7, lda, NULL);
+
+  /* No extra-precision needed for alpha = 0 */
+  if (alpha == 0.0 && beta == 1.0)
+    return;
+
+  FPU_FIX_START;
+
+  kx = (incx > 0) ? 0 : (1 - lenx) * incx;
+  iy = (incy > 0) ? 0 : (1 - leny) * incy;
+
+  /* The row sums, from the column sweep or the row panels when they
+     take the shape, else row by row. */
+  if (alpha != 0.0) {
+    if (incai == 1)
+      sum = blas_gemv_cols_x(leny, lenx, a, blas_gemm_elt_d, incaij, 0,
+			     x + kx, blas_gemm_elt_d, incx);
+    else
+      sum = blas_gemv_rows_x(leny, lenx, a, blas_gemm_elt_d, incai, 0,
+			     x + kx, blas_gemm_elt_d, incx, incx == 1);
+  }
+
+  for (i = 0; i < leny; i++, iy += incy) {
+    double head_sum = 0.0, tail_sum = 0.0;
+
+    if (sum != NULL) {
+      head_sum = sum[2 * i];
+      tail_sum = sum[2 * i + 1];
+    } else if (alpha != 0.0) {
+      const double *ai = a + (long) i * incai;
+
+      if (incaij == 1 && incx == 1 && blas_dd_vec_enabled())
+	blas_dot_x_kernel(lenx, ai, 0, x, 0, 0, blas_no_conj,
+			  &head_sum, &tail_sum);
+      else
+	blas_batch_dot_dd(lenx, ai, incaij, x + kx, incx,
+			  &head_sum, &tail_sum);
+    }
+    blas_dd_axpby(alpha, head_sum, tail_sum, beta, &y_head[iy],
+		  &y_tail[iy]);
+  }
+  blas_free(sum);
+
+  FPU_FIX_STOP;
+}
@@ -0,0 +1,272 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_batch.h"
+#include "blas_repro.h"
+
+/*
+ * Purpose
+ * =======
+ *
+ * Computes y_p <- alpha * op(A_p) * x_p + beta * y_p for each problem p
+ * of a batch, with the precision of BLAS_dgemv_x.
+ *
+ * BLAS_dgemv_x_batch takes arrays of pointers, a[p], x[p] and y[p].
+ * BLAS_dgemv_x_batch_strided takes A_p = a + p*stridea,
+ * x_p = x + p*stridex and y_p = y + p*stridey.  Other arguments are
+ * those of BLAS_dgemv_x and are shared by the whole batch.
+ *
+ * Each y_p is what BLAS_dgemv_x would store.
+ *
+ */
+
+struct gemv_batch {
+  int lenx, leny, incai, incaij;
+  double alpha, beta;
+  const double *a, *x;		/* strided bases, or NULL          */
+  double *y;
+  const double *const *as, *const *xs;	/* pointer arrays        */
+  double *const *ys;
+  long stridea, stridex, stridey;
+  int incx, incy;
+  int batch, chunk;
+  enum blas_prec_type prec;
+};
+
+/* Zero tails for the double x of the column sweep. */
+static const double zero_tail[BLAS_BATCH_ROWS];
+
+/* Double-double sums of rows [r0, r0 + rows) of op(A) * x, with columns
+   of op(A) contiguous: the rows are swept a column at a time, and each
+   row still adds its products in column order. */
+static void sums_cols(const struct gemv_batch *b, const double *a,
+		      const double *x, int r0, int rows,
+		      double *head_sum, double *tail_sum)
+{
+  int c, nc, i;
+
+  for (i = 0; i < rows; i++)
+    head_sum[i] = tail_sum[i] = 0.0;
+  for (c = 0; c < b->lenx; c += nc) {
+    nc = MIN(BLAS_BATCH_ROWS, b->lenx - c);
+    blas_gemv_dd_cols_x_kernel(rows, nc, a + r0 + (long) c * b->incaij, 0,
+			       b->incaij, x + c, zero_tail, 0,
+			       head_sum, tail_sum);
+  }
+}
+
+/* y[iy] <- alpha * (head_sum, tail_sum) + beta * y[iy], as in the extra
+   branch of BLAS_dgemv_x. */
+static double finish_dd(const struct gemv_batch *b, double head_sum,
+			double tail_sum, double y_elem)
+{
+  double head_tmp1, tail_tmp1, head_tmp2, tail_tmp2;
+
+  if (b->beta == 0.0) {
+    if (b->alpha == 1.0)
+      return head_sum;
+    blas_dd_mul_d(head_sum, tail_sum, b->alpha, &head_tmp1, &tail_tmp1);
+    return head_tmp1;
+  }
+  blas_dd_mul_d(head_sum, tail_sum, b->alpha, &head_tmp1, &tail_tmp1);
+  blas_dd_two_prod(y_elem, b->beta, &head_tmp2, &tail_tmp2);
+  blas_dd_add(head_tmp1, tail_tmp1, head_tmp2, tail_tmp2,
+	      &head_tmp1, &tail_tmp1);
+  return head_tmp1;
+}
+
+static void gemv_one(const struct gemv_batch *b, const double *a,
+		     const double *x, double *y)
+{
+  int i, iy, ai, lenx = b->lenx, leny = b->leny;
+  int incx = b->incx, incy = b->incy;
+
+  if (incx < 0)
+    x += (1 - lenx) * incx;
+  iy = (incy > 0) ? 0 : (1 - leny) * incy;
+
+  /* No extra-precision needed for alpha = 0 */
+  if (b->alpha == 0.0) {
+    for (i = 0; i < leny; i++, iy += incy)
+      y[iy] = (b->beta == 0.0) ? 0.0 : y[iy] * b->beta;
+    return;
+  }
+
+  if (b->prec == blas_prec_reproducible) {
+    double sum[BLAS_REPRO_ROWS];
+    int r0, rows;
+
+    for (r0 = 0; r0 < leny; r0 += rows) {
+      rows = MIN(BLAS_REPRO_ROWS, leny - r0);
+      blas_repro_gemv(rows, lenx, a + (long) r0 * b->incai, b->incai,
+		      b->incaij, x, incx, sum);
+      for (i = 0; i < rows; i++, iy += incy) {
+	if (b->beta == 0.0)
+	  y[iy] = (b->alpha == 1.0) ? sum[i] : sum[i] * b->alpha;
+	else
+	  y[iy] = sum[i] * b->alpha + y[iy] * b->beta;
+      }
+    }
+  } else if (b->prec != blas_prec_extra) {
+    for (i = 0, ai = 0; i < leny; i++, ai += b->incai, iy += incy) {
+      double sum = blas_batch_dot_d(lenx, a + ai, b->incaij, x, incx);
+
+      if (b->beta == 0.0)
+	y[iy] = (b->alpha == 1.0) ? sum : sum * b->alpha;
+      else
+	y[iy] = sum * b->alpha + y[iy] * b->beta;
+    }
+  } else if (b->incaij == 1 && incx == 1 && blas_dd_vec_enabled()) {
+    /* Rows of op(A) contiguous: the vector dot of BLAS_dgemv_x. */
+    for (i = 0, ai = 0; i < leny; i++, ai += b->incai, iy += incy) {
+      double head_sum, tail_sum;
+
+      blas_dot_x_kernel(lenx, a + ai, 0, x, 0, 0, blas_no_conj,
+			&head_sum, &tail_sum);
+      y[iy] = finish_dd(b, head_sum, tail_sum, y[iy]);
+    }
+  } else if (b->incai == 1 && incx == 1) {
+    double head_sum[BLAS_BATCH_ROWS], tail_sum[BLAS_BATCH_ROWS];
+    int r0, rows;
+
+    for (r0 = 0; r0 < leny; r0 += rows) {
+      rows = MIN(BLAS_BATCH_ROWS, leny - r0);
+      sums_cols(b, a, x, r0, rows, head_sum, tail_sum);
+      for (i = 0; i < rows; i++, iy += incy)
+	y[iy] = finish_dd(b, head_sum[i], tail_sum[i], y[iy]);
+    }
+  } else {
+    for (i = 0, ai = 0; i < leny; i++, ai += b->incai, iy += incy) {
+      double head_sum, tail_sum;
+
+      blas_batch_dot_dd(lenx, a + ai, b->incaij, x, incx,
+			&head_sum, &tail_sum);
+      y[iy] = finish_dd(b, head_sum, tail_sum, y[iy]);
+    }
+  }
+}
+
+static void gemv_task(void *arg, int task, int worker)
+{
+  const struct gemv_batch *b = (const struct gemv_batch *) arg;
+  int p, p0 = task * b->chunk, p1 = p0 + b->chunk;
+  FPU_FIX_DECL;
+
+  (void) worker;
+  if (p1 > b->batch)
+    p1 = b->batch;
+  if (b->prec == blas_prec_extra || b->prec == blas_prec_reproducible) {
+    FPU_FIX_START;
+  }
+  for (p = p0; p < p1; p++) {
+    if (b->as != NULL)
+      gemv_one(b, b->as[p], b->xs[p], b->ys[p]);
+    else
+      gemv_one(b, b->a + p * b->stridea, b->x + p * b->stridex,
+	       b->y + p * b->stridey);
+  }
+  if (b->prec == blas_prec_extra || b->prec == blas_prec_reproducible) {
+    FPU_FIX_STOP;
+  }
+}
+
+/* Shared setup and checks; returns 0 when there is nothing to do. */
+static int gemv_setup(struct gemv_batch *b, const char *routine_name,
+		      enum blas_order_type order, enum blas_trans_type trans,
+		      int m, int n, double alpha, int lda, int incx,
+		      double beta, int incy, int batch,
+		      enum blas_prec_type prec, int pos_lda, int pos_incx,
+		      int pos_incy, int pos_batch)
+{
+  if (!blas_batch_prec_known(prec))
+    return 0;
+
+  /* all error calls */
+  if (m < 0)
+    BLAS_error(routine_name, -3, m, 0);
+  else if (n <= 0)
+    BLAS_error(routine_name, -4, n, 0);
+  else if (incx == 0)
+    BLAS_error(routine_name, pos_incx, incx, 0);
+  else if (incy == 0)
+    BLAS_error(routine_name, pos_incy, incy, 0);
+  else if (batch < 0)
+    BLAS_error(routine_name, pos_batch, batch, 0);
+
+  if ((order == blas_rowmajor) == (trans == blas_no_trans)) {
+    b->incai = lda;
+    b->incaij = 1;
+  } else {
+    b->incai = 1;
+    b->incaij = lda;
+  }
+  b->lenx = (trans == blas_no_trans) ? n : m;
+  b->leny = (trans == blas_no_trans) ? m : n;
+  if ((order == blas_colmajor && lda < m) ||
+      (order == blas_rowmajor && lda < n))
+    BLAS_error(routine_name, pos_lda, lda, NULL);
+
+  b->alpha = alpha;
+  b->beta = beta;
+  b->incx = incx;
+  b->incy = incy;
+  b->batch = batch;
+  b->prec = prec;
+  b->chunk = blas_batch_chunk((long) m * n);
+  return batch > 0;
+}
+
+static void gemv_run(struct gemv_batch *b)
+{
+  int ntasks = (b->batch + b->chunk - 1) / b->chunk;
+
+  blas_parallel_for(ntasks, blas_parallel_workers(ntasks), gemv_task, b);
+}
+
+void BLAS_dgemv_x_batch(enum blas_order_type order,
+			enum blas_trans_type trans, int m, int n,
+			double alpha, const double *const *a, int lda,
+			const double *const *x, int incx, double beta,
+			double *const *y, int incy, int batch,
+			enum blas_prec_type prec)
+{
+  static const char routine_name[] = "BLAS_dgemv_x_batch";
+  struct gemv_batch b;
+
+  if (!gemv_setup(&b, routine_name, order, trans, m, n, alpha, lda, incx,
+		  beta, incy, batch, prec, -7, -9, -12, -13))
+    return;
+  b.a = b.x = NULL;
+  b.y = NULL;
+  b.as = a;
+  b.xs = x;
+  b.ys = y;
+  b.stridea = b.stridex = b.stridey = 0;
+  gemv_run(&b);
+}
+
+void BLAS_dgemv_x_batch_strided(enum blas_order_type order,
+				enum blas_trans_type trans, int m, int n,
+				double alpha, const double *a, int lda,
+				int stridea, const double *x, int incx,
+				int stridex, double beta, double *y,
+				int incy, int stridey, int batch,
+				enum blas_prec_type prec)
+{
+  static const char routine_name[] = "BLAS_dgemv_x_batch_strided";
+  struct gemv_batch b;
+
+  if (!gemv_setup(&b, routine_name, order, trans, m, n, alpha, lda, incx,
+		  beta, incy, batch, prec, -7, -10, -14, -16))
+    return;
+  b.a = a;
+  b.x = x;
+  b.y = y;
+  b.as = b.xs = NULL;
+  b.ys = NULL;
+  b.stridea = stridea;
+  b.stridex = stridex;
+  b.stridey = stridey;
+  gemv_run(&b);
+}
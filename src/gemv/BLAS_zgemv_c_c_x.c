@@ -1,5 +1,7 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		       		int		m       , int n, const void *alpha, const void *a, int lda,
 		       		const		void  *x, int incx, const void *beta, void *y,
@@ -59,6 +61,7 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -382,6 +385,8 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
       int	      lenx , leny;
       int	      ai   , aij;
       int	      incai, incaij;
+      int	      unit_stride;
+      enum blas_conj_type conj;
 
       const float    *a_i = (float *)a;
       const float    *x_i = (float *)x;
@@ -395,6 +400,7 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -448,6 +454,28 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Rows of op(A) that are contiguous go through the vector dot. */
+      unit_stride = (incaij == 2 && incx == 2 && blas_dd_vec_enabled());
+      conj = (trans == blas_conj_trans) ? blas_conj : blas_no_conj;
+
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = NULL;
+      if (incai == 2
+	  && !unit_stride
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				   incaij / 2, trans == blas_conj_trans,
+				   x_i + kx, blas_gemm_elt_c, incx / 2);
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c, incai / 2,
+				   trans == blas_conj_trans, x_i + kx,
+				   blas_gemm_elt_c, incx / 2, unit_stride);
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -469,35 +497,13 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -533,35 +539,13 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -611,134 +595,120 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		y_i[iy] = head_sum[0];
 		y_i[iy + 1] = head_sum[1];
@@ -752,134 +722,120 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -894,20 +850,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -918,20 +864,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -974,20 +910,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -998,20 +924,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1065,128 +981,120 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem[0] = x_i[jx];
-		x_elem[1] = x_i[jx + 1];
-		{
-		  double	  head_e1, tail_e1;
-		  double	  d1;
-		  double	  d2;
-		  /* Real part */
-		  d1 = (double)a_elem[0] * x_elem[0];
-		  d2 = (double)-a_elem[1] * x_elem[1];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[0] = head_e1;
-		  tail_prod[0] = tail_e1;
-		  /* imaginary part */
-		  d1 = (double)a_elem[0] * x_elem[1];
-		  d2 = (double)a_elem[1] * x_elem[0];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[1] = head_e1;
-		  tail_prod[1] = tail_e1;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+	      if (col_sum != NULL) {
+		head_sum[0] = col_sum[4 * i];
+		head_sum[1] = col_sum[4 * i + 1];
+		tail_sum[0] = col_sum[4 * i + 2];
+		tail_sum[1] = col_sum[4 * i + 3];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				  head_sum, tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+		  a_elem[1] = -a_elem[1];
+		  x_elem[0] = x_i[jx];
+		  x_elem[1] = x_i[jx + 1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    double	  head_e1, tail_e1;
+		    double	  d1;
+		    double	  d2;
+		    /* Real part */
+		    d1 = (double)a_elem[0] * x_elem[0];
+		    d2 = (double)-a_elem[1] * x_elem[1];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    s2 += t1;
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[0] = head_e1;
+		    tail_prod[0] = tail_e1;
+		    /* imaginary part */
+		    d1 = (double)a_elem[0] * x_elem[1];
+		    d2 = (double)a_elem[1] * x_elem[0];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    t2 += s2;
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[1] = head_e1;
+		    tail_prod[1] = tail_e1;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute complex-extra = complex-extra * complex-double. */
@@ -1201,20 +1109,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1225,20 +1123,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1281,20 +1169,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1305,20 +1183,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1367,35 +1235,13 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1431,35 +1277,13 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1532,185 +1356,171 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* Imaginary part */
 		head_a = head_tmp1[1];
 		tail_a = tail_tmp1[1];
-		head_b = head_tmp2[1];
-		tail_b = tail_tmp2[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_tmp1[1] = head_t;
-		tail_tmp1[1] = tail_t;
-	      }
-	      y_i[iy] = head_tmp1[0];
-	      y_i[iy + 1] = head_tmp1[1];
-	      ai += incai;
-	      iy += incy;
-	    }
-	  }
-
-	} else {
-
-	  /* if beta = 0, we can save m multiplies: y = alpha*A*x */
-	  if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-	    /* save m more multiplies if alpha = 1 */
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      ai = 0;
-	      iy = ky;
-	      for (i = 0; i < leny; i++) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		head_b = head_tmp2[1];
+		tail_b = tail_tmp2[1];
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		      t2 += s2;
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		  /* Add two lo words. */
+		  t1 = tail_a + tail_b;
+		  bv = t1 - tail_a;
+		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  s2 += t1;
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		      s2 += t1;
+		  t2 += s2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		  /* Renormalize (t1, t2)  */
+		  head_t = t1 + t2;
+		  tail_t = t2 - (head_t - t1);
+		}
+		head_tmp1[1] = head_t;
+		tail_tmp1[1] = tail_t;
+	      }
+	      y_i[iy] = head_tmp1[0];
+	      y_i[iy + 1] = head_tmp1[1];
+	      ai += incai;
+	      iy += incy;
+	    }
+	  }
 
-		      t2 += s2;
+	} else {
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+	  /* if beta = 0, we can save m multiplies: y = alpha*A*x */
+	  if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+	    /* save m more multiplies if alpha = 1 */
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
+	      ai = 0;
+	      iy = ky;
+	      for (i = 0; i < leny; i++) {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		aij = ai;
+		jx = kx;
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
+		    {
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		y_i[iy] = head_sum[0];
 		y_i[iy + 1] = head_sum[1];
@@ -1724,134 +1534,120 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[jx];
-		  x_elem[1] = x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		} else if (unit_stride)
+		  blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				    head_sum, tail_sum);
+		else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[jx];
+		    x_elem[1] = x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -1866,20 +1662,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1890,20 +1676,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1946,20 +1722,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1970,20 +1736,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2037,128 +1793,120 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-
-		x_elem[0] = x_i[jx];
-		x_elem[1] = x_i[jx + 1];
-		{
-		  double	  head_e1, tail_e1;
-		  double	  d1;
-		  double	  d2;
-		  /* Real part */
-		  d1 = (double)a_elem[0] * x_elem[0];
-		  d2 = (double)-a_elem[1] * x_elem[1];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[0] = head_e1;
-		  tail_prod[0] = tail_e1;
-		  /* imaginary part */
-		  d1 = (double)a_elem[0] * x_elem[1];
-		  d2 = (double)a_elem[1] * x_elem[0];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+	      if (col_sum != NULL) {
+		head_sum[0] = col_sum[4 * i];
+		head_sum[1] = col_sum[4 * i + 1];
+		tail_sum[0] = col_sum[4 * i + 2];
+		tail_sum[1] = col_sum[4 * i + 3];
+	      } else if (unit_stride)
+		blas_dot_x_kernel(lenx, a_i + ai, 1, x_i, 1, 1, conj,
+				  head_sum, tail_sum);
+	      else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
 
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_prod[1] = head_e1;
-		  tail_prod[1] = tail_e1;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  x_elem[0] = x_i[jx];
+		  x_elem[1] = x_i[jx + 1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    double	  head_e1, tail_e1;
+		    double	  d1;
+		    double	  d2;
+		    /* Real part */
+		    d1 = (double)a_elem[0] * x_elem[0];
+		    d2 = (double)-a_elem[1] * x_elem[1];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    s2 += t1;
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[0] = head_e1;
+		    tail_prod[0] = tail_e1;
+		    /* imaginary part */
+		    d1 = (double)a_elem[0] * x_elem[1];
+		    d2 = (double)a_elem[1] * x_elem[0];
+		    {
+		      /* Compute double-double = double + double. */
+		      double	    e   , t1, t2;
 
-		    t2 += s2;
+		      /* Knuth trick. */
+		      t1 = d1 + d2;
+		      e = t1 - d1;
+		      t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* The result is t1 + t2, after normalization. */
+		      head_e1 = t1 + t2;
+		      tail_e1 = t2 - (head_e1 - t1);
+		    }
+		    head_prod[1] = head_e1;
+		    tail_prod[1] = tail_e1;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  aij += incaij;
+		  jx += incx;
 		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute complex-extra = complex-extra * complex-double. */
@@ -2173,20 +1921,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -2197,20 +1935,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -2253,20 +1981,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -2277,20 +1995,10 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -2339,35 +2047,13 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -2403,35 +2089,13 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -2546,6 +2210,7 @@ void		BLAS_zgemv_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
       FPU_FIX_STOP;
     }
     break;
@@ -0,0 +1,542 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_malloc.h"
+#include "blas_gemv_cols.h"
+
+/*
+ * Row sums of op(A) * x by columns.
+ *
+ * Real A against real x goes through the column kernel of blas_dd_vec.h
+ * on a double copy of x (with zero tails, which makes its products the
+ * plain two-products of the reference; for float A and x the products
+ * are exact and the kernel adds them as doubles).  So does complex A
+ * against real x, taken as a real matrix of 2m rows, and real A against
+ * complex x, in one pass for each part of x: each part of each sum is
+ * then a real sum of two-products, as in the generated code.  Complex
+ * by complex goes through the complex column kernel, which keeps the
+ * (re, im) pairs of several rows in each vector and forms the products
+ * of the generated code:
+ *
+ *   complex float by complex float   exact double products, each part
+ *                                    summed with the Knuth trick
+ *   other complex by complex         four two-products, added in pairs
+ *
+ * Blocks of BLAS_GEMV_COLS_MB rows are independent tasks; on several
+ * threads each worker keeps its accumulators apart from the others.
+ *
+ * When the rows of op(A) are contiguous instead, blas_gemv_rows_x hands
+ * out panels of BLAS_GEMV_ROWS_MB rows, each row summed as the reference
+ * loop sums it: through blas_dot_x_kernel where GEMV uses it, else
+ * element by element with the products above.
+ *
+ * A GBMV band is the same matrix with kl sub- and ku super-diagonals
+ * and the rest of each row and column left out.  In band storage
+ * op(A)(i, j) sits at (i + j * (lda - 1)) past ku (or kl) leading slots
+ * when columns of op(A) are contiguous, (j + i * (lda - 1)) when rows
+ * are, so both sweeps take it as a dense matrix with leading dimension
+ * lda - 1 and clip each column or row to the band.  A column sweep
+ * hands the kernel panels narrow enough that all their columns share
+ * most of their rows, and the ragged ends of each column one column at
+ * a time, so every row still adds its products in column order.  A row
+ * sweep sums each band row through blas_dot_x_kernel.
+ */
+
+enum cols_mode {
+  cols_real,
+  cols_a_complex,		/* complex A, real x    */
+  cols_x_complex,		/* real A, complex x    */
+  cols_complex,
+  cols_complex_single		/* complex float A and x */
+};
+
+struct gemv_cols {
+  int m, n;
+  int kl, ku;			/* band of op(A); m - 1 and n - 1 when
+				   dense */
+  const void *a;
+  int a_single, x_single, lda, conj;
+  enum cols_mode mode;
+  int w;			/* doubles per sum */
+  const double *xh, *xt;	/* x as doubles (re, im pairs for a complex
+				   sweep, all re then all im for complex x
+				   against real A); zero tails */
+  double *acc;			/* 2 * w * BLAS_GEMV_COLS_MB doubles per
+				   worker, the accumulators of a block */
+  double *sum;			/* the result */
+
+  /* Row sweeps only: x as given, for the dot kernel, and whether rows
+     go through it. */
+  const void *x;
+  int dot;
+};
+
+/* Real component k of p. */
+static double elt(const void *p, int single, long k)
+{
+  return single ? ((const float *) p)[k] : ((const double *) p)[k];
+}
+
+/* (head_prod, tail_prod) = (a0 + i a1) * (x0 + i x1) for a complex
+   sweep; a1 is already conjugated if need be. */
+static void complex_prod(const struct gemv_cols *s, double a0, double a1,
+			 double x0, double x1, double *head_prod,
+			 double *tail_prod)
+{
+  blas_dd_cmul(a0, a1, x0, x1, s->mode == cols_complex_single, head_prod,
+	       tail_prod);
+}
+
+/* Rows [i0, i1) of columns [c, c + nc) into the sums of the block of
+   rows starting at r0. */
+static void sweep_panel(const struct gemv_cols *s, int r0, int rows,
+			int i0, int i1, int c, int nc, double *head,
+			double *tail)
+{
+  int both = (s->mode == cols_complex || s->mode == cols_complex_single);
+  int w = (s->mode == cols_a_complex || both) ? 2 : 1;
+  long off = w * ((long) c * s->lda + i0);
+  const void *t = s->a_single ? (const void *) ((const float *) s->a + off)
+    : (const void *) ((const double *) s->a + off);
+
+  if (i1 <= i0)
+    return;
+  if (both) {
+    blas_zgemv_dd_cols_x_kernel(i1 - i0, nc, t, s->a_single, s->lda,
+				s->xh + 2 * c, s->conj,
+				s->mode == cols_complex_single,
+				head + 2 * (i0 - r0), tail + 2 * (i0 - r0));
+    return;
+  }
+  blas_gemv_dd_cols_x_kernel(w * (i1 - i0), nc, t, s->a_single, w * s->lda,
+			     s->xh + c, s->xt + c, s->x_single,
+			     head + w * (i0 - r0), tail + w * (i0 - r0));
+  if (s->mode == cols_x_complex)
+    blas_gemv_dd_cols_x_kernel(i1 - i0, nc, t, s->a_single, s->lda,
+			       s->xh + s->n + c, s->xt + c, s->x_single,
+			       head + rows + i0 - r0, tail + rows + i0 - r0);
+}
+
+/* Sums of rows [r0, r0 + rows), a panel of columns at a time, in (head,
+   tail).  Complex A leaves (re, im) pairs, conjugated afterwards if need
+   be against real x; complex x against real A leaves the real parts of
+   the rows, then their imaginary parts. */
+static void sweep_block(const struct gemv_cols *s, int r0, int rows,
+		       double *head, double *tail)
+{
+  int c0 = MAX(0, r0 - s->kl), c1 = MIN(s->n, r0 + rows + s->ku);
+  int r1 = r0 + rows;
+  int c, j, nb, nc, i, i0, i1;
+
+  /* A band takes panels about half its width, so that their columns
+     share most of their rows. */
+  nb = (s->kl >= s->m - 1 && s->ku >= s->n - 1) ? BLAS_GEMV_COLS_NB
+    : MAX(1, MIN(BLAS_GEMV_COLS_NB, (s->kl + s->ku + 2) / 2));
+
+  for (c = c0; c < c1; c += nc) {
+    nc = MIN(nb, c1 - c);
+
+    /* The rows every column of the panel reaches, then the ends of each
+       column above and below them. */
+    i0 = MAX(r0, c + nc - 1 - s->ku);
+    i1 = MIN(r1, c + s->kl + 1);
+    if (i0 < i1)
+      sweep_panel(s, r0, rows, i0, i1, c, nc, head, tail);
+    else
+      i0 = i1 = r1;
+    for (j = c; j < c + nc && (i0 > r0 || i1 < r1); j++) {
+      sweep_panel(s, r0, rows, MAX(r0, j - s->ku), MIN(i0, j + s->kl + 1),
+		  j, 1, head, tail);
+      sweep_panel(s, r0, rows, MAX(i1, j - s->ku), MIN(r1, j + s->kl + 1),
+		  j, 1, head, tail);
+    }
+  }
+
+  /* The reference negates each imaginary part of A; negating the sums
+     instead rounds the same, and 0.0 - v keeps a zero sum positive as
+     it is there. */
+  if (s->mode == cols_a_complex && s->conj)
+    for (i = 0; i < rows; i++) {
+      head[2 * i + 1] = 0.0 - head[2 * i + 1];
+      tail[2 * i + 1] = 0.0 - tail[2 * i + 1];
+    }
+}
+
+/* Chains summed together by a row sweep.  Each is one real part of one
+   row with an accumulator of its own, so running several side by side
+   changes nothing but the speed. */
+#define ROWS_CHAINS 4
+
+/* One real part of a row: SUM_j sgn * a[a0 + j*inca] * x[x0 + j*incx],
+   sgn (1 or -1) conjugating the imaginary parts of A. */
+struct row_chain {
+  long a0;
+  int x0;
+  double sgn;
+  double head, tail;
+};
+
+/* Sums the chains c[0..ROWS_CHAINS). */
+static void sum_chains(const struct gemv_cols *s, struct row_chain *c,
+		       int inca, int incx)
+{
+  int exact = s->a_single && s->x_single;
+  double head[ROWS_CHAINS], tail[ROWS_CHAINS];
+  int j, k;
+
+  for (k = 0; k < ROWS_CHAINS; k++)
+    head[k] = tail[k] = 0.0;
+  for (j = 0; j < s->n; j++)
+    for (k = 0; k < ROWS_CHAINS; k++) {
+      double v = c[k].sgn * elt(s->a, s->a_single,
+				c[k].a0 + (long) j * inca);
+      double head_prod, tail_prod = 0.0;
+
+      if (exact)
+	head_prod = v * s->xh[c[k].x0 + (long) j * incx];
+      else
+	blas_dd_two_prod(v, s->xh[c[k].x0 + (long) j * incx],
+			 &head_prod, &tail_prod);
+      blas_dd_add_lazy(head[k], tail[k], head_prod, tail_prod,
+		       &head[k], &tail[k]);
+    }
+  for (k = 0; k < ROWS_CHAINS; k++) {
+    c[k].head = head[k];
+    c[k].tail = tail[k];
+  }
+}
+
+/* Rows [r0, r0 + rows) of a row sweep into s->sum. */
+static void sweep_rows(const struct gemv_cols *s, int r0, int rows)
+{
+  int a_complex = (s->mode != cols_real && s->mode != cols_x_complex);
+  int x_complex = (s->mode != cols_real && s->mode != cols_a_complex);
+  int w = s->w;
+  struct row_chain c[ROWS_CHAINS];
+  int i, j, k, nc;
+
+  if (s->dot || (a_complex && x_complex)) {
+    for (i = r0; i < r0 + rows; i++) {
+      double head[2], tail[2];
+      int j0 = MAX(0, i - s->kl), j1 = MIN(s->n, i + s->ku + 1);
+      long row = (long) (a_complex ? 2 : 1) * ((long) i * s->lda + j0);
+      const void *t = s->a_single
+	? (const void *) ((const float *) s->a + row)
+	: (const void *) ((const double *) s->a + row);
+
+      if (s->dot) {
+	long xo = (long) (x_complex ? 2 : 1) * j0;
+	const void *x = s->x_single
+	  ? (const void *) ((const float *) s->x + xo)
+	  : (const void *) ((const double *) s->x + xo);
+
+	blas_dot_x_kernel(MAX(0, j1 - j0), t, s->a_single, x, s->x_single,
+			  a_complex, s->conj ? blas_conj : blas_no_conj,
+			  head, tail);
+      } else {
+	head[0] = head[1] = tail[0] = tail[1] = 0.0;
+	for (j = j0; j < j1; j++) {
+	  double head_prod[2], tail_prod[2];
+	  double a0 = elt(t, s->a_single, 2 * (j - j0));
+	  double a1 = elt(t, s->a_single, 2 * (j - j0) + 1);
+
+	  if (s->conj)
+	    a1 = -a1;
+	  complex_prod(s, a0, a1, s->xh[2 * j], s->xh[2 * j + 1],
+		       head_prod, tail_prod);
+	  for (k = 0; k < 2; k++)
+	    blas_dd_add_lazy(head[k], tail[k], head_prod[k], tail_prod[k],
+			     &head[k], &tail[k]);
+	}
+      }
+      for (k = 0; k < w; k++) {
+	s->sum[2 * w * i + k] = head[k];
+	s->sum[2 * w * i + w + k] = tail[k];
+      }
+    }
+    return;
+  }
+
+  /* One real factor: each part is a real sum; they go ROWS_CHAINS at a
+     time, the last group padded with copies of its first chain. */
+  for (k = 0; k < rows * w; k += nc) {
+    nc = MIN(ROWS_CHAINS, rows * w - k);
+    for (j = 0; j < ROWS_CHAINS; j++) {
+      int part = (j < nc) ? (k + j) % w : k % w;
+      long row = r0 + ((j < nc) ? (k + j) / w : k / w);
+
+      c[j].a0 = (a_complex ? 2 : 1) * row * s->lda + (a_complex ? part : 0);
+      c[j].x0 = x_complex ? part : 0;
+      c[j].sgn = (a_complex && part == 1 && s->conj) ? -1.0 : 1.0;
+    }
+    sum_chains(s, c, a_complex ? 2 : 1, x_complex ? 2 : 1);
+    for (j = 0; j < nc; j++) {
+      i = r0 + (k + j) / w;
+      s->sum[2 * w * i + (k + j) % w] = c[j].head;
+      s->sum[2 * w * i + w + (k + j) % w] = c[j].tail;
+    }
+  }
+}
+
+/* Task t of a column sweep: the block of rows starting at t *
+   BLAS_GEMV_COLS_MB, in the accumulators of the worker. */
+static void cols_task(void *arg, int task, int worker)
+{
+  const struct gemv_cols *s = (const struct gemv_cols *) arg;
+  int w = s->w;
+  int r0 = task * BLAS_GEMV_COLS_MB;
+  int rows = MIN(BLAS_GEMV_COLS_MB, s->m - r0);
+  double *head = s->acc + (size_t) 2 * w * BLAS_GEMV_COLS_MB * worker;
+  double *tail = head + w * BLAS_GEMV_COLS_MB;
+  int i, j;
+
+  for (i = 0; i < w * rows; i++)
+    head[i] = tail[i] = 0.0;
+  sweep_block(s, r0, rows, head, tail);
+  for (i = 0; i < rows; i++)
+    for (j = 0; j < w; j++) {
+      /* Complex x against real A leaves the parts apart. */
+      int k = (s->mode == cols_x_complex) ? j * rows + i : w * i + j;
+
+      s->sum[2 * w * (r0 + i) + j] = head[k];
+      s->sum[2 * w * (r0 + i) + w + j] = tail[k];
+    }
+}
+
+/* Task t of a row sweep: its panel of BLAS_GEMV_ROWS_MB rows. */
+static void rows_task(void *arg, int task, int worker)
+{
+  const struct gemv_cols *s = (const struct gemv_cols *) arg;
+  int r0 = task * BLAS_GEMV_ROWS_MB;
+
+  (void) worker;
+  sweep_rows(s, r0, MIN(BLAS_GEMV_ROWS_MB, s->m - r0));
+}
+
+/* Fills in the type fields of s. */
+static void cols_setup(struct gemv_cols *s, int m, int n, const void *a,
+		       enum blas_gemm_elt_type a_type, int lda, int conj,
+		       enum blas_gemm_elt_type x_type)
+{
+  int a_complex = BLAS_GEMM_ELT_IS_COMPLEX(a_type);
+  int x_complex = BLAS_GEMM_ELT_IS_COMPLEX(x_type);
+
+  s->m = m;
+  s->n = n;
+  s->kl = m - 1;
+  s->ku = n - 1;
+  s->a = a;
+  s->a_single = (a_type == blas_gemm_elt_s || a_type == blas_gemm_elt_c);
+  s->x_single = (x_type == blas_gemm_elt_s || x_type == blas_gemm_elt_c);
+  s->lda = lda;
+  s->conj = conj;
+  if (!a_complex && !x_complex)
+    s->mode = cols_real;
+  else if (!x_complex)
+    s->mode = cols_a_complex;
+  else if (!a_complex)
+    s->mode = cols_x_complex;
+  else if (s->a_single && s->x_single)
+    s->mode = cols_complex_single;
+  else
+    s->mode = cols_complex;
+  s->w = (a_complex || x_complex) ? 2 : 1;
+}
+
+/* x into the 3 * n doubles at xh, as a column sweep takes it. */
+static void cols_load_x(struct gemv_cols *s, double *xh, const void *x,
+			enum blas_gemm_elt_type x_type, int incx)
+{
+  int n = s->n, j;
+
+  for (j = 0; j < n; j++) {
+    long k = (long) (BLAS_GEMM_ELT_IS_COMPLEX(x_type) ? 2 : 1) * j * incx;
+
+    if (s->mode == cols_real || s->mode == cols_a_complex) {
+      xh[j] = elt(x, s->x_single, k);
+    } else if (s->mode == cols_x_complex) {
+      xh[j] = elt(x, s->x_single, k);
+      xh[n + j] = elt(x, s->x_single, k + 1);
+    } else {
+      xh[2 * j] = elt(x, s->x_single, k);
+      xh[2 * j + 1] = elt(x, s->x_single, k + 1);
+    }
+    xh[2 * n + j] = 0.0;
+  }
+  s->xh = xh;
+  s->xt = xh + 2 * n;
+}
+
+/* Workers for ntasks tasks over an m by n op(A): one below
+   BLAS_GEMV_PAR_MIN elements. */
+static int cols_workers(int m, int n, int ntasks)
+{
+  return ((long) m * n < BLAS_GEMV_PAR_MIN) ? 1
+    : blas_parallel_workers(ntasks);
+}
+
+double *blas_gemv_cols_x(int m, int n, const void *a,
+			 enum blas_gemm_elt_type a_type, int lda, int conj,
+			 const void *x, enum blas_gemm_elt_type x_type,
+			 int incx)
+{
+  struct gemv_cols s;
+  int ntasks, nworkers, w;
+  double *ws, *xh;
+
+  if (m < BLAS_GEMV_COLS_MIN_ROWS || n <= 0 || lda < m)
+    return NULL;
+
+  cols_setup(&s, m, n, a, a_type, lda, conj, x_type);
+  w = s.w;
+  ntasks = (m + BLAS_GEMV_COLS_MB - 1) / BLAS_GEMV_COLS_MB;
+  nworkers = cols_workers(m, n, ntasks);
+
+  /* x (and zero tails for the real kernel), then the accumulators of
+     each worker. */
+  ws = (double *) blas_thread_scratch(((size_t) 3 * n +
+				       (size_t) 2 * w * BLAS_GEMV_COLS_MB *
+				       nworkers) * sizeof(double));
+  s.sum = (double *) blas_malloc((size_t) 2 * w * m * sizeof(double));
+  if (ws == NULL || s.sum == NULL) {
+    blas_free(s.sum);
+    return NULL;
+  }
+  xh = ws;
+  s.acc = ws + 3 * n;
+  cols_load_x(&s, xh, x, x_type, incx);
+
+  blas_parallel_for(ntasks, nworkers, cols_task, &s);
+  return s.sum;
+}
+
+double *blas_gemv_rows_x(int m, int n, const void *a,
+			 enum blas_gemm_elt_type a_type, int lda, int conj,
+			 const void *x, enum blas_gemm_elt_type x_type,
+			 int incx, int dot)
+{
+  struct gemv_cols s;
+  int ntasks, nworkers;
+
+  if (m <= 0 || n <= 0)
+    return NULL;
+  ntasks = (m + BLAS_GEMV_ROWS_MB - 1) / BLAS_GEMV_ROWS_MB;
+  nworkers = cols_workers(m, n, ntasks);
+  if (nworkers < 2)
+    return NULL;
+
+  cols_setup(&s, m, n, a, a_type, lda, conj, x_type);
+  s.x = x;
+  s.dot = dot;
+
+  /* x as doubles, (re, im) pairs when complex, for the element by
+     element sums. */
+  s.xh = NULL;
+  if (!dot) {
+    int x_complex = BLAS_GEMM_ELT_IS_COMPLEX(x_type);
+    int xw = x_complex ? 2 : 1;
+    double *xh = (double *) blas_thread_scratch((size_t) xw * n *
+						sizeof(double));
+    int j;
+
+    if (xh == NULL)
+      return NULL;
+    for (j = 0; j < xw * n; j++)
+      xh[j] = elt(x, s.x_single, (long) xw * (j / xw) * incx + j % xw);
+    s.xh = xh;
+  }
+  s.sum = (double *) blas_malloc((size_t) 2 * s.w * m * sizeof(double));
+  if (s.sum == NULL)
+    return NULL;
+
+  blas_parallel_for(ntasks, nworkers, rows_task, &s);
+  return s.sum;
+}
+
+double *blas_gbmv_band_x(enum blas_order_type order,
+			 enum blas_trans_type trans, int m, int n, int kl,
+			 int ku, const void *a, enum blas_gemm_elt_type a_type,
+			 int lda, const void *x, enum blas_gemm_elt_type x_type,
+			 int incx)
+{
+  struct gemv_cols s;
+  int a_complex = BLAS_GEMM_ELT_IS_COMPLEX(a_type);
+  int x_complex = BLAS_GEMM_ELT_IS_COMPLEX(x_type);
+  int cols = (order == blas_colmajor) == (trans == blas_no_trans);
+  int leny = (trans == blas_no_trans) ? m : n;
+  int lenx = (trans == blas_no_trans) ? n : m;
+  int bl = (trans == blas_no_trans) ? kl : ku;	/* band of op(A) */
+  int bu = (trans == blas_no_trans) ? ku : kl;
+  int ntasks, nworkers, xw, j;
+  long off;
+  double *ws, *xh;
+
+  if (leny < BLAS_GEMV_COLS_MIN_ROWS || lenx <= 0 || lda < kl + ku + 1)
+    return NULL;
+  /* A row sweep needs the dot kernel: A and x both real or both
+     complex. */
+  if (!cols && a_complex != x_complex)
+    return NULL;
+  if (!a_complex && !x_complex && bl + bu + 1 < BLAS_GBMV_BAND_MIN_WIDTH)
+    return NULL;
+
+  cols_setup(&s, leny, lenx, a, a_type, lda - 1, trans == blas_conj_trans,
+	     x_type);
+  s.kl = bl;
+  s.ku = bu;
+  /* The first element of the band sits past the slots of the diagonals
+     above it (columns of op(A)) or below it (rows). */
+  off = (long) (a_complex ? 2 : 1) * (cols ? bu : bl);
+  s.a = s.a_single ? (const void *) ((const float *) a + off)
+    : (const void *) ((const double *) a + off);
+  xw = x_complex ? 2 : 1;
+
+  if (!cols) {
+    ntasks = (leny + BLAS_GEMV_ROWS_MB - 1) / BLAS_GEMV_ROWS_MB;
+    nworkers = cols_workers(leny, bl + bu + 1, ntasks);
+    s.dot = 1;
+    s.x = x;
+    if (incx != 1) {
+      /* The kernel takes x contiguous, in its own type. */
+      size_t size = s.x_single ? sizeof(float) : sizeof(double);
+      void *xc = blas_thread_scratch((size_t) xw * lenx * size);
+
+      if (xc == NULL)
+	return NULL;
+      for (j = 0; j < xw * lenx; j++) {
+	long k = (long) xw * (j / xw) * incx + j % xw;
+
+	if (s.x_single)
+	  ((float *) xc)[j] = ((const float *) x)[k];
+	else
+	  ((double *) xc)[j] = ((const double *) x)[k];
+      }
+      s.x = xc;
+    }
+    s.sum = (double *) blas_malloc((size_t) 2 * s.w * leny * sizeof(double));
+    if (s.sum == NULL)
+      return NULL;
+    blas_parallel_for(ntasks, nworkers, rows_task, &s);
+    return s.sum;
+  }
+
+  ntasks = (leny + BLAS_GEMV_COLS_MB - 1) / BLAS_GEMV_COLS_MB;
+  nworkers = cols_workers(leny, bl + bu + 1, ntasks);
+  /* As for blas_gemv_cols_x: x, then the accumulators of each worker. */
+  ws = (double *) blas_thread_scratch(((size_t) 3 * lenx +
+				       (size_t) 2 * s.w * BLAS_GEMV_COLS_MB *
+				       nworkers) * sizeof(double));
+  s.sum = (double *) blas_malloc((size_t) 2 * s.w * leny * sizeof(double));
+  if (ws == NULL || s.sum == NULL) {
+    blas_free(s.sum);
+    return NULL;
+  }
+  xh = ws;
+  s.acc = ws + 3 * lenx;
+  cols_load_x(&s, xh, x, x_type, incx);
+
+  blas_parallel_for(ntasks, nworkers, cols_task, &s);
+  return s.sum;
+}
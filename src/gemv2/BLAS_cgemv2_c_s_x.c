@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 					int		m       , int n, const void *alpha, const void *a, int lda,
 		const		float *head_x, const float *tail_x, int incx,
@@ -561,6 +562,7 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -1071,6 +1073,8 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum2[2], tail_sum2[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
+      double         *col_sum2;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -1124,6 +1128,30 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = col_sum2 = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				   incaij / 2, trans == blas_conj_trans,
+				   head_x_i + kx, blas_gemm_elt_s, incx);
+	col_sum2 = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				    incaij / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_s, incx);
+      }
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c, incai / 2,
+				   trans == blas_conj_trans, head_x_i + kx,
+				   blas_gemm_elt_s, incx, 0);
+	col_sum2 = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c,
+				    incai / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_s, incx, 0);
+      }
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -1201,184 +1229,147 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = head_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = tail_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -1466,184 +1457,147 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = head_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = tail_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -1665,20 +1619,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -1689,20 +1633,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -1748,20 +1682,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -1772,20 +1696,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -1849,20 +1763,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -1873,20 +1777,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -1932,20 +1826,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -1956,20 +1840,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2102,184 +1976,147 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = head_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = tail_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -2437,231 +2274,194 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		  tail_tmp2[0] = tail_t;
 		  /* Imaginary part */
 		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_tmp1[1];
-		  tail_b = tail_tmp1[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp2[1] = head_t;
-		  tail_tmp2[1] = tail_t;
-		}
-		y_i[iy] = head_tmp2[0];
-		y_i[iy + 1] = head_tmp2[1];
-		ai += incai;
-		iy += incy;
-	      }
-	    } else {		/* alpha != 1, the most general form: y =
-				 * alpha*A*head_x + alpha*A*tail_x + beta*y */
-	      ai = 0;
-	      iy = ky;
-	      for (i = 0; i < leny; i++) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
-		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
-		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		  tail_a = tail_sum[1];
+		  head_b = head_tmp1[1];
+		  tail_b = tail_tmp1[1];
+		  {
+		    /* Compute double-double = double-double + double-double. */
+		    double	    bv;
+		    double	    s1  , s2, t1, t2;
 
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add two lo words. */
+		    t1 = tail_a + tail_b;
+		    bv = t1 - tail_a;
+		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		      s2 += t1;
+		    s2 += t1;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
 
-		      t2 += s2;
+		    t2 += s2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		    /* Renormalize (t1, t2)  */
+		    head_t = t1 + t2;
+		    tail_t = t2 - (head_t - t1);
+		  }
+		  head_tmp2[1] = head_t;
+		  tail_tmp2[1] = tail_t;
+		}
+		y_i[iy] = head_tmp2[0];
+		y_i[iy + 1] = head_tmp2[1];
+		ai += incai;
+		iy += incy;
+	      }
+	    } else {		/* alpha != 1, the most general form: y =
+				 * alpha*A*head_x + alpha*A*tail_x + beta*y */
+	      ai = 0;
+	      iy = ky;
+	      for (i = 0; i < leny; i++) {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
+		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
+		aij = ai;
+		jx = kx;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = head_x_i[jx];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem = tail_x_i[jx];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -2683,20 +2483,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2707,20 +2497,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2766,20 +2546,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2790,20 +2560,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2867,20 +2627,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2891,20 +2641,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2950,20 +2690,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2974,20 +2704,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -3244,184 +2964,147 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem = head_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = tail_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -3472,221 +3155,184 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    double	    s1  , s2, t1, t2;
 
 		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		y_i[iy] = head_sum[0];
-		y_i[iy + 1] = head_sum[1];
-		ai += incai;
-		iy += incy;
-	      }			/* end for */
-	    } else {		/* alpha != 1 */
-	      ai = 0;
-	      iy = ky;
-	      for (i = 0; i < leny; i++) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add two lo words. */
+		    t1 = tail_a + tail_b;
+		    bv = t1 - tail_a;
+		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		      s2 += t1;
+		    s2 += t1;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
 
-		      t2 += s2;
+		    t2 += s2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		    /* Renormalize (t1, t2)  */
+		    head_t = t1 + t2;
+		    tail_t = t2 - (head_t - t1);
+		  }
+		  head_sum[1] = head_t;
+		  tail_sum[1] = tail_t;
+		}
+		y_i[iy] = head_sum[0];
+		y_i[iy + 1] = head_sum[1];
+		ai += incai;
+		iy += incy;
+	      }			/* end for */
+	    } else {		/* alpha != 1 */
+	      ai = 0;
+	      iy = ky;
+	      for (i = 0; i < leny; i++) {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+		aij = ai;
+		jx = kx;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem = head_x_i[jx];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem = tail_x_i[jx];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -3708,20 +3354,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -3732,20 +3368,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -3791,20 +3417,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -3815,20 +3431,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -3892,20 +3498,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -3916,20 +3512,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -3975,20 +3561,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -3999,20 +3575,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -4145,184 +3711,147 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem = head_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = tail_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -4527,184 +4056,147 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem = head_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem = head_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem = tail_x_i[jx];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = tail_x_i[jx];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -4726,20 +4218,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -4750,20 +4232,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -4809,20 +4281,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -4833,20 +4295,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -4910,20 +4362,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -4934,20 +4376,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -4993,20 +4425,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5017,20 +4439,10 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5274,6 +4686,8 @@ void		BLAS_cgemv2_c_s_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
+      blas_free(col_sum2);
       FPU_FIX_STOP;
     }
     break;
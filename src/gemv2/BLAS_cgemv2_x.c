@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    		int		m       , int n, const void *alpha, const void *a, int lda,
     		const		void  *head_x, const void *tail_x, int incx,
@@ -593,6 +594,7 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -1119,6 +1121,8 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum2[2], tail_sum2[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
+      double         *col_sum2;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -1172,6 +1176,31 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = col_sum2 = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				   incaij / 2, trans == blas_conj_trans,
+				   head_x_i + kx, blas_gemm_elt_c, incx / 2);
+	col_sum2 = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				    incaij / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_c, incx / 2);
+      }
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c, incai / 2,
+				   trans == blas_conj_trans, head_x_i + kx,
+				   blas_gemm_elt_c, incx / 2, 0);
+	col_sum2 = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c,
+				    incai / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_c, incx / 2,
+				    0);
+      }
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -1249,256 +1278,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -1586,256 +1578,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -1857,20 +1812,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -1881,20 +1826,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -1940,20 +1875,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -1964,20 +1889,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2041,20 +1956,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2065,20 +1970,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2124,20 +2019,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2148,20 +2033,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2294,256 +2169,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -2715,289 +2553,252 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp2[1] = head_t;
-		  tail_tmp2[1] = tail_t;
-		}
-		y_i[iy] = head_tmp2[0];
-		y_i[iy + 1] = head_tmp2[1];
-		ai += incai;
-		iy += incy;
-	      }
-	    } else {		/* alpha != 1, the most general form: y =
-				 * alpha*A*head_x + alpha*A*tail_x + beta*y */
-	      ai = 0;
-	      iy = ky;
-	      for (i = 0; i < leny; i++) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
-		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
-		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    t1 = tail_a + tail_b;
+		    bv = t1 - tail_a;
+		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		      s2 += t1;
+		    s2 += t1;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
 
-		      t2 += s2;
+		    t2 += s2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		    /* Renormalize (t1, t2)  */
+		    head_t = t1 + t2;
+		    tail_t = t2 - (head_t - t1);
+		  }
+		  head_tmp2[1] = head_t;
+		  tail_tmp2[1] = tail_t;
+		}
+		y_i[iy] = head_tmp2[0];
+		y_i[iy + 1] = head_tmp2[1];
+		ai += incai;
+		iy += incy;
+	      }
+	    } else {		/* alpha != 1, the most general form: y =
+				 * alpha*A*head_x + alpha*A*tail_x + beta*y */
+	      ai = 0;
+	      iy = ky;
+	      for (i = 0; i < leny; i++) {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
+		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
+		aij = ai;
+		jx = kx;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
+		    {
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
+		    {
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -3019,20 +2820,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -3043,20 +2834,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -3102,20 +2883,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -3126,20 +2897,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -3203,20 +2964,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -3227,20 +2978,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -3286,20 +3027,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -3310,20 +3041,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -3580,256 +3301,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -3917,256 +3601,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
+		    {
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -4188,20 +3835,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -4212,20 +3849,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -4271,20 +3898,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -4295,20 +3912,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -4372,20 +3979,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -4396,20 +3993,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -4455,20 +4042,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -4479,20 +4056,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -4625,256 +4192,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -5079,256 +4609,219 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  cd     [2];
@@ -5350,20 +4843,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -5374,20 +4857,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -5433,20 +4906,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5457,20 +4920,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5534,20 +4987,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -5558,20 +5001,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -5617,20 +5050,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5641,20 +5064,10 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5898,6 +5311,8 @@ void		BLAS_cgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
+      blas_free(col_sum2);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 					int		m       , int n, double alpha, const float *a, int lda,
 					const		double *head_x, const double *tail_x, int incx,
@@ -61,6 +62,7 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -306,6 +308,8 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum2, tail_sum2;
       double	      head_tmp1, tail_tmp1;
       double	      head_tmp2, tail_tmp2;
+      double         *col_sum;
+      double         *col_sum2;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -359,6 +363,24 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = col_sum2 = NULL;
+      if (incai == 1 && alpha_i != 0.0) {
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_s, incaij, 0,
+				   head_x_i + kx, blas_gemm_elt_d, incx);
+	col_sum2 = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_s, incaij,
+				    0, tail_x_i + kx, blas_gemm_elt_d, incx);
+      }
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL && incaij == 1 && alpha_i != 0.0) {
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_s, incai, 0,
+				   head_x_i + kx, blas_gemm_elt_d, incx, 0);
+	col_sum2 = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_s, incai, 0,
+				    tail_x_i + kx, blas_gemm_elt_d, incx, 0);
+      }
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i == 0.0) {
 	if (beta_i == 0.0) {
@@ -373,19 +395,8 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	    y_elem = y_i[iy];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem * split;
-	      a1 = con - y_elem;
-	      a1 = con - a1;
-	      a2 = y_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp1 = y_elem * beta_i;
-	      tail_tmp1 = (((a1 * b1 - head_tmp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp1 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp1);
 	    }
 	    y_i[iy] = head_tmp1;
 	    iy += incy;
@@ -407,105 +418,72 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum2 = tail_sum2 = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = head_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
+	      if (col_sum != NULL && col_sum2 != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+		head_sum2 = col_sum2[2 * i];
+		tail_sum2 = col_sum2[2 * i + 1];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = head_x_i[jx];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
 		  }
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		x_elem = tail_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
 		  }
+		  x_elem = tail_x_i[jx];
+		  {
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum2 + head_prod;
+		    bv = s1 - head_sum2;
+		    s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum2 + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum2 = s1 + s2;
+		    tail_sum2 = s2 - (head_sum2 - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum2 + head_prod;
-		  bv = s1 - head_sum2;
-		  s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum2 + tail_prod;
-		  bv = t1 - tail_sum2;
-		  t2 = ((tail_prod - bv) + (tail_sum2 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum2 = t1 + t2;
-		  tail_sum2 = t2 - (head_sum2 - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -546,121 +524,79 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum2 = tail_sum2 = 0.0;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = head_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
+	      if (col_sum != NULL && col_sum2 != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+		head_sum2 = col_sum2[2 * i];
+		tail_sum2 = col_sum2[2 * i + 1];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = head_x_i[jx];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
 		  }
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		x_elem = tail_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
 		  }
+		  x_elem = tail_x_i[jx];
+		  {
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum2 + head_prod;
+		    bv = s1 - head_sum2;
+		    s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum2 + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum2 = s1 + s2;
+		    tail_sum2 = s2 - (head_sum2 - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum2 + head_prod;
-		  bv = s1 - head_sum2;
-		  s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum2 + tail_prod;
-		  bv = t1 - tail_sum2;
-		  t2 = ((tail_prod - bv) + (tail_sum2 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum2 = t1 + t2;
-		  tail_sum2 = t2 - (head_sum2 - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 		c2 = tail_sum * alpha_i;
 		t1 = c11 + c2;
@@ -671,19 +607,10 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum2 * split;
-		a11 = con - head_sum2;
-		a11 = con - a11;
-		a21 = head_sum2 - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum2 * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum2, alpha_i, c11);
 
 		c2 = tail_sum2 * alpha_i;
 		t1 = c11 + c2;
@@ -734,105 +661,72 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum2 = tail_sum2 = 0.0;;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = head_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
+	      if (col_sum != NULL && col_sum2 != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+		head_sum2 = col_sum2[2 * i];
+		tail_sum2 = col_sum2[2 * i + 1];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = head_x_i[jx];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
 		  }
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		x_elem = tail_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
 		  }
+		  x_elem = tail_x_i[jx];
+		  {
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum2 + head_prod;
+		    bv = s1 - head_sum2;
+		    s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum2 + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum2 = s1 + s2;
+		    tail_sum2 = s2 - (head_sum2 - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum2 + head_prod;
-		  bv = s1 - head_sum2;
-		  s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum2 + tail_prod;
-		  bv = t1 - tail_sum2;
-		  t2 = ((tail_prod - bv) + (tail_sum2 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum2 = t1 + t2;
-		  tail_sum2 = t2 - (head_sum2 - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -864,19 +758,8 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      y_elem = y_i[iy];
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem * split;
-		a1 = con - y_elem;
-		a1 = con - a1;
-		a2 = y_elem - a1;
-		con = beta_i * split;
-		b1 = con - beta_i;
-		b1 = con - b1;
-		b2 = beta_i - b1;
-
 		head_tmp1 = y_elem * beta_i;
-		tail_tmp1 = (((a1 * b1 - head_tmp1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_tmp1 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp1);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -918,121 +801,79 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      head_sum2 = tail_sum2 = 0.0;;
 	      aij = ai;
 	      jx = kx;
-	      for (j = 0; j < lenx; j++) {
-		a_elem = a_i[aij];
-
-		x_elem = head_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
+	      if (col_sum != NULL && col_sum2 != NULL) {
+		head_sum = col_sum[2 * i];
+		tail_sum = col_sum[2 * i + 1];
+		head_sum2 = col_sum2[2 * i];
+		tail_sum2 = col_sum2[2 * i + 1];
+	      } else {
+		for (j = 0; j < lenx; j++) {
+		  a_elem = a_i[aij];
+
+		  x_elem = head_x_i[jx];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
 		  }
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum + head_prod;
-		  bv = s1 - head_sum;
-		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum + tail_prod;
-		  bv = t1 - tail_sum;
-		  t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum = t1 + t2;
-		  tail_sum = t2 - (head_sum - t1);
-		}
-		x_elem = tail_x_i[jx];
-		{
-		  double	  dt = (double)a_elem;
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem * split;
-		    b1 = con - x_elem;
-		    b1 = con - b1;
-		    b2 = x_elem - b1;
-
-		    head_prod = dt * x_elem;
-		    tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum + head_prod;
+		    bv = s1 - head_sum;
+		    s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum = s1 + s2;
+		    tail_sum = s2 - (head_sum - s1);
 		  }
+		  x_elem = tail_x_i[jx];
+		  {
+		    double	  dt = (double)a_elem;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_prod = dt * x_elem;
+		      tail_prod = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod);
+		    }
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_sum2 + head_prod;
+		    bv = s1 - head_sum2;
+		    s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_sum2 + tail_prod;
+
+		    /* Renormalize (s1, s2)  */
+		    head_sum2 = s1 + s2;
+		    tail_sum2 = s2 - (head_sum2 - s1);
+		  }
+		  aij += incaij;
+		  jx += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_sum2 + head_prod;
-		  bv = s1 - head_sum2;
-		  s2 = ((head_prod - bv) + (head_sum2 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_sum2 + tail_prod;
-		  bv = t1 - tail_sum2;
-		  t2 = ((tail_prod - bv) + (tail_sum2 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_sum2 = t1 + t2;
-		  tail_sum2 = t2 - (head_sum2 - t1);
-		}
-		aij += incaij;
-		jx += incx;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 		c2 = tail_sum * alpha_i;
 		t1 = c11 + c2;
@@ -1043,19 +884,10 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum2 * split;
-		a11 = con - head_sum2;
-		a11 = con - a11;
-		a21 = head_sum2 - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum2 * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum2, alpha_i, c11);
 
 		c2 = tail_sum2 * alpha_i;
 		t1 = c11 + c2;
@@ -1094,19 +926,8 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 	      y_elem = y_i[iy];
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem * split;
-		a1 = con - y_elem;
-		a1 = con - a1;
-		a2 = y_elem - a1;
-		con = beta_i * split;
-		b1 = con - beta_i;
-		b1 = con - b1;
-		b2 = beta_i - b1;
-
 		head_tmp2 = y_elem * beta_i;
-		tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_tmp2 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -1144,6 +965,8 @@ void		BLAS_dgemv2_s_d_x(enum blas_order_type order, enum blas_trans_type trans,
 
       }
 
+      blas_free(col_sum);
+      blas_free(col_sum2);
       FPU_FIX_STOP;
     }
     break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 					int		m       , int n, const void *alpha, const void *a, int lda,
 		const		void  *head_x, const void *tail_x, int incx,
@@ -61,6 +62,7 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -587,6 +589,8 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum2[2], tail_sum2[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
+      double         *col_sum2;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -640,6 +644,31 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = col_sum2 = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				   incaij / 2, trans == blas_conj_trans,
+				   head_x_i + kx, blas_gemm_elt_c, incx / 2);
+	col_sum2 = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_c,
+				    incaij / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_c, incx / 2);
+      }
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c, incai / 2,
+				   trans == blas_conj_trans, head_x_i + kx,
+				   blas_gemm_elt_c, incx / 2, 0);
+	col_sum2 = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_c,
+				    incai / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_c, incx / 2,
+				    0);
+      }
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -661,35 +690,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -725,35 +732,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -807,256 +792,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -1144,256 +1092,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -1408,20 +1319,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1432,20 +1333,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1488,20 +1379,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1512,20 +1393,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1578,20 +1449,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1602,20 +1463,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1658,20 +1509,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1682,20 +1523,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1824,256 +1655,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -2157,35 +1951,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -2221,35 +1993,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -2368,256 +2118,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -2632,20 +2345,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2656,20 +2359,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2712,20 +2405,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2736,20 +2419,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2802,20 +2475,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2826,20 +2489,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2882,20 +2535,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2906,20 +2549,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3041,35 +2674,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -3105,35 +2716,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -3262,256 +2851,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -3599,256 +3151,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -3863,20 +3378,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3887,20 +3392,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3943,20 +3438,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3967,20 +3452,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4033,20 +3508,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -4057,20 +3522,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4113,20 +3568,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -4137,20 +3582,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4279,256 +3714,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -4612,35 +4010,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -4676,35 +4052,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -4823,256 +4177,219 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
-		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
-		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)a_elem[0] * x_elem[0];
-		    d2 = (double)-a_elem[1] * x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_prod[0] = head_e1;
-		    tail_prod[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)a_elem[0] * x_elem[1];
-		    d2 = (double)a_elem[1] * x_elem[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_e1;
-		    tail_prod[1] = tail_e1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)a_elem[0] * x_elem[0];
+		      d2 = (double)-a_elem[1] * x_elem[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[0] = head_e1;
+		      tail_prod[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)a_elem[0] * x_elem[1];
+		      d2 = (double)a_elem[1] * x_elem[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_prod[1] = head_e1;
+		      tail_prod[1] = tail_e1;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -5087,20 +4404,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5111,20 +4418,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5167,20 +4464,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5191,20 +4478,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5257,20 +4534,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5281,20 +4548,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5337,20 +4594,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5361,20 +4608,10 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5496,35 +4733,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -5560,35 +4775,13 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -5704,6 +4897,8 @@ void		BLAS_zgemv2_c_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
+      blas_free(col_sum2);
       FPU_FIX_STOP;
     }
     break;
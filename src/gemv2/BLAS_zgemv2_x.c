@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		    		int		m       , int n, const void *alpha, const void *a, int lda,
     		const		void  *head_x, const void *tail_x, int incx,
@@ -61,6 +62,7 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -587,6 +589,8 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum2[2], tail_sum2[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
+      double         *col_sum2;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -640,6 +644,31 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = col_sum2 = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_z,
+				   incaij / 2, trans == blas_conj_trans,
+				   head_x_i + kx, blas_gemm_elt_z, incx / 2);
+	col_sum2 = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_z,
+				    incaij / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_z, incx / 2);
+      }
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_z, incai / 2,
+				   trans == blas_conj_trans, head_x_i + kx,
+				   blas_gemm_elt_z, incx / 2, 0);
+	col_sum2 = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_z,
+				    incai / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_z, incx / 2,
+				    0);
+      }
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -661,35 +690,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -725,35 +732,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -807,454 +792,281 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -1342,454 +1154,281 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -1804,20 +1443,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1828,20 +1457,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1884,20 +1503,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1908,20 +1517,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1974,20 +1573,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1998,20 +1587,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2054,20 +1633,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2078,20 +1647,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2220,454 +1779,281 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -2751,35 +2137,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -2815,35 +2179,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -2937,479 +2279,306 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 
 		    /* Renormalize (s1, s2)  to  (t1, s2) */
 		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp2[1] = head_t;
-		  tail_tmp2[1] = tail_t;
-		}
-		y_i[iy] = head_tmp2[0];
-		y_i[iy + 1] = head_tmp2[1];
-		ai += incai;
-		iy += incy;
-	      }
-	    } else {		/* alpha != 1, the most general form: y =
-				 * alpha*A*head_x + alpha*A*tail_x + beta*y */
-	      ai = 0;
-	      iy = ky;
-	      for (i = 0; i < leny; i++) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
-		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
-		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		    s2 = s2 - (t1 - s1);
 
-		      t2 += s2;
+		    t2 += s2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
+		    /* Renormalize (t1, t2)  */
+		    head_t = t1 + t2;
+		    tail_t = t2 - (head_t - t1);
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		  head_tmp2[1] = head_t;
+		  tail_tmp2[1] = tail_t;
+		}
+		y_i[iy] = head_tmp2[0];
+		y_i[iy + 1] = head_tmp2[1];
+		ai += incai;
+		iy += incy;
+	      }
+	    } else {		/* alpha != 1, the most general form: y =
+				 * alpha*A*head_x + alpha*A*tail_x + beta*y */
+	      ai = 0;
+	      iy = ky;
+	      for (i = 0; i < leny; i++) {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;;
+		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
+		aij = ai;
+		jx = kx;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -3424,20 +2593,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3448,20 +2607,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3504,20 +2653,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3528,20 +2667,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3594,20 +2723,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3618,20 +2737,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3674,20 +2783,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3698,20 +2797,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3833,35 +2922,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -3897,35 +2964,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -4054,454 +3099,281 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -4579,464 +3451,291 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		y_i[iy] = head_sum[0];
 		y_i[iy + 1] = head_sum[1];
 		ai += incai;
-		iy += incy;
-	      }			/* end for */
-	    } else {		/* alpha != 1 */
-	      ai = 0;
-	      iy = ky;
-	      for (i = 0; i < leny; i++) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		iy += incy;
+	      }			/* end for */
+	    } else {		/* alpha != 1 */
+	      ai = 0;
+	      iy = ky;
+	      for (i = 0; i < leny; i++) {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+		aij = ai;
+		jx = kx;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -5051,20 +3750,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5075,20 +3764,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5131,20 +3810,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5155,20 +3824,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5221,20 +3880,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5245,20 +3894,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5301,20 +3940,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5325,20 +3954,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5467,454 +4086,281 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -5998,35 +4444,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -6062,35 +4486,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -6209,454 +4611,281 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
+		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -6671,20 +4900,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6695,20 +4914,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -6751,20 +4960,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6775,20 +4974,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -6841,20 +5030,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6865,20 +5044,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -6921,20 +5090,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6945,20 +5104,10 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7080,35 +5229,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -7144,35 +5271,13 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -7288,6 +5393,8 @@ void		BLAS_zgemv2_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
+      blas_free(col_sum2);
       FPU_FIX_STOP;
     }
     break;
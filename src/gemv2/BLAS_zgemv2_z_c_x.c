@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemv_cols.h"
 void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 					int		m       , int n, const void *alpha, const void *a, int lda,
 		const		void  *head_x, const void *tail_x, int incx,
@@ -61,6 +62,7 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -587,6 +589,8 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
       double	      head_sum2[2], tail_sum2[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *col_sum;
+      double         *col_sum2;
       FPU_FIX_DECL;
 
       /* all error calls */
@@ -640,6 +644,31 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
       else
 	ky = (1 - leny) * incy;
 
+      /* Columns of op(A) contiguous: sweep them into row sums. */
+      col_sum = col_sum2 = NULL;
+      if (incai == 2 && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_z,
+				   incaij / 2, trans == blas_conj_trans,
+				   head_x_i + kx, blas_gemm_elt_c, incx / 2);
+	col_sum2 = blas_gemv_cols_x(leny, lenx, a_i, blas_gemm_elt_z,
+				    incaij / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_c, incx / 2);
+      }
+
+      /* Rows of op(A) contiguous: on several threads, sum them in
+         panels. */
+      if (col_sum == NULL
+	  && incaij == 2
+	  && !(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	col_sum = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_z, incai / 2,
+				   trans == blas_conj_trans, head_x_i + kx,
+				   blas_gemm_elt_c, incx / 2, 0);
+	col_sum2 = blas_gemv_rows_x(leny, lenx, a_i, blas_gemm_elt_z,
+				    incai / 2, trans == blas_conj_trans,
+				    tail_x_i + kx, blas_gemm_elt_c, incx / 2,
+				    0);
+      }
+
       /* No extra-precision needed for alpha = 0 */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
@@ -661,35 +690,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -725,35 +732,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[1] * split;
-		a1 = con - y_elem[1];
-		a1 = con - a1;
-		a2 = y_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = y_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = y_elem[0] * split;
-		a1 = con - y_elem[0];
-		a1 = con - a1;
-		a2 = y_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = y_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -807,464 +792,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -1352,464 +1164,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -1824,20 +1463,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1848,20 +1477,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1904,20 +1523,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1928,20 +1537,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1994,20 +1593,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2018,20 +1607,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2074,20 +1653,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2098,20 +1667,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2240,464 +1799,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -2781,35 +2167,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -2845,35 +2209,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -2992,464 +2334,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -3464,20 +2633,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3488,20 +2647,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3544,20 +2693,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3568,20 +2707,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3634,20 +2763,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3658,20 +2777,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3714,20 +2823,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -3738,20 +2837,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -3873,35 +2962,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -3937,35 +3004,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -4093,465 +3138,292 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
-		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
-		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
-		      /* Imaginary part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		jx = kx;
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -4639,464 +3511,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -5111,20 +3810,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5135,20 +3824,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5191,20 +3870,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5215,20 +3884,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5281,20 +3940,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5305,20 +3954,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5361,20 +4000,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5385,20 +4014,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5527,464 +4146,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  double	  head_t, tail_t;
@@ -6068,35 +4514,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -6132,35 +4556,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -6279,464 +4681,291 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;;
 		aij = ai;
 		jx = kx;
-		for (j = 0; j < lenx; j++) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = head_x_i[jx];
-		  x_elem[1] = head_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
+		if (col_sum != NULL && col_sum2 != NULL) {
+		  head_sum[0] = col_sum[4 * i];
+		  head_sum[1] = col_sum[4 * i + 1];
+		  tail_sum[0] = col_sum[4 * i + 2];
+		  tail_sum[1] = col_sum[4 * i + 3];
+		  head_sum2[0] = col_sum2[4 * i];
+		  head_sum2[1] = col_sum2[4 * i + 1];
+		  tail_sum2[0] = col_sum2[4 * i + 2];
+		  tail_sum2[1] = col_sum2[4 * i + 3];
+		} else {
+		  for (j = 0; j < lenx; j++) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = head_x_i[jx];
+		    x_elem[1] = head_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
+		    x_elem[0] = tail_x_i[jx];
+		    x_elem[1] = tail_x_i[jx + 1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    cd   [2];
+		      cd[0] = (double)x_elem[0];
+		      cd[1] = (double)x_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = a_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = a_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		  x_elem[0] = tail_x_i[jx];
-		  x_elem[1] = tail_x_i[jx + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)x_elem[0];
-		    cd[1] = (double)x_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum2[0];
+		      tail_a = tail_sum2[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum2[0] = head_t;
+		      tail_sum2[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum2[1];
+		      tail_a = tail_sum2[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[1] * split;
-			a1 = con - a_elem[1];
-			a1 = con - a1;
-			a2 = a_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = a_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = a_elem[0] * split;
-			a1 = con - a_elem[0];
-			a1 = con - a1;
-			a2 = a_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = a_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
+		      head_sum2[1] = head_t;
+		      tail_sum2[1] = tail_t;
 		    }
+		    aij += incaij;
+		    jx += incx;
 		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum2[0];
-		    tail_a = tail_sum2[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[0] = head_t;
-		    tail_sum2[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum2[1];
-		    tail_a = tail_sum2[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum2[1] = head_t;
-		    tail_sum2[1] = tail_t;
-		  }
-		  aij += incaij;
-		  jx += incx;
 		}
 		{
 		  /* Compute complex-extra = complex-extra * complex-double. */
@@ -6751,20 +4980,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6775,20 +4994,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -6831,20 +5040,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6855,20 +5054,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -6921,20 +5110,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -6945,20 +5124,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7001,20 +5170,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -7025,20 +5184,10 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7160,35 +5309,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -7224,35 +5351,13 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -7368,6 +5473,8 @@ void		BLAS_zgemv2_z_c_x(enum blas_order_type order, enum blas_trans_type trans,
 	}
       }
 
+      blas_free(col_sum);
+      blas_free(col_sum2);
       FPU_FIX_STOP;
     }
     break;
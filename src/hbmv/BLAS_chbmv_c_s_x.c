@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		 		enum		blas_uplo_type uplo, int n, int k,
 	      		const		void  *alpha, const void *a, int lda,
@@ -625,7 +626,8 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
 
       /* Integer Index Variables */
       int	      i    , j;
@@ -1150,6 +1152,7 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *row_sum;
       FPU_FIX_DECL;
 
 
@@ -1213,6 +1216,13 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored band into row sums. */
+      row_sum = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	row_sum = blas_sbmv_lines_x(order, uplo, 1, n, k, a_i, blas_gemm_elt_c,
+				    lda, x_i + x_starti, blas_gemm_elt_s,
+				    incx);
+
       /* alpha = 0.  In this case, just return beta * y */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
@@ -1286,206 +1296,99 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
 	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
 
-		  x_elem = x_i[xi];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = x_i[xi];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem = x_i[xi];
-		head_prod[0] = (double)x_elem *a_elem[0];
-		head_prod[1] = 0.0;
-		tail_prod[0] = tail_prod[1] = 0.0;
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
 		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
 		  x_elem = x_i[xi];
+		  head_prod[0] = (double)x_elem *a_elem[0];
+		  head_prod[1] = 0.0;
+		  tail_prod[0] = tail_prod[1] = 0.0;
 		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1517,12 +1420,9 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1549,6 +1449,75 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = x_i[xi];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		}
 		y_i[yi] = head_sum[0];
 		y_i[yi + 1] = head_sum[1];
@@ -1569,36 +1538,100 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 	       * beta * y
 	       */
 	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
 
-		  x_elem = x_i[xi];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
+		    x_elem = x_i[xi];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
 		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem = x_i[xi];
+		  head_prod[0] = (double)x_elem *a_elem[0];
+		  head_prod[1] = 0.0;
+		  tail_prod[0] = tail_prod[1] = 0.0;
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1630,12 +1663,9 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1662,21 +1692,132 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = x_i[xi];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		}
-		a_elem[0] = a_i[aij];
-		x_elem = x_i[xi];
-		head_prod[0] = (double)x_elem *a_elem[0];
-		head_prod[1] = 0.0;
-		tail_prod[0] = tail_prod[1] = 0.0;
+		y_elem[0] = y_i[yi];
+		y_elem[1] = y_i[yi + 1];
+		{
+		  double	  head_e1, tail_e1;
+		  double	  d1;
+		  double	  d2;
+		  /* Real part */
+		  d1 = (double)y_elem[0] * beta_i[0];
+		  d2 = (double)-y_elem[1] * beta_i[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	    e   , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_tmp2[0] = head_e1;
+		  tail_tmp2[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)y_elem[0] * beta_i[1];
+		  d2 = (double)y_elem[1] * beta_i[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	    e   , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_tmp2[1] = head_e1;
+		  tail_tmp2[1] = tail_e1;
+		}
+		head_tmp1[0] = head_sum[0];
+		tail_tmp1[0] = tail_sum[0];
+		head_tmp1[1] = head_sum[1];
+		tail_tmp1[1] = tail_sum[1];
 		{
 		  double	  head_t, tail_t;
 		  double	  head_a, tail_a;
 		  double	  head_b, tail_b;
 		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  head_a = head_tmp2[0];
+		  tail_a = tail_tmp2[0];
+		  head_b = head_tmp1[0];
+		  tail_b = tail_tmp1[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
@@ -1704,13 +1845,13 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
+		  head_tmp1[0] = head_t;
+		  tail_tmp1[0] = tail_t;
 		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
+		  head_a = head_tmp2[1];
+		  tail_a = tail_tmp2[1];
+		  head_b = head_tmp1[1];
+		  tail_b = tail_tmp1[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
@@ -1738,15 +1879,39 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  head_tmp1[1] = head_t;
+		  tail_tmp1[1] = tail_t;
 		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		y_i[yi] = head_tmp1[0];
+		y_i[yi + 1] = head_tmp1[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    }
+	  } else {
+	    /* The most general form,   y <--- alpha * A * x + beta * y */
+	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+	      if (row_sum != NULL) {
+		head_sum[0] = row_sum[4 * i];
+		head_sum[1] = row_sum[4 * i + 1];
+		tail_sum[0] = row_sum[4 * i + 2];
+		tail_sum[1] = row_sum[4 * i + 3];
+	      } else {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		for (j = 0, aij = astarti, xi = x_starti;
+		     j < maxj_first; j++, aij += incaij, xi += incx) {
 		  a_elem[0] = a_i[aij];
 		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
+
 		  x_elem = x_i[xi];
 		  {
 		    head_prod[0] = (double)a_elem[0] * x_elem;
@@ -1755,43 +1920,31 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    tail_prod[1] = 0.0;
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[0] = head_t;
 		    tail_sum[0] = tail_t;
@@ -1801,194 +1954,36 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
 		}
-		y_elem[0] = y_i[yi];
-		y_elem[1] = y_i[yi + 1];
-		{
-		  double	  head_e1, tail_e1;
-		  double	  d1;
-		  double	  d2;
-		  /* Real part */
-		  d1 = (double)y_elem[0] * beta_i[0];
-		  d2 = (double)-y_elem[1] * beta_i[1];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_tmp2[0] = head_e1;
-		  tail_tmp2[0] = tail_e1;
-		  /* imaginary part */
-		  d1 = (double)y_elem[0] * beta_i[1];
-		  d2 = (double)y_elem[1] * beta_i[0];
-		  {
-		    /* Compute double-double = double + double. */
-		    double	    e   , t1, t2;
-
-		    /* Knuth trick. */
-		    t1 = d1 + d2;
-		    e = t1 - d1;
-		    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		    /* The result is t1 + t2, after normalization. */
-		    head_e1 = t1 + t2;
-		    tail_e1 = t2 - (head_e1 - t1);
-		  }
-		  head_tmp2[1] = head_e1;
-		  tail_tmp2[1] = tail_e1;
-		}
-		head_tmp1[0] = head_sum[0];
-		tail_tmp1[0] = tail_sum[0];
-		head_tmp1[1] = head_sum[1];
-		tail_tmp1[1] = tail_sum[1];
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_tmp2[0];
-		  tail_a = tail_tmp2[0];
-		  head_b = head_tmp1[0];
-		  tail_b = tail_tmp1[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[0] = head_t;
-		  tail_tmp1[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_tmp2[1];
-		  tail_a = tail_tmp2[1];
-		  head_b = head_tmp1[1];
-		  tail_b = tail_tmp1[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[1] = head_t;
-		  tail_tmp1[1] = tail_t;
-		}
-		y_i[yi] = head_tmp1[0];
-		y_i[yi + 1] = head_tmp1[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    }
-	  } else {
-	    /* The most general form,   y <--- alpha * A * x + beta * y */
-	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	      for (j = 0, aij = astarti, xi = x_starti;
-		   j < maxj_first; j++, aij += incaij, xi += incx) {
 		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-
 		x_elem = x_i[xi];
+		head_prod[0] = (double)x_elem *a_elem[0];
+		head_prod[1] = 0.0;
+		tail_prod[0] = tail_prod[1] = 0.0;
 		{
-		  head_prod[0] = (double)a_elem[0] * x_elem;
-		  tail_prod[0] = 0.0;
-		  head_prod[1] = (double)a_elem[1] * x_elem;
-		  tail_prod[1] = 0.0;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
 		  /* Real part */
 		  head_a = head_sum[0];
 		  tail_a = tail_sum[0];
@@ -1996,8 +1991,8 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  tail_b = tail_prod[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -2030,8 +2025,8 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  tail_b = tail_prod[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -2058,170 +2053,74 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  head_sum[1] = head_t;
 		  tail_sum[1] = tail_t;
 		}
-	      }
-	      a_elem[0] = a_i[aij];
-	      x_elem = x_i[xi];
-	      head_prod[0] = (double)x_elem *a_elem[0];
-	      head_prod[1] = 0.0;
-	      tail_prod[0] = tail_prod[1] = 0.0;
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		aij += incaij2;
+		xi += incx;
+		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+		  a_elem[1] = -a_elem[1];
+		  x_elem = x_i[xi];
+		  {
+		    head_prod[0] = (double)a_elem[0] * x_elem;
+		    tail_prod[0] = 0.0;
+		    head_prod[1] = (double)a_elem[1] * x_elem;
+		    tail_prod[1] = 0.0;
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	      aij += incaij2;
-	      xi += incx;
-	      for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem = x_i[xi];
-		{
-		  head_prod[0] = (double)a_elem[0] * x_elem;
-		  tail_prod[0] = 0.0;
-		  head_prod[1] = (double)a_elem[1] * x_elem;
-		  tail_prod[1] = 0.0;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
 		}
 	      }
 	      y_elem[0] = y_i[yi];
@@ -2284,20 +2183,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -2308,20 +2197,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -2364,20 +2243,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -2388,20 +2257,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -2538,35 +2397,99 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
 	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = x_i[xi];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
 		  x_elem = x_i[xi];
+		  head_prod[0] = (double)x_elem *a_elem[0];
+		  head_prod[1] = 0.0;
+		  tail_prod[0] = tail_prod[1] = 0.0;
 		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -2598,12 +2521,9 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -2630,176 +2550,74 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem = x_i[xi];
-		head_prod[0] = (double)x_elem *a_elem[0];
-		head_prod[1] = 0.0;
-		tail_prod[0] = tail_prod[1] = 0.0;
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
 
-		  x_elem = x_i[xi];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		    x_elem = x_i[xi];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
 		  }
 		}
 		y_i[yi] = head_sum[0];
@@ -2821,207 +2639,100 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 	       * beta * y
 	       */
 	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem = x_i[xi];
-		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem = x_i[xi];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
 		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem = x_i[xi];
-		head_prod[0] = (double)x_elem *a_elem[0];
-		head_prod[1] = 0.0;
-		tail_prod[0] = tail_prod[1] = 0.0;
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
 		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
 		  x_elem = x_i[xi];
+		  head_prod[0] = (double)x_elem *a_elem[0];
+		  head_prod[1] = 0.0;
+		  tail_prod[0] = tail_prod[1] = 0.0;
 		  {
-		    head_prod[0] = (double)a_elem[0] * x_elem;
-		    tail_prod[0] = 0.0;
-		    head_prod[1] = (double)a_elem[1] * x_elem;
-		    tail_prod[1] = 0.0;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -3053,12 +2764,9 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -3085,6 +2793,75 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem = x_i[xi];
+		    {
+		      head_prod[0] = (double)a_elem[0] * x_elem;
+		      tail_prod[0] = 0.0;
+		      head_prod[1] = (double)a_elem[1] * x_elem;
+		      tail_prod[1] = 0.0;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		}
 		y_elem[0] = y_i[yi];
 		y_elem[1] = y_i[yi + 1];
@@ -3223,24 +3000,91 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 	  } else {
 	    /* The most general form,   y <--- alpha * A * x + beta * y */
 	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+	      if (row_sum != NULL) {
+		head_sum[0] = row_sum[4 * i];
+		head_sum[1] = row_sum[4 * i + 1];
+		tail_sum[0] = row_sum[4 * i + 2];
+		tail_sum[1] = row_sum[4 * i + 3];
+	      } else {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 
-	      for (j = 0, aij = astarti, xi = x_starti;
-		   j < maxj_first; j++, aij += incaij, xi += incx) {
+		for (j = 0, aij = astarti, xi = x_starti;
+		     j < maxj_first; j++, aij += incaij, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+		  a_elem[1] = -a_elem[1];
+		  x_elem = x_i[xi];
+		  {
+		    head_prod[0] = (double)a_elem[0] * x_elem;
+		    tail_prod[0] = 0.0;
+		    head_prod[1] = (double)a_elem[1] * x_elem;
+		    tail_prod[1] = 0.0;
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		}
 		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
 		x_elem = x_i[xi];
+		head_prod[0] = (double)x_elem *a_elem[0];
+		head_prod[1] = 0.0;
+		tail_prod[0] = tail_prod[1] = 0.0;
 		{
-		  head_prod[0] = (double)a_elem[0] * x_elem;
-		  tail_prod[0] = 0.0;
-		  head_prod[1] = (double)a_elem[1] * x_elem;
-		  tail_prod[1] = 0.0;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
 		  /* Real part */
 		  head_a = head_sum[0];
 		  tail_a = tail_sum[0];
@@ -3248,8 +3092,8 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  tail_b = tail_prod[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -3282,8 +3126,8 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  tail_b = tail_prod[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -3310,170 +3154,74 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  head_sum[1] = head_t;
 		  tail_sum[1] = tail_t;
 		}
-	      }
-	      a_elem[0] = a_i[aij];
-	      x_elem = x_i[xi];
-	      head_prod[0] = (double)x_elem *a_elem[0];
-	      head_prod[1] = 0.0;
-	      tail_prod[0] = tail_prod[1] = 0.0;
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	      aij += incaij2;
-	      xi += incx;
-	      for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
+		aij += incaij2;
+		xi += incx;
+		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
 
-		x_elem = x_i[xi];
-		{
-		  head_prod[0] = (double)a_elem[0] * x_elem;
-		  tail_prod[0] = 0.0;
-		  head_prod[1] = (double)a_elem[1] * x_elem;
-		  tail_prod[1] = 0.0;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  x_elem = x_i[xi];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_prod[0] = (double)a_elem[0] * x_elem;
+		    tail_prod[0] = 0.0;
+		    head_prod[1] = (double)a_elem[1] * x_elem;
+		    tail_prod[1] = 0.0;
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
 		}
 	      }
 	      y_elem[0] = y_i[yi];
@@ -3536,20 +3284,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -3560,20 +3298,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -3616,20 +3344,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -3640,20 +3358,10 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -3783,6 +3491,7 @@ void		BLAS_chbmv_c_s_x(enum blas_order_type order,
 	  }
 	}
       }
+      blas_free(row_sum);
       FPU_FIX_STOP;
 
       break;
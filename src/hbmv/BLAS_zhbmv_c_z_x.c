@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		 		enum		blas_uplo_type uplo, int n, int k,
 	      		const		void  *alpha, const void *a, int lda,
@@ -124,7 +125,8 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
 
       /* Integer Index Variables */
       int	      i    , j;
@@ -680,6 +682,7 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *row_sum;
       FPU_FIX_DECL;
 
 
@@ -744,6 +747,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored band into row sums. */
+      row_sum = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	row_sum = blas_sbmv_lines_x(order, uplo, 1, n, k, a_i, blas_gemm_elt_c,
+				    lda, x_i + x_starti, blas_gemm_elt_z,
+				    incx / 2);
+
       /* alpha = 0.  In this case, just return beta * y */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
@@ -756,35 +766,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
 	      head_t1 = y_elem[0] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
 	      head_t2 = y_elem[1] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	    }
 	    head_t2 = -head_t2;
 	    tail_t2 = -tail_t2;
@@ -820,35 +808,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 	    /* Imaginary part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
 	      head_t1 = y_elem[1] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
 	      head_t2 = y_elem[0] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
@@ -907,175 +873,596 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
 	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		  a_elem[0] = a_i[aij];
 		  x_elem[0] = x_i[xi];
 		  x_elem[1] = x_i[xi + 1];
 		  {
-		    double	    cd   [2];
-		    cd[0] = (double)a_elem[0];
-		    cd[1] = (double)a_elem[1];
+		    double	  dt = (double)a_elem[0];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			head_t = dt * x_elem[0];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[0], head_t);
 		      }
+		      head_prod[0] = head_t;
+		      tail_prod[0] = tail_t;
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			head_t = dt * x_elem[1];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[1], head_t);
+		      }
+		      head_prod[1] = head_t;
+		      tail_prod[1] = tail_t;
+		    }
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+		      /* Add two lo words. */
+		      t1 = tail_a + tail_b;
+		      bv = t1 - tail_a;
+		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		      s2 += t1;
+
+		      /* Renormalize (s1, s2)  to  (t1, s2) */
+		      t1 = s1 + s2;
+		      s2 = s2 - (t1 - s1);
+
+		      t2 += s2;
+
+		      /* Renormalize (t1, t2)  */
+		      head_t = t1 + t2;
+		      tail_t = t2 - (head_t - t1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add two lo words. */
+		      t1 = tail_a + tail_b;
+		      bv = t1 - tail_a;
+		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			s2 += t1;
+		      s2 += t1;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+		      /* Renormalize (s1, s2)  to  (t1, s2) */
+		      t1 = s1 + s2;
+		      s2 = s2 - (t1 - s1);
 
-			t2 += s2;
+		      t2 += s2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (t1, t2)  */
+		      head_t = t1 + t2;
+		      tail_t = t2 - (head_t - t1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
-		      /* Imaginary part */
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		}
+		y_i[yi] = head_sum[0];
+		y_i[yi + 1] = head_sum[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    } else {
+	      /*
+	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
+	       * beta * y
+	       */
+	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			s2 += t1;
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    double	  dt = (double)a_elem[0];
+		    {
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = dt * x_elem[0];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[0], head_t);
+		      }
+		      head_prod[0] = head_t;
+		      tail_prod[0] = tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = dt * x_elem[1];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[1], head_t);
+		      }
+		      head_prod[1] = head_t;
+		      tail_prod[1] = tail_t;
 		    }
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1107,12 +1494,9 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1139,74 +1523,262 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  dt = (double)a_elem[0];
-		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t = dt * x_elem[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_prod[0] = head_t;
-		    tail_prod[0] = tail_t;
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      head_t = dt * x_elem[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
-		    head_prod[1] = head_t;
-		    tail_prod[1] = tail_t;
 		  }
 		}
+		y_elem[0] = y_i[yi];
+		y_elem[1] = y_i[yi + 1];
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double	  head_t1, tail_t1;
+		  double	  head_t2, tail_t2;
 		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = y_elem[0] * beta_i[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = y_elem[1] * beta_i[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
 		    double	    s1  , s2, t1, t2;
 
 		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
+		    t1 = tail_t1 + tail_t2;
+		    bv = t1 - tail_t1;
+		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		    s2 += t1;
+
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
+
+		    t2 += s2;
+
+		    /* Renormalize (t1, t2)  */
+		    head_t1 = t1 + t2;
+		    tail_t1 = t2 - (head_t1 - t1);
+		  }
+		  head_tmp2[0] = head_t1;
+		  tail_tmp2[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = y_elem[1] * beta_i[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
+		  }
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t2 = y_elem[0] * beta_i[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double. */
+		    double	    bv;
+		    double	    s1  , s2, t1, t2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		    /* Add two lo words. */
+		    t1 = tail_t1 + tail_t2;
+		    bv = t1 - tail_t1;
+		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		    s2 += t1;
+
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
+
+		    t2 += s2;
+
+		    /* Renormalize (t1, t2)  */
+		    head_t1 = t1 + t2;
+		    tail_t1 = t2 - (head_t1 - t1);
+		  }
+		  head_tmp2[1] = head_t1;
+		  tail_tmp2[1] = tail_t1;
+		}
+		head_tmp1[0] = head_sum[0];
+		tail_tmp1[0] = tail_sum[0];
+		head_tmp1[1] = head_sum[1];
+		tail_tmp1[1] = tail_sum[1];
+		{
+		  double	  head_t, tail_t;
+		  double	  head_a, tail_a;
+		  double	  head_b, tail_b;
+		  /* Real part */
+		  head_a = head_tmp2[0];
+		  tail_a = tail_tmp2[0];
+		  head_b = head_tmp1[0];
+		  tail_b = tail_tmp1[0];
+		  {
+		    /* Compute double-double = double-double + double-double. */
+		    double	    bv;
+		    double	    s1  , s2, t1, t2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add two lo words. */
+		    t1 = tail_a + tail_b;
 		    bv = t1 - tail_a;
 		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
@@ -1222,13 +1794,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
+		  head_tmp1[0] = head_t;
+		  tail_tmp1[0] = tail_t;
 		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
+		  head_a = head_tmp2[1];
+		  tail_a = tail_tmp2[1];
+		  head_b = head_tmp1[1];
+		  tail_b = tail_tmp1[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
@@ -1256,19 +1828,43 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  head_tmp1[1] = head_t;
+		  tail_tmp1[1] = tail_t;
 		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		y_i[yi] = head_tmp1[0];
+		y_i[yi + 1] = head_tmp1[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    }
+	  } else {
+	    /* The most general form,   y <--- alpha * A * x + beta * y */
+	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+	      if (row_sum != NULL) {
+		head_sum[0] = row_sum[4 * i];
+		head_sum[1] = row_sum[4 * i + 1];
+		tail_sum[0] = row_sum[4 * i + 2];
+		tail_sum[1] = row_sum[4 * i + 3];
+	      } else {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		for (j = 0, aij = astarti, xi = x_starti;
+		     j < maxj_first; j++, aij += incaij, xi += incx) {
 		  a_elem[0] = a_i[aij];
 		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
+
 		  x_elem[0] = x_i[xi];
 		  x_elem[1] = x_i[xi + 1];
 		  {
-		    double	    cd   [2];
+		    double	  cd     [2];
 		    cd[0] = (double)a_elem[0];
 		    cd[1] = (double)a_elem[1];
 		    {
@@ -1276,180 +1872,100 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		       * Compute complex-extra = complex-double *
 		       * complex-double.
 		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
 			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
 			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_prod[0] = head_t1;
 		      tail_prod[0] = tail_t1;
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
 			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
 			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_prod[1] = head_t1;
 		      tail_prod[1] = tail_t1;
 		    }
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[0] = head_t;
 		    tail_sum[0] = tail_t;
@@ -1459,363 +1975,76 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
 		}
-		y_i[yi] = head_sum[0];
-		y_i[yi + 1] = head_sum[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    } else {
-	      /*
-	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
-	       * beta * y
-	       */
-	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
+		a_elem[0] = a_i[aij];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		{
+		  double		dt = (double)a_elem[0];
 		  {
-		    double	    cd   [2];
-		    cd[0] = (double)a_elem[0];
-		    cd[1] = (double)a_elem[1];
+		    /* Compute complex-extra = complex-double * real. */
+		    double	  head_t, tail_t;
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+		      /* Compute double_double = double * double. */
+		      head_t = dt * x_elem[0];
+		      tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[0], head_t);
+		    }
+		    head_prod[0] = head_t;
+		    tail_prod[0] = tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = dt * x_elem[1];
+		      tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[1], head_t);
+		    }
+		    head_prod[1] = head_t;
+		    tail_prod[1] = tail_t;
+		  }
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sum[0];
+		  tail_a = tail_sum[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double. */
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+		    /* Add two lo words. */
+		    t1 = tail_a + tail_b;
+		    bv = t1 - tail_a;
+		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
-		      /* Imaginary part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  dt = (double)a_elem[0];
-		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t = dt * x_elem[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_prod[0] = head_t;
-		    tail_prod[0] = tail_t;
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t = dt * x_elem[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_prod[1] = head_t;
-		    tail_prod[1] = tail_t;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		    s2 += t1;
 
 		    /* Renormalize (s1, s2)  to  (t1, s2) */
 		    t1 = s1 + s2;
@@ -1836,8 +2065,8 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  tail_b = tail_prod[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -1873,7 +2102,7 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  x_elem[0] = x_i[xi];
 		  x_elem[1] = x_i[xi + 1];
 		  {
-		    double	    cd   [2];
+		    double	  cd     [2];
 		    cd[0] = (double)a_elem[0];
 		    cd[1] = (double)a_elem[1];
 		    {
@@ -1881,180 +2110,100 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		       * Compute complex-extra = complex-double *
 		       * complex-double.
 		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
 			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
 			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_prod[0] = head_t1;
 		      tail_prod[0] = tail_t1;
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
 			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
 			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_prod[1] = head_t1;
 		      tail_prod[1] = tail_t1;
 		    }
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[0] = head_t;
 		    tail_sum[0] = tail_t;
@@ -2064,549 +2213,256 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
 		}
-		y_elem[0] = y_i[yi];
-		y_elem[1] = y_i[yi + 1];
+	      }
+	      y_elem[0] = y_i[yi];
+	      y_elem[1] = y_i[yi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double		head_t1, tail_t1;
+		double		head_t2, tail_t2;
+		/* Real part */
 		{
-		  /* Compute complex-extra = complex-double * complex-double. */
-		  double	  head_t1, tail_t1;
-		  double	  head_t2, tail_t2;
-		  /* Real part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Compute double_double = double * double. */
+		  head_t1 = y_elem[0] * beta_i[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = y_elem[1] * beta_i[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
-		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_t2 = -head_t2;
-		  tail_t2 = -tail_t2;
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		  s2 += t1;
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    s2 += t1;
+		  t2 += s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		head_tmp2[0] = head_t1;
+		tail_tmp2[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = y_elem[1] * beta_i[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = y_elem[0] * beta_i[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    t2 += s2;
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_tmp2[0] = head_t1;
-		  tail_tmp2[0] = tail_t1;
-		  /* Imaginary part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
+		  s2 += t1;
 
-		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
+		  t2 += s2;
 
-		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		head_tmp2[1] = head_t1;
+		tail_tmp2[1] = tail_t1;
+	      }
+	      {
+		/* Compute complex-extra = complex-extra * complex-double. */
+		double		head_a0, tail_a0;
+		double		head_a1, tail_a1;
+		double		head_t1, tail_t1;
+		double		head_t2, tail_t2;
+		head_a0 = head_sum[0];
+		tail_a0 = tail_sum[0];
+		head_a1 = head_sum[1];
+		tail_a1 = tail_sum[1];
+		/* real part */
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		  c11 = head_a0 * alpha_i[0];
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		  c2 = tail_a0 * alpha_i[0];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
 
-		    s2 += t1;
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  c11 = head_a1 * alpha_i[1];
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-		    t2 += s2;
+		  c2 = tail_a1 * alpha_i[1];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_tmp2[1] = head_t1;
-		  tail_tmp2[1] = tail_t1;
+		  head_t2 = t1 + t2;
+		  tail_t2 = t2 - (head_t2 - t1);
 		}
-		head_tmp1[0] = head_sum[0];
-		tail_tmp1[0] = tail_sum[0];
-		head_tmp1[1] = head_sum[1];
-		tail_tmp1[1] = tail_sum[1];
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_tmp2[0];
-		  tail_a = tail_tmp2[0];
-		  head_b = head_tmp1[0];
-		  tail_b = tail_tmp1[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    s2 += t1;
+		  s2 += t1;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    t2 += s2;
+		  t2 += s2;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[0] = head_t;
-		  tail_tmp1[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_tmp2[1];
-		  tail_a = tail_tmp2[1];
-		  head_b = head_tmp1[1];
-		  tail_b = tail_tmp1[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		head_tmp1[0] = head_t1;
+		tail_tmp1[0] = tail_t1;
+		/* imaginary part */
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  c11 = head_a1 * alpha_i[0];
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  c2 = tail_a1 * alpha_i[0];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
 
-		    s2 += t1;
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  c11 = head_a0 * alpha_i[1];
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-		    t2 += s2;
+		  c2 = tail_a0 * alpha_i[1];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[1] = head_t;
-		  tail_tmp1[1] = tail_t;
-		}
-		y_i[yi] = head_tmp1[0];
-		y_i[yi + 1] = head_tmp1[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    }
-	  } else {
-	    /* The most general form,   y <--- alpha * A * x + beta * y */
-	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	      for (j = 0, aij = astarti, xi = x_starti;
-		   j < maxj_first; j++, aij += incaij, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  cd     [2];
-		  cd[0] = (double)a_elem[0];
-		  cd[1] = (double)a_elem[1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[0] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[1] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[1] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[0] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
+		  head_t2 = t1 + t2;
+		  tail_t2 = t2 - (head_t2 - t1);
 		}
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    s2 += t1;
+		  s2 += t1;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    t2 += s2;
+		  t2 += s2;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-	      }
-	      a_elem[0] = a_i[aij];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		double		dt = (double)a_elem[0];
-		{
-		  /* Compute complex-extra = complex-double * real. */
-		  double	  head_t, tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t = dt * x_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[0] = head_t;
-		  tail_prod[0] = tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t = dt * x_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[1] = head_t;
-		  tail_prod[1] = tail_t;
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
 		}
+		head_tmp1[1] = head_t1;
+		tail_tmp1[1] = tail_t1;
 	      }
+
 	      {
 		double		head_t , tail_t;
 		double		head_a , tail_a;
 		double		head_b , tail_b;
 		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+		head_a = head_tmp2[0];
+		tail_a = tail_tmp2[0];
+		head_b = head_tmp1[0];
+		tail_b = tail_tmp1[0];
 		{
 		  /* Compute double-double = double-double + double-double. */
 		  double	  bv;
@@ -2634,13 +2490,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  head_t = t1 + t2;
 		  tail_t = t2 - (head_t - t1);
 		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
+		head_tmp1[0] = head_t;
+		tail_tmp1[0] = tail_t;
 		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
+		head_a = head_tmp2[1];
+		tail_a = tail_tmp2[1];
+		head_b = head_tmp1[1];
+		tail_b = tail_tmp1[1];
 		{
 		  /* Compute double-double = double-double + double-double. */
 		  double	  bv;
@@ -2668,1409 +2524,216 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  head_t = t1 + t2;
 		  tail_t = t2 - (head_t - t1);
 		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
+		head_tmp1[1] = head_t;
+		tail_tmp1[1] = tail_t;
 	      }
-	      aij += incaij2;
-	      xi += incx;
-	      for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  cd     [2];
-		  cd[0] = (double)a_elem[0];
-		  cd[1] = (double)a_elem[1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[0] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[1] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[1] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[0] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
+	      y_i[yi] = head_tmp1[0];
+	      y_i[yi + 1] = head_tmp1[1];
+	      if (i + 1 >= (n_i - k)) {
+		maxj_second--;
 	      }
-	      y_elem[0] = y_i[yi];
-	      y_elem[1] = y_i[yi + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
-		  head_t1 = y_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
-		  head_t2 = y_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp2[0] = head_t1;
-		tail_tmp2[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
-		  head_t1 = y_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
-		  head_t2 = y_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp2[1] = head_t1;
-		tail_tmp2[1] = tail_t1;
-	      }
-	      {
-		/* Compute complex-extra = complex-extra * complex-double. */
-		double		head_a0, tail_a0;
-		double		head_a1, tail_a1;
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		head_a0 = head_sum[0];
-		tail_a0 = tail_sum[0];
-		head_a1 = head_sum[1];
-		tail_a1 = tail_sum[1];
-		/* real part */
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
-		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a0 * alpha_i[0];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
-		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a1 * alpha_i[1];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t2 = t1 + t2;
-		  tail_t2 = t2 - (head_t2 - t1);
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp1[0] = head_t1;
-		tail_tmp1[0] = tail_t1;
-		/* imaginary part */
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
-		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a1 * alpha_i[0];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
-		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a0 * alpha_i[1];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t2 = t1 + t2;
-		  tail_t2 = t2 - (head_t2 - t1);
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp1[1] = head_t1;
-		tail_tmp1[1] = tail_t1;
-	      }
-
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_tmp2[0];
-		tail_a = tail_tmp2[0];
-		head_b = head_tmp1[0];
-		tail_b = tail_tmp1[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_tmp1[0] = head_t;
-		tail_tmp1[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_tmp2[1];
-		tail_a = tail_tmp2[1];
-		head_b = head_tmp1[1];
-		tail_b = tail_tmp1[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_tmp1[1] = head_t;
-		tail_tmp1[1] = tail_t;
-	      }
-	      y_i[yi] = head_tmp1[0];
-	      y_i[yi + 1] = head_tmp1[1];
-	      if (i + 1 >= (n_i - k)) {
-		maxj_second--;
-	      }
-	      if (i >= k) {
-		astarti += (incaij + incaij2);
-		x_starti += incx;
-	      } else {
-		maxj_first++;
-		astarti += incaij2;
+	      if (i >= k) {
+		astarti += (incaij + incaij2);
+		x_starti += incx;
+	      } else {
+		maxj_first++;
+		astarti += incaij2;
 	      }
 	    }
 	  }
-	} else {
-	  /* conjugate first loop */
-
-	  /* Case alpha == 1. */
-	  if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-
-	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
-	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)a_elem[0];
-		    cd[1] = (double)a_elem[1];
-		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
-		      /* Imaginary part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  dt = (double)a_elem[0];
-		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t = dt * x_elem[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_prod[0] = head_t;
-		    tail_prod[0] = tail_t;
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t = dt * x_elem[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_prod[1] = head_t;
-		    tail_prod[1] = tail_t;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)a_elem[0];
-		    cd[1] = (double)a_elem[1];
-		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
-		      /* Imaginary part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
-		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
-		    }
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		y_i[yi] = head_sum[0];
-		y_i[yi + 1] = head_sum[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    } else {
-	      /*
-	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
-	       * beta * y
-	       */
-	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)a_elem[0];
-		    cd[1] = (double)a_elem[1];
-		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
-		      /* Real part */
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
-
-			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+	} else {
+	  /* conjugate first loop */
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+	  /* Case alpha == 1. */
+	  if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
 
-			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
+	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    double	  dt = (double)a_elem[0];
+		    {
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			head_t = dt * x_elem[0];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[0], head_t);
 		      }
+		      head_prod[0] = head_t;
+		      tail_prod[0] = tail_t;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Compute double_double = double * double. */
+			head_t = dt * x_elem[1];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[1], head_t);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
+		      head_prod[1] = head_t;
+		      tail_prod[1] = tail_t;
 		    }
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -4102,12 +2765,9 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -4134,295 +2794,352 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  dt = (double)a_elem[0];
-		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t = dt * x_elem[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_prod[0] = head_t;
-		    tail_prod[0] = tail_t;
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = dt * split;
-		      a1 = con - dt;
-		      a1 = con - a1;
-		      a2 = dt - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t = dt * x_elem[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
 		    }
-		    head_prod[1] = head_t;
-		    tail_prod[1] = tail_t;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    double	    cd   [2];
-		    cd[0] = (double)a_elem[0];
-		    cd[1] = (double)a_elem[1];
 		    {
-		      /*
-		       * Compute complex-extra = complex-double *
-		       * complex-double.
-		       */
-		      double	      head_t1, tail_t1;
-		      double	      head_t2, tail_t2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
 		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			head_t1 = x_elem[0] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			head_t2 = x_elem[1] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_t2 = -head_t2;
-		      tail_t2 = -tail_t2;
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		}
+		y_i[yi] = head_sum[0];
+		y_i[yi + 1] = head_sum[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    } else {
+	      /*
+	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
+	       * beta * y
+	       */
+	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
 		      {
 			/*
-			 * Compute double-double = double-double +
-			 * double-double.
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
 			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
 			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
-		      head_prod[0] = head_t1;
-		      tail_prod[0] = tail_t1;
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
 		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
 		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			con = x_elem[1] * split;
-			a1 = con - x_elem[1];
-			a1 = con - a1;
-			a2 = x_elem[1] - a1;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
 
-			head_t1 = x_elem[1] * cd[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
 		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    double	  dt = (double)a_elem[0];
+		    {
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = x_elem[0] * split;
-			a1 = con - x_elem[0];
-			a1 = con - a1;
-			a2 = x_elem[0] - a1;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
-
-			head_t2 = x_elem[0] * cd[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			head_t = dt * x_elem[0];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[0], head_t);
 		      }
+		      head_prod[0] = head_t;
+		      tail_prod[0] = tail_t;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_t1 + head_t2;
-			bv = s1 - head_t1;
-			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Compute double_double = double * double. */
+			head_t = dt * x_elem[1];
+			tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[1], head_t);
 		      }
-		      head_prod[1] = head_t1;
-		      tail_prod[1] = tail_t1;
+		      head_prod[1] = head_t;
+		      tail_prod[1] = tail_t;
 		    }
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -4453,13 +3170,10 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    tail_a = tail_sum[1];
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		    {
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -4486,6 +3200,147 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      double	    cd   [2];
+		      cd[0] = (double)a_elem[0];
+		      cd[1] = (double)a_elem[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double	      head_t1, tail_t1;
+			double	      head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[0] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[1] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[0] = head_t1;
+			tail_prod[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = x_elem[1] * cd[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = x_elem[0] * cd[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_t1 + tail_t2;
+
+			  /* Renormalize (s1, s2)  */
+			  head_t1 = s1 + s2;
+			  tail_t1 = s2 - (head_t1 - s1);
+			}
+			head_prod[1] = head_t1;
+			tail_prod[1] = tail_t1;
+		      }
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		}
 		y_elem[0] = y_i[yi];
 		y_elem[1] = y_i[yi + 1];
@@ -4496,35 +3351,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -4560,35 +3393,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
 		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
 		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -4699,525 +3510,197 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		}
 		y_i[yi] = head_tmp1[0];
 		y_i[yi + 1] = head_tmp1[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    }
-	  } else {
-	    /* The most general form,   y <--- alpha * A * x + beta * y */
-	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	      for (j = 0, aij = astarti, xi = x_starti;
-		   j < maxj_first; j++, aij += incaij, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  cd     [2];
-		  cd[0] = (double)a_elem[0];
-		  cd[1] = (double)a_elem[1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[0] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[1] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[1] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[0] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-	      }
-	      a_elem[0] = a_i[aij];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		double		dt = (double)a_elem[0];
-		{
-		  /* Compute complex-extra = complex-double * real. */
-		  double	  head_t, tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t = dt * x_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[0] = head_t;
-		  tail_prod[0] = tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = dt * split;
-		    a1 = con - dt;
-		    a1 = con - a1;
-		    a2 = dt - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t = dt * x_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[1] = head_t;
-		  tail_prod[1] = tail_t;
-		}
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
 		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
 	      }
-	      aij += incaij2;
-	      xi += incx;
-	      for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
+	    }
+	  } else {
+	    /* The most general form,   y <--- alpha * A * x + beta * y */
+	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+	      if (row_sum != NULL) {
+		head_sum[0] = row_sum[4 * i];
+		head_sum[1] = row_sum[4 * i + 1];
+		tail_sum[0] = row_sum[4 * i + 2];
+		tail_sum[1] = row_sum[4 * i + 3];
+	      } else {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  double	  cd     [2];
-		  cd[0] = (double)a_elem[0];
-		  cd[1] = (double)a_elem[1];
+		for (j = 0, aij = astarti, xi = x_starti;
+		     j < maxj_first; j++, aij += incaij, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+		  a_elem[1] = -a_elem[1];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
 		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[0] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[1] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+		    double	  cd     [2];
+		    cd[0] = (double)a_elem[0];
+		    cd[1] = (double)a_elem[1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = x_elem[0] * cd[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = x_elem[1] * cd[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = x_elem[1] * cd[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = x_elem[0] * cd[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[1] * split;
-		      a1 = con - x_elem[1];
-		      a1 = con - a1;
-		      a2 = x_elem[1] - a1;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
-
-		      head_t1 = x_elem[1] * cd[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = x_elem[0] * split;
-		      a1 = con - x_elem[0];
-		      a1 = con - a1;
-		      a2 = x_elem[0] - a1;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
-
-		      head_t2 = x_elem[0] * cd[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
 		    }
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		}
+		a_elem[0] = a_i[aij];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		{
+		  double		dt = (double)a_elem[0];
+		  {
+		    /* Compute complex-extra = complex-double * real. */
+		    double	  head_t, tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = dt * x_elem[0];
+		      tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[0], head_t);
+		    }
+		    head_prod[0] = head_t;
+		    tail_prod[0] = tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = dt * x_elem[1];
+		      tail_t = BLAS_TWO_PROD_ERR(dt, x_elem[1], head_t);
 		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
+		    head_prod[1] = head_t;
+		    tail_prod[1] = tail_t;
 		  }
 		}
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
 		  /* Real part */
 		  head_a = head_sum[0];
 		  tail_a = tail_sum[0];
@@ -5225,8 +3708,8 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  tail_b = tail_prod[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -5259,8 +3742,8 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  tail_b = tail_prod[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -5287,6 +3770,147 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		  head_sum[1] = head_t;
 		  tail_sum[1] = tail_t;
 		}
+		aij += incaij2;
+		xi += incx;
+		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    double	  cd     [2];
+		    cd[0] = (double)a_elem[0];
+		    cd[1] = (double)a_elem[1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = x_elem[0] * cd[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], cd[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = x_elem[1] * cd[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], cd[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = x_elem[1] * cd[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], cd[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = x_elem[0] * cd[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], cd[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		}
 	      }
 	      y_elem[0] = y_i[yi];
 	      y_elem[1] = y_i[yi + 1];
@@ -5297,35 +3921,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -5361,35 +3963,13 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -5434,20 +4014,10 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -5458,20 +4028,10 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -5514,20 +4074,10 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -5538,20 +4088,10 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -5680,6 +4220,7 @@ void		BLAS_zhbmv_c_z_x(enum blas_order_type order,
 	  }
 	}
       }
+      blas_free(row_sum);
       FPU_FIX_STOP;
 
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 void		BLAS_zhbmv_x(enum blas_order_type order,
 	     		enum		blas_uplo_type uplo, int n, int k,
 	  		const		void  *alpha, const void *a, int lda,
@@ -124,7 +125,8 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
 
       /* Integer Index Variables */
       int	      i    , j;
@@ -680,6 +682,7 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *row_sum;
       FPU_FIX_DECL;
 
 
@@ -744,6 +747,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored band into row sums. */
+      row_sum = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	row_sum = blas_sbmv_lines_x(order, uplo, 1, n, k, a_i, blas_gemm_elt_z,
+				    lda, x_i + x_starti, blas_gemm_elt_z,
+				    incx / 2);
+
       /* alpha = 0.  In this case, just return beta * y */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
@@ -756,35 +766,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
 	      head_t1 = y_elem[0] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
 	      head_t2 = y_elem[1] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	    }
 	    head_t2 = -head_t2;
 	    tail_t2 = -tail_t2;
@@ -820,35 +808,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 	    /* Imaginary part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
 	      head_t1 = y_elem[1] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
 	      head_t2 = y_elem[0] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
@@ -907,73 +873,192 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
 	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
 		  x_elem[0] = x_i[xi];
 		  x_elem[1] = x_i[xi + 1];
 		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
+		    /* Compute complex-extra = complex-double * real. */
+		    double	  head_t, tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      head_t = a_elem[0] * x_elem[0];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t);
 		    }
+		    head_prod[0] = head_t;
+		    tail_prod[0] = tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      head_t = a_elem[0] * x_elem[1];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t);
 		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+		    head_prod[1] = head_t;
+		    tail_prod[1] = tail_t;
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      t1 = tail_a + tail_b;
+		      bv = t1 - tail_a;
+		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 		      s2 += t1;
 
@@ -984,61 +1069,30 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		      t2 += s2;
 
 		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      head_t = t1 + t2;
+		      tail_t = t2 - (head_t - t1);
 		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
 		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      t1 = tail_a + tail_b;
+		      bv = t1 - tail_a;
+		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 		      s2 += t1;
 
@@ -1049,28 +1103,345 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		      t2 += s2;
 
 		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      head_t = t1 + t2;
+		      tail_t = t2 - (head_t - t1);
 		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		}
+		y_i[yi] = head_sum[0];
+		y_i[yi + 1] = head_sum[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    } else {
+	      /*
+	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
+	       * beta * y
+	       */
+	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    /* Compute complex-extra = complex-double * real. */
+		    double	  head_t, tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = a_elem[0] * x_elem[0];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t);
+		    }
+		    head_prod[0] = head_t;
+		    tail_prod[0] = tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = a_elem[0] * x_elem[1];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t);
+		    }
+		    head_prod[1] = head_t;
+		    tail_prod[1] = tail_t;
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1102,12 +1473,9 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -1134,59 +1502,245 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
+		  }
 		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
+		y_elem[0] = y_i[yi];
+		y_elem[1] = y_i[yi + 1];
 		{
-		  /* Compute complex-extra = complex-double * real. */
-		  double	  head_t, tail_t;
+		  /* Compute complex-extra = complex-double * complex-double. */
+		  double	  head_t1, tail_t1;
+		  double	  head_t2, tail_t2;
+		  /* Real part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = y_elem[0] * beta_i[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
+		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		    head_t2 = y_elem[1] * beta_i[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
+		  }
+		  head_t2 = -head_t2;
+		  tail_t2 = -tail_t2;
+		  {
+		    /* Compute double-double = double-double + double-double. */
+		    double	    bv;
+		    double	    s1  , s2, t1, t2;
 
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    head_t = a_elem[0] * x_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Add two lo words. */
+		    t1 = tail_t1 + tail_t2;
+		    bv = t1 - tail_t1;
+		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		    s2 += t1;
+
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
+
+		    t2 += s2;
+
+		    /* Renormalize (t1, t2)  */
+		    head_t1 = t1 + t2;
+		    tail_t1 = t2 - (head_t1 - t1);
+		  }
+		  head_tmp2[0] = head_t1;
+		  tail_tmp2[0] = tail_t1;
+		  /* Imaginary part */
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t1 = y_elem[1] * beta_i[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
-		  head_prod[0] = head_t;
-		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		    head_t2 = y_elem[0] * beta_i[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
+		  }
+		  {
+		    /* Compute double-double = double-double + double-double. */
+		    double	    bv;
+		    double	    s1  , s2, t1, t2;
+
+		    /* Add two hi words. */
+		    s1 = head_t1 + head_t2;
+		    bv = s1 - head_t1;
+		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
+		    /* Add two lo words. */
+		    t1 = tail_t1 + tail_t2;
+		    bv = t1 - tail_t1;
+		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    head_t = a_elem[0] * x_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    s2 += t1;
+
+		    /* Renormalize (s1, s2)  to  (t1, s2) */
+		    t1 = s1 + s2;
+		    s2 = s2 - (t1 - s1);
+
+		    t2 += s2;
+
+		    /* Renormalize (t1, t2)  */
+		    head_t1 = t1 + t2;
+		    tail_t1 = t2 - (head_t1 - t1);
 		  }
-		  head_prod[1] = head_t;
-		  tail_prod[1] = tail_t;
+		  head_tmp2[1] = head_t1;
+		  tail_tmp2[1] = tail_t1;
 		}
+		head_tmp1[0] = head_sum[0];
+		tail_tmp1[0] = tail_sum[0];
+		head_tmp1[1] = head_sum[1];
+		tail_tmp1[1] = tail_sum[1];
 		{
 		  double	  head_t, tail_t;
 		  double	  head_a, tail_a;
 		  double	  head_b, tail_b;
 		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  head_a = head_tmp2[0];
+		  tail_a = tail_tmp2[0];
+		  head_b = head_tmp1[0];
+		  tail_b = tail_tmp1[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
@@ -1214,13 +1768,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
+		  head_tmp1[0] = head_t;
+		  tail_tmp1[0] = tail_t;
 		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
+		  head_a = head_tmp2[1];
+		  tail_a = tail_tmp2[1];
+		  head_b = head_tmp1[1];
+		  tail_b = tail_tmp1[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
@@ -1248,239 +1802,11 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
+		  head_tmp1[1] = head_t;
+		  tail_tmp1[1] = tail_t;
 		}
-		y_i[yi] = head_sum[0];
-		y_i[yi + 1] = head_sum[1];
+		y_i[yi] = head_tmp1[0];
+		y_i[yi + 1] = head_tmp1[1];
 		if (i + 1 >= (n_i - k)) {
 		  maxj_second--;
 		}
@@ -1492,12 +1818,16 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  astarti += incaij2;
 		}
 	      }
-	    } else {
-	      /*
-	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
-	       * beta * y
-	       */
-	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+	    }
+	  } else {
+	    /* The most general form,   y <--- alpha * A * x + beta * y */
+	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+	      if (row_sum != NULL) {
+		head_sum[0] = row_sum[4 * i];
+		head_sum[1] = row_sum[4 * i + 1];
+		tail_sum[0] = row_sum[4 * i + 2];
+		tail_sum[1] = row_sum[4 * i + 3];
+	      } else {
 		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
 
 		for (j = 0, aij = astarti, xi = x_starti;
@@ -1508,183 +1838,100 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  x_elem[0] = x_i[xi];
 		  x_elem[1] = x_i[xi + 1];
 		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
+		    /* Compute complex-extra = complex-double * complex-double. */
+		    double	  head_t1, tail_t1;
+		    double	  head_t2, tail_t2;
 		    /* Real part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
 		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
 		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
 		    }
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_prod[0] = head_t1;
 		    tail_prod[0] = tail_t1;
 		    /* Imaginary part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
 		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
 		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_prod[1] = head_t1;
 		    tail_prod[1] = tail_t1;
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[0] = head_t;
 		    tail_sum[0] = tail_t;
@@ -1694,34 +1941,22 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
@@ -1732,48 +1967,26 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		x_elem[1] = x_i[xi + 1];
 		{
 		  /* Compute complex-extra = complex-double * real. */
-		  double	  head_t, tail_t;
+		  double		head_t , tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
 		    head_t = a_elem[0] * x_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
 		    head_t = a_elem[0] * x_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
 		}
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
 		  /* Real part */
 		  head_a = head_sum[0];
 		  tail_a = tail_sum[0];
@@ -1781,8 +1994,8 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  tail_b = tail_prod[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -1815,8 +2028,8 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  tail_b = tail_prod[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -1852,183 +2065,100 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  x_elem[0] = x_i[xi];
 		  x_elem[1] = x_i[xi + 1];
 		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
+		    /* Compute complex-extra = complex-double * complex-double. */
+		    double	  head_t1, tail_t1;
+		    double	  head_t2, tail_t2;
 		    /* Real part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
 		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
 		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
 		    }
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_prod[0] = head_t1;
 		    tail_prod[0] = tail_t1;
 		    /* Imaginary part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
 		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
 		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_prod[1] = head_t1;
 		    tail_prod[1] = tail_t1;
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[0] = head_t;
 		    tail_sum[0] = tail_t;
@@ -2038,2308 +2168,519 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
 		      bv = s1 - head_a;
 		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
 		}
-		y_elem[0] = y_i[yi];
-		y_elem[1] = y_i[yi + 1];
+	      }
+	      y_elem[0] = y_i[yi];
+	      y_elem[1] = y_i[yi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double		head_t1, tail_t1;
+		double		head_t2, tail_t2;
+		/* Real part */
 		{
-		  /* Compute complex-extra = complex-double * complex-double. */
-		  double	  head_t1, tail_t1;
-		  double	  head_t2, tail_t2;
-		  /* Real part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
-		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Compute double_double = double * double. */
+		  head_t1 = y_elem[0] * beta_i[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = y_elem[1] * beta_i[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_t2 = -head_t2;
-		  tail_t2 = -tail_t2;
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		  s2 += t1;
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    s2 += t1;
+		  t2 += s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		head_tmp2[0] = head_t1;
+		tail_tmp2[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = y_elem[1] * beta_i[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = y_elem[0] * beta_i[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    t2 += s2;
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_tmp2[0] = head_t1;
-		  tail_tmp2[0] = tail_t1;
-		  /* Imaginary part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
+		  s2 += t1;
 
-		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
+		  t2 += s2;
 
-		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		head_tmp2[1] = head_t1;
+		tail_tmp2[1] = tail_t1;
+	      }
+	      {
+		/* Compute complex-extra = complex-extra * complex-double. */
+		double		head_a0, tail_a0;
+		double		head_a1, tail_a1;
+		double		head_t1, tail_t1;
+		double		head_t2, tail_t2;
+		head_a0 = head_sum[0];
+		tail_a0 = tail_sum[0];
+		head_a1 = head_sum[1];
+		tail_a1 = tail_sum[1];
+		/* real part */
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		  c11 = head_a0 * alpha_i[0];
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		  c2 = tail_a0 * alpha_i[0];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
 
-		    s2 += t1;
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  c11 = head_a1 * alpha_i[1];
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-		    t2 += s2;
+		  c2 = tail_a1 * alpha_i[1];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_tmp2[1] = head_t1;
-		  tail_tmp2[1] = tail_t1;
+		  head_t2 = t1 + t2;
+		  tail_t2 = t2 - (head_t2 - t1);
 		}
-		head_tmp1[0] = head_sum[0];
-		tail_tmp1[0] = tail_sum[0];
-		head_tmp1[1] = head_sum[1];
-		tail_tmp1[1] = tail_sum[1];
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_tmp2[0];
-		  tail_a = tail_tmp2[0];
-		  head_b = head_tmp1[0];
-		  tail_b = tail_tmp1[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[0] = head_t;
-		  tail_tmp1[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_tmp2[1];
-		  tail_a = tail_tmp2[1];
-		  head_b = head_tmp1[1];
-		  tail_b = tail_tmp1[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[1] = head_t;
-		  tail_tmp1[1] = tail_t;
-		}
-		y_i[yi] = head_tmp1[0];
-		y_i[yi + 1] = head_tmp1[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    }
-	  } else {
-	    /* The most general form,   y <--- alpha * A * x + beta * y */
-	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	      for (j = 0, aij = astarti, xi = x_starti;
-		   j < maxj_first; j++, aij += incaij, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  /* Compute complex-extra = complex-double * complex-double. */
-		  double	  head_t1, tail_t1;
-		  double	  head_t2, tail_t2;
-		  /* Real part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[0] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[1] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_t2 = -head_t2;
-		  tail_t2 = -tail_t2;
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_prod[0] = head_t1;
-		  tail_prod[0] = tail_t1;
-		  /* Imaginary part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[1] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[0] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_prod[1] = head_t1;
-		  tail_prod[1] = tail_t1;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-	      }
-	      a_elem[0] = a_i[aij];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem[0] * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem[0] * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	      aij += incaij2;
-	      xi += incx;
-	      for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  /* Compute complex-extra = complex-double * complex-double. */
-		  double	  head_t1, tail_t1;
-		  double	  head_t2, tail_t2;
-		  /* Real part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[0] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[1] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_t2 = -head_t2;
-		  tail_t2 = -tail_t2;
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_prod[0] = head_t1;
-		  tail_prod[0] = tail_t1;
-		  /* Imaginary part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[1] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[0] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_prod[1] = head_t1;
-		  tail_prod[1] = tail_t1;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-	      }
-	      y_elem[0] = y_i[yi];
-	      y_elem[1] = y_i[yi + 1];
-	      {
-		/* Compute complex-extra = complex-double * complex-double. */
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		/* Real part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
-		  head_t1 = y_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
-		  head_t2 = y_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp2[0] = head_t1;
-		tail_tmp2[0] = tail_t1;
-		/* Imaginary part */
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
-		  head_t1 = y_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
-		  head_t2 = y_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp2[1] = head_t1;
-		tail_tmp2[1] = tail_t1;
-	      }
-	      {
-		/* Compute complex-extra = complex-extra * complex-double. */
-		double		head_a0, tail_a0;
-		double		head_a1, tail_a1;
-		double		head_t1, tail_t1;
-		double		head_t2, tail_t2;
-		head_a0 = head_sum[0];
-		tail_a0 = tail_sum[0];
-		head_a1 = head_sum[1];
-		tail_a1 = tail_sum[1];
-		/* real part */
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
-		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a0 * alpha_i[0];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
-		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a1 * alpha_i[1];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t2 = t1 + t2;
-		  tail_t2 = t2 - (head_t2 - t1);
-		}
-		head_t2 = -head_t2;
-		tail_t2 = -tail_t2;
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp1[0] = head_t1;
-		tail_tmp1[0] = tail_t1;
-		/* imaginary part */
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
-		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a1 * alpha_i[0];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
-		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_a0 * alpha_i[1];
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_t2 = t1 + t2;
-		  tail_t2 = t2 - (head_t2 - t1);
-		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_t1 + head_t2;
-		  bv = s1 - head_t1;
-		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_t1 + tail_t2;
-		  bv = t1 - tail_t1;
-		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t1 = t1 + t2;
-		  tail_t1 = t2 - (head_t1 - t1);
-		}
-		head_tmp1[1] = head_t1;
-		tail_tmp1[1] = tail_t1;
-	      }
-
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_tmp2[0];
-		tail_a = tail_tmp2[0];
-		head_b = head_tmp1[0];
-		tail_b = tail_tmp1[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_tmp1[0] = head_t;
-		tail_tmp1[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_tmp2[1];
-		tail_a = tail_tmp2[1];
-		head_b = head_tmp1[1];
-		tail_b = tail_tmp1[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_tmp1[1] = head_t;
-		tail_tmp1[1] = tail_t;
-	      }
-	      y_i[yi] = head_tmp1[0];
-	      y_i[yi + 1] = head_tmp1[1];
-	      if (i + 1 >= (n_i - k)) {
-		maxj_second--;
-	      }
-	      if (i >= k) {
-		astarti += (incaij + incaij2);
-		x_starti += incx;
-	      } else {
-		maxj_first++;
-		astarti += incaij2;
-	      }
-	    }
-	  }
-	} else {
-	  /* conjugate first loop */
-
-	  /* Case alpha == 1. */
-	  if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-
-	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
-	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  /* Compute complex-extra = complex-double * real. */
-		  double	  head_t, tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t = a_elem[0] * x_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[0] = head_t;
-		  tail_prod[0] = tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t = a_elem[0] * x_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[1] = head_t;
-		  tail_prod[1] = tail_t;
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
-		}
-		y_i[yi] = head_sum[0];
-		y_i[yi + 1] = head_sum[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
-		}
-	      }
-	    } else {
-	      /*
-	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
-	       * beta * y
-	       */
-	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-		for (j = 0, aij = astarti, xi = x_starti;
-		     j < maxj_first; j++, aij += incaij, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
-		  a_elem[1] = -a_elem[1];
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
-		  }
-		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
-		    /* Real part */
-		    head_a = head_sum[0];
-		    tail_a = tail_sum[0];
-		    head_b = head_prod[0];
-		    tail_b = tail_prod[0];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[0] = head_t;
-		    tail_sum[0] = tail_t;
-		    /* Imaginary part */
-		    head_a = head_sum[1];
-		    tail_a = tail_sum[1];
-		    head_b = head_prod[1];
-		    tail_b = tail_prod[1];
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_a + head_b;
-		      bv = s1 - head_a;
-		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_a + tail_b;
-		      bv = t1 - tail_a;
-		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		      s2 += t1;
+		  s2 += t1;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		      t2 += s2;
+		  t2 += s2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t = t1 + t2;
-		      tail_t = t2 - (head_t - t1);
-		    }
-		    head_sum[1] = head_t;
-		    tail_sum[1] = tail_t;
-		  }
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
 		}
-		a_elem[0] = a_i[aij];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
+		head_tmp1[0] = head_t1;
+		tail_tmp1[0] = tail_t1;
+		/* imaginary part */
 		{
-		  /* Compute complex-extra = complex-double * real. */
-		  double	  head_t, tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
+		  c11 = head_a1 * alpha_i[0];
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-		    head_t = a_elem[0] * x_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[0] = head_t;
-		  tail_prod[0] = tail_t;
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
+		  c2 = tail_a1 * alpha_i[0];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
+
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		{
+		  /* Compute double-double = double-double * double. */
+		  double	  c11   , c21, c2, t1, t2;
 
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
+		  c11 = head_a0 * alpha_i[1];
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-		    head_t = a_elem[0] * x_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_prod[1] = head_t;
-		  tail_prod[1] = tail_t;
+		  c2 = tail_a0 * alpha_i[1];
+		  t1 = c11 + c2;
+		  t2 = (c2 - (t1 - c11)) + c21;
+
+		  head_t2 = t1 + t2;
+		  tail_t2 = t2 - (head_t2 - t1);
 		}
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Add two lo words. */
+		  t1 = tail_t1 + tail_t2;
+		  bv = t1 - tail_t1;
+		  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		    s2 += t1;
+		  s2 += t1;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    t2 += s2;
+		  t2 += s2;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		  /* Renormalize (t1, t2)  */
+		  head_t1 = t1 + t2;
+		  tail_t1 = t2 - (head_t1 - t1);
+		}
+		head_tmp1[1] = head_t1;
+		tail_tmp1[1] = tail_t1;
+	      }
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      {
+		double		head_t , tail_t;
+		double		head_a , tail_a;
+		double		head_b , tail_b;
+		/* Real part */
+		head_a = head_tmp2[0];
+		tail_a = tail_tmp2[0];
+		head_b = head_tmp1[0];
+		tail_b = tail_tmp1[0];
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    s2 += t1;
+		  /* Add two lo words. */
+		  t1 = tail_a + tail_b;
+		  bv = t1 - tail_a;
+		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		  s2 += t1;
 
-		    t2 += s2;
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
+		  t2 += s2;
+
+		  /* Renormalize (t1, t2)  */
+		  head_t = t1 + t2;
+		  tail_t = t2 - (head_t - t1);
 		}
-		aij += incaij2;
-		xi += incx;
-		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		  a_elem[0] = a_i[aij];
-		  a_elem[1] = a_i[aij + 1];
+		head_tmp1[0] = head_t;
+		tail_tmp1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_tmp2[1];
+		tail_a = tail_tmp2[1];
+		head_b = head_tmp1[1];
+		tail_b = tail_tmp1[1];
+		{
+		  /* Compute double-double = double-double + double-double. */
+		  double	  bv;
+		  double	  s1    , s2, t1, t2;
 
-		  x_elem[0] = x_i[xi];
-		  x_elem[1] = x_i[xi + 1];
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add two lo words. */
+		  t1 = tail_a + tail_b;
+		  bv = t1 - tail_a;
+		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
+		  s2 += t1;
 
-		      head_t1 = a_elem[0] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
+		  /* Renormalize (s1, s2)  to  (t1, s2) */
+		  t1 = s1 + s2;
+		  s2 = s2 - (t1 - s1);
 
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
+		  t2 += s2;
 
-		      head_t2 = a_elem[1] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+		  /* Renormalize (t1, t2)  */
+		  head_t = t1 + t2;
+		  tail_t = t2 - (head_t - t1);
+		}
+		head_tmp1[1] = head_t;
+		tail_tmp1[1] = tail_t;
+	      }
+	      y_i[yi] = head_tmp1[0];
+	      y_i[yi + 1] = head_tmp1[1];
+	      if (i + 1 >= (n_i - k)) {
+		maxj_second--;
+	      }
+	      if (i >= k) {
+		astarti += (incaij + incaij2);
+		x_starti += incx;
+	      } else {
+		maxj_first++;
+		astarti += incaij2;
+	      }
+	    }
+	  }
+	} else {
+	  /* conjugate first loop */
+
+	  /* Case alpha == 1. */
+	  if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
+
+	    if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+	      /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
+	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
 		    }
-		    head_prod[0] = head_t1;
-		    tail_prod[0] = tail_t1;
-		    /* Imaginary part */
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[1] * split;
-		      a1 = con - a_elem[1];
-		      a1 = con - a1;
-		      a2 = a_elem[1] - a1;
-		      con = x_elem[0] * split;
-		      b1 = con - x_elem[0];
-		      b1 = con - b1;
-		      b2 = x_elem[0] - b1;
-
-		      head_t1 = a_elem[1] * x_elem[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
 		    }
+		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    /* Compute complex-extra = complex-double * real. */
+		    double	  head_t, tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = a_elem[0] * split;
-		      a1 = con - a_elem[0];
-		      a1 = con - a1;
-		      a2 = a_elem[0] - a1;
-		      con = x_elem[1] * split;
-		      b1 = con - x_elem[1];
-		      b1 = con - b1;
-		      b2 = x_elem[1] - b1;
-
-		      head_t2 = a_elem[0] * x_elem[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      head_t = a_elem[0] * x_elem[0];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t);
 		    }
+		    head_prod[0] = head_t;
+		    tail_prod[0] = tail_t;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Compute double_double = double * double. */
+		      head_t = a_elem[0] * x_elem[1];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t);
 		    }
-		    head_prod[1] = head_t1;
-		    tail_prod[1] = tail_t1;
+		    head_prod[1] = head_t;
+		    tail_prod[1] = tail_t;
 		  }
 		  {
-		    double	    head_t, tail_t;
-		    double	    head_a, tail_a;
-		    double	    head_b, tail_b;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
 		    head_a = head_sum[0];
 		    tail_a = tail_sum[0];
 		    head_b = head_prod[0];
 		    tail_b = tail_prod[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -4371,12 +2712,9 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_b = head_prod[1];
 		    tail_b = tail_prod[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
 		      /* Add two hi words. */
 		      s1 = head_a + head_b;
@@ -4403,243 +2741,538 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_sum[1] = head_t;
 		    tail_sum[1] = tail_t;
 		  }
-		}
-		y_elem[0] = y_i[yi];
-		y_elem[1] = y_i[yi + 1];
-		{
-		  /* Compute complex-extra = complex-double * complex-double. */
-		  double	  head_t1, tail_t1;
-		  double	  head_t2, tail_t2;
-		  /* Real part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
-		    head_t1 = y_elem[0] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
-		    head_t2 = y_elem[1] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_t2 = -head_t2;
-		  tail_t2 = -tail_t2;
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_tmp2[0] = head_t1;
-		  tail_tmp2[0] = tail_t1;
-		  /* Imaginary part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[1] * split;
-		    a1 = con - y_elem[1];
-		    a1 = con - a1;
-		    a2 = y_elem[1] - a1;
-		    con = beta_i[0] * split;
-		    b1 = con - beta_i[0];
-		    b1 = con - b1;
-		    b2 = beta_i[0] - b1;
-
-		    head_t1 = y_elem[1] * beta_i[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
 		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = y_elem[0] * split;
-		    a1 = con - y_elem[0];
-		    a1 = con - a1;
-		    a2 = y_elem[0] - a1;
-		    con = beta_i[1] * split;
-		    b1 = con - beta_i[1];
-		    b1 = con - b1;
-		    b2 = beta_i[1] - b1;
-
-		    head_t2 = y_elem[0] * beta_i[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		}
+		y_i[yi] = head_sum[0];
+		y_i[yi + 1] = head_sum[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    } else {
+	      /*
+	       * Case alpha = 1, but beta != 0. We compute  y  <--- A * x +
+	       * beta * y
+	       */
+	      for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+		if (row_sum != NULL) {
+		  head_sum[0] = row_sum[4 * i];
+		  head_sum[1] = row_sum[4 * i + 1];
+		  tail_sum[0] = row_sum[4 * i + 2];
+		  tail_sum[1] = row_sum[4 * i + 3];
+		} else {
+		  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		  for (j = 0, aij = astarti, xi = x_starti;
+		       j < maxj_first; j++, aij += incaij, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+		    a_elem[1] = -a_elem[1];
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
 		  }
+		  a_elem[0] = a_i[aij];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Compute complex-extra = complex-double * real. */
+		    double	  head_t, tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = a_elem[0] * x_elem[0];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t);
+		    }
+		    head_prod[0] = head_t;
+		    tail_prod[0] = tail_t;
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t = a_elem[0] * x_elem[1];
+		      tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t);
+		    }
+		    head_prod[1] = head_t;
+		    tail_prod[1] = tail_t;
 		  }
-		  head_tmp2[1] = head_t1;
-		  tail_tmp2[1] = tail_t1;
-		}
-		head_tmp1[0] = head_sum[0];
-		tail_tmp1[0] = tail_sum[0];
-		head_tmp1[1] = head_sum[1];
-		tail_tmp1[1] = tail_sum[1];
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_tmp2[0];
-		  tail_a = tail_tmp2[0];
-		  head_b = head_tmp1[0];
-		  tail_b = tail_tmp1[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
-		    t2 += s2;
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_tmp1[0] = head_t;
-		  tail_tmp1[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_tmp2[1];
-		  tail_a = tail_tmp2[1];
-		  head_b = head_tmp1[1];
-		  tail_b = tail_tmp1[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		      /* Add two lo words. */
+		      t1 = tail_a + tail_b;
+		      bv = t1 - tail_a;
+		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      s2 += t1;
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		      /* Renormalize (s1, s2)  to  (t1, s2) */
+		      t1 = s1 + s2;
+		      s2 = s2 - (t1 - s1);
 
-		    s2 += t1;
+		      t2 += s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Renormalize (t1, t2)  */
+		      head_t = t1 + t2;
+		      tail_t = t2 - (head_t - t1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double. */
+		      double	    bv;
+		      double	    s1  , s2, t1, t2;
 
-		    t2 += s2;
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		      /* Add two lo words. */
+		      t1 = tail_a + tail_b;
+		      bv = t1 - tail_a;
+		      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+		      s2 += t1;
+
+		      /* Renormalize (s1, s2)  to  (t1, s2) */
+		      t1 = s1 + s2;
+		      s2 = s2 - (t1 - s1);
+
+		      t2 += s2;
+
+		      /* Renormalize (t1, t2)  */
+		      head_t = t1 + t2;
+		      tail_t = t2 - (head_t - t1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		  aij += incaij2;
+		  xi += incx;
+		  for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		    a_elem[0] = a_i[aij];
+		    a_elem[1] = a_i[aij + 1];
+
+		    x_elem[0] = x_i[xi];
+		    x_elem[1] = x_i[xi + 1];
+		    {
+		      /*
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
+		       */
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[0] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[1] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[0] = head_t1;
+		      tail_prod[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = a_elem[1] * x_elem[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = a_elem[0] * x_elem[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_prod[1] = head_t1;
+		      tail_prod[1] = tail_t1;
+		    }
+		    {
+		      double	    head_t, tail_t;
+		      double	    head_a, tail_a;
+		      double	    head_b, tail_b;
+		      /* Real part */
+		      head_a = head_sum[0];
+		      tail_a = tail_sum[0];
+		      head_b = head_prod[0];
+		      tail_b = tail_prod[0];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[0] = head_t;
+		      tail_sum[0] = tail_t;
+		      /* Imaginary part */
+		      head_a = head_sum[1];
+		      tail_a = tail_sum[1];
+		      head_b = head_prod[1];
+		      tail_b = tail_prod[1];
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_a + head_b;
+			bv = s1 - head_a;
+			s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_a + tail_b;
+
+			/* Renormalize (s1, s2)  */
+			head_t = s1 + s2;
+			tail_t = s2 - (head_t - s1);
+		      }
+		      head_sum[1] = head_t;
+		      tail_sum[1] = tail_t;
+		    }
 		  }
-		  head_tmp1[1] = head_t;
-		  tail_tmp1[1] = tail_t;
-		}
-		y_i[yi] = head_tmp1[0];
-		y_i[yi + 1] = head_tmp1[1];
-		if (i + 1 >= (n_i - k)) {
-		  maxj_second--;
-		}
-		if (i >= k) {
-		  astarti += (incaij + incaij2);
-		  x_starti += incx;
-		} else {
-		  maxj_first++;
-		  astarti += incaij2;
 		}
-	      }
-	    }
-	  } else {
-	    /* The most general form,   y <--- alpha * A * x + beta * y */
-	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
-	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	      for (j = 0, aij = astarti, xi = x_starti;
-		   j < maxj_first; j++, aij += incaij, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-		a_elem[1] = -a_elem[1];
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
+		y_elem[0] = y_i[yi];
+		y_elem[1] = y_i[yi + 1];
 		{
 		  /* Compute complex-extra = complex-double * complex-double. */
 		  double	  head_t1, tail_t1;
@@ -4647,35 +3280,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  /* Real part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[0] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    head_t1 = y_elem[0] * beta_i[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[1] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    head_t2 = y_elem[1] * beta_i[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		  }
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
@@ -4706,40 +3317,18 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_t1 = t1 + t2;
 		    tail_t1 = t2 - (head_t1 - t1);
 		  }
-		  head_prod[0] = head_t1;
-		  tail_prod[0] = tail_t1;
+		  head_tmp2[0] = head_t1;
+		  tail_tmp2[0] = tail_t1;
 		  /* Imaginary part */
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[1] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    head_t1 = y_elem[1] * beta_i[0];
+		    tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		  }
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[0] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    head_t2 = y_elem[0] * beta_i[1];
+		    tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		  }
 		  {
 		    /* Compute double-double = double-double + double-double. */
@@ -4768,18 +3357,22 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_t1 = t1 + t2;
 		    tail_t1 = t2 - (head_t1 - t1);
 		  }
-		  head_prod[1] = head_t1;
-		  tail_prod[1] = tail_t1;
+		  head_tmp2[1] = head_t1;
+		  tail_tmp2[1] = tail_t1;
 		}
+		head_tmp1[0] = head_sum[0];
+		tail_tmp1[0] = tail_sum[0];
+		head_tmp1[1] = head_sum[1];
+		tail_tmp1[1] = tail_sum[1];
 		{
 		  double	  head_t, tail_t;
 		  double	  head_a, tail_a;
 		  double	  head_b, tail_b;
 		  /* Real part */
-		  head_a = head_sum[0];
-		  tail_a = tail_sum[0];
-		  head_b = head_prod[0];
-		  tail_b = tail_prod[0];
+		  head_a = head_tmp2[0];
+		  tail_a = tail_tmp2[0];
+		  head_b = head_tmp1[0];
+		  tail_b = tail_tmp1[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
@@ -4807,221 +3400,27 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    head_t = t1 + t2;
 		    tail_t = t2 - (head_t - t1);
 		  }
-		  head_sum[0] = head_t;
-		  tail_sum[0] = tail_t;
+		  head_tmp1[0] = head_t;
+		  tail_tmp1[0] = tail_t;
 		  /* Imaginary part */
-		  head_a = head_sum[1];
-		  tail_a = tail_sum[1];
-		  head_b = head_prod[1];
-		  tail_b = tail_prod[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_sum[1] = head_t;
-		  tail_sum[1] = tail_t;
-		}
-	      }
-	      a_elem[0] = a_i[aij];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		/* Compute complex-extra = complex-double * real. */
-		double		head_t , tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[0] * split;
-		  b1 = con - x_elem[0];
-		  b1 = con - b1;
-		  b2 = x_elem[0] - b1;
-
-		  head_t = a_elem[0] * x_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[0] = head_t;
-		tail_prod[0] = tail_t;
-		{
-		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem[0] * split;
-		  a1 = con - a_elem[0];
-		  a1 = con - a1;
-		  a2 = a_elem[0] - a1;
-		  con = x_elem[1] * split;
-		  b1 = con - x_elem[1];
-		  b1 = con - b1;
-		  b2 = x_elem[1] - b1;
-
-		  head_t = a_elem[0] * x_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-		}
-		head_prod[1] = head_t;
-		tail_prod[1] = tail_t;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	      aij += incaij2;
-	      xi += incx;
-	      for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
-		a_elem[0] = a_i[aij];
-		a_elem[1] = a_i[aij + 1];
-
-		x_elem[0] = x_i[xi];
-		x_elem[1] = x_i[xi + 1];
-		{
-		  /* Compute complex-extra = complex-double * complex-double. */
-		  double	  head_t1, tail_t1;
-		  double	  head_t2, tail_t2;
-		  /* Real part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[0] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[1] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		  }
-		  head_t2 = -head_t2;
-		  tail_t2 = -tail_t2;
+		  head_a = head_tmp2[1];
+		  tail_a = tail_tmp2[1];
+		  head_b = head_tmp1[1];
+		  tail_b = tail_tmp1[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
 		    double	    bv;
 		    double	    s1  , s2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		    t1 = tail_a + tail_b;
+		    bv = t1 - tail_a;
+		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 		    s2 += t1;
 
@@ -5032,78 +3431,194 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		    t2 += s2;
 
 		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
-		  }
-		  head_prod[0] = head_t1;
-		  tail_prod[0] = tail_t1;
-		  /* Imaginary part */
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[1] * split;
-		    a1 = con - a_elem[1];
-		    a1 = con - a1;
-		    a2 = a_elem[1] - a1;
-		    con = x_elem[0] * split;
-		    b1 = con - x_elem[0];
-		    b1 = con - b1;
-		    b2 = x_elem[0] - b1;
-
-		    head_t1 = a_elem[1] * x_elem[0];
-		    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		    head_t = t1 + t2;
+		    tail_t = t2 - (head_t - t1);
 		  }
+		  head_tmp1[1] = head_t;
+		  tail_tmp1[1] = tail_t;
+		}
+		y_i[yi] = head_tmp1[0];
+		y_i[yi + 1] = head_tmp1[1];
+		if (i + 1 >= (n_i - k)) {
+		  maxj_second--;
+		}
+		if (i >= k) {
+		  astarti += (incaij + incaij2);
+		  x_starti += incx;
+		} else {
+		  maxj_first++;
+		  astarti += incaij2;
+		}
+	      }
+	    }
+	  } else {
+	    /* The most general form,   y <--- alpha * A * x + beta * y */
+	    for (i = 0, yi = y_starti; i < n_i; i++, yi += incy) {
+	      if (row_sum != NULL) {
+		head_sum[0] = row_sum[4 * i];
+		head_sum[1] = row_sum[4 * i + 1];
+		tail_sum[0] = row_sum[4 * i + 2];
+		tail_sum[1] = row_sum[4 * i + 3];
+	      } else {
+		head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+		for (j = 0, aij = astarti, xi = x_starti;
+		     j < maxj_first; j++, aij += incaij, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+		  a_elem[1] = -a_elem[1];
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = a_elem[0] * split;
-		    a1 = con - a_elem[0];
-		    a1 = con - a1;
-		    a2 = a_elem[0] - a1;
-		    con = x_elem[1] * split;
-		    b1 = con - x_elem[1];
-		    b1 = con - b1;
-		    b2 = x_elem[1] - b1;
-
-		    head_t2 = a_elem[0] * x_elem[1];
-		    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute complex-extra = complex-double * complex-double. */
+		    double	  head_t1, tail_t1;
+		    double	  head_t2, tail_t2;
+		    /* Real part */
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t1 = a_elem[0] * x_elem[0];
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		    }
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t2 = a_elem[1] * x_elem[1];
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		    }
+		    head_t2 = -head_t2;
+		    tail_t2 = -tail_t2;
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_t1 + head_t2;
+		      bv = s1 - head_t1;
+		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
+		    }
+		    head_prod[0] = head_t1;
+		    tail_prod[0] = tail_t1;
+		    /* Imaginary part */
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t1 = a_elem[1] * x_elem[0];
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		    }
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t2 = a_elem[0] * x_elem[1];
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		    }
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_t1 + head_t2;
+		      bv = s1 - head_t1;
+		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
+		    }
+		    head_prod[1] = head_t1;
+		    tail_prod[1] = tail_t1;
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Add two hi words. */
-		    s1 = head_t1 + head_t2;
-		    bv = s1 - head_t1;
-		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    s2 += t1;
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
 		  }
-		  head_prod[1] = head_t1;
-		  tail_prod[1] = tail_t1;
 		}
+		a_elem[0] = a_i[aij];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
 		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
+		  /* Compute complex-extra = complex-double * real. */
+		  double		head_t , tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem[0] * x_elem[0];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t);
+		  }
+		  head_prod[0] = head_t;
+		  tail_prod[0] = tail_t;
+		  {
+		    /* Compute double_double = double * double. */
+		    head_t = a_elem[0] * x_elem[1];
+		    tail_t = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t);
+		  }
+		  head_prod[1] = head_t;
+		  tail_prod[1] = tail_t;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
 		  /* Real part */
 		  head_a = head_sum[0];
 		  tail_a = tail_sum[0];
@@ -5111,8 +3626,8 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  tail_b = tail_prod[0];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -5145,8 +3660,8 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  tail_b = tail_prod[1];
 		  {
 		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	  bv;
+		    double	  s1    , s2, t1, t2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
@@ -5173,6 +3688,139 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		  head_sum[1] = head_t;
 		  tail_sum[1] = tail_t;
 		}
+		aij += incaij2;
+		xi += incx;
+		for (j = 1; j < maxj_second; j++, aij += incaij2, xi += incx) {
+		  a_elem[0] = a_i[aij];
+		  a_elem[1] = a_i[aij + 1];
+
+		  x_elem[0] = x_i[xi];
+		  x_elem[1] = x_i[xi + 1];
+		  {
+		    /* Compute complex-extra = complex-double * complex-double. */
+		    double	  head_t1, tail_t1;
+		    double	  head_t2, tail_t2;
+		    /* Real part */
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t1 = a_elem[0] * x_elem[0];
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		    }
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t2 = a_elem[1] * x_elem[1];
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		    }
+		    head_t2 = -head_t2;
+		    tail_t2 = -tail_t2;
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_t1 + head_t2;
+		      bv = s1 - head_t1;
+		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
+		    }
+		    head_prod[0] = head_t1;
+		    tail_prod[0] = tail_t1;
+		    /* Imaginary part */
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t1 = a_elem[1] * x_elem[0];
+		      tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		    }
+		    {
+		      /* Compute double_double = double * double. */
+		      head_t2 = a_elem[0] * x_elem[1];
+		      tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		    }
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_t1 + head_t2;
+		      bv = s1 - head_t1;
+		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
+		    }
+		    head_prod[1] = head_t1;
+		    tail_prod[1] = tail_t1;
+		  }
+		  {
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_sum[0];
+		    tail_a = tail_sum[0];
+		    head_b = head_prod[0];
+		    tail_b = tail_prod[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[0] = head_t;
+		    tail_sum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_sum[1];
+		    tail_a = tail_sum[1];
+		    head_b = head_prod[1];
+		    tail_b = tail_prod[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_sum[1] = head_t;
+		    tail_sum[1] = tail_t;
+		  }
+		}
 	      }
 	      y_elem[0] = y_i[yi];
 	      y_elem[1] = y_i[yi + 1];
@@ -5183,35 +3831,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -5247,35 +3873,13 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[1] * split;
-		  a1 = con - y_elem[1];
-		  a1 = con - a1;
-		  a2 = y_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = y_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = y_elem[0] * split;
-		  a1 = con - y_elem[0];
-		  a1 = con - a1;
-		  a2 = y_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = y_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -5320,20 +3924,10 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -5344,20 +3938,10 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -5400,20 +3984,10 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -5424,20 +3998,10 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -5566,6 +4130,7 @@ void		BLAS_zhbmv_x(enum blas_order_type order,
 	  }
 	}
       }
+      blas_free(row_sum);
       FPU_FIX_STOP;
 
       break;
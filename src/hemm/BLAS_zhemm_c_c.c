@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_zhemm_c_c(enum blas_order_type order, enum blas_side_type side,
 	       		enum		blas_uplo_type uplo, int m, int n,
 	    		const		void  *alpha, const void *a, int lda,
@@ -95,6 +96,12 @@ void		BLAS_zhemm_c_c(enum blas_order_type order, enum blas_side_type side,
 
 
 
+  /* Large problems go through the packed engine. */
+  if (blas_hemm_engine(order, side, uplo, m, n, alpha,
+		       a, blas_gemm_elt_c, lda, b, blas_gemm_elt_c, ldb,
+		       beta, c, blas_gemm_elt_z, ldc, blas_prec_double))
+    return;
+
   /* Check for error conditions. */
   if (m <= 0 || n <= 0) {
     return;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		 		enum		blas_uplo_type uplo, int m, int n,
 	      		const		void  *alpha, const void *a, int lda,
@@ -67,10 +68,17 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
  *
  */
 {
+  /* Large problems go through the packed engine. */
+  if (blas_hemm_engine(order, side, uplo, m, n, alpha,
+		       a, blas_gemm_elt_z, lda, b, blas_gemm_elt_d, ldb,
+		       beta, c, blas_gemm_elt_z, ldc, prec))
+    return;
+
   switch (prec) {
 
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       /* Integer Index Variables */
@@ -472,35 +480,13 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -536,35 +522,13 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -624,37 +588,15 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		  double	  head_t, tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[0] * split;
-		    b1 = con - a_elem[0];
-		    b1 = con - b1;
-		    b2 = a_elem[0] - b1;
-
 		    head_t = b_elem * a_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[1] * split;
-		    b1 = con - a_elem[1];
-		    b1 = con - b1;
-		    b2 = a_elem[1] - b1;
-
 		    head_t = b_elem * a_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
@@ -744,37 +686,15 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		  double	  head_t, tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[0] * split;
-		    b1 = con - a_elem[0];
-		    b1 = con - b1;
-		    b2 = a_elem[0] - b1;
-
 		    head_t = b_elem * a_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[1] * split;
-		    b1 = con - a_elem[1];
-		    b1 = con - b1;
-		    b2 = a_elem[1] - b1;
-
 		    head_t = b_elem * a_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
@@ -881,37 +801,15 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		  double	  head_t, tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[0] * split;
-		    b1 = con - a_elem[0];
-		    b1 = con - b1;
-		    b2 = a_elem[0] - b1;
-
 		    head_t = b_elem * a_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[1] * split;
-		    b1 = con - a_elem[1];
-		    b1 = con - b1;
-		    b2 = a_elem[1] - b1;
-
 		    head_t = b_elem * a_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
@@ -1001,37 +899,15 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		  double	  head_t, tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[0] * split;
-		    b1 = con - a_elem[0];
-		    b1 = con - b1;
-		    b2 = a_elem[0] - b1;
-
 		    head_t = b_elem * a_elem[0];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[0], head_t);
 		  }
 		  head_prod[0] = head_t;
 		  tail_prod[0] = tail_t;
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = b_elem * split;
-		    a1 = con - b_elem;
-		    a1 = con - a1;
-		    a2 = b_elem - a1;
-		    con = a_elem[1] * split;
-		    b1 = con - a_elem[1];
-		    b1 = con - b1;
-		    b2 = a_elem[1] - b1;
-
 		    head_t = b_elem * a_elem[1];
-		    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[1], head_t);
 		  }
 		  head_prod[1] = head_t;
 		  tail_prod[1] = tail_t;
@@ -1119,35 +995,13 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[0] * split;
-		  a1 = con - c_elem[0];
-		  a1 = con - a1;
-		  a2 = c_elem[0] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = c_elem[0] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[1] * split;
-		  a1 = con - c_elem[1];
-		  a1 = con - a1;
-		  a2 = c_elem[1] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = c_elem[1] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1183,35 +1037,13 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[1] * split;
-		  a1 = con - c_elem[1];
-		  a1 = con - a1;
-		  a2 = c_elem[1] - a1;
-		  con = beta_i[0] * split;
-		  b1 = con - beta_i[0];
-		  b1 = con - b1;
-		  b2 = beta_i[0] - b1;
-
 		  head_t1 = c_elem[1] * beta_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = c_elem[0] * split;
-		  a1 = con - c_elem[0];
-		  a1 = con - a1;
-		  a2 = c_elem[0] - a1;
-		  con = beta_i[1] * split;
-		  b1 = con - beta_i[1];
-		  b1 = con - b1;
-		  b2 = beta_i[1] - b1;
-
 		  head_t2 = c_elem[0] * beta_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1350,37 +1182,15 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		double		head_t , tail_t;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = a_elem[0] * split;
-		  b1 = con - a_elem[0];
-		  b1 = con - b1;
-		  b2 = a_elem[0] - b1;
-
 		  head_t = b_elem * a_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[0], head_t);
 		}
 		head_prod[0] = head_t;
 		tail_prod[0] = tail_t;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = a_elem[1] * split;
-		  b1 = con - a_elem[1];
-		  b1 = con - b1;
-		  b2 = a_elem[1] - b1;
-
 		  head_t = b_elem * a_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[1], head_t);
 		}
 		head_prod[1] = head_t;
 		tail_prod[1] = tail_t;
@@ -1470,37 +1280,15 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		double		head_t , tail_t;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = a_elem[0] * split;
-		  b1 = con - a_elem[0];
-		  b1 = con - b1;
-		  b2 = a_elem[0] - b1;
-
 		  head_t = b_elem * a_elem[0];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[0], head_t);
 		}
 		head_prod[0] = head_t;
 		tail_prod[0] = tail_t;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = b_elem * split;
-		  a1 = con - b_elem;
-		  a1 = con - a1;
-		  a2 = b_elem - a1;
-		  con = a_elem[1] * split;
-		  b1 = con - a_elem[1];
-		  b1 = con - b1;
-		  b2 = a_elem[1] - b1;
-
 		  head_t = b_elem * a_elem[1];
-		  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t = BLAS_TWO_PROD_ERR(b_elem, a_elem[1], head_t);
 		}
 		head_prod[1] = head_t;
 		tail_prod[1] = tail_t;
@@ -1592,19 +1380,10 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		c2 = tail_a0 * alpha_i[0];
 		t1 = c11 + c2;
@@ -1615,19 +1394,10 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		c2 = tail_a1 * alpha_i[1];
 		t1 = c11 + c2;
@@ -1670,19 +1440,10 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = alpha_i[0] * split;
-		b1 = con - alpha_i[0];
-		b1 = con - b1;
-		b2 = alpha_i[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * alpha_i[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		c2 = tail_a1 * alpha_i[0];
 		t1 = c11 + c2;
@@ -1693,19 +1454,10 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = alpha_i[1] * split;
-		b1 = con - alpha_i[1];
-		b1 = con - b1;
-		b2 = alpha_i[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * alpha_i[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		c2 = tail_a0 * alpha_i[1];
 		t1 = c11 + c2;
@@ -1754,35 +1506,13 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      /* Real part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[0] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[1] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[1], head_t2);
 	      }
 	      head_t2 = -head_t2;
 	      tail_t2 = -tail_t2;
@@ -1818,35 +1548,13 @@ void		BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 	      /* Imaginary part */
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[1] * split;
-		a1 = con - c_elem[1];
-		a1 = con - a1;
-		a2 = c_elem[1] - a1;
-		con = beta_i[0] * split;
-		b1 = con - beta_i[0];
-		b1 = con - b1;
-		b2 = beta_i[0] - b1;
-
 		head_t1 = c_elem[1] * beta_i[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t1 = BLAS_TWO_PROD_ERR(c_elem[1], beta_i[0], head_t1);
 	      }
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem[0] * split;
-		a1 = con - c_elem[0];
-		a1 = con - a1;
-		a2 = c_elem[0] - a1;
-		con = beta_i[1] * split;
-		b1 = con - beta_i[1];
-		b1 = con - b1;
-		b2 = beta_i[1] - b1;
-
 		head_t2 = c_elem[0] * beta_i[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_t2 = BLAS_TWO_PROD_ERR(c_elem[0], beta_i[1], head_t2);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -1,6 +1,7 @@
 #include <blas_extended.h>
 #include <blas_extended_private.h>
 #include <blas_fpu.h>
+#include "blas_symv_lines.h"
 void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 		    		const		void  *alpha, const void *a, int lda, const void *x_head,
 		    		const		void  *x_tail, int incx, const void *beta, const void *y,
@@ -330,6 +331,7 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
     }
 
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -605,6 +607,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
       double	      head_tmp3[2], tail_tmp3[2];
+      double         *row_sum1;
+      double         *row_sum2;
 
       FPU_FIX_DECL;
 
@@ -649,64 +653,249 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored triangle into row sums. */
+      row_sum1 = row_sum2 = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	row_sum1 = blas_symv_lines_x(order, uplo, 1, n, a_i, blas_gemm_elt_c,
+				     lda, x_head_i + xi0, blas_gemm_elt_c,
+				     incx / 2);
+	row_sum2 = blas_symv_lines_x(order, uplo, 1, n, a_i, blas_gemm_elt_c,
+				     lda, x_tail_i + xi0, blas_gemm_elt_c,
+				     incx / 2);
+      }
+
       /*
        * The most general form,   y <--- alpha * A * (x_head + x_tail) + beta *
        * y
        */
       if (uplo == blas_lower) {
 	for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
-	  head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
-	  head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-	  for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    x_elem[0] = x_head_i[xi];
-	    x_elem[1] = x_head_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
+	  if (row_sum1 != NULL && row_sum2 != NULL) {
+	    head_sum1[0] = row_sum1[4 * i];
+	    head_sum1[1] = row_sum1[4 * i + 1];
+	    tail_sum1[0] = row_sum1[4 * i + 2];
+	    tail_sum1[1] = row_sum1[4 * i + 3];
+	    head_sum2[0] = row_sum2[4 * i];
+	    head_sum2[1] = row_sum2[4 * i + 1];
+	    tail_sum2[0] = row_sum2[4 * i + 2];
+	    tail_sum2[1] = row_sum2[4 * i + 3];
+	  } else {
+	    head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
+	    head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+	    for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[0] = head_e1;
+		tail_prod1[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[1] = head_e1;
+		tail_prod1[1] = tail_e1;
 	      }
-	      head_prod1[0] = head_e1;
-	      tail_prod1[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
+	      }
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[0] = head_e1;
+		tail_prod2[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[1] = head_e1;
+		tail_prod2[1] = tail_e1;
 	      }
-	      head_prod1[1] = head_e1;
-	      tail_prod1[1] = tail_e1;
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
+	    }
+
+	    diag_elem = a_i[aij];
+	    x_elem[0] = x_head_i[xi];
+	    x_elem[1] = x_head_i[xi + 1];
+	    {
+	      head_prod1[0] = (double)x_elem[0] * diag_elem;
+	      tail_prod1[0] = 0.0;
+	      head_prod1[1] = (double)x_elem[1] * diag_elem;
+	      tail_prod1[1] = 0.0;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum1[0];
 	      tail_a = tail_sum1[0];
@@ -714,8 +903,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -748,8 +937,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -779,50 +968,15 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    x_elem[0] = x_tail_i[xi];
 	    x_elem[1] = x_tail_i[xi + 1];
 	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[0] = head_e1;
-	      tail_prod2[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[1] = head_e1;
-	      tail_prod2[1] = tail_e1;
+	      head_prod2[0] = (double)x_elem[0] * diag_elem;
+	      tail_prod2[0] = 0.0;
+	      head_prod2[1] = (double)x_elem[1] * diag_elem;
+	      tail_prod2[1] = 0.0;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum2[0];
 	      tail_a = tail_sum2[0];
@@ -830,8 +984,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -864,8 +1018,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -892,1028 +1046,212 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_sum2[1] = head_t;
 	      tail_sum2[1] = tail_t;
 	    }
-	  }
-
-	  diag_elem = a_i[aij];
-	  x_elem[0] = x_head_i[xi];
-	  x_elem[1] = x_head_i[xi + 1];
-	  {
-	    head_prod1[0] = (double)x_elem[0] * diag_elem;
-	    tail_prod1[0] = 0.0;
-	    head_prod1[1] = (double)x_elem[1] * diag_elem;
-	    tail_prod1[1] = 0.0;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum1[0];
-	    tail_a = tail_sum1[0];
-	    head_b = head_prod1[0];
-	    tail_b = tail_prod1[0];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[0] = head_t;
-	    tail_sum1[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum1[1];
-	    tail_a = tail_sum1[1];
-	    head_b = head_prod1[1];
-	    tail_b = tail_prod1[1];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[1] = head_t;
-	    tail_sum1[1] = tail_t;
-	  }
-	  x_elem[0] = x_tail_i[xi];
-	  x_elem[1] = x_tail_i[xi + 1];
-	  {
-	    head_prod2[0] = (double)x_elem[0] * diag_elem;
-	    tail_prod2[0] = 0.0;
-	    head_prod2[1] = (double)x_elem[1] * diag_elem;
-	    tail_prod2[1] = 0.0;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum2[0];
-	    tail_a = tail_sum2[0];
-	    head_b = head_prod2[0];
-	    tail_b = tail_prod2[0];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum2[0] = head_t;
-	    tail_sum2[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum2[1];
-	    tail_a = tail_sum2[1];
-	    head_b = head_prod2[1];
-	    tail_b = tail_prod2[1];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum2[1] = head_t;
-	    tail_sum2[1] = tail_t;
-	  }
-	  j++;
-	  aij += incaij2;
-	  xi += incx;
-
-	  for (; j < n; j++, aij += incaij2, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    a_elem[1] = -a_elem[1];
-	    x_elem[0] = x_head_i[xi];
-	    x_elem[1] = x_head_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
+	    j++;
+	    aij += incaij2;
+	    xi += incx;
+
+	    for (; j < n; j++, aij += incaij2, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      a_elem[1] = -a_elem[1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[0] = head_e1;
+		tail_prod1[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[1] = head_e1;
+		tail_prod1[1] = tail_e1;
 	      }
-	      head_prod1[0] = head_e1;
-	      tail_prod1[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
 	      }
-	      head_prod1[1] = head_e1;
-	      tail_prod1[1] = tail_e1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum1[0];
-	      tail_a = tail_sum1[0];
-	      head_b = head_prod1[0];
-	      tail_b = tail_prod1[0];
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[0] = head_e1;
+		tail_prod2[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[1] = head_e1;
+		tail_prod2[1] = tail_e1;
 	      }
-	      head_sum1[0] = head_t;
-	      tail_sum1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum1[1];
-	      tail_a = tail_sum1[1];
-	      head_b = head_prod1[1];
-	      tail_b = tail_prod1[1];
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[1] = head_t;
-	      tail_sum1[1] = tail_t;
-	    }
-	    x_elem[0] = x_tail_i[xi];
-	    x_elem[1] = x_tail_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[0] = head_e1;
-	      tail_prod2[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[1] = head_e1;
-	      tail_prod2[1] = tail_e1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum2[0];
-	      tail_a = tail_sum2[0];
-	      head_b = head_prod2[0];
-	      tail_b = tail_prod2[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[0] = head_t;
-	      tail_sum2[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum2[1];
-	      tail_a = tail_sum2[1];
-	      head_b = head_prod2[1];
-	      tail_b = tail_prod2[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[1] = head_t;
-	      tail_sum2[1] = tail_t;
-	    }
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum1[0];
-	    tail_a = tail_sum1[0];
-	    head_b = head_sum2[0];
-	    tail_b = tail_sum2[0];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[0] = head_t;
-	    tail_sum1[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum1[1];
-	    tail_a = tail_sum1[1];
-	    head_b = head_sum2[1];
-	    tail_b = tail_sum2[1];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[1] = head_t;
-	    tail_sum1[1] = tail_t;
-	  }
-	  {
-	    double	    cd   [2];
-	    cd[0] = (double)alpha_i[0];
-	    cd[1] = (double)alpha_i[1];
-	    {
-	      /* Compute complex-extra = complex-extra * complex-double. */
-	      double	      head_a0, tail_a0;
-	      double	      head_a1, tail_a1;
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      head_a0 = head_sum1[0];
-	      tail_a0 = tail_sum1[0];
-	      head_a1 = head_sum1[1];
-	      tail_a1 = tail_sum1[1];
-	      /* real part */
-	      {
-		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = cd[0] * split;
-		b1 = con - cd[0];
-		b1 = con - b1;
-		b2 = cd[0] - b1;
-
-		c11 = head_a0 * cd[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		c2 = tail_a0 * cd[0];
-		t1 = c11 + c2;
-		t2 = (c2 - (t1 - c11)) + c21;
-
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      {
-		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = cd[1] * split;
-		b1 = con - cd[1];
-		b1 = con - b1;
-		b2 = cd[1] - b1;
-
-		c11 = head_a1 * cd[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		c2 = tail_a1 * cd[1];
-		t1 = c11 + c2;
-		t2 = (c2 - (t1 - c11)) + c21;
-
-		head_t2 = t1 + t2;
-		tail_t2 = t2 - (head_t2 - t1);
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_tmp1[0] = head_t1;
-	      tail_tmp1[0] = tail_t1;
-	      /* imaginary part */
-	      {
-		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = cd[0] * split;
-		b1 = con - cd[0];
-		b1 = con - b1;
-		b2 = cd[0] - b1;
-
-		c11 = head_a1 * cd[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		c2 = tail_a1 * cd[0];
-		t1 = c11 + c2;
-		t2 = (c2 - (t1 - c11)) + c21;
-
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      {
-		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = cd[1] * split;
-		b1 = con - cd[1];
-		b1 = con - b1;
-		b2 = cd[1] - b1;
-
-		c11 = head_a0 * cd[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		c2 = tail_a0 * cd[1];
-		t1 = c11 + c2;
-		t2 = (c2 - (t1 - c11)) + c21;
-
-		head_t2 = t1 + t2;
-		tail_t2 = t2 - (head_t2 - t1);
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_tmp1[1] = head_t1;
-	      tail_tmp1[1] = tail_t1;
-	    }
-
-	  }
-	  y_elem[0] = y_i[yi];
-	  y_elem[1] = y_i[yi + 1];
-	  {
-	    double	    head_e1, tail_e1;
-	    double	    d1;
-	    double	    d2;
-	    /* Real part */
-	    d1 = (double)y_elem[0] * beta_i[0];
-	    d2 = (double)-y_elem[1] * beta_i[1];
-	    {
-	      /* Compute double-double = double + double. */
-	      double	      e , t1, t2;
-
-	      /* Knuth trick. */
-	      t1 = d1 + d2;
-	      e = t1 - d1;
-	      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-	      /* The result is t1 + t2, after normalization. */
-	      head_e1 = t1 + t2;
-	      tail_e1 = t2 - (head_e1 - t1);
-	    }
-	    head_tmp2[0] = head_e1;
-	    tail_tmp2[0] = tail_e1;
-	    /* imaginary part */
-	    d1 = (double)y_elem[0] * beta_i[1];
-	    d2 = (double)y_elem[1] * beta_i[0];
-	    {
-	      /* Compute double-double = double + double. */
-	      double	      e , t1, t2;
-
-	      /* Knuth trick. */
-	      t1 = d1 + d2;
-	      e = t1 - d1;
-	      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-	      /* The result is t1 + t2, after normalization. */
-	      head_e1 = t1 + t2;
-	      tail_e1 = t2 - (head_e1 - t1);
-	    }
-	    head_tmp2[1] = head_e1;
-	    tail_tmp2[1] = tail_e1;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_tmp1[0];
-	    tail_a = tail_tmp1[0];
-	    head_b = head_tmp2[0];
-	    tail_b = tail_tmp2[0];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_tmp3[0] = head_t;
-	    tail_tmp3[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_tmp1[1];
-	    tail_a = tail_tmp1[1];
-	    head_b = head_tmp2[1];
-	    tail_b = tail_tmp2[1];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_tmp3[1] = head_t;
-	    tail_tmp3[1] = tail_t;
-	  }
-	  y_i[yi] = head_tmp3[0];
-	  y_i[yi + 1] = head_tmp3[1];
-	}
-      } else {
-	/* uplo == blas_upper */
-	for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
-	  head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
-	  head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-
-	  for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    a_elem[1] = -a_elem[1];
-	    x_elem[0] = x_head_i[xi];
-	    x_elem[1] = x_head_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod1[0] = head_e1;
-	      tail_prod1[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod1[1] = head_e1;
-	      tail_prod1[1] = tail_e1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum1[0];
-	      tail_a = tail_sum1[0];
-	      head_b = head_prod1[0];
-	      tail_b = tail_prod1[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[0] = head_t;
-	      tail_sum1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum1[1];
-	      tail_a = tail_sum1[1];
-	      head_b = head_prod1[1];
-	      tail_b = tail_prod1[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[1] = head_t;
-	      tail_sum1[1] = tail_t;
-	    }
-	    x_elem[0] = x_tail_i[xi];
-	    x_elem[1] = x_tail_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[0] = head_e1;
-	      tail_prod2[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[1] = head_e1;
-	      tail_prod2[1] = tail_e1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum2[0];
-	      tail_a = tail_sum2[0];
-	      head_b = head_prod2[0];
-	      tail_b = tail_prod2[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[0] = head_t;
-	      tail_sum2[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum2[1];
-	      tail_a = tail_sum2[1];
-	      head_b = head_prod2[1];
-	      tail_b = tail_prod2[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
 	      }
-	      head_sum2[1] = head_t;
-	      tail_sum2[1] = tail_t;
 	    }
 	  }
-
-	  diag_elem = a_i[aij];
-	  x_elem[0] = x_head_i[xi];
-	  x_elem[1] = x_head_i[xi + 1];
-	  {
-	    head_prod1[0] = (double)x_elem[0] * diag_elem;
-	    tail_prod1[0] = 0.0;
-	    head_prod1[1] = (double)x_elem[1] * diag_elem;
-	    tail_prod1[1] = 0.0;
-	  }
 	  {
 	    double	    head_t, tail_t;
 	    double	    head_a, tail_a;
@@ -1921,8 +1259,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* Real part */
 	    head_a = head_sum1[0];
 	    tail_a = tail_sum1[0];
-	    head_b = head_prod1[0];
-	    tail_b = tail_prod1[0];
+	    head_b = head_sum2[0];
+	    tail_b = tail_sum2[0];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -1955,8 +1293,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* Imaginary part */
 	    head_a = head_sum1[1];
 	    tail_a = tail_sum1[1];
-	    head_b = head_prod1[1];
-	    tail_b = tail_prod1[1];
+	    head_b = head_sum2[1];
+	    tail_b = tail_sum2[1];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -1987,23 +1325,193 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    head_sum1[1] = head_t;
 	    tail_sum1[1] = tail_t;
 	  }
-	  x_elem[0] = x_tail_i[xi];
-	  x_elem[1] = x_tail_i[xi + 1];
 	  {
-	    head_prod2[0] = (double)x_elem[0] * diag_elem;
-	    tail_prod2[0] = 0.0;
-	    head_prod2[1] = (double)x_elem[1] * diag_elem;
-	    tail_prod2[1] = 0.0;
+	    double	    cd   [2];
+	    cd[0] = (double)alpha_i[0];
+	    cd[1] = (double)alpha_i[1];
+	    {
+	      /* Compute complex-extra = complex-extra * complex-double. */
+	      double	      head_a0, tail_a0;
+	      double	      head_a1, tail_a1;
+	      double	      head_t1, tail_t1;
+	      double	      head_t2, tail_t2;
+	      head_a0 = head_sum1[0];
+	      tail_a0 = tail_sum1[0];
+	      head_a1 = head_sum1[1];
+	      tail_a1 = tail_sum1[1];
+	      /* real part */
+	      {
+		/* Compute double-double = double-double * double. */
+		double		c11    , c21, c2, t1, t2;
+
+		c11 = head_a0 * cd[0];
+		c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
+
+		c2 = tail_a0 * cd[0];
+		t1 = c11 + c2;
+		t2 = (c2 - (t1 - c11)) + c21;
+
+		head_t1 = t1 + t2;
+		tail_t1 = t2 - (head_t1 - t1);
+	      }
+	      {
+		/* Compute double-double = double-double * double. */
+		double		c11    , c21, c2, t1, t2;
+
+		c11 = head_a1 * cd[1];
+		c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
+
+		c2 = tail_a1 * cd[1];
+		t1 = c11 + c2;
+		t2 = (c2 - (t1 - c11)) + c21;
+
+		head_t2 = t1 + t2;
+		tail_t2 = t2 - (head_t2 - t1);
+	      }
+	      head_t2 = -head_t2;
+	      tail_t2 = -tail_t2;
+	      {
+		/* Compute double-double = double-double + double-double. */
+		double		bv;
+		double		s1     , s2, t1, t2;
+
+		/* Add two hi words. */
+		s1 = head_t1 + head_t2;
+		bv = s1 - head_t1;
+		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		/* Add two lo words. */
+		t1 = tail_t1 + tail_t2;
+		bv = t1 - tail_t1;
+		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		s2 += t1;
+
+		/* Renormalize (s1, s2)  to  (t1, s2) */
+		t1 = s1 + s2;
+		s2 = s2 - (t1 - s1);
+
+		t2 += s2;
+
+		/* Renormalize (t1, t2)  */
+		head_t1 = t1 + t2;
+		tail_t1 = t2 - (head_t1 - t1);
+	      }
+	      head_tmp1[0] = head_t1;
+	      tail_tmp1[0] = tail_t1;
+	      /* imaginary part */
+	      {
+		/* Compute double-double = double-double * double. */
+		double		c11    , c21, c2, t1, t2;
+
+		c11 = head_a1 * cd[0];
+		c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+		c2 = tail_a1 * cd[0];
+		t1 = c11 + c2;
+		t2 = (c2 - (t1 - c11)) + c21;
+
+		head_t1 = t1 + t2;
+		tail_t1 = t2 - (head_t1 - t1);
+	      }
+	      {
+		/* Compute double-double = double-double * double. */
+		double		c11    , c21, c2, t1, t2;
+
+		c11 = head_a0 * cd[1];
+		c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+		c2 = tail_a0 * cd[1];
+		t1 = c11 + c2;
+		t2 = (c2 - (t1 - c11)) + c21;
+
+		head_t2 = t1 + t2;
+		tail_t2 = t2 - (head_t2 - t1);
+	      }
+	      {
+		/* Compute double-double = double-double + double-double. */
+		double		bv;
+		double		s1     , s2, t1, t2;
+
+		/* Add two hi words. */
+		s1 = head_t1 + head_t2;
+		bv = s1 - head_t1;
+		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		/* Add two lo words. */
+		t1 = tail_t1 + tail_t2;
+		bv = t1 - tail_t1;
+		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		s2 += t1;
+
+		/* Renormalize (s1, s2)  to  (t1, s2) */
+		t1 = s1 + s2;
+		s2 = s2 - (t1 - s1);
+
+		t2 += s2;
+
+		/* Renormalize (t1, t2)  */
+		head_t1 = t1 + t2;
+		tail_t1 = t2 - (head_t1 - t1);
+	      }
+	      head_tmp1[1] = head_t1;
+	      tail_tmp1[1] = tail_t1;
+	    }
+
+	  }
+	  y_elem[0] = y_i[yi];
+	  y_elem[1] = y_i[yi + 1];
+	  {
+	    double	    head_e1, tail_e1;
+	    double	    d1;
+	    double	    d2;
+	    /* Real part */
+	    d1 = (double)y_elem[0] * beta_i[0];
+	    d2 = (double)-y_elem[1] * beta_i[1];
+	    {
+	      /* Compute double-double = double + double. */
+	      double	      e , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = d1 + d2;
+	      e = t1 - d1;
+	      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_e1 = t1 + t2;
+	      tail_e1 = t2 - (head_e1 - t1);
+	    }
+	    head_tmp2[0] = head_e1;
+	    tail_tmp2[0] = tail_e1;
+	    /* imaginary part */
+	    d1 = (double)y_elem[0] * beta_i[1];
+	    d2 = (double)y_elem[1] * beta_i[0];
+	    {
+	      /* Compute double-double = double + double. */
+	      double	      e , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = d1 + d2;
+	      e = t1 - d1;
+	      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_e1 = t1 + t2;
+	      tail_e1 = t2 - (head_e1 - t1);
+	    }
+	    head_tmp2[1] = head_e1;
+	    tail_tmp2[1] = tail_e1;
 	  }
 	  {
 	    double	    head_t, tail_t;
 	    double	    head_a, tail_a;
 	    double	    head_b, tail_b;
 	    /* Real part */
-	    head_a = head_sum2[0];
-	    tail_a = tail_sum2[0];
-	    head_b = head_prod2[0];
-	    tail_b = tail_prod2[0];
+	    head_a = head_tmp1[0];
+	    tail_a = tail_tmp1[0];
+	    head_b = head_tmp2[0];
+	    tail_b = tail_tmp2[0];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -2031,13 +1539,13 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_t = t1 + t2;
 	      tail_t = t2 - (head_t - t1);
 	    }
-	    head_sum2[0] = head_t;
-	    tail_sum2[0] = tail_t;
+	    head_tmp3[0] = head_t;
+	    tail_tmp3[0] = tail_t;
 	    /* Imaginary part */
-	    head_a = head_sum2[1];
-	    tail_a = tail_sum2[1];
-	    head_b = head_prod2[1];
-	    tail_b = tail_prod2[1];
+	    head_a = head_tmp1[1];
+	    tail_a = tail_tmp1[1];
+	    head_b = head_tmp2[1];
+	    tail_b = tail_tmp2[1];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -2065,63 +1573,243 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_t = t1 + t2;
 	      tail_t = t2 - (head_t - t1);
 	    }
-	    head_sum2[1] = head_t;
-	    tail_sum2[1] = tail_t;
+	    head_tmp3[1] = head_t;
+	    tail_tmp3[1] = tail_t;
 	  }
-	  j++;
-	  aij += incaij2;
-	  xi += incx;
-
-	  for (; j < n; j++, aij += incaij2, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    x_elem[0] = x_head_i[xi];
-	    x_elem[1] = x_head_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
+	  y_i[yi] = head_tmp3[0];
+	  y_i[yi + 1] = head_tmp3[1];
+	}
+      } else {
+	/* uplo == blas_upper */
+	for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
+	  if (row_sum1 != NULL && row_sum2 != NULL) {
+	    head_sum1[0] = row_sum1[4 * i];
+	    head_sum1[1] = row_sum1[4 * i + 1];
+	    tail_sum1[0] = row_sum1[4 * i + 2];
+	    tail_sum1[1] = row_sum1[4 * i + 3];
+	    head_sum2[0] = row_sum2[4 * i];
+	    head_sum2[1] = row_sum2[4 * i + 1];
+	    tail_sum2[0] = row_sum2[4 * i + 2];
+	    tail_sum2[1] = row_sum2[4 * i + 3];
+	  } else {
+	    head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
+	    head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+
+	    for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      a_elem[1] = -a_elem[1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[0] = head_e1;
+		tail_prod1[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[1] = head_e1;
+		tail_prod1[1] = tail_e1;
 	      }
-	      head_prod1[0] = head_e1;
-	      tail_prod1[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
 	      }
-	      head_prod1[1] = head_e1;
-	      tail_prod1[1] = tail_e1;
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[0] = head_e1;
+		tail_prod2[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[1] = head_e1;
+		tail_prod2[1] = tail_e1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
+	    }
+
+	    diag_elem = a_i[aij];
+	    x_elem[0] = x_head_i[xi];
+	    x_elem[1] = x_head_i[xi + 1];
+	    {
+	      head_prod1[0] = (double)x_elem[0] * diag_elem;
+	      tail_prod1[0] = 0.0;
+	      head_prod1[1] = (double)x_elem[1] * diag_elem;
+	      tail_prod1[1] = 0.0;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum1[0];
 	      tail_a = tail_sum1[0];
@@ -2129,8 +1817,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -2163,8 +1851,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -2194,50 +1882,15 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    x_elem[0] = x_tail_i[xi];
 	    x_elem[1] = x_tail_i[xi + 1];
 	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[0] = head_e1;
-	      tail_prod2[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_prod2[1] = head_e1;
-	      tail_prod2[1] = tail_e1;
+	      head_prod2[0] = (double)x_elem[0] * diag_elem;
+	      tail_prod2[0] = 0.0;
+	      head_prod2[1] = (double)x_elem[1] * diag_elem;
+	      tail_prod2[1] = 0.0;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum2[0];
 	      tail_a = tail_sum2[0];
@@ -2245,8 +1898,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -2279,8 +1932,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -2307,6 +1960,210 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_sum2[1] = head_t;
 	      tail_sum2[1] = tail_t;
 	    }
+	    j++;
+	    aij += incaij2;
+	    xi += incx;
+
+	    for (; j < n; j++, aij += incaij2, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
+	      {
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[0] = head_e1;
+		tail_prod1[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod1[1] = head_e1;
+		tail_prod1[1] = tail_e1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
+	      }
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[0] = head_e1;
+		tail_prod2[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod2[1] = head_e1;
+		tail_prod2[1] = tail_e1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
+	    }
 	  }
 	  {
 	    double	    head_t, tail_t;
@@ -2398,19 +2255,10 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = cd[0] * split;
-		b1 = con - cd[0];
-		b1 = con - b1;
-		b2 = cd[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * cd[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		c2 = tail_a0 * cd[0];
 		t1 = c11 + c2;
@@ -2421,19 +2269,10 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = cd[1] * split;
-		b1 = con - cd[1];
-		b1 = con - b1;
-		b2 = cd[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * cd[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		c2 = tail_a1 * cd[1];
 		t1 = c11 + c2;
@@ -2476,19 +2315,10 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = cd[0] * split;
-		b1 = con - cd[0];
-		b1 = con - b1;
-		b2 = cd[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * cd[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		c2 = tail_a1 * cd[0];
 		t1 = c11 + c2;
@@ -2499,19 +2329,10 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = cd[1] * split;
-		b1 = con - cd[1];
-		b1 = con - b1;
-		b2 = cd[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * cd[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		c2 = tail_a0 * cd[1];
 		t1 = c11 + c2;
@@ -2673,6 +2494,8 @@ void		BLAS_chemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	}
       }
 
+      blas_free(row_sum1);
+      blas_free(row_sum2);
       FPU_FIX_STOP;
 
       break;
@@ -1,6 +1,7 @@
 #include <blas_extended.h>
 #include <blas_extended_private.h>
 #include <blas_fpu.h>
+#include "blas_symv_lines.h"
 void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 		    		const		void  *alpha, const void *a, int lda, const void *x_head,
 		    		const		void  *x_tail, int incx, const void *beta, const void *y,
@@ -318,6 +319,7 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
     }
 
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -593,6 +595,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
       double	      head_tmp3[2], tail_tmp3[2];
+      double         *row_sum1;
+      double         *row_sum2;
 
       FPU_FIX_DECL;
 
@@ -637,154 +641,317 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored triangle into row sums. */
+      row_sum1 = row_sum2 = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0)) {
+	row_sum1 = blas_symv_lines_x(order, uplo, 1, n, a_i, blas_gemm_elt_z,
+				     lda, x_head_i + xi0, blas_gemm_elt_z,
+				     incx / 2);
+	row_sum2 = blas_symv_lines_x(order, uplo, 1, n, a_i, blas_gemm_elt_z,
+				     lda, x_tail_i + xi0, blas_gemm_elt_z,
+				     incx / 2);
+      }
+
       /*
        * The most general form,   y <--- alpha * A * (x_head + x_tail) + beta *
        * y
        */
       if (uplo == blas_lower) {
 	for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
-	  head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
-	  head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-	  for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
+	  if (row_sum1 != NULL && row_sum2 != NULL) {
+	    head_sum1[0] = row_sum1[4 * i];
+	    head_sum1[1] = row_sum1[4 * i + 1];
+	    tail_sum1[0] = row_sum1[4 * i + 2];
+	    tail_sum1[1] = row_sum1[4 * i + 3];
+	    head_sum2[0] = row_sum2[4 * i];
+	    head_sum2[1] = row_sum2[4 * i + 1];
+	    tail_sum2[0] = row_sum2[4 * i + 2];
+	    tail_sum2[1] = row_sum2[4 * i + 3];
+	  } else {
+	    head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
+	    head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+	    for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[0] = head_t1;
+		tail_prod1[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[1] = head_t1;
+		tail_prod1[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
+	      }
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[0] = head_t1;
+		tail_prod2[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[1] = head_t1;
+		tail_prod2[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
+	    }
+
+	    diag_elem = a_i[aij];
 	    x_elem[0] = x_head_i[xi];
 	    x_elem[1] = x_head_i[xi + 1];
 	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod1[0] = head_t1;
-	      tail_prod1[0] = tail_t1;
-	      /* Imaginary part */
+	      /* Compute complex-extra = complex-double * real. */
+	      double	    head_t, tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		head_t = diag_elem * x_elem[0];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[0], head_t);
 	      }
+	      head_prod1[0] = head_t;
+	      tail_prod1[0] = tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
+		head_t = diag_elem * x_elem[1];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[1], head_t);
 	      }
-	      head_prod1[1] = head_t1;
-	      tail_prod1[1] = tail_t1;
+	      head_prod1[1] = head_t;
+	      tail_prod1[1] = tail_t;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum1[0];
 	      tail_a = tail_sum1[0];
@@ -792,8 +959,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -826,8 +993,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -857,140 +1024,27 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    x_elem[0] = x_tail_i[xi];
 	    x_elem[1] = x_tail_i[xi + 1];
 	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod2[0] = head_t1;
-	      tail_prod2[0] = tail_t1;
-	      /* Imaginary part */
+	      /* Compute complex-extra = complex-double * real. */
+	      double	    head_t, tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		head_t = diag_elem * x_elem[0];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[0], head_t);
 	      }
+	      head_prod2[0] = head_t;
+	      tail_prod2[0] = tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
+		head_t = diag_elem * x_elem[1];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[1], head_t);
 	      }
-	      head_prod2[1] = head_t1;
-	      tail_prod2[1] = tail_t1;
+	      head_prod2[1] = head_t;
+	      tail_prod2[1] = tail_t;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum2[0];
 	      tail_a = tail_sum2[0];
@@ -998,8 +1052,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -1032,8 +1086,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -1060,50 +1114,267 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_sum2[1] = head_t;
 	      tail_sum2[1] = tail_t;
 	    }
-	  }
-
-	  diag_elem = a_i[aij];
-	  x_elem[0] = x_head_i[xi];
-	  x_elem[1] = x_head_i[xi + 1];
-	  {
-	    /* Compute complex-extra = complex-double * real. */
-	    double	    head_t, tail_t;
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[0] * split;
-	      b1 = con - x_elem[0];
-	      b1 = con - b1;
-	      b2 = x_elem[0] - b1;
-
-	      head_t = diag_elem * x_elem[0];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    head_prod1[0] = head_t;
-	    tail_prod1[0] = tail_t;
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[1] * split;
-	      b1 = con - x_elem[1];
-	      b1 = con - b1;
-	      b2 = x_elem[1] - b1;
-
-	      head_t = diag_elem * x_elem[1];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    j++;
+	    aij += incaij2;
+	    xi += incx;
+
+	    for (; j < n; j++, aij += incaij2, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      a_elem[1] = -a_elem[1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[0] = head_t1;
+		tail_prod1[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[1] = head_t1;
+		tail_prod1[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
+	      }
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[0] = head_t1;
+		tail_prod2[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[1] = head_t1;
+		tail_prod2[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
 	    }
-	    head_prod1[1] = head_t;
-	    tail_prod1[1] = tail_t;
 	  }
 	  {
 	    double	    head_t, tail_t;
@@ -1112,8 +1383,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* Real part */
 	    head_a = head_sum1[0];
 	    tail_a = tail_sum1[0];
-	    head_b = head_prod1[0];
-	    tail_b = tail_prod1[0];
+	    head_b = head_sum2[0];
+	    tail_b = tail_sum2[0];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -1146,8 +1417,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* Imaginary part */
 	    head_a = head_sum1[1];
 	    tail_a = tail_sum1[1];
-	    head_b = head_prod1[1];
-	    tail_b = tail_prod1[1];
+	    head_b = head_sum2[1];
+	    tail_b = tail_sum2[1];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -1178,105 +1449,61 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    head_sum1[1] = head_t;
 	    tail_sum1[1] = tail_t;
 	  }
-	  x_elem[0] = x_tail_i[xi];
-	  x_elem[1] = x_tail_i[xi + 1];
-	  {
-	    /* Compute complex-extra = complex-double * real. */
-	    double	    head_t, tail_t;
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[0] * split;
-	      b1 = con - x_elem[0];
-	      b1 = con - b1;
-	      b2 = x_elem[0] - b1;
-
-	      head_t = diag_elem * x_elem[0];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    head_prod2[0] = head_t;
-	    tail_prod2[0] = tail_t;
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[1] * split;
-	      b1 = con - x_elem[1];
-	      b1 = con - b1;
-	      b2 = x_elem[1] - b1;
-
-	      head_t = diag_elem * x_elem[1];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    head_prod2[1] = head_t;
-	    tail_prod2[1] = tail_t;
-	  }
 	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum2[0];
-	    tail_a = tail_sum2[0];
-	    head_b = head_prod2[0];
-	    tail_b = tail_prod2[0];
+	    /* Compute complex-extra = complex-extra * complex-double. */
+	    double	    head_a0, tail_a0;
+	    double	    head_a1, tail_a1;
+	    double	    head_t1, tail_t1;
+	    double	    head_t2, tail_t2;
+	    head_a0 = head_sum1[0];
+	    tail_a0 = tail_sum1[0];
+	    head_a1 = head_sum1[1];
+	    tail_a1 = tail_sum1[1];
+	    /* real part */
 	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      /* Compute double-double = double-double * double. */
+	      double	      c11, c21, c2, t1, t2;
 
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      c11 = head_a0 * alpha_i[0];
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      c2 = tail_a0 * alpha_i[0];
+	      t1 = c11 + c2;
+	      t2 = (c2 - (t1 - c11)) + c21;
 
-	      s2 += t1;
+	      head_t1 = t1 + t2;
+	      tail_t1 = t2 - (head_t1 - t1);
+	    }
+	    {
+	      /* Compute double-double = double-double * double. */
+	      double	      c11, c21, c2, t1, t2;
 
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+	      c11 = head_a1 * alpha_i[1];
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-	      t2 += s2;
+	      c2 = tail_a1 * alpha_i[1];
+	      t1 = c11 + c2;
+	      t2 = (c2 - (t1 - c11)) + c21;
 
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      head_t2 = t1 + t2;
+	      tail_t2 = t2 - (head_t2 - t1);
 	    }
-	    head_sum2[0] = head_t;
-	    tail_sum2[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum2[1];
-	    tail_a = tail_sum2[1];
-	    head_b = head_prod2[1];
-	    tail_b = tail_prod2[1];
+	    head_t2 = -head_t2;
+	    tail_t2 = -tail_t2;
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
 	      double	      s1, s2, t1, t2;
 
 	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      s1 = head_t1 + head_t2;
+	      bv = s1 - head_t1;
+	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      t1 = tail_t1 + tail_t2;
+	      bv = t1 - tail_t1;
+	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 	      s2 += t1;
 
@@ -1287,1371 +1514,104 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      t2 += s2;
 
 	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      head_t1 = t1 + t2;
+	      tail_t1 = t2 - (head_t1 - t1);
 	    }
-	    head_sum2[1] = head_t;
-	    tail_sum2[1] = tail_t;
-	  }
-	  j++;
-	  aij += incaij2;
-	  xi += incx;
-
-	  for (; j < n; j++, aij += incaij2, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    a_elem[1] = -a_elem[1];
-	    x_elem[0] = x_head_i[xi];
-	    x_elem[1] = x_head_i[xi + 1];
+	    head_tmp1[0] = head_t1;
+	    tail_tmp1[0] = tail_t1;
+	    /* imaginary part */
 	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod1[0] = head_t1;
-	      tail_prod1[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
+	      /* Compute double-double = double-double * double. */
+	      double	      c11, c21, c2, t1, t2;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+	      c11 = head_a1 * alpha_i[0];
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-		t2 += s2;
+	      c2 = tail_a1 * alpha_i[0];
+	      t1 = c11 + c2;
+	      t2 = (c2 - (t1 - c11)) + c21;
 
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod1[1] = head_t1;
-	      tail_prod1[1] = tail_t1;
+	      head_t1 = t1 + t2;
+	      tail_t1 = t2 - (head_t1 - t1);
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum1[0];
-	      tail_a = tail_sum1[0];
-	      head_b = head_prod1[0];
-	      tail_b = tail_prod1[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[0] = head_t;
-	      tail_sum1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum1[1];
-	      tail_a = tail_sum1[1];
-	      head_b = head_prod1[1];
-	      tail_b = tail_prod1[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[1] = head_t;
-	      tail_sum1[1] = tail_t;
-	    }
-	    x_elem[0] = x_tail_i[xi];
-	    x_elem[1] = x_tail_i[xi + 1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod2[0] = head_t1;
-	      tail_prod2[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod2[1] = head_t1;
-	      tail_prod2[1] = tail_t1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum2[0];
-	      tail_a = tail_sum2[0];
-	      head_b = head_prod2[0];
-	      tail_b = tail_prod2[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[0] = head_t;
-	      tail_sum2[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum2[1];
-	      tail_a = tail_sum2[1];
-	      head_b = head_prod2[1];
-	      tail_b = tail_prod2[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[1] = head_t;
-	      tail_sum2[1] = tail_t;
-	    }
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum1[0];
-	    tail_a = tail_sum1[0];
-	    head_b = head_sum2[0];
-	    tail_b = tail_sum2[0];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[0] = head_t;
-	    tail_sum1[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_sum1[1];
-	    tail_a = tail_sum1[1];
-	    head_b = head_sum2[1];
-	    tail_b = tail_sum2[1];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[1] = head_t;
-	    tail_sum1[1] = tail_t;
-	  }
-	  {
-	    /* Compute complex-extra = complex-extra * complex-double. */
-	    double	    head_a0, tail_a0;
-	    double	    head_a1, tail_a1;
-	    double	    head_t1, tail_t1;
-	    double	    head_t2, tail_t2;
-	    head_a0 = head_sum1[0];
-	    tail_a0 = tail_sum1[0];
-	    head_a1 = head_sum1[1];
-	    tail_a1 = tail_sum1[1];
-	    /* real part */
-	    {
-	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = alpha_i[0] * split;
-	      b1 = con - alpha_i[0];
-	      b1 = con - b1;
-	      b2 = alpha_i[0] - b1;
-
-	      c11 = head_a0 * alpha_i[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-	      c2 = tail_a0 * alpha_i[0];
-	      t1 = c11 + c2;
-	      t2 = (c2 - (t1 - c11)) + c21;
-
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
-	    }
-	    {
-	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = alpha_i[1] * split;
-	      b1 = con - alpha_i[1];
-	      b1 = con - b1;
-	      b2 = alpha_i[1] - b1;
-
-	      c11 = head_a1 * alpha_i[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-	      c2 = tail_a1 * alpha_i[1];
-	      t1 = c11 + c2;
-	      t2 = (c2 - (t1 - c11)) + c21;
-
-	      head_t2 = t1 + t2;
-	      tail_t2 = t2 - (head_t2 - t1);
-	    }
-	    head_t2 = -head_t2;
-	    tail_t2 = -tail_t2;
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_t1 + head_t2;
-	      bv = s1 - head_t1;
-	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
-	    }
-	    head_tmp1[0] = head_t1;
-	    tail_tmp1[0] = tail_t1;
-	    /* imaginary part */
-	    {
-	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = alpha_i[0] * split;
-	      b1 = con - alpha_i[0];
-	      b1 = con - b1;
-	      b2 = alpha_i[0] - b1;
-
-	      c11 = head_a1 * alpha_i[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-	      c2 = tail_a1 * alpha_i[0];
-	      t1 = c11 + c2;
-	      t2 = (c2 - (t1 - c11)) + c21;
-
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
-	    }
-	    {
-	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = alpha_i[1] * split;
-	      b1 = con - alpha_i[1];
-	      b1 = con - b1;
-	      b2 = alpha_i[1] - b1;
-
-	      c11 = head_a0 * alpha_i[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-	      c2 = tail_a0 * alpha_i[1];
-	      t1 = c11 + c2;
-	      t2 = (c2 - (t1 - c11)) + c21;
-
-	      head_t2 = t1 + t2;
-	      tail_t2 = t2 - (head_t2 - t1);
-	    }
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_t1 + head_t2;
-	      bv = s1 - head_t1;
-	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
-	    }
-	    head_tmp1[1] = head_t1;
-	    tail_tmp1[1] = tail_t1;
-	  }
-
-	  y_elem[0] = y_i[yi];
-	  y_elem[1] = y_i[yi + 1];
-	  {
-	    /* Compute complex-extra = complex-double * complex-double. */
-	    double	    head_t1, tail_t1;
-	    double	    head_t2, tail_t2;
-	    /* Real part */
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
-	      head_t1 = y_elem[0] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
-	      head_t2 = y_elem[1] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    head_t2 = -head_t2;
-	    tail_t2 = -tail_t2;
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_t1 + head_t2;
-	      bv = s1 - head_t1;
-	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
-	    }
-	    head_tmp2[0] = head_t1;
-	    tail_tmp2[0] = tail_t1;
-	    /* Imaginary part */
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
-	      head_t1 = y_elem[1] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
-	      head_t2 = y_elem[0] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_t1 + head_t2;
-	      bv = s1 - head_t1;
-	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_t1 + tail_t2;
-	      bv = t1 - tail_t1;
-	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t1 = t1 + t2;
-	      tail_t1 = t2 - (head_t1 - t1);
-	    }
-	    head_tmp2[1] = head_t1;
-	    tail_tmp2[1] = tail_t1;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_tmp1[0];
-	    tail_a = tail_tmp1[0];
-	    head_b = head_tmp2[0];
-	    tail_b = tail_tmp2[0];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_tmp3[0] = head_t;
-	    tail_tmp3[0] = tail_t;
-	    /* Imaginary part */
-	    head_a = head_tmp1[1];
-	    tail_a = tail_tmp1[1];
-	    head_b = head_tmp2[1];
-	    tail_b = tail_tmp2[1];
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	      s2 += t1;
-
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
-
-	      t2 += s2;
-
-	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_tmp3[1] = head_t;
-	    tail_tmp3[1] = tail_t;
-	  }
-	  y_i[yi] = head_tmp3[0];
-	  y_i[yi + 1] = head_tmp3[1];
-	}
-      } else {
-	/* uplo == blas_upper */
-	for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
-	  head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
-	  head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
-
-	  for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
-	    a_elem[1] = -a_elem[1];
-	    x_elem[0] = x_head_i[xi];
-	    x_elem[1] = x_head_i[xi + 1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod1[0] = head_t1;
-	      tail_prod1[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod1[1] = head_t1;
-	      tail_prod1[1] = tail_t1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum1[0];
-	      tail_a = tail_sum1[0];
-	      head_b = head_prod1[0];
-	      tail_b = tail_prod1[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[0] = head_t;
-	      tail_sum1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum1[1];
-	      tail_a = tail_sum1[1];
-	      head_b = head_prod1[1];
-	      tail_b = tail_prod1[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum1[1] = head_t;
-	      tail_sum1[1] = tail_t;
-	    }
-	    x_elem[0] = x_tail_i[xi];
-	    x_elem[1] = x_tail_i[xi + 1];
-	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod2[0] = head_t1;
-	      tail_prod2[0] = tail_t1;
-	      /* Imaginary part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod2[1] = head_t1;
-	      tail_prod2[1] = tail_t1;
-	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum2[0];
-	      tail_a = tail_sum2[0];
-	      head_b = head_prod2[0];
-	      tail_b = tail_prod2[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
+	      /* Compute double-double = double-double * double. */
+	      double	      c11, c21, c2, t1, t2;
 
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[0] = head_t;
-	      tail_sum2[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum2[1];
-	      tail_a = tail_sum2[1];
-	      head_b = head_prod2[1];
-	      tail_b = tail_prod2[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+	      c11 = head_a0 * alpha_i[1];
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      c2 = tail_a0 * alpha_i[1];
+	      t1 = c11 + c2;
+	      t2 = (c2 - (t1 - c11)) + c21;
 
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      head_t2 = t1 + t2;
+	      tail_t2 = t2 - (head_t2 - t1);
+	    }
+	    {
+	      /* Compute double-double = double-double + double-double. */
+	      double	      bv;
+	      double	      s1, s2, t1, t2;
 
-		s2 += t1;
+	      /* Add two hi words. */
+	      s1 = head_t1 + head_t2;
+	      bv = s1 - head_t1;
+	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+	      /* Add two lo words. */
+	      t1 = tail_t1 + tail_t2;
+	      bv = t1 - tail_t1;
+	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-		t2 += s2;
+	      s2 += t1;
 
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_sum2[1] = head_t;
-	      tail_sum2[1] = tail_t;
+	      /* Renormalize (s1, s2)  to  (t1, s2) */
+	      t1 = s1 + s2;
+	      s2 = s2 - (t1 - s1);
+
+	      t2 += s2;
+
+	      /* Renormalize (t1, t2)  */
+	      head_t1 = t1 + t2;
+	      tail_t1 = t2 - (head_t1 - t1);
 	    }
+	    head_tmp1[1] = head_t1;
+	    tail_tmp1[1] = tail_t1;
 	  }
 
-	  diag_elem = a_i[aij];
-	  x_elem[0] = x_head_i[xi];
-	  x_elem[1] = x_head_i[xi + 1];
+	  y_elem[0] = y_i[yi];
+	  y_elem[1] = y_i[yi + 1];
 	  {
-	    /* Compute complex-extra = complex-double * real. */
-	    double	    head_t, tail_t;
+	    /* Compute complex-extra = complex-double * complex-double. */
+	    double	    head_t1, tail_t1;
+	    double	    head_t2, tail_t2;
+	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[0] * split;
-	      b1 = con - x_elem[0];
-	      b1 = con - b1;
-	      b2 = x_elem[0] - b1;
-
-	      head_t = diag_elem * x_elem[0];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t1 = y_elem[0] * beta_i[0];
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	    }
-	    head_prod1[0] = head_t;
-	    tail_prod1[0] = tail_t;
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[1] * split;
-	      b1 = con - x_elem[1];
-	      b1 = con - b1;
-	      b2 = x_elem[1] - b1;
-
-	      head_t = diag_elem * x_elem[1];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t2 = y_elem[1] * beta_i[1];
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	    }
-	    head_prod1[1] = head_t;
-	    tail_prod1[1] = tail_t;
-	  }
-	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    double	    head_b, tail_b;
-	    /* Real part */
-	    head_a = head_sum1[0];
-	    tail_a = tail_sum1[0];
-	    head_b = head_prod1[0];
-	    tail_b = tail_prod1[0];
+	    head_t2 = -head_t2;
+	    tail_t2 = -tail_t2;
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
 	      double	      s1, s2, t1, t2;
 
 	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      s1 = head_t1 + head_t2;
+	      bv = s1 - head_t1;
+	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      t1 = tail_t1 + tail_t2;
+	      bv = t1 - tail_t1;
+	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 	      s2 += t1;
 
@@ -2662,30 +1622,36 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      t2 += s2;
 
 	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      head_t1 = t1 + t2;
+	      tail_t1 = t2 - (head_t1 - t1);
 	    }
-	    head_sum1[0] = head_t;
-	    tail_sum1[0] = tail_t;
+	    head_tmp2[0] = head_t1;
+	    tail_tmp2[0] = tail_t1;
 	    /* Imaginary part */
-	    head_a = head_sum1[1];
-	    tail_a = tail_sum1[1];
-	    head_b = head_prod1[1];
-	    tail_b = tail_prod1[1];
+	    {
+	      /* Compute double_double = double * double. */
+	      head_t1 = y_elem[1] * beta_i[0];
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
+	    }
+	    {
+	      /* Compute double_double = double * double. */
+	      head_t2 = y_elem[0] * beta_i[1];
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
+	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
 	      double	      s1, s2, t1, t2;
 
 	      /* Add two hi words. */
-	      s1 = head_a + head_b;
-	      bv = s1 - head_a;
-	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      s1 = head_t1 + head_t2;
+	      bv = s1 - head_t1;
+	      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 	      /* Add two lo words. */
-	      t1 = tail_a + tail_b;
-	      bv = t1 - tail_a;
-	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      t1 = tail_t1 + tail_t2;
+	      bv = t1 - tail_t1;
+	      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 	      s2 += t1;
 
@@ -2696,63 +1662,21 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      t2 += s2;
 
 	      /* Renormalize (t1, t2)  */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_sum1[1] = head_t;
-	    tail_sum1[1] = tail_t;
-	  }
-	  x_elem[0] = x_tail_i[xi];
-	  x_elem[1] = x_tail_i[xi + 1];
-	  {
-	    /* Compute complex-extra = complex-double * real. */
-	    double	    head_t, tail_t;
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[0] * split;
-	      b1 = con - x_elem[0];
-	      b1 = con - b1;
-	      b2 = x_elem[0] - b1;
-
-	      head_t = diag_elem * x_elem[0];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-	    }
-	    head_prod2[0] = head_t;
-	    tail_prod2[0] = tail_t;
-	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = diag_elem * split;
-	      a1 = con - diag_elem;
-	      a1 = con - a1;
-	      a2 = diag_elem - a1;
-	      con = x_elem[1] * split;
-	      b1 = con - x_elem[1];
-	      b1 = con - b1;
-	      b2 = x_elem[1] - b1;
-
-	      head_t = diag_elem * x_elem[1];
-	      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t1 = t1 + t2;
+	      tail_t1 = t2 - (head_t1 - t1);
 	    }
-	    head_prod2[1] = head_t;
-	    tail_prod2[1] = tail_t;
+	    head_tmp2[1] = head_t1;
+	    tail_tmp2[1] = tail_t1;
 	  }
 	  {
 	    double	    head_t, tail_t;
 	    double	    head_a, tail_a;
 	    double	    head_b, tail_b;
 	    /* Real part */
-	    head_a = head_sum2[0];
-	    tail_a = tail_sum2[0];
-	    head_b = head_prod2[0];
-	    tail_b = tail_prod2[0];
+	    head_a = head_tmp1[0];
+	    tail_a = tail_tmp1[0];
+	    head_b = head_tmp2[0];
+	    tail_b = tail_tmp2[0];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -2780,13 +1704,13 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_t = t1 + t2;
 	      tail_t = t2 - (head_t - t1);
 	    }
-	    head_sum2[0] = head_t;
-	    tail_sum2[0] = tail_t;
+	    head_tmp3[0] = head_t;
+	    tail_tmp3[0] = tail_t;
 	    /* Imaginary part */
-	    head_a = head_sum2[1];
-	    tail_a = tail_sum2[1];
-	    head_b = head_prod2[1];
-	    tail_b = tail_prod2[1];
+	    head_a = head_tmp1[1];
+	    tail_a = tail_tmp1[1];
+	    head_b = head_tmp2[1];
+	    tail_b = tail_tmp2[1];
 	    {
 	      /* Compute double-double = double-double + double-double. */
 	      double	      bv;
@@ -2814,153 +1738,311 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_t = t1 + t2;
 	      tail_t = t2 - (head_t - t1);
 	    }
-	    head_sum2[1] = head_t;
-	    tail_sum2[1] = tail_t;
+	    head_tmp3[1] = head_t;
+	    tail_tmp3[1] = tail_t;
 	  }
-	  j++;
-	  aij += incaij2;
-	  xi += incx;
-
-	  for (; j < n; j++, aij += incaij2, xi += incx) {
-	    a_elem[0] = a_i[aij];
-	    a_elem[1] = a_i[aij + 1];
+	  y_i[yi] = head_tmp3[0];
+	  y_i[yi + 1] = head_tmp3[1];
+	}
+      } else {
+	/* uplo == blas_upper */
+	for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
+	  if (row_sum1 != NULL && row_sum2 != NULL) {
+	    head_sum1[0] = row_sum1[4 * i];
+	    head_sum1[1] = row_sum1[4 * i + 1];
+	    tail_sum1[0] = row_sum1[4 * i + 2];
+	    tail_sum1[1] = row_sum1[4 * i + 3];
+	    head_sum2[0] = row_sum2[4 * i];
+	    head_sum2[1] = row_sum2[4 * i + 1];
+	    tail_sum2[0] = row_sum2[4 * i + 2];
+	    tail_sum2[1] = row_sum2[4 * i + 3];
+	  } else {
+	    head_sum1[0] = head_sum1[1] = tail_sum1[0] = tail_sum1[1] = 0.0;
+	    head_sum2[0] = head_sum2[1] = tail_sum2[0] = tail_sum2[1] = 0.0;
+
+	    for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      a_elem[1] = -a_elem[1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[0] = head_t1;
+		tail_prod1[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[1] = head_t1;
+		tail_prod1[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
+	      }
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[0] = head_t1;
+		tail_prod2[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[1] = head_t1;
+		tail_prod2[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
+	    }
+
+	    diag_elem = a_i[aij];
 	    x_elem[0] = x_head_i[xi];
 	    x_elem[1] = x_head_i[xi + 1];
 	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod1[0] = head_t1;
-	      tail_prod1[0] = tail_t1;
-	      /* Imaginary part */
+	      /* Compute complex-extra = complex-double * real. */
+	      double	    head_t, tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		head_t = diag_elem * x_elem[0];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[0], head_t);
 	      }
+	      head_prod1[0] = head_t;
+	      tail_prod1[0] = tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
+		head_t = diag_elem * x_elem[1];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[1], head_t);
 	      }
-	      head_prod1[1] = head_t1;
-	      tail_prod1[1] = tail_t1;
+	      head_prod1[1] = head_t;
+	      tail_prod1[1] = tail_t;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum1[0];
 	      tail_a = tail_sum1[0];
@@ -2968,8 +2050,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -3002,8 +2084,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod1[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -3033,140 +2115,27 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    x_elem[0] = x_tail_i[xi];
 	    x_elem[1] = x_tail_i[xi + 1];
 	    {
-	      /* Compute complex-extra = complex-double * complex-double. */
-	      double	      head_t1, tail_t1;
-	      double	      head_t2, tail_t2;
-	      /* Real part */
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[0] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[1] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      head_t2 = -head_t2;
-	      tail_t2 = -tail_t2;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
-	      }
-	      head_prod2[0] = head_t1;
-	      tail_prod2[0] = tail_t1;
-	      /* Imaginary part */
+	      /* Compute complex-extra = complex-double * real. */
+	      double	    head_t, tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[1] * split;
-		a1 = con - a_elem[1];
-		a1 = con - a1;
-		a2 = a_elem[1] - a1;
-		con = x_elem[0] * split;
-		b1 = con - x_elem[0];
-		b1 = con - b1;
-		b2 = x_elem[0] - b1;
-
-		head_t1 = a_elem[1] * x_elem[0];
-		tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		head_t = diag_elem * x_elem[0];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[0], head_t);
 	      }
+	      head_prod2[0] = head_t;
+	      tail_prod2[0] = tail_t;
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem[0] * split;
-		a1 = con - a_elem[0];
-		a1 = con - a1;
-		a2 = a_elem[0] - a1;
-		con = x_elem[1] * split;
-		b1 = con - x_elem[1];
-		b1 = con - b1;
-		b2 = x_elem[1] - b1;
-
-		head_t2 = a_elem[0] * x_elem[1];
-		tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	      }
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_t1 + head_t2;
-		bv = s1 - head_t1;
-		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_t1 + tail_t2;
-		bv = t1 - tail_t1;
-		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t1 = t1 + t2;
-		tail_t1 = t2 - (head_t1 - t1);
+		head_t = diag_elem * x_elem[1];
+		tail_t = BLAS_TWO_PROD_ERR(diag_elem, x_elem[1], head_t);
 	      }
-	      head_prod2[1] = head_t1;
-	      tail_prod2[1] = tail_t1;
+	      head_prod2[1] = head_t;
+	      tail_prod2[1] = tail_t;
 	    }
 	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      double	    head_b, tail_b;
 	      /* Real part */
 	      head_a = head_sum2[0];
 	      tail_a = tail_sum2[0];
@@ -3174,8 +2143,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -3208,8 +2177,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      tail_b = tail_prod2[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      bv;
+		double	      s1, s2, t1, t2;
 
 		/* Add two hi words. */
 		s1 = head_a + head_b;
@@ -3236,6 +2205,266 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	      head_sum2[1] = head_t;
 	      tail_sum2[1] = tail_t;
 	    }
+	    j++;
+	    aij += incaij2;
+	    xi += incx;
+
+	    for (; j < n; j++, aij += incaij2, xi += incx) {
+	      a_elem[0] = a_i[aij];
+	      a_elem[1] = a_i[aij + 1];
+	      x_elem[0] = x_head_i[xi];
+	      x_elem[1] = x_head_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[0] = head_t1;
+		tail_prod1[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod1[1] = head_t1;
+		tail_prod1[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum1[0];
+		tail_a = tail_sum1[0];
+		head_b = head_prod1[0];
+		tail_b = tail_prod1[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[0] = head_t;
+		tail_sum1[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum1[1];
+		tail_a = tail_sum1[1];
+		head_b = head_prod1[1];
+		tail_b = tail_prod1[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum1[1] = head_t;
+		tail_sum1[1] = tail_t;
+	      }
+	      x_elem[0] = x_tail_i[xi];
+	      x_elem[1] = x_tail_i[xi + 1];
+	      {
+		/* Compute complex-extra = complex-double * complex-double. */
+		double	      head_t1, tail_t1;
+		double	      head_t2, tail_t2;
+		/* Real part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[0] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[1] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[1], head_t2);
+		}
+		head_t2 = -head_t2;
+		tail_t2 = -tail_t2;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[0] = head_t1;
+		tail_prod2[0] = tail_t1;
+		/* Imaginary part */
+		{
+		  /* Compute double_double = double * double. */
+		  head_t1 = a_elem[1] * x_elem[0];
+		  tail_t1 = BLAS_TWO_PROD_ERR(a_elem[1], x_elem[0], head_t1);
+		}
+		{
+		  /* Compute double_double = double * double. */
+		  head_t2 = a_elem[0] * x_elem[1];
+		  tail_t2 = BLAS_TWO_PROD_ERR(a_elem[0], x_elem[1], head_t2);
+		}
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_t1 + head_t2;
+		  bv = s1 - head_t1;
+		  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_t1 + tail_t2;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t1 = s1 + s2;
+		  tail_t1 = s2 - (head_t1 - s1);
+		}
+		head_prod2[1] = head_t1;
+		tail_prod2[1] = tail_t1;
+	      }
+	      {
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum2[0];
+		tail_a = tail_sum2[0];
+		head_b = head_prod2[0];
+		tail_b = tail_prod2[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[0] = head_t;
+		tail_sum2[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum2[1];
+		tail_a = tail_sum2[1];
+		head_b = head_prod2[1];
+		tail_b = tail_prod2[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum2[1] = head_t;
+		tail_sum2[1] = tail_t;
+	      }
+	    }
 	  }
 	  {
 	    double	    head_t, tail_t;
@@ -3323,19 +2552,10 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* real part */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = alpha_i[0] * split;
-	      b1 = con - alpha_i[0];
-	      b1 = con - b1;
-	      b2 = alpha_i[0] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a0 * alpha_i[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 	      c2 = tail_a0 * alpha_i[0];
 	      t1 = c11 + c2;
@@ -3346,19 +2566,10 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = alpha_i[1] * split;
-	      b1 = con - alpha_i[1];
-	      b1 = con - b1;
-	      b2 = alpha_i[1] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a1 * alpha_i[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 	      c2 = tail_a1 * alpha_i[1];
 	      t1 = c11 + c2;
@@ -3401,19 +2612,10 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* imaginary part */
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a1 * split;
-	      a11 = con - head_a1;
-	      a11 = con - a11;
-	      a21 = head_a1 - a11;
-	      con = alpha_i[0] * split;
-	      b1 = con - alpha_i[0];
-	      b1 = con - b1;
-	      b2 = alpha_i[0] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a1 * alpha_i[0];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 	      c2 = tail_a1 * alpha_i[0];
 	      t1 = c11 + c2;
@@ -3424,19 +2626,10 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_a0 * split;
-	      a11 = con - head_a0;
-	      a11 = con - a11;
-	      a21 = head_a0 - a11;
-	      con = alpha_i[1] * split;
-	      b1 = con - alpha_i[1];
-	      b1 = con - b1;
-	      b2 = alpha_i[1] - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_a0 * alpha_i[1];
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 	      c2 = tail_a0 * alpha_i[1];
 	      t1 = c11 + c2;
@@ -3485,35 +2678,13 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
 	      head_t1 = y_elem[0] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
 	      head_t2 = y_elem[1] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[1], head_t2);
 	    }
 	    head_t2 = -head_t2;
 	    tail_t2 = -tail_t2;
@@ -3549,35 +2720,13 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	    /* Imaginary part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[1] * split;
-	      a1 = con - y_elem[1];
-	      a1 = con - a1;
-	      a2 = y_elem[1] - a1;
-	      con = beta_i[0] * split;
-	      b1 = con - beta_i[0];
-	      b1 = con - b1;
-	      b2 = beta_i[0] - b1;
-
 	      head_t1 = y_elem[1] * beta_i[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t1 = BLAS_TWO_PROD_ERR(y_elem[1], beta_i[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem[0] * split;
-	      a1 = con - y_elem[0];
-	      a1 = con - a1;
-	      a2 = y_elem[0] - a1;
-	      con = beta_i[1] * split;
-	      b1 = con - beta_i[1];
-	      b1 = con - b1;
-	      b2 = beta_i[1] - b1;
-
 	      head_t2 = y_elem[0] * beta_i[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_t2 = BLAS_TWO_PROD_ERR(y_elem[0], beta_i[1], head_t2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
@@ -3687,6 +2836,8 @@ void		BLAS_zhemv2_x(enum blas_order_type order, enum blas_uplo_type uplo, int n,
 	}
       }
 
+      blas_free(row_sum1);
+      blas_free(row_sum2);
       FPU_FIX_STOP;
 
       break;
@@ -0,0 +1,103 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
+#include "blas_syrk_engine.h"
+
+void BLAS_zherk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, double alpha,
+		  const void *a, int lda, double beta, void *c, int ldc,
+		  enum blas_prec_type prec)
+/*
+ * Purpose
+ * =======
+ *
+ * This routine computes the rank-k update
+ *
+ *     C <- alpha * A * A^H + beta * C     (trans = blas_no_trans)
+ *     C <- alpha * A^H * A + beta * C     (trans = blas_conj_trans)
+ *
+ * of the Hermitian n by n matrix C, of which only the uplo triangle is
+ * read and written; A is n by k (trans = blas_no_trans) or k by n.  The
+ * imaginary parts of the diagonal of C are taken as zero and set to
+ * zero.  The triangle is formed in blocks of columns on the GEMM engine;
+ * see blas_syrk_engine.h.
+ *
+ * Arguments
+ * =========
+ *
+ * order  (input) enum blas_order_type
+ *        column major, row major
+ *
+ * uplo   (input) enum blas_uplo_type
+ *        upper, lower: the triangle of C
+ *
+ * trans  (input) enum blas_trans_type
+ *        no trans, conj trans
+ *
+ * n      (input) int
+ *        the order of C
+ *
+ * k      (input) int
+ *        the other dimension of A
+ *
+ * alpha  (input) double
+ *
+ * a      (input) const void*
+ *        Matrix A
+ *
+ * lda    (input) int
+ *        leading dimension of A
+ *
+ * beta   (input) double
+ *
+ * c      (input/output) void*
+ *        Matrix C
+ *
+ * ldc    (input) int
+ *        leading dimension of C
+ *
+ * prec   (input) enum blas_prec_type
+ *        Specifies the internal precision to be used.
+ *        = blas_prec_single: single precision.
+ *        = blas_prec_double: double precision.
+ *        = blas_prec_extra : anything at least 1.5 times as accurate
+ *                            than double, and wider than 80-bits.
+ *                            We use double-double in our implementation.
+ *
+ */
+{
+  static const char routine_name[] = "BLAS_zherk_x";
+  double alpha_c[2], beta_c[2];
+  int ld_min = ((order == blas_colmajor) == (trans == blas_no_trans))
+    ? n : k;
+
+  /* Test for error conditions */
+  if (order != blas_colmajor && order != blas_rowmajor)
+    BLAS_error(routine_name, -1, order, NULL);
+  if (uplo != blas_upper && uplo != blas_lower)
+    BLAS_error(routine_name, -2, uplo, NULL);
+  if (trans != blas_no_trans && trans != blas_conj_trans)
+    BLAS_error(routine_name, -3, trans, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -4, n, NULL);
+  if (k < 0)
+    BLAS_error(routine_name, -5, k, NULL);
+  if (lda < MAX(1, ld_min))
+    BLAS_error(routine_name, -8, lda, NULL);
+  if (ldc < MAX(1, n))
+    BLAS_error(routine_name, -11, ldc, NULL);
+
+  /* Test for no-op */
+  if (n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
+    return;
+
+  alpha_c[0] = alpha;
+  alpha_c[1] = 0.0;
+  beta_c[0] = beta;
+  beta_c[1] = 0.0;
+
+  if (!blas_syrk_engine(order, uplo, trans, n, k, alpha_c, a, blas_gemm_elt_z,
+			lda, NULL, blas_gemm_elt_z, lda, beta_c, c,
+			blas_gemm_elt_z, ldc, blas_gemm_hermitian, prec))
+    BLAS_error("blas_malloc", 0, 0, "malloc failed.\n");
+}
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -1138,7 +1139,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -1151,6 +1153,7 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = x;
 	float          *y_i = (float *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval   [2];
 	float		vecval;
@@ -1193,6 +1196,13 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_s, incx);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1221,47 +1231,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1274,47 +1289,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1333,47 +1353,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1394,47 +1419,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1463,47 +1493,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1518,47 +1553,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1579,47 +1619,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1642,47 +1687,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1715,47 +1765,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1768,47 +1823,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1827,47 +1887,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1888,47 +1953,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1957,47 +2027,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -2012,47 +2087,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -2073,47 +2153,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -2136,47 +2221,52 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = (double)vecval *matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval;
-			  rowtmp[1] = (double)matval[1] * vecval;
-			}
+			rowtmp[0] = (double)vecval *matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval;
+			    rowtmp[1] = (double)matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -2202,6 +2292,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -2219,6 +2311,7 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = x;
 	float          *y_i = (float *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval   [2];
 	float		vecval;
@@ -2263,6 +2356,13 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_s, incx);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -2328,23 +2428,96 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2355,8 +2528,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2392,8 +2565,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2420,114 +2593,181 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2538,8 +2778,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2575,8 +2815,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2605,6 +2845,75 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
@@ -2615,27 +2924,106 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2646,8 +3034,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2683,8 +3071,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2711,27 +3099,134 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2762,13 +3257,13 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2799,26 +3294,108 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2829,8 +3406,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2866,8 +3443,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2896,139 +3473,132 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
 		      head_tmp1[1] = head_rowsum[1];
 		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    s2 += t1;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    t2 += s2;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
 			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3059,13 +3629,13 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3096,26 +3666,116 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3126,8 +3786,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3163,8 +3823,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3193,135 +3853,234 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
+			  /*
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
+			   */
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
 
-			  s2 += t1;
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			  t2 += s2;
+			    s2 += t1;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    t2 += s2;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  s2 += t1;
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  t2 += s2;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
+
 		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += incap;
 		    }
@@ -3329,23 +4088,96 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3356,8 +4188,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3393,8 +4225,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3421,3023 +4253,132 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute double-double = double-double *
+			     * double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
+			    double	    c11 , c21, c2, t1, t2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			    t2 += s2;
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute double-double = double-double *
+			     * double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    double	    c11 , c21, c2, t1, t2;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			    t2 += s2;
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -6447,14 +4388,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -6465,16 +4406,46 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -6484,14 +4455,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -6502,23 +4473,18 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      y_i[y_index] = head_tmp1[0];
 		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
@@ -6530,23 +4496,96 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -6557,8 +4596,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -6594,8 +4633,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -6624,117 +4663,132 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      {
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			  s2 += t1;
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  t2 += s2;
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -6744,34 +4798,64 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    s2 += t1;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
-			    t2 += s2;
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -6781,14 +4865,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -6799,21 +4883,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			double		head_e1, tail_e1;
 			double		d1;
@@ -6937,29 +5014,102 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -6970,8 +5120,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7007,8 +5157,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7037,117 +5187,132 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  s2 += t1;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			  t2 += s2;
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7157,14 +5322,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7175,16 +5340,46 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7194,14 +5389,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7212,21 +5407,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			double		head_e1, tail_e1;
 			double		d1;
@@ -7350,12 +5538,14 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
 	      }
-	    } else {
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
 	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 		{
 		  y_index = y_start;
@@ -7364,23 +5554,96 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7391,8 +5654,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7428,8 +5691,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7456,114 +5719,181 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7574,8 +5904,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7611,8 +5941,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7641,98 +5971,244 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
-			     * Compute double-double = double-double *
-			     * double.
+			     * Compute double-double = double-double +
+			     * double-double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    s2 += t1;
 
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			    t2 += s2;
 
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7743,103 +6219,212 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
 			  }
 			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  s2 += t1;
 
-			    t2 += s2;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
 			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
@@ -7847,23 +6432,96 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7874,8 +6532,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7911,8 +6569,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7926,40 +6584,147 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 			    s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    t2 += s2;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
 			}
-			ap_index += incap;
-			x_index += incx;
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -7990,13 +6755,13 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -8027,26 +6792,116 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8057,8 +6912,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8094,8 +6949,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8124,6 +6979,75 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			double		cd      [2];
@@ -8148,20 +7072,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			    c2 = tail_a0 * cd[0];
 			    t1 = c11 + c2;
@@ -8175,20 +7089,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			    c2 = tail_a1 * cd[1];
 			    t1 = c11 + c2;
@@ -8237,20 +7141,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			    c2 = tail_a1 * cd[0];
 			    t1 = c11 + c2;
@@ -8264,20 +7158,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			    c2 = tail_a0 * cd[1];
 			    t1 = c11 + c2;
@@ -8326,33 +7210,100 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8363,8 +7314,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8400,8 +7351,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8428,114 +7379,339 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  s2 += t1;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			  t2 += s2;
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			  s2 += t1;
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    s2 += t1;
 
-			  t2 += s2;
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8546,8 +7722,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8583,8 +7759,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8613,6 +7789,75 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -8639,20 +7884,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			    c2 = tail_a0 * cd[0];
 			    t1 = c11 + c2;
@@ -8666,20 +7901,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			    c2 = tail_a1 * cd[1];
 			    t1 = c11 + c2;
@@ -8728,20 +7953,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			    c2 = tail_a1 * cd[0];
 			    t1 = c11 + c2;
@@ -8755,20 +7970,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			    c2 = tail_a0 * cd[1];
 			    t1 = c11 + c2;
@@ -8941,206 +8146,96 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
 
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
 			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp[0] = (double)vecval *matval[0];
-		      head_rowtmp[1] = 0.0;
-		      tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  head_rowtmp[0] = (double)matval[0] * vecval;
-			  tail_rowtmp[0] = 0.0;
-			  head_rowtmp[1] = (double)matval[1] * vecval;
-			  tail_rowtmp[1] = 0.0;
-			}
+			head_rowtmp[0] = (double)vecval *matval[0];
+			head_rowtmp[1] = 0.0;
+			tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9151,8 +8246,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9188,8 +8283,8 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9218,6 +8313,75 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    head_rowtmp[0] = (double)matval[0] * vecval;
+			    tail_rowtmp[0] = 0.0;
+			    head_rowtmp[1] = (double)matval[1] * vecval;
+			    tail_rowtmp[1] = 0.0;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -9244,20 +8408,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			    c2 = tail_a0 * cd[0];
 			    t1 = c11 + c2;
@@ -9271,20 +8425,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			    c2 = tail_a1 * cd[1];
 			    t1 = c11 + c2;
@@ -9333,20 +8477,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			    c2 = tail_a1 * cd[0];
 			    t1 = c11 + c2;
@@ -9360,20 +8494,10 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			    c2 = tail_a0 * cd[1];
 			    t1 = c11 + c2;
@@ -9548,6 +8672,7 @@ void		BLAS_chpmv_c_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
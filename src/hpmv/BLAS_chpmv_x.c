@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -1250,7 +1251,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -1263,6 +1265,7 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	float          *y_i = (float *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -1305,6 +1308,13 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1333,52 +1343,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1391,52 +1406,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1455,52 +1475,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1521,52 +1546,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1595,52 +1625,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1655,52 +1690,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1721,52 +1761,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1789,58 +1834,63 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
-			tmp1[1] = (double)rowsum[0] * alpha_i[1] + (double)rowsum[1] * alpha_i[0];
+			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
+			tmp1[1] = (double)rowsum[0] * alpha_i[1] + (double)rowsum[1] * alpha_i[0];
 		      }
 		      {
 			tmp2[0] = (double)beta_i[0] * resval[0] - (double)beta_i[1] * resval[1];
@@ -1867,52 +1917,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1925,52 +1980,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -1989,52 +2049,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -2055,52 +2120,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -2129,52 +2199,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -2189,52 +2264,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -2255,58 +2335,63 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
-			tmp1[1] = (double)rowsum[0] * alpha_i[1] + (double)rowsum[1] * alpha_i[0];
+			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
+			tmp1[1] = (double)rowsum[0] * alpha_i[1] + (double)rowsum[1] * alpha_i[0];
 		      }
 		      {
 			tmp2[0] = (double)beta_i[0] * resval[0] - (double)beta_i[1] * resval[1];
@@ -2323,52 +2408,57 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -2394,6 +2484,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -2411,6 +2503,7 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	float          *y_i = (float *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -2455,6 +2548,13 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -2520,59 +2620,136 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2583,8 +2760,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2620,8 +2797,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2648,154 +2825,257 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2806,8 +3086,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2843,8 +3123,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2873,6 +3153,111 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
@@ -2883,63 +3268,146 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2950,8 +3418,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2987,8 +3455,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3015,31 +3483,170 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3070,13 +3677,13 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3107,62 +3714,148 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3173,8 +3866,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3210,8 +3903,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3240,179 +3933,168 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
 		      head_tmp1[1] = head_rowsum[1];
 		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
 			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    t2 += s2;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
 			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3443,13 +4125,13 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3480,62 +4162,156 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3546,8 +4322,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3583,8 +4359,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3613,3416 +4389,166 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
-
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
-
-		      }
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)beta_i[0] * resval[0];
-			d2 = (double)-beta_i[1] * resval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[0] = head_e1;
-			tail_tmp2[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)beta_i[0] * resval[1];
-			d2 = (double)beta_i[1] * resval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_tmp2[1] = head_e1;
-			tail_tmp2[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			  /*
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
+			   */
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute double-double = double-double *
+			     * double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
+			    double	    c11 , c21, c2, t1, t2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			    t2 += s2;
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute double-double = double-double *
+			     * double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    double	    c11 , c21, c2, t1, t2;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7032,14 +4558,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7050,16 +4576,46 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7069,14 +4625,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7087,81 +4643,153 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      y_i[y_index] = head_tmp1[0];
 		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7172,8 +4800,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7209,8 +4837,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7239,194 +4867,233 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  s2 += t1;
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  t2 += s2;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
 
-			  s2 += t1;
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			  t2 += s2;
+			    s2 += t1;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    t2 += s2;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
 			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute double-double = double-double *
+			     * double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	    c11 , c21, c2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    s2 += t1;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
-			    t2 += s2;
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7436,14 +5103,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7454,23 +5121,18 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      y_i[y_index] = head_tmp1[0];
 		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
@@ -7482,59 +5144,136 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7545,8 +5284,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7582,8 +5321,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7612,157 +5351,168 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
 			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
 			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7772,34 +5522,64 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
-			    t2 += s2;
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -7809,14 +5589,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -7827,21 +5607,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			double		head_e1, tail_e1;
 			double		d1;
@@ -7965,65 +5738,142 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8034,8 +5884,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8071,8 +5921,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8101,157 +5951,168 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
 			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
 			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -8261,14 +6122,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -8279,16 +6140,46 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
 			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
@@ -8298,14 +6189,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    double	    s1  , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -8316,21 +6207,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			double		head_e1, tail_e1;
 			double		d1;
@@ -8454,12 +6338,14 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
 	      }
-	    } else {
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
 	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 		{
 		  y_index = y_start;
@@ -8468,59 +6354,136 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8531,8 +6494,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8568,8 +6531,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8596,154 +6559,257 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8754,8 +6820,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8791,8 +6857,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8821,98 +6887,320 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      {
-			double		cd      [2];
-			cd[0] = (double)alpha_i[0];
-			cd[1] = (double)alpha_i[1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-extra *
-			   * complex-double.
-			   */
-			  double	  head_a0, tail_a0;
-			  double	  head_a1, tail_a1;
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  head_a0 = head_rowsum[0];
-			  tail_a0 = tail_rowsum[0];
-			  head_a1 = head_rowsum[1];
-			  tail_a1 = tail_rowsum[1];
-			  /* real part */
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
-			     * Compute double-double = double-double *
-			     * double.
+			     * Compute double-double = double-double +
+			     * double-double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
-			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    c2 = tail_a0 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    s2 += t1;
 
-			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			    c2 = tail_a1 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			    t2 += s2;
 
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -8923,103 +7211,248 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_tmp1[0] = head_t1;
-			  tail_tmp1[0] = tail_t1;
-			  /* imaginary part */
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    c2 = tail_a1 * cd[0];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
 
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double *
-			     * double.
-			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    c2 = tail_a0 * cd[1];
-			    t1 = c11 + c2;
-			    t2 = (c2 - (t1 - c11)) + c21;
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    head_t2 = t1 + t2;
-			    tail_t2 = t2 - (head_t2 - t1);
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  s2 += t1;
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    s2 += t1;
+			  t2 += s2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    t2 += s2;
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_tmp1[1] = head_t1;
-			  tail_tmp1[1] = tail_t1;
-			}
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
 
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
@@ -9027,59 +7460,136 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9090,8 +7600,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9127,8 +7637,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9155,31 +7665,170 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			double		head_e1, tail_e1;
+			double		d1;
+			double		d2;
+			/* Real part */
+			d1 = (double)beta_i[0] * resval[0];
+			d2 = (double)-beta_i[1] * resval[1];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[0] = head_e1;
+			tail_tmp2[0] = tail_e1;
+			/* imaginary part */
+			d1 = (double)beta_i[0] * resval[1];
+			d2 = (double)beta_i[1] * resval[0];
+			{
+			  /* Compute double-double = double + double. */
+			  double	  e     , t1, t2;
+
+			  /* Knuth trick. */
+			  t1 = d1 + d2;
+			  e = t1 - d1;
+			  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			  /* The result is t1 + t2, after normalization. */
+			  head_e1 = t1 + t2;
+			  tail_e1 = t2 - (head_e1 - t1);
+			}
+			head_tmp2[1] = head_e1;
+			tail_tmp2[1] = tail_e1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9210,13 +7859,13 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9247,62 +7896,156 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9313,8 +8056,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9350,8 +8093,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9380,6 +8123,111 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			double		cd      [2];
@@ -9404,20 +8252,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			    c2 = tail_a0 * cd[0];
 			    t1 = c11 + c2;
@@ -9431,20 +8269,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			    c2 = tail_a1 * cd[1];
 			    t1 = c11 + c2;
@@ -9493,20 +8321,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			    c2 = tail_a1 * cd[0];
 			    t1 = c11 + c2;
@@ -9520,20 +8338,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			    c2 = tail_a0 * cd[1];
 			    t1 = c11 + c2;
@@ -9582,69 +8390,140 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9655,8 +8534,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9692,8 +8571,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9720,154 +8599,415 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			double		cd      [2];
+			cd[0] = (double)alpha_i[0];
+			cd[1] = (double)alpha_i[1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-extra *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  double	  head_a0, tail_a0;
+			  double	  head_a1, tail_a1;
+			  double	  head_t1, tail_t1;
+			  double	  head_t2, tail_t2;
+			  head_a0 = head_rowsum[0];
+			  tail_a0 = tail_rowsum[0];
+			  head_a1 = head_rowsum[1];
+			  tail_a1 = tail_rowsum[1];
+			  /* real part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    c11 = head_a0 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    c2 = tail_a0 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  s2 += t1;
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    c11 = head_a1 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
-			  t2 += s2;
+			    c2 = tail_a1 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[0] = head_t1;
+			  tail_tmp1[0] = tail_t1;
+			  /* imaginary part */
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a1 * cd[0];
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
+
+			    c2 = tail_a1 * cd[0];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double *
+			     * double.
+			     */
+			    double	    c11 , c21, c2, t1, t2;
+
+			    c11 = head_a0 * cd[1];
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
+
+			    c2 = tail_a0 * cd[1];
+			    t1 = c11 + c2;
+			    t2 = (c2 - (t1 - c11)) + c21;
+
+			    head_t2 = t1 + t2;
+			    tail_t2 = t2 - (head_t2 - t1);
+			  }
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	    bv;
+			    double	    s1  , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    /* Add two lo words. */
+			    t1 = tail_t1 + tail_t2;
+			    bv = t1 - tail_t1;
+			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			  s2 += t1;
+			    s2 += t1;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			  t2 += s2;
+			    t2 += s2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t1 = t1 + t2;
+			    tail_t1 = t2 - (head_t1 - t1);
+			  }
+			  head_tmp1[1] = head_t1;
+			  tail_tmp1[1] = tail_t1;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9878,8 +9018,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9915,8 +9055,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9945,6 +9085,111 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -9971,20 +9216,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			    c2 = tail_a0 * cd[0];
 			    t1 = c11 + c2;
@@ -9998,20 +9233,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			    c2 = tail_a1 * cd[1];
 			    t1 = c11 + c2;
@@ -10060,20 +9285,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			    c2 = tail_a1 * cd[0];
 			    t1 = c11 + c2;
@@ -10087,20 +9302,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			    c2 = tail_a0 * cd[1];
 			    t1 = c11 + c2;
@@ -10273,282 +9478,136 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10559,8 +9618,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10596,8 +9655,8 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10626,6 +9685,111 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -10652,20 +9816,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			    c2 = tail_a0 * cd[0];
 			    t1 = c11 + c2;
@@ -10679,20 +9833,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			    c2 = tail_a1 * cd[1];
 			    t1 = c11 + c2;
@@ -10741,20 +9885,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a1 * split;
-			    a11 = con - head_a1;
-			    a11 = con - a11;
-			    a21 = head_a1 - a11;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a1 * cd[0];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			    c2 = tail_a1 * cd[0];
 			    t1 = c11 + c2;
@@ -10768,20 +9902,10 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double *
 			     * double.
 			     */
-			    double	    a11 , a21, b1, b2, c11, c21, c2,
-			    		    con      , t1, t2;
-
-			    con = head_a0 * split;
-			    a11 = con - head_a0;
-			    a11 = con - a11;
-			    a21 = head_a0 - a11;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
+			    double	    c11 , c21, c2, t1, t2;
 
 			    c11 = head_a0 * cd[1];
-			    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			    c2 = tail_a0 * cd[1];
 			    t1 = c11 + c2;
@@ -10956,6 +10080,7 @@ void		BLAS_chpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -68,6 +70,7 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -110,6 +113,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -138,52 +148,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -196,52 +211,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -260,52 +280,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -326,52 +351,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -400,52 +430,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -460,52 +495,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -526,52 +566,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -594,52 +639,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -672,52 +722,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -730,52 +785,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -794,52 +854,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -860,52 +925,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -934,52 +1004,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -994,52 +1069,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1060,52 +1140,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1128,52 +1213,57 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval[0];
-			rowtmp[1] = (double)vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = (double)vecval[0] * matval[0];
+			  rowtmp[1] = (double)vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1199,6 +1289,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -1216,6 +1308,7 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -1260,6 +1353,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1274,35 +1374,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1338,35 +1416,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1415,59 +1471,136 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1478,8 +1611,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1515,8 +1648,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1543,154 +1676,257 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1701,8 +1937,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1738,8 +1974,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1768,6 +2004,111 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
@@ -1778,63 +2119,146 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1845,8 +2269,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1882,8 +2306,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1910,31 +2334,140 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -1944,14 +2477,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -1962,16 +2495,64 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2002,62 +2583,185 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			  s2 += t1;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
+		      }
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2068,8 +2772,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2105,8 +2809,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2135,19 +2839,303 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
 		      head_tmp1[1] = head_rowsum[1];
 		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
+		      }
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
-	      } else {
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 		{
 		  y_index = y_start;
 		  ap_start = 0;
@@ -2155,59 +3143,136 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2218,8 +3283,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2255,8 +3320,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2283,31 +3348,158 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2317,14 +3509,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -2335,16 +3527,40 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2354,14 +3570,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -2372,65 +3588,152 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2441,8 +3744,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2478,8 +3781,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2508,52 +3811,153 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -2587,40 +3991,36 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -2652,4129 +4052,172 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
 			    t1 = tail_a + tail_b;
@@ -6805,8 +4248,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -6835,275 +4278,155 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -7137,40 +4460,36 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -7202,18 +4521,30 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
+
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
 			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -7223,14 +4554,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -7241,16 +4572,22 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
 			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -7260,14 +4597,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -7278,174 +4615,21 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -7476,13 +4660,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -7513,62 +4697,148 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7579,8 +4849,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7616,8 +4886,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7644,15 +4914,255 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (step + 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
+		      }
+
 		      {
 			/*
 			 * Compute complex-extra = complex-double *
@@ -7663,35 +5173,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -7730,35 +5218,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -7875,12 +5341,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
 	      }
-	    } else {
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
 	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 		{
 		  y_index = y_start;
@@ -7889,59 +5357,136 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7952,8 +5497,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7989,8 +5534,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8017,154 +5562,589 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    t2 += s2;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
 
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8175,8 +6155,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8212,8 +6192,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8242,68 +6222,135 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-extra *
+			 * Compute complex-extra = complex-double *
 			 * complex-double.
 			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
+			/* Real part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -8337,56 +6384,18 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -8418,12 +6427,90 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
+		      }
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
@@ -8431,59 +6518,136 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8494,8 +6658,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8531,8 +6695,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8559,31 +6723,225 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -8614,13 +6972,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -8651,62 +7009,156 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8717,8 +7169,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8754,8 +7206,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8784,6 +7236,111 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			/*
@@ -8801,20 +7358,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -8825,20 +7372,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -8884,20 +7421,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -8908,20 +7435,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -8969,69 +7486,140 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9042,8 +7630,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9079,8 +7667,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9107,31 +7695,158 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9141,34 +7856,58 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  s2 += t1;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  t2 += s2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9178,14 +7917,14 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -9196,65 +7935,158 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9265,8 +8097,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9302,8 +8134,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9332,6 +8164,111 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -9351,20 +8288,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -9375,20 +8302,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -9434,20 +8351,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -9458,20 +8365,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -9524,35 +8421,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -9591,35 +8466,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -9742,282 +8595,136 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  double	  head_e1, tail_e1;
-			  double	  d1;
-			  double	  d2;
-			  /* Real part */
-			  d1 = (double)matval[0] * vecval[0];
-			  d2 = (double)-matval[1] * vecval[1];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[0] = head_e1;
-			  tail_rowtmp[0] = tail_e1;
-			  /* imaginary part */
-			  d1 = (double)matval[0] * vecval[1];
-			  d2 = (double)matval[1] * vecval[0];
-			  {
-			    /* Compute double-double = double + double. */
-			    double	    e   , t1, t2;
-
-			    /* Knuth trick. */
-			    t1 = d1 + d2;
-			    e = t1 - d1;
-			    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			    /* The result is t1 + t2, after normalization. */
-			    head_e1 = t1 + t2;
-			    tail_e1 = t2 - (head_e1 - t1);
-			  }
-			  head_rowtmp[1] = head_e1;
-			  tail_rowtmp[1] = tail_e1;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10028,8 +8735,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10065,8 +8772,8 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10095,6 +8802,111 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  head_e1, tail_e1;
+			    double	  d1;
+			    double	  d2;
+			    /* Real part */
+			    d1 = (double)matval[0] * vecval[0];
+			    d2 = (double)-matval[1] * vecval[1];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[0] = head_e1;
+			    tail_rowtmp[0] = tail_e1;
+			    /* imaginary part */
+			    d1 = (double)matval[0] * vecval[1];
+			    d2 = (double)matval[1] * vecval[0];
+			    {
+			      /* Compute double-double = double + double. */
+			      double	    e   , t1, t2;
+
+			      /* Knuth trick. */
+			      t1 = d1 + d2;
+			      e = t1 - d1;
+			      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			      /* The result is t1 + t2, after normalization. */
+			      head_e1 = t1 + t2;
+			      tail_e1 = t2 - (head_e1 - t1);
+			    }
+			    head_rowtmp[1] = head_e1;
+			    tail_rowtmp[1] = tail_e1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -10114,20 +8926,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -10138,20 +8940,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -10197,20 +8989,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -10221,20 +9003,10 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -10287,35 +9059,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -10354,35 +9104,13 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -10507,6 +9235,7 @@ void		BLAS_zhpmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -68,6 +70,7 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = (double *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval   [2];
 	double		vecval  [2];
@@ -110,6 +113,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_z, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -138,52 +148,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -196,52 +211,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -260,52 +280,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -326,52 +351,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -400,52 +430,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -460,52 +495,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -526,52 +566,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -594,52 +639,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -672,52 +722,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -730,52 +785,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -794,52 +854,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -860,52 +925,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -934,52 +1004,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -994,52 +1069,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1060,52 +1140,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1128,52 +1213,57 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1199,6 +1289,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -1216,6 +1308,7 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = (double *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval   [2];
 	double		vecval  [2];
@@ -1260,6 +1353,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_z, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1274,35 +1374,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1338,35 +1416,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1415,163 +1471,187 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1582,8 +1662,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1619,8 +1699,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1647,295 +1727,344 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
 			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1946,8 +2075,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1983,8 +2112,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2013,6 +2142,147 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
@@ -2023,167 +2293,197 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
 			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2194,8 +2494,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2231,8 +2531,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2259,68 +2559,261 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			double		dt = (double)matval[0];
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			  s2 += t1;
 
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2351,13 +2844,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2388,166 +2881,199 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2558,8 +3084,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2595,8 +3121,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2625,183 +3151,527 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
 			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			      s2 += t1;
+			  s2 += t1;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			      t2 += s2;
+			  t2 += s2;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			  t2 += s2;
 
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
+		      }
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2812,8 +3682,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2849,8 +3719,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2877,85 +3747,211 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  ap_index += incap;
+			  x_index += incx;
 			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -2966,16 +3962,40 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2985,14 +4005,14 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -3003,169 +4023,203 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
 
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3176,8 +4230,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3213,8 +4267,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3243,52 +4297,189 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -3322,40 +4513,36 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -3387,254 +4574,206 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3645,8 +4784,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3682,8 +4821,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3710,68 +4849,196 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  ap_index += incap;
+			  x_index += incx;
 			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3781,14 +5048,14 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -3799,16 +5066,40 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3818,14 +5109,14 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -3836,253 +5127,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
 			 * Compute complex-extra = complex-double *
@@ -4093,35 +5144,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -4160,35 +5189,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -4307,175 +5314,191 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -4486,8 +5509,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -4523,8 +5546,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -4551,403 +5574,172 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  ap_index += incap;
+			  x_index += incx;
 			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -4958,20 +5750,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -5017,20 +5799,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -5041,20 +5813,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -5097,346 +5859,69 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_tmp1[1] = tail_t1;
 		      }
 
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
 			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			  s2 += t1;
 
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  t2 += s2;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -5446,4009 +5931,39 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			  t2 += s2;
 
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9479,13 +5994,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9516,166 +6031,209 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9686,8 +6244,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9723,8 +6281,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9753,234 +6311,154 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
 		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
@@ -9988,163 +6466,187 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10155,8 +6657,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10192,8 +6694,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10220,295 +6722,350 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
 			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10519,8 +7076,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10556,8 +7113,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10586,6 +7143,147 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -10603,35 +7301,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
+			  /* Compute double_double = double * double. */
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -10670,35 +7346,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -10817,175 +7471,191 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10996,8 +7666,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11033,8 +7703,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11061,68 +7731,261 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			double		dt = (double)matval[0];
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			  s2 += t1;
 
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -11153,13 +8016,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -11190,166 +8053,207 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11360,8 +8264,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11397,8 +8301,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11427,6 +8331,147 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			/*
@@ -11444,20 +8489,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -11468,20 +8503,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -11527,20 +8552,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -11551,20 +8566,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -11616,163 +8621,187 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11783,8 +8812,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11820,8 +8849,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11848,372 +8877,149 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      {
 			/*
@@ -12231,20 +9037,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -12255,20 +9051,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -12314,20 +9100,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -12338,20 +9114,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -12409,163 +9175,187 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -12576,8 +9366,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12613,8 +9403,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12641,372 +9431,149 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -13026,20 +9593,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -13050,20 +9607,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -13109,20 +9656,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -13133,20 +9670,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -13198,36 +9725,14 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		head_t2, tail_t2;
 			/* Real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
+			  /* Compute double_double = double * double. */
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -13266,35 +9771,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -13417,163 +9900,187 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		dt = (double)matval[0];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
 			    {
 			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      head_t = dt * vecval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[0], head_t);
 			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Compute double_double = double * double. */
+			      head_t = dt * vecval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(dt, vecval[1], head_t);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
 			  }
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -13584,8 +10091,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -13621,8 +10128,8 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -13649,372 +10156,149 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		dt = (double)matval[0];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t = dt * vecval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = dt * split;
-			    a1 = con - dt;
-			    a1 = con - a1;
-			    a2 = dt - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t = dt * vecval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)matval[0];
-			  cd[1] = (double)matval[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)matval[0];
+			    cd[1] = (double)matval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = vecval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = vecval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[1] * split;
-			      a1 = con - vecval[1];
-			      a1 = con - a1;
-			      a2 = vecval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = vecval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = vecval[0] * split;
-			      a1 = con - vecval[0];
-			      a1 = con - a1;
-			      a2 = vecval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = vecval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -14034,20 +10318,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -14058,20 +10332,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -14117,20 +10381,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -14141,20 +10395,10 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -14207,35 +10451,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -14274,35 +10496,13 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -14427,6 +10627,7 @@ void		BLAS_zhpmv_c_z_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
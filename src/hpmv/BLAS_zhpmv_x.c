@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -68,6 +70,7 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = (double *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		matval  [2];
 	double		vecval  [2];
@@ -110,6 +113,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_z, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -138,52 +148,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -196,52 +211,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -260,52 +280,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -326,52 +351,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -400,52 +430,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -460,52 +495,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -526,52 +566,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -594,52 +639,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -672,52 +722,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -730,52 +785,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -794,52 +854,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -860,52 +925,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -934,52 +1004,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -994,52 +1069,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1060,52 +1140,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1128,52 +1213,57 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1199,6 +1289,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -1216,6 +1308,7 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = (double *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		matval  [2];
 	double		vecval  [2];
@@ -1260,6 +1353,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_z, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1274,35 +1374,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1338,35 +1416,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1415,158 +1471,179 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1577,8 +1654,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1614,8 +1691,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1642,287 +1719,331 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1933,8 +2054,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1970,8 +2091,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2000,6 +2121,142 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
@@ -2010,162 +2267,189 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2176,8 +2460,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2213,8 +2497,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2241,65 +2525,256 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
 
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
 
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2330,13 +2805,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2367,161 +2842,191 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2532,8 +3037,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2569,8 +3074,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2599,312 +3104,254 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
 		      head_tmp1[1] = head_rowsum[1];
 		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
+			   * Compute double-double = double-double +
+			   * double-double.
 			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    s2 += t1;
+			  s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    t2 += s2;
+			  t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    s2 += t1;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    t2 += s2;
+			  s2 += t1;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
+			  t2 += s2;
 
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2935,13 +3382,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2972,76 +3419,221 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -3052,61 +3644,33 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -3117,16 +3681,472 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+		      }
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
+		      }
+
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
+			  }
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3137,8 +4157,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3174,8 +4194,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3204,52 +4224,184 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -3283,40 +4435,36 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -3348,249 +4496,198 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3601,8 +4698,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3638,8 +4735,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3666,65 +4763,191 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3734,14 +4957,14 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -3752,16 +4975,40 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -3771,14 +5018,14 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -3789,248 +5036,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
 			 * Compute complex-extra = complex-double *
@@ -4041,35 +5053,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -4108,35 +5098,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -4254,6933 +5222,184 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11191,8 +5410,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11228,8 +5447,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11256,9 +5475,147 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (step + 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
 			/*
 			 * Compute complex-extra = complex-extra *
@@ -11275,20 +5632,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -11299,20 +5646,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -11358,20 +5695,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -11382,20 +5709,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -11438,167 +5755,373 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_tmp1[1] = tail_t1;
 		      }
 
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
+			   * Compute double-double = double-double +
+			   * double-double.
 			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			  s2 += t1;
 
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  t2 += s2;
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    s2 += t1;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    t2 += s2;
+			  s2 += t1;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
+			  t2 += s2;
 
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  s2 += t1;
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    s2 += t1;
+			  t2 += s2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    t2 += s2;
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
+		      }
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
+			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11609,8 +6132,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11646,8 +6169,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11674,202 +6197,353 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -11880,61 +6554,33 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -11945,16 +6591,343 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
+			  }
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11965,8 +6938,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12002,8 +6975,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12032,71 +7005,212 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-extra *
+			 * Compute complex-extra = complex-double *
 			 * complex-double.
 			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
+			/* Real part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
 
+			  /* Renormalize (t1, t2)  */
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -12127,57 +7241,55 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  s2 += t1;
 
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
+			  t2 += s2;
 
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
 			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -12187,14 +7299,14 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -12205,180 +7317,194 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
 			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -12389,8 +7515,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12426,8 +7552,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12454,65 +7580,256 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
+			  t2 += s2;
 
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -12543,13 +7860,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -12580,161 +7897,199 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -12745,8 +8100,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12782,8 +8137,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12812,9 +8167,143 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
 		      {
 			/*
 			 * Compute complex-extra = complex-extra *
@@ -12831,20 +8320,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -12855,20 +8334,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -12914,20 +8383,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -12938,20 +8397,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -12994,113 +8443,446 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_tmp1[1] = tail_t1;
 		      }
 
-		      {
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
+			 * need to do diagonal element without referencing the
+			 * imaginary part
 			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
+			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
+			  }
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s2 += t1;
 
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			  s2 += t1;
+			    t2 += s2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
-			  t2 += s2;
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -13131,55 +8913,37 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  s2 += t1;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  t2 += s2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -13189,14 +8953,14 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -13207,88 +8971,223 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -13299,61 +9198,33 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			    s2 += t1;
 
@@ -13364,150 +9235,397 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			    t2 += s2;
 
 			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
+		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			    s2 += t1;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			    t2 += s2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    s2 += t1;
+			  s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    t2 += s2;
+			  t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			ap_index += incap;
-			x_index += incx;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+
 		      {
-			/* Compute complex-extra = complex-double * real. */
-			double		head_t , tail_t;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
+			  t2 += s2;
 
-			  head_t = matval[0] * vecval[0];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
-			head_rowtmp[0] = head_t;
-			tail_rowtmp[0] = tail_t;
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t = matval[0] * vecval[1];
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_rowtmp[1] = head_t;
-			tail_rowtmp[1] = tail_t;
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -13538,13 +9656,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -13575,161 +9693,191 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
+			  /* Compute complex-extra = complex-double * real. */
+			  double		head_t , tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[0] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[1] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
-			  /* Imaginary part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = vecval[0] * split;
-			    b1 = con - vecval[0];
-			    b1 = con - b1;
-			    b2 = vecval[0] - b1;
-
-			    head_t1 = matval[1] * vecval[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			    head_t = matval[0] * vecval[0];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t);
 			  }
+			  head_rowtmp[0] = head_t;
+			  tail_rowtmp[0] = tail_t;
 			  {
 			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = vecval[1] * split;
-			    b1 = con - vecval[1];
-			    b1 = con - b1;
-			    b2 = vecval[1] - b1;
-
-			    head_t2 = matval[0] * vecval[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    head_t = matval[0] * vecval[1];
+			    tail_t = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowtmp[1] = head_t;
+			  tail_rowtmp[1] = tail_t;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -13740,8 +9888,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -13777,8 +9925,8 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -13807,6 +9955,142 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * vecval[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * vecval[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -13826,20 +10110,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -13850,20 +10124,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -13909,20 +10173,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -13933,20 +10187,10 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -13999,35 +10243,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -14066,35 +10288,13 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -14219,6 +10419,7 @@ void		BLAS_zhpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -68,6 +70,7 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		matval  [2];
 	float		vecval   [2];
@@ -110,6 +113,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -138,52 +148,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -196,52 +211,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -260,52 +280,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -326,52 +351,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -400,52 +430,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -460,52 +495,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -526,52 +566,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -594,52 +639,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -672,52 +722,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -730,52 +785,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -794,52 +854,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -860,52 +925,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -934,52 +1004,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -994,52 +1069,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1060,52 +1140,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1128,52 +1213,57 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = vecval[0] * matval[0];
-			rowtmp[1] = vecval[1] * matval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval[0] = x_i[x_index];
 			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
 			{
-			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  rowtmp[0] = vecval[0] * matval[0];
+			  rowtmp[1] = vecval[1] * matval[0];
 			}
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1199,6 +1289,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -1216,6 +1308,7 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		matval  [2];
 	float		vecval   [2];
@@ -1260,6 +1353,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1274,35 +1374,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1338,35 +1416,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1415,163 +1471,172 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1582,8 +1647,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1619,8 +1684,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1647,258 +1712,329 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1909,8 +2045,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1946,8 +2082,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1976,177 +2112,333 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2157,8 +2449,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2194,8 +2486,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2222,31 +2514,261 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2277,13 +2799,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2314,166 +2836,184 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2484,8 +3024,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2521,8 +3061,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2551,283 +3091,259 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
 		      head_tmp1[1] = head_rowsum[1];
 		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
 			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    s2 += t1;
+			  s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    t2 += s2;
+			  t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    s2 += t1;
+			  s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    t2 += s2;
+			  t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2858,13 +3374,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2895,166 +3411,192 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3065,8 +3607,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3102,8 +3644,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3132,52 +3674,189 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+		      }
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -3211,40 +3890,36 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -3276,90 +3951,12 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += incap;
 		    }
@@ -3367,163 +3964,172 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3534,8 +4140,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3571,8 +4177,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3599,69 +4205,195 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
+		      }
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
 			  /*
 			   * Compute double-double = double-double +
 			   * double-double.
@@ -3670,14 +4402,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -3688,169 +4420,255 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			      s2 += t1;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			      t2 += s2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
+		      }
+
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -3861,8 +4679,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3898,8 +4716,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3928,52 +4746,191 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -4007,40 +4964,36 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -4072,11 +5025,108 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
+
 		      {
-			double		head_t , tail_t;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
@@ -4159,175 +5209,176 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -4338,8 +5389,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -4375,8 +5426,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -4403,68 +5454,196 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  s2 += t1;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  t2 += s2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -4474,14 +5653,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -4492,360 +5671,18 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -4856,5299 +5693,52 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
-			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  double	  c11   , c21, c2, t1, t2;
 
-			    t2 += s2;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    s2 += t1;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  s2 += t1;
 
-			    t2 += s2;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
+
 		      {
 			/*
 			 * Compute complex-extra = complex-double *
@@ -10159,35 +5749,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -10226,35 +5794,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -10371,12 +5917,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
 	      }
-	    } else {
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
 	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 		{
 		  y_index = y_start;
@@ -10385,163 +5933,172 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10552,8 +6109,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10589,8 +6146,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10617,258 +6174,733 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			  t2 += s2;
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
+
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			  s2 += t1;
+			    s2 += t1;
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			  t2 += s2;
+			    t2 += s2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10879,8 +6911,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10916,8 +6948,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10946,68 +6978,171 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-extra *
+			 * Compute complex-extra = complex-double *
 			 * complex-double.
 			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
+			/* Real part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -11041,57 +7176,98 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
 
+			  /* Renormalize (t1, t2)  */
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
 
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
+			  t2 += s2;
 
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
 			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -11101,14 +7277,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -11119,15 +7295,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
 			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
@@ -11135,163 +7310,172 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11302,8 +7486,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11339,8 +7523,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11367,31 +7551,261 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -11422,13 +7836,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -11459,166 +7873,192 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
-
-			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
-			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
-			    /* Imaginary part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
 			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
 			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -11629,8 +8069,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11666,8 +8106,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -11696,6 +8136,147 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			/*
@@ -11713,20 +8294,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -11737,20 +8308,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -11796,20 +8357,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -11820,20 +8371,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -11881,173 +8422,176 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -12058,8 +8602,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12095,8 +8639,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12123,31 +8667,194 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -12157,14 +8864,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -12175,16 +8882,40 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -12194,14 +8925,14 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -12212,169 +8943,194 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
 
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      t2 += s2;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -12385,8 +9141,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12422,8 +9178,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -12452,6 +9208,147 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+
+			  {
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
+			    {
+			      /*
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
+			       */
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -12471,20 +9368,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -12495,20 +9382,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -12554,20 +9431,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -12578,20 +9445,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -12644,35 +9501,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -12711,35 +9546,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -12862,163 +9675,172 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
 
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      s2 += t1;
-
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval[0];
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval[0];
+			  tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -13029,8 +9851,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -13066,8 +9888,8 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -13094,335 +9916,149 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval[0];
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval[0];
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval[0] = x_i[x_index];
-			vecval[1] = x_i[x_index + 1];
-			matval[1] = -matval[1];
-			{
-			  double	  cd     [2];
-			  cd[0] = (double)vecval[0];
-			  cd[1] = (double)vecval[1];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval[0] = x_i[x_index];
+			  vecval[1] = x_i[x_index + 1];
+			  matval[1] = -matval[1];
 			  {
-			    /*
-			     * Compute complex-extra = complex-double *
-			     * complex-double.
-			     */
-			    double	    head_t1, tail_t1;
-			    double	    head_t2, tail_t2;
-			    /* Real part */
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[0] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[1] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    head_t2 = -head_t2;
-			    tail_t2 = -tail_t2;
+			    double	  cd     [2];
+			    cd[0] = (double)vecval[0];
+			    cd[1] = (double)vecval[1];
 			    {
 			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
+			       * Compute complex-extra = complex-double *
+			       * complex-double.
 			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      double	    head_t1, tail_t1;
+			      double	    head_t2, tail_t2;
+			      /* Real part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[0] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[1] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			      }
+			      head_t2 = -head_t2;
+			      tail_t2 = -tail_t2;
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[0] = head_t1;
+			      tail_rowtmp[0] = tail_t1;
+			      /* Imaginary part */
+			      {
+				/* Compute double_double = double * double. */
+				head_t1 = matval[1] * cd[0];
+				tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			      }
+			      {
+				/* Compute double_double = double * double. */
+				head_t2 = matval[0] * cd[1];
+				tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			      }
+			      {
+				/* Compute double-double = double-double + double-double,
+				   renormalizing once. */
+				double	      bv;
+				double	      s1, s2;
+
+				/* Add two hi words. */
+				s1 = head_t1 + head_t2;
+				bv = s1 - head_t1;
+				s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+				/* Add the lo words to the error. */
+				s2 += tail_t1 + tail_t2;
+
+				/* Renormalize (s1, s2)  */
+				head_t1 = s1 + s2;
+				tail_t1 = s2 - (head_t1 - s1);
+			      }
+			      head_rowtmp[1] = head_t1;
+			      tail_rowtmp[1] = tail_t1;
+			    }
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			      s2 += t1;
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[0] = head_t1;
-			    tail_rowtmp[0] = tail_t1;
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
 			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
 			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[1] * split;
-			      a1 = con - matval[1];
-			      a1 = con - a1;
-			      a2 = matval[1] - a1;
-			      con = cd[0] * split;
-			      b1 = con - cd[0];
-			      b1 = con - b1;
-			      b2 = cd[0] - b1;
-
-			      head_t1 = matval[1] * cd[0];
-			      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /* Compute double_double = double * double. */
-			      double	      a1, a2, b1, b2, con;
-
-			      con = matval[0] * split;
-			      a1 = con - matval[0];
-			      a1 = con - a1;
-			      a2 = matval[0] - a1;
-			      con = cd[1] * split;
-			      b1 = con - cd[1];
-			      b1 = con - b1;
-			      b2 = cd[1] - b1;
-
-			      head_t2 = matval[0] * cd[1];
-			      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			    }
-			    {
-			      /*
-			       * Compute double-double = double-double +
-			       * double-double.
-			       */
-			      double	      bv;
-			      double	      s1, s2, t1, t2;
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
 
 			      /* Add two hi words. */
-			      s1 = head_t1 + head_t2;
-			      bv = s1 - head_t1;
-			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			      /* Add two lo words. */
-			      t1 = tail_t1 + tail_t2;
-			      bv = t1 - tail_t1;
-			      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			      s2 += t1;
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
 
-			      /* Renormalize (s1, s2)  to  (t1, s2) */
-			      t1 = s1 + s2;
-			      s2 = s2 - (t1 - s1);
-
-			      t2 += s2;
-
-			      /* Renormalize (t1, t2)  */
-			      head_t1 = t1 + t2;
-			      tail_t1 = t2 - (head_t1 - t1);
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
 			    }
-			    head_rowtmp[1] = head_t1;
-			    tail_rowtmp[1] = tail_t1;
-			  }
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
 			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -13442,20 +10078,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -13466,20 +10092,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -13525,20 +10141,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -13549,20 +10155,10 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -13615,35 +10211,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -13682,35 +10256,13 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -13835,6 +10387,7 @@ void		BLAS_zhpmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	enum blas_order_type order_i;
 
@@ -68,6 +70,7 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		matval  [2];
 	double		vecval;
@@ -110,6 +113,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_d, incx);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -138,47 +148,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -191,47 +206,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -250,47 +270,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -311,47 +336,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -380,47 +410,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -435,47 +470,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -496,47 +536,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -559,47 +604,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -632,47 +682,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -685,47 +740,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      tmp1[0] = rowsum[0];
 		      tmp1[1] = rowsum[1];
@@ -744,47 +804,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -805,47 +870,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -874,47 +944,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -929,47 +1004,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -990,47 +1070,52 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -1053,49 +1138,54 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      rowsum[0] = rowsum[1] = 0.0;
-		      rowtmp[0] = rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
+		      if (row_sum != NULL) {
+			rowsum[0] = row_sum[2 * matrix_row];
+			rowsum[1] = row_sum[2 * matrix_row + 1];
+		      } else {
+			rowsum[0] = rowsum[1] = 0.0;
+			rowtmp[0] = rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			rowsum[0] = rowsum[0] + rowtmp[0];
-			rowsum[1] = rowsum[1] + rowtmp[1];
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp[0] = vecval * matval[0];
-		      rowtmp[1] = 0.0;
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  rowtmp[0] = matval[0] * vecval;
-			  rowtmp[1] = matval[1] * vecval;
-			}
+			rowtmp[0] = vecval * matval[0];
+			rowtmp[1] = 0.0;
 			rowsum[0] = rowsum[0] + rowtmp[0];
 			rowsum[1] = rowsum[1] + rowtmp[1];
 			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    rowtmp[0] = matval[0] * vecval;
+			    rowtmp[1] = matval[1] * vecval;
+			  }
+			  rowsum[0] = rowsum[0] + rowtmp[0];
+			  rowsum[1] = rowsum[1] + rowtmp[1];
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
 		      {
 			tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1119,6 +1209,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}			/* end alpha != 0 */
 
+	blas_free(row_sum);
+
       }
       break;
     }
@@ -1136,6 +1228,7 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		matval  [2];
 	double		vecval;
@@ -1180,6 +1273,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	else
 	  order_i = order;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 1, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_d, incx);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1194,35 +1294,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -1258,35 +1336,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -1335,57 +1391,111 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1396,8 +1506,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1433,8 +1543,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1461,162 +1571,208 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1627,8 +1783,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1664,8 +1820,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1694,6 +1850,87 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
@@ -1704,61 +1941,121 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += incap;
 		    }
-		  } else {	/* if uplo == ... */
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -1769,8 +2066,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1806,8 +2103,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -1834,41 +2131,201 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -1899,13 +2356,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -1936,60 +2393,123 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2000,8 +2520,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2037,8 +2557,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2067,187 +2587,199 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
 		      head_tmp1[0] = head_rowsum[0];
 		      tail_tmp1[0] = tail_rowsum[0];
 		      head_tmp1[1] = head_rowsum[1];
 		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    s2 += t1;
+			  s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    t2 += s2;
+			  t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
 
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
-			    s2 += t1;
+			  s2 += t1;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
 
-			    t2 += s2;
+			  t2 += s2;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2278,13 +2810,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2315,60 +2847,131 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2379,8 +2982,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2416,8 +3019,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2446,52 +3049,129 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-double *
+			 * Compute complex-extra = complex-extra *
 			 * complex-double.
 			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			/* Real part */
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -2525,40 +3205,36 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
 			{
 			  /*
@@ -2590,90 +3266,12 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
 		      y_index += incy;
 		      ap_start += incap;
 		    }
@@ -2681,57 +3279,111 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -2742,8 +3394,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2779,8 +3431,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -2807,41 +3459,134 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (n - step - 1) * incap;
+			ap_index += incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2851,14 +3596,14 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -2869,16 +3614,40 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -2888,14 +3657,14 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -2906,75 +3675,145 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
 
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
 			  tail_b = tail_rowtmp[0];
 			  {
 			    /*
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3010,8 +3849,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -3040,13 +3879,229 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
+		      }
+
 		      {
 			/*
 			 * Compute complex-extra = complex-double *
@@ -3057,35 +4112,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -3124,35 +4157,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -3270,4297 +4281,116 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    } else {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (n - step - 1) * incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-extra *
-			 * complex-double.
-			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
-		      }
-
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      }
-	    }
-	  } else {
-	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
-	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-			matval[1] = -matval[1];
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += (step + 1) * incap;
-			x_index += incx;
-		      }
-		      resval[0] = y_i[y_index];
-		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[0] = head_t1;
-			tail_tmp2[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
-			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
-			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_tmp2[1] = head_t1;
-			tail_tmp2[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_tmp1[0];
-			tail_a = tail_tmp1[0];
-			head_b = head_tmp2[0];
-			tail_b = tail_tmp2[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[0] = head_t;
-			tail_tmp2[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_tmp1[1];
-			tail_a = tail_tmp1[1];
-			head_b = head_tmp2[1];
-			tail_b = tail_tmp2[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_tmp2[1] = head_t;
-			tail_tmp2[1] = tail_t;
-		      }
-		      y_i[y_index] = head_tmp2[0];
-		      y_i[y_index + 1] = head_tmp2[1];
-		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
-		    }
-		  } else {	/* if uplo == ... */
-		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		      x_index = x_start;
-		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (n - step - 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7571,8 +4401,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7608,8 +4438,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7636,15 +4466,231 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += (step + 1) * incap;
+			ap_index += incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
-		      head_tmp1[0] = head_rowsum[0];
-		      tail_tmp1[0] = tail_rowsum[0];
-		      head_tmp1[1] = head_rowsum[1];
-		      tail_tmp1[1] = tail_rowsum[1];
+		      {
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
+
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
+		      }
+
 		      {
 			/*
 			 * Compute complex-extra = complex-double *
@@ -7655,35 +4701,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -7722,35 +4746,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -7867,12 +4869,14 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_i[y_index] = head_tmp2[0];
 		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
-		      ap_start += (matrix_row + 1) * incap;
+		      ap_start += incap;
 		    }
 		  }		/* end if uplo == blas_upper ... */
 		}
 	      }
-	    } else {
+	    }
+	  } else {
+	    if ((alpha_i[0] == 1.0 && alpha_i[1] == 0.0)) {
 	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
 		{
 		  y_index = y_start;
@@ -7881,57 +4885,388 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
+
+			    t2 += s2;
 
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
+			    /*
+			     * Compute double-double = double-double +
+			     * double-double.
+			     */
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add two lo words. */
+			    t1 = tail_a + tail_b;
+			    bv = t1 - tail_a;
+			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			    s2 += t1;
+
+			    /* Renormalize (s1, s2)  to  (t1, s2) */
+			    t1 = s1 + s2;
+			    s2 = s2 - (t1 - s1);
 
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
+			    t2 += s2;
 
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			    /* Renormalize (t1, t2)  */
+			    head_t = t1 + t2;
+			    tail_t = t2 - (head_t - t1);
 			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
+		      }
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  } else {	/* if uplo == ... */
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
+			matval[0] = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -7942,8 +5277,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -7979,8 +5314,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8007,162 +5342,214 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8173,8 +5560,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8210,8 +5597,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8240,68 +5627,111 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
 			/*
-			 * Compute complex-extra = complex-extra *
+			 * Compute complex-extra = complex-double *
 			 * complex-double.
 			 */
-			double		head_a0, tail_a0;
-			double		head_a1, tail_a1;
 			double		head_t1, tail_t1;
 			double		head_t2, tail_t2;
-			head_a0 = head_rowsum[0];
-			tail_a0 = tail_rowsum[0];
-			head_a1 = head_rowsum[1];
-			tail_a1 = tail_rowsum[1];
-			/* real part */
+			/* Real part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -8335,56 +5765,18 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp1[0] = head_t1;
-			tail_tmp1[0] = tail_t1;
-			/* imaginary part */
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
-
-			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a1 * alpha_i[0];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
-			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
-
-			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-			  c2 = tail_a0 * alpha_i[1];
-			  t1 = c11 + c2;
-			  t2 = (c2 - (t1 - c11)) + c21;
-
-			  head_t2 = t1 + t2;
-			  tail_t2 = t2 - (head_t2 - t1);
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -8416,12 +5808,90 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t1 = t1 + t2;
 			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_tmp1[1] = head_t1;
-			tail_tmp1[1] = tail_t1;
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
+		      }
+		      {
+			double		head_t , tail_t;
+			double		head_a , tail_a;
+			double		head_b , tail_b;
+			/* Real part */
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
+			/* Imaginary part */
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_a + head_b;
+			  bv = s1 - head_a;
+			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_a + tail_b;
+			  bv = t1 - tail_a;
+			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t = t1 + t2;
+			  tail_t = t2 - (head_t - t1);
+			}
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-
-		      y_i[y_index] = head_tmp1[0];
-		      y_i[y_index + 1] = head_tmp1[1];
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
@@ -8429,57 +5899,111 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8490,8 +6014,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8527,8 +6051,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8555,41 +6079,201 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
+		      resval[0] = y_i[y_index];
+		      resval[1] = y_i[y_index + 1];
+		      head_tmp1[0] = head_rowsum[0];
+		      tail_tmp1[0] = tail_rowsum[0];
+		      head_tmp1[1] = head_rowsum[1];
+		      tail_tmp1[1] = tail_rowsum[1];
 		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			/*
+			 * Compute complex-extra = complex-double *
+			 * complex-double.
+			 */
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			/* Real part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[0] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[1] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[0] = head_t1;
+			tail_tmp2[0] = tail_t1;
+			/* Imaginary part */
+			{
+			  /* Compute double_double = double * double. */
+			  head_t1 = beta_i[1] * resval[0];
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
+			}
+			{
+			  /* Compute double_double = double * double. */
+			  head_t2 = beta_i[0] * resval[1];
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
+			}
+			{
+			  /*
+			   * Compute double-double = double-double +
+			   * double-double.
+			   */
+			  double	  bv;
+			  double	  s1    , s2, t1, t2;
+
+			  /* Add two hi words. */
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			  /* Add two lo words. */
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp2[1] = head_t1;
+			tail_tmp2[1] = tail_t1;
 		      }
 		      {
 			double		head_t , tail_t;
 			double		head_a , tail_a;
 			double		head_b , tail_b;
 			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			head_a = head_tmp1[0];
+			tail_a = tail_tmp1[0];
+			head_b = head_tmp2[0];
+			tail_b = tail_tmp2[0];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -8620,13 +6304,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
+			head_tmp2[0] = head_t;
+			tail_tmp2[0] = tail_t;
 			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+			head_a = head_tmp1[1];
+			tail_a = tail_tmp1[1];
+			head_b = head_tmp2[1];
+			tail_b = tail_tmp2[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -8657,60 +6341,131 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_t = t1 + t2;
 			  tail_t = t2 - (head_t - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp2[1] = head_t;
+			tail_tmp2[1] = tail_t;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+		      y_i[y_index] = head_tmp2[0];
+		      y_i[y_index + 1] = head_tmp2[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      }
+	    } else {
+	      if (beta_i[0] == 0.0 && beta_i[1] == 0.0) {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -8721,8 +6476,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8758,8 +6513,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -8788,6 +6543,87 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
 			/*
@@ -8805,20 +6641,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -8829,20 +6655,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -8888,20 +6704,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -8912,20 +6718,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -8973,67 +6769,115 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      y_index += incy;
 		      ap_start += (matrix_row + 1) * incap;
 		    }
-		  }		/* end if uplo == blas_upper ... */
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  if (uplo == blas_upper) {
+		  } else {	/* if uplo == ... */
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9044,8 +6888,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9081,8 +6925,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9109,41 +6953,134 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  head_rowsum[1] = head_t;
 			  tail_rowsum[1] = tail_t;
 			}
-			ap_index += incap;
+			ap_index += (step + 1) * incap;
 			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+			/*
+			 * Compute complex-extra = complex-extra *
+			 * complex-double.
+			 */
+			double		head_a0, tail_a0;
+			double		head_a1, tail_a1;
+			double		head_t1, tail_t1;
+			double		head_t2, tail_t2;
+			head_a0 = head_rowsum[0];
+			tail_a0 = tail_rowsum[0];
+			head_a1 = head_rowsum[1];
+			tail_a1 = tail_rowsum[1];
+			/* real part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a0 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
+
+			  c2 = tail_a0 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
+
+			  c11 = head_a1 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
+
+			  c2 = tail_a1 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
+			}
+			head_t2 = -head_t2;
+			tail_t2 = -tail_t2;
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9153,34 +7090,58 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+			  s2 += t1;
+
+			  /* Renormalize (s1, s2)  to  (t1, s2) */
+			  t1 = s1 + s2;
+			  s2 = s2 - (t1 - s1);
+
+			  t2 += s2;
+
+			  /* Renormalize (t1, t2)  */
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			head_tmp1[0] = head_t1;
+			tail_tmp1[0] = tail_t1;
+			/* imaginary part */
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  s2 += t1;
+			  c11 = head_a1 * alpha_i[0];
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
+			  c2 = tail_a1 * alpha_i[0];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
 
-			  t2 += s2;
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
+			}
+			{
+			  /* Compute double-double = double-double * double. */
+			  double	  c11   , c21, c2, t1, t2;
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  c11 = head_a0 * alpha_i[1];
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
+
+			  c2 = tail_a0 * alpha_i[1];
+			  t1 = c11 + c2;
+			  t2 = (c2 - (t1 - c11)) + c21;
+
+			  head_t2 = t1 + t2;
+			  tail_t2 = t2 - (head_t2 - t1);
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
 			  /*
 			   * Compute double-double = double-double +
@@ -9190,14 +7151,14 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  double	  s1    , s2, t1, t2;
 
 			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+			  s1 = head_t1 + head_t2;
+			  bv = s1 - head_t1;
+			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
 			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+			  t1 = tail_t1 + tail_t2;
+			  bv = t1 - tail_t1;
+			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
 
 			  s2 += t1;
 
@@ -9208,63 +7169,133 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			  t2 += s2;
 
 			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_t1 = t1 + t2;
+			  tail_t1 = t2 - (head_t1 - t1);
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			head_tmp1[1] = head_t1;
+			tail_tmp1[1] = tail_t1;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+
+		      y_i[y_index] = head_tmp1[0];
+		      y_i[y_index + 1] = head_tmp1[1];
+		      y_index += incy;
+		      ap_start += (matrix_row + 1) * incap;
+		    }
+		  }		/* end if uplo == blas_upper ... */
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  if (uplo == blas_upper) {
+		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		      x_index = x_start;
+		      ap_index = ap_start;
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
+			}
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -9275,8 +7306,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9312,8 +7343,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -9342,6 +7373,87 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -9361,20 +7473,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -9385,20 +7487,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -9444,20 +7536,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -9468,20 +7550,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -9534,35 +7606,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -9601,35 +7651,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -9752,288 +7780,111 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		      x_index = x_start;
 		      ap_index = ap_start;
-		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		      for (step = 0; step < matrix_row; step++) {
-			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
-			vecval = x_i[x_index];
-
-			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
-			}
-			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
-			  /* Real part */
-			  head_a = head_rowsum[0];
-			  tail_a = tail_rowsum[0];
-			  head_b = head_rowtmp[0];
-			  tail_b = tail_rowtmp[0];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[0] = head_t;
-			  tail_rowsum[0] = tail_t;
-			  /* Imaginary part */
-			  head_a = head_rowsum[1];
-			  tail_a = tail_rowsum[1];
-			  head_b = head_rowtmp[1];
-			  tail_b = tail_rowtmp[1];
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_a + head_b;
-			    bv = s1 - head_a;
-			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_a + tail_b;
-			    bv = t1 - tail_a;
-			    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t = t1 + t2;
-			    tail_t = t2 - (head_t - t1);
-			  }
-			  head_rowsum[1] = head_t;
-			  tail_rowsum[1] = tail_t;
-			}
-			ap_index += incap;
-			x_index += incx;
-		      }
-		      /*
-		       * need to do diagonal element without referencing the
-		       * imaginary part
-		       */
-		      matval[0] = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute complex double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = vecval * split;
-			a1 = con - vecval;
-			a1 = con - a1;
-			a2 = vecval - a1;
-			con = matval[0] * split;
-			b1 = con - matval[0];
-			b1 = con - b1;
-			b2 = matval[0] - b1;
-
-			head_rowtmp[0] = vecval * matval[0];
-			tail_rowtmp[0] = (((a1 * b1 - head_rowtmp[0]) + a1 * b2) + a2 * b1) + a2 * b2;
-			head_rowtmp[1] = tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		      if (row_sum != NULL) {
+			head_rowsum[0] = row_sum[4 * matrix_row];
+			head_rowsum[1] = row_sum[4 * matrix_row + 1];
+			tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+			tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		      } else {
+			head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+			head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+			for (step = 0; step < matrix_row; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += incap;
+			  x_index += incx;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		      for (step = matrix_row + 1; step < n; step++) {
+			/*
+			 * need to do diagonal element without referencing the
+			 * imaginary part
+			 */
 			matval[0] = ap_i[ap_index];
-			matval[1] = ap_i[ap_index + 1];
 			vecval = x_i[x_index];
-			matval[1] = -matval[1];
 			{
-			  /* Compute complex-extra = complex-double * real. */
-			  double	  head_t, tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[0] * split;
-			    b1 = con - matval[0];
-			    b1 = con - b1;
-			    b2 = matval[0] - b1;
-
-			    head_t = vecval * matval[0];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[0] = head_t;
-			  tail_rowtmp[0] = tail_t;
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = vecval * split;
-			    a1 = con - vecval;
-			    a1 = con - a1;
-			    a2 = vecval - a1;
-			    con = matval[1] * split;
-			    b1 = con - matval[1];
-			    b1 = con - b1;
-			    b2 = matval[1] - b1;
-
-			    head_t = vecval * matval[1];
-			    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_rowtmp[1] = head_t;
-			  tail_rowtmp[1] = tail_t;
+			  /* Compute complex double_double = double * double. */
+			  head_rowtmp[0] = vecval * matval[0];
+			  tail_rowtmp[0] = BLAS_TWO_PROD_ERR(vecval, matval[0], head_rowtmp[0]);
+			  head_rowtmp[1] = tail_rowtmp[1] = 0.0;
 			}
 			{
-			  double	  head_t, tail_t;
-			  double	  head_a, tail_a;
-			  double	  head_b, tail_b;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
 			  head_a = head_rowsum[0];
 			  tail_a = tail_rowsum[0];
@@ -10044,8 +7895,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10081,8 +7932,8 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			     * Compute double-double = double-double +
 			     * double-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  bv;
+			    double	  s1    , s2, t1, t2;
 
 			    /* Add two hi words. */
 			    s1 = head_a + head_b;
@@ -10111,6 +7962,87 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			ap_index += (step + 1) * incap;
 			x_index += incx;
+			for (step = matrix_row + 1; step < n; step++) {
+			  matval[0] = ap_i[ap_index];
+			  matval[1] = ap_i[ap_index + 1];
+			  vecval = x_i[x_index];
+			  matval[1] = -matval[1];
+			  {
+			    /* Compute complex-extra = complex-double * real. */
+			    double	  head_t, tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[0];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[0], head_t);
+			    }
+			    head_rowtmp[0] = head_t;
+			    tail_rowtmp[0] = tail_t;
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t = vecval * matval[1];
+			      tail_t = BLAS_TWO_PROD_ERR(vecval, matval[1], head_t);
+			    }
+			    head_rowtmp[1] = head_t;
+			    tail_rowtmp[1] = tail_t;
+			  }
+			  {
+			    double	  head_t, tail_t;
+			    double	  head_a, tail_a;
+			    double	  head_b, tail_b;
+			    /* Real part */
+			    head_a = head_rowsum[0];
+			    tail_a = tail_rowsum[0];
+			    head_b = head_rowtmp[0];
+			    tail_b = tail_rowtmp[0];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[0] = head_t;
+			    tail_rowsum[0] = tail_t;
+			    /* Imaginary part */
+			    head_a = head_rowsum[1];
+			    tail_a = tail_rowsum[1];
+			    head_b = head_rowtmp[1];
+			    tail_b = tail_rowtmp[1];
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_a + head_b;
+			      bv = s1 - head_a;
+			      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_a + tail_b;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t = s1 + s2;
+			      tail_t = s2 - (head_t - s1);
+			    }
+			    head_rowsum[1] = head_t;
+			    tail_rowsum[1] = tail_t;
+			  }
+			  ap_index += (step + 1) * incap;
+			  x_index += incx;
+			}
 		      }
 		      resval[0] = y_i[y_index];
 		      resval[1] = y_i[y_index + 1];
@@ -10130,20 +8062,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			  c2 = tail_a0 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -10154,20 +8076,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			  c2 = tail_a1 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -10213,20 +8125,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = alpha_i[0] * split;
-			  b1 = con - alpha_i[0];
-			  b1 = con - b1;
-			  b2 = alpha_i[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * alpha_i[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			  c2 = tail_a1 * alpha_i[0];
 			  t1 = c11 + c2;
@@ -10237,20 +8139,10 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = alpha_i[1] * split;
-			  b1 = con - alpha_i[1];
-			  b1 = con - b1;
-			  b2 = alpha_i[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * alpha_i[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			  c2 = tail_a0 * alpha_i[1];
 			  t1 = c11 + c2;
@@ -10303,35 +8195,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Real part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[0] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[1] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 			}
 			head_t2 = -head_t2;
 			tail_t2 = -tail_t2;
@@ -10370,35 +8240,13 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* Imaginary part */
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[1] * split;
-			  a1 = con - beta_i[1];
-			  a1 = con - a1;
-			  a2 = beta_i[1] - a1;
-			  con = resval[0] * split;
-			  b1 = con - resval[0];
-			  b1 = con - b1;
-			  b2 = resval[0] - b1;
-
 			  head_t1 = beta_i[1] * resval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 			}
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = beta_i[0] * split;
-			  a1 = con - beta_i[0];
-			  a1 = con - a1;
-			  a2 = beta_i[0] - a1;
-			  con = resval[1] * split;
-			  b1 = con - resval[1];
-			  b1 = con - b1;
-			  b2 = resval[1] - b1;
-
 			  head_t2 = beta_i[0] * resval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 			}
 			{
 			  /*
@@ -10523,6 +8371,7 @@ void		BLAS_zhpmv_z_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    }
 	  }
 	}			/* end alpha != 0 */
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -0,0 +1,105 @@
+#ifndef BLAS_BATCH_H
+#define BLAS_BATCH_H
+
+/* Shared pieces of the batched _x routines.
+
+   A batch is checked once and cut into tasks of whole problems that run
+   on the thread pool, each task under a single FPU_FIX.  Every problem
+   is computed with the arithmetic of the single routine, so its result
+   is the same as a call to that routine and does not depend on the
+   split.  Problem sizes of 8, 16, 32 and 64 get loops of fixed length,
+   which the compiler unrolls. */
+
+#include "blas_dd_private.h"
+
+/* Least multiply-adds worth a task of their own. */
+#define BLAS_BATCH_TASK_WORK (1 << 15)
+
+/* Rows kept in registers by the column sweep of the batched GEMV. */
+#define BLAS_BATCH_ROWS 64
+
+/* The precisions of the single routines.  They do nothing at all,
+   arguments unchecked, for any other, and neither does a batch. */
+static inline int blas_batch_prec_known(enum blas_prec_type prec)
+{
+  return prec == blas_prec_single || prec == blas_prec_double
+    || prec == blas_prec_indigenous || prec == blas_prec_extra
+    || prec == blas_prec_reproducible;
+}
+
+/* Problems per task for problems of 'work' multiply-adds each. */
+static inline int blas_batch_chunk(long work)
+{
+  return (work >= BLAS_BATCH_TASK_WORK) ? 1
+    : (int) (BLAS_BATCH_TASK_WORK / (work > 0 ? work : 1));
+}
+
+/* SUM x[i*incx] * y[i*incy] for i < n, added in order. */
+static inline double blas_batch_dot_d_n(int n, const double *x, int incx,
+					const double *y, int incy)
+{
+  double sum = 0.0;
+  int i;
+
+  for (i = 0; i < n; i++)
+    sum = sum + x[i * incx] * y[i * incy];
+  return sum;
+}
+
+static inline double blas_batch_dot_d(int n, const double *x, int incx,
+				      const double *y, int incy)
+{
+  switch (n) {
+  case 8:
+    return blas_batch_dot_d_n(8, x, incx, y, incy);
+  case 16:
+    return blas_batch_dot_d_n(16, x, incx, y, incy);
+  case 32:
+    return blas_batch_dot_d_n(32, x, incx, y, incy);
+  case 64:
+    return blas_batch_dot_d_n(64, x, incx, y, incy);
+  default:
+    return blas_batch_dot_d_n(n, x, incx, y, incy);
+  }
+}
+
+/* As above in double-double. */
+static inline void blas_batch_dot_dd_n(int n, const double *x, int incx,
+				       const double *y, int incy,
+				       double *head_sum, double *tail_sum)
+{
+  double head = 0.0, tail = 0.0, head_prod, tail_prod;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    blas_dd_two_prod(x[i * incx], y[i * incy], &head_prod, &tail_prod);
+    blas_dd_add_lazy(head, tail, head_prod, tail_prod, &head, &tail);
+  }
+  *head_sum = head;
+  *tail_sum = tail;
+}
+
+static inline void blas_batch_dot_dd(int n, const double *x, int incx,
+				     const double *y, int incy,
+				     double *head_sum, double *tail_sum)
+{
+  switch (n) {
+  case 8:
+    blas_batch_dot_dd_n(8, x, incx, y, incy, head_sum, tail_sum);
+    break;
+  case 16:
+    blas_batch_dot_dd_n(16, x, incx, y, incy, head_sum, tail_sum);
+    break;
+  case 32:
+    blas_batch_dot_dd_n(32, x, incx, y, incy, head_sum, tail_sum);
+    break;
+  case 64:
+    blas_batch_dot_dd_n(64, x, incx, y, incy, head_sum, tail_sum);
+    break;
+  default:
+    blas_batch_dot_dd_n(n, x, incx, y, incy, head_sum, tail_sum);
+    break;
+  }
+}
+
+#endif /* BLAS_BATCH_H */
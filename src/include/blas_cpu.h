@@ -0,0 +1,145 @@
+#ifndef BLAS_CPU_H
+#define BLAS_CPU_H
+
+/* Runtime dispatch of the hot _x kernels.
+
+   Every kernel listed in struct blas_kernel_table is compiled once per
+   instruction set below, each copy with its own target attribute, so the
+   library itself can be built for a baseline CPU.  The widest set the
+   running CPU supports is picked once, when the library is loaded, and
+   the routines call through the chosen table. */
+
+/* Instruction sets the vector kernels are built for, best last. */
+enum blas_cpu_isa {
+            blas_isa_scalar = 0,
+            blas_isa_sse2   = 1,
+            blas_isa_avx2   = 2,	/* AVX2 + FMA */
+            blas_isa_avx512 = 3 };	/* AVX-512F   */
+
+#define BLAS_ISA_COUNT 4
+
+/* Environment variable that caps the instruction set, e.g. XBLAS_ISA=sse2.
+   It can only lower the choice, never raise it above what the CPU has. */
+#define BLAS_ISA_ENV "XBLAS_ISA"
+
+/* Per-ISA kernels.  Lane kernels leave 'lanes' partial double-double
+   sums in hl/tl (and gl/ul) for the caller to merge in a fixed order. */
+struct blas_kernel_table {
+  enum blas_cpu_isa isa;
+  const char *name;
+  int lanes;
+
+  /* dot, gemv: sums of x[j]*y[j] and, for complex data, x[j]*y[j^1]. */
+  void (*dot_lanes) (int len, const void *x, int x_single,
+		     const void *y, int y_single, int is_complex,
+		     double *hl, double *tl, double *gl, double *ul);
+  /* trsv: sums of t[j] * (head_x[j], tail_x[j]). */
+  void (*dot_dd_lanes) (int len, const void *t, int t_single,
+			const double *head_x, const double *tail_x,
+			double *hl, double *tl);
+  /* trsv panels: (hu[r], tu[r]) += sums over columns c of
+     t[r + c*ldt] * (head_x[c], tail_x[c]); x_single when head_x holds
+     floats and tail_x zeros. */
+  void (*gemv_dd_cols) (int len, int ncols, const void *t, int t_single,
+			int ldt, const double *head_x, const double *tail_x,
+			int x_single, double *hu, double *tu);
+  /* symv: gemv_dd_cols on xc, plus per-line lane sums of t[r + c*ldt] *
+     xr[r] in hl/tl + c*lanes. */
+  void (*symv_dd_lines) (int len, int ncols, const void *t, int t_single,
+			 int ldt, const double *xr, const double *xc,
+			 int x_single, double *hu, double *tu,
+			 double *hl, double *tl);
+  /* complex gemv panels: (hu, tu) += t[r + c*ldt] * x[c] over the
+     columns c in order, hu, tu, t and x holding (re, im) pairs, t's
+     imaginary parts negated when conj; exact when t and x hold floats,
+     whose products are exact in double. */
+  void (*zgemv_dd_cols) (int len, int ncols, const void *t, int t_single,
+			 int ldt, const double *x, int conj, int exact,
+			 double *hu, double *tu);
+  /* complex symv: zgemv_dd_cols on xc (conj_row), plus per-line lane
+     sums of t[r + c*ldt] * xr[r] (conj_line) in hl/tl + c*lanes, even
+     lanes real and odd lanes imaginary. */
+  void (*zsymv_dd_lines) (int len, int ncols, const void *t, int t_single,
+			  int ldt, const double *xr, const double *xc,
+			  int conj_row, int conj_line, int exact,
+			  double *hu, double *tu, double *hl, double *tl);
+  /* sum: sums of x[j]. */
+  void (*sum_lanes) (int len, const void *x, int x_single,
+		     double *hl, double *tl);
+  /* axpby, waxpby: returns the number of doubles done. */
+  int (*waxpby) (int len, const double *alpha, const void *x, int x_single,
+		 const double *beta, const void *y, int y_single,
+		 void *w, int w_single, int is_complex);
+  /* reproducible sums (blas_repro.h) of x[j]*y[j], or x[j] when y is
+     NULL: the largest magnitude, with *finite cleared on an infinity or
+     NaN, and the exact sums s[k] of the pieces in the bins of sigma[k]. */
+  double (*repro_max) (int len, const double *x, const double *y,
+		       int *finite);
+  void (*repro_deposit) (int len, const double *x, const double *y,
+			 const double *sigma, double *s);
+  /* gemm: MR x NR micro-kernels over packed panels. */
+  void (*gemm_kernel_d) (int kc, const double *a, const double *b,
+			 double *t, int ldt, int first);
+  void (*gemm_kernel_dd) (int kc, const double *a, const double *b,
+			  double *th, double *tt, int ldt, int first);
+  /* gemm_kernel_dd for panels of floats, whose products are exact. */
+  void (*gemm_kernel_dd_exact) (int kc, const double *a, const double *b,
+				double *th, double *tt, int ldt, int first);
+};
+
+#define BLAS_KERNEL_DECLS(isa)						\
+  void blas_dot_lanes_##isa(int, const void *, int, const void *, int,	\
+			    int, double *, double *, double *, double *);\
+  void blas_dot_dd_lanes_##isa(int, const void *, int, const double *,	\
+			       const double *, double *, double *);	\
+  void blas_gemv_dd_cols_##isa(int, int, const void *, int, int,	\
+			       const double *, const double *, int,	\
+			       double *, double *);			\
+  void blas_symv_dd_lines_##isa(int, int, const void *, int, int,	\
+				const double *, const double *, int,	\
+				double *, double *, double *, double *);\
+  void blas_zgemv_dd_cols_##isa(int, int, const void *, int, int,	\
+				const double *, int, int, double *,	\
+				double *);				\
+  void blas_zsymv_dd_lines_##isa(int, int, const void *, int, int,	\
+				 const double *, const double *, int,	\
+				 int, int, double *, double *, double *,\
+				 double *);				\
+  void blas_sum_lanes_##isa(int, const void *, int, double *, double *);\
+  int blas_waxpby_##isa(int, const double *, const void *, int,	\
+			const double *, const void *, int, void *, int, int);\
+  double blas_repro_max_##isa(int, const double *, const double *, int *);\
+  void blas_repro_deposit_##isa(int, const double *, const double *,	\
+				const double *, double *);
+
+#define BLAS_GEMM_KERNEL_DECLS(isa)					\
+  void blas_gemm_kernel_d_##isa(int, const double *, const double *,	\
+				double *, int, int);			\
+  void blas_gemm_kernel_dd_##isa(int, const double *, const double *,	\
+				 double *, double *, int, int);		\
+  void blas_gemm_kernel_dd_exact_##isa(int, const double *,		\
+				       const double *, double *,	\
+				       double *, int, int);
+
+/* The 4 x 4 GEMM tile is four 256-bit vectors, so AVX-512 uses the
+   AVX2 micro-kernels. */
+BLAS_KERNEL_DECLS(scalar)
+BLAS_GEMM_KERNEL_DECLS(scalar)
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(BLAS_NO_SIMD)
+#define BLAS_CPU_X86 1
+BLAS_KERNEL_DECLS(sse2)
+BLAS_KERNEL_DECLS(avx2)
+BLAS_KERNEL_DECLS(avx512)
+BLAS_GEMM_KERNEL_DECLS(sse2)
+BLAS_GEMM_KERNEL_DECLS(avx2)
+#endif
+
+/* The table in use.  Chosen at load time; later calls are a load. */
+const struct blas_kernel_table *blas_kernels(void);
+
+/* Instruction set of the table in use, and its name ("scalar", "sse2",
+   "avx2" or "avx512"), for logging which kernels a process runs. */
+enum blas_cpu_isa BLAS_get_isa(void);
+const char *BLAS_get_isa_name(void);
+
+#endif /* BLAS_CPU_H */
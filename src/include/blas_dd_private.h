@@ -0,0 +1,204 @@
+#ifndef BLAS_DD_PRIVATE_H
+#define BLAS_DD_PRIVATE_H
+
+/* Double-double primitives shared by the blocked kernels.
+
+   blas_dd_two_prod, blas_dd_two_sum, blas_dd_add, blas_dd_add_d,
+   blas_dd_mul_d, blas_dd_div_d and blas_dd_axpby are the exact
+   sequences the generated routines expand inline, so a kernel built
+   from them alone rounds identically to the loop it replaces.
+
+   blas_dd_add_lazy, and blas_dd_cmul, which adds its products with it,
+   are not: the lazy add renormalizes once, and its error is about
+   u^2 (|a| + |b|), u = 2^-53, with no relative bound when a and b
+   cancel.  A sum accumulated with it differs from one accumulated with
+   blas_dd_add in the last bits of the tail. */
+
+#include "blas_extended_private.h"
+
+/* Compute double_double = double * double. */
+static inline void blas_dd_two_prod(double a, double b,
+				    double *head, double *tail)
+{
+  double p = a * b;
+
+  *tail = BLAS_TWO_PROD_ERR(a, b, p);
+  *head = p;
+}
+
+/* Compute double-double = double-double + double-double. */
+static inline void blas_dd_add(double head_a, double tail_a,
+			       double head_b, double tail_b,
+			       double *head, double *tail)
+{
+  double bv;
+  double s1, s2, t1, t2;
+
+  /* Add two hi words. */
+  s1 = head_a + head_b;
+  bv = s1 - head_a;
+  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+  /* Add two lo words. */
+  t1 = tail_a + tail_b;
+  bv = t1 - tail_a;
+  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+  s2 += t1;
+
+  /* Renormalize (s1, s2)  to  (t1, s2) */
+  t1 = s1 + s2;
+  s2 = s2 - (t1 - s1);
+
+  t2 += s2;
+
+  /* Renormalize (t1, t2)  */
+  *head = t1 + t2;
+  *tail = t2 - (*head - t1);
+}
+
+/* Compute double-double = double-double + double-double, renormalizing
+   once: the lo words go straight into the error of the hi words.  11
+   flops instead of 20, still within the error bounds of the _x routines;
+   the inner loops accumulate their sums with it. */
+static inline void blas_dd_add_lazy(double head_a, double tail_a,
+				    double head_b, double tail_b,
+				    double *head, double *tail)
+{
+  double bv;
+  double s1, s2;
+
+  /* Add two hi words. */
+  s1 = head_a + head_b;
+  bv = s1 - head_a;
+  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+  /* Add the lo words to the error. */
+  s2 += tail_a + tail_b;
+
+  /* Renormalize (s1, s2)  */
+  *head = s1 + s2;
+  *tail = s2 - (*head - s1);
+}
+
+/* Compute double-double = double + double. */
+static inline void blas_dd_two_sum(double a, double b,
+				   double *head, double *tail)
+{
+  double e, t1, t2;
+
+  /* Knuth trick. */
+  t1 = a + b;
+  e = t1 - a;
+  t2 = ((b - e) + (a - (t1 - e)));
+
+  /* The result is t1 + t2, after normalization. */
+  *head = t1 + t2;
+  *tail = t2 - (*head - t1);
+}
+
+/* Compute double-double = double-double + double.  The same sum as
+   blas_dd_add with a zero tail on b, in fewer operations; used where the
+   product being added is exact (floats multiplied in double). */
+static inline void blas_dd_add_d(double head_a, double tail_a, double b,
+				 double *head, double *tail)
+{
+  double e, t1, t2;
+
+  /* Knuth trick. */
+  t1 = head_a + b;
+  e = t1 - head_a;
+  t2 = ((b - e) + (head_a - (t1 - e))) + tail_a;
+
+  /* The result is t1 + t2, after normalization. */
+  *head = t1 + t2;
+  *tail = t2 - (*head - t1);
+}
+
+/* Compute double-double complex = (a0 + i a1) * (x0 + i x1): four
+   two-products added in pairs, or, when exact (float operands, whose
+   products are exact in double), the products summed with the Knuth
+   trick. */
+static inline void blas_dd_cmul(double a0, double a1, double x0, double x1,
+				int exact, double *head, double *tail)
+{
+  double head_t, tail_t;
+
+  if (exact) {
+    blas_dd_two_sum(a0 * x0, -a1 * x1, &head[0], &tail[0]);
+    blas_dd_two_sum(a0 * x1, a1 * x0, &head[1], &tail[1]);
+    return;
+  }
+  /* Real part */
+  blas_dd_two_prod(a0, x0, &head[0], &tail[0]);
+  blas_dd_two_prod(a1, x1, &head_t, &tail_t);
+  blas_dd_add_lazy(head[0], tail[0], -head_t, -tail_t, &head[0], &tail[0]);
+  /* Imaginary part */
+  blas_dd_two_prod(a1, x0, &head[1], &tail[1]);
+  blas_dd_two_prod(a0, x1, &head_t, &tail_t);
+  blas_dd_add_lazy(head[1], tail[1], head_t, tail_t, &head[1], &tail[1]);
+}
+
+/* Compute double-double = double-double * double. */
+static inline void blas_dd_mul_d(double head_a, double tail_a, double b,
+				 double *head, double *tail)
+{
+  double c11, c21, c2, t1, t2;
+
+  blas_dd_two_prod(head_a, b, &c11, &c21);
+
+  c2 = tail_a * b;
+  t1 = c11 + c2;
+  t2 = (c2 - (t1 - c11)) + c21;
+
+  *head = t1 + t2;
+  *tail = t2 - (*head - t1);
+}
+
+/* Compute double-double = double-double / double, using a Newton
+   iteration scheme. */
+static inline void blas_dd_div_d(double head_a, double tail_a, double b,
+				 double *head, double *tail)
+{
+  double e, t1, t2, t11, t21, t12, t22;
+
+  /* Compute a DP approximation to the quotient. */
+  t1 = head_a / b;
+
+  /* Compute t1 * b and subtract it from dda using Knuth trick. */
+  blas_dd_two_prod(t1, b, &t12, &t22);
+  t11 = head_a - t12;
+  e = t11 - head_a;
+  t21 = ((-t12 - e) + (head_a - (t11 - e))) + tail_a - t22;
+
+  /* Compute high-order word of (t11, t21) and divide by b. */
+  t2 = (t11 + t21) / b;
+
+  /* The result is t1 + t2, after normalization. */
+  *head = t1 + t2;
+  *tail = t2 - (*head - t1);
+}
+
+/* Compute (head_r, tail_r) <- alpha * (head_s, tail_s) + beta * (head_r,
+   tail_r), r not read when beta is zero: the result of an _x2 routine,
+   kept as a double-double. */
+static inline void blas_dd_axpby(double alpha, double head_s, double tail_s,
+				 double beta, double *head_r, double *tail_r)
+{
+  double head_t, tail_t, head_c, tail_c;
+
+  if (alpha == 1.0) {
+    head_t = head_s;
+    tail_t = tail_s;
+  } else {
+    blas_dd_mul_d(head_s, tail_s, alpha, &head_t, &tail_t);
+  }
+  if (beta != 0.0) {
+    blas_dd_mul_d(*head_r, *tail_r, beta, &head_c, &tail_c);
+    blas_dd_add(head_t, tail_t, head_c, tail_c, &head_t, &tail_t);
+  }
+  *head_r = head_t;
+  *tail_r = tail_t;
+}
+
+#endif /* BLAS_DD_PRIVATE_H */
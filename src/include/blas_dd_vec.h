@@ -0,0 +1,113 @@
+#ifndef BLAS_DD_VEC_H
+#define BLAS_DD_VEC_H
+
+/* Unit-stride double-double kernels for the level-1 _x routines.
+
+   Each kernel keeps several independent double-double accumulators in
+   vector lanes and calls through the kernel table of blas_cpu.h, so it
+   runs the widest instruction set the CPU supports.  Vectors are
+   contiguous: for complex data n counts complex elements and x, y, w
+   point at interleaved (re, im) pairs.  A "single"
+   flag means the array holds floats, which are widened to double on
+   load. */
+
+#include "blas_enum.h"
+
+/* Nonzero when a vector instruction set is available.  Without one the
+   kernels still work, but the generated loops are faster. */
+int blas_dd_vec_enabled(void);
+
+/* head_sum/tail_sum <- SUM x[i] * y[i]  (x conjugated if conj == blas_conj).
+   Complex results are written to head_sum[0..1], tail_sum[0..1]. */
+void blas_dot_x_kernel(int n, const void *x, int x_single,
+		       const void *y, int y_single, int is_complex,
+		       enum blas_conj_type conj,
+		       double *head_sum, double *tail_sum);
+
+/* head_sum/tail_sum <- SUM t[i] * (head_x[i], tail_x[i]), for the
+   double-double work vectors of trsv.  Real data only. */
+void blas_dot_dd_x_kernel(int n, const void *t, int t_single,
+			  const double *head_x, const double *tail_x,
+			  double *head_sum, double *tail_sum);
+
+/* (head_y[r], tail_y[r]) += SUM_c t[r + c*ldt] * (head_x[c], tail_x[c])
+   for r < m, c < n: a column-oriented GEMV panel on double-double
+   vectors, with the columns added in order.  Real data only.  x_single
+   says head_x holds float values and tail_x zeros; with float t every
+   product is then exact and is added as a double, which gives the same
+   sums in fewer operations. */
+void blas_gemv_dd_cols_x_kernel(int m, int n, const void *t, int t_single,
+				int ldt, const double *head_x,
+				const double *tail_x, int x_single,
+				double *head_y, double *tail_y);
+
+/* Most lines blas_symv_dd_lines_x_kernel takes at a time. */
+#define BLAS_SYMV_DD_LINES 8
+
+/* For ncols <= BLAS_SYMV_DD_LINES lines of a stored triangle, each of m
+   elements t[r + c*ldt]: (head_y[r], tail_y[r]) += SUM_c t[r + c*ldt] *
+   xc[c], the lines added in order as blas_gemv_dd_cols_x_kernel does,
+   and (head_dot[c], tail_dot[c]) <- SUM_r t[r + c*ldt] * xr[r].  Each
+   element is loaded once for both.  Real data only; x_single as for
+   blas_gemv_dd_cols_x_kernel, for xr and xc. */
+void blas_symv_dd_lines_x_kernel(int m, int ncols, const void *t,
+				 int t_single, int ldt, const double *xr,
+				 const double *xc, int x_single,
+				 double *head_y, double *tail_y,
+				 double *head_dot, double *tail_dot);
+
+/* (head_y[r], tail_y[r]) += SUM_c t[r + c*ldt] * x[c], complex, r < m
+   and c < n: blas_gemv_dd_cols_x_kernel for complex t and x, each array
+   of (re, im) pairs, t conjugated when conj.  x holds doubles; exact
+   says t and x hold floats, whose products are exact in double and
+   are then summed with the Knuth trick.  Every row adds the products of
+   the generated code in column order, so the sums are bitwise theirs. */
+void blas_zgemv_dd_cols_x_kernel(int m, int n, const void *t, int t_single,
+				 int ldt, const double *x, int conj,
+				 int exact, double *head_y, double *tail_y);
+
+/* blas_symv_dd_lines_x_kernel for complex t, xr and xc as above, the
+   rows taking t conjugated when conj_row, the lines when conj_line;
+   head_dot and tail_dot get a (re, im) pair per line. */
+void blas_zsymv_dd_lines_x_kernel(int m, int ncols, const void *t,
+				  int t_single, int ldt, const double *xr,
+				  const double *xc, int conj_row,
+				  int conj_line, int exact, double *head_y,
+				  double *tail_y, double *head_dot,
+				  double *tail_dot);
+
+/* head_sum/tail_sum <- SUM x[i]. */
+void blas_sum_x_kernel(int n, const void *x, int x_single, int is_complex,
+		       double *head_sum, double *tail_sum);
+
+/* w[i] <- alpha * x[i] + beta * y[i], each element formed in
+   double-double and rounded once.  alpha and beta hold one real or one
+   complex value.  w may alias y (axpby). */
+void blas_waxpby_x_kernel(int n, const double *alpha,
+			  const void *x, int x_single,
+			  const double *beta,
+			  const void *y, int y_single,
+			  void *w, int w_single, int is_complex);
+
+/* Vectors of at least BLAS_DD_PAR_MIN elements are reduced in chunks on
+   the thread pool.  The chunks depend on n alone (about BLAS_DD_PAR_CHUNK
+   elements, at most BLAS_DD_PAR_MAX_CHUNKS of them) and their double-double
+   sums are merged pairwise in chunk order, so the result is the same for
+   any thread count. */
+#define BLAS_DD_PAR_MIN (1 << 20)
+#define BLAS_DD_PAR_CHUNK (1 << 16)
+#define BLAS_DD_PAR_MAX_CHUNKS 256
+
+/* As blas_dot_x_kernel and blas_sum_x_kernel, chunked as above.  With
+   tail_sum NULL the chunks are summed in double instead, each product
+   rounded and added in index order as the double loops do, and merged
+   in the same pairwise order; the other precisions of the routines pass
+   NULL, so only blas_prec_extra pays for double-double. */
+void blas_dot_x_par(int n, const void *x, int x_single,
+		    const void *y, int y_single, int is_complex,
+		    enum blas_conj_type conj,
+		    double *head_sum, double *tail_sum);
+void blas_sum_x_par(int n, const void *x, int x_single, int is_complex,
+		    double *head_sum, double *tail_sum);
+
+#endif /* BLAS_DD_VEC_H */
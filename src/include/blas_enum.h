@@ -60,11 +60,15 @@ enum blas_jrot_type {
             blas_jrot_outer  = 202,
             blas_jrot_sorted = 203 };
 
+/* blas_prec_reproducible is summed reproducibly by BLAS_ddot_x,
+   BLAS_dsum_x, BLAS_dgemv_x and their _batch forms; every other _x
+   routine takes it as blas_prec_double. */
 enum blas_prec_type {
             blas_prec_single     = 211,
             blas_prec_double     = 212,
             blas_prec_indigenous = 213,
-            blas_prec_extra      = 214 };
+            blas_prec_extra      = 214,
+            blas_prec_reproducible = 215 };
 
 enum blas_base_type {
             blas_zero_base = 221,
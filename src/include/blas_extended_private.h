@@ -9,6 +9,39 @@
 /* Split a double into 2 parts with at most 26 bits each. (2^27 + 1) */
 #define split 	(134217729.0)
 
+/* With a fused multiply-add the rounding error of a*b is exactly
+   fma(a, b, -a*b), which replaces the Dekker split above in every
+   two-product.  Define BLAS_NO_FMA to force the Dekker sequence. */
+#if !defined(BLAS_NO_FMA) && !defined(BLAS_HAVE_FMA) && \
+    (defined(__FMA__) || defined(__ARM_FEATURE_FMA) || defined(__FP_FAST_FMA))
+#define BLAS_HAVE_FMA 1
+#endif
+
+/* The rounding error of the double product p = a*b, so that
+   a*b = p + BLAS_TWO_PROD_ERR(a, b, p) exactly.  Every two-product of
+   the routines goes through it. */
+#ifdef BLAS_HAVE_FMA
+#include <math.h>
+#define BLAS_TWO_PROD_ERR(a, b, p) fma((a), (b), -(p))
+#else
+static inline double blas_two_prod_err(double a, double b, double p)
+{
+  double a1, a2, b1, b2, con;
+
+  con = a * split;
+  a1 = con - a;
+  a1 = con - a1;
+  a2 = a - a1;
+  con = b * split;
+  b1 = con - b;
+  b1 = con - b1;
+  b2 = b - b1;
+
+  return (((a1 * b1 - p) + a1 * b2) + a2 * b1) + a2 * b2;
+}
+#define BLAS_TWO_PROD_ERR(a, b, p) blas_two_prod_err((a), (b), (p))
+#endif
+
 /* macros */
 #define MAX(a,b) (((a) > (b)) ? (a) : (b))
 #define MIN(a,b) (((a) < (b)) ? (a) : (b))
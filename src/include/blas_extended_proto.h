@@ -46,6 +46,18 @@ void BLAS_ddot_x(enum blas_conj_type conj, int n, double alpha,
 		 const double *x, int incx, double beta,
 		 const double *y, int incy,
 		 double *r, enum blas_prec_type prec);
+void BLAS_ddot_x_batch(enum blas_conj_type conj, int n, double alpha,
+		       const double *const *x, int incx, double beta,
+		       const double *const *y, int incy,
+		       double *r, int batch, enum blas_prec_type prec);
+void BLAS_ddot_x_batch_strided(enum blas_conj_type conj, int n,
+			       double alpha, const double *x, int incx,
+			       int stridex, double beta, const double *y,
+			       int incy, int stridey, double *r, int batch,
+			       enum blas_prec_type prec);
+void BLAS_ddot_x2(enum blas_conj_type conj, int n, double alpha,
+		  const double *x, int incx, double beta,
+		  const double *y, int incy, double *r_head, double *r_tail);
 void BLAS_cdot_x(enum blas_conj_type conj, int n, const void *alpha,
 		 const void *x, int incx, const void *beta,
 		 const void *y, int incy, void *r, enum blas_prec_type prec);
@@ -287,6 +299,23 @@ void BLAS_dgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  int m, int n, double alpha, const double *a, int lda,
 		  const double *x, int incx, double beta, double *y,
 		  int incy, enum blas_prec_type prec);
+void BLAS_dgemv_x_batch(enum blas_order_type order,
+			enum blas_trans_type trans, int m, int n,
+			double alpha, const double *const *a, int lda,
+			const double *const *x, int incx, double beta,
+			double *const *y, int incy, int batch,
+			enum blas_prec_type prec);
+void BLAS_dgemv_x_batch_strided(enum blas_order_type order,
+				enum blas_trans_type trans, int m, int n,
+				double alpha, const double *a, int lda,
+				int stridea, const double *x, int incx,
+				int stridex, double beta, double *y,
+				int incy, int stridey, int batch,
+				enum blas_prec_type prec);
+void BLAS_dgemv_x2(enum blas_order_type order, enum blas_trans_type trans,
+		   int m, int n, double alpha, const double *a, int lda,
+		   const double *x, int incx, double beta, double *y_head,
+		   double *y_tail, int incy);
 void BLAS_cgemv_x(enum blas_order_type order, enum blas_trans_type trans,
 		  int m, int n, const void *alpha, const void *a, int lda,
 		  const void *x, int incx, const void *beta, void *y,
@@ -1379,6 +1408,11 @@ void BLAS_dgemm_x(enum blas_order_type order, enum blas_trans_type transa,
 		  double alpha, const double *a, int lda, const double *b,
 		  int ldb, double beta, double *c, int ldc,
 		  enum blas_prec_type prec);
+void BLAS_dgemm_x2(enum blas_order_type order, enum blas_trans_type transa,
+		   enum blas_trans_type transb, int m, int n, int k,
+		   double alpha, const double *a, int lda, const double *b,
+		   int ldb, double beta, double *c_head, double *c_tail,
+		   int ldc);
 void BLAS_cgemm_x(enum blas_order_type order, enum blas_trans_type transa,
 		  enum blas_trans_type transb, int m, int n, int k,
 		  const void *alpha, const void *a, int lda, const void *b,
@@ -1652,6 +1686,145 @@ void BLAS_zhemm_z_d_x(enum blas_order_type order, enum blas_side_type side,
 		      const double *b, int ldb, const void *beta,
 		      void *c, int ldc, enum blas_prec_type prec);
 
+void BLAS_strsm_x(enum blas_order_type order, enum blas_side_type side,
+		  enum blas_uplo_type uplo, enum blas_trans_type trans,
+		  enum blas_diag_type diag, int m, int n, float alpha,
+		  const float *t, int ldt, float *b, int ldb,
+		  enum blas_prec_type prec);
+void BLAS_dtrsm_x(enum blas_order_type order, enum blas_side_type side,
+		  enum blas_uplo_type uplo, enum blas_trans_type trans,
+		  enum blas_diag_type diag, int m, int n, double alpha,
+		  const double *t, int ldt, double *b, int ldb,
+		  enum blas_prec_type prec);
+void BLAS_dtrsm_s_x(enum blas_order_type order, enum blas_side_type side,
+		    enum blas_uplo_type uplo, enum blas_trans_type trans,
+		    enum blas_diag_type diag, int m, int n, double alpha,
+		    const float *t, int ldt, double *b, int ldb,
+		    enum blas_prec_type prec);
+void BLAS_ctrsm_x(enum blas_order_type order, enum blas_side_type side,
+		  enum blas_uplo_type uplo, enum blas_trans_type trans,
+		  enum blas_diag_type diag, int m, int n, const void *alpha,
+		  const void *t, int ldt, void *b, int ldb,
+		  enum blas_prec_type prec);
+void BLAS_ztrsm_x(enum blas_order_type order, enum blas_side_type side,
+		  enum blas_uplo_type uplo, enum blas_trans_type trans,
+		  enum blas_diag_type diag, int m, int n, const void *alpha,
+		  const void *t, int ldt, void *b, int ldb,
+		  enum blas_prec_type prec);
+void BLAS_ztrsm_c_x(enum blas_order_type order, enum blas_side_type side,
+		    enum blas_uplo_type uplo, enum blas_trans_type trans,
+		    enum blas_diag_type diag, int m, int n, const void *alpha,
+		    const void *t, int ldt, void *b, int ldb,
+		    enum blas_prec_type prec);
+void BLAS_ctrsm_s_x(enum blas_order_type order, enum blas_side_type side,
+		    enum blas_uplo_type uplo, enum blas_trans_type trans,
+		    enum blas_diag_type diag, int m, int n, const void *alpha,
+		    const float *t, int ldt, void *b, int ldb,
+		    enum blas_prec_type prec);
+void BLAS_ztrsm_d_x(enum blas_order_type order, enum blas_side_type side,
+		    enum blas_uplo_type uplo, enum blas_trans_type trans,
+		    enum blas_diag_type diag, int m, int n, const void *alpha,
+		    const double *t, int ldt, void *b, int ldb,
+		    enum blas_prec_type prec);
+void BLAS_ssyrk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, float alpha,
+		  const float *a, int lda, float beta, float *c, int ldc,
+		  enum blas_prec_type prec);
+void BLAS_dsyrk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, double alpha,
+		  const double *a, int lda, double beta, double *c, int ldc,
+		  enum blas_prec_type prec);
+void BLAS_dsyrk_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		    enum blas_trans_type trans, int n, int k, double alpha,
+		    const float *a, int lda, double beta, double *c, int ldc,
+		    enum blas_prec_type prec);
+void BLAS_csyrk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, const void *alpha,
+		  const void *a, int lda, const void *beta, void *c, int ldc,
+		  enum blas_prec_type prec);
+void BLAS_zsyrk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, const void *alpha,
+		  const void *a, int lda, const void *beta, void *c, int ldc,
+		  enum blas_prec_type prec);
+void BLAS_zsyrk_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		    enum blas_trans_type trans, int n, int k,
+		    const void *alpha, const void *a, int lda,
+		    const void *beta, void *c, int ldc,
+		    enum blas_prec_type prec);
+void BLAS_csyrk_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		    enum blas_trans_type trans, int n, int k,
+		    const void *alpha, const float *a, int lda,
+		    const void *beta, void *c, int ldc,
+		    enum blas_prec_type prec);
+void BLAS_zsyrk_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		    enum blas_trans_type trans, int n, int k,
+		    const void *alpha, const double *a, int lda,
+		    const void *beta, void *c, int ldc,
+		    enum blas_prec_type prec);
+void BLAS_cherk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, float alpha,
+		  const void *a, int lda, float beta, void *c, int ldc,
+		  enum blas_prec_type prec);
+void BLAS_zherk_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		  enum blas_trans_type trans, int n, int k, double alpha,
+		  const void *a, int lda, double beta, void *c, int ldc,
+		  enum blas_prec_type prec);
+void BLAS_zherk_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		    enum blas_trans_type trans, int n, int k, double alpha,
+		    const void *a, int lda, double beta, void *c, int ldc,
+		    enum blas_prec_type prec);
+void BLAS_ssyr2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, float alpha,
+		   const float *a, int lda, const float *b, int ldb,
+		   float beta, float *c, int ldc, enum blas_prec_type prec);
+void BLAS_dsyr2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, double alpha,
+		   const double *a, int lda, const double *b, int ldb,
+		   double beta, double *c, int ldc, enum blas_prec_type prec);
+void BLAS_dsyr2k_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		       enum blas_trans_type trans, int n, int k, double alpha,
+		       const float *a, int lda, const float *b, int ldb,
+		       double beta, double *c, int ldc,
+		       enum blas_prec_type prec);
+void BLAS_csyr2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, const void *alpha,
+		   const void *a, int lda, const void *b, int ldb,
+		   const void *beta, void *c, int ldc,
+		   enum blas_prec_type prec);
+void BLAS_zsyr2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, const void *alpha,
+		   const void *a, int lda, const void *b, int ldb,
+		   const void *beta, void *c, int ldc,
+		   enum blas_prec_type prec);
+void BLAS_zsyr2k_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		       enum blas_trans_type trans, int n, int k,
+		       const void *alpha, const void *a, int lda,
+		       const void *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec);
+void BLAS_csyr2k_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		       enum blas_trans_type trans, int n, int k,
+		       const void *alpha, const float *a, int lda,
+		       const float *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec);
+void BLAS_zsyr2k_d_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		       enum blas_trans_type trans, int n, int k,
+		       const void *alpha, const double *a, int lda,
+		       const double *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec);
+void BLAS_cher2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, const void *alpha,
+		   const void *a, int lda, const void *b, int ldb, float beta,
+		   void *c, int ldc, enum blas_prec_type prec);
+void BLAS_zher2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, const void *alpha,
+		   const void *a, int lda, const void *b, int ldb, double beta,
+		   void *c, int ldc, enum blas_prec_type prec);
+void BLAS_zher2k_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		       enum blas_trans_type trans, int n, int k,
+		       const void *alpha, const void *a, int lda,
+		       const void *b, int ldb, double beta, void *c, int ldc,
+		       enum blas_prec_type prec);
+
 
 void BLAS_dgemv2_d_s(enum blas_order_type order, enum blas_trans_type trans,
 		     int m, int n, double alpha, const double *a, int lda,
@@ -0,0 +1,237 @@
+#ifndef BLAS_GEMM_ENGINE_H
+#define BLAS_GEMM_ENGINE_H
+
+/* Packed, cache-blocked engine behind the GEMM family.
+
+   Every operand is reduced to a real "view": a complex matrix multiplied
+   by a real one contributes its real and imaginary parts as separate rows
+   (A) or columns (B), and a complex-by-complex product expands each a(i,h)
+   into the 2x2 real block [re -im; im re] against b(h,j) stacked as
+   [re; im].  The engine then only needs real micro-kernels, in double
+   and in double-double, and a complex-aware epilogue.
+
+   There is no single-precision kernel: blas_prec_single, and the float
+   routines without _x, accumulate in double and round C once.  Their
+   results are at least as accurate as those of the float loops they
+   replace, but not bitwise the same.  Real results in double, and all
+   blas_prec_extra results of real operands, match the loops bit for bit.
+   Complex results in double do not: the real view sums re*re and -im*im
+   (or re*im and im*re) of each h as two separate products where the
+   loops round their difference first, so they differ from the loops by
+   rounding, a few ulps of the sum. */
+
+#include "blas_enum.h"
+
+/* Register block, L2 block of A, L1/L2 depth and L3 width of B.
+   MC and NC must be multiples of MR and NR. */
+#define BLAS_GEMM_MR 4
+#define BLAS_GEMM_NR 4
+#define BLAS_GEMM_MC 96
+#define BLAS_GEMM_KC 256
+#define BLAS_GEMM_NC 256
+/* Rows of C accumulated at once; bounds the accumulator workspace. */
+#define BLAS_GEMM_MB 576
+/* Tiles of C handed to the threads, in elements of C; they are halved
+   down to TILE_MIN until every thread has a couple of them. */
+#define BLAS_GEMM_TILE_M 192
+#define BLAS_GEMM_TILE_N 256
+#define BLAS_GEMM_TILE_MIN 32
+
+/* Calls with m*n*k below this stay on the reference loops. */
+#ifndef BLAS_GEMM_ENGINE_MIN_FLOPS
+#define BLAS_GEMM_ENGINE_MIN_FLOPS (32 * 32 * 32)
+#endif
+
+/* How the blas_prec_extra products form their double-double sums:
+   with the double-double micro-kernels (the default), or by the Ozaki
+   scheme, which splits A and B into slices whose products are exact in
+   double, runs those through the double micro-kernels and adds them up
+   in double-double.  The slices cover every bit of each row of A and
+   column of B, so the scheme keeps the XBLAS error bound, but not the
+   bits of the direct kernels.  It pays off only for data of a narrow
+   exponent range: the work grows with the square of the number of
+   slices, and it keeps several copies of A, B and C.
+   blas_gemm_extra_auto takes it when A or B holds doubles and m, n and
+   k of the real problem all reach BLAS_GEMM_OZAKI_MIN_DIM (bench_gemm
+   reports where it starts to win).  The direct kernels run when the
+   scheme cannot have its memory, or the data has infinities, NaNs,
+   elements out of its exponent range, or a row or column needing more
+   slices than the scheme takes. */
+enum blas_gemm_extra_method {
+            blas_gemm_extra_auto  = 0,
+            blas_gemm_extra_dd    = 1,
+            blas_gemm_extra_ozaki = 2 };
+
+#ifndef BLAS_GEMM_OZAKI_MIN_DIM
+#define BLAS_GEMM_OZAKI_MIN_DIM 128
+#endif
+
+/* Environment variable read once for the initial method: "dd" (the
+   default), "ozaki" or "auto". */
+#define BLAS_GEMM_EXTRA_ENV "XBLAS_GEMM_EXTRA"
+
+/* Method of the extra-precision GEMM, SYMM and HEMM calls made after
+   this one, in every thread that has not set its own. */
+void BLAS_set_gemm_extra_method(enum blas_gemm_extra_method method);
+
+/* Method of the calls made by the calling thread alone, over the one
+   above until cleared; set it around a call to choose for that call.
+   Returns 0, or -1 if the thread cannot keep it. */
+int BLAS_set_thread_gemm_extra_method(enum blas_gemm_extra_method method);
+void BLAS_clear_thread_gemm_extra_method(void);
+
+/* The method the calling thread's next call takes. */
+enum blas_gemm_extra_method BLAS_get_gemm_extra_method(void);
+
+/* Element storage of a matrix handed to the engine. */
+enum blas_gemm_elt_type {
+            blas_gemm_elt_s = 0,
+            blas_gemm_elt_d = 1,
+            blas_gemm_elt_c = 2,
+            blas_gemm_elt_z = 3 };
+
+#define BLAS_GEMM_ELT_IS_COMPLEX(t) ((t) >= blas_gemm_elt_c)
+
+/* Symmetric and Hermitian operands store only the i <= j triangle;
+   element (i, j) below the diagonal is read from (j, i).  The packing
+   expands their blocks into full panels, a line of the operand at a
+   time in runs either side of the diagonal, so the micro-kernels see
+   them as general matrices. */
+enum blas_gemm_shape {
+            blas_gemm_general = 0,
+            blas_gemm_symmetric = 1,
+            blas_gemm_hermitian = 2 };
+
+/* op(X) as seen by the engine: element (i, j) lives at p[i*rs + j*cs]
+   (counted in elements, so complex strides are in complex units).
+   conj negates imaginary parts read from the stored triangle; a
+   Hermitian operand negates the other triangle instead, and its
+   diagonal when diag_conj is set. */
+struct blas_gemm_operand {
+  const void *p;
+  enum blas_gemm_elt_type type;
+  int rs, cs;
+  int conj;
+  enum blas_gemm_shape shape;
+  int diag_conj;
+};
+
+void blas_gemm_operand_init(struct blas_gemm_operand *x, const void *p,
+			    enum blas_gemm_elt_type type,
+			    enum blas_order_type order,
+			    enum blas_trans_type trans, int ld);
+
+/* A of SYMM (shape blas_gemm_symmetric) or HEMM (blas_gemm_hermitian),
+   read the way the reference loops of that side and triangle read it. */
+void blas_gemm_operand_init_sym(struct blas_gemm_operand *x, const void *p,
+				enum blas_gemm_elt_type type,
+				enum blas_gemm_shape shape,
+				enum blas_order_type order,
+				enum blas_side_type side,
+				enum blas_uplo_type uplo, int ld);
+
+/* C <- alpha * op(A) * op(B) + beta * C through the packed engine.
+   alpha and beta point to scalars of C's type.  blas_prec_extra sums in
+   double-double and the other precisions in double, blas_prec_single
+   and blas_prec_reproducible included.
+   Returns 0 without touching C when the call is invalid (prec
+   included), trivial or too small, so that the caller falls through to
+   its reference loops. */
+int blas_gemm_engine(enum blas_order_type order,
+		     enum blas_trans_type transa,
+		     enum blas_trans_type transb, int m, int n, int k,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_prec_type prec);
+
+/* The same in blas_prec_extra for a double or double complex C kept as
+   two words, C_head + C_tail <- alpha * op(A) * op(B) + beta * (C_head +
+   C_tail), left unrounded; C is not read when beta is zero.  Takes
+   problems of any size.  Returns 0, leaving C untouched, when the call
+   is invalid or trivial (k or alpha zero) or memory runs out. */
+int blas_gemm_engine_x2(enum blas_order_type order,
+			enum blas_trans_type transa,
+			enum blas_trans_type transb, int m, int n, int k,
+			const void *alpha,
+			const void *a, enum blas_gemm_elt_type a_type,
+			int lda,
+			const void *b, enum blas_gemm_elt_type b_type,
+			int ldb, const void *beta, double *c_head,
+			double *c_tail, enum blas_gemm_elt_type c_type,
+			int ldc);
+
+/* C <- alpha * A * B + beta * C or alpha * B * A + beta * C, with A
+   symmetric (SYMM) or Hermitian (HEMM); same contract as above. */
+int blas_symm_engine(enum blas_order_type order, enum blas_side_type side,
+		     enum blas_uplo_type uplo, int m, int n,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_prec_type prec);
+int blas_hemm_engine(enum blas_order_type order, enum blas_side_type side,
+		     enum blas_uplo_type uplo, int m, int n,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_prec_type prec);
+
+/* Operand-level entry: C is m-by-n with element (i, j) at
+   c[i*c_rs + j*c_cs].  The caller has validated the arguments.  The
+   work is split over BLAS_get_num_threads() threads by tiles of C; every
+   element is computed the same way whatever the split, so the result
+   does not depend on the thread count. */
+int blas_gemm_engine_op(int m, int n, int k, const void *alpha,
+			const struct blas_gemm_operand *a,
+			const struct blas_gemm_operand *b,
+			const void *beta, void *c,
+			enum blas_gemm_elt_type c_type, int c_rs, int c_cs,
+			enum blas_prec_type prec);
+
+/* The same in blas_prec_extra with C kept as head and tail words, as
+   blas_gemm_engine_x2 keeps it. */
+int blas_gemm_engine_op_x2(int m, int n, int k, const void *alpha,
+			   const struct blas_gemm_operand *a,
+			   const struct blas_gemm_operand *b,
+			   const void *beta, double *c_head, double *c_tail,
+			   enum blas_gemm_elt_type c_type, int c_rs, int c_cs);
+
+/* op(A) packed once for many products: the MR-row micro-panels of every
+   KC block of its real view, as the engine would pack them for B of
+   b_type, block pc at p + pc * rows, rows being the view rows rounded up
+   to MR.  a is op(A) itself, which must outlive the panels; the Ozaki
+   scheme reads it. */
+struct blas_gemm_packed_a {
+  struct blas_gemm_operand a;
+  int m, k;
+  int b_complex;
+  long rows;
+  double *p;
+};
+
+/* Packs the m-by-k op(A) a for products with B of type b_type.  Returns
+   1, or 0 if memory runs out, pa->p then NULL. */
+int blas_gemm_pack_a(struct blas_gemm_packed_a *pa, int m, int k,
+		     const struct blas_gemm_operand *a,
+		     enum blas_gemm_elt_type b_type);
+void blas_gemm_packed_a_free(struct blas_gemm_packed_a *pa);
+
+/* C <- alpha * op(A) * op(B) + beta * C with op(A) from pa, C m by n,
+   B and C in the given order.  Computes what blas_gemm_engine computes
+   for the same op(A), bit for bit, and declines the same calls. */
+int blas_gemm_engine_packed(enum blas_order_type order,
+			    enum blas_trans_type transb, int n,
+			    const void *alpha,
+			    const struct blas_gemm_packed_a *pa,
+			    const void *b, enum blas_gemm_elt_type b_type,
+			    int ldb, const void *beta, void *c,
+			    enum blas_gemm_elt_type c_type, int ldc,
+			    enum blas_prec_type prec);
+
+#endif /* BLAS_GEMM_ENGINE_H */
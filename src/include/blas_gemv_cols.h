@@ -0,0 +1,83 @@
+#ifndef BLAS_GEMV_COLS_H
+#define BLAS_GEMV_COLS_H
+
+/* Column sweep for the extra-precision branches of GEMV, GEMV2 and
+   GE_SUM_MV when the columns of op(A) are contiguous (column-major
+   without transpose, row-major with), and its band form for GBMV and
+   GBMV2.
+
+   The row sums of op(A) * x are formed BLAS_GEMV_COLS_MB rows at a
+   time.  Their double-double accumulators sit in the calling thread's
+   scratch space, small enough to stay in L1, while A is read down its
+   columns, BLAS_GEMV_COLS_NB of them per pass over the block.  Each row
+   still adds its products in column order, so the sums are bitwise
+   those of the reference row loops, which then apply alpha and beta as
+   before.
+
+   Large problems are split by rows over the thread pool: row blocks
+   here, panels of BLAS_GEMV_ROWS_MB rows when the rows of op(A) are
+   contiguous.  A row is summed by one worker in the serial order, so
+   the result is the same for any thread count. */
+
+#include "blas_gemm_engine.h"
+
+#define BLAS_GEMV_COLS_MB 256
+#define BLAS_GEMV_COLS_NB 64
+#define BLAS_GEMV_ROWS_MB 32
+
+/* Fewer rows than this stay on the reference loops. */
+#ifndef BLAS_GEMV_COLS_MIN_ROWS
+#define BLAS_GEMV_COLS_MIN_ROWS 8
+#endif
+
+/* Real bands narrower than this, in diagonals, stay on the reference
+   loops: their panels are too short to pay for the kernel calls. */
+#ifndef BLAS_GBMV_BAND_MIN_WIDTH
+#define BLAS_GBMV_BAND_MIN_WIDTH 41
+#endif
+
+/* Smaller problems, in elements of op(A), stay on the calling thread. */
+#ifndef BLAS_GEMV_PAR_MIN
+#define BLAS_GEMV_PAR_MIN (1 << 16)
+#endif
+
+/* Double-double sums s[i] = SUM_j op(A)(i, j) * x[j] for i < m, j < n,
+   with op(A)(i, j) at a[i + j*lda] and x[j] at x[j*incx], both counted
+   in elements of their type (so x points at the first element used,
+   and incx may be negative).  conj negates the imaginary part of A.
+   Returns a blas_malloc'ed block holding head, tail for each row (head
+   re, head im, tail re, tail im when A or x is complex), to be released
+   with blas_free, or NULL when the sweep does not apply or no memory
+   can be had, so that the caller keeps to its own loops. */
+double *blas_gemv_cols_x(int m, int n, const void *a,
+			 enum blas_gemm_elt_type a_type, int lda, int conj,
+			 const void *x, enum blas_gemm_elt_type x_type,
+			 int incx);
+
+/* The same sums when the rows of op(A) are contiguous, op(A)(i, j) at
+   a[i*lda + j], formed on the thread pool: each row through
+   blas_dot_x_kernel when dot is set (GEMV's unit-stride rows, A and x
+   both real or both complex), else element by element as the reference
+   loops add it.  Returns NULL, leaving the rows to the caller's loops,
+   below BLAS_GEMV_PAR_MIN elements, on one thread or without memory. */
+double *blas_gemv_rows_x(int m, int n, const void *a,
+			 enum blas_gemm_elt_type a_type, int lda, int conj,
+			 const void *x, enum blas_gemm_elt_type x_type,
+			 int incx, int dot);
+
+/* The row sums of op(A) * x for GBMV: A m by n with kl sub- and ku
+   super-diagonals in band storage with leading dimension lda, op(A)
+   and x as the routine takes them (x pointing at the first element
+   used), conjugated for blas_conj_trans.  A column sweep when columns of
+   op(A) are contiguous, bitwise the reference row loops; else a row
+   sweep through blas_dot_x_kernel, A and x both real or both complex,
+   whose lanes split each row sum.  Either runs on the thread pool from
+   BLAS_GEMV_PAR_MIN elements of the band.  Returns as blas_gemv_cols_x,
+   one sum per row of op(A), or NULL. */
+double *blas_gbmv_band_x(enum blas_order_type order,
+			 enum blas_trans_type trans, int m, int n, int kl,
+			 int ku, const void *a, enum blas_gemm_elt_type a_type,
+			 int lda, const void *x, enum blas_gemm_elt_type x_type,
+			 int incx);
+
+#endif /* BLAS_GEMV_COLS_H */
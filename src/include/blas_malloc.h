@@ -19,4 +19,30 @@ void blas_free(void *p);
 
 #endif
 
+/* Workspace cache behind blas_malloc and blas_free.  Freed blocks are
+   kept per thread in power-of-two size classes from 2^BLAS_WS_MIN_SHIFT
+   bytes up, and handed out again by later calls on the same thread. */
+#define BLAS_WS_MIN_SHIFT 6
+#define BLAS_WS_CLASSES 26
+
+/* A request may take a cached block up to this many classes larger
+   than its own. */
+#define BLAS_WS_SPAN 2
+
+/* Bytes a thread keeps cached unless BLAS_workspace_reserve asks for
+   more. */
+#define BLAS_WS_CACHE_MAX ((size_t) 64 << 20)
+
+/* Puts a block of at least 'bytes' in the calling thread's cache, so
+   the next request for between bytes/4 and bytes does not touch the
+   heap.  Returns 0 if it cannot be had. */
+int BLAS_workspace_reserve(size_t bytes);
+
+/* Frees the calling thread's cached blocks. */
+void BLAS_workspace_release(void);
+
+/* Calls to blas_malloc on the calling thread that were served from the
+   cache, and those that went to the heap. */
+void BLAS_workspace_counters(unsigned long *reused, unsigned long *heap);
+
 #endif
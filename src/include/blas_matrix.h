@@ -0,0 +1,108 @@
+#ifndef BLAS_MATRIX_H
+#define BLAS_MATRIX_H
+
+/* A matrix packed once for repeated products.
+
+   BLAS_matrix_create makes an empty handle for the routines of one type
+   (blas_matrix_elt_s, _d, _c or _z for the s, d, c and z routines), and
+   one of the BLAS_matrix_pack_* calls copies A into it, in the storage
+   of GEMV, GBMV, SPMV, HPMV, SBMV or HBMV.  The handle keeps op(A) with
+   its rows contiguous, the layout the _x kernels sweep fastest: dense
+   formats as a row-major matrix, band formats as a row-major band.
+   Symmetric and Hermitian matrices are expanded to both triangles, the
+   Hermitian ones with the mirrored triangle conjugated and the imaginary
+   parts of the diagonal dropped, as HPMV and HBMV read them.
+
+   A may be of the handle's type, or of a narrower one the mixed routines
+   take: float for d and c, float complex for z, double or float for z.
+   A float A for a double routine is widened to double when it is packed.
+
+   BLAS_<t>matrix_mv_x then computes y <- alpha * op(A) * x + beta * y
+   with the arguments and precisions of BLAS_<t>gemv_x, and
+   BLAS_<t>matrix_mm_x computes C <- alpha * op(A) * op(B) + beta * C,
+   C m by n, with those of BLAS_<t>gemm_x (dense formats only).  A dense
+   handle also holds op(A) in the micro-panels of the GEMM engine, one to
+   four times the memory of the row-major copy (complex float the most),
+   so that BLAS_<t>matrix_mm_x hands the engine an A it need not pack.  Both round as the routine of the packed
+   layout does, the engine included.  An op(A)
+   with no rows leaves y and C alone, and one with no columns scales
+   them by beta, which the routines themselves do not take. */
+
+#include "blas_enum.h"
+
+/* Element type of the routines a handle feeds, and of the A packed. */
+enum blas_matrix_elt_type {
+            blas_matrix_elt_s = 0,
+            blas_matrix_elt_d = 1,
+            blas_matrix_elt_c = 2,
+            blas_matrix_elt_z = 3 };
+
+struct blas_matrix;
+
+/* An empty handle for the routines of the given type, or NULL. */
+struct blas_matrix *BLAS_matrix_create(enum blas_matrix_elt_type type);
+
+/* Frees the handle and its packed copy. */
+void BLAS_matrix_destroy(struct blas_matrix *h);
+
+/* Packs A, replacing what the handle held.  The arguments describe A as
+   the routine named takes it.  Return 0, or -1 if a_type does not suit
+   the handle or memory runs out; the handle is then left empty. */
+int BLAS_matrix_pack_ge(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_trans_type trans, int m, int n,
+			const void *a, enum blas_matrix_elt_type a_type,
+			int lda);
+int BLAS_matrix_pack_gb(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_trans_type trans, int m, int n, int kl,
+			int ku, const void *a,
+			enum blas_matrix_elt_type a_type, int lda);
+int BLAS_matrix_pack_sp(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, const void *ap,
+			enum blas_matrix_elt_type a_type);
+int BLAS_matrix_pack_hp(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, const void *ap,
+			enum blas_matrix_elt_type a_type);
+int BLAS_matrix_pack_sb(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, int k,
+			const void *a, enum blas_matrix_elt_type a_type,
+			int lda);
+int BLAS_matrix_pack_hb(struct blas_matrix *h, enum blas_order_type order,
+			enum blas_uplo_type uplo, int n, int k,
+			const void *a, enum blas_matrix_elt_type a_type,
+			int lda);
+
+void BLAS_smatrix_mv_x(const struct blas_matrix *h, float alpha,
+		       const float *x, int incx, float beta, float *y,
+		       int incy, enum blas_prec_type prec);
+void BLAS_dmatrix_mv_x(const struct blas_matrix *h, double alpha,
+		       const double *x, int incx, double beta, double *y,
+		       int incy, enum blas_prec_type prec);
+void BLAS_cmatrix_mv_x(const struct blas_matrix *h, const void *alpha,
+		       const void *x, int incx, const void *beta, void *y,
+		       int incy, enum blas_prec_type prec);
+void BLAS_zmatrix_mv_x(const struct blas_matrix *h, const void *alpha,
+		       const void *x, int incx, const void *beta, void *y,
+		       int incy, enum blas_prec_type prec);
+
+void BLAS_smatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, float alpha,
+		       const float *b, int ldb, float beta, float *c,
+		       int ldc, enum blas_prec_type prec);
+void BLAS_dmatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, double alpha,
+		       const double *b, int ldb, double beta, double *c,
+		       int ldc, enum blas_prec_type prec);
+void BLAS_cmatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, const void *alpha,
+		       const void *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec);
+void BLAS_zmatrix_mm_x(const struct blas_matrix *h,
+		       enum blas_order_type order,
+		       enum blas_trans_type transb, int n, const void *alpha,
+		       const void *b, int ldb, const void *beta, void *c,
+		       int ldc, enum blas_prec_type prec);
+
+#endif /* BLAS_MATRIX_H */
@@ -0,0 +1,89 @@
+#ifndef BLAS_REPRO_H
+#define BLAS_REPRO_H
+
+/* Reproducible sums for blas_prec_reproducible.
+
+   Values are pre-rounded into bins on a fixed grid, BLAS_REPRO_WIDTH bits
+   apart, and the pieces falling into the BLAS_REPRO_FOLD bins below the
+   largest value are added exactly.  Exact sums do not depend on the
+   order of the values, so neither does the result: it is the same for
+   any vector width, block size, thread count or split of the data
+   between accumulators.
+
+   Between 80 and 120 bits below the largest value are kept, and each
+   value loses what lies below the lowest bin, at most 2^-80 times the
+   largest.  For n values v_i the result r thus satisfies
+
+     |r - SUM v_i| <= ulp(r) / 2 + n * 2^-80 * max |v_i|,
+
+   a bound relative to the largest value, not to the sum: a value more
+   than about 120 bits below the largest is dropped whole, so {2^200,
+   -2^200, 1} sums to 0.  For a dot product the v_i are the products
+   rounded to double. */
+
+/* Bins kept, and bits between neighbouring bins. */
+#define BLAS_REPRO_FOLD 3
+#define BLAS_REPRO_WIDTH 40
+
+/* Most values added to the bins between two carries.  With 40-bit bins a
+   bin sum stays exact for 2^13 values; this leaves a factor of two. */
+#define BLAS_REPRO_BLOCK 4096
+
+/* Exact sums in the bins top, top - 1, ..., each with a carry counted in
+   units of 2^52 ulps of its bin. */
+struct blas_repro_bins {
+  int top;			/* grid index of the highest bin, -1 if empty */
+  double s[BLAS_REPRO_FOLD];
+  double c[BLAS_REPRO_FOLD];
+};
+
+/* A reproducible sum in progress. */
+struct blas_repro {
+  struct blas_repro_bins lo;	/* finite values below 2^1005         */
+  struct blas_repro_bins hi;	/* finite values from 2^1005, scaled  */
+  double special;		/* sum of the infinities and NaNs, or 0 */
+};
+
+/* Pieces of v in the bins whose rounding constants are sigma[], added to
+   s[].  The scalar step of every deposit kernel. */
+static inline void blas_repro_deposit1(double v, const double *sigma,
+				       double *s)
+{
+  int k;
+
+  for (k = 0; k < BLAS_REPRO_FOLD; k++) {
+    double q = (v + sigma[k]) - sigma[k];
+
+    s[k] += q;
+    v -= q;
+  }
+}
+
+void blas_repro_init(struct blas_repro *acc);
+
+/* acc += SUM_{i<n} x[i*incx] * y[i*incy], or x[i*incx] alone when y is
+   NULL; the strides count from the pointers given, as in the kernels. */
+void blas_repro_add(struct blas_repro *acc, int n, const double *x, int incx,
+		    const double *y, int incy);
+
+/* acc += b, as if b's values had been added to acc. */
+void blas_repro_merge(struct blas_repro *acc, const struct blas_repro *b);
+
+/* The sum, rounded to double. */
+double blas_repro_value(const struct blas_repro *acc);
+
+/* SUM x[i*incx] * y[i*incy] (y may be NULL) in one call; long unit-stride
+   vectors are split over the thread pool as blas_dot_x_par does. */
+double blas_repro_dot(int n, const double *x, int incx,
+		      const double *y, int incy);
+
+/* Rows blas_repro_gemv sweeps together. */
+#define BLAS_REPRO_ROWS 64
+
+/* sum[i] <- SUM_{j<n} a[i*incai + j*incaij] * x[j*incx] for i < m: the
+   row sums of GEMV.  Matrices with contiguous columns are swept by
+   columns over blocks of rows. */
+void blas_repro_gemv(int m, int n, const double *a, int incai, int incaij,
+		     const double *x, int incx, double *sum);
+
+#endif /* BLAS_REPRO_H */
@@ -0,0 +1,87 @@
+#ifndef BLAS_SYMV_LINES_H
+#define BLAS_SYMV_LINES_H
+
+/* Single sweep of the stored triangle for the extra-precision branches
+   of SYMV, SYMV2, HEMV, HEMV2, SBMV, HBMV, SPMV and HPMV, and for the
+   double branches of SPMV and HPMV.
+
+   The row loops read every off-diagonal element twice, once along a row
+   and once, with stride lda, down a column.  Here the contiguous lines
+   of the stored triangle (columns of a column-major lower triangle, rows
+   of a row-major upper one, and so on) are read once each, in order; an
+   element a(t, j) of line j adds a(t, j) * x[j] to row t and a(t, j) *
+   x[t] to row j.  Every row still receives its terms in column order.
+   Complex A against real x, or the other way round, is swept one
+   element at a time with the products of the generated code, so its
+   sums are bitwise those of the row loops.  Real data, and complex A
+   against complex x, go up to BLAS_SYMV_DD_LINES lines at a time
+   through the vector kernels of blas_dd_vec.h, whose lanes split the
+   sums along a line the way the vector dot does.
+
+   A packed triangle is read in the order it is stored, which the row
+   loops of SPMV and HPMV only do for half of the rows: the other half
+   they take one element per packed column.  Their double branches get
+   the same sweep with the products and sums of the generated code, so
+   their sums are bitwise those of the loops. */
+
+#include "blas_enum.h"
+#include "blas_gemm_engine.h"
+
+/* Fewer rows than this stay on the reference loops. */
+#ifndef BLAS_SYMV_LINES_MIN_N
+#define BLAS_SYMV_LINES_MIN_N 8
+#endif
+
+/* Real bands with fewer off-diagonals than this stay on the reference
+   loops: their blocks of lines are too short to pay for the kernel. */
+#ifndef BLAS_SBMV_LINES_MIN_K
+#define BLAS_SBMV_LINES_MIN_K 20
+#endif
+
+/* Double-double sums s[i] = SUM_k A(i, k) * x[k] for the n by n symmetric
+   (herm == 0) or Hermitian (herm != 0) A whose uplo triangle is stored
+   in a with leading dimension lda, and x[k] at x[k*incx], counted in
+   elements of its type (x points at the first element used, and incx may
+   be negative).  A Hermitian diagonal is taken as real.  Returns a
+   blas_malloc'ed block holding head, tail for each row (head re, head
+   im, tail re, tail im when A or x is complex), to be released with
+   blas_free, or NULL when the sweep does not apply or no memory can be
+   had, so that the caller keeps to its own loops. */
+double *blas_symv_lines_x(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n,
+			  const void *a, enum blas_gemm_elt_type a_type,
+			  int lda, const void *x,
+			  enum blas_gemm_elt_type x_type, int incx);
+
+/* As blas_symv_lines_x for the band matrices of SBMV and HBMV: k
+   off-diagonals of the uplo triangle in band storage, lda >= k + 1. */
+double *blas_sbmv_lines_x(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n, int k,
+			  const void *a, enum blas_gemm_elt_type a_type,
+			  int lda, const void *x,
+			  enum blas_gemm_elt_type x_type, int incx);
+
+/* Rows of packed lines the kernel takes per call: a block of lines is
+   copied into a panel of this many rows, which stays in L1. */
+#ifndef BLAS_SPMV_LINES_MB
+#define BLAS_SPMV_LINES_MB 128
+#endif
+
+/* As blas_symv_lines_x for the packed matrices of SPMV and HPMV: the
+   uplo triangle of A packed in ap, by columns for blas_colmajor and by
+   rows for blas_rowmajor. */
+double *blas_spmv_lines_x(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n,
+			  const void *ap, enum blas_gemm_elt_type a_type,
+			  const void *x, enum blas_gemm_elt_type x_type,
+			  int incx);
+
+/* As blas_spmv_lines_x in the arithmetic of the double branches: one
+   double per row, or a (re, im) pair when A or x is complex. */
+double *blas_spmv_lines_d(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n,
+			  const void *ap, enum blas_gemm_elt_type a_type,
+			  const void *x, enum blas_gemm_elt_type x_type,
+			  int incx);
+
+#endif /* BLAS_SYMV_LINES_H */
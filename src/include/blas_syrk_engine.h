@@ -0,0 +1,51 @@
+#ifndef BLAS_SYRK_ENGINE_H
+#define BLAS_SYRK_ENGINE_H
+
+/* Rank-k and rank-2k updates of one triangle of C, behind the SYRK,
+   HERK, SYR2K and HER2K _x routines.
+
+   C is cut into column blocks of BLAS_SYRK_NB, one thread task each,
+   the tallest first.  A block covers only the rows of the triangle: the
+   tiles off the diagonal are BLAS_SYRK_MB rows high, and the diagonal
+   tile is cut into strips of BLAS_SYRK_DIAG columns that stop at the
+   diagonal, so that about half the flops of the GEMM are done.
+   Each tile goes through the packed GEMM engine into a per-worker
+   workspace that starts as beta * C, and only its triangle is written
+   back.
+
+   In blas_prec_extra the workspace keeps head and tail words, so that
+   the two products of SYR2K and HER2K are summed before C is rounded,
+   once.  The other precisions work in double, as the GEMM engine
+   does. */
+
+#include "blas_enum.h"
+#include "blas_gemm_engine.h"
+
+/* Columns of C per thread task, and rows of the tiles above or below
+   the diagonal. */
+#define BLAS_SYRK_NB 256
+#define BLAS_SYRK_MB 512
+/* Columns of the strips the diagonal tiles are cut into. */
+#define BLAS_SYRK_DIAG 32
+
+/* The uplo triangle of the n by n C <- alpha * op(A) * op(A)' + beta *
+   C when b is NULL, or alpha * op(A) * op(B)' + alpha' * op(B) *
+   op(A)' + beta * C otherwise, with op(A) and op(B) n by k.  For shape
+   blas_gemm_symmetric ' is the transpose and alpha' is alpha; for
+   blas_gemm_hermitian it is the conjugate transpose, alpha' is
+   conj(alpha), and the imaginary parts of beta and of the diagonal of
+   C are taken as zero (alpha must then be real when b is NULL).
+   trans is blas_no_trans for op(X) = X and the transpose kind of the
+   shape otherwise.  alpha and beta point to scalars of C's type.  The
+   arguments are those of the calling routine and have been checked by
+   it.  Returns 0 without touching C when no workspace can be had. */
+int blas_syrk_engine(enum blas_order_type order, enum blas_uplo_type uplo,
+		     enum blas_trans_type trans, int n, int k,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_gemm_shape shape, enum blas_prec_type prec);
+
+#endif /* BLAS_SYRK_ENGINE_H */
@@ -0,0 +1,42 @@
+#ifndef BLAS_THREADS_H
+#define BLAS_THREADS_H
+
+/* Thread pool and per-thread scratch space.
+
+   Work is split into tasks whose results do not depend on which worker
+   runs them or in what order, so a routine returns the same bits for
+   any thread count.  The pool is started on first use and its workers
+   sleep between calls. */
+
+#include <stddef.h>
+
+/* Environment variable read once for the initial thread count,
+   e.g. XBLAS_NUM_THREADS=8.  The default is 1. */
+#define BLAS_THREADS_ENV "XBLAS_NUM_THREADS"
+
+/* Upper bound on the thread count, counting the calling thread. */
+#define BLAS_MAX_THREADS 64
+
+/* Threads the routines may use; values below 1 mean 1. */
+void BLAS_set_num_threads(int nthreads);
+int BLAS_get_num_threads(void);
+
+/* Task body: 'worker' is in [0, nworkers) and no two tasks run on the
+   same worker at once, so it can index per-worker scratch space. */
+typedef void (*blas_task_fn) (void *arg, int task, int worker);
+
+/* Workers worth using for ntasks tasks, counting the caller. */
+int blas_parallel_workers(int ntasks);
+
+/* Runs fn(arg, task, worker) for every task in [0, ntasks) on up to
+   nworkers workers and returns when all are done.  A call made while
+   the pool is busy, e.g. from inside a task, runs on the caller alone. */
+void blas_parallel_for(int ntasks, int nworkers, blas_task_fn fn, void *arg);
+
+/* Scratch space of the calling thread, at least 'bytes' long.  It is
+   kept across calls, grown on demand and freed when the thread exits, so
+   routines called over and over do not allocate.  The contents last
+   until the thread's next call; NULL means no memory. */
+void *blas_thread_scratch(size_t bytes);
+
+#endif /* BLAS_THREADS_H */
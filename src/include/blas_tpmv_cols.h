@@ -0,0 +1,54 @@
+#ifndef BLAS_TPMV_COLS_H
+#define BLAS_TPMV_COLS_H
+
+/* Column sweep of a packed triangle for TPMV.
+
+   When the columns of op(T) are packed one after the other (column-major
+   without transpose, row-major with), the row loops of TPMV read each
+   row one element per packed column, across the whole of the packed
+   array.  Here the packed array is read once, column after column: a
+   lower op(T) from its first column on, an upper one from its last
+   back, which is the order in which each row adds its terms, with its
+   diagonal last.  The sums are formed from x as it is on entry and are
+   bitwise those of the row loops, which then scale them by alpha and
+   write x as before.
+
+   The extra-precision sums go through the column kernels of
+   blas_dd_vec.h, one column at a time; real T against complex x takes
+   each part of x in a pass of its own, as GEMV does.  The double sums
+   are formed with the products of the double branches. */
+
+#include "blas_enum.h"
+#include "blas_gemm_engine.h"
+
+/* Fewer rows than this stay on the reference loops. */
+#ifndef BLAS_TPMV_COLS_MIN_N
+#define BLAS_TPMV_COLS_MIN_N 8
+#endif
+
+/* Double-double sums s[i] = SUM_k op(T)(i, k) * x[k] for the n by n
+   triangular T packed in tp as order and uplo say, its diagonal taken
+   as ones when diag is blas_unit_diag, and x[k] at x[k*incx], counted
+   in elements of its type (x points at the first element used, and incx
+   may be negative).  Returns a blas_malloc'ed block holding head, tail
+   for each row (head re, head im, tail re, tail im when x is complex),
+   to be released with blas_free, or NULL when the rows of op(T) are the
+   packed lines, the problem is small, or no memory can be had, so that
+   the caller keeps to its own loops. */
+double *blas_tpmv_cols_x(enum blas_order_type order,
+			 enum blas_uplo_type uplo,
+			 enum blas_trans_type trans,
+			 enum blas_diag_type diag, int n, const void *tp,
+			 enum blas_gemm_elt_type a_type, const void *x,
+			 enum blas_gemm_elt_type x_type, int incx);
+
+/* As blas_tpmv_cols_x in the arithmetic of the double branches: one
+   double per row, or a (re, im) pair when x is complex. */
+double *blas_tpmv_cols_d(enum blas_order_type order,
+			 enum blas_uplo_type uplo,
+			 enum blas_trans_type trans,
+			 enum blas_diag_type diag, int n, const void *tp,
+			 enum blas_gemm_elt_type a_type, const void *x,
+			 enum blas_gemm_elt_type x_type, int incx);
+
+#endif /* BLAS_TPMV_COLS_H */
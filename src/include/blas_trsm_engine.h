@@ -0,0 +1,48 @@
+#ifndef BLAS_TRSM_ENGINE_H
+#define BLAS_TRSM_ENGINE_H
+
+/* Blocked triangular solve with many right-hand sides, behind the TRSM
+   _x routines.
+
+   Both sides reduce to X <- inverse(A) * X with A lower or upper
+   triangular: on the right the transposed system is solved, so the
+   rows of B are the columns of X.  X is copied, times alpha, into a
+   workspace BLAS_TRSM_NRHS columns at a time, and each such block of
+   right-hand sides reads T once.  A block is solved BLAS_TRSM_NB rows
+   at a time: the rows just solved enter the rows still to come through
+   one GEMM update on the packed engine, and only the small diagonal
+   block is solved entry by entry, its columns spread over the threads.
+
+   In blas_prec_extra X stays in double-double throughout.  The head
+   words go through the double-double GEMM kernels and the tail words
+   through the double ones, into a correction added in as each entry is
+   solved; that keeps the sums as accurate as TRSV's at about the cost
+   of one extra-precision GEMM.  The other precisions work in double,
+   as the GEMM engine does. */
+
+#include "blas_enum.h"
+#include "blas_gemm_engine.h"
+
+/* Rows of the diagonal blocks, and right-hand sides solved together. */
+#define BLAS_TRSM_NB 128
+#define BLAS_TRSM_NRHS 256
+/* Rows of a diagonal block solved entry by entry before the rest of
+   the block takes them in. */
+#define BLAS_TRSM_NB_INNER 8
+/* Columns of X per thread task in the diagonal blocks. */
+#define BLAS_TRSM_DIAG_COLS 16
+
+/* B <- alpha * inverse(op(T)) * B (left side) or alpha * B *
+   inverse(op(T)) (right side) for the m by n matrix B; alpha points to
+   a nonzero scalar of B's type.  The arguments are those of the calling
+   routine and have been checked by it.  Returns 0 without touching B
+   when no workspace can be had. */
+int blas_trsm_engine(enum blas_order_type order, enum blas_side_type side,
+		     enum blas_uplo_type uplo, enum blas_trans_type trans,
+		     enum blas_diag_type diag, int m, int n,
+		     const void *alpha,
+		     const void *t, enum blas_gemm_elt_type t_type, int ldt,
+		     void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     enum blas_prec_type prec);
+
+#endif /* BLAS_TRSM_ENGINE_H */
@@ -0,0 +1,33 @@
+#ifndef BLAS_TRSV_DD_H
+#define BLAS_TRSV_DD_H
+
+/* Blocked double-double triangular solves for the real TRSV and TBSV
+   _x routines (blas_prec_extra).
+
+   x is solved BLAS_TRSV_NB entries at a time.  The entries already
+   solved enter a block through one GEMV panel update, run by the vector
+   kernels of blas_dd_vec.h: a row dot when rows of op(T) are contiguous,
+   a column sweep that keeps a whole block of sums in registers when
+   columns are.  Only the small diagonal block is solved entry by entry.
+   The double-double copy of x lives in the calling thread's scratch
+   space, so repeated solves do not allocate. */
+
+#include "blas_enum.h"
+
+#define BLAS_TRSV_NB 64
+
+/* x <- alpha * inverse(op(T)) * x for a full triangular T (TRSV), or a
+   band one with k off-diagonals (TBSV).  The single flags say T or x
+   hold floats.  Arguments are those of the calling routine and have
+   been checked by it.  Returns 0 without touching x when no workspace
+   can be had, so that the caller falls through to its own loops. */
+int blas_trsv_dd_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, enum blas_diag_type diag,
+		   int n, double alpha, const void *t, int t_single, int ldt,
+		   void *x, int x_single, int incx);
+int blas_tbsv_dd_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, enum blas_diag_type diag,
+		   int n, int k, double alpha, const void *t, int t_single,
+		   int ldt, void *x, int x_single, int incx);
+
+#endif /* BLAS_TRSV_DD_H */
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -547,7 +548,8 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -558,6 +560,7 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	float          *y_i = (float *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval;
 	float		vecval   [2];
@@ -599,6 +602,13 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_s, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -629,33 +639,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -673,33 +688,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -727,33 +747,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -773,33 +798,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -831,33 +861,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -875,33 +910,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -929,33 +969,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -975,33 +1020,38 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)vecval[0] * matval;
-			rowtmp[1] = (double)vecval[1] * matval;
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)vecval[0] * matval;
+			  rowtmp[1] = (double)vecval[1] * matval;
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1027,6 +1077,8 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -1043,6 +1095,7 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	float          *y_i = (float *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval;
 	float		vecval   [2];
@@ -1086,6 +1139,13 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_s, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1153,198 +1213,157 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    head_tmp1[0] = head_rowsum[0];
-		    tail_tmp1[0] = tail_rowsum[0];
-		    head_tmp1[1] = head_rowsum[1];
-		    tail_tmp1[1] = tail_rowsum[1];
-		    y_i[y_index] = head_tmp1[0];
-		    y_i[y_index + 1] = head_tmp1[1];
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		    }
+		    head_tmp1[0] = head_rowsum[0];
+		    tail_tmp1[0] = tail_rowsum[0];
+		    head_tmp1[1] = head_rowsum[1];
+		    tail_tmp1[1] = tail_rowsum[1];
+		    y_i[y_index] = head_tmp1[0];
+		    y_i[y_index + 1] = head_tmp1[1];
 
 		    y_index += incy;
 		    ap_start += incap;
@@ -1357,191 +1376,150 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1685,191 +1663,150 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      double	      cd [2];
@@ -1891,20 +1828,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -1915,20 +1842,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -1974,20 +1891,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -1998,20 +1905,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -2069,191 +1966,150 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -2277,20 +2133,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -2301,20 +2147,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -2360,20 +2196,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -2384,20 +2210,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -2579,191 +2395,150 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -2780,194 +2555,153 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		{
 		  y_index = y_start;
 		  ap_start = 0;
-		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		    x_index = x_start;
-		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		    x_index = x_start;
+		    ap_index = ap_start;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -3111,191 +2845,150 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      double	      cd [2];
@@ -3317,20 +3010,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -3341,20 +3024,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -3400,20 +3073,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -3424,20 +3087,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -3495,191 +3148,150 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			head_rowtmp[0] = (double)vecval[0] * matval;
-			tail_rowtmp[0] = 0.0;
-			head_rowtmp[1] = (double)vecval[1] * matval;
-			tail_rowtmp[1] = 0.0;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowtmp[0] = (double)vecval[0] * matval;
+			  tail_rowtmp[0] = 0.0;
+			  head_rowtmp[1] = (double)vecval[1] * matval;
+			  tail_rowtmp[1] = 0.0;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -3703,20 +3315,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -3727,20 +3329,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -3786,20 +3378,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -3810,20 +3392,10 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -3999,6 +3571,7 @@ void		BLAS_cspmv_s_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
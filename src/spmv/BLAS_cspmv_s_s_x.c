@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -463,7 +464,8 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -474,6 +476,7 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = x;
 	float          *y_i = (float *)y;
 	double		rowsum;
+	double         *row_sum;
 	double		rowtmp;
 	float		matval;
 	float		vecval;
@@ -515,6 +518,13 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_s, x_i + x_start,
+				      blas_gemm_elt_s, incx);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -545,23 +555,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    tmp1[0] = rowsum;
 		    tmp1[1] = 0.0;
@@ -579,23 +593,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -623,23 +641,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    {
 		      tmp1[0] = alpha_i[0] * rowsum;
@@ -659,23 +681,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -707,23 +733,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    tmp1[0] = rowsum;
 		    tmp1[1] = 0.0;
@@ -741,23 +771,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -785,23 +819,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    {
 		      tmp1[0] = alpha_i[0] * rowsum;
@@ -821,23 +859,27 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = (double)matval *vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = (double)matval *vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -863,6 +905,8 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -879,6 +923,7 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = x;
 	float          *y_i = (float *)y;
 	double		head_rowsum, tail_rowsum;
+	double         *row_sum;
 	double		head_rowtmp, tail_rowtmp;
 	float		matval;
 	float		vecval;
@@ -922,6 +967,13 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_s, x_i + x_start,
+				      blas_gemm_elt_s, incx);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -989,83 +1041,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum;
 		    tail_tmp1[0] = tail_rowsum;
@@ -1084,83 +1117,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1303,104 +1317,75 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    {
-		      double	      head_e1, tail_e1;
-		      double	      dt;
-		      dt = (double)alpha_i[0];
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		    }
+		    {
+		      double	      head_e1, tail_e1;
+		      double	      dt;
+		      dt = (double)alpha_i[0];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -1414,20 +1399,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -1453,83 +1428,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1539,20 +1495,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[0];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -1566,20 +1512,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -1729,83 +1665,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum;
 		    tail_tmp1[0] = tail_rowsum;
@@ -1824,83 +1741,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -2043,83 +1941,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      double	      head_e1, tail_e1;
@@ -2127,20 +2006,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[0];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -2154,20 +2023,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -2193,83 +2052,64 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      head_rowtmp = (double)matval *vecval;
-		      tail_rowtmp = 0.0;
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			head_rowtmp = (double)matval *vecval;
+			tail_rowtmp = 0.0;
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -2279,20 +2119,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[0];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -2306,20 +2136,10 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      dt = (double)alpha_i[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_rowsum * split;
-			a11 = con - head_rowsum;
-			a11 = con - a11;
-			a21 = head_rowsum - a11;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_rowsum * dt;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_rowsum, dt, c11);
 
 			c2 = tail_rowsum * dt;
 			t1 = c11 + c2;
@@ -2463,6 +2283,7 @@ void		BLAS_cspmv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -579,7 +580,8 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -590,6 +592,7 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	float          *y_i = (float *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -631,6 +634,13 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -661,35 +671,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -707,35 +722,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -763,35 +783,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -811,35 +836,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -871,35 +901,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -917,35 +952,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -973,35 +1013,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -1021,35 +1066,40 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1075,6 +1125,8 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -1091,6 +1143,7 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	float          *y_i = (float *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -1134,6 +1187,13 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -1201,263 +1261,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -1477,263 +1496,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1877,263 +1855,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      double	      cd [2];
@@ -2155,20 +2092,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -2179,20 +2106,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -2238,20 +2155,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -2262,20 +2169,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -2333,263 +2230,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -2613,20 +2469,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -2637,20 +2483,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -2696,20 +2532,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -2720,20 +2546,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -2915,263 +2731,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -3183,271 +2958,230 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    y_index += incy;
 		    ap_start += (matrix_row + 1) * incap;
 		  }
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		    x_index = x_start;
-		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		    x_index = x_start;
+		    ap_index = ap_start;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -3591,263 +3325,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      double	      cd [2];
@@ -3869,20 +3562,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -3893,20 +3576,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -3952,20 +3625,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -3976,20 +3639,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -4047,263 +3700,222 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
 			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -4327,20 +3939,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* real part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			  c2 = tail_a0 * cd[0];
 			  t1 = c11 + c2;
@@ -4351,20 +3953,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			  c2 = tail_a1 * cd[1];
 			  t1 = c11 + c2;
@@ -4410,20 +4002,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			/* imaginary part */
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = cd[0] * split;
-			  b1 = con - cd[0];
-			  b1 = con - b1;
-			  b2 = cd[0] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * cd[0];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			  c2 = tail_a1 * cd[0];
 			  t1 = c11 + c2;
@@ -4434,20 +4016,10 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			}
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = cd[1] * split;
-			  b1 = con - cd[1];
-			  b1 = con - b1;
-			  b2 = cd[1] - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * cd[1];
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			  c2 = tail_a0 * cd[1];
 			  t1 = c11 + c2;
@@ -4623,6 +4195,7 @@ void		BLAS_cspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -66,6 +68,7 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = x;
 	double         *y_i = y;
 	double		rowsum;
+	double         *row_sum;
 	double		rowtmp;
 	double		matval;
 	double		vecval;
@@ -107,6 +110,13 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (alpha_i != 0.0)
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_d, x_i + x_start,
+				      blas_gemm_elt_d, incx);
+
 	if (alpha_i == 0.0) {
 	  {
 	    y_index = y_start;
@@ -132,23 +142,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    tmp1 = rowsum;
 		    y_i[y_index] = tmp1;
@@ -164,23 +178,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    resval = y_i[y_index];
 		    tmp1 = rowsum;
@@ -201,23 +219,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    tmp1 = rowsum * alpha_i;
 		    y_i[y_index] = tmp1;
@@ -233,23 +255,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
 		    }
 		    resval = y_i[y_index];
 		    tmp1 = rowsum * alpha_i;
@@ -272,23 +298,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    tmp1 = rowsum;
 		    y_i[y_index] = tmp1;
@@ -304,23 +334,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    resval = y_i[y_index];
 		    tmp1 = rowsum;
@@ -341,23 +375,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    tmp1 = rowsum * alpha_i;
 		    y_i[y_index] = tmp1;
@@ -373,23 +411,27 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum = 0.0;
-		    rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      rowtmp = matval * vecval;
-		      rowsum = rowsum + rowtmp;
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
+		    if (row_sum != NULL) {
+		      rowsum = row_sum[matrix_row];
+		    } else {
+		      rowsum = 0.0;
+		      rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			rowtmp = matval * vecval;
+			rowsum = rowsum + rowtmp;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
 		    }
 		    resval = y_i[y_index];
 		    tmp1 = rowsum * alpha_i;
@@ -406,6 +448,8 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -422,6 +466,7 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = x;
 	double         *y_i = y;
 	double		head_rowsum, tail_rowsum;
+	double         *row_sum;
 	double		head_rowtmp, tail_rowtmp;
 	double		matval;
 	double		vecval;
@@ -465,6 +510,13 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (alpha_i != 0.0)
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_d, x_i + x_start,
+				      blas_gemm_elt_d, incx);
+
 	if (alpha_i == 0.0) {
 	  {
 	    y_index = y_start;
@@ -473,19 +525,8 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = beta_i * split;
-		a1 = con - beta_i;
-		a1 = con - a1;
-		a2 = beta_i - a1;
-		con = resval * split;
-		b1 = con - resval;
-		b1 = con - b1;
-		b2 = resval - b1;
-
 		head_tmp2 = beta_i * resval;
-		tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_tmp2 = BLAS_TWO_PROD_ERR(beta_i, resval, head_tmp2);
 	      }
 
 	      y_i[y_index] = head_tmp2;
@@ -505,111 +546,70 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    head_tmp1 = head_rowsum;
 		    tail_tmp1 = tail_rowsum;
@@ -626,130 +626,78 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval = y_i[y_index];
 		    head_tmp1 = head_rowsum;
 		    tail_tmp1 = tail_rowsum;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = beta_i * split;
-		      a1 = con - beta_i;
-		      a1 = con - a1;
-		      a2 = beta_i - a1;
-		      con = resval * split;
-		      b1 = con - resval;
-		      b1 = con - b1;
-		      b2 = resval - b1;
-
 		      head_tmp2 = beta_i * resval;
-		      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_tmp2 = BLAS_TWO_PROD_ERR(beta_i, resval, head_tmp2);
 		    }
 		    {
 		      /*
@@ -796,128 +744,77 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_rowsum * split;
-		      a11 = con - head_rowsum;
-		      a11 = con - a11;
-		      a21 = head_rowsum - a11;
-		      con = alpha_i * split;
-		      b1 = con - alpha_i;
-		      b1 = con - b1;
-		      b2 = alpha_i - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_rowsum * alpha_i;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		      c2 = tail_rowsum * alpha_i;
 		      t1 = c11 + c2;
@@ -939,129 +836,78 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval = y_i[y_index];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_rowsum * split;
-		      a11 = con - head_rowsum;
-		      a11 = con - a11;
-		      a21 = head_rowsum - a11;
-		      con = alpha_i * split;
-		      b1 = con - alpha_i;
-		      b1 = con - b1;
-		      b2 = alpha_i - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_rowsum * alpha_i;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		      c2 = tail_rowsum * alpha_i;
 		      t1 = c11 + c2;
@@ -1072,19 +918,8 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = beta_i * split;
-		      a1 = con - beta_i;
-		      a1 = con - a1;
-		      a2 = beta_i - a1;
-		      con = resval * split;
-		      b1 = con - resval;
-		      b1 = con - b1;
-		      b2 = resval - b1;
-
 		      head_tmp2 = beta_i * resval;
-		      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_tmp2 = BLAS_TWO_PROD_ERR(beta_i, resval, head_tmp2);
 		    }
 		    {
 		      /*
@@ -1133,111 +968,70 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    head_tmp1 = head_rowsum;
 		    tail_tmp1 = tail_rowsum;
@@ -1254,130 +1048,78 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval = y_i[y_index];
 		    head_tmp1 = head_rowsum;
 		    tail_tmp1 = tail_rowsum;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = beta_i * split;
-		      a1 = con - beta_i;
-		      a1 = con - a1;
-		      a2 = beta_i - a1;
-		      con = resval * split;
-		      b1 = con - resval;
-		      b1 = con - b1;
-		      b2 = resval - b1;
-
 		      head_tmp2 = beta_i * resval;
-		      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_tmp2 = BLAS_TWO_PROD_ERR(beta_i, resval, head_tmp2);
 		    }
 		    {
 		      /*
@@ -1424,128 +1166,77 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_rowsum * split;
-		      a11 = con - head_rowsum;
-		      a11 = con - a11;
-		      a21 = head_rowsum - a11;
-		      con = alpha_i * split;
-		      b1 = con - alpha_i;
-		      b1 = con - b1;
-		      b2 = alpha_i - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_rowsum * alpha_i;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		      c2 = tail_rowsum * alpha_i;
 		      t1 = c11 + c2;
@@ -1567,129 +1258,78 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum = tail_rowsum = 0.0;
-		    head_rowtmp = tail_rowtmp = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    if (row_sum != NULL) {
+		      head_rowsum = row_sum[2 * matrix_row];
+		      tail_rowsum = row_sum[2 * matrix_row + 1];
+		    } else {
+		      head_rowsum = tail_rowsum = 0.0;
+		      head_rowtmp = tail_rowtmp = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
+		      for (step = matrix_row; step < n; step++) {
+			matval = ap_i[ap_index];
+			vecval = x_i[x_index];
+			{
+			  /* Compute double_double = double * double. */
+			  head_rowtmp = matval * vecval;
+			  tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+			}
+			{
+			  /* Compute double-double = double-double + double-double,
+			     renormalizing once. */
+			  double		bv;
+			  double		s1     , s2;
+
+			  /* Add two hi words. */
+			  s1 = head_rowsum + head_rowtmp;
+			  bv = s1 - head_rowsum;
+			  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+			  /* Add the lo words to the error. */
+			  s2 += tail_rowsum + tail_rowtmp;
+
+			  /* Renormalize (s1, s2)  */
+			  head_rowsum = s1 + s2;
+			  tail_rowsum = s2 - (head_rowsum - s1);
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval = ap_i[ap_index];
-		      vecval = x_i[x_index];
-		      {
-			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = matval * split;
-			a1 = con - matval;
-			a1 = con - a1;
-			a2 = matval - a1;
-			con = vecval * split;
-			b1 = con - vecval;
-			b1 = con - b1;
-			b2 = vecval - b1;
-
-			head_rowtmp = matval * vecval;
-			tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
-		      }
-		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
-			double		bv;
-			double		s1     , s2, t1, t2;
-
-			/* Add two hi words. */
-			s1 = head_rowsum + head_rowtmp;
-			bv = s1 - head_rowsum;
-			s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-			/* Add two lo words. */
-			t1 = tail_rowsum + tail_rowtmp;
-			bv = t1 - tail_rowsum;
-			t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_rowsum = t1 + t2;
-			tail_rowsum = t2 - (head_rowsum - t1);
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval = y_i[y_index];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_rowsum * split;
-		      a11 = con - head_rowsum;
-		      a11 = con - a11;
-		      a21 = head_rowsum - a11;
-		      con = alpha_i * split;
-		      b1 = con - alpha_i;
-		      b1 = con - b1;
-		      b2 = alpha_i - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_rowsum * alpha_i;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		      c2 = tail_rowsum * alpha_i;
 		      t1 = c11 + c2;
@@ -1700,19 +1340,8 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = beta_i * split;
-		      a1 = con - beta_i;
-		      a1 = con - a1;
-		      a2 = beta_i - a1;
-		      con = resval * split;
-		      b1 = con - resval;
-		      b1 = con - b1;
-		      b2 = resval - b1;
-
 		      head_tmp2 = beta_i * resval;
-		      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_tmp2 = BLAS_TWO_PROD_ERR(beta_i, resval, head_tmp2);
 		    }
 		    {
 		      /*
@@ -1755,6 +1384,7 @@ void		BLAS_dspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
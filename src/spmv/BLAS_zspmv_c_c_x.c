@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -66,6 +68,7 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -107,6 +110,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -137,35 +147,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -183,35 +198,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -239,35 +259,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -287,35 +312,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -347,35 +377,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -393,35 +428,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -449,35 +489,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -497,35 +542,40 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
-		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -551,6 +601,8 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -567,6 +619,7 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	float		matval   [2];
 	float		vecval   [2];
@@ -610,6 +663,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_c, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -624,35 +684,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -688,35 +726,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -767,263 +783,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -1043,263 +1018,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1317,35 +1251,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -1384,35 +1296,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -1542,263 +1432,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      /*
@@ -1816,20 +1665,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -1840,20 +1679,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -1899,20 +1728,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -1923,20 +1742,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -1993,263 +1802,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -2269,20 +2037,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -2293,20 +2051,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -2352,20 +2100,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -2376,20 +2114,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -2442,35 +2170,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -2509,35 +2215,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -2669,263 +2353,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -2945,263 +2588,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -3219,35 +2821,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -3286,35 +2866,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -3444,263 +3002,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      /*
@@ -3718,20 +3235,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -3742,20 +3249,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -3801,20 +3298,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -3825,20 +3312,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -3895,263 +3372,222 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  double		head_e1, tail_e1;
+			  double		d1;
+			  double		d2;
+			  /* Real part */
+			  d1 = (double)matval[0] * vecval[0];
+			  d2 = (double)-matval[1] * vecval[1];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[0] = head_e1;
+			  tail_rowtmp[0] = tail_e1;
+			  /* imaginary part */
+			  d1 = (double)matval[0] * vecval[1];
+			  d2 = (double)matval[1] * vecval[0];
+			  {
+			    /* Compute double-double = double + double. */
+			    double	  e     , t1, t2;
+
+			    /* Knuth trick. */
+			    t1 = d1 + d2;
+			    e = t1 - d1;
+			    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			    /* The result is t1 + t2, after normalization. */
+			    head_e1 = t1 + t2;
+			    tail_e1 = t2 - (head_e1 - t1);
+			  }
+			  head_rowtmp[1] = head_e1;
+			  tail_rowtmp[1] = tail_e1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		head_e1, tail_e1;
-			double		d1;
-			double		d2;
-			/* Real part */
-			d1 = (double)matval[0] * vecval[0];
-			d2 = (double)-matval[1] * vecval[1];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[0] = head_e1;
-			tail_rowtmp[0] = tail_e1;
-			/* imaginary part */
-			d1 = (double)matval[0] * vecval[1];
-			d2 = (double)matval[1] * vecval[0];
-			{
-			  /* Compute double-double = double + double. */
-			  double	  e     , t1, t2;
-
-			  /* Knuth trick. */
-			  t1 = d1 + d2;
-			  e = t1 - d1;
-			  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-			  /* The result is t1 + t2, after normalization. */
-			  head_e1 = t1 + t2;
-			  tail_e1 = t2 - (head_e1 - t1);
-			}
-			head_rowtmp[1] = head_e1;
-			tail_rowtmp[1] = tail_e1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -4171,20 +3607,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -4195,20 +3621,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -4254,20 +3670,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -4278,20 +3684,10 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -4344,35 +3740,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -4411,35 +3785,13 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -4565,6 +3917,7 @@ void		BLAS_zspmv_c_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
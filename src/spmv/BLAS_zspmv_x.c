@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -66,6 +68,7 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = (double *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		matval  [2];
 	double		vecval  [2];
@@ -107,6 +110,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_z, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -137,35 +147,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -183,35 +198,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -239,35 +259,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -287,35 +312,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -347,35 +377,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -393,35 +428,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -449,35 +489,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -497,35 +542,40 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -551,6 +601,8 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -567,6 +619,7 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *x_i = (double *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		matval  [2];
 	double		vecval  [2];
@@ -610,6 +663,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_z, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -624,35 +684,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -688,35 +726,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -767,461 +783,284 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -1241,461 +1080,284 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1713,35 +1375,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -1780,35 +1420,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -1938,461 +1556,284 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
+			  /*
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
+			   */
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      /*
@@ -2410,20 +1851,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -2434,20 +1865,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -2493,20 +1914,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -2517,20 +1928,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -2587,461 +1988,284 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -3061,20 +2285,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -3085,20 +2299,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -3144,20 +2348,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -3168,20 +2362,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -3234,35 +2418,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -3301,35 +2463,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -3461,935 +2601,581 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
-		    }
-		    head_tmp1[0] = head_rowsum[0];
-		    tail_tmp1[0] = tail_rowsum[0];
-		    head_tmp1[1] = head_rowsum[1];
-		    tail_tmp1[1] = tail_rowsum[1];
-		    y_i[y_index] = head_tmp1[0];
-		    y_i[y_index + 1] = head_tmp1[1];
-
-		    y_index += incy;
-		    ap_start += (matrix_row + 1) * incap;
-		  }
-		}
-	      } else {
-		{
-		  y_index = y_start;
-		  ap_start = 0;
-		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
-		    x_index = x_start;
-		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
+			   */
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
+		      }
+		    }
+		    head_tmp1[0] = head_rowsum[0];
+		    tail_tmp1[0] = tail_rowsum[0];
+		    head_tmp1[1] = head_rowsum[1];
+		    tail_tmp1[1] = tail_rowsum[1];
+		    y_i[y_index] = head_tmp1[0];
+		    y_i[y_index + 1] = head_tmp1[1];
 
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		    y_index += incy;
+		    ap_start += (matrix_row + 1) * incap;
+		  }
+		}
+	      } else {
+		{
+		  y_index = y_start;
+		  ap_start = 0;
+		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
+		    x_index = x_start;
+		    ap_index = ap_start;
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
+		      }
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  /*
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
+			   */
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -4407,35 +3193,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -4474,35 +3238,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -4632,461 +3374,284 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      /*
@@ -5104,20 +3669,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5128,20 +3683,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5187,20 +3732,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5211,20 +3746,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5281,461 +3806,284 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			/*
-			 * Compute complex-extra = complex-double *
-			 * complex-double.
-			 */
-			double		head_t1, tail_t1;
-			double		head_t2, tail_t2;
-			/* Real part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[0] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[1] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			head_t2 = -head_t2;
-			tail_t2 = -tail_t2;
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[0] = head_t1;
-			tail_rowtmp[0] = tail_t1;
-			/* Imaginary part */
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[1] * split;
-			  a1 = con - matval[1];
-			  a1 = con - a1;
-			  a2 = matval[1] - a1;
-			  con = vecval[0] * split;
-			  b1 = con - vecval[0];
-			  b1 = con - b1;
-			  b2 = vecval[0] - b1;
-
-			  head_t1 = matval[1] * vecval[0];
-			  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
-			{
-			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = matval[0] * split;
-			  a1 = con - matval[0];
-			  a1 = con - a1;
-			  a2 = matval[0] - a1;
-			  con = vecval[1] * split;
-			  b1 = con - vecval[1];
-			  b1 = con - b1;
-			  b2 = vecval[1] - b1;
-
-			  head_t2 = matval[0] * vecval[1];
-			  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			}
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_t1 + head_t2;
-			  bv = s1 - head_t1;
-			  s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_t1 + tail_t2;
-			  bv = t1 - tail_t1;
-			  t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t1 = t1 + t2;
-			  tail_t1 = t2 - (head_t1 - t1);
-			}
-			head_rowtmp[1] = head_t1;
-			tail_rowtmp[1] = tail_t1;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
 			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
+			   * Compute complex-extra = complex-double *
+			   * complex-double.
 			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			  double		head_t1, tail_t1;
+			  double		head_t2, tail_t2;
+			  /* Real part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[0] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[1] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+			  }
+			  head_t2 = -head_t2;
+			  tail_t2 = -tail_t2;
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[0] = head_t1;
+			  tail_rowtmp[0] = tail_t1;
+			  /* Imaginary part */
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t1 = matval[1] * vecval[0];
+			    tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+			  }
+			  {
+			    /* Compute double_double = double * double. */
+			    head_t2 = matval[0] * vecval[1];
+			    tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+			  }
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_t1 + head_t2;
+			    bv = s1 - head_t1;
+			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_t1 + tail_t2;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t1 = s1 + s2;
+			    tail_t1 = s2 - (head_t1 - s1);
+			  }
+			  head_rowtmp[1] = head_t1;
+			  tail_rowtmp[1] = tail_t1;
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
+			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
+
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
+			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -5755,20 +4103,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5779,20 +4117,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5838,20 +4166,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5862,20 +4180,10 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5928,35 +4236,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -5995,35 +4281,13 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -6149,6 +4413,7 @@ void		BLAS_zspmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 
 /*
  * Purpose
@@ -55,7 +56,8 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 	int		matrix_row, step, ap_index, ap_start, x_index, x_start;
 	int		y_start   , y_index, incap;
@@ -66,6 +68,7 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		matval  [2];
 	float		vecval   [2];
@@ -107,6 +110,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incy == 0) {
 	  BLAS_error(routine_name, -10, incy, NULL);
 	}
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_d(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -137,35 +147,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -183,35 +198,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -239,35 +259,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -287,35 +312,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -347,35 +377,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    tmp1[0] = rowsum[0];
 		    tmp1[1] = rowsum[1];
@@ -393,35 +428,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -449,35 +489,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      tmp1[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -497,35 +542,40 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    rowsum[0] = rowsum[1] = 0.0;
-		    rowtmp[0] = rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    if (row_sum != NULL) {
+		      rowsum[0] = row_sum[2 * matrix_row];
+		      rowsum[1] = row_sum[2 * matrix_row + 1];
+		    } else {
+		      rowsum[0] = rowsum[1] = 0.0;
+		      rowtmp[0] = rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-			rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
+			{
+			  rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+			  rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+			}
+			rowsum[0] = rowsum[0] + rowtmp[0];
+			rowsum[1] = rowsum[1] + rowtmp[1];
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      rowsum[0] = rowsum[0] + rowtmp[0];
-		      rowsum[1] = rowsum[1] + rowtmp[1];
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -551,6 +601,8 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -567,6 +619,7 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *x_i = (float *)x;
 	double         *y_i = (double *)y;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		matval  [2];
 	float		vecval   [2];
@@ -610,6 +663,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
 	FPU_FIX_START;
 
+	/* One sweep of the packed triangle into row sums. */
+	row_sum = NULL;
+	if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	  row_sum = blas_spmv_lines_x(order, uplo, 0, n, ap_i,
+				      blas_gemm_elt_z, x_i + x_start,
+				      blas_gemm_elt_c, incx / 2);
+
 	if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	  {
 	    y_index = y_start;
@@ -624,35 +684,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[0] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[1] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -688,35 +726,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[1] * split;
-		  a1 = con - beta_i[1];
-		  a1 = con - a1;
-		  a2 = beta_i[1] - a1;
-		  con = resval[0] * split;
-		  b1 = con - resval[0];
-		  b1 = con - b1;
-		  b2 = resval[0] - b1;
-
 		  head_t1 = beta_i[1] * resval[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = beta_i[0] * split;
-		  a1 = con - beta_i[0];
-		  a1 = con - a1;
-		  a2 = beta_i[0] - a1;
-		  con = resval[1] * split;
-		  b1 = con - resval[1];
-		  b1 = con - b1;
-		  b2 = resval[1] - b1;
-
 		  head_t2 = beta_i[0] * resval[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -767,471 +783,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -1251,471 +1090,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
-			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -1733,35 +1395,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -1800,35 +1440,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -1958,471 +1576,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    {
 		      /*
@@ -2440,20 +1881,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -2464,20 +1895,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -2523,20 +1944,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -2547,20 +1958,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -2617,471 +2018,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += (n - step - 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (n - step - 1) * incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
-
-			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
-			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			    /* Add two hi words. */
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
+
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
+			  }
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      ap_index += incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -3101,20 +2325,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -3125,20 +2339,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -3184,20 +2388,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -3208,20 +2402,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -3274,35 +2458,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -3341,35 +2503,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -3501,471 +2641,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    head_tmp1[0] = head_rowsum[0];
 		    tail_tmp1[0] = tail_rowsum[0];
@@ -3985,471 +2948,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -4467,35 +3253,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -4534,35 +3298,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -4692,471 +3434,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
-
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    t2 += s2;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    {
 		      /*
@@ -5174,20 +3739,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5198,20 +3753,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5257,20 +3802,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5281,20 +3816,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5351,471 +3876,294 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  for (matrix_row = 0; matrix_row < n; matrix_row++) {
 		    x_index = x_start;
 		    ap_index = ap_start;
-		    head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-		    head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-		    for (step = 0; step < matrix_row; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
+		    if (row_sum != NULL) {
+		      head_rowsum[0] = row_sum[4 * matrix_row];
+		      head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		      tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		      tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+		    } else {
+		      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		      for (step = 0; step < matrix_row; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
-			  /* Real part */
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
 			  {
 			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
 			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
+			}
+			{
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
+			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
+			  {
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
+			ap_index += incap;
+			x_index += incx;
 		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
+		      for (step = matrix_row; step < n; step++) {
+			matval[0] = ap_i[ap_index];
+			matval[1] = ap_i[ap_index + 1];
+			vecval[0] = x_i[x_index];
+			vecval[1] = x_i[x_index + 1];
 			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  double		cd      [2];
+			  cd[0] = (double)vecval[0];
+			  cd[1] = (double)vecval[1];
+			  {
+			    /*
+			     * Compute complex-extra = complex-double *
+			     * complex-double.
+			     */
+			    double	  head_t1, tail_t1;
+			    double	  head_t2, tail_t2;
+			    /* Real part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[0] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[1] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], cd[1], head_t2);
+			    }
+			    head_t2 = -head_t2;
+			    tail_t2 = -tail_t2;
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[0] = head_t1;
+			    tail_rowtmp[0] = tail_t1;
+			    /* Imaginary part */
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t1 = matval[1] * cd[0];
+			      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], cd[0], head_t1);
+			    }
+			    {
+			      /* Compute double_double = double * double. */
+			      head_t2 = matval[0] * cd[1];
+			      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], cd[1], head_t2);
+			    }
+			    {
+			      /* Compute double-double = double-double + double-double,
+				 renormalizing once. */
+			      double	    bv;
+			      double	    s1  , s2;
+
+			      /* Add two hi words. */
+			      s1 = head_t1 + head_t2;
+			      bv = s1 - head_t1;
+			      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			      /* Add the lo words to the error. */
+			      s2 += tail_t1 + tail_t2;
+
+			      /* Renormalize (s1, s2)  */
+			      head_t1 = s1 + s2;
+			      tail_t1 = s2 - (head_t1 - s1);
+			    }
+			    head_rowtmp[1] = head_t1;
+			    tail_rowtmp[1] = tail_t1;
+			  }
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
-		      }
-		      ap_index += incap;
-		      x_index += incx;
-		    }
-		    for (step = matrix_row; step < n; step++) {
-		      matval[0] = ap_i[ap_index];
-		      matval[1] = ap_i[ap_index + 1];
-		      vecval[0] = x_i[x_index];
-		      vecval[1] = x_i[x_index + 1];
-		      {
-			double		cd      [2];
-			cd[0] = (double)vecval[0];
-			cd[1] = (double)vecval[1];
 			{
-			  /*
-			   * Compute complex-extra = complex-double *
-			   * complex-double.
-			   */
-			  double	  head_t1, tail_t1;
-			  double	  head_t2, tail_t2;
+			  double		head_t , tail_t;
+			  double		head_a , tail_a;
+			  double		head_b , tail_b;
 			  /* Real part */
+			  head_a = head_rowsum[0];
+			  tail_a = tail_rowsum[0];
+			  head_b = head_rowtmp[0];
+			  tail_b = tail_rowtmp[0];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[0] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[1] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  head_t2 = -head_t2;
-			  tail_t2 = -tail_t2;
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			    s2 += t1;
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[0] = head_t1;
-			  tail_rowtmp[0] = tail_t1;
+			  head_rowsum[0] = head_t;
+			  tail_rowsum[0] = tail_t;
 			  /* Imaginary part */
+			  head_a = head_rowsum[1];
+			  tail_a = tail_rowsum[1];
+			  head_b = head_rowtmp[1];
+			  tail_b = tail_rowtmp[1];
 			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[1] * split;
-			    a1 = con - matval[1];
-			    a1 = con - a1;
-			    a2 = matval[1] - a1;
-			    con = cd[0] * split;
-			    b1 = con - cd[0];
-			    b1 = con - b1;
-			    b2 = cd[0] - b1;
-
-			    head_t1 = matval[1] * cd[0];
-			    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /* Compute double_double = double * double. */
-			    double	    a1  , a2, b1, b2, con;
-
-			    con = matval[0] * split;
-			    a1 = con - matval[0];
-			    a1 = con - a1;
-			    a2 = matval[0] - a1;
-			    con = cd[1] * split;
-			    b1 = con - cd[1];
-			    b1 = con - b1;
-			    b2 = cd[1] - b1;
-
-			    head_t2 = matval[0] * cd[1];
-			    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-			  }
-			  {
-			    /*
-			     * Compute double-double = double-double +
-			     * double-double.
-			     */
-			    double	    bv;
-			    double	    s1  , s2, t1, t2;
+			    /* Compute double-double = double-double + double-double,
+			       renormalizing once. */
+			    double	  bv;
+			    double	  s1    , s2;
 
 			    /* Add two hi words. */
-			    s1 = head_t1 + head_t2;
-			    bv = s1 - head_t1;
-			    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-			    /* Add two lo words. */
-			    t1 = tail_t1 + tail_t2;
-			    bv = t1 - tail_t1;
-			    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+			    s1 = head_a + head_b;
+			    bv = s1 - head_a;
+			    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-			    s2 += t1;
+			    /* Add the lo words to the error. */
+			    s2 += tail_a + tail_b;
 
-			    /* Renormalize (s1, s2)  to  (t1, s2) */
-			    t1 = s1 + s2;
-			    s2 = s2 - (t1 - s1);
-
-			    t2 += s2;
-
-			    /* Renormalize (t1, t2)  */
-			    head_t1 = t1 + t2;
-			    tail_t1 = t2 - (head_t1 - t1);
+			    /* Renormalize (s1, s2)  */
+			    head_t = s1 + s2;
+			    tail_t = s2 - (head_t - s1);
 			  }
-			  head_rowtmp[1] = head_t1;
-			  tail_rowtmp[1] = tail_t1;
-			}
-		      }
-		      {
-			double		head_t , tail_t;
-			double		head_a , tail_a;
-			double		head_b , tail_b;
-			/* Real part */
-			head_a = head_rowsum[0];
-			tail_a = tail_rowsum[0];
-			head_b = head_rowtmp[0];
-			tail_b = tail_rowtmp[0];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
-			}
-			head_rowsum[0] = head_t;
-			tail_rowsum[0] = tail_t;
-			/* Imaginary part */
-			head_a = head_rowsum[1];
-			tail_a = tail_rowsum[1];
-			head_b = head_rowtmp[1];
-			tail_b = tail_rowtmp[1];
-			{
-			  /*
-			   * Compute double-double = double-double +
-			   * double-double.
-			   */
-			  double	  bv;
-			  double	  s1    , s2, t1, t2;
-
-			  /* Add two hi words. */
-			  s1 = head_a + head_b;
-			  bv = s1 - head_a;
-			  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-			  /* Add two lo words. */
-			  t1 = tail_a + tail_b;
-			  bv = t1 - tail_a;
-			  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-			  s2 += t1;
-
-			  /* Renormalize (s1, s2)  to  (t1, s2) */
-			  t1 = s1 + s2;
-			  s2 = s2 - (t1 - s1);
-
-			  t2 += s2;
-
-			  /* Renormalize (t1, t2)  */
-			  head_t = t1 + t2;
-			  tail_t = t2 - (head_t - t1);
+			  head_rowsum[1] = head_t;
+			  tail_rowsum[1] = tail_t;
 			}
-			head_rowsum[1] = head_t;
-			tail_rowsum[1] = tail_t;
+			ap_index += (step + 1) * incap;
+			x_index += incx;
 		      }
-		      ap_index += (step + 1) * incap;
-		      x_index += incx;
 		    }
 		    resval[0] = y_i[y_index];
 		    resval[1] = y_i[y_index + 1];
@@ -5835,20 +4183,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 			c2 = tail_a0 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5859,20 +4197,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 			c2 = tail_a1 * alpha_i[1];
 			t1 = c11 + c2;
@@ -5918,20 +4246,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = alpha_i[0] * split;
-			b1 = con - alpha_i[0];
-			b1 = con - b1;
-			b2 = alpha_i[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * alpha_i[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 			c2 = tail_a1 * alpha_i[0];
 			t1 = c11 + c2;
@@ -5942,20 +4260,10 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = alpha_i[1] * split;
-			b1 = con - alpha_i[1];
-			b1 = con - b1;
-			b2 = alpha_i[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * alpha_i[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 			c2 = tail_a0 * alpha_i[1];
 			t1 = c11 + c2;
@@ -6008,35 +4316,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Real part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[0] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[1] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], resval[1], head_t2);
 		      }
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
@@ -6075,35 +4361,13 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* Imaginary part */
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[1] * split;
-			a1 = con - beta_i[1];
-			a1 = con - a1;
-			a2 = beta_i[1] - a1;
-			con = resval[0] * split;
-			b1 = con - resval[0];
-			b1 = con - b1;
-			b2 = resval[0] - b1;
-
 			head_t1 = beta_i[1] * resval[0];
-			tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], resval[0], head_t1);
 		      }
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = beta_i[0] * split;
-			a1 = con - beta_i[0];
-			a1 = con - a1;
-			a2 = beta_i[0] - a1;
-			con = resval[1] * split;
-			b1 = con - resval[1];
-			b1 = con - b1;
-			b2 = resval[1] - b1;
-
 			head_t2 = beta_i[0] * resval[1];
-			tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], resval[1], head_t2);
 		      }
 		      {
 			/*
@@ -6229,6 +4493,7 @@ void		BLAS_zspmv_z_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }			/* if order == ... */
 	}			/* alpha != 0 */
 
+	blas_free(row_sum);
 	FPU_FIX_STOP;
       }
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 void		BLAS_csum_x(int n, const void *x, int incx,
 		  		void         *sum, enum blas_prec_type prec)
 /*
@@ -38,6 +39,7 @@ void		BLAS_csum_x(int n, const void *x, int incx,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , xi;
@@ -110,50 +112,55 @@ void		BLAS_csum_x(int n, const void *x, int incx,
       else
 	xi = 0;
 
-      for (i = 0; i < n; i++, xi += incx) {
-	x_elem[0] = x_i[xi];
-	x_elem[1] = x_i[xi + 1];
-	{
-	  double	  cd     [2];
-	  cd[0] = (double)x_elem[0];
-	  cd[1] = (double)x_elem[1];
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 2 && blas_dd_vec_enabled()) {
+	blas_sum_x_kernel(n, x_i, 1, 1, head_tmp, tail_tmp);
+      } else {
+	for (i = 0; i < n; i++, xi += incx) {
+	  x_elem[0] = x_i[xi];
+	  x_elem[1] = x_i[xi + 1];
 	  {
-	    double	    head_t, tail_t;
-	    double	    head_a, tail_a;
-	    head_a = head_tmp[0];
-	    tail_a = tail_tmp[0];
+	    double	  cd     [2];
+	    cd[0] = (double)x_elem[0];
+	    cd[1] = (double)x_elem[1];
 	    {
-	      /* Compute double-double = double-double + double. */
-	      double	      e , t1, t2;
-
-	      /* Knuth trick. */
-	      t1 = head_a + cd[0];
-	      e = t1 - head_a;
-	      t2 = ((cd[0] - e) + (head_a - (t1 - e))) + tail_a;
-
-	      /* The result is t1 + t2, after normalization. */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
-	    }
-	    head_tmp[0] = head_t;
-	    tail_tmp[0] = tail_t;
-	    head_a = head_tmp[1];
-	    tail_a = tail_tmp[1];
-	    {
-	      /* Compute double-double = double-double + double. */
-	      double	      e , t1, t2;
-
-	      /* Knuth trick. */
-	      t1 = head_a + cd[1];
-	      e = t1 - head_a;
-	      t2 = ((cd[1] - e) + (head_a - (t1 - e))) + tail_a;
-
-	      /* The result is t1 + t2, after normalization. */
-	      head_t = t1 + t2;
-	      tail_t = t2 - (head_t - t1);
+	      double	    head_t, tail_t;
+	      double	    head_a, tail_a;
+	      head_a = head_tmp[0];
+	      tail_a = tail_tmp[0];
+	      {
+		/* Compute double-double = double-double + double. */
+		double	      e , t1, t2;
+
+		/* Knuth trick. */
+		t1 = head_a + cd[0];
+		e = t1 - head_a;
+		t2 = ((cd[0] - e) + (head_a - (t1 - e))) + tail_a;
+
+		/* The result is t1 + t2, after normalization. */
+		head_t = t1 + t2;
+		tail_t = t2 - (head_t - t1);
+	      }
+	      head_tmp[0] = head_t;
+	      tail_tmp[0] = tail_t;
+	      head_a = head_tmp[1];
+	      tail_a = tail_tmp[1];
+	      {
+		/* Compute double-double = double-double + double. */
+		double	      e , t1, t2;
+
+		/* Knuth trick. */
+		t1 = head_a + cd[1];
+		e = t1 - head_a;
+		t2 = ((cd[1] - e) + (head_a - (t1 - e))) + tail_a;
+
+		/* The result is t1 + t2, after normalization. */
+		head_t = t1 + t2;
+		tail_t = t2 - (head_t - t1);
+	      }
+	      head_tmp[1] = head_t;
+	      tail_tmp[1] = tail_t;
 	    }
-	    head_tmp[1] = head_t;
-	    tail_tmp[1] = tail_t;
 	  }
 	}
       }
@@ -1,5 +1,7 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
+#include "blas_repro.h"
 void		BLAS_dsum_x(int n, const double *x, int incx,
 		  		double       *sum, enum blas_prec_type prec)
 /*
@@ -31,6 +33,9 @@ void		BLAS_dsum_x(int n, const double *x, int incx,
  *        = blas_prec_extra : anything at least 1.5 times as accurate
  *                            than double, and wider than 80-bits.
  *                            We use double-double in our implementation.
+ *        = blas_prec_reproducible: double precision, summed so that
+ *                            the result is bitwise the same for any
+ *                            vector width, blocking or thread count.
  *
   */ 
 {
@@ -66,9 +71,14 @@ void		BLAS_dsum_x(int n, const double *x, int incx,
       else
 	xi = 0;
 
-      for (i = 0; i < n; i++, xi += incx) {
-	x_elem = x_i[xi];
-	tmp = tmp + x_elem;
+      /* Long vectors are reduced in fixed chunks on the thread pool. */
+      if (incx == 1 && n >= BLAS_DD_PAR_MIN) {
+	blas_sum_x_par(n, x_i, 0, 0, &tmp, NULL);
+      } else {
+	for (i = 0; i < n; i++, xi += incx) {
+	  x_elem = x_i[xi];
+	  tmp = tmp + x_elem;
+	}
       }
       *sum = tmp;
 
@@ -107,20 +117,28 @@ void		BLAS_dsum_x(int n, const double *x, int incx,
       else
 	xi = 0;
 
-      for (i = 0; i < n; i++, xi += incx) {
-	x_elem = x_i[xi];
-	{
-	  /* Compute double-double = double-double + double. */
-	  double	  e     , t1, t2;
-
-	  /* Knuth trick. */
-	  t1 = head_tmp + x_elem;
-	  e = t1 - head_tmp;
-	  t2 = ((x_elem - e) + (head_tmp - (t1 - e))) + tail_tmp;
-
-	  /* The result is t1 + t2, after normalization. */
-	  head_tmp = t1 + t2;
-	  tail_tmp = t2 - (head_tmp - t1);
+      /* Unit stride goes through the vector kernel, long vectors in
+	   fixed chunks on the thread pool. */
+      if (incx == 1 && n >= BLAS_DD_PAR_MIN) {
+	blas_sum_x_par(n, x_i, 0, 0, &head_tmp, &tail_tmp);
+      } else if (incx == 1 && blas_dd_vec_enabled()) {
+	blas_sum_x_kernel(n, x_i, 0, 0, &head_tmp, &tail_tmp);
+      } else {
+	for (i = 0; i < n; i++, xi += incx) {
+	  x_elem = x_i[xi];
+	  {
+	    /* Compute double-double = double-double + double. */
+	    double	  e     , t1, t2;
+
+	    /* Knuth trick. */
+	    t1 = head_tmp + x_elem;
+	    e = t1 - head_tmp;
+	    t2 = ((x_elem - e) + (head_tmp - (t1 - e))) + tail_tmp;
+
+	    /* The result is t1 + t2, after normalization. */
+	    head_tmp = t1 + t2;
+	    tail_tmp = t2 - (head_tmp - t1);
+	  }
 	}
       }
       *sum = head_tmp;
@@ -128,5 +146,32 @@ void		BLAS_dsum_x(int n, const double *x, int incx,
       FPU_FIX_STOP;
     }
     break;
+  case blas_prec_reproducible:
+    {
+      int	      xi = 0;
+      FPU_FIX_DECL;
+
+      /* Test the input parameters. */
+      if (n < 0)
+	BLAS_error(routine_name, -1, n, NULL);
+      if (incx == 0)
+	BLAS_error(routine_name, -3, incx, NULL);
+
+      /* Immediate return. */
+      if (n <= 0) {
+	*sum = 0.0;
+	return;
+      }
+      FPU_FIX_START;
+
+      if (incx < 0)
+	xi = -(n - 1) * incx;
+
+      /* Binned sum. */
+      *sum = blas_repro_dot(n, x + xi, incx, NULL, 0);
+
+      FPU_FIX_STOP;
+    }
+    break;
   }
 }
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 void		BLAS_ssum_x(int n, const float *x, int incx,
 		  		float        *sum, enum blas_prec_type prec)
 /*
@@ -38,6 +39,7 @@ void		BLAS_ssum_x(int n, const float *x, int incx,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , xi;
@@ -107,23 +109,28 @@ void		BLAS_ssum_x(int n, const float *x, int incx,
       else
 	xi = 0;
 
-      for (i = 0; i < n; i++, xi += incx) {
-	x_elem = x_i[xi];
-	{
-	  double	  dt = (double)x_elem;
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 1 && blas_dd_vec_enabled()) {
+	blas_sum_x_kernel(n, x_i, 1, 0, &head_tmp, &tail_tmp);
+      } else {
+	for (i = 0; i < n; i++, xi += incx) {
+	  x_elem = x_i[xi];
 	  {
-	    /* Compute double-double = double-double + double. */
-	    double	    e   , t1, t2;
-
-	    /* Knuth trick. */
-	    t1 = head_tmp + dt;
-	    e = t1 - head_tmp;
-	    t2 = ((dt - e) + (head_tmp - (t1 - e))) + tail_tmp;
-
-	    /* The result is t1 + t2, after normalization. */
-	    head_tmp = t1 + t2;
-	    tail_tmp = t2 - (head_tmp - t1);
-	  };
+	    double	  dt = (double)x_elem;
+	    {
+	      /* Compute double-double = double-double + double. */
+	      double	    e   , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = head_tmp + dt;
+	      e = t1 - head_tmp;
+	      t2 = ((dt - e) + (head_tmp - (t1 - e))) + tail_tmp;
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_tmp = t1 + t2;
+	      tail_tmp = t2 - (head_tmp - t1);
+	    };
+	  }
 	}
       }
       *sum = head_tmp;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
 void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	     		enum		blas_uplo_type uplo, int m, int n,
 		   		double	alpha , const double *a, int lda,
@@ -67,10 +68,17 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
  *
  */
 {
+  /* Large problems go through the packed engine. */
+  if (blas_symm_engine(order, side, uplo, m, n, &alpha,
+		       a, blas_gemm_elt_d, lda, b, blas_gemm_elt_d, ldb,
+		       &beta, c, blas_gemm_elt_d, ldc, prec))
+    return;
+
   switch (prec) {
 
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       /* Integer Index Variables */
@@ -385,19 +393,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	    c_elem = c_i[cij];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = c_elem * split;
-	      a1 = con - c_elem;
-	      a1 = con - a1;
-	      a2 = c_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp1 = c_elem * beta_i;
-	      tail_tmp1 = (((a1 * b1 - head_tmp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp1 = BLAS_TWO_PROD_ERR(c_elem, beta_i, head_tmp1);
 	    }
 	    c_i[cij] = head_tmp1;
 	  }
@@ -420,19 +417,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 		b_elem = b_i[bkj];
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem * split;
-		  b1 = con - b_elem;
-		  b1 = con - b1;
-		  b2 = b_elem - b1;
-
 		  head_prod = a_elem * b_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -467,19 +453,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 		b_elem = b_i[bkj];
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem * split;
-		  b1 = con - b_elem;
-		  b1 = con - b1;
-		  b2 = b_elem - b1;
-
 		  head_prod = a_elem * b_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -530,19 +505,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 		b_elem = b_i[bkj];
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem * split;
-		  b1 = con - b_elem;
-		  b1 = con - b1;
-		  b2 = b_elem - b1;
-
 		  head_prod = a_elem * b_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -577,19 +541,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 		b_elem = b_i[bkj];
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = a_elem * split;
-		  a1 = con - a_elem;
-		  a1 = con - a1;
-		  a2 = a_elem - a1;
-		  con = b_elem * split;
-		  b1 = con - b_elem;
-		  b1 = con - b1;
-		  b2 = b_elem - b1;
-
 		  head_prod = a_elem * b_elem;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -622,19 +575,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	      c_elem = c_i[cij];
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = c_elem * split;
-		a1 = con - c_elem;
-		a1 = con - a1;
-		a2 = c_elem - a1;
-		con = beta_i * split;
-		b1 = con - beta_i;
-		b1 = con - b1;
-		b2 = beta_i - b1;
-
 		head_tmp2 = c_elem * beta_i;
-		tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_tmp2 = BLAS_TWO_PROD_ERR(c_elem, beta_i, head_tmp2);
 	      }
 	      head_tmp1 = head_sum;
 	      tail_tmp1 = tail_sum;
@@ -687,19 +629,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	      b_elem = b_i[bkj];
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem * split;
-		a1 = con - a_elem;
-		a1 = con - a1;
-		a2 = a_elem - a1;
-		con = b_elem * split;
-		b1 = con - b_elem;
-		b1 = con - b1;
-		b2 = b_elem - b1;
-
 		head_prod = a_elem * b_elem;
-		tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -734,19 +665,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	      b_elem = b_i[bkj];
 	      {
 		/* Compute double_double = double * double. */
-		double		a1     , a2, b1, b2, con;
-
-		con = a_elem * split;
-		a1 = con - a_elem;
-		a1 = con - a1;
-		a2 = a_elem - a1;
-		con = b_elem * split;
-		b1 = con - b_elem;
-		b1 = con - b1;
-		b2 = b_elem - b1;
-
 		head_prod = a_elem * b_elem;
-		tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		tail_prod = BLAS_TWO_PROD_ERR(a_elem, b_elem, head_prod);
 	      }
 	      {
 		/* Compute double-double = double-double + double-double. */
@@ -778,19 +698,10 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	    }
 	    {
 	      /* Compute double-double = double-double * double. */
-	      double	      a11, a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	      con = head_sum * split;
-	      a11 = con - head_sum;
-	      a11 = con - a11;
-	      a21 = head_sum - a11;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
+	      double	      c11, c21, c2, t1, t2;
 
 	      c11 = head_sum * alpha_i;
-	      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	      c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 	      c2 = tail_sum * alpha_i;
 	      t1 = c11 + c2;
@@ -802,19 +713,8 @@ void		BLAS_dsymm_x(enum blas_order_type order, enum blas_side_type side,
 	    c_elem = c_i[cij];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = c_elem * split;
-	      a1 = con - c_elem;
-	      a1 = con - a1;
-	      a2 = c_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp2 = c_elem * beta_i;
-	      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp2 = BLAS_TWO_PROD_ERR(c_elem, beta_i, head_tmp2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   		int		n       , const void *alpha, const void *a, int lda,
 	  		const		void  *x, int incx, const void *beta,
@@ -311,6 +312,7 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       /* Integer Index Variables */
@@ -581,6 +583,7 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       double	      head_sum[2], tail_sum[2];
       double	      head_tmp1[2], tail_tmp1[2];
       double	      head_tmp2[2], tail_tmp2[2];
+      double         *row_sum;
 
       FPU_FIX_DECL;
 
@@ -634,6 +637,13 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored triangle into row sums. */
+      row_sum = NULL;
+      if (!(alpha_i[0] == 0.0 && alpha_i[1] == 0.0))
+	row_sum = blas_symv_lines_x(order, uplo, 0, n, a_i, blas_gemm_elt_c,
+				    lda, x_i + x_starti, blas_gemm_elt_c,
+				    incx / 2);
+
       /* alpha = 0.  In this case, just return beta * y */
       if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
 	for (i = 0, yi = y_starti;
@@ -692,247 +702,218 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
 	  for (i = 0, yi = y_starti, astarti = 0;
 	       i < n_i; i++, yi += incy, astarti += incai) {
-	    head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	    for (k = 0, aik = astarti, xi = x_starti; k < i;
-		 k++, aik += incaik, xi += incx) {
-	      a_elem[0] = a_i[aik];
-	      a_elem[1] = a_i[aik + 1];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
+	    if (row_sum != NULL) {
+	      head_sum[0] = row_sum[4 * i];
+	      head_sum[1] = row_sum[4 * i + 1];
+	      tail_sum[0] = row_sum[4 * i + 2];
+	      tail_sum[1] = row_sum[4 * i + 3];
+	    } else {
+	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+	      for (k = 0, aik = astarti, xi = x_starti; k < i;
+		   k++, aik += incaik, xi += incx) {
+		a_elem[0] = a_i[aik];
+		a_elem[1] = a_i[aik + 1];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
 		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sum[0];
+		  tail_a = tail_sum[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[0] = head_t;
+		  tail_sum[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sum[1];
+		  tail_a = tail_sum[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[1] = head_t;
+		  tail_sum[1] = tail_t;
 		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
 	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
+	      for (; k < n_i; k++, aik += incaik2, xi += incx) {
+		a_elem[0] = a_i[aik];
+		a_elem[1] = a_i[aik + 1];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
 		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sum[0];
+		  tail_a = tail_sum[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[0] = head_t;
+		  tail_sum[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sum[1];
+		  tail_a = tail_sum[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[1] = head_t;
+		  tail_sum[1] = tail_t;
 		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	    }
-	    for (; k < n_i; k++, aik += incaik2, xi += incx) {
-	      a_elem[0] = a_i[aik];
-	      a_elem[1] = a_i[aik + 1];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
 	      }
 	    }
 	    y_i[yi] = head_sum[0];
@@ -944,394 +925,230 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	   * y
 	   */
 	  for (i = 0, yi = y_starti, astarti = 0;
-	       i < n_i; i++, yi += incy, astarti += incai) {
-	    head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	    for (k = 0, aik = astarti, xi = x_starti;
-		 k < i; k++, aik += incaik, xi += incx) {
-	      a_elem[0] = a_i[aik];
-	      a_elem[1] = a_i[aik + 1];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	    }
-	    for (; k < n_i; k++, aik += incaik2, xi += incx) {
-	      a_elem[0] = a_i[aik];
-	      a_elem[1] = a_i[aik + 1];
-	      x_elem[0] = x_i[xi];
-	      x_elem[1] = x_i[xi + 1];
-	      {
-		double		head_e1, tail_e1;
-		double		d1;
-		double		d2;
-		/* Real part */
-		d1 = (double)a_elem[0] * x_elem[0];
-		d2 = (double)-a_elem[1] * x_elem[1];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[0] = head_e1;
-		tail_prod[0] = tail_e1;
-		/* imaginary part */
-		d1 = (double)a_elem[0] * x_elem[1];
-		d2 = (double)a_elem[1] * x_elem[0];
-		{
-		  /* Compute double-double = double + double. */
-		  double	  e     , t1, t2;
-
-		  /* Knuth trick. */
-		  t1 = d1 + d2;
-		  e = t1 - d1;
-		  t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		  /* The result is t1 + t2, after normalization. */
-		  head_e1 = t1 + t2;
-		  tail_e1 = t2 - (head_e1 - t1);
-		}
-		head_prod[1] = head_e1;
-		tail_prod[1] = tail_e1;
-	      }
-	      {
-		double		head_t , tail_t;
-		double		head_a , tail_a;
-		double		head_b , tail_b;
-		/* Real part */
-		head_a = head_sum[0];
-		tail_a = tail_sum[0];
-		head_b = head_prod[0];
-		tail_b = tail_prod[0];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[0] = head_t;
-		tail_sum[0] = tail_t;
-		/* Imaginary part */
-		head_a = head_sum[1];
-		tail_a = tail_sum[1];
-		head_b = head_prod[1];
-		tail_b = tail_prod[1];
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_a + head_b;
-		  bv = s1 - head_a;
-		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_a + tail_b;
-		  bv = t1 - tail_a;
-		  t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_t = t1 + t2;
-		  tail_t = t2 - (head_t - t1);
-		}
-		head_sum[1] = head_t;
-		tail_sum[1] = tail_t;
-	      }
-	    }
-	    y_elem[0] = y_i[yi];
-	    y_elem[1] = y_i[yi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)y_elem[0] * beta_i[0];
-	      d2 = (double)-y_elem[1] * beta_i[1];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_tmp2[0] = head_e1;
-	      tail_tmp2[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)y_elem[0] * beta_i[1];
-	      d2 = (double)y_elem[1] * beta_i[0];
-	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
-
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
-	      }
-	      head_tmp2[1] = head_e1;
-	      tail_tmp2[1] = tail_e1;
-	    }
-	    head_tmp1[0] = head_sum[0];
-	    tail_tmp1[0] = tail_sum[0];
-	    head_tmp1[1] = head_sum[1];
-	    tail_tmp1[1] = tail_sum[1];
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_tmp2[0];
-	      tail_a = tail_tmp2[0];
-	      head_b = head_tmp1[0];
-	      tail_b = tail_tmp1[0];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_tmp1[0] = head_t;
-	      tail_tmp1[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_tmp2[1];
-	      tail_a = tail_tmp2[1];
-	      head_b = head_tmp1[1];
-	      tail_b = tail_tmp1[1];
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
-	      }
-	      head_tmp1[1] = head_t;
-	      tail_tmp1[1] = tail_t;
-	    }
-	    y_i[yi] = head_tmp1[0];
-	    y_i[yi + 1] = head_tmp1[1];
-	  }
-	}
-
-      } else {
-	/* The most general form,   y <--- alpha * A * x + beta * y */
-	for (i = 0, yi = y_starti, astarti = 0;
-	     i < n_i; i++, yi += incy, astarti += incai) {
-	  head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
-
-	  for (k = 0, aik = astarti, xi = x_starti;
-	       k < i; k++, aik += incaik, xi += incx) {
-	    a_elem[0] = a_i[aik];
-	    a_elem[1] = a_i[aik + 1];
-	    x_elem[0] = x_i[xi];
-	    x_elem[1] = x_i[xi + 1];
+	       i < n_i; i++, yi += incy, astarti += incai) {
+	    if (row_sum != NULL) {
+	      head_sum[0] = row_sum[4 * i];
+	      head_sum[1] = row_sum[4 * i + 1];
+	      tail_sum[0] = row_sum[4 * i + 2];
+	      tail_sum[1] = row_sum[4 * i + 3];
+	    } else {
+	      head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+	      for (k = 0, aik = astarti, xi = x_starti;
+		   k < i; k++, aik += incaik, xi += incx) {
+		a_elem[0] = a_i[aik];
+		a_elem[1] = a_i[aik + 1];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		{
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sum[0];
+		  tail_a = tail_sum[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[0] = head_t;
+		  tail_sum[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sum[1];
+		  tail_a = tail_sum[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[1] = head_t;
+		  tail_sum[1] = tail_t;
+		}
+	      }
+	      for (; k < n_i; k++, aik += incaik2, xi += incx) {
+		a_elem[0] = a_i[aik];
+		a_elem[1] = a_i[aik + 1];
+		x_elem[0] = x_i[xi];
+		x_elem[1] = x_i[xi + 1];
+		{
+		  double		head_e1, tail_e1;
+		  double		d1;
+		  double		d2;
+		  /* Real part */
+		  d1 = (double)a_elem[0] * x_elem[0];
+		  d2 = (double)-a_elem[1] * x_elem[1];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[0] = head_e1;
+		  tail_prod[0] = tail_e1;
+		  /* imaginary part */
+		  d1 = (double)a_elem[0] * x_elem[1];
+		  d2 = (double)a_elem[1] * x_elem[0];
+		  {
+		    /* Compute double-double = double + double. */
+		    double	  e     , t1, t2;
+
+		    /* Knuth trick. */
+		    t1 = d1 + d2;
+		    e = t1 - d1;
+		    t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		    /* The result is t1 + t2, after normalization. */
+		    head_e1 = t1 + t2;
+		    tail_e1 = t2 - (head_e1 - t1);
+		  }
+		  head_prod[1] = head_e1;
+		  tail_prod[1] = tail_e1;
+		}
+		{
+		  double		head_t , tail_t;
+		  double		head_a , tail_a;
+		  double		head_b , tail_b;
+		  /* Real part */
+		  head_a = head_sum[0];
+		  tail_a = tail_sum[0];
+		  head_b = head_prod[0];
+		  tail_b = tail_prod[0];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[0] = head_t;
+		  tail_sum[0] = tail_t;
+		  /* Imaginary part */
+		  head_a = head_sum[1];
+		  tail_a = tail_sum[1];
+		  head_b = head_prod[1];
+		  tail_b = tail_prod[1];
+		  {
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_a + head_b;
+		    bv = s1 - head_a;
+		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
+
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
+		  }
+		  head_sum[1] = head_t;
+		  tail_sum[1] = tail_t;
+		}
+	      }
+	    }
+	    y_elem[0] = y_i[yi];
+	    y_elem[1] = y_i[yi + 1];
 	    {
 	      double	      head_e1, tail_e1;
 	      double	      d1;
 	      double	      d2;
 	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
+	      d1 = (double)y_elem[0] * beta_i[0];
+	      d2 = (double)-y_elem[1] * beta_i[1];
 	      {
 		/* Compute double-double = double + double. */
 		double		e      , t1, t2;
@@ -1345,11 +1162,11 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_e1 = t1 + t2;
 		tail_e1 = t2 - (head_e1 - t1);
 	      }
-	      head_prod[0] = head_e1;
-	      tail_prod[0] = tail_e1;
+	      head_tmp2[0] = head_e1;
+	      tail_tmp2[0] = tail_e1;
 	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
+	      d1 = (double)y_elem[0] * beta_i[1];
+	      d2 = (double)y_elem[1] * beta_i[0];
 	      {
 		/* Compute double-double = double + double. */
 		double		e      , t1, t2;
@@ -1363,18 +1180,22 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_e1 = t1 + t2;
 		tail_e1 = t2 - (head_e1 - t1);
 	      }
-	      head_prod[1] = head_e1;
-	      tail_prod[1] = tail_e1;
+	      head_tmp2[1] = head_e1;
+	      tail_tmp2[1] = tail_e1;
 	    }
+	    head_tmp1[0] = head_sum[0];
+	    tail_tmp1[0] = tail_sum[0];
+	    head_tmp1[1] = head_sum[1];
+	    tail_tmp1[1] = tail_sum[1];
 	    {
 	      double	      head_t, tail_t;
 	      double	      head_a, tail_a;
 	      double	      head_b, tail_b;
 	      /* Real part */
-	      head_a = head_sum[0];
-	      tail_a = tail_sum[0];
-	      head_b = head_prod[0];
-	      tail_b = tail_prod[0];
+	      head_a = head_tmp2[0];
+	      tail_a = tail_tmp2[0];
+	      head_b = head_tmp1[0];
+	      tail_b = tail_tmp1[0];
 	      {
 		/* Compute double-double = double-double + double-double. */
 		double		bv;
@@ -1402,13 +1223,13 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_t = t1 + t2;
 		tail_t = t2 - (head_t - t1);
 	      }
-	      head_sum[0] = head_t;
-	      tail_sum[0] = tail_t;
+	      head_tmp1[0] = head_t;
+	      tail_tmp1[0] = tail_t;
 	      /* Imaginary part */
-	      head_a = head_sum[1];
-	      tail_a = tail_sum[1];
-	      head_b = head_prod[1];
-	      tail_b = tail_prod[1];
+	      head_a = head_tmp2[1];
+	      tail_a = tail_tmp2[1];
+	      head_b = head_tmp1[1];
+	      tail_b = tail_tmp1[1];
 	      {
 		/* Compute double-double = double-double + double-double. */
 		double		bv;
@@ -1436,128 +1257,230 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_t = t1 + t2;
 		tail_t = t2 - (head_t - t1);
 	      }
-	      head_sum[1] = head_t;
-	      tail_sum[1] = tail_t;
+	      head_tmp1[1] = head_t;
+	      tail_tmp1[1] = tail_t;
 	    }
+	    y_i[yi] = head_tmp1[0];
+	    y_i[yi + 1] = head_tmp1[1];
 	  }
-	  for (; k < n_i; k++, aik += incaik2, xi += incx) {
-	    a_elem[0] = a_i[aik];
-	    a_elem[1] = a_i[aik + 1];
-	    x_elem[0] = x_i[xi];
-	    x_elem[1] = x_i[xi + 1];
-	    {
-	      double	      head_e1, tail_e1;
-	      double	      d1;
-	      double	      d2;
-	      /* Real part */
-	      d1 = (double)a_elem[0] * x_elem[0];
-	      d2 = (double)-a_elem[1] * x_elem[1];
+	}
+
+      } else {
+	/* The most general form,   y <--- alpha * A * x + beta * y */
+	for (i = 0, yi = y_starti, astarti = 0;
+	     i < n_i; i++, yi += incy, astarti += incai) {
+	  if (row_sum != NULL) {
+	    head_sum[0] = row_sum[4 * i];
+	    head_sum[1] = row_sum[4 * i + 1];
+	    tail_sum[0] = row_sum[4 * i + 2];
+	    tail_sum[1] = row_sum[4 * i + 3];
+	  } else {
+	    head_sum[0] = head_sum[1] = tail_sum[0] = tail_sum[1] = 0.0;
+
+	    for (k = 0, aik = astarti, xi = x_starti;
+		 k < i; k++, aik += incaik, xi += incx) {
+	      a_elem[0] = a_i[aik];
+	      a_elem[1] = a_i[aik + 1];
+	      x_elem[0] = x_i[xi];
+	      x_elem[1] = x_i[xi + 1];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
 
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod[0] = head_e1;
+		tail_prod[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
+
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod[1] = head_e1;
+		tail_prod[1] = tail_e1;
 	      }
-	      head_prod[0] = head_e1;
-	      tail_prod[0] = tail_e1;
-	      /* imaginary part */
-	      d1 = (double)a_elem[0] * x_elem[1];
-	      d2 = (double)a_elem[1] * x_elem[0];
 	      {
-		/* Compute double-double = double + double. */
-		double		e      , t1, t2;
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum[0];
+		tail_a = tail_sum[0];
+		head_b = head_prod[0];
+		tail_b = tail_prod[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
 
-		/* Knuth trick. */
-		t1 = d1 + d2;
-		e = t1 - d1;
-		t2 = ((d2 - e) + (d1 - (t1 - e)));
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		/* The result is t1 + t2, after normalization. */
-		head_e1 = t1 + t2;
-		tail_e1 = t2 - (head_e1 - t1);
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum[0] = head_t;
+		tail_sum[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum[1];
+		tail_a = tail_sum[1];
+		head_b = head_prod[1];
+		tail_b = tail_prod[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
+
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum[1] = head_t;
+		tail_sum[1] = tail_t;
 	      }
-	      head_prod[1] = head_e1;
-	      tail_prod[1] = tail_e1;
 	    }
-	    {
-	      double	      head_t, tail_t;
-	      double	      head_a, tail_a;
-	      double	      head_b, tail_b;
-	      /* Real part */
-	      head_a = head_sum[0];
-	      tail_a = tail_sum[0];
-	      head_b = head_prod[0];
-	      tail_b = tail_prod[0];
+	    for (; k < n_i; k++, aik += incaik2, xi += incx) {
+	      a_elem[0] = a_i[aik];
+	      a_elem[1] = a_i[aik + 1];
+	      x_elem[0] = x_i[xi];
+	      x_elem[1] = x_i[xi + 1];
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		double	      head_e1, tail_e1;
+		double	      d1;
+		double	      d2;
+		/* Real part */
+		d1 = (double)a_elem[0] * x_elem[0];
+		d2 = (double)-a_elem[1] * x_elem[1];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
 
-		s2 += t1;
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod[0] = head_e1;
+		tail_prod[0] = tail_e1;
+		/* imaginary part */
+		d1 = (double)a_elem[0] * x_elem[1];
+		d2 = (double)a_elem[1] * x_elem[0];
+		{
+		  /* Compute double-double = double + double. */
+		  double		e      , t1, t2;
 
-		t2 += s2;
+		  /* Knuth trick. */
+		  t1 = d1 + d2;
+		  e = t1 - d1;
+		  t2 = ((d2 - e) + (d1 - (t1 - e)));
 
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
+		  /* The result is t1 + t2, after normalization. */
+		  head_e1 = t1 + t2;
+		  tail_e1 = t2 - (head_e1 - t1);
+		}
+		head_prod[1] = head_e1;
+		tail_prod[1] = tail_e1;
 	      }
-	      head_sum[0] = head_t;
-	      tail_sum[0] = tail_t;
-	      /* Imaginary part */
-	      head_a = head_sum[1];
-	      tail_a = tail_sum[1];
-	      head_b = head_prod[1];
-	      tail_b = tail_prod[1];
 	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
+		double	      head_t, tail_t;
+		double	      head_a, tail_a;
+		double	      head_b, tail_b;
+		/* Real part */
+		head_a = head_sum[0];
+		tail_a = tail_sum[0];
+		head_b = head_prod[0];
+		tail_b = tail_prod[0];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
 
-		/* Add two hi words. */
-		s1 = head_a + head_b;
-		bv = s1 - head_a;
-		s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		/* Add two lo words. */
-		t1 = tail_a + tail_b;
-		bv = t1 - tail_a;
-		t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
 
-		s2 += t1;
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum[0] = head_t;
+		tail_sum[0] = tail_t;
+		/* Imaginary part */
+		head_a = head_sum[1];
+		tail_a = tail_sum[1];
+		head_b = head_prod[1];
+		tail_b = tail_prod[1];
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
+		  /* Add two hi words. */
+		  s1 = head_a + head_b;
+		  bv = s1 - head_a;
+		  s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		t2 += s2;
+		  /* Add the lo words to the error. */
+		  s2 += tail_a + tail_b;
 
-		/* Renormalize (t1, t2)  */
-		head_t = t1 + t2;
-		tail_t = t2 - (head_t - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_t = s1 + s2;
+		  tail_t = s2 - (head_t - s1);
+		}
+		head_sum[1] = head_t;
+		tail_sum[1] = tail_t;
 	      }
-	      head_sum[1] = head_t;
-	      tail_sum[1] = tail_t;
 	    }
 	  }
 	  y_elem[0] = y_i[yi];
@@ -1620,19 +1543,10 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      /* real part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = cd[0] * split;
-		b1 = con - cd[0];
-		b1 = con - b1;
-		b2 = cd[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * cd[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		c2 = tail_a0 * cd[0];
 		t1 = c11 + c2;
@@ -1643,19 +1557,10 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = cd[1] * split;
-		b1 = con - cd[1];
-		b1 = con - b1;
-		b2 = cd[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * cd[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		c2 = tail_a1 * cd[1];
 		t1 = c11 + c2;
@@ -1698,19 +1603,10 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      /* imaginary part */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a1 * split;
-		a11 = con - head_a1;
-		a11 = con - a11;
-		a21 = head_a1 - a11;
-		con = cd[0] * split;
-		b1 = con - cd[0];
-		b1 = con - b1;
-		b2 = cd[0] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a1 * cd[0];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		c2 = tail_a1 * cd[0];
 		t1 = c11 + c2;
@@ -1721,19 +1617,10 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_a0 * split;
-		a11 = con - head_a0;
-		a11 = con - a11;
-		a21 = head_a0 - a11;
-		con = cd[1] * split;
-		b1 = con - cd[1];
-		b1 = con - b1;
-		b2 = cd[1] - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_a0 * cd[1];
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		c2 = tail_a0 * cd[1];
 		t1 = c11 + c2;
@@ -1852,6 +1739,7 @@ void		BLAS_csymv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
       }
 
+      blas_free(row_sum);
       FPU_FIX_STOP;
 
       break;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_symv_lines.h"
 void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		       		int		n       , double alpha, const float *a, int lda,
 		   		const		float *x, int incx, double beta,
@@ -65,6 +66,7 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       /* Integer Index Variables */
@@ -277,6 +279,7 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
       double	      head_sum, tail_sum;
       double	      head_tmp1, tail_tmp1;
       double	      head_tmp2, tail_tmp2;
+      double         *row_sum;
 
       FPU_FIX_DECL;
 
@@ -330,6 +333,13 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
       FPU_FIX_START;
 
+      /* One sweep of the stored triangle into row sums. */
+      row_sum = NULL;
+      if (alpha_i != 0.0)
+	row_sum = blas_symv_lines_x(order, uplo, 0, n, a_i, blas_gemm_elt_s,
+				    lda, x_i + x_starti, blas_gemm_elt_s,
+				    incx);
+
       /* alpha = 0.  In this case, just return beta * y */
       if (alpha_i == 0.0) {
 	for (i = 0, yi = y_starti;
@@ -337,19 +347,8 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  y_elem = y_i[yi];
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = y_elem * split;
-	    a1 = con - y_elem;
-	    a1 = con - a1;
-	    a2 = y_elem - a1;
-	    con = beta_i * split;
-	    b1 = con - beta_i;
-	    b1 = con - b1;
-	    b2 = beta_i - b1;
-
 	    head_tmp1 = y_elem * beta_i;
-	    tail_tmp1 = (((a1 * b1 - head_tmp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_tmp1 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp1);
 	  }
 	  y_i[yi] = head_tmp1;
 	}
@@ -361,73 +360,60 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  /* Case alpha = 1, beta = 0.  We compute  y <--- A * x */
 	  for (i = 0, yi = y_starti, astarti = 0;
 	       i < n_i; i++, yi += incy, astarti += incai) {
-	    head_sum = tail_sum = 0.0;
-
-	    for (k = 0, aik = astarti, xi = x_starti; k < i;
-		 k++, aik += incaik, xi += incx) {
-	      a_elem = a_i[aik];
-	      x_elem = x_i[xi];
-	      head_prod = (double)a_elem *x_elem;
-	      tail_prod = 0.0;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+	    if (row_sum != NULL) {
+	      head_sum = row_sum[2 * i];
+	      tail_sum = row_sum[2 * i + 1];
+	    } else {
+	      head_sum = tail_sum = 0.0;
+
+	      for (k = 0, aik = astarti, xi = x_starti; k < i;
+		   k++, aik += incaik, xi += incx) {
+		a_elem = a_i[aik];
+		x_elem = x_i[xi];
+		head_prod = (double)a_elem *x_elem;
+		tail_prod = 0.0;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
 	      }
-	    }
-	    for (; k < n_i; k++, aik += incaik2, xi += incx) {
-	      a_elem = a_i[aik];
-	      x_elem = x_i[xi];
-	      head_prod = (double)a_elem *x_elem;
-	      tail_prod = 0.0;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+	      for (; k < n_i; k++, aik += incaik2, xi += incx) {
+		a_elem = a_i[aik];
+		x_elem = x_i[xi];
+		head_prod = (double)a_elem *x_elem;
+		tail_prod = 0.0;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
 	      }
 	    }
 	    y_i[yi] = head_sum;
@@ -439,91 +425,67 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	   */
 	  for (i = 0, yi = y_starti, astarti = 0;
 	       i < n_i; i++, yi += incy, astarti += incai) {
-	    head_sum = tail_sum = 0.0;
-
-	    for (k = 0, aik = astarti, xi = x_starti;
-		 k < i; k++, aik += incaik, xi += incx) {
-	      a_elem = a_i[aik];
-	      x_elem = x_i[xi];
-	      head_prod = (double)a_elem *x_elem;
-	      tail_prod = 0.0;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+	    if (row_sum != NULL) {
+	      head_sum = row_sum[2 * i];
+	      tail_sum = row_sum[2 * i + 1];
+	    } else {
+	      head_sum = tail_sum = 0.0;
+
+	      for (k = 0, aik = astarti, xi = x_starti;
+		   k < i; k++, aik += incaik, xi += incx) {
+		a_elem = a_i[aik];
+		x_elem = x_i[xi];
+		head_prod = (double)a_elem *x_elem;
+		tail_prod = 0.0;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
 	      }
-	    }
-	    for (; k < n_i; k++, aik += incaik2, xi += incx) {
-	      a_elem = a_i[aik];
-	      x_elem = x_i[xi];
-	      head_prod = (double)a_elem *x_elem;
-	      tail_prod = 0.0;
-	      {
-		/* Compute double-double = double-double + double-double. */
-		double		bv;
-		double		s1     , s2, t1, t2;
-
-		/* Add two hi words. */
-		s1 = head_sum + head_prod;
-		bv = s1 - head_sum;
-		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+	      for (; k < n_i; k++, aik += incaik2, xi += incx) {
+		a_elem = a_i[aik];
+		x_elem = x_i[xi];
+		head_prod = (double)a_elem *x_elem;
+		tail_prod = 0.0;
+		{
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
+		  double		bv;
+		  double		s1     , s2;
+
+		  /* Add two hi words. */
+		  s1 = head_sum + head_prod;
+		  bv = s1 - head_sum;
+		  s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
+
+		  /* Add the lo words to the error. */
+		  s2 += tail_sum + tail_prod;
+
+		  /* Renormalize (s1, s2)  */
+		  head_sum = s1 + s2;
+		  tail_sum = s2 - (head_sum - s1);
+		}
 	      }
 	    }
 	    y_elem = y_i[yi];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = y_elem * split;
-	      a1 = con - y_elem;
-	      a1 = con - a1;
-	      a2 = y_elem - a1;
-	      con = beta_i * split;
-	      b1 = con - beta_i;
-	      b1 = con - b1;
-	      b2 = beta_i - b1;
-
 	      head_tmp2 = y_elem * beta_i;
-	      tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_tmp2 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp2);
 	    }
 	    head_tmp1 = head_sum;
 	    tail_tmp1 = tail_sum;
@@ -562,107 +524,74 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	/* The most general form,   y <--- alpha * A * x + beta * y */
 	for (i = 0, yi = y_starti, astarti = 0;
 	     i < n_i; i++, yi += incy, astarti += incai) {
-	  head_sum = tail_sum = 0.0;
-
-	  for (k = 0, aik = astarti, xi = x_starti;
-	       k < i; k++, aik += incaik, xi += incx) {
-	    a_elem = a_i[aik];
-	    x_elem = x_i[xi];
-	    head_prod = (double)a_elem *x_elem;
-	    tail_prod = 0.0;
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_sum + head_prod;
-	      bv = s1 - head_sum;
-	      s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_sum + tail_prod;
-	      bv = t1 - tail_sum;
-	      t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
+	  if (row_sum != NULL) {
+	    head_sum = row_sum[2 * i];
+	    tail_sum = row_sum[2 * i + 1];
+	  } else {
+	    head_sum = tail_sum = 0.0;
 
-	      s2 += t1;
+	    for (k = 0, aik = astarti, xi = x_starti;
+		 k < i; k++, aik += incaik, xi += incx) {
+	      a_elem = a_i[aik];
+	      x_elem = x_i[xi];
+	      head_prod = (double)a_elem *x_elem;
+	      tail_prod = 0.0;
+	      {
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
+		double	      bv;
+		double	      s1, s2;
 
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+		/* Add two hi words. */
+		s1 = head_sum + head_prod;
+		bv = s1 - head_sum;
+		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-	      t2 += s2;
+		/* Add the lo words to the error. */
+		s2 += tail_sum + tail_prod;
 
-	      /* Renormalize (t1, t2)  */
-	      head_sum = t1 + t2;
-	      tail_sum = t2 - (head_sum - t1);
+		/* Renormalize (s1, s2)  */
+		head_sum = s1 + s2;
+		tail_sum = s2 - (head_sum - s1);
+	      }
 	    }
-	  }
-	  for (; k < n_i; k++, aik += incaik2, xi += incx) {
-	    a_elem = a_i[aik];
-	    x_elem = x_i[xi];
-	    head_prod = (double)a_elem *x_elem;
-	    tail_prod = 0.0;
-	    {
-	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
-
-	      /* Add two hi words. */
-	      s1 = head_sum + head_prod;
-	      bv = s1 - head_sum;
-	      s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
-
-	      /* Add two lo words. */
-	      t1 = tail_sum + tail_prod;
-	      bv = t1 - tail_sum;
-	      t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-	      s2 += t1;
+	    for (; k < n_i; k++, aik += incaik2, xi += incx) {
+	      a_elem = a_i[aik];
+	      x_elem = x_i[xi];
+	      head_prod = (double)a_elem *x_elem;
+	      tail_prod = 0.0;
+	      {
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
+		double	      bv;
+		double	      s1, s2;
 
-	      /* Renormalize (s1, s2)  to  (t1, s2) */
-	      t1 = s1 + s2;
-	      s2 = s2 - (t1 - s1);
+		/* Add two hi words. */
+		s1 = head_sum + head_prod;
+		bv = s1 - head_sum;
+		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-	      t2 += s2;
+		/* Add the lo words to the error. */
+		s2 += tail_sum + tail_prod;
 
-	      /* Renormalize (t1, t2)  */
-	      head_sum = t1 + t2;
-	      tail_sum = t2 - (head_sum - t1);
+		/* Renormalize (s1, s2)  */
+		head_sum = s1 + s2;
+		tail_sum = s2 - (head_sum - s1);
+	      }
 	    }
 	  }
 	  y_elem = y_i[yi];
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = y_elem * split;
-	    a1 = con - y_elem;
-	    a1 = con - a1;
-	    a2 = y_elem - a1;
-	    con = beta_i * split;
-	    b1 = con - beta_i;
-	    b1 = con - b1;
-	    b2 = beta_i - b1;
-
 	    head_tmp2 = y_elem * beta_i;
-	    tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_tmp2 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp2);
 	  }
 	  {
 	    /* Compute double-double = double-double * double. */
-	    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	    con = head_sum * split;
-	    a11 = con - head_sum;
-	    a11 = con - a11;
-	    a21 = head_sum - a11;
-	    con = alpha_i * split;
-	    b1 = con - alpha_i;
-	    b1 = con - b1;
-	    b2 = alpha_i - b1;
+	    double	    c11 , c21, c2, t1, t2;
 
 	    c11 = head_sum * alpha_i;
-	    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	    c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 	    c2 = tail_sum * alpha_i;
 	    t1 = c11 + c2;
@@ -702,6 +631,7 @@ void		BLAS_dsymv_s_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	}
       }
 
+      blas_free(row_sum);
       FPU_FIX_STOP;
 
       break;
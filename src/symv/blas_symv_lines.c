@@ -0,0 +1,802 @@
+#include <string.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_malloc.h"
+#include "blas_symv_lines.h"
+
+/*
+ * Row sums of a symmetric or Hermitian A times x from one sweep of its
+ * stored triangle.
+ *
+ * Line j of the triangle is contiguous: elements a(t, j) for t >= j when
+ * the triangle is "lower" in memory, t <= j when "upper".  With the
+ * lines taken in order, row i gets its terms k < i from the lines before
+ * its own and its terms k > i from its own line (lower), or the other
+ * way round (upper), so each row still adds them in column order.
+ *
+ * The products are those the generated code forms for the pair of types:
+ *
+ *   complex float by complex float   exact double products, each part
+ *                                    summed with the Knuth trick
+ *   other complex by complex         four two-products, added in pairs
+ *   complex by real, real by complex two two-products
+ *
+ * For Hermitian A the terms of one of the two directions take the
+ * conjugate of the stored element, and the diagonal its real part.
+ *
+ * Real data, and complex A against complex x, go a block of lines at a
+ * time through the line kernels of blas_dd_vec.h, which add each row's
+ * terms as the loops do but split the sum along each line over vector
+ * lanes; the mixed types are swept here one element at a time.
+ *
+ * A band triangle (SBMV, HBMV) is the same sweep with lines of at most
+ * k + 1 elements: in band storage element a(t, j) of line j sits at
+ * t + j * (lda - 1), past k leading slots when the triangle is upper in
+ * memory, so the sweep takes it as a full triangle of leading dimension
+ * lda - 1 and stops each line at the edge of the band.  The lines go
+ * to the kernel fewer at a time when the band is narrow, and the corners
+ * the lines of a block do not share are added one element at a time.
+ *
+ * A packed triangle (SPMV, HPMV) is the full sweep with line j starting
+ * where the packing puts it.  Its lines are contiguous but not evenly
+ * spaced, so a block of them is copied, BLAS_SPMV_LINES_MB rows at a
+ * time, into a small panel that the kernel takes with a fixed leading
+ * dimension; the dot products of the pieces are added in row order.
+ *
+ * The double branches of SPMV and HPMV get the same sweep in plain
+ * double arithmetic, with the products and sums of their loops: every
+ * row adds its terms in column order, so the sums are bitwise theirs.
+ */
+
+enum lines_mode {
+  lines_real,
+  lines_a_complex,		/* complex A, real x    */
+  lines_x_complex,		/* real A, complex x    */
+  lines_complex,
+  lines_complex_single		/* complex float A and x */
+};
+
+struct symv_lines {
+  int n, k, lda;		/* k off-diagonals per line, n - 1 for a
+				   full triangle */
+  int packed;			/* lines packed one after the other */
+  const void *a;
+  int a_single, x_single, herm;
+  int lower;			/* line j holds t >= j */
+  int conj_row;			/* conjugate a(t, j) in a(t, j) * x[j] */
+  int conj_line;		/* conjugate a(t, j) in a(t, j) * x[t] */
+  enum lines_mode mode;
+  const double *x;		/* x as doubles, (re, im) pairs when the
+				   sums are complex */
+};
+
+/* Where line j starts, less j elements when the triangle is lower in
+   memory: element a(t, j) sits at line_off(s, j) + t. */
+static long line_off(const struct symv_lines *s, int j)
+{
+  if (!s->packed)
+    return (long) j * s->lda;
+  if (s->lower)
+    return (long) j * (2 * s->n - j - 1) / 2;
+  return (long) j * (j + 1) / 2;
+}
+
+/* Real component k of p. */
+static double elt(const void *p, int single, long k)
+{
+  return single ? ((const float *) p)[k] : ((const double *) p)[k];
+}
+
+/* a(t, j) * (x0, x1), complex, for element k of A. */
+static void prod(const struct symv_lines *s, long k, int conj,
+		 double x0, double x1, double *head, double *tail)
+{
+  double a0, a1;
+
+  switch (s->mode) {
+  case lines_a_complex:
+    a0 = elt(s->a, s->a_single, 2 * k);
+    a1 = elt(s->a, s->a_single, 2 * k + 1);
+    if (conj)
+      a1 = -a1;
+    blas_dd_two_prod(x0, a0, &head[0], &tail[0]);
+    blas_dd_two_prod(x0, a1, &head[1], &tail[1]);
+    break;
+  case lines_x_complex:
+    a0 = elt(s->a, s->a_single, k);
+    blas_dd_two_prod(a0, x0, &head[0], &tail[0]);
+    blas_dd_two_prod(a0, x1, &head[1], &tail[1]);
+    break;
+  default:
+    a0 = elt(s->a, s->a_single, 2 * k);
+    a1 = elt(s->a, s->a_single, 2 * k + 1);
+    if (conj)
+      a1 = -a1;
+    blas_dd_cmul(a0, a1, x0, x1, s->mode == lines_complex_single, head,
+		 tail);
+    break;
+  }
+}
+
+/* a(j, j) * x[j], complex, for element k of A. */
+static void prod_diag(const struct symv_lines *s, long k, double x0,
+		      double x1, double *head, double *tail)
+{
+  double a0;
+
+  if (!s->herm) {
+    prod(s, k, 0, x0, x1, head, tail);
+    return;
+  }
+  a0 = elt(s->a, s->a_single, 2 * k);
+  if (s->mode == lines_a_complex) {
+    blas_dd_two_prod(x0, a0, &head[0], &tail[0]);
+    head[1] = tail[1] = 0.0;
+  } else if (!s->a_single && s->x_single) {
+    /* zhemv_z_c rounds these two products to double. */
+    head[0] = x0 * a0;
+    head[1] = x1 * a0;
+    tail[0] = tail[1] = 0.0;
+  } else {
+    blas_dd_two_prod(a0, x0, &head[0], &tail[0]);
+    blas_dd_two_prod(a0, x1, &head[1], &tail[1]);
+  }
+}
+
+/* (head, tail) += the product, part by part. */
+static void add_prod(double *head, double *tail, const double *head_p,
+		     const double *tail_p)
+{
+  blas_dd_add_lazy(head[0], tail[0], head_p[0], tail_p[0], &head[0], &tail[0]);
+  blas_dd_add_lazy(head[1], tail[1], head_p[1], tail_p[1], &head[1], &tail[1]);
+}
+
+/* Sums of complex A against real x or the other way round into sum: head
+   re, head im, tail re, tail im per row. */
+static void sweep_mixed(const struct symv_lines *s, double *sum)
+{
+  const double *x = s->x;
+  double head_p[2], tail_p[2], head_j[2], tail_j[2];
+  int n = s->n, j, t, t0, t1;
+
+  for (j = 0; j < n; j++) {
+    long line = line_off(s, j);
+    double *sj = sum + 4 * j;
+
+    head_j[0] = sj[0];
+    head_j[1] = sj[1];
+    tail_j[0] = sj[2];
+    tail_j[1] = sj[3];
+    if (s->lower) {
+      prod_diag(s, line + j, x[2 * j], x[2 * j + 1], head_p, tail_p);
+      add_prod(head_j, tail_j, head_p, tail_p);
+      t0 = j + 1;
+      t1 = MIN(n, j + s->k + 1);
+    } else {
+      t0 = MAX(0, j - s->k);
+      t1 = j;
+    }
+    for (t = t0; t < t1; t++) {
+      double *st = sum + 4 * t;
+
+      prod(s, line + t, s->conj_line, x[2 * t], x[2 * t + 1],
+	   head_p, tail_p);
+      add_prod(head_j, tail_j, head_p, tail_p);
+      prod(s, line + t, s->conj_row, x[2 * j], x[2 * j + 1],
+	   head_p, tail_p);
+      add_prod(st, st + 2, head_p, tail_p);
+    }
+    if (!s->lower) {
+      prod_diag(s, line + j, x[2 * j], x[2 * j + 1], head_p, tail_p);
+      add_prod(head_j, tail_j, head_p, tail_p);
+    }
+    sj[0] = head_j[0];
+    sj[1] = head_j[1];
+    sj[2] = tail_j[0];
+    sj[3] = tail_j[1];
+  }
+}
+
+/* Lines [j0, j1) against rows [j0, j1), in the order of the row loops. */
+static void triangle_real(const struct symv_lines *s, int j0, int j1,
+			  double *head, double *tail)
+{
+  const double *x = s->x;
+  double head_p, tail_p, a_elem;
+  int j, t;
+
+  for (j = j0; j < j1; j++) {
+    long line = line_off(s, j);
+    int t0 = s->lower ? j + 1 : MAX(j0, j - s->k);
+    int t1 = s->lower ? MIN(j1, j + s->k + 1) : j;
+
+    if (s->lower) {
+      a_elem = elt(s->a, s->a_single, line + j);
+      blas_dd_two_prod(a_elem, x[j], &head_p, &tail_p);
+      blas_dd_add_lazy(head[j], tail[j], head_p, tail_p, &head[j], &tail[j]);
+    }
+    for (t = t0; t < t1; t++) {
+      a_elem = elt(s->a, s->a_single, line + t);
+      blas_dd_two_prod(a_elem, x[t], &head_p, &tail_p);
+      blas_dd_add_lazy(head[j], tail[j], head_p, tail_p, &head[j], &tail[j]);
+      blas_dd_two_prod(a_elem, x[j], &head_p, &tail_p);
+      blas_dd_add_lazy(head[t], tail[t], head_p, tail_p, &head[t], &tail[t]);
+    }
+    if (!s->lower) {
+      a_elem = elt(s->a, s->a_single, line + j);
+      blas_dd_two_prod(a_elem, x[j], &head_p, &tail_p);
+      blas_dd_add_lazy(head[j], tail[j], head_p, tail_p, &head[j], &tail[j]);
+    }
+  }
+}
+
+/* triangle_real for complex A and x, with (re, im) pairs of sums. */
+static void triangle_complex(const struct symv_lines *s, int j0, int j1,
+			     double *head, double *tail)
+{
+  const double *x = s->x;
+  double head_p[2], tail_p[2];
+  int j, t;
+
+  for (j = j0; j < j1; j++) {
+    long line = line_off(s, j);
+    int t0 = s->lower ? j + 1 : MAX(j0, j - s->k);
+    int t1 = s->lower ? MIN(j1, j + s->k + 1) : j;
+
+    if (s->lower) {
+      prod_diag(s, line + j, x[2 * j], x[2 * j + 1], head_p, tail_p);
+      add_prod(head + 2 * j, tail + 2 * j, head_p, tail_p);
+    }
+    for (t = t0; t < t1; t++) {
+      prod(s, line + t, s->conj_line, x[2 * t], x[2 * t + 1],
+	   head_p, tail_p);
+      add_prod(head + 2 * j, tail + 2 * j, head_p, tail_p);
+      prod(s, line + t, s->conj_row, x[2 * j], x[2 * j + 1],
+	   head_p, tail_p);
+      add_prod(head + 2 * t, tail + 2 * t, head_p, tail_p);
+    }
+    if (!s->lower) {
+      prod_diag(s, line + j, x[2 * j], x[2 * j + 1], head_p, tail_p);
+      add_prod(head + 2 * j, tail + 2 * j, head_p, tail_p);
+    }
+  }
+}
+
+/* Line j against rows [t0, t1) outside its block, where the other lines
+   of the block do not all reach: a(t, j) * x[j] into row t and a(t, j) *
+   x[t] into (head_j, tail_j). */
+static void corner_real(const struct symv_lines *s, int j, int t0, int t1,
+			double *head, double *tail, double *head_j,
+			double *tail_j)
+{
+  const double *x = s->x;
+  long line = line_off(s, j);
+  double head_p, tail_p, a_elem;
+  int t;
+
+  for (t = t0; t < t1; t++) {
+    a_elem = elt(s->a, s->a_single, line + t);
+    blas_dd_two_prod(a_elem, x[t], &head_p, &tail_p);
+    blas_dd_add_lazy(*head_j, *tail_j, head_p, tail_p, head_j, tail_j);
+    blas_dd_two_prod(a_elem, x[j], &head_p, &tail_p);
+    blas_dd_add_lazy(head[t], tail[t], head_p, tail_p, &head[t], &tail[t]);
+  }
+}
+
+/* corner_real for complex A and x. */
+static void corner_complex(const struct symv_lines *s, int j, int t0,
+			   int t1, double *head, double *tail,
+			   double *head_j, double *tail_j)
+{
+  const double *x = s->x;
+  long line = line_off(s, j);
+  double head_p[2], tail_p[2];
+  int t;
+
+  for (t = t0; t < t1; t++) {
+    prod(s, line + t, s->conj_line, x[2 * t], x[2 * t + 1], head_p, tail_p);
+    add_prod(head_j, tail_j, head_p, tail_p);
+    prod(s, line + t, s->conj_row, x[2 * j], x[2 * j + 1], head_p, tail_p);
+    add_prod(head + 2 * t, tail + 2 * t, head_p, tail_p);
+  }
+}
+
+static void triangle(const struct symv_lines *s, int j0, int j1,
+		     double *head, double *tail)
+{
+  if (s->mode == lines_real)
+    triangle_real(s, j0, j1, head, tail);
+  else
+    triangle_complex(s, j0, j1, head, tail);
+}
+
+static void corner(const struct symv_lines *s, int j, int t0, int t1,
+		   double *head, double *tail, double *head_j,
+		   double *tail_j)
+{
+  if (s->mode == lines_real)
+    corner_real(s, j, t0, t1, head, tail, head_j, tail_j);
+  else
+    corner_complex(s, j, t0, t1, head, tail, head_j, tail_j);
+}
+
+/* The line kernel for lines [j0, j0 + nl) against rows [r0, r0 + rows),
+   whose first element is element off of t and the next line's ldt
+   elements on. */
+static void kernel(const struct symv_lines *s, int nl, long off,
+		   const void *t, int ldt, int r0, int rows, int j0,
+		   double *head, double *tail, double *head_dot,
+		   double *tail_dot)
+{
+  const void *p = s->a_single
+    ? (const void *) ((const float *) t + off)
+    : (const void *) ((const double *) t + off);
+
+  if (s->mode == lines_real)
+    blas_symv_dd_lines_x_kernel(rows, nl, p, s->a_single, ldt, s->x + r0,
+				s->x + j0, s->x_single, head + r0, tail + r0,
+				head_dot, tail_dot);
+  else
+    blas_zsymv_dd_lines_x_kernel(rows, nl, p, s->a_single, ldt,
+				 s->x + 2 * r0, s->x + 2 * j0, s->conj_row,
+				 s->conj_line,
+				 s->mode == lines_complex_single,
+				 head + 2 * r0, tail + 2 * r0, head_dot,
+				 tail_dot);
+}
+
+/* The kernel on packed lines [j0, j1), each copied BLAS_SPMV_LINES_MB
+   rows at a time into a panel of fixed leading dimension. */
+static void packed_block(const struct symv_lines *s, int j0, int j1,
+			 int r0, int rows, double *head, double *tail,
+			 double *head_dot, double *tail_dot)
+{
+  double panel[2 * BLAS_SYMV_DD_LINES * BLAS_SPMV_LINES_MB];
+  double head_p[2 * BLAS_SYMV_DD_LINES], tail_p[2 * BLAS_SYMV_DD_LINES];
+  int w = (s->mode == lines_real) ? 1 : 2;
+  int nl = j1 - j0, r, mb, c;
+  size_t size = s->a_single ? sizeof(float) : sizeof(double);
+
+  for (r = r0; r < r0 + rows; r += mb) {
+    mb = MIN(BLAS_SPMV_LINES_MB, r0 + rows - r);
+    for (c = 0; c < nl; c++)
+      memcpy((char *) panel + (size_t) w * mb * c * size,
+	     (const char *) s->a + (size_t) w * (line_off(s, j0 + c) + r)
+	     * size, (size_t) w * mb * size);
+    if (r == r0) {
+      kernel(s, nl, 0, panel, mb, r, mb, j0, head, tail, head_dot,
+	     tail_dot);
+      continue;
+    }
+    kernel(s, nl, 0, panel, mb, r, mb, j0, head, tail, head_p, tail_p);
+    for (c = 0; c < w * nl; c++)
+      blas_dd_add(head_dot[c], tail_dot[c], head_p[c], tail_p[c],
+		  &head_dot[c], &tail_dot[c]);
+  }
+}
+
+/* Sums into (head, tail), (re, im) pairs of them when A and x are
+   complex, up to BLAS_SYMV_DD_LINES lines at a time: the block's own
+   triangle here, the rows all its lines reach in the kernel, and in a
+   band the corners between the two here again. */
+static void sweep_lines(const struct symv_lines *s, double *head,
+			double *tail)
+{
+  double head_dot[2 * BLAS_SYMV_DD_LINES], tail_dot[2 * BLAS_SYMV_DD_LINES];
+  int w = (s->mode == lines_real) ? 1 : 2;
+  int n = s->n, k = s->k, nl, j0, j1, j, c, rows, r0, dot;
+
+  /* A narrow band takes fewer lines per block, so that its rectangle
+     stays at least as tall as its corners. */
+  nl = (k >= n - 1) ? BLAS_SYMV_DD_LINES
+    : MAX(1, MIN(BLAS_SYMV_DD_LINES, (k + 1) / 2));
+
+  for (j0 = 0; j0 < n; j0 = j1) {
+    j1 = MIN(j0 + nl, n);
+
+    /* Rows below the block (lower) come after its triangle, rows above
+       it (upper) before. */
+    if (s->lower) {
+      triangle(s, j0, j1, head, tail);
+      r0 = j1;
+      rows = MIN(n, j0 + k + 1) - j1;
+    } else {
+      r0 = MAX(0, j1 - 1 - k);
+      rows = j0 - r0;
+      for (j = j0; j < j1; j++)
+	corner(s, j, MAX(0, j - k), MIN(r0, j0), head, tail, &head[w * j],
+	       &tail[w * j]);
+    }
+    for (c = 0; c < w * (j1 - j0); c++)
+      head_dot[c] = tail_dot[c] = 0.0;
+    dot = (rows > 0);
+    if (rows > 0 && s->packed)
+      packed_block(s, j0, j1, r0, rows, head, tail, head_dot, tail_dot);
+    else if (rows > 0)
+      kernel(s, j1 - j0, w * (line_off(s, j0) + r0), s->a, s->lda, r0, rows,
+	     j0, head, tail, head_dot, tail_dot);
+    if (s->lower && MIN(n, j1 + k) > r0 + rows) {
+      for (j = j0; j < j1; j++)
+	corner(s, j, r0 + rows, MIN(n, j + k + 1), head, tail,
+	       &head_dot[w * (j - j0)], &tail_dot[w * (j - j0)]);
+      dot = 1;
+    }
+    if (dot)
+      for (c = 0; c < w * (j1 - j0); c++)
+	blas_dd_add(head[w * j0 + c], tail[w * j0 + c], head_dot[c],
+		    tail_dot[c], &head[w * j0 + c], &tail[w * j0 + c]);
+    if (!s->lower)
+      triangle(s, j0, j1, head, tail);
+  }
+}
+
+/* Types, conjugation and mode of the sweep. */
+static void lines_init(struct symv_lines *s, enum blas_uplo_type uplo,
+		       int herm, enum blas_gemm_elt_type a_type,
+		       enum blas_gemm_elt_type x_type)
+{
+  int a_complex = BLAS_GEMM_ELT_IS_COMPLEX(a_type);
+  int x_complex = BLAS_GEMM_ELT_IS_COMPLEX(x_type);
+
+  s->a_single = (a_type == blas_gemm_elt_s || a_type == blas_gemm_elt_c);
+  s->x_single = (x_type == blas_gemm_elt_s || x_type == blas_gemm_elt_c);
+  s->herm = herm && a_complex;
+  /* The row loops conjugate their terms k > i when the lower triangle is
+     stored, k < i when the upper one is. */
+  s->conj_row = s->herm && (s->lower != (uplo == blas_lower));
+  s->conj_line = s->herm && !s->conj_row;
+  if (!a_complex && !x_complex)
+    s->mode = lines_real;
+  else if (!x_complex)
+    s->mode = lines_a_complex;
+  else if (!a_complex)
+    s->mode = lines_x_complex;
+  else if (s->a_single && s->x_single)
+    s->mode = lines_complex_single;
+  else
+    s->mode = lines_complex;
+}
+
+/* x as doubles into xd: one per element when the sums are real, else
+   (re, im) pairs. */
+static void lines_copy_x(const struct symv_lines *s, const void *x,
+			 int x_complex, int incx, double *xd)
+{
+  int j;
+
+  for (j = 0; j < s->n; j++) {
+    long k = (long) (x_complex ? 2 : 1) * j * incx;
+
+    if (s->mode == lines_real) {
+      xd[j] = elt(x, s->x_single, k);
+    } else {
+      xd[2 * j] = elt(x, s->x_single, k);
+      xd[2 * j + 1] = x_complex ? elt(x, s->x_single, k + 1) : 0.0;
+    }
+  }
+}
+
+/* The sums for the triangle described by s->n, k, lda, a and lower. */
+static double *lines_x(struct symv_lines *s, enum blas_uplo_type uplo,
+		       int herm, enum blas_gemm_elt_type a_type,
+		       const void *x, enum blas_gemm_elt_type x_type,
+		       int incx)
+{
+  int w, n = s->n;
+  int i, j;
+  double *sum, *ws;
+
+  lines_init(s, uplo, herm, a_type, x_type);
+  w = (s->mode == lines_real) ? 1 : 2;	/* doubles per sum */
+
+  /* x, then (head, tail) for the kernels. */
+  ws = (double *) blas_thread_scratch((size_t) 3 * w * n * sizeof(double));
+  sum = (double *) blas_malloc((size_t) 2 * w * n * sizeof(double));
+  if (ws == NULL || sum == NULL) {
+    blas_free(sum);
+    return NULL;
+  }
+  lines_copy_x(s, x, BLAS_GEMM_ELT_IS_COMPLEX(x_type), incx, ws);
+  s->x = ws;
+
+  if (s->mode == lines_a_complex || s->mode == lines_x_complex) {
+    for (i = 0; i < 4 * n; i++)
+      sum[i] = 0.0;
+    sweep_mixed(s, sum);
+  } else {
+    double *head = ws + w * n, *tail = ws + 2 * w * n;
+
+    for (i = 0; i < w * n; i++)
+      head[i] = tail[i] = 0.0;
+    sweep_lines(s, head, tail);
+    for (i = 0; i < n; i++)
+      for (j = 0; j < w; j++) {
+	sum[2 * w * i + j] = head[w * i + j];
+	sum[2 * w * i + w + j] = tail[w * i + j];
+      }
+  }
+  return sum;
+}
+
+/* a(t, j) * (x0, x1) for element k of A, in double as the double
+   branches form it. */
+static void prod_d(const struct symv_lines *s, long k, int conj, double x0,
+		   double x1, double *p)
+{
+  double a0, a1;
+
+  switch (s->mode) {
+  case lines_a_complex:
+    a0 = elt(s->a, s->a_single, 2 * k);
+    a1 = elt(s->a, s->a_single, 2 * k + 1);
+    if (conj)
+      a1 = -a1;
+    p[0] = a0 * x0;
+    p[1] = a1 * x0;
+    break;
+  case lines_x_complex:
+    a0 = elt(s->a, s->a_single, k);
+    p[0] = x0 * a0;
+    p[1] = x1 * a0;
+    break;
+  default:
+    a0 = elt(s->a, s->a_single, 2 * k);
+    a1 = elt(s->a, s->a_single, 2 * k + 1);
+    if (conj)
+      a1 = -a1;
+    p[0] = a0 * x0 - a1 * x1;
+    p[1] = a0 * x1 + a1 * x0;
+    break;
+  }
+}
+
+/* a(j, j) * x[j] in double; a Hermitian diagonal is real, and against
+   real x its product is too. */
+static void prod_diag_d(const struct symv_lines *s, long k, double x0,
+			double x1, double *p)
+{
+  double a0;
+
+  if (!s->herm) {
+    prod_d(s, k, 0, x0, x1, p);
+    return;
+  }
+  a0 = elt(s->a, s->a_single, 2 * k);
+  p[0] = x0 * a0;
+  p[1] = (s->mode == lines_a_complex) ? 0.0 : x1 * a0;
+}
+
+/* Lines [j0, j1) against rows [j0, j1), real, in double. */
+static void triangle_real_d(const struct symv_lines *s, int j0, int j1,
+			    double *sum)
+{
+  const double *x = s->x;
+  double a_elem;
+  int j, t;
+
+  for (j = j0; j < j1; j++) {
+    long line = line_off(s, j);
+
+    if (s->lower)
+      sum[j] = sum[j] + elt(s->a, s->a_single, line + j) * x[j];
+    for (t = s->lower ? j + 1 : j0; t < (s->lower ? j1 : j); t++) {
+      a_elem = elt(s->a, s->a_single, line + t);
+      sum[j] = sum[j] + a_elem * x[t];
+      sum[t] = sum[t] + a_elem * x[j];
+    }
+    if (!s->lower)
+      sum[j] = sum[j] + elt(s->a, s->a_single, line + j) * x[j];
+  }
+}
+
+/* Double sums of real A and x, BLAS_SYMV_DD_LINES lines at a time: each
+   row below (lower) or above (upper) a block takes one term from each of
+   its lines, and each line one term for its own row. */
+static void sweep_real_d(const struct symv_lines *s, double *sum)
+{
+  const double *x = s->x;
+  double dot[BLAS_SYMV_DD_LINES], x_line[BLAS_SYMV_DD_LINES];
+  double a_elem, y_elem;
+  long line[BLAS_SYMV_DD_LINES];
+  int n = s->n, j0, j1, c, t, t0, t1;
+
+  for (j0 = 0; j0 < n; j0 = j1) {
+    j1 = MIN(j0 + BLAS_SYMV_DD_LINES, n);
+    if (s->lower)
+      triangle_real_d(s, j0, j1, sum);
+    for (c = 0; c < j1 - j0; c++) {
+      line[c] = line_off(s, j0 + c);
+      dot[c] = sum[j0 + c];
+      x_line[c] = x[j0 + c];
+    }
+    t0 = s->lower ? j1 : 0;
+    t1 = s->lower ? n : j0;
+    for (t = t0; t < t1; t++) {
+      y_elem = sum[t];
+      for (c = 0; c < j1 - j0; c++) {
+	a_elem = elt(s->a, s->a_single, line[c] + t);
+	dot[c] = dot[c] + a_elem * x[t];
+	y_elem = y_elem + a_elem * x_line[c];
+      }
+      sum[t] = y_elem;
+    }
+    for (c = 0; c < j1 - j0; c++)
+      sum[j0 + c] = dot[c];
+    if (!s->lower)
+      triangle_real_d(s, j0, j1, sum);
+  }
+}
+
+/* Line j of complex A against complex x, rows [t0, t1) other than j, in
+   double. */
+static void line_complex_d(const struct symv_lines *s, int j, int t0,
+			   int t1, double *sum)
+{
+  const double *x = s->x;
+  long line = 2 * line_off(s, j);
+  double x0 = x[2 * j], x1 = x[2 * j + 1];
+  double sgn_line = s->conj_line ? -1.0 : 1.0;
+  double sgn_row = s->conj_row ? -1.0 : 1.0;
+  double h0 = sum[2 * j], h1 = sum[2 * j + 1], a0, a1, b1;
+  int t;
+
+  for (t = t0; t < t1; t++) {
+    a0 = elt(s->a, s->a_single, line + 2 * t);
+    a1 = elt(s->a, s->a_single, line + 2 * t + 1);
+    b1 = sgn_line * a1;
+    h0 = h0 + (a0 * x[2 * t] - b1 * x[2 * t + 1]);
+    h1 = h1 + (a0 * x[2 * t + 1] + b1 * x[2 * t]);
+    b1 = sgn_row * a1;
+    sum[2 * t] = sum[2 * t] + (a0 * x0 - b1 * x1);
+    sum[2 * t + 1] = sum[2 * t + 1] + (a0 * x1 + b1 * x0);
+  }
+  sum[2 * j] = h0;
+  sum[2 * j + 1] = h1;
+}
+
+/* Double sums of complex A or x, (re, im) per row, one line at a time. */
+static void sweep_d(const struct symv_lines *s, double *sum)
+{
+  const double *x = s->x;
+  double p[2];
+  int n = s->n, j, t;
+
+  for (j = 0; j < n; j++) {
+    long line = line_off(s, j);
+    double *sj = sum + 2 * j;
+
+    if (s->lower) {
+      prod_diag_d(s, line + j, x[2 * j], x[2 * j + 1], p);
+      sj[0] = sj[0] + p[0];
+      sj[1] = sj[1] + p[1];
+    }
+    if (s->mode == lines_complex || s->mode == lines_complex_single)
+      line_complex_d(s, j, s->lower ? j + 1 : 0, s->lower ? n : j, sum);
+    else
+      for (t = s->lower ? j + 1 : 0; t < (s->lower ? n : j); t++) {
+	double *st = sum + 2 * t;
+
+	prod_d(s, line + t, s->conj_line, x[2 * t], x[2 * t + 1], p);
+	sj[0] = sj[0] + p[0];
+	sj[1] = sj[1] + p[1];
+	prod_d(s, line + t, s->conj_row, x[2 * j], x[2 * j + 1], p);
+	st[0] = st[0] + p[0];
+	st[1] = st[1] + p[1];
+      }
+    if (!s->lower) {
+      prod_diag_d(s, line + j, x[2 * j], x[2 * j + 1], p);
+      sj[0] = sj[0] + p[0];
+      sj[1] = sj[1] + p[1];
+    }
+  }
+}
+
+double *blas_symv_lines_x(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n,
+			  const void *a, enum blas_gemm_elt_type a_type,
+			  int lda, const void *x,
+			  enum blas_gemm_elt_type x_type, int incx)
+{
+  struct symv_lines s;
+
+  if (n < BLAS_SYMV_LINES_MIN_N || lda < n)
+    return NULL;
+
+  s.n = n;
+  s.k = n - 1;
+  s.lda = lda;
+  s.packed = 0;
+  s.a = a;
+  s.lower = (order == blas_colmajor) == (uplo == blas_lower);
+  return lines_x(&s, uplo, herm, a_type, x, x_type, incx);
+}
+
+double *blas_sbmv_lines_x(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n, int k,
+			  const void *a, enum blas_gemm_elt_type a_type,
+			  int lda, const void *x,
+			  enum blas_gemm_elt_type x_type, int incx)
+{
+  struct symv_lines s;
+  long off;
+
+  if (n < BLAS_SYMV_LINES_MIN_N || k < 0 || lda < k + 1)
+    return NULL;
+  if (!BLAS_GEMM_ELT_IS_COMPLEX(a_type) && !BLAS_GEMM_ELT_IS_COMPLEX(x_type)
+      && MIN(k, n - 1) < BLAS_SBMV_LINES_MIN_K)
+    return NULL;
+
+  s.n = n;
+  s.k = MIN(k, n - 1);
+  s.lda = lda - 1;
+  s.packed = 0;
+  s.lower = (order == blas_colmajor) == (uplo == blas_lower);
+  /* An upper band has k slots ahead of its first element. */
+  off = s.lower ? 0 : (long) k * (BLAS_GEMM_ELT_IS_COMPLEX(a_type) ? 2 : 1);
+  s.a = (a_type == blas_gemm_elt_s || a_type == blas_gemm_elt_c)
+    ? (const void *) ((const float *) a + off)
+    : (const void *) ((const double *) a + off);
+  return lines_x(&s, uplo, herm, a_type, x, x_type, incx);
+}
+
+double *blas_spmv_lines_x(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n,
+			  const void *ap, enum blas_gemm_elt_type a_type,
+			  const void *x, enum blas_gemm_elt_type x_type,
+			  int incx)
+{
+  struct symv_lines s;
+
+  if (n < BLAS_SYMV_LINES_MIN_N)
+    return NULL;
+
+  s.n = n;
+  s.k = n - 1;
+  s.lda = 0;
+  s.packed = 1;
+  s.a = ap;
+  s.lower = (order == blas_colmajor) == (uplo == blas_lower);
+  return lines_x(&s, uplo, herm, a_type, x, x_type, incx);
+}
+
+double *blas_spmv_lines_d(enum blas_order_type order,
+			  enum blas_uplo_type uplo, int herm, int n,
+			  const void *ap, enum blas_gemm_elt_type a_type,
+			  const void *x, enum blas_gemm_elt_type x_type,
+			  int incx)
+{
+  struct symv_lines s;
+  double *sum, *xd;
+  int w, i;
+
+  if (n < BLAS_SYMV_LINES_MIN_N)
+    return NULL;
+
+  s.n = n;
+  s.k = n - 1;
+  s.lda = 0;
+  s.packed = 1;
+  s.a = ap;
+  s.lower = (order == blas_colmajor) == (uplo == blas_lower);
+  lines_init(&s, uplo, herm, a_type, x_type);
+  w = (s.mode == lines_real) ? 1 : 2;
+
+  xd = (double *) blas_thread_scratch((size_t) w * n * sizeof(double));
+  sum = (double *) blas_malloc((size_t) w * n * sizeof(double));
+  if (xd == NULL || sum == NULL) {
+    blas_free(sum);
+    return NULL;
+  }
+  lines_copy_x(&s, x, BLAS_GEMM_ELT_IS_COMPLEX(x_type), incx, xd);
+  s.x = xd;
+  for (i = 0; i < w * n; i++)
+    sum[i] = 0.0;
+  if (s.mode == lines_real)
+    sweep_real_d(&s, sum);
+  else
+    sweep_d(&s, sum);
+  return sum;
+}
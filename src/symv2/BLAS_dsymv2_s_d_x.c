@@ -1,6 +1,7 @@
 #include <blas_extended.h>
 #include <blas_extended_private.h>
 #include <blas_fpu.h>
+#include "blas_symv_lines.h"
 void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, int n, double alpha,
 					const		float *a, int lda, const double *x_head, const double *x_tail,
 	   		int		incx    , double beta, double *y,
@@ -175,6 +176,7 @@ void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, in
     }
 
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;
@@ -306,6 +308,8 @@ void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, in
       double	      head_tmp1, tail_tmp1;
       double	      head_tmp2, tail_tmp2;
       double	      head_tmp3, tail_tmp3;
+      double         *row_sum1;
+      double         *row_sum2;
 
       FPU_FIX_DECL;
 
@@ -350,206 +354,144 @@ void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, in
 
       FPU_FIX_START;
 
+      /* One sweep of the stored triangle into row sums. */
+      row_sum1 = row_sum2 = NULL;
+      if (alpha_i != 0.0) {
+	row_sum1 = blas_symv_lines_x(order, uplo, 0, n, a_i, blas_gemm_elt_s,
+				     lda, x_head_i + xi0, blas_gemm_elt_d,
+				     incx);
+	row_sum2 = blas_symv_lines_x(order, uplo, 0, n, a_i, blas_gemm_elt_s,
+				     lda, x_tail_i + xi0, blas_gemm_elt_d,
+				     incx);
+      }
+
       /*
        * The most general form,   y <--- alpha * A * (x_head + x_tail) + beta *
        * y
        */
       for (i = 0, yi = yi0, ai = 0; i < n; i++, yi += incy, ai += incai) {
-	head_sum1 = tail_sum1 = 0.0;
-	head_sum2 = tail_sum2 = 0.0;
-
-	for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
-	  a_elem = a_i[aij];
-	  x_elem = x_head_i[xi];
-	  {
-	    double	    dt = (double)a_elem;
+	if (row_sum1 != NULL && row_sum2 != NULL) {
+	  head_sum1 = row_sum1[2 * i];
+	  tail_sum1 = row_sum1[2 * i + 1];
+	  head_sum2 = row_sum2[2 * i];
+	  tail_sum2 = row_sum2[2 * i + 1];
+	} else {
+	  head_sum1 = tail_sum1 = 0.0;
+	  head_sum2 = tail_sum2 = 0.0;
+
+	  for (j = 0, aij = ai, xi = xi0; j < i; j++, aij += incaij, xi += incx) {
+	    a_elem = a_i[aij];
+	    x_elem = x_head_i[xi];
 	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = dt * split;
-	      a1 = con - dt;
-	      a1 = con - a1;
-	      a2 = dt - a1;
-	      con = x_elem * split;
-	      b1 = con - x_elem;
-	      b1 = con - b1;
-	      b2 = x_elem - b1;
-
-	      head_prod1 = dt * x_elem;
-	      tail_prod1 = (((a1 * b1 - head_prod1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      double	    dt = (double)a_elem;
+	      {
+		/* Compute double_double = double * double. */
+		head_prod1 = dt * x_elem;
+		tail_prod1 = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod1);
+	      }
 	    }
-	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum1 + head_prod1;
-	    bv = s1 - head_sum1;
-	    s2 = ((head_prod1 - bv) + (head_sum1 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum1 + tail_prod1;
-	    bv = t1 - tail_sum1;
-	    t2 = ((tail_prod1 - bv) + (tail_sum1 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum1 = t1 + t2;
-	    tail_sum1 = t2 - (head_sum1 - t1);
-	  }
-	  x_elem = x_tail_i[xi];
-	  {
-	    double	    dt = (double)a_elem;
 	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = dt * split;
-	      a1 = con - dt;
-	      a1 = con - a1;
-	      a2 = dt - a1;
-	      con = x_elem * split;
-	      b1 = con - x_elem;
-	      b1 = con - b1;
-	      b2 = x_elem - b1;
-
-	      head_prod2 = dt * x_elem;
-	      tail_prod2 = (((a1 * b1 - head_prod2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum1 + head_prod1;
+	      bv = s1 - head_sum1;
+	      s2 = ((head_prod1 - bv) + (head_sum1 - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum1 + tail_prod1;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum1 = s1 + s2;
+	      tail_sum1 = s2 - (head_sum1 - s1);
 	    }
-	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum2 + head_prod2;
-	    bv = s1 - head_sum2;
-	    s2 = ((head_prod2 - bv) + (head_sum2 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum2 + tail_prod2;
-	    bv = t1 - tail_sum2;
-	    t2 = ((tail_prod2 - bv) + (tail_sum2 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum2 = t1 + t2;
-	    tail_sum2 = t2 - (head_sum2 - t1);
-	  }
-	}
-	for (; j < n; j++, aij += incaij2, xi += incx) {
-	  a_elem = a_i[aij];
-	  x_elem = x_head_i[xi];
-	  {
-	    double	    dt = (double)a_elem;
+	    x_elem = x_tail_i[xi];
 	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = dt * split;
-	      a1 = con - dt;
-	      a1 = con - a1;
-	      a2 = dt - a1;
-	      con = x_elem * split;
-	      b1 = con - x_elem;
-	      b1 = con - b1;
-	      b2 = x_elem - b1;
-
-	      head_prod1 = dt * x_elem;
-	      tail_prod1 = (((a1 * b1 - head_prod1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      double	    dt = (double)a_elem;
+	      {
+		/* Compute double_double = double * double. */
+		head_prod2 = dt * x_elem;
+		tail_prod2 = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod2);
+	      }
 	    }
-	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum1 + head_prod1;
-	    bv = s1 - head_sum1;
-	    s2 = ((head_prod1 - bv) + (head_sum1 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum1 + tail_prod1;
-	    bv = t1 - tail_sum1;
-	    t2 = ((tail_prod1 - bv) + (tail_sum1 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum1 = t1 + t2;
-	    tail_sum1 = t2 - (head_sum1 - t1);
-	  }
-	  x_elem = x_tail_i[xi];
-	  {
-	    double	    dt = (double)a_elem;
 	    {
-	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = dt * split;
-	      a1 = con - dt;
-	      a1 = con - a1;
-	      a2 = dt - a1;
-	      con = x_elem * split;
-	      b1 = con - x_elem;
-	      b1 = con - b1;
-	      b2 = x_elem - b1;
-
-	      head_prod2 = dt * x_elem;
-	      tail_prod2 = (((a1 * b1 - head_prod2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum2 + head_prod2;
+	      bv = s1 - head_sum2;
+	      s2 = ((head_prod2 - bv) + (head_sum2 - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum2 + tail_prod2;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum2 = s1 + s2;
+	      tail_sum2 = s2 - (head_sum2 - s1);
 	    }
 	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_sum2 + head_prod2;
-	    bv = s1 - head_sum2;
-	    s2 = ((head_prod2 - bv) + (head_sum2 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_sum2 + tail_prod2;
-	    bv = t1 - tail_sum2;
-	    t2 = ((tail_prod2 - bv) + (tail_sum2 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_sum2 = t1 + t2;
-	    tail_sum2 = t2 - (head_sum2 - t1);
+	  for (; j < n; j++, aij += incaij2, xi += incx) {
+	    a_elem = a_i[aij];
+	    x_elem = x_head_i[xi];
+	    {
+	      double	    dt = (double)a_elem;
+	      {
+		/* Compute double_double = double * double. */
+		head_prod1 = dt * x_elem;
+		tail_prod1 = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod1);
+	      }
+	    }
+	    {
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum1 + head_prod1;
+	      bv = s1 - head_sum1;
+	      s2 = ((head_prod1 - bv) + (head_sum1 - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum1 + tail_prod1;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum1 = s1 + s2;
+	      tail_sum1 = s2 - (head_sum1 - s1);
+	    }
+	    x_elem = x_tail_i[xi];
+	    {
+	      double	    dt = (double)a_elem;
+	      {
+		/* Compute double_double = double * double. */
+		head_prod2 = dt * x_elem;
+		tail_prod2 = BLAS_TWO_PROD_ERR(dt, x_elem, head_prod2);
+	      }
+	    }
+	    {
+	      /* Compute double-double = double-double + double-double,
+	         renormalizing once. */
+	      double	    bv;
+	      double	    s1  , s2;
+
+	      /* Add two hi words. */
+	      s1 = head_sum2 + head_prod2;
+	      bv = s1 - head_sum2;
+	      s2 = ((head_prod2 - bv) + (head_sum2 - (s1 - bv)));
+
+	      /* Add the lo words to the error. */
+	      s2 += tail_sum2 + tail_prod2;
+
+	      /* Renormalize (s1, s2)  */
+	      head_sum2 = s1 + s2;
+	      tail_sum2 = s2 - (head_sum2 - s1);
+	    }
 	  }
 	}
 	{
@@ -581,19 +523,10 @@ void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, in
 	}
 	{
 	  /* Compute double-double = double-double * double. */
-	  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-	  con = head_sum1 * split;
-	  a11 = con - head_sum1;
-	  a11 = con - a11;
-	  a21 = head_sum1 - a11;
-	  con = alpha_i * split;
-	  b1 = con - alpha_i;
-	  b1 = con - b1;
-	  b2 = alpha_i - b1;
+	  double	  c11   , c21, c2, t1, t2;
 
 	  c11 = head_sum1 * alpha_i;
-	  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+	  c21 = BLAS_TWO_PROD_ERR(head_sum1, alpha_i, c11);
 
 	  c2 = tail_sum1 * alpha_i;
 	  t1 = c11 + c2;
@@ -605,19 +538,8 @@ void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, in
 	y_elem = y_i[yi];
 	{
 	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = y_elem * split;
-	  a1 = con - y_elem;
-	  a1 = con - a1;
-	  a2 = y_elem - a1;
-	  con = beta_i * split;
-	  b1 = con - beta_i;
-	  b1 = con - b1;
-	  b2 = beta_i - b1;
-
 	  head_tmp2 = y_elem * beta_i;
-	  tail_tmp2 = (((a1 * b1 - head_tmp2) + a1 * b2) + a2 * b1) + a2 * b2;
+	  tail_tmp2 = BLAS_TWO_PROD_ERR(y_elem, beta_i, head_tmp2);
 	}
 	{
 	  /* Compute double-double = double-double + double-double. */
@@ -649,6 +571,8 @@ void		BLAS_dsymv2_s_d_x(enum blas_order_type order, enum blas_uplo_type uplo, in
 	y_i[yi] = head_tmp3;
       }
 
+      blas_free(row_sum1);
+      blas_free(row_sum2);
       FPU_FIX_STOP;
 
       break;
@@ -0,0 +1,112 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
+#include "blas_syrk_engine.h"
+
+void BLAS_csyr2k_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, int n, int k, const void *alpha,
+		   const void *a, int lda, const void *b, int ldb,
+		   const void *beta, void *c, int ldc,
+		   enum blas_prec_type prec)
+/*
+ * Purpose
+ * =======
+ *
+ * This routine computes the rank-2k update
+ *
+ *     C <- alpha * A * B^T + alpha * B * A^T + beta * C
+ *                                         (trans = blas_no_trans)
+ *     C <- alpha * A^T * B + alpha * B^T * A + beta * C
+ *                                         (trans = blas_trans)
+ *
+ * of the symmetric n by n matrix C, of which only the uplo triangle is
+ * read and written; A and B are n by k (trans = blas_no_trans) or k by
+ * n.  The triangle is formed in blocks of columns on the GEMM engine;
+ * see blas_syrk_engine.h.
+ *
+ * Arguments
+ * =========
+ *
+ * order  (input) enum blas_order_type
+ *        column major, row major
+ *
+ * uplo   (input) enum blas_uplo_type
+ *        upper, lower: the triangle of C
+ *
+ * trans  (input) enum blas_trans_type
+ *        no trans, trans
+ *
+ * n      (input) int
+ *        the order of C
+ *
+ * k      (input) int
+ *        the other dimension of A and B
+ *
+ * alpha  (input) const void*
+ *
+ * a      (input) const void*
+ *        Matrix A
+ *
+ * lda    (input) int
+ *        leading dimension of A
+ *
+ * b      (input) const void*
+ *        Matrix B
+ *
+ * ldb    (input) int
+ *        leading dimension of B
+ *
+ * beta   (input) const void*
+ *
+ * c      (input/output) void*
+ *        Matrix C
+ *
+ * ldc    (input) int
+ *        leading dimension of C
+ *
+ * prec   (input) enum blas_prec_type
+ *        Specifies the internal precision to be used.
+ *        = blas_prec_single: single precision.
+ *        = blas_prec_double: double precision.
+ *        = blas_prec_extra : anything at least 1.5 times as accurate
+ *                            than double, and wider than 80-bits.
+ *                            We use double-double in our implementation.
+ *
+ */
+{
+  static const char routine_name[] = "BLAS_csyr2k_x";
+  const float *alpha_i = (const float *) alpha;
+  const float *beta_i = (const float *) beta;
+  int ld_min = ((order == blas_colmajor) == (trans == blas_no_trans))
+    ? n : k;
+
+  /* Test for error conditions */
+  if (order != blas_colmajor && order != blas_rowmajor)
+    BLAS_error(routine_name, -1, order, NULL);
+  if (uplo != blas_upper && uplo != blas_lower)
+    BLAS_error(routine_name, -2, uplo, NULL);
+  if (trans != blas_no_trans && trans != blas_trans)
+    BLAS_error(routine_name, -3, trans, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -4, n, NULL);
+  if (k < 0)
+    BLAS_error(routine_name, -5, k, NULL);
+  if (lda < MAX(1, ld_min))
+    BLAS_error(routine_name, -8, lda, NULL);
+  if (ldb < MAX(1, ld_min))
+    BLAS_error(routine_name, -10, ldb, NULL);
+  if (ldc < MAX(1, n))
+    BLAS_error(routine_name, -13, ldc, NULL);
+
+  /* Test for no-op */
+  if (n == 0
+      || (((alpha_i[0] == 0.0 && alpha_i[1] == 0.0) || k == 0)
+	  && beta_i[0] == 1.0 && beta_i[1] == 0.0))
+    return;
+
+
+  if (!blas_syrk_engine(order, uplo, trans, n, k, alpha, a, blas_gemm_elt_c,
+			lda, b, blas_gemm_elt_c, ldb, beta, c, blas_gemm_elt_c,
+			ldc, blas_gemm_symmetric, prec))
+    BLAS_error("blas_malloc", 0, 0, "malloc failed.\n");
+}
@@ -0,0 +1,363 @@
+#include <string.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_threads.h"
+#include "blas_gemm_engine.h"
+#include "blas_syrk_engine.h"
+
+/*
+ * Blocked SYRK, HERK, SYR2K and HER2K.
+ *
+ * C(i, j) of the triangle is the sum over the products p of
+ * alpha[p] * a[p](i, :) * b[p](:, j), plus beta * C(i, j): one product
+ * for a rank-k update, two for a rank-2k one.  A tile of C, rows
+ * [i0, i1) by columns [j0, j1), is formed in the worker's workspace,
+ * column-major with i1 - i0 rows and w doubles per element (head, then
+ * tail in blas_prec_extra), and its elements in the triangle are copied
+ * back to C.
+ */
+
+struct syrk_job {
+  int n, k, nblk;
+  int upper, herm, extra, nprod, trivial;
+  struct blas_gemm_operand a[2], b[2];
+  double alpha[2][2], beta[2];
+  void *c;
+  enum blas_gemm_elt_type c_type;
+  long c_rs, c_cs;
+  enum blas_gemm_elt_type w_type;	/* d or z */
+  int w;			/* doubles per element of a tile */
+  double *ws;			/* ws_len doubles per worker */
+  long ws_len;
+};
+
+static const void *elt_ptr(const void *p, enum blas_gemm_elt_type type,
+			   long off)
+{
+  switch (type) {
+  case blas_gemm_elt_s:
+    return (const float *) p + off;
+  case blas_gemm_elt_d:
+    return (const double *) p + off;
+  case blas_gemm_elt_c:
+    return (const float *) p + 2 * off;
+  default:
+    return (const double *) p + 2 * off;
+  }
+}
+
+/* v <- element off of p, as (re, im); conj negates im. */
+static void load_elt(const void *p, enum blas_gemm_elt_type type, long off,
+		     int conj, double *v)
+{
+  switch (type) {
+  case blas_gemm_elt_s:
+    v[0] = ((const float *) p)[off];
+    v[1] = 0.0;
+    return;
+  case blas_gemm_elt_d:
+    v[0] = ((const double *) p)[off];
+    v[1] = 0.0;
+    return;
+  case blas_gemm_elt_c:
+    v[0] = ((const float *) p)[2 * off];
+    v[1] = ((const float *) p)[2 * off + 1];
+    break;
+  default:
+    v[0] = ((const double *) p)[2 * off];
+    v[1] = ((const double *) p)[2 * off + 1];
+    break;
+  }
+  if (conj)
+    v[1] = -v[1];
+}
+
+static void store_elt(void *p, enum blas_gemm_elt_type type, long off,
+		      const double *v)
+{
+  switch (type) {
+  case blas_gemm_elt_s:
+    ((float *) p)[off] = v[0];
+    break;
+  case blas_gemm_elt_d:
+    ((double *) p)[off] = v[0];
+    break;
+  case blas_gemm_elt_c:
+    ((float *) p)[2 * off] = v[0];
+    ((float *) p)[2 * off + 1] = v[1];
+    break;
+  default:
+    ((double *) p)[2 * off] = v[0];
+    ((double *) p)[2 * off + 1] = v[1];
+    break;
+  }
+}
+
+static int in_triangle(const struct syrk_job *s, int i, int j)
+{
+  return s->upper ? (i <= j) : (i >= j);
+}
+
+/* (head, tail) <- a * (head_x, tail_x), double-double by double, w
+   doubles each. */
+static void scale_dd(const double *a, const double *head_x,
+		     const double *tail_x, int w, double *head, double *tail)
+{
+  double head_p, tail_p, head_q, tail_q;
+
+  if (w == 1) {
+    blas_dd_mul_d(head_x[0], tail_x[0], a[0], head, tail);
+    return;
+  }
+  /* Real part */
+  blas_dd_mul_d(head_x[0], tail_x[0], a[0], &head_p, &tail_p);
+  blas_dd_mul_d(head_x[1], tail_x[1], a[1], &head_q, &tail_q);
+  blas_dd_add(head_p, tail_p, -head_q, -tail_q, &head[0], &tail[0]);
+  /* Imaginary part */
+  blas_dd_mul_d(head_x[1], tail_x[1], a[0], &head_p, &tail_p);
+  blas_dd_mul_d(head_x[0], tail_x[0], a[1], &head_q, &tail_q);
+  blas_dd_add(head_p, tail_p, head_q, tail_q, &head[1], &tail[1]);
+}
+
+/* The tile in (head, tail) <- alpha[p] * product p + beta * the tile, by
+   loops; used when the GEMM engine has no memory, and with the product
+   left out when it is trivial (k or alpha zero). */
+static void tile_loops(const struct syrk_job *s, int p, const double *beta,
+		       int i0, int i1, int j0, int j1, double *head,
+		       double *tail)
+{
+  const struct blas_gemm_operand *a = &s->a[p], *b = &s->b[p];
+  int w = s->w, mt = i1 - i0, i, j, l, d;
+  int k = s->trivial ? 0 : s->k;
+
+  for (j = j0; j < j1; j++)
+    for (i = i0; i < i1; i++) {
+      long off = (long) w * ((i - i0) + (long) (j - j0) * mt);
+      double va[2], vb[2];
+
+      if (!in_triangle(s, i, j))
+	continue;
+
+      if (s->extra) {
+	double head_s[2] = { 0.0, 0.0 }, tail_s[2] = { 0.0, 0.0 };
+	double head_t[2], tail_t[2], head_c[2], tail_c[2];
+
+	for (l = 0; l < k; l++) {
+	  load_elt(a->p, a->type, (long) i * a->rs + (long) l * a->cs,
+		   a->conj, va);
+	  load_elt(b->p, b->type, (long) l * b->rs + (long) j * b->cs,
+		   b->conj, vb);
+	  blas_dd_cmul(va[0], va[1], vb[0], vb[1], 0, head_t, tail_t);
+	  for (d = 0; d < w; d++)
+	    blas_dd_add(head_s[d], tail_s[d], head_t[d], tail_t[d],
+			&head_s[d], &tail_s[d]);
+	}
+	if (s->trivial) {
+	  head_t[0] = head_t[1] = tail_t[0] = tail_t[1] = 0.0;
+	} else {
+	  scale_dd(s->alpha[p], head_s, tail_s, w, head_t, tail_t);
+	}
+	if (beta[0] != 0.0 || beta[1] != 0.0) {
+	  scale_dd(beta, head + off, tail + off, w, head_c, tail_c);
+	  for (d = 0; d < w; d++)
+	    blas_dd_add(head_t[d], tail_t[d], head_c[d], tail_c[d],
+			&head_t[d], &tail_t[d]);
+	}
+	for (d = 0; d < w; d++) {
+	  head[off + d] = head_t[d];
+	  tail[off + d] = tail_t[d];
+	}
+      } else {
+	double sum[2] = { 0.0, 0.0 }, r[2];
+	const double *al = s->alpha[p];
+
+	for (l = 0; l < k; l++) {
+	  load_elt(a->p, a->type, (long) i * a->rs + (long) l * a->cs,
+		   a->conj, va);
+	  load_elt(b->p, b->type, (long) l * b->rs + (long) j * b->cs,
+		   b->conj, vb);
+	  sum[0] = sum[0] + (va[0] * vb[0] - va[1] * vb[1]);
+	  sum[1] = sum[1] + (va[0] * vb[1] + va[1] * vb[0]);
+	}
+	r[0] = r[1] = 0.0;
+	if (!s->trivial) {
+	  r[0] = al[0] * sum[0] - al[1] * sum[1];
+	  r[1] = al[0] * sum[1] + al[1] * sum[0];
+	}
+	if (beta[0] != 0.0 || beta[1] != 0.0) {
+	  double c0 = head[off], c1 = (w == 2) ? head[off + 1] : 0.0;
+
+	  r[0] = r[0] + (beta[0] * c0 - beta[1] * c1);
+	  r[1] = r[1] + (beta[0] * c1 + beta[1] * c0);
+	}
+	for (d = 0; d < w; d++)
+	  head[off + d] = r[d];
+      }
+    }
+}
+
+/* C(i0:i1, j0:j1) takes in the products, on the worker's workspace. */
+static void tile(const struct syrk_job *s, int worker, int i0, int i1,
+		 int j0, int j1)
+{
+  static const double one[2] = { 1.0, 0.0 };
+  struct blas_gemm_operand a, b;
+  double *head = s->ws + (long) worker * s->ws_len;
+  double *tail = s->extra ? head + s->ws_len / 2 : NULL;
+  int w = s->w, mt = i1 - i0, nt = j1 - j0, i, j, p, ok;
+  int beta_zero = (s->beta[0] == 0.0 && s->beta[1] == 0.0);
+  double v[2];
+
+  /* The tile <- C, zero outside the triangle. */
+  for (j = j0; j < j1; j++)
+    for (i = i0; i < i1; i++) {
+      long off = (long) w * ((i - i0) + (long) (j - j0) * mt);
+
+      v[0] = v[1] = 0.0;
+      if (!beta_zero && in_triangle(s, i, j)) {
+	load_elt(s->c, s->c_type, i * s->c_rs + j * s->c_cs, 0, v);
+	if (s->herm && i == j)
+	  v[1] = 0.0;
+      }
+      head[off] = v[0];
+      if (w == 2)
+	head[off + 1] = v[1];
+      if (s->extra) {
+	tail[off] = 0.0;
+	if (w == 2)
+	  tail[off + 1] = 0.0;
+      }
+    }
+
+  for (p = 0; p < s->nprod; p++) {
+    const double *beta = (p == 0) ? s->beta : one;
+
+    if (s->trivial) {
+      tile_loops(s, p, beta, i0, i1, j0, j1, head, tail);
+      break;
+    }
+    a = s->a[p];
+    b = s->b[p];
+    a.p = elt_ptr(a.p, a.type, (long) i0 * a.rs);
+    b.p = elt_ptr(b.p, b.type, (long) j0 * b.cs);
+    if (s->extra)
+      ok = blas_gemm_engine_op_x2(mt, nt, s->k, s->alpha[p], &a, &b, beta,
+				  head, tail, s->w_type, 1, mt);
+    else
+      ok = blas_gemm_engine_op(mt, nt, s->k, s->alpha[p], &a, &b, beta,
+			       head, s->w_type, 1, mt, blas_prec_double);
+    if (!ok)
+      tile_loops(s, p, beta, i0, i1, j0, j1, head, tail);
+  }
+
+  /* C <- the tile, rounded, in the triangle. */
+  for (j = j0; j < j1; j++)
+    for (i = i0; i < i1; i++) {
+      long off = (long) w * ((i - i0) + (long) (j - j0) * mt);
+
+      if (!in_triangle(s, i, j))
+	continue;
+      v[0] = head[off];
+      v[1] = (w == 2 && !(s->herm && i == j)) ? head[off + 1] : 0.0;
+      store_elt(s->c, s->c_type, i * s->c_rs + j * s->c_cs, v);
+    }
+}
+
+/* One column block of C: the tiles off the diagonal, then the strips of
+   the diagonal tile.  Upper triangles have their tallest blocks last,
+   so the tasks run from the last block back. */
+static void block_task(void *arg, int task, int worker)
+{
+  const struct syrk_job *s = (const struct syrk_job *) arg;
+  int bi = s->upper ? s->nblk - 1 - task : task;
+  int j0 = bi * BLAS_SYRK_NB, j1 = MIN(s->n, j0 + BLAS_SYRK_NB);
+  int i0, js0, js1;
+  FPU_FIX_DECL;
+
+  FPU_FIX_START;
+  if (s->upper) {
+    for (i0 = 0; i0 < j0; i0 += BLAS_SYRK_MB)
+      tile(s, worker, i0, MIN(j0, i0 + BLAS_SYRK_MB), j0, j1);
+  } else {
+    for (i0 = j1; i0 < s->n; i0 += BLAS_SYRK_MB)
+      tile(s, worker, i0, MIN(s->n, i0 + BLAS_SYRK_MB), j0, j1);
+  }
+  for (js0 = j0; js0 < j1; js0 += BLAS_SYRK_DIAG) {
+    js1 = MIN(j1, js0 + BLAS_SYRK_DIAG);
+    if (s->upper)
+      tile(s, worker, j0, js1, js0, js1);
+    else
+      tile(s, worker, js0, j1, js0, js1);
+  }
+  FPU_FIX_STOP;
+}
+
+int blas_syrk_engine(enum blas_order_type order, enum blas_uplo_type uplo,
+		     enum blas_trans_type trans, int n, int k,
+		     const void *alpha,
+		     const void *a, enum blas_gemm_elt_type a_type, int lda,
+		     const void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     const void *beta,
+		     void *c, enum blas_gemm_elt_type c_type, int ldc,
+		     enum blas_gemm_shape shape, enum blas_prec_type prec)
+{
+  struct syrk_job s;
+  enum blas_trans_type t_kind, ta, tb;
+  int nworkers;
+
+  s.n = n;
+  s.k = k;
+  s.upper = (uplo == blas_upper);
+  s.herm = (shape == blas_gemm_hermitian);
+  s.extra = (prec == blas_prec_extra);
+  s.c = c;
+  s.c_type = c_type;
+  s.c_rs = (order == blas_colmajor) ? 1 : ldc;
+  s.c_cs = (order == blas_colmajor) ? ldc : 1;
+  if (BLAS_GEMM_ELT_IS_COMPLEX(c_type)) {
+    s.w_type = blas_gemm_elt_z;
+    s.w = 2;
+  } else {
+    s.w_type = blas_gemm_elt_d;
+    s.w = 1;
+  }
+  load_elt(alpha, c_type, 0, 0, s.alpha[0]);
+  load_elt(alpha, c_type, 0, s.herm, s.alpha[1]);
+  load_elt(beta, c_type, 0, 0, s.beta);
+  if (s.herm)
+    s.beta[1] = 0.0;
+
+  /* op(A) * op(B)' as a[p] * b[p]: product 0 is A against B, product 1
+     B against A; a rank-k update has B = A and product 0 alone. */
+  t_kind = s.herm ? blas_conj_trans : blas_trans;
+  ta = (trans == blas_no_trans) ? blas_no_trans : t_kind;
+  tb = (trans == blas_no_trans) ? t_kind : blas_no_trans;
+  s.nprod = (b == NULL) ? 1 : 2;
+  if (b == NULL) {
+    b = a;
+    b_type = a_type;
+    ldb = lda;
+  }
+  blas_gemm_operand_init(&s.a[0], a, a_type, order, ta, lda);
+  blas_gemm_operand_init(&s.b[0], b, b_type, order, tb, ldb);
+  blas_gemm_operand_init(&s.a[1], b, b_type, order, ta, ldb);
+  blas_gemm_operand_init(&s.b[1], a, a_type, order, tb, lda);
+  s.trivial = (k == 0 || (s.alpha[0][0] == 0.0 && s.alpha[0][1] == 0.0));
+
+  s.nblk = (n + BLAS_SYRK_NB - 1) / BLAS_SYRK_NB;
+  s.ws_len = (long) (s.extra ? 2 : 1) * s.w * BLAS_SYRK_MB * BLAS_SYRK_NB;
+  /* Too few blocks to go round: one at a time, each GEMM threaded on
+     its own.  The tiles are the same either way. */
+  nworkers = blas_parallel_workers(s.nblk);
+  if (nworkers < BLAS_get_num_threads())
+    nworkers = 1;
+  s.ws = (double *) blas_malloc(nworkers * s.ws_len * sizeof(double));
+  if (s.ws == NULL)
+    return 0;
+
+  blas_parallel_for(s.nblk, nworkers, block_task, &s);
+
+  blas_free(s.ws);
+  return 1;
+}
@@ -300,7 +300,8 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 
 	{
@@ -585,20 +586,10 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * dt;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		    c2 = tail_a0 * dt;
 		    t1 = c11 + c2;
@@ -611,20 +602,10 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * dt;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		    c2 = tail_a1 * dt;
 		    t1 = c11 + c2;
@@ -649,31 +630,22 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2[0];
 		tail_bt = -tail_temp2[0];
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_at + head_bt;
 		  bv = s1 - head_at;
 		  s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_at + tail_bt;
-		  bv = t1 - tail_at;
-		  t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		  /* Add the lo words to the error. */
+		  s2 += tail_at + tail_bt;
 
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_ct = t1 + t2;
-		  tail_ct = t2 - (head_ct - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_ct = s1 + s2;
+		  tail_ct = s2 - (head_ct - s1);
 		}
 		head_temp1[0] = head_ct;
 		tail_temp1[0] = tail_ct;
@@ -683,31 +655,22 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2[1];
 		tail_bt = -tail_temp2[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_at + head_bt;
 		  bv = s1 - head_at;
 		  s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_at + tail_bt;
-		  bv = t1 - tail_at;
-		  t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		  s2 += t1;
+		  /* Add the lo words to the error. */
+		  s2 += tail_at + tail_bt;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_ct = t1 + t2;
-		  tail_ct = t2 - (head_ct - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_ct = s1 + s2;
+		  tail_ct = s2 - (head_ct - s1);
 		}
 		head_temp1[1] = head_ct;
 		tail_temp1[1] = tail_ct;
@@ -735,25 +698,14 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_a / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_a - t12;
@@ -776,25 +728,14 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_a / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_a - t12;
@@ -901,20 +842,10 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * dt;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		    c2 = tail_a0 * dt;
 		    t1 = c11 + c2;
@@ -927,20 +858,10 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * dt;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		    c2 = tail_a1 * dt;
 		    t1 = c11 + c2;
@@ -965,31 +886,22 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2[0];
 		tail_bt = -tail_temp2[0];
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_at + head_bt;
 		  bv = s1 - head_at;
 		  s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_at + tail_bt;
-		  bv = t1 - tail_at;
-		  t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
+		  /* Add the lo words to the error. */
+		  s2 += tail_at + tail_bt;
 
-		  /* Renormalize (t1, t2)  */
-		  head_ct = t1 + t2;
-		  tail_ct = t2 - (head_ct - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_ct = s1 + s2;
+		  tail_ct = s2 - (head_ct - s1);
 		}
 		head_temp1[0] = head_ct;
 		tail_temp1[0] = tail_ct;
@@ -999,31 +911,22 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2[1];
 		tail_bt = -tail_temp2[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_at + head_bt;
 		  bv = s1 - head_at;
 		  s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_at + tail_bt;
-		  bv = t1 - tail_at;
-		  t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		  /* Add the lo words to the error. */
+		  s2 += tail_at + tail_bt;
 
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_ct = t1 + t2;
-		  tail_ct = t2 - (head_ct - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_ct = s1 + s2;
+		  tail_ct = s2 - (head_ct - s1);
 		}
 		head_temp1[1] = head_ct;
 		tail_temp1[1] = tail_ct;
@@ -1053,20 +956,10 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * dt;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		    c2 = tail_a0 * dt;
 		    t1 = c11 + c2;
@@ -1079,20 +972,10 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = dt * split;
-		    b1 = con - dt;
-		    b1 = con - b1;
-		    b2 = dt - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * dt;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		    c2 = tail_a1 * dt;
 		    t1 = c11 + c2;
@@ -1117,31 +1000,22 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2[0];
 		tail_bt = -tail_temp2[0];
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_at + head_bt;
 		  bv = s1 - head_at;
 		  s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_at + tail_bt;
-		  bv = t1 - tail_at;
-		  t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		  s2 += t1;
+		  /* Add the lo words to the error. */
+		  s2 += tail_at + tail_bt;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_ct = t1 + t2;
-		  tail_ct = t2 - (head_ct - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_ct = s1 + s2;
+		  tail_ct = s2 - (head_ct - s1);
 		}
 		head_temp1[0] = head_ct;
 		tail_temp1[0] = tail_ct;
@@ -1151,31 +1025,22 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2[1];
 		tail_bt = -tail_temp2[1];
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_at + head_bt;
 		  bv = s1 - head_at;
 		  s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_at + tail_bt;
-		  bv = t1 - tail_at;
-		  t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		  s2 += t1;
+		  /* Add the lo words to the error. */
+		  s2 += tail_at + tail_bt;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_ct = t1 + t2;
-		  tail_ct = t2 - (head_ct - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_ct = s1 + s2;
+		  tail_ct = s2 - (head_ct - s1);
 		}
 		head_temp1[1] = head_ct;
 		tail_temp1[1] = tail_ct;
@@ -1203,25 +1068,14 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_a / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_a - t12;
@@ -1244,25 +1098,14 @@ void		BLAS_ctbsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_a / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_a - t12;
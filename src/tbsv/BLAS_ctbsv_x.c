@@ -642,7 +642,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 
 	{
@@ -1315,20 +1316,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -1339,20 +1330,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -1364,54 +1345,32 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -1422,20 +1381,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -1445,34 +1394,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -1490,31 +1427,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1524,31 +1452,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1603,26 +1522,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -1648,26 +1555,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -1707,20 +1602,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -1733,20 +1618,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -1777,19 +1652,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -1812,20 +1676,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1868,26 +1722,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1926,13 +1771,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1982,20 +1823,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -2043,26 +1874,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -2101,13 +1923,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -2159,19 +1977,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -2194,20 +2001,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -2250,26 +2047,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -2308,13 +2096,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -2364,20 +2148,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -2425,26 +2199,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -2483,13 +2248,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -2553,20 +2314,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -2579,20 +2330,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -2704,20 +2445,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2728,20 +2459,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2753,54 +2474,32 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2811,20 +2510,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2834,34 +2523,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -2879,31 +2556,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -2913,31 +2581,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2975,20 +2634,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2999,20 +2648,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -3024,54 +2663,32 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -3082,20 +2699,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -3105,34 +2712,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -3150,31 +2745,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -3184,31 +2770,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -3263,26 +2840,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -3308,26 +2873,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -3367,20 +2920,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -3393,20 +2936,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -3437,19 +2970,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -3472,20 +2994,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3528,26 +3040,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3586,13 +3089,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3642,20 +3141,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3703,26 +3192,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3761,13 +3241,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3819,19 +3295,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -3854,20 +3319,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3910,26 +3365,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3968,13 +3414,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -4024,20 +3466,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4085,26 +3517,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4143,13 +3566,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -4213,20 +3632,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -4239,20 +3648,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -4372,20 +3771,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -4396,20 +3785,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -4421,54 +3800,32 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -4479,20 +3836,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -4502,34 +3849,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -4547,31 +3882,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -4581,31 +3907,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -4660,26 +3977,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -4705,26 +4010,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -4764,20 +4057,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -4790,20 +4073,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -4834,19 +4107,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -4869,20 +4131,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4925,26 +4177,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4983,13 +4226,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5039,20 +4278,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -5100,26 +4329,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -5158,13 +4378,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5216,19 +4432,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -5251,20 +4456,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -5307,26 +4502,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -5365,13 +4551,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5421,20 +4603,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -5482,26 +4654,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -5540,13 +4703,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5610,20 +4769,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -5636,20 +4785,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -5761,20 +4900,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -5785,20 +4914,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -5810,54 +4929,32 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5868,20 +4965,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5891,34 +4978,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -5936,31 +5011,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -5970,31 +5036,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -6032,20 +5089,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -6056,20 +5103,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -6081,54 +5118,32 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -6139,20 +5154,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -6162,34 +5167,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -6207,31 +5200,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -6241,31 +5225,22 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -6320,26 +5295,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -6365,26 +5328,14 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -6424,20 +5375,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -6450,20 +5391,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -6494,19 +5425,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -6529,20 +5449,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6585,26 +5495,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6643,13 +5544,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6699,20 +5596,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6760,26 +5647,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6818,13 +5696,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6876,19 +5750,8 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -6911,20 +5774,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6967,26 +5820,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -7025,13 +5869,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -7081,20 +5921,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -7142,26 +5972,17 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -7200,13 +6021,9 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -7270,20 +6087,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -7296,20 +6103,10 @@ void		BLAS_ctbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -1,6 +1,7 @@
 #include <math.h>
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_trsv_dd.h"
 void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   		enum		blas_trans_type trans, enum blas_diag_type diag,
 		   		int		n       , int k, double alpha, const double *t, int ldt,
@@ -172,7 +173,8 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 
 	{
@@ -275,7 +277,12 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
 
-  case blas_prec_extra:{
+  case blas_prec_extra:
+    /* Blocked solve on a per-thread double-double copy of x. */
+    if (blas_tbsv_dd_x(order, uplo, trans, diag, n, k, alpha, t, 0, ldt,
+		       x, 0, incx))
+      break;
+    {
       {
 
 	{
@@ -317,19 +324,8 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	     */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_elem * split;
-	      a1 = con - x_elem;
-	      a1 = con - a1;
-	      a2 = x_elem - a1;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
-
 	      head_temp1 = x_elem * alpha_i;
-	      tail_temp1 = (((a1 * b1 - head_temp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_temp1 = BLAS_TWO_PROD_ERR(x_elem, alpha_i, head_temp1);
 	    }
 
 	    Tij = dot_start;
@@ -344,19 +340,10 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      tail_temp3 = tail_x_internal[x_inti];
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = T_element * split;
-		b1 = con - T_element;
-		b1 = con - b1;
-		b2 = T_element - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * T_element;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
 		c2 = tail_temp3 * T_element;
 		t1 = c11 + c2;
@@ -370,31 +357,22 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2;
 		tail_bt = -tail_temp2;
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_temp1 + head_bt;
 		  bv = s1 - head_temp1;
 		  s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_temp1 + tail_bt;
-		  bv = t1 - tail_temp1;
-		  t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
+		  /* Add the lo words to the error. */
+		  s2 += tail_temp1 + tail_bt;
 
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_temp1 = t1 + t2;
-		  tail_temp1 = t2 - (head_temp1 - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_temp1 = s1 + s2;
+		  tail_temp1 = s2 - (head_temp1 - s1);
 		}
 	      }
 	      x_inti += inc_x_inti;
@@ -415,25 +393,14 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		 * Compute double-double = double-double / double, using a
 		 * Newton iteration scheme.
 		 */
-		double		b1     , b2, con, e, t1, t2, t11, t21, t12, t22;
+		double		e      , t1, t2, t11, t21, t12, t22;
 
 		/* Compute a DP approximation to the quotient. */
 		t1 = head_temp1 / T_element;
 
-		/*
-		 * Split t1 and b into two parts with at most 26 bits each,
-		 * using the Dekker-Veltkamp method.
-		 */
-		con = t1 * split;
-		t11 = con - (con - t1);
-		t21 = t1 - t11;
-		con = T_element * split;
-		b1 = con - (con - T_element);
-		b2 = T_element - b1;
-
-		/* Compute t1 * b using Dekker method. */
+		/* Compute t1 * b exactly. */
 		t12 = t1 * T_element;
-		t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		/* Compute dda - (t12, t22) using Knuth trick. */
 		t11 = head_temp1 - t12;
@@ -469,19 +436,8 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    x_elem = x_i[xi];
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = x_elem * split;
-	      a1 = con - x_elem;
-	      a1 = con - a1;
-	      a2 = x_elem - a1;
-	      con = alpha_i * split;
-	      b1 = con - alpha_i;
-	      b1 = con - b1;
-	      b2 = alpha_i - b1;
-
 	      head_temp1 = x_elem * alpha_i;
-	      tail_temp1 = (((a1 * b1 - head_temp1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      tail_temp1 = BLAS_TWO_PROD_ERR(x_elem, alpha_i, head_temp1);
 	    }
 
 
@@ -495,19 +451,10 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      tail_temp3 = tail_x_internal[x_inti];
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = T_element * split;
-		b1 = con - T_element;
-		b1 = con - b1;
-		b2 = T_element - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * T_element;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
 		c2 = tail_temp3 * T_element;
 		t1 = c11 + c2;
@@ -521,31 +468,22 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2;
 		tail_bt = -tail_temp2;
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_temp1 + head_bt;
 		  bv = s1 - head_temp1;
 		  s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_temp1 + tail_bt;
-		  bv = t1 - tail_temp1;
-		  t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
+		  /* Add the lo words to the error. */
+		  s2 += tail_temp1 + tail_bt;
 
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_temp1 = t1 + t2;
-		  tail_temp1 = t2 - (head_temp1 - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_temp1 = s1 + s2;
+		  tail_temp1 = s2 - (head_temp1 - s1);
 		}
 	      }
 	      x_inti += inc_x_inti;
@@ -560,19 +498,10 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      tail_temp3 = tail_x_internal[x_inti];
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = T_element * split;
-		b1 = con - T_element;
-		b1 = con - b1;
-		b2 = T_element - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * T_element;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
 		c2 = tail_temp3 * T_element;
 		t1 = c11 + c2;
@@ -586,31 +515,22 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		head_bt = -head_temp2;
 		tail_bt = -tail_temp2;
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_temp1 + head_bt;
 		  bv = s1 - head_temp1;
 		  s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_temp1 + tail_bt;
-		  bv = t1 - tail_temp1;
-		  t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
+		  /* Add the lo words to the error. */
+		  s2 += tail_temp1 + tail_bt;
 
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_temp1 = t1 + t2;
-		  tail_temp1 = t2 - (head_temp1 - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_temp1 = s1 + s2;
+		  tail_temp1 = s2 - (head_temp1 - s1);
 		}
 	      }
 	      x_inti += inc_x_inti;
@@ -631,25 +551,14 @@ void		BLAS_dtbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		 * Compute double-double = double-double / double, using a
 		 * Newton iteration scheme.
 		 */
-		double		b1     , b2, con, e, t1, t2, t11, t21, t12, t22;
+		double		e      , t1, t2, t11, t21, t12, t22;
 
 		/* Compute a DP approximation to the quotient. */
 		t1 = head_temp1 / T_element;
 
-		/*
-		 * Split t1 and b into two parts with at most 26 bits each,
-		 * using the Dekker-Veltkamp method.
-		 */
-		con = t1 * split;
-		t11 = con - (con - t1);
-		t21 = t1 - t11;
-		con = T_element * split;
-		b1 = con - (con - T_element);
-		b2 = T_element - b1;
-
-		/* Compute t1 * b using Dekker method. */
+		/* Compute t1 * b exactly. */
 		t12 = t1 * T_element;
-		t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		/* Compute dda - (t12, t22) using Knuth trick. */
 		t11 = head_temp1 - t12;
@@ -173,7 +173,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 
 	{
@@ -704,35 +705,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -768,35 +747,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -862,20 +819,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -886,20 +833,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -911,54 +848,32 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -969,20 +884,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -992,34 +897,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -1037,31 +930,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1071,31 +955,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1150,26 +1025,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -1195,26 +1058,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -1254,20 +1105,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -1280,20 +1121,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -1324,19 +1155,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -1359,20 +1179,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1415,26 +1225,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1473,13 +1274,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1529,20 +1326,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1590,26 +1377,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1648,13 +1426,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1706,19 +1480,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -1741,20 +1504,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1797,26 +1550,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1855,13 +1599,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1911,20 +1651,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1972,26 +1702,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -2030,13 +1751,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -2100,20 +1817,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -2126,20 +1833,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -2184,35 +1881,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -2248,35 +1923,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -2341,20 +1994,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2365,20 +2008,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2390,54 +2023,32 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2448,20 +2059,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2471,34 +2072,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -2516,31 +2105,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -2550,31 +2130,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2612,20 +2183,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2636,20 +2197,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2661,54 +2212,32 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2719,20 +2248,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2742,34 +2261,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -2787,31 +2294,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -2821,31 +2319,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2900,26 +2389,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -2945,26 +2422,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -3004,20 +2469,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -3030,20 +2485,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -3074,19 +2519,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -3109,20 +2543,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3165,26 +2589,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3223,13 +2638,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3279,20 +2690,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3340,26 +2741,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3398,13 +2790,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3456,19 +2844,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -3491,20 +2868,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3547,26 +2914,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3605,13 +2963,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3661,20 +3015,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3722,26 +3066,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3780,13 +3115,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3850,20 +3181,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -3876,20 +3197,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -3941,35 +3252,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -4005,35 +3294,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -4099,20 +3366,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -4123,20 +3380,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -4148,54 +3395,32 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -4206,20 +3431,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -4229,34 +3444,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -4274,31 +3477,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -4308,31 +3502,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -4387,26 +3572,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -4432,26 +3605,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -4491,20 +3652,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -4517,20 +3668,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -4561,19 +3702,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -4596,20 +3726,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4652,26 +3772,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4710,13 +3821,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -4766,20 +3873,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4827,26 +3924,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4885,13 +3973,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -4943,19 +4027,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -4978,20 +4051,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -5034,26 +4097,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -5092,13 +4146,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5148,20 +4198,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -5209,26 +4249,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -5267,13 +4298,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5337,20 +4364,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -5363,20 +4380,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -5421,35 +4428,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -5485,35 +4470,13 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -5578,20 +4541,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -5602,20 +4555,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -5627,54 +4570,32 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5685,20 +4606,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5708,34 +4619,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -5753,31 +4652,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -5787,31 +4677,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -5849,20 +4730,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -5873,20 +4744,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -5898,54 +4759,32 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5956,20 +4795,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5979,34 +4808,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -6024,31 +4841,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -6058,31 +4866,22 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -6137,26 +4936,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -6182,26 +4969,14 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -6241,20 +5016,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -6267,20 +5032,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -6311,19 +5066,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -6346,20 +5090,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6402,26 +5136,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6460,13 +5185,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6516,20 +5237,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6577,26 +5288,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6635,13 +5337,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6693,19 +5391,8 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      double	      dt = (double)T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = dt * split;
-			b1 = con - dt;
-			b1 = con - b1;
-			b2 = dt - b1;
-
 			head_t = r * dt;
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 		      }
 		    }
 		    {
@@ -6728,20 +5415,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6784,26 +5461,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6842,13 +5510,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6898,20 +5562,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6959,26 +5613,17 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -7017,13 +5662,9 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -7087,20 +5728,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -7113,20 +5744,10 @@ void		BLAS_ztbsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -173,7 +173,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
   case blas_prec_single:
   case blas_prec_indigenous:
-  case blas_prec_double:{
+  case blas_prec_double:
+  case blas_prec_reproducible:{
       {
 
 	{
@@ -688,35 +689,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -752,35 +731,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -839,20 +796,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		    c2 = tail_a0 * T_element[0];
 		    t1 = c11 + c2;
@@ -863,20 +810,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		    c2 = tail_a1 * T_element[1];
 		    t1 = c11 + c2;
@@ -888,51 +825,32 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[0] = head_t1;
 		  tail_temp2[0] = tail_t1;
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		    c2 = tail_a1 * T_element[0];
 		    t1 = c11 + c2;
@@ -943,20 +861,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		    c2 = tail_a0 * T_element[1];
 		    t1 = c11 + c2;
@@ -966,31 +874,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t2 = t2 - (head_t2 - t1);
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[1] = head_t1;
 		  tail_temp2[1] = tail_t1;
@@ -1007,31 +906,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1041,31 +931,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1121,26 +1002,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -1166,26 +1035,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -1225,20 +1082,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -1251,20 +1098,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -1293,19 +1130,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[1] / T_element[0];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
-
 		      head_t = r * T_element[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -1324,20 +1150,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1380,26 +1196,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1438,13 +1245,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1494,20 +1297,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1555,26 +1348,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1613,13 +1397,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1669,19 +1449,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[0] / T_element[1];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
-
 		      head_t = r * T_element[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -1700,20 +1469,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1756,26 +1515,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1814,13 +1564,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -1870,20 +1616,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -1931,26 +1667,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -1989,13 +1716,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -2059,20 +1782,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -2085,20 +1798,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -2143,35 +1846,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -2207,35 +1888,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -2293,20 +1952,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		    c2 = tail_a0 * T_element[0];
 		    t1 = c11 + c2;
@@ -2317,20 +1966,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		    c2 = tail_a1 * T_element[1];
 		    t1 = c11 + c2;
@@ -2342,51 +1981,32 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[0] = head_t1;
 		  tail_temp2[0] = tail_t1;
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		    c2 = tail_a1 * T_element[0];
 		    t1 = c11 + c2;
@@ -2397,20 +2017,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		    c2 = tail_a0 * T_element[1];
 		    t1 = c11 + c2;
@@ -2420,31 +2030,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t2 = t2 - (head_t2 - t1);
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[1] = head_t1;
 		  tail_temp2[1] = tail_t1;
@@ -2461,31 +2062,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -2495,31 +2087,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2550,20 +2133,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		    c2 = tail_a0 * T_element[0];
 		    t1 = c11 + c2;
@@ -2574,20 +2147,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		    c2 = tail_a1 * T_element[1];
 		    t1 = c11 + c2;
@@ -2599,51 +2162,32 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[0] = head_t1;
 		  tail_temp2[0] = tail_t1;
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		    c2 = tail_a1 * T_element[0];
 		    t1 = c11 + c2;
@@ -2654,20 +2198,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		    c2 = tail_a0 * T_element[1];
 		    t1 = c11 + c2;
@@ -2677,31 +2211,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t2 = t2 - (head_t2 - t1);
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[1] = head_t1;
 		  tail_temp2[1] = tail_t1;
@@ -2718,31 +2243,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -2752,31 +2268,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2832,26 +2339,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -2877,26 +2372,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -2936,20 +2419,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -2962,20 +2435,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -3004,19 +2467,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[1] / T_element[0];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
-
 		      head_t = r * T_element[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -3035,20 +2487,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3091,26 +2533,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3149,13 +2582,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3205,20 +2634,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3266,26 +2685,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3324,13 +2734,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3380,19 +2786,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[0] / T_element[1];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
-
 		      head_t = r * T_element[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -3411,20 +2806,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3467,26 +2852,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3525,13 +2901,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3581,20 +2953,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -3642,26 +3004,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -3700,13 +3053,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -3770,20 +3119,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -3796,20 +3135,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -3861,35 +3190,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -3925,35 +3232,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -4012,20 +3297,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		    c2 = tail_a0 * T_element[0];
 		    t1 = c11 + c2;
@@ -4036,20 +3311,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		    c2 = tail_a1 * T_element[1];
 		    t1 = c11 + c2;
@@ -4061,51 +3326,32 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[0] = head_t1;
 		  tail_temp2[0] = tail_t1;
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		    c2 = tail_a1 * T_element[0];
 		    t1 = c11 + c2;
@@ -4116,20 +3362,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		    c2 = tail_a0 * T_element[1];
 		    t1 = c11 + c2;
@@ -4139,31 +3375,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t2 = t2 - (head_t2 - t1);
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[1] = head_t1;
 		  tail_temp2[1] = tail_t1;
@@ -4180,31 +3407,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -4214,31 +3432,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -4294,26 +3503,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -4339,26 +3536,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -4398,20 +3583,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -4424,20 +3599,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -4466,19 +3631,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[1] / T_element[0];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
-
 		      head_t = r * T_element[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -4497,20 +3651,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4553,26 +3697,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4611,13 +3746,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -4667,20 +3798,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4728,26 +3849,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4786,13 +3898,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -4842,19 +3950,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[0] / T_element[1];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
-
 		      head_t = r * T_element[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -4873,20 +3970,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -4929,26 +4016,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -4987,13 +4065,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5043,20 +4117,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -5104,26 +4168,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -5162,13 +4217,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -5232,20 +4283,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -5258,20 +4299,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -5316,35 +4347,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Real part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[0] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[1] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[1], head_t2);
 		}
 		head_t2 = -head_t2;
 		tail_t2 = -tail_t2;
@@ -5380,35 +4389,13 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* Imaginary part */
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[1] * split;
-		  a1 = con - x_elem[1];
-		  a1 = con - a1;
-		  a2 = x_elem[1] - a1;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
-
 		  head_t1 = x_elem[1] * alpha_i[0];
-		  tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t1 = BLAS_TWO_PROD_ERR(x_elem[1], alpha_i[0], head_t1);
 		}
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem[0] * split;
-		  a1 = con - x_elem[0];
-		  a1 = con - a1;
-		  a2 = x_elem[0] - a1;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
-
 		  head_t2 = x_elem[0] * alpha_i[1];
-		  tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_t2 = BLAS_TWO_PROD_ERR(x_elem[0], alpha_i[1], head_t2);
 		}
 		{
 		  /* Compute double-double = double-double + double-double. */
@@ -5466,20 +4453,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		    c2 = tail_a0 * T_element[0];
 		    t1 = c11 + c2;
@@ -5490,20 +4467,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		    c2 = tail_a1 * T_element[1];
 		    t1 = c11 + c2;
@@ -5515,51 +4482,32 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[0] = head_t1;
 		  tail_temp2[0] = tail_t1;
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		    c2 = tail_a1 * T_element[0];
 		    t1 = c11 + c2;
@@ -5570,20 +4518,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		    c2 = tail_a0 * T_element[1];
 		    t1 = c11 + c2;
@@ -5593,31 +4531,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t2 = t2 - (head_t2 - t1);
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[1] = head_t1;
 		  tail_temp2[1] = tail_t1;
@@ -5634,31 +4563,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -5668,31 +4588,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -5723,20 +4634,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		    c2 = tail_a0 * T_element[0];
 		    t1 = c11 + c2;
@@ -5747,20 +4648,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		    c2 = tail_a1 * T_element[1];
 		    t1 = c11 + c2;
@@ -5772,51 +4663,32 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_t2 = -head_t2;
 		  tail_t2 = -tail_t2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[0] = head_t1;
 		  tail_temp2[0] = tail_t1;
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element[0] * split;
-		    b1 = con - T_element[0];
-		    b1 = con - b1;
-		    b2 = T_element[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		    c2 = tail_a1 * T_element[0];
 		    t1 = c11 + c2;
@@ -5827,20 +4699,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element[1] * split;
-		    b1 = con - T_element[1];
-		    b1 = con - b1;
-		    b2 = T_element[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		    c2 = tail_a0 * T_element[1];
 		    t1 = c11 + c2;
@@ -5850,31 +4712,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t2 = t2 - (head_t2 - t1);
 		  }
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_t1 + head_t2;
 		    bv = s1 - head_t1;
 		    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_t1 + tail_t2;
-		    bv = t1 - tail_t1;
-		    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_t1 + tail_t2;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t1 = t1 + t2;
-		    tail_t1 = t2 - (head_t1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t1 = s1 + s2;
+		    tail_t1 = s2 - (head_t1 - s1);
 		  }
 		  head_temp2[1] = head_t1;
 		  tail_temp2[1] = tail_t1;
@@ -5891,31 +4744,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -5925,31 +4769,22 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -6005,26 +4840,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -6050,26 +4873,14 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			 * Compute double-double = double-double / double,
 			 * using a Newton iteration scheme.
 			 */
-			double		b1     , b2, con, e, t1, t2, t11, t21,
-					t12          , t22;
+			double		e      , t1, t2, t11, t21, t12, t22;
 
 			/* Compute a DP approximation to the quotient. */
 			t1 = head_a / 16.0;
 
-			/*
-			 * Split t1 and b into two parts with at most 26 bits
-			 * each, using the Dekker-Veltkamp method.
-			 */
-			con = t1 * split;
-			t11 = con - (con - t1);
-			t21 = t1 - t11;
-			con = 16.0 * split;
-			b1 = con - (con - 16.0);
-			b2 = 16.0 - b1;
-
-			/* Compute t1 * b using Dekker method. */
+			/* Compute t1 * b exactly. */
 			t12 = t1 * 16.0;
-			t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			/* Compute dda - (t12, t22) using Knuth trick. */
 			t11 = head_a - t12;
@@ -6109,20 +4920,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_temp1[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			c2 = tail_a0 * s;
 			t1 = c11 + c2;
@@ -6135,20 +4936,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = s * split;
-			b1 = con - s;
-			b1 = con - b1;
-			b2 = s - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * s;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			c2 = tail_a1 * s;
 			t1 = c11 + c2;
@@ -6177,19 +4968,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[1] / T_element[0];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
-
 		      head_t = r * T_element[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -6208,20 +4988,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6264,26 +5034,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6322,13 +5083,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6378,20 +5135,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6439,26 +5186,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b - a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6497,13 +5235,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6553,19 +5287,8 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    r = T_element[0] / T_element[1];
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = r * split;
-		      a1 = con - r;
-		      a1 = con - a1;
-		      a2 = r - a1;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
-
 		      head_t = r * T_element[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		    }
 		    {
 		      /* Compute double-double = double-double + double. */
@@ -6584,20 +5307,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[0];	/* a */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6640,26 +5353,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* b + a*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6698,13 +5402,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6754,20 +5454,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_t1 = tail_temp1[1];	/* b */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_t1 * split;
-		      a11 = con - head_t1;
-		      a11 = con - a11;
-		      a21 = head_t1 - a11;
-		      con = r * split;
-		      b1 = con - r;
-		      b1 = con - b1;
-		      b2 = r - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_t1 * r;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 		      c2 = tail_t1 * r;
 		      t1 = c11 + c2;
@@ -6815,26 +5505,17 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }		/* -a + b*r */
 		    {
 		      double	      q1, q2, q3;
-		      double	      a1, a2, b1, b2;
 		      double	      p1, p2, c;
 		      double	      s1, s2, v;
 		      double	      t1, t2;
 		      double	      r1, r2;
-		      double	      cona, conb;
 
 		      q1 = head_t2 / head_t;	/* approximate quotient */
 
 		      /* Compute  q1 * b  */
-		      cona = q1 * split;
-		      conb = head_t * split;
-		      a1 = cona - (cona - q1);
-		      b1 = conb - (conb - head_t);
-		      a2 = q1 - a1;
-		      b2 = head_t - b1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q1 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q1 * tail_t;
@@ -6873,13 +5554,9 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 		      /* Compute residual   r1 - q2 * b          */
-		      cona = q2 * split;
-		      a1 = cona - (cona - q2);
-		      a2 = q2 - a1;
-
 		      /* (p1, p2) is the product of high order terms. */
 		      p1 = q2 * head_t;
-		      p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 		      /* Compute the low-order term */
 		      c = q2 * tail_t;
@@ -6943,20 +5620,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_q[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 		      c2 = tail_a0 * S;
 		      t1 = c11 + c2;
@@ -6969,20 +5636,10 @@ void		BLAS_ztbsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp1[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = S * split;
-		      b1 = con - S;
-		      b1 = con - b1;
-		      b2 = S - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * S;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 		      c2 = tail_a1 * S;
 		      t1 = c11 + c2;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_tpmv_cols.h"
 
 void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     		enum		blas_trans_type trans, enum blas_diag_type diag,
@@ -272,6 +273,7 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       {
@@ -283,6 +285,7 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *tp_i = tp;
 	float          *x_i = (float *)x;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		result  [2];
 	float		matval;
@@ -314,6 +317,11 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incx == 0) {
 	  BLAS_error(routine_name, -9, incx, NULL);
 	} {
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_d(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_s, x_i + x_start,
+				     blas_gemm_elt_c, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -366,30 +374,35 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    rowtmp[0] = (double)vecval[0] * one;
-		    rowtmp[1] = (double)vecval[1] * one;
-		  }
-		} else {
-		  matval = tp_i[tp_index];
-		  {
-		    rowtmp[0] = (double)vecval[0] * matval;
-		    rowtmp[1] = (double)vecval[1] * matval;
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    {
+		      rowtmp[0] = (double)vecval[0] * one;
+		      rowtmp[1] = (double)vecval[1] * one;
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      rowtmp[0] = (double)vecval[0] * matval;
+		      rowtmp[1] = (double)vecval[1] * matval;
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -446,30 +459,35 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    rowtmp[0] = (double)vecval[0] * one;
-		    rowtmp[1] = (double)vecval[1] * one;
-		  }
-		} else {
-		  matval = tp_i[tp_index];
-		  {
-		    rowtmp[0] = (double)vecval[0] * matval;
-		    rowtmp[1] = (double)vecval[1] * matval;
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    {
+		      rowtmp[0] = (double)vecval[0] * one;
+		      rowtmp[1] = (double)vecval[1] * one;
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      rowtmp[0] = (double)vecval[0] * matval;
+		      rowtmp[1] = (double)vecval[1] * matval;
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -482,6 +500,8 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -498,6 +518,7 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *tp_i = tp;
 	float          *x_i = (float *)x;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		head_result[2], tail_result[2];
 	float		matval;
@@ -533,6 +554,11 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 	{
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_x(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_s, x_i + x_start,
+				     blas_gemm_elt_c, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -575,31 +601,22 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -609,31 +626,22 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -659,20 +667,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -683,20 +681,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -739,20 +727,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -763,20 +741,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -831,105 +799,94 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    head_rowtmp[0] = (double)vecval[0] * one;
-		    tail_rowtmp[0] = 0.0;
-		    head_rowtmp[1] = (double)vecval[1] * one;
-		    tail_rowtmp[1] = 0.0;
-		  }
-		} else {
-		  matval = tp_i[tp_index];
-		  {
-		    head_rowtmp[0] = (double)vecval[0] * matval;
-		    tail_rowtmp[0] = 0.0;
-		    head_rowtmp[1] = (double)vecval[1] * matval;
-		    tail_rowtmp[1] = 0.0;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    {
+		      head_rowtmp[0] = (double)vecval[0] * one;
+		      tail_rowtmp[0] = 0.0;
+		      head_rowtmp[1] = (double)vecval[1] * one;
+		      tail_rowtmp[1] = 0.0;
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      head_rowtmp[0] = (double)vecval[0] * matval;
+		      tail_rowtmp[0] = 0.0;
+		      head_rowtmp[1] = (double)vecval[1] * matval;
+		      tail_rowtmp[1] = 0.0;
+		    }
 		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		double		cd      [2];
@@ -948,20 +905,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -972,20 +919,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1028,20 +965,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1052,20 +979,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1152,31 +1069,22 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -1186,31 +1094,22 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -1235,20 +1134,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1259,20 +1148,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1315,20 +1194,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1339,20 +1208,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1403,105 +1262,94 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    head_rowtmp[0] = (double)vecval[0] * one;
-		    tail_rowtmp[0] = 0.0;
-		    head_rowtmp[1] = (double)vecval[1] * one;
-		    tail_rowtmp[1] = 0.0;
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    {
+		      head_rowtmp[0] = (double)vecval[0] * one;
+		      tail_rowtmp[0] = 0.0;
+		      head_rowtmp[1] = (double)vecval[1] * one;
+		      tail_rowtmp[1] = 0.0;
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      head_rowtmp[0] = (double)vecval[0] * matval;
+		      tail_rowtmp[0] = 0.0;
+		      head_rowtmp[1] = (double)vecval[1] * matval;
+		      tail_rowtmp[1] = 0.0;
+		    }
 		  }
-		} else {
-		  matval = tp_i[tp_index];
 		  {
-		    head_rowtmp[0] = (double)vecval[0] * matval;
-		    tail_rowtmp[0] = 0.0;
-		    head_rowtmp[1] = (double)vecval[1] * matval;
-		    tail_rowtmp[1] = 0.0;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
+		    {
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
+		    }
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
-		}
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		double		cd      [2];
@@ -1520,20 +1368,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1544,20 +1382,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1600,20 +1428,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1624,20 +1442,10 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1685,6 +1493,8 @@ void		BLAS_ctpmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
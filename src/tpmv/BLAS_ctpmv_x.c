@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_tpmv_cols.h"
 
 void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   		enum		blas_trans_type trans, enum blas_diag_type diag,
@@ -285,6 +286,7 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       {
@@ -296,6 +298,7 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *tp_i = (float *)tp;
 	float          *x_i = (float *)x;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		result  [2];
 	float		matval   [2];
@@ -328,6 +331,11 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incx == 0) {
 	  BLAS_error(routine_name, -9, incx, NULL);
 	} {
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_d(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_c, x_i + x_start,
+				     blas_gemm_elt_c, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -381,31 +389,36 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
-		    rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
-		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
-		  {
-		    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-		    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    {
+		      rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
+		      rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
+		    }
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
+		    {
+		      rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+		      rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -463,31 +476,36 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
-		    rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
-		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
-		  {
-		    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-		    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    {
+		      rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
+		      rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
+		    }
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
+		    {
+		      rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+		      rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -500,6 +518,8 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -516,6 +536,7 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const float    *tp_i = (float *)tp;
 	float          *x_i = (float *)x;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		head_result[2], tail_result[2];
 	float		matval   [2];
@@ -552,6 +573,11 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 	{
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_x(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_c, x_i + x_start,
+				     blas_gemm_elt_c, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -665,31 +691,22 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -699,31 +716,22 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -749,20 +757,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -773,20 +771,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -829,20 +817,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -853,20 +831,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -921,176 +889,165 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)vecval[0] * one[0];
-		    d2 = (double)-vecval[1] * one[1];
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)vecval[0] * one[0];
+		      d2 = (double)-vecval[1] * one[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[0] = head_e1;
+		      tail_rowtmp[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)vecval[0] * one[1];
+		      d2 = (double)vecval[1] * one[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[1] = head_e1;
+		      tail_rowtmp[1] = tail_e1;
 		    }
-		    head_rowtmp[0] = head_e1;
-		    tail_rowtmp[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)vecval[0] * one[1];
-		    d2 = (double)vecval[1] * one[0];
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)matval[0] * vecval[0];
+		      d2 = (double)-matval[1] * vecval[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[0] = head_e1;
+		      tail_rowtmp[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)matval[0] * vecval[1];
+		      d2 = (double)matval[1] * vecval[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[1] = head_e1;
+		      tail_rowtmp[1] = tail_e1;
 		    }
-		    head_rowtmp[1] = head_e1;
-		    tail_rowtmp[1] = tail_e1;
 		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
 		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
-		    d1 = (double)matval[0] * vecval[0];
-		    d2 = (double)-matval[1] * vecval[1];
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[0] = head_e1;
-		    tail_rowtmp[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)matval[0] * vecval[1];
-		    d2 = (double)matval[1] * vecval[0];
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[1] = head_e1;
-		    tail_rowtmp[1] = tail_e1;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		double		cd      [2];
@@ -1109,20 +1066,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1133,20 +1080,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1189,20 +1126,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1213,20 +1140,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1384,31 +1301,22 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -1418,31 +1326,22 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -1467,20 +1366,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1491,20 +1380,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1547,20 +1426,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1571,20 +1440,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1635,176 +1494,165 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
-		    /* Real part */
-		    d1 = (double)vecval[0] * one[0];
-		    d2 = (double)-vecval[1] * one[1];
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)vecval[0] * one[0];
+		      d2 = (double)-vecval[1] * one[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[0] = head_e1;
+		      tail_rowtmp[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)vecval[0] * one[1];
+		      d2 = (double)vecval[1] * one[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[1] = head_e1;
+		      tail_rowtmp[1] = tail_e1;
 		    }
-		    head_rowtmp[0] = head_e1;
-		    tail_rowtmp[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)vecval[0] * one[1];
-		    d2 = (double)vecval[1] * one[0];
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      double	    head_e1, tail_e1;
+		      double	    d1;
+		      double	    d2;
+		      /* Real part */
+		      d1 = (double)matval[0] * vecval[0];
+		      d2 = (double)-matval[1] * vecval[1];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[0] = head_e1;
+		      tail_rowtmp[0] = tail_e1;
+		      /* imaginary part */
+		      d1 = (double)matval[0] * vecval[1];
+		      d2 = (double)matval[1] * vecval[0];
+		      {
+			/* Compute double-double = double + double. */
+			double	      e , t1, t2;
+
+			/* Knuth trick. */
+			t1 = d1 + d2;
+			e = t1 - d1;
+			t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+			/* The result is t1 + t2, after normalization. */
+			head_e1 = t1 + t2;
+			tail_e1 = t2 - (head_e1 - t1);
+		      }
+		      head_rowtmp[1] = head_e1;
+		      tail_rowtmp[1] = tail_e1;
 		    }
-		    head_rowtmp[1] = head_e1;
-		    tail_rowtmp[1] = tail_e1;
 		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
 		  {
-		    double	    head_e1, tail_e1;
-		    double	    d1;
-		    double	    d2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
-		    d1 = (double)matval[0] * vecval[0];
-		    d2 = (double)-matval[1] * vecval[1];
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[0] = head_e1;
-		    tail_rowtmp[0] = tail_e1;
-		    /* imaginary part */
-		    d1 = (double)matval[0] * vecval[1];
-		    d2 = (double)matval[1] * vecval[0];
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
 		    {
-		      /* Compute double-double = double + double. */
-		      double	      e , t1, t2;
-
-		      /* Knuth trick. */
-		      t1 = d1 + d2;
-		      e = t1 - d1;
-		      t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-		      /* The result is t1 + t2, after normalization. */
-		      head_e1 = t1 + t2;
-		      tail_e1 = t2 - (head_e1 - t1);
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[1] = head_e1;
-		    tail_rowtmp[1] = tail_e1;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		double		cd      [2];
@@ -1823,20 +1671,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1847,20 +1685,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1903,20 +1731,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1927,20 +1745,10 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1988,6 +1796,8 @@ void		BLAS_ctpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
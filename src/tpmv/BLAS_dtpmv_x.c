@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_tpmv_cols.h"
 
 void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   		enum		blas_trans_type trans, enum blas_diag_type diag,
@@ -55,6 +56,7 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       {
@@ -66,6 +68,7 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *tp_i = tp;
 	double         *x_i = x;
 	double		rowsum;
+	double         *row_sum;
 	double		rowtmp;
 	double		result;
 	double		matval;
@@ -97,6 +100,11 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incx == 0) {
 	  BLAS_error(routine_name, -9, incx, NULL);
 	} {
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_d(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_d, x_i + x_start,
+				     blas_gemm_elt_d, incx);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -137,22 +145,26 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      rowsum = 0.0;
-	      rowtmp = 0.0;
-	      result = 0.0;
-	      while (col_index >= 0) {
-		vecval = x_i[x_index];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  rowtmp = vecval * one;
-		} else {
-		  matval = tp_i[tp_index];
-		  rowtmp = matval * vecval;
+	      if (row_sum != NULL) {
+		rowsum = row_sum[matrix_row];
+	      } else {
+		rowsum = 0.0;
+		rowtmp = 0.0;
+		result = 0.0;
+		while (col_index >= 0) {
+		  vecval = x_i[x_index];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    rowtmp = vecval * one;
+		  } else {
+		    matval = tp_i[tp_index];
+		    rowtmp = matval * vecval;
+		  }
+		  rowsum = rowsum + rowtmp;
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		rowsum = rowsum + rowtmp;
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      result = rowsum * alpha_i;
 	      x_i[x_index2] = result;
@@ -193,22 +205,26 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      rowsum = 0.0;
-	      rowtmp = 0.0;
-	      result = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval = x_i[x_index2];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  rowtmp = vecval * one;
-		} else {
-		  matval = tp_i[tp_index];
-		  rowtmp = matval * vecval;
+	      if (row_sum != NULL) {
+		rowsum = row_sum[matrix_row];
+	      } else {
+		rowsum = 0.0;
+		rowtmp = 0.0;
+		result = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval = x_i[x_index2];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    rowtmp = vecval * one;
+		  } else {
+		    matval = tp_i[tp_index];
+		    rowtmp = matval * vecval;
+		  }
+		  rowsum = rowsum + rowtmp;
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		rowsum = rowsum + rowtmp;
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      result = rowsum * alpha_i;
 	      x_i[x_index] = result;
@@ -217,6 +233,8 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -233,6 +251,7 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *tp_i = tp;
 	double         *x_i = x;
 	double		head_rowsum, tail_rowsum;
+	double         *row_sum;
 	double		head_rowtmp, tail_rowtmp;
 	double		head_result, tail_result;
 	double		matval;
@@ -268,6 +287,11 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 	{
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_x(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_d, x_i + x_start,
+				     blas_gemm_elt_d, incx);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -286,65 +310,34 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		if ((diag == blas_unit_diag) && (col_index == matrix_row)) {
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = vecval * split;
-		    a1 = con - vecval;
-		    a1 = con - a1;
-		    a2 = vecval - a1;
-		    con = one * split;
-		    b1 = con - one;
-		    b1 = con - b1;
-		    b2 = one - b1;
-
 		    head_rowtmp = vecval * one;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_rowtmp = BLAS_TWO_PROD_ERR(vecval, one, head_rowtmp);
 		  }
 		} else {
 		  matval = tp_i[tp_index];
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = matval * split;
-		    a1 = con - matval;
-		    a1 = con - a1;
-		    a2 = matval - a1;
-		    con = vecval * split;
-		    b1 = con - vecval;
-		    b1 = con - b1;
-		    b2 = vecval - b1;
-
 		    head_rowtmp = matval * vecval;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
 		  }
 		}
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_rowsum + head_rowtmp;
 		  bv = s1 - head_rowsum;
 		  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_rowsum + tail_rowtmp;
-		  bv = t1 - tail_rowsum;
-		  t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-		  s2 += t1;
+		  /* Add the lo words to the error. */
+		  s2 += tail_rowsum + tail_rowtmp;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_rowsum = t1 + t2;
-		  tail_rowsum = t2 - (head_rowsum - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_rowsum = s1 + s2;
+		  tail_rowsum = s2 - (head_rowsum - s1);
 		}
 		x_index += incx;
 		tp_index += inctp;
@@ -352,19 +345,10 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_rowsum * split;
-		a11 = con - head_rowsum;
-		a11 = con - a11;
-		a21 = head_rowsum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_rowsum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		c2 = tail_rowsum * alpha_i;
 		t1 = c11 + c2;
@@ -386,94 +370,59 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      head_rowsum = tail_rowsum = 0.0;
-	      head_rowtmp = tail_rowtmp = 0.0;
-	      head_result = tail_result = 0.0;
-	      while (col_index >= 0) {
-		vecval = x_i[x_index];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = vecval * split;
-		    a1 = con - vecval;
-		    a1 = con - a1;
-		    a2 = vecval - a1;
-		    con = one * split;
-		    b1 = con - one;
-		    b1 = con - b1;
-		    b2 = one - b1;
-
-		    head_rowtmp = vecval * one;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+	      if (row_sum != NULL) {
+		head_rowsum = row_sum[2 * matrix_row];
+		tail_rowsum = row_sum[2 * matrix_row + 1];
+	      } else {
+		head_rowsum = tail_rowsum = 0.0;
+		head_rowtmp = tail_rowtmp = 0.0;
+		head_result = tail_result = 0.0;
+		while (col_index >= 0) {
+		  vecval = x_i[x_index];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    {
+		      /* Compute double_double = double * double. */
+		      head_rowtmp = vecval * one;
+		      tail_rowtmp = BLAS_TWO_PROD_ERR(vecval, one, head_rowtmp);
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      /* Compute double_double = double * double. */
+		      head_rowtmp = matval * vecval;
+		      tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+		    }
 		  }
-		} else {
-		  matval = tp_i[tp_index];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = matval * split;
-		    a1 = con - matval;
-		    a1 = con - a1;
-		    a2 = matval - a1;
-		    con = vecval * split;
-		    b1 = con - vecval;
-		    b1 = con - b1;
-		    b2 = vecval - b1;
-
-		    head_rowtmp = matval * vecval;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_rowsum + head_rowtmp;
+		    bv = s1 - head_rowsum;
+		    s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_rowsum + tail_rowtmp;
+
+		    /* Renormalize (s1, s2)  */
+		    head_rowsum = s1 + s2;
+		    tail_rowsum = s2 - (head_rowsum - s1);
 		  }
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_rowsum + head_rowtmp;
-		  bv = s1 - head_rowsum;
-		  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_rowsum + tail_rowtmp;
-		  bv = t1 - tail_rowsum;
-		  t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_rowsum = t1 + t2;
-		  tail_rowsum = t2 - (head_rowsum - t1);
-		}
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_rowsum * split;
-		a11 = con - head_rowsum;
-		a11 = con - a11;
-		a21 = head_rowsum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_rowsum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		c2 = tail_rowsum * alpha_i;
 		t1 = c11 + c2;
@@ -503,84 +452,44 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		if ((diag == blas_unit_diag) && (step == 0)) {
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = vecval * split;
-		    a1 = con - vecval;
-		    a1 = con - a1;
-		    a2 = vecval - a1;
-		    con = one * split;
-		    b1 = con - one;
-		    b1 = con - b1;
-		    b2 = one - b1;
-
 		    head_rowtmp = vecval * one;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_rowtmp = BLAS_TWO_PROD_ERR(vecval, one, head_rowtmp);
 		  }
 		} else {
 		  matval = tp_i[tp_index];
 		  {
 		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = matval * split;
-		    a1 = con - matval;
-		    a1 = con - a1;
-		    a2 = matval - a1;
-		    con = vecval * split;
-		    b1 = con - vecval;
-		    b1 = con - b1;
-		    b2 = vecval - b1;
-
 		    head_rowtmp = matval * vecval;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
 		  }
 		}
 		{
-		  /* Compute double-double = double-double + double-double. */
+		  /* Compute double-double = double-double + double-double,
+		     renormalizing once. */
 		  double	  bv;
-		  double	  s1    , s2, t1, t2;
+		  double	  s1    , s2;
 
 		  /* Add two hi words. */
 		  s1 = head_rowsum + head_rowtmp;
 		  bv = s1 - head_rowsum;
 		  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
 
-		  /* Add two lo words. */
-		  t1 = tail_rowsum + tail_rowtmp;
-		  bv = t1 - tail_rowsum;
-		  t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-		  s2 += t1;
+		  /* Add the lo words to the error. */
+		  s2 += tail_rowsum + tail_rowtmp;
 
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_rowsum = t1 + t2;
-		  tail_rowsum = t2 - (head_rowsum - t1);
+		  /* Renormalize (s1, s2)  */
+		  head_rowsum = s1 + s2;
+		  tail_rowsum = s2 - (head_rowsum - s1);
 		}
 		x_index2 -= incx;
 		tp_index -= inctp;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_rowsum * split;
-		a11 = con - head_rowsum;
-		a11 = con - a11;
-		a21 = head_rowsum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_rowsum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		c2 = tail_rowsum * alpha_i;
 		t1 = c11 + c2;
@@ -598,94 +507,59 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      head_rowsum = tail_rowsum = 0.0;
-	      head_rowtmp = tail_rowtmp = 0.0;
-	      head_result = tail_result = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval = x_i[x_index2];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = vecval * split;
-		    a1 = con - vecval;
-		    a1 = con - a1;
-		    a2 = vecval - a1;
-		    con = one * split;
-		    b1 = con - one;
-		    b1 = con - b1;
-		    b2 = one - b1;
-
-		    head_rowtmp = vecval * one;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+	      if (row_sum != NULL) {
+		head_rowsum = row_sum[2 * matrix_row];
+		tail_rowsum = row_sum[2 * matrix_row + 1];
+	      } else {
+		head_rowsum = tail_rowsum = 0.0;
+		head_rowtmp = tail_rowtmp = 0.0;
+		head_result = tail_result = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval = x_i[x_index2];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    {
+		      /* Compute double_double = double * double. */
+		      head_rowtmp = vecval * one;
+		      tail_rowtmp = BLAS_TWO_PROD_ERR(vecval, one, head_rowtmp);
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      /* Compute double_double = double * double. */
+		      head_rowtmp = matval * vecval;
+		      tail_rowtmp = BLAS_TWO_PROD_ERR(matval, vecval, head_rowtmp);
+		    }
 		  }
-		} else {
-		  matval = tp_i[tp_index];
 		  {
-		    /* Compute double_double = double * double. */
-		    double	    a1  , a2, b1, b2, con;
-
-		    con = matval * split;
-		    a1 = con - matval;
-		    a1 = con - a1;
-		    a2 = matval - a1;
-		    con = vecval * split;
-		    b1 = con - vecval;
-		    b1 = con - b1;
-		    b2 = vecval - b1;
-
-		    head_rowtmp = matval * vecval;
-		    tail_rowtmp = (((a1 * b1 - head_rowtmp) + a1 * b2) + a2 * b1) + a2 * b2;
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
+		    double	  bv;
+		    double	  s1    , s2;
+
+		    /* Add two hi words. */
+		    s1 = head_rowsum + head_rowtmp;
+		    bv = s1 - head_rowsum;
+		    s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
+
+		    /* Add the lo words to the error. */
+		    s2 += tail_rowsum + tail_rowtmp;
+
+		    /* Renormalize (s1, s2)  */
+		    head_rowsum = s1 + s2;
+		    tail_rowsum = s2 - (head_rowsum - s1);
 		  }
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		{
-		  /* Compute double-double = double-double + double-double. */
-		  double	  bv;
-		  double	  s1    , s2, t1, t2;
-
-		  /* Add two hi words. */
-		  s1 = head_rowsum + head_rowtmp;
-		  bv = s1 - head_rowsum;
-		  s2 = ((head_rowtmp - bv) + (head_rowsum - (s1 - bv)));
-
-		  /* Add two lo words. */
-		  t1 = tail_rowsum + tail_rowtmp;
-		  bv = t1 - tail_rowsum;
-		  t2 = ((tail_rowtmp - bv) + (tail_rowsum - (t1 - bv)));
-
-		  s2 += t1;
-
-		  /* Renormalize (s1, s2)  to  (t1, s2) */
-		  t1 = s1 + s2;
-		  s2 = s2 - (t1 - s1);
-
-		  t2 += s2;
-
-		  /* Renormalize (t1, t2)  */
-		  head_rowsum = t1 + t2;
-		  tail_rowsum = t2 - (head_rowsum - t1);
-		}
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_rowsum * split;
-		a11 = con - head_rowsum;
-		a11 = con - a11;
-		a21 = head_rowsum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_rowsum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_rowsum, alpha_i, c11);
 
 		c2 = tail_rowsum * alpha_i;
 		t1 = c11 + c2;
@@ -700,6 +574,8 @@ void		BLAS_dtpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
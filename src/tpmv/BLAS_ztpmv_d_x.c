@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_tpmv_cols.h"
 
 void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     		enum		blas_trans_type trans, enum blas_diag_type diag,
@@ -55,6 +56,7 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       {
@@ -66,6 +68,7 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *tp_i = tp;
 	double         *x_i = (double *)x;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		result  [2];
 	double		matval;
@@ -97,6 +100,11 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incx == 0) {
 	  BLAS_error(routine_name, -9, incx, NULL);
 	} {
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_d(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_d, x_i + x_start,
+				     blas_gemm_elt_z, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -149,30 +157,35 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    rowtmp[0] = vecval[0] * one;
-		    rowtmp[1] = vecval[1] * one;
-		  }
-		} else {
-		  matval = tp_i[tp_index];
-		  {
-		    rowtmp[0] = vecval[0] * matval;
-		    rowtmp[1] = vecval[1] * matval;
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    {
+		      rowtmp[0] = vecval[0] * one;
+		      rowtmp[1] = vecval[1] * one;
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      rowtmp[0] = vecval[0] * matval;
+		      rowtmp[1] = vecval[1] * matval;
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -229,30 +242,35 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    rowtmp[0] = vecval[0] * one;
-		    rowtmp[1] = vecval[1] * one;
-		  }
-		} else {
-		  matval = tp_i[tp_index];
-		  {
-		    rowtmp[0] = vecval[0] * matval;
-		    rowtmp[1] = vecval[1] * matval;
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    {
+		      rowtmp[0] = vecval[0] * one;
+		      rowtmp[1] = vecval[1] * one;
+		    }
+		  } else {
+		    matval = tp_i[tp_index];
+		    {
+		      rowtmp[0] = vecval[0] * matval;
+		      rowtmp[1] = vecval[1] * matval;
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -265,6 +283,8 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -281,6 +301,7 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *tp_i = tp;
 	double         *x_i = (double *)x;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		head_result[2], tail_result[2];
 	double		matval;
@@ -316,6 +337,11 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 	{
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_x(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_d, x_i + x_start,
+				     blas_gemm_elt_z, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -338,37 +364,15 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    double	    head_t, tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t = one * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(one, vecval[0], head_t);
 		    }
 		    head_rowtmp[0] = head_t;
 		    tail_rowtmp[0] = tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t = one * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(one, vecval[1], head_t);
 		    }
 		    head_rowtmp[1] = head_t;
 		    tail_rowtmp[1] = tail_t;
@@ -380,37 +384,15 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    double	    head_t, tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t = matval * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(matval, vecval[0], head_t);
 		    }
 		    head_rowtmp[0] = head_t;
 		    tail_rowtmp[0] = tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t = matval * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(matval, vecval[1], head_t);
 		    }
 		    head_rowtmp[1] = head_t;
 		    tail_rowtmp[1] = tail_t;
@@ -426,31 +408,22 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -460,31 +433,22 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -506,20 +470,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -530,20 +484,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -586,20 +530,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -610,20 +544,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -677,173 +601,118 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t = one * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = one * vecval[0];
+			tail_t = BLAS_TWO_PROD_ERR(one, vecval[0], head_t);
+		      }
+		      head_rowtmp[0] = head_t;
+		      tail_rowtmp[0] = tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = one * vecval[1];
+			tail_t = BLAS_TWO_PROD_ERR(one, vecval[1], head_t);
+		      }
+		      head_rowtmp[1] = head_t;
+		      tail_rowtmp[1] = tail_t;
 		    }
-		    head_rowtmp[0] = head_t;
-		    tail_rowtmp[0] = tail_t;
+		  } else {
+		    matval = tp_i[tp_index];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t = one * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = matval * vecval[0];
+			tail_t = BLAS_TWO_PROD_ERR(matval, vecval[0], head_t);
+		      }
+		      head_rowtmp[0] = head_t;
+		      tail_rowtmp[0] = tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = matval * vecval[1];
+			tail_t = BLAS_TWO_PROD_ERR(matval, vecval[1], head_t);
+		      }
+		      head_rowtmp[1] = head_t;
+		      tail_rowtmp[1] = tail_t;
 		    }
-		    head_rowtmp[1] = head_t;
-		    tail_rowtmp[1] = tail_t;
 		  }
-		} else {
-		  matval = tp_i[tp_index];
 		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t = matval * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[0] = head_t;
-		    tail_rowtmp[0] = tail_t;
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t = matval * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[1] = head_t;
-		    tail_rowtmp[1] = tail_t;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		/* Compute complex-extra = complex-extra * complex-double. */
@@ -858,20 +727,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -882,20 +741,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -938,20 +787,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -962,20 +801,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1041,37 +870,15 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    double	    head_t, tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t = one * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(one, vecval[0], head_t);
 		    }
 		    head_rowtmp[0] = head_t;
 		    tail_rowtmp[0] = tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t = one * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(one, vecval[1], head_t);
 		    }
 		    head_rowtmp[1] = head_t;
 		    tail_rowtmp[1] = tail_t;
@@ -1083,37 +890,15 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    double	    head_t, tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t = matval * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(matval, vecval[0], head_t);
 		    }
 		    head_rowtmp[0] = head_t;
 		    tail_rowtmp[0] = tail_t;
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t = matval * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t = BLAS_TWO_PROD_ERR(matval, vecval[1], head_t);
 		    }
 		    head_rowtmp[1] = head_t;
 		    tail_rowtmp[1] = tail_t;
@@ -1129,31 +914,22 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -1163,31 +939,22 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -1208,20 +975,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1232,20 +989,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1288,20 +1035,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1312,20 +1049,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1375,173 +1102,118 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t = one * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = one * vecval[0];
+			tail_t = BLAS_TWO_PROD_ERR(one, vecval[0], head_t);
+		      }
+		      head_rowtmp[0] = head_t;
+		      tail_rowtmp[0] = tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = one * vecval[1];
+			tail_t = BLAS_TWO_PROD_ERR(one, vecval[1], head_t);
+		      }
+		      head_rowtmp[1] = head_t;
+		      tail_rowtmp[1] = tail_t;
 		    }
-		    head_rowtmp[0] = head_t;
-		    tail_rowtmp[0] = tail_t;
+		  } else {
+		    matval = tp_i[tp_index];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = one * split;
-		      a1 = con - one;
-		      a1 = con - a1;
-		      a2 = one - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t = one * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute complex-extra = complex-double * real. */
+		      double	    head_t, tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = matval * vecval[0];
+			tail_t = BLAS_TWO_PROD_ERR(matval, vecval[0], head_t);
+		      }
+		      head_rowtmp[0] = head_t;
+		      tail_rowtmp[0] = tail_t;
+		      {
+			/* Compute double_double = double * double. */
+			head_t = matval * vecval[1];
+			tail_t = BLAS_TWO_PROD_ERR(matval, vecval[1], head_t);
+		      }
+		      head_rowtmp[1] = head_t;
+		      tail_rowtmp[1] = tail_t;
 		    }
-		    head_rowtmp[1] = head_t;
-		    tail_rowtmp[1] = tail_t;
 		  }
-		} else {
-		  matval = tp_i[tp_index];
 		  {
-		    /* Compute complex-extra = complex-double * real. */
-		    double	    head_t, tail_t;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
+		    /* Real part */
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t = matval * vecval[0];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[0] = head_t;
-		    tail_rowtmp[0] = tail_t;
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
+		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval * split;
-		      a1 = con - matval;
-		      a1 = con - a1;
-		      a2 = matval - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t = matval * vecval[1];
-		      tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
+
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[1] = head_t;
-		    tail_rowtmp[1] = tail_t;
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
-		}
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		/* Compute complex-extra = complex-extra * complex-double. */
@@ -1556,20 +1228,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1580,20 +1242,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1636,20 +1288,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1660,20 +1302,10 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1720,6 +1352,8 @@ void		BLAS_ztpmv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
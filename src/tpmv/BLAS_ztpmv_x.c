@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_tpmv_cols.h"
 
 void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   		enum		blas_trans_type trans, enum blas_diag_type diag,
@@ -55,6 +56,7 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       {
@@ -66,6 +68,7 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *tp_i = (double *)tp;
 	double         *x_i = (double *)x;
 	double		rowsum  [2];
+	double         *row_sum;
 	double		rowtmp  [2];
 	double		result  [2];
 	double		matval  [2];
@@ -98,6 +101,11 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	if (incx == 0) {
 	  BLAS_error(routine_name, -9, incx, NULL);
 	} {
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_d(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_z, x_i + x_start,
+				     blas_gemm_elt_z, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -151,31 +159,36 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
-		    rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
-		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
-		  {
-		    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-		    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
+		    {
+		      rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
+		      rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
+		    }
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
+		    {
+		      rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+		      rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -233,31 +246,36 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      rowsum[0] = rowsum[1] = 0.0;
-	      rowtmp[0] = rowtmp[1] = 0.0;
-	      result[0] = result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
-		    rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
-		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
-		  {
-		    rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
-		    rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+	      if (row_sum != NULL) {
+		rowsum[0] = row_sum[2 * matrix_row];
+		rowsum[1] = row_sum[2 * matrix_row + 1];
+	      } else {
+		rowsum[0] = rowsum[1] = 0.0;
+		rowtmp[0] = rowtmp[1] = 0.0;
+		result[0] = result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
+		    {
+		      rowtmp[0] = (double)vecval[0] * one[0] - (double)vecval[1] * one[1];
+		      rowtmp[1] = (double)vecval[0] * one[1] + (double)vecval[1] * one[0];
+		    }
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
+		    {
+		      rowtmp[0] = (double)matval[0] * vecval[0] - (double)matval[1] * vecval[1];
+		      rowtmp[1] = (double)matval[0] * vecval[1] + (double)matval[1] * vecval[0];
+		    }
 		  }
+		  rowsum[0] = rowsum[0] + rowtmp[0];
+		  rowsum[1] = rowsum[1] + rowtmp[1];
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		rowsum[0] = rowsum[0] + rowtmp[0];
-		rowsum[1] = rowsum[1] + rowtmp[1];
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		result[0] = (double)rowsum[0] * alpha_i[0] - (double)rowsum[1] * alpha_i[1];
@@ -270,6 +288,8 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
@@ -286,6 +306,7 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	const double   *tp_i = (double *)tp;
 	double         *x_i = (double *)x;
 	double		head_rowsum[2], tail_rowsum[2];
+	double         *row_sum;
 	double		head_rowtmp[2], tail_rowtmp[2];
 	double		head_result[2], tail_result[2];
 	double		matval  [2];
@@ -322,6 +343,11 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 	{
+	  /* One pass over the packed columns into row sums. */
+	  row_sum = blas_tpmv_cols_x(order, uplo, trans, diag, n, tp_i,
+				     blas_gemm_elt_z, x_i + x_start,
+				     blas_gemm_elt_z, incx / 2);
+
 	  if ((uplo == blas_upper &&
 	       trans == blas_no_trans && order == blas_rowmajor) ||
 	      (uplo == blas_lower &&
@@ -349,132 +375,64 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* Real part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
 		      head_t1 = vecval[0] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], one[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
 		      head_t2 = vecval[1] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], one[1], head_t2);
 		    }
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[0] = head_t1;
 		    tail_rowtmp[0] = tail_t1;
 		    /* Imaginary part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
 		      head_t1 = vecval[1] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], one[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
 		      head_t2 = vecval[0] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], one[1], head_t2);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[1] = head_t1;
 		    tail_rowtmp[1] = tail_t1;
@@ -492,132 +450,64 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* Real part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t1 = matval[0] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t2 = matval[1] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
 		    }
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[0] = head_t1;
 		    tail_rowtmp[0] = tail_t1;
 		    /* Imaginary part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t1 = matval[1] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t2 = matval[0] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[1] = head_t1;
 		    tail_rowtmp[1] = tail_t1;
@@ -633,31 +523,22 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -667,31 +548,22 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -713,20 +585,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -737,20 +599,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -793,20 +645,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -817,20 +659,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -884,374 +716,227 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      x_index = x_start + incx * (n - 1);
 	      tp_index = (tp_start + matrix_row) * inctp;
 	      col_index = (n - 1) - matrix_row;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      while (col_index >= 0) {
-		vecval[0] = x_i[x_index];
-		vecval[1] = x_i[x_index + 1];
-		if ((diag == blas_unit_diag) && (col_index == 0)) {
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
-		      head_t1 = vecval[0] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
-		      head_t2 = vecval[1] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		while (col_index >= 0) {
+		  vecval[0] = x_i[x_index];
+		  vecval[1] = x_i[x_index + 1];
+		  if ((diag == blas_unit_diag) && (col_index == 0)) {
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_rowtmp[0] = head_t1;
-		    tail_rowtmp[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
-		      head_t1 = vecval[1] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
-		      head_t2 = vecval[0] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = vecval[0] * one[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], one[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = vecval[1] * one[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], one[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[0] = head_t1;
+		      tail_rowtmp[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = vecval[1] * one[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], one[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = vecval[0] * one[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], one[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[1] = head_t1;
+		      tail_rowtmp[1] = tail_t1;
 		    }
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = matval[0] * vecval[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = matval[1] * vecval[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[0] = head_t1;
+		      tail_rowtmp[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = matval[1] * vecval[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = matval[0] * vecval[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[1] = head_t1;
+		      tail_rowtmp[1] = tail_t1;
 		    }
-		    head_rowtmp[1] = head_t1;
-		    tail_rowtmp[1] = tail_t1;
 		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
 		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t1 = matval[0] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t2 = matval[1] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[0] = head_t1;
-		    tail_rowtmp[0] = tail_t1;
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
 		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t1 = matval[1] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t2 = matval[0] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[1] = head_t1;
-		    tail_rowtmp[1] = tail_t1;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
+		  x_index -= incx;
+		  tp_index -= inctp2 * inctp;
+		  inctp2--;
+		  col_index--;
 		}
-		x_index -= incx;
-		tp_index -= inctp2 * inctp;
-		inctp2--;
-		col_index--;
 	      }
 	      {
 		/* Compute complex-extra = complex-extra * complex-double. */
@@ -1266,20 +951,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1290,20 +965,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1346,20 +1011,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1370,20 +1025,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1454,132 +1099,64 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* Real part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
 		      head_t1 = vecval[0] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], one[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
 		      head_t2 = vecval[1] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], one[1], head_t2);
 		    }
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[0] = head_t1;
 		    tail_rowtmp[0] = tail_t1;
 		    /* Imaginary part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
 		      head_t1 = vecval[1] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], one[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
 		      head_t2 = vecval[0] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], one[1], head_t2);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[1] = head_t1;
 		    tail_rowtmp[1] = tail_t1;
@@ -1597,132 +1174,64 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* Real part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t1 = matval[0] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t2 = matval[1] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
 		    }
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[0] = head_t1;
 		    tail_rowtmp[0] = tail_t1;
 		    /* Imaginary part */
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
 		      head_t1 = matval[1] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
 		    }
 		    {
 		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
 		      head_t2 = matval[0] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_rowtmp[1] = head_t1;
 		    tail_rowtmp[1] = tail_t1;
@@ -1738,31 +1247,22 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[0];
 		  tail_b = tail_rowtmp[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[0] = head_t;
 		  tail_rowsum[0] = tail_t;
@@ -1772,31 +1272,22 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_b = head_rowtmp[1];
 		  tail_b = tail_rowtmp[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_a + head_b;
 		    bv = s1 - head_a;
 		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_a + tail_b;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_t = s1 + s2;
+		    tail_t = s2 - (head_t - s1);
 		  }
 		  head_rowsum[1] = head_t;
 		  tail_rowsum[1] = tail_t;
@@ -1817,20 +1308,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1841,20 +1322,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1897,20 +1368,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1921,20 +1382,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1984,374 +1435,227 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    for (matrix_row = n - 1; matrix_row >= 0; matrix_row--) {
 	      tp_index = matrix_row * inctp;
 	      x_index2 = x_start;
-	      head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
-	      head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
-	      head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
-	      stride = n;
-	      for (step = 0; step <= matrix_row; step++) {
-		vecval[0] = x_i[x_index2];
-		vecval[1] = x_i[x_index2 + 1];
-		if ((diag == blas_unit_diag) && (step == matrix_row)) {
-		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
-		    /* Real part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
-		      head_t1 = vecval[0] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
-		      head_t2 = vecval[1] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
+	      if (row_sum != NULL) {
+		head_rowsum[0] = row_sum[4 * matrix_row];
+		head_rowsum[1] = row_sum[4 * matrix_row + 1];
+		tail_rowsum[0] = row_sum[4 * matrix_row + 2];
+		tail_rowsum[1] = row_sum[4 * matrix_row + 3];
+	      } else {
+		head_rowsum[0] = head_rowsum[1] = tail_rowsum[0] = tail_rowsum[1] = 0.0;
+		head_rowtmp[0] = head_rowtmp[1] = tail_rowtmp[0] = tail_rowtmp[1] = 0.0;
+		head_result[0] = head_result[1] = tail_result[0] = tail_result[1] = 0.0;
+		stride = n;
+		for (step = 0; step <= matrix_row; step++) {
+		  vecval[0] = x_i[x_index2];
+		  vecval[1] = x_i[x_index2 + 1];
+		  if ((diag == blas_unit_diag) && (step == matrix_row)) {
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
-		    }
-		    head_rowtmp[0] = head_t1;
-		    tail_rowtmp[0] = tail_t1;
-		    /* Imaginary part */
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[1] * split;
-		      a1 = con - vecval[1];
-		      a1 = con - a1;
-		      a2 = vecval[1] - a1;
-		      con = one[0] * split;
-		      b1 = con - one[0];
-		      b1 = con - b1;
-		      b2 = one[0] - b1;
-
-		      head_t1 = vecval[1] * one[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = vecval[0] * split;
-		      a1 = con - vecval[0];
-		      a1 = con - a1;
-		      a2 = vecval[0] - a1;
-		      con = one[1] * split;
-		      b1 = con - one[1];
-		      b1 = con - b1;
-		      b2 = one[1] - b1;
-
-		      head_t2 = vecval[0] * one[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = vecval[0] * one[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(vecval[0], one[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = vecval[1] * one[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(vecval[1], one[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[0] = head_t1;
+		      tail_rowtmp[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = vecval[1] * one[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(vecval[1], one[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = vecval[0] * one[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(vecval[0], one[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[1] = head_t1;
+		      tail_rowtmp[1] = tail_t1;
 		    }
+		  } else {
+		    matval[0] = tp_i[tp_index];
+		    matval[1] = tp_i[tp_index + 1];
 		    {
 		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
+		       * Compute complex-extra = complex-double *
+		       * complex-double.
 		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
-
-		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      double	    head_t1, tail_t1;
+		      double	    head_t2, tail_t2;
+		      /* Real part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = matval[0] * vecval[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(matval[0], vecval[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = matval[1] * vecval[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(matval[1], vecval[1], head_t2);
+		      }
+		      head_t2 = -head_t2;
+		      tail_t2 = -tail_t2;
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[0] = head_t1;
+		      tail_rowtmp[0] = tail_t1;
+		      /* Imaginary part */
+		      {
+			/* Compute double_double = double * double. */
+			head_t1 = matval[1] * vecval[0];
+			tail_t1 = BLAS_TWO_PROD_ERR(matval[1], vecval[0], head_t1);
+		      }
+		      {
+			/* Compute double_double = double * double. */
+			head_t2 = matval[0] * vecval[1];
+			tail_t2 = BLAS_TWO_PROD_ERR(matval[0], vecval[1], head_t2);
+		      }
+		      {
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
+			double	      bv;
+			double	      s1, s2;
+
+			/* Add two hi words. */
+			s1 = head_t1 + head_t2;
+			bv = s1 - head_t1;
+			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
+
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
+		      }
+		      head_rowtmp[1] = head_t1;
+		      tail_rowtmp[1] = tail_t1;
 		    }
-		    head_rowtmp[1] = head_t1;
-		    tail_rowtmp[1] = tail_t1;
 		  }
-		} else {
-		  matval[0] = tp_i[tp_index];
-		  matval[1] = tp_i[tp_index + 1];
 		  {
-		    /*
-		     * Compute complex-extra = complex-double *
-		     * complex-double.
-		     */
-		    double	    head_t1, tail_t1;
-		    double	    head_t2, tail_t2;
+		    double	  head_t, tail_t;
+		    double	  head_a, tail_a;
+		    double	  head_b, tail_b;
 		    /* Real part */
+		    head_a = head_rowsum[0];
+		    tail_a = tail_rowsum[0];
+		    head_b = head_rowtmp[0];
+		    tail_b = tail_rowtmp[0];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t1 = matval[0] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t2 = matval[1] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    head_t2 = -head_t2;
-		    tail_t2 = -tail_t2;
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[0] = head_t1;
-		    tail_rowtmp[0] = tail_t1;
+		    head_rowsum[0] = head_t;
+		    tail_rowsum[0] = tail_t;
 		    /* Imaginary part */
+		    head_a = head_rowsum[1];
+		    tail_a = tail_rowsum[1];
+		    head_b = head_rowtmp[1];
+		    tail_b = tail_rowtmp[1];
 		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[1] * split;
-		      a1 = con - matval[1];
-		      a1 = con - a1;
-		      a2 = matval[1] - a1;
-		      con = vecval[0] * split;
-		      b1 = con - vecval[0];
-		      b1 = con - b1;
-		      b2 = vecval[0] - b1;
-
-		      head_t1 = matval[1] * vecval[0];
-		      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /* Compute double_double = double * double. */
-		      double	      a1, a2, b1, b2, con;
-
-		      con = matval[0] * split;
-		      a1 = con - matval[0];
-		      a1 = con - a1;
-		      a2 = matval[0] - a1;
-		      con = vecval[1] * split;
-		      b1 = con - vecval[1];
-		      b1 = con - b1;
-		      b2 = vecval[1] - b1;
-
-		      head_t2 = matval[0] * vecval[1];
-		      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-		    }
-		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
-		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      /* Compute double-double = double-double + double-double,
+			 renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
 
 		      /* Add two hi words. */
-		      s1 = head_t1 + head_t2;
-		      bv = s1 - head_t1;
-		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      s1 = head_a + head_b;
+		      bv = s1 - head_a;
+		      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_a + tail_b;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t = s1 + s2;
+		      tail_t = s2 - (head_t - s1);
 		    }
-		    head_rowtmp[1] = head_t1;
-		    tail_rowtmp[1] = tail_t1;
-		  }
-		}
-		{
-		  double	  head_t, tail_t;
-		  double	  head_a, tail_a;
-		  double	  head_b, tail_b;
-		  /* Real part */
-		  head_a = head_rowsum[0];
-		  tail_a = tail_rowsum[0];
-		  head_b = head_rowtmp[0];
-		  tail_b = tail_rowtmp[0];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
+		    head_rowsum[1] = head_t;
+		    tail_rowsum[1] = tail_t;
 		  }
-		  head_rowsum[0] = head_t;
-		  tail_rowsum[0] = tail_t;
-		  /* Imaginary part */
-		  head_a = head_rowsum[1];
-		  tail_a = tail_rowsum[1];
-		  head_b = head_rowtmp[1];
-		  tail_b = tail_rowtmp[1];
-		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_a + head_b;
-		    bv = s1 - head_a;
-		    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_a + tail_b;
-		    bv = t1 - tail_a;
-		    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_t = t1 + t2;
-		    tail_t = t2 - (head_t - t1);
-		  }
-		  head_rowsum[1] = head_t;
-		  tail_rowsum[1] = tail_t;
+		  stride--;
+		  tp_index += stride * inctp;
+		  x_index2 += incx;
 		}
-		stride--;
-		tp_index += stride * inctp;
-		x_index2 += incx;
 	      }
 	      {
 		/* Compute complex-extra = complex-extra * complex-double. */
@@ -2366,20 +1670,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -2390,20 +1684,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -2446,20 +1730,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -2470,20 +1744,10 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -2530,6 +1794,8 @@ void		BLAS_ztpmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	  }
 	}
 
+	blas_free(row_sum);
+
 
       }
       break;
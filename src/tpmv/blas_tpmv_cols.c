@@ -0,0 +1,334 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_malloc.h"
+#include "blas_tpmv_cols.h"
+
+/*
+ * Row sums of op(T) * x from one pass over the packed columns of op(T).
+ *
+ * Column k of a lower op(T) holds rows t >= k, from its diagonal down;
+ * it starts k * (2n - k - 1) / 2 elements past row k's place, so that
+ * element t sits at that offset plus t.  Column k of an upper op(T)
+ * holds rows t <= k, down to its diagonal, from k * (k + 1) / 2 on.  The
+ * row loops add op(T)(i, k) * x[k] for k from 0 up to i (lower) or from
+ * n - 1 down to i (upper); taking the columns in that same order keeps
+ * every row's terms in its order, the diagonal last.
+ *
+ * The products are those the generated code forms for the pair of types:
+ *
+ *   complex float by complex float   exact double products, each part
+ *                                    summed with the Knuth trick
+ *   other complex by complex         four two-products, added in pairs
+ *   real by complex, real by real    two-products, exact (and added as
+ *                                    doubles) for float T and x
+ *
+ * A unit diagonal is the product of x[k] by one, formed as those loops
+ * form it.  Below (lower) or above (upper) the diagonal each column goes
+ * through the column kernel of blas_dd_vec.h, complex by complex through
+ * the complex one; real T against complex x takes the real parts of x,
+ * then the imaginary parts, as GEMV does.
+ */
+
+enum cols_mode {
+  cols_real,
+  cols_x_complex,		/* real T, complex x */
+  cols_complex,
+  cols_complex_single		/* complex float T and x */
+};
+
+struct tpmv_cols {
+  int n;
+  const void *a;
+  int a_single, x_single;
+  int lower;			/* op(T) is lower triangular */
+  int unit;
+  enum cols_mode mode;
+};
+
+/* Real component k of p. */
+static double elt(const void *p, int single, long k)
+{
+  return single ? ((const float *) p)[k] : ((const double *) p)[k];
+}
+
+/* Where column k starts, less the elements of the rows it leaves out. */
+static long col_off(const struct tpmv_cols *s, int k)
+{
+  if (s->lower)
+    return (long) k * (2 * s->n - k - 1) / 2;
+  return (long) k * (k + 1) / 2;
+}
+
+/* Element k of T and on. */
+static const void *elt_ptr(const struct tpmv_cols *s, long k)
+{
+  return s->a_single ? (const void *) ((const float *) s->a + k)
+    : (const void *) ((const double *) s->a + k);
+}
+
+/* Sweep setup for the order, uplo and trans of TPMV and the types of T
+   and x; 0 when the rows of op(T) are contiguous instead. */
+static int cols_init(struct tpmv_cols *s, enum blas_order_type order,
+		     enum blas_uplo_type uplo, enum blas_trans_type trans,
+		     enum blas_diag_type diag, int n, const void *tp,
+		     enum blas_gemm_elt_type a_type,
+		     enum blas_gemm_elt_type x_type)
+{
+  if (n < BLAS_TPMV_COLS_MIN_N
+      || (order == blas_colmajor) != (trans == blas_no_trans))
+    return 0;
+
+  s->n = n;
+  s->a = tp;
+  s->a_single = (a_type == blas_gemm_elt_s || a_type == blas_gemm_elt_c);
+  s->x_single = (x_type == blas_gemm_elt_s || x_type == blas_gemm_elt_c);
+  s->lower = (uplo == blas_lower) == (trans == blas_no_trans);
+  s->unit = (diag == blas_unit_diag);
+  if (!BLAS_GEMM_ELT_IS_COMPLEX(x_type))
+    s->mode = cols_real;
+  else if (!BLAS_GEMM_ELT_IS_COMPLEX(a_type))
+    s->mode = cols_x_complex;
+  else if (s->a_single && s->x_single)
+    s->mode = cols_complex_single;
+  else
+    s->mode = cols_complex;
+  return 1;
+}
+
+/* The rows of column k below or above its diagonal, and where they
+   start. */
+static void col_rows(const struct tpmv_cols *s, int k, int *t0, int *rows)
+{
+  *t0 = s->lower ? k + 1 : 0;
+  *rows = s->lower ? s->n - k - 1 : k;
+}
+
+/* head, tail += a * x, or x * 1 for a unit diagonal, real. */
+static void add_diag_real(const struct tpmv_cols *s, long k, double x,
+			  double *head, double *tail)
+{
+  double head_p, tail_p = 0.0;
+
+  if (s->a_single && s->x_single)
+    head_p = s->unit ? x * 1.0 : elt(s->a, 1, k) * x;
+  else if (s->unit)
+    blas_dd_two_prod(x, 1.0, &head_p, &tail_p);
+  else
+    blas_dd_two_prod(elt(s->a, s->a_single, k), x, &head_p, &tail_p);
+  blas_dd_add_lazy(*head, *tail, head_p, tail_p, head, tail);
+}
+
+/* Columns in the order of the row loops into (head, tail): one double
+   per row for real x; (re, im) pairs for complex T and x; the real parts
+   of the rows, then their imaginary parts, for real T and complex x.
+   xh holds x likewise, xt n zeros. */
+static void sweep_x(const struct tpmv_cols *s, const double *xh,
+		    const double *xt, double *head, double *tail)
+{
+  int n = s->n, i, k, c, t0, rows;
+
+  for (i = 0; i < n; i++) {
+    long off;
+
+    k = s->lower ? i : n - 1 - i;
+    off = col_off(s, k);
+    col_rows(s, k, &t0, &rows);
+    if (s->mode == cols_complex || s->mode == cols_complex_single) {
+      double a0 = 1.0, a1 = 0.0, x0 = xh[2 * k], x1 = xh[2 * k + 1];
+      double head_p[2], tail_p[2];
+      int exact = (s->mode == cols_complex_single);
+
+      if (rows > 0)
+	blas_zgemv_dd_cols_x_kernel(rows, 1, elt_ptr(s, 2 * (off + t0)),
+				    s->a_single, rows, xh + 2 * k, 0, exact,
+				    head + 2 * t0, tail + 2 * t0);
+      if (s->unit) {
+	blas_dd_cmul(x0, x1, a0, a1, exact, head_p, tail_p);
+      } else {
+	a0 = elt(s->a, s->a_single, 2 * (off + k));
+	a1 = elt(s->a, s->a_single, 2 * (off + k) + 1);
+	blas_dd_cmul(a0, a1, x0, x1, exact, head_p, tail_p);
+      }
+      for (c = 0; c < 2; c++)
+	blas_dd_add_lazy(head[2 * k + c], tail[2 * k + c], head_p[c],
+			 tail_p[c], &head[2 * k + c], &tail[2 * k + c]);
+      continue;
+    }
+    if (rows > 0)
+      blas_gemv_dd_cols_x_kernel(rows, 1, elt_ptr(s, off + t0), s->a_single,
+				 rows, xh + k, xt + k, s->x_single,
+				 head + t0, tail + t0);
+    add_diag_real(s, off + k, xh[k], &head[k], &tail[k]);
+    if (s->mode == cols_x_complex) {
+      if (rows > 0)
+	blas_gemv_dd_cols_x_kernel(rows, 1, elt_ptr(s, off + t0),
+				   s->a_single, rows, xh + n + k, xt + k,
+				   s->x_single, head + n + t0, tail + n + t0);
+      add_diag_real(s, off + k, xh[n + k], &head[n + k], &tail[n + k]);
+    }
+  }
+}
+
+double *blas_tpmv_cols_x(enum blas_order_type order,
+			 enum blas_uplo_type uplo,
+			 enum blas_trans_type trans,
+			 enum blas_diag_type diag, int n, const void *tp,
+			 enum blas_gemm_elt_type a_type, const void *x,
+			 enum blas_gemm_elt_type x_type, int incx)
+{
+  struct tpmv_cols s;
+  double *sum, *ws, *xh, *xt, *head, *tail;
+  int w, i, j;
+
+  if (!cols_init(&s, order, uplo, trans, diag, n, tp, a_type, x_type))
+    return NULL;
+  w = (s.mode == cols_real) ? 1 : 2;	/* doubles per sum */
+
+  /* x, its zero tails, then (head, tail). */
+  ws = (double *) blas_thread_scratch((size_t) (3 * w + 1) * n
+				      * sizeof(double));
+  sum = (double *) blas_malloc((size_t) 2 * w * n * sizeof(double));
+  if (ws == NULL || sum == NULL) {
+    blas_free(sum);
+    return NULL;
+  }
+  xh = ws;
+  xt = ws + w * n;
+  head = xt + n;
+  tail = head + w * n;
+  for (j = 0; j < n; j++) {
+    long k = (long) w * j * incx;
+
+    xt[j] = 0.0;
+    if (s.mode == cols_real) {
+      xh[j] = elt(x, s.x_single, k);
+    } else if (s.mode == cols_x_complex) {
+      xh[j] = elt(x, s.x_single, k);
+      xh[n + j] = elt(x, s.x_single, k + 1);
+    } else {
+      xh[2 * j] = elt(x, s.x_single, k);
+      xh[2 * j + 1] = elt(x, s.x_single, k + 1);
+    }
+  }
+  for (i = 0; i < w * n; i++)
+    head[i] = tail[i] = 0.0;
+
+  sweep_x(&s, xh, xt, head, tail);
+
+  for (i = 0; i < n; i++) {
+    if (s.mode == cols_real) {
+      sum[2 * i] = head[i];
+      sum[2 * i + 1] = tail[i];
+    } else if (s.mode == cols_x_complex) {
+      sum[4 * i] = head[i];
+      sum[4 * i + 1] = head[n + i];
+      sum[4 * i + 2] = tail[i];
+      sum[4 * i + 3] = tail[n + i];
+    } else {
+      sum[4 * i] = head[2 * i];
+      sum[4 * i + 1] = head[2 * i + 1];
+      sum[4 * i + 2] = tail[2 * i];
+      sum[4 * i + 3] = tail[2 * i + 1];
+    }
+  }
+  return sum;
+}
+
+/* sum[t0 + r] += column * x, r < rows, real, in double. */
+static void axpy_real_d(const struct tpmv_cols *s, long off, int t0,
+			int rows, double x, double *sum)
+{
+  int r;
+
+  if (s->a_single) {
+    const float *col = (const float *) s->a + off + t0;
+
+    for (r = 0; r < rows; r++)
+      sum[t0 + r] = sum[t0 + r] + col[r] * x;
+  } else {
+    const double *col = (const double *) s->a + off + t0;
+
+    for (r = 0; r < rows; r++)
+      sum[t0 + r] = sum[t0 + r] + col[r] * x;
+  }
+}
+
+double *blas_tpmv_cols_d(enum blas_order_type order,
+			 enum blas_uplo_type uplo,
+			 enum blas_trans_type trans,
+			 enum blas_diag_type diag, int n, const void *tp,
+			 enum blas_gemm_elt_type a_type, const void *x,
+			 enum blas_gemm_elt_type x_type, int incx)
+{
+  struct tpmv_cols s;
+  double *sum, *xd;
+  int w, i, k, t, t0, rows;
+
+  if (!cols_init(&s, order, uplo, trans, diag, n, tp, a_type, x_type))
+    return NULL;
+  w = (s.mode == cols_real) ? 1 : 2;
+
+  xd = (double *) blas_thread_scratch((size_t) w * n * sizeof(double));
+  sum = (double *) blas_malloc((size_t) w * n * sizeof(double));
+  if (xd == NULL || sum == NULL) {
+    blas_free(sum);
+    return NULL;
+  }
+  for (i = 0; i < w * n; i++) {
+    xd[i] = elt(x, s.x_single, (long) w * (i / w) * incx + i % w);
+    sum[i] = 0.0;
+  }
+
+  for (i = 0; i < n; i++) {
+    long off;
+    double x0, x1, a0, a1, p0, p1;
+
+    k = s.lower ? i : n - 1 - i;
+    off = col_off(&s, k);
+    col_rows(&s, k, &t0, &rows);
+    if (s.mode == cols_real) {
+      axpy_real_d(&s, off, t0, rows, xd[k], sum);
+      p0 = s.unit ? xd[k] * 1.0 : elt(s.a, s.a_single, off + k) * xd[k];
+      sum[k] = sum[k] + p0;
+      continue;
+    }
+    x0 = xd[2 * k];
+    x1 = xd[2 * k + 1];
+    for (t = t0; t < t0 + rows; t++) {
+      if (s.mode == cols_x_complex) {
+	a0 = elt(s.a, s.a_single, off + t);
+	p0 = x0 * a0;
+	p1 = x1 * a0;
+      } else {
+	a0 = elt(s.a, s.a_single, 2 * (off + t));
+	a1 = elt(s.a, s.a_single, 2 * (off + t) + 1);
+	p0 = a0 * x0 - a1 * x1;
+	p1 = a0 * x1 + a1 * x0;
+      }
+      sum[2 * t] = sum[2 * t] + p0;
+      sum[2 * t + 1] = sum[2 * t + 1] + p1;
+    }
+    if (s.unit && s.mode == cols_x_complex) {
+      p0 = x0 * 1.0;
+      p1 = x1 * 1.0;
+    } else if (s.unit) {
+      p0 = x0 * 1.0 - x1 * 0.0;
+      p1 = x0 * 0.0 + x1 * 1.0;
+    } else if (s.mode == cols_x_complex) {
+      a0 = elt(s.a, s.a_single, off + k);
+      p0 = x0 * a0;
+      p1 = x1 * a0;
+    } else {
+      a0 = elt(s.a, s.a_single, 2 * (off + k));
+      a1 = elt(s.a, s.a_single, 2 * (off + k) + 1);
+      p0 = a0 * x0 - a1 * x1;
+      p1 = a0 * x1 + a1 * x0;
+    }
+    sum[2 * k] = sum[2 * k] + p0;
+    sum[2 * k + 1] = sum[2 * k + 1] + p1;
+  }
+  return sum;
+}
@@ -58,6 +58,7 @@ void		BLAS_dtrmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;	/* used to idx matrix */
@@ -339,47 +340,27 @@ void		BLAS_dtrmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		double		dt = (double)t_elem;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem * split;
-		  a1 = con - x_elem;
-		  a1 = con - a1;
-		  a2 = x_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
 		  head_prod = x_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(x_elem, dt, head_prod);
 		}
 	      }
 	      {
-		/* Compute double-double = double-double + double-double. */
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
 		double		bv;
-		double		s1     , s2, t1, t2;
+		double		s1     , s2;
 
 		/* Add two hi words. */
 		s1 = head_sum + head_prod;
 		bv = s1 - head_sum;
 		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
+		/* Add the lo words to the error. */
+		s2 += tail_sum + tail_prod;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		/* Renormalize (s1, s2)  */
+		head_sum = s1 + s2;
+		tail_sum = s2 - (head_sum - s1);
 	      }
 
 	      xj += inc_x;
@@ -406,19 +387,10 @@ void		BLAS_dtrmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    } else {
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 		c2 = tail_sum * alpha_i;
 		t1 = c11 + c2;
@@ -453,47 +425,27 @@ void		BLAS_dtrmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		double		dt = (double)t_elem;
 		{
 		  /* Compute double_double = double * double. */
-		  double	  a1    , a2, b1, b2, con;
-
-		  con = x_elem * split;
-		  a1 = con - x_elem;
-		  a1 = con - a1;
-		  a2 = x_elem - a1;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
-
 		  head_prod = x_elem * dt;
-		  tail_prod = (((a1 * b1 - head_prod) + a1 * b2) + a2 * b1) + a2 * b2;
+		  tail_prod = BLAS_TWO_PROD_ERR(x_elem, dt, head_prod);
 		}
 	      }
 	      {
-		/* Compute double-double = double-double + double-double. */
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
 		double		bv;
-		double		s1     , s2, t1, t2;
+		double		s1     , s2;
 
 		/* Add two hi words. */
 		s1 = head_sum + head_prod;
 		bv = s1 - head_sum;
 		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
-
-		s2 += t1;
+		/* Add the lo words to the error. */
+		s2 += tail_sum + tail_prod;
 
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		/* Renormalize (s1, s2)  */
+		head_sum = s1 + s2;
+		tail_sum = s2 - (head_sum - s1);
 	      }
 
 	      xj += inc_x;
@@ -505,19 +457,10 @@ void		BLAS_dtrmv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	    } else {
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_sum * split;
-		a11 = con - head_sum;
-		a11 = con - a11;
-		a21 = head_sum - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_sum * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_sum, alpha_i, c11);
 
 		c2 = tail_sum * alpha_i;
 		t1 = c11 + c2;
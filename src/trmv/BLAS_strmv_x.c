@@ -225,6 +225,7 @@ void		BLAS_strmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , j;	/* used to idx matrix */
@@ -505,31 +506,22 @@ void		BLAS_strmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      head_prod = (double)x_elem *t_elem;
 	      tail_prod = 0.0;
 	      {
-		/* Compute double-double = double-double + double-double. */
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
 		double		bv;
-		double		s1     , s2, t1, t2;
+		double		s1     , s2;
 
 		/* Add two hi words. */
 		s1 = head_sum + head_prod;
 		bv = s1 - head_sum;
 		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
+		/* Add the lo words to the error. */
+		s2 += tail_sum + tail_prod;
 
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		/* Renormalize (s1, s2)  */
+		head_sum = s1 + s2;
+		tail_sum = s2 - (head_sum - s1);
 	      }
 
 	      xj += inc_x;
@@ -561,20 +553,10 @@ void		BLAS_strmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		double		dt = (double)alpha_i;
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_sum * split;
-		  a11 = con - head_sum;
-		  a11 = con - a11;
-		  a21 = head_sum - a11;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_sum * dt;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		  c2 = tail_sum * dt;
 		  t1 = c11 + c2;
@@ -609,31 +591,22 @@ void		BLAS_strmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      head_prod = (double)x_elem *t_elem;
 	      tail_prod = 0.0;
 	      {
-		/* Compute double-double = double-double + double-double. */
+		/* Compute double-double = double-double + double-double,
+		   renormalizing once. */
 		double		bv;
-		double		s1     , s2, t1, t2;
+		double		s1     , s2;
 
 		/* Add two hi words. */
 		s1 = head_sum + head_prod;
 		bv = s1 - head_sum;
 		s2 = ((head_prod - bv) + (head_sum - (s1 - bv)));
 
-		/* Add two lo words. */
-		t1 = tail_sum + tail_prod;
-		bv = t1 - tail_sum;
-		t2 = ((tail_prod - bv) + (tail_sum - (t1 - bv)));
+		/* Add the lo words to the error. */
+		s2 += tail_sum + tail_prod;
 
-		s2 += t1;
-
-		/* Renormalize (s1, s2)  to  (t1, s2) */
-		t1 = s1 + s2;
-		s2 = s2 - (t1 - s1);
-
-		t2 += s2;
-
-		/* Renormalize (t1, t2)  */
-		head_sum = t1 + t2;
-		tail_sum = t2 - (head_sum - t1);
+		/* Renormalize (s1, s2)  */
+		head_sum = s1 + s2;
+		tail_sum = s2 - (head_sum - s1);
 	      }
 
 	      xj += inc_x;
@@ -647,20 +620,10 @@ void		BLAS_strmv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		double		dt = (double)alpha_i;
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_sum * split;
-		  a11 = con - head_sum;
-		  a11 = con - a11;
-		  a21 = head_sum - a11;
-		  con = dt * split;
-		  b1 = con - dt;
-		  b1 = con - b1;
-		  b2 = dt - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_sum * dt;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_sum, dt, c11);
 
 		  c2 = tail_sum * dt;
 		  t1 = c11 + c2;
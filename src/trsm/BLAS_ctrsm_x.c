@@ -0,0 +1,115 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_gemm_engine.h"
+#include "blas_trsm_engine.h"
+
+void BLAS_ctrsm_x(enum blas_order_type order, enum blas_side_type side,
+		  enum blas_uplo_type uplo, enum blas_trans_type trans,
+		  enum blas_diag_type diag, int m, int n, const void *alpha,
+		  const void *t, int ldt, void *b, int ldb,
+		  enum blas_prec_type prec)
+/*
+ * Purpose
+ * =======
+ *
+ * This routine solves, for the m by n matrix B, one of
+ *
+ *     B <- alpha * inverse(op(T)) * B     (side = blas_left_side)
+ *     B <- alpha * B * inverse(op(T))     (side = blas_right_side)
+ *
+ * where T is triangular and op(T) is T, its transpose or its conjugate
+ * transpose.  The right-hand sides are solved in blocks that read T
+ * once each; see blas_trsm_engine.h.
+ *
+ * Arguments
+ * =========
+ *
+ * order  (input) enum blas_order_type
+ *        column major, row major
+ *
+ * side   (input) enum blas_side_type
+ *        left, right: which side of B op(T) is on
+ *
+ * uplo   (input) enum blas_uplo_type
+ *        upper, lower
+ *
+ * trans  (input) enum blas_trans_type
+ *        no trans, trans, conj trans
+ *
+ * diag   (input) enum blas_diag_type
+ *        unit, non unit
+ *
+ * m n    (input) int
+ *        the dimensions of B; T is m by m on the left, n by n on the
+ *        right
+ *
+ * alpha  (input) const void*
+ *
+ * t      (input) const void*
+ *        Triangular matrix
+ *
+ * ldt    (input) int
+ *        leading dimension of T
+ *
+ * b      (input/output) void*
+ *        On entry the right-hand sides, on exit the solution
+ *
+ * ldb    (input) int
+ *        leading dimension of B
+ *
+ * prec   (input) enum blas_prec_type
+ *        Specifies the internal precision to be used.
+ *        = blas_prec_single: single precision.
+ *        = blas_prec_double: double precision.
+ *        = blas_prec_extra : anything at least 1.5 times as accurate
+ *                            than double, and wider than 80-bits.
+ *                            We use double-double in our implementation.
+ *
+ */
+{
+  static const char routine_name[] = "BLAS_ctrsm_x";
+  const float *alpha_i = (const float *) alpha;
+  int i, j, ld_rows = (side == blas_left_side) ? m : n;
+
+  /* Test for error conditions */
+  if (order != blas_colmajor && order != blas_rowmajor)
+    BLAS_error(routine_name, -1, order, NULL);
+  if (side != blas_left_side && side != blas_right_side)
+    BLAS_error(routine_name, -2, side, NULL);
+  if (uplo != blas_upper && uplo != blas_lower)
+    BLAS_error(routine_name, -3, uplo, NULL);
+  if (trans != blas_no_trans && trans != blas_trans
+      && trans != blas_conj_trans)
+    BLAS_error(routine_name, -4, trans, NULL);
+  if (diag != blas_non_unit_diag && diag != blas_unit_diag)
+    BLAS_error(routine_name, -5, diag, NULL);
+  if (m < 0)
+    BLAS_error(routine_name, -6, m, NULL);
+  if (n < 0)
+    BLAS_error(routine_name, -7, n, NULL);
+  if (ldt < MAX(1, ld_rows))
+    BLAS_error(routine_name, -10, ldt, NULL);
+  if (ldb < MAX(1, (order == blas_colmajor) ? m : n))
+    BLAS_error(routine_name, -12, ldb, NULL);
+
+  /* Test for no-op */
+  if (m == 0 || n == 0)
+    return;
+
+  /* if alpha is zero, then B is zero */
+  if (alpha_i[0] == 0.0 && alpha_i[1] == 0.0) {
+    for (i = 0; i < m; i++)
+      for (j = 0; j < n; j++) {
+	long bij = (order == blas_colmajor) ? i + (long) j * ldb
+	  : (long) i * ldb + j;
+
+	((float *) b)[2 * bij] = 0.0;
+	((float *) b)[2 * bij + 1] = 0.0;
+      }
+    return;
+  }
+
+  if (!blas_trsm_engine(order, side, uplo, trans, diag, m, n, alpha, t,
+			blas_gemm_elt_c, ldt, b, blas_gemm_elt_c, ldb, prec))
+    BLAS_error("blas_malloc", 0, 0, "malloc failed.\n");
+}
@@ -0,0 +1,554 @@
+#include <math.h>
+#include <string.h>
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_gemm_engine.h"
+#include "blas_trsm_engine.h"
+
+/*
+ * Blocked TRSM.
+ *
+ * A is p by p and X p by q, with A(i, j) read through a GEMM operand
+ * (conjugated on read for blas_conj_trans).  'lower' solves from the
+ * first row down, otherwise from the last row up.  X lives in a
+ * column-major workspace, w doubles per element, and each diagonal
+ * block [k0, k1) runs
+ *
+ *   X(k0:k1, :) <- inverse(A(k0:k1, k0:k1)) * X(k0:k1, :)
+ *   X(R, :)     <- X(R, :) - A(R, k0:k1) * X(k0:k1, :)
+ *
+ * with R the rows still to solve.  In blas_prec_extra X is (head, tail)
+ * and the update of the tails goes into corr, which each entry adds in
+ * as it is solved.  The diagonal block of A is copied first into blk,
+ * so that the threads solving it read it from cache.
+ */
+
+struct trsm_job {
+  int p, nq;			/* rows of X, columns in this block */
+  int lower, non_unit, extra;
+  struct blas_gemm_operand a;
+  enum blas_gemm_elt_type x_type;	/* d or z */
+  int w;			/* doubles per element of X */
+  double *head, *tail, *corr;	/* column j at w * j * p */
+  int k0, k1;			/* the diagonal block */
+  double *blk;			/* the diagonal block, see BLK */
+};
+
+static const void *elt_ptr(const void *p, enum blas_gemm_elt_type type,
+			   long off)
+{
+  switch (type) {
+  case blas_gemm_elt_s:
+    return (const float *) p + off;
+  case blas_gemm_elt_d:
+    return (const double *) p + off;
+  case blas_gemm_elt_c:
+    return (const float *) p + 2 * off;
+  default:
+    return (const double *) p + 2 * off;
+  }
+}
+
+/* v <- element off of p, as (re, im); conj negates im. */
+static void load_elt(const void *p, enum blas_gemm_elt_type type, long off,
+		     int conj, double *v)
+{
+  switch (type) {
+  case blas_gemm_elt_s:
+    v[0] = ((const float *) p)[off];
+    v[1] = 0.0;
+    return;
+  case blas_gemm_elt_d:
+    v[0] = ((const double *) p)[off];
+    v[1] = 0.0;
+    return;
+  case blas_gemm_elt_c:
+    v[0] = ((const float *) p)[2 * off];
+    v[1] = ((const float *) p)[2 * off + 1];
+    break;
+  default:
+    v[0] = ((const double *) p)[2 * off];
+    v[1] = ((const double *) p)[2 * off + 1];
+    break;
+  }
+  if (conj)
+    v[1] = -v[1];
+}
+
+static void a_elt(const struct trsm_job *s, int i, int j, double *v)
+{
+  load_elt(s->a.p, s->a.type, (long) i * s->a.rs + (long) j * s->a.cs,
+	   s->a.conj, v);
+}
+
+/* Compute double-double = double-double / double-double. */
+static void div_dd(double head_a, double tail_a, double head_b,
+		   double tail_b, double *head, double *tail)
+{
+  double q1, q2, head_r, tail_r;
+
+  q1 = head_a / head_b;
+  blas_dd_mul_d(head_b, tail_b, q1, &head_r, &tail_r);
+  blas_dd_add(head_a, tail_a, -head_r, -tail_r, &head_r, &tail_r);
+  q2 = head_r / head_b;
+  blas_dd_two_sum(q1, q2, head, tail);
+}
+
+/* (head, tail) <- (head, tail) - a * (head_x, tail_x), complex
+   double-double against complex double. */
+static void sub_cprod_dd(double *head, double *tail, const double *a,
+			 const double *head_x, const double *tail_x)
+{
+  double head_p, tail_p, head_q, tail_q;
+
+  /* Real part */
+  blas_dd_mul_d(head_x[0], tail_x[0], a[0], &head_p, &tail_p);
+  blas_dd_mul_d(head_x[1], tail_x[1], a[1], &head_q, &tail_q);
+  blas_dd_add_lazy(head_p, tail_p, -head_q, -tail_q, &head_p, &tail_p);
+  blas_dd_add_lazy(head[0], tail[0], -head_p, -tail_p, &head[0], &tail[0]);
+  /* Imaginary part */
+  blas_dd_mul_d(head_x[1], tail_x[1], a[0], &head_p, &tail_p);
+  blas_dd_mul_d(head_x[0], tail_x[0], a[1], &head_q, &tail_q);
+  blas_dd_add_lazy(head_p, tail_p, head_q, tail_q, &head_p, &tail_p);
+  blas_dd_add_lazy(head[1], tail[1], -head_p, -tail_p, &head[1], &tail[1]);
+}
+
+/* (head, tail) <- (head, tail) / d, complex double-double by complex
+   double, as x * conj(d) / |d|^2 with d scaled by a power of two so
+   that |d|^2 can neither overflow nor underflow. */
+static void cdiv_dd(double *head, double *tail, const double *d)
+{
+  double d0, d1, head_n[2], tail_n[2], head_d, tail_d, head_p, tail_p;
+  int e, k;
+
+  (void) frexp(MAX(fabs(d[0]), fabs(d[1])), &e);
+  d0 = ldexp(d[0], -e);
+  d1 = ldexp(d[1], -e);
+  blas_dd_two_prod(d0, d0, &head_d, &tail_d);
+  blas_dd_two_prod(d1, d1, &head_p, &tail_p);
+  blas_dd_add(head_d, tail_d, head_p, tail_p, &head_d, &tail_d);
+
+  blas_dd_mul_d(head[0], tail[0], d0, &head_n[0], &tail_n[0]);
+  blas_dd_mul_d(head[1], tail[1], d1, &head_p, &tail_p);
+  blas_dd_add(head_n[0], tail_n[0], head_p, tail_p, &head_n[0], &tail_n[0]);
+  blas_dd_mul_d(head[1], tail[1], d0, &head_n[1], &tail_n[1]);
+  blas_dd_mul_d(head[0], tail[0], d1, &head_p, &tail_p);
+  blas_dd_add(head_n[1], tail_n[1], -head_p, -tail_p,
+	      &head_n[1], &tail_n[1]);
+
+  for (k = 0; k < 2; k++) {
+    div_dd(head_n[k], tail_n[k], head_d, tail_d, &head[k], &tail[k]);
+    head[k] = ldexp(head[k], -e);
+    tail[k] = ldexp(tail[k], -e);
+  }
+}
+
+/* x <- x / d in complex double, by Smith's method. */
+static void cdiv_d(double *x, const double *d)
+{
+  double r, t, x0 = x[0], x1 = x[1];
+
+  if (fabs(d[0]) >= fabs(d[1])) {
+    r = d[1] / d[0];
+    t = 1.0 / (d[0] + d[1] * r);
+    x[0] = (x0 + x1 * r) * t;
+    x[1] = (x1 - x0 * r) * t;
+  } else {
+    r = d[0] / d[1];
+    t = 1.0 / (d[1] + d[0] * r);
+    x[0] = (x1 + x0 * r) * t;
+    x[1] = (x1 * r - x0) * t;
+  }
+}
+
+/* Element (i, l) of the diagonal block in blk: column-major, NB rows,
+   the entries off the diagonal negated so that the kernels can add
+   their products. */
+#define BLK(s, i, l) ((s)->blk + (long) (s)->w * ((long) (l) * BLAS_TRSM_NB \
+						  + (i)))
+
+/* Solves the diagonal block for one column of X, (head, tail) with its
+   correction corr, in double-double, all indices from k0.  Real blocks
+   go BLAS_TRSM_NB_INNER rows at a time, each passing its solution on to
+   the rest of the block through the column kernel. */
+static void diag_dd(const struct trsm_job *s, double *head, double *tail,
+		    const double *corr)
+{
+  int kb = s->k1 - s->k0, ii, i, l, lo, hi, r0, r1;
+
+  head += s->w * s->k0;
+  tail += s->w * s->k0;
+  corr += s->w * s->k0;
+  for (i = 0; i < s->w * kb; i++)
+    blas_dd_add_d(head[i], tail[i], corr[i], &head[i], &tail[i]);
+
+  if (s->w == 1) {
+    for (r0 = 0; r0 < kb; r0 += BLAS_TRSM_NB_INNER) {
+      /* Rows [lo, hi) of the block, in solve order. */
+      lo = s->lower ? r0 : MAX(0, kb - r0 - BLAS_TRSM_NB_INNER);
+      hi = s->lower ? MIN(kb, r0 + BLAS_TRSM_NB_INNER) : kb - r0;
+      for (ii = 0; ii < hi - lo; ii++) {
+	double head_t, tail_t, head_p, tail_p;
+
+	i = s->lower ? lo + ii : hi - 1 - ii;
+	head_t = head[i];
+	tail_t = tail[i];
+	for (l = s->lower ? lo : i + 1; l < (s->lower ? i : hi); l++) {
+	  blas_dd_mul_d(head[l], tail[l], *BLK(s, i, l), &head_p, &tail_p);
+	  blas_dd_add_lazy(head_t, tail_t, head_p, tail_p, &head_t, &tail_t);
+	}
+	if (s->non_unit)
+	  blas_dd_div_d(head_t, tail_t, *BLK(s, i, i), &head_t, &tail_t);
+	head[i] = head_t;
+	tail[i] = tail_t;
+      }
+      r1 = s->lower ? kb : lo;
+      l = s->lower ? hi : 0;
+      if (l < r1)
+	blas_gemv_dd_cols_x_kernel(r1 - l, hi - lo, BLK(s, l, lo), 0,
+				   BLAS_TRSM_NB, head + lo, tail + lo, 0,
+				   head + l, tail + l);
+    }
+    return;
+  }
+
+  for (ii = 0; ii < kb; ii++) {
+    double head_t[2], tail_t[2], a[2];
+
+    i = s->lower ? ii : kb - 1 - ii;
+    head_t[0] = head[2 * i];
+    head_t[1] = head[2 * i + 1];
+    tail_t[0] = tail[2 * i];
+    tail_t[1] = tail[2 * i + 1];
+    for (l = s->lower ? 0 : i + 1; l < (s->lower ? i : kb); l++) {
+      a[0] = -BLK(s, i, l)[0];
+      a[1] = -BLK(s, i, l)[1];
+      sub_cprod_dd(head_t, tail_t, a, head + 2 * l, tail + 2 * l);
+    }
+    if (s->non_unit)
+      cdiv_dd(head_t, tail_t, BLK(s, i, i));
+    head[2 * i] = head_t[0];
+    head[2 * i + 1] = head_t[1];
+    tail[2 * i] = tail_t[0];
+    tail[2 * i + 1] = tail_t[1];
+  }
+}
+
+/* The same in double. */
+static void diag_d(const struct trsm_job *s, double *x)
+{
+  const double *a;
+  int kb = s->k1 - s->k0, ii, i, l;
+
+  x += s->w * s->k0;
+  for (ii = 0; ii < kb; ii++) {
+    i = s->lower ? ii : kb - 1 - ii;
+    if (s->w == 1) {
+      double t = x[i];
+
+      for (l = s->lower ? 0 : i + 1; l < (s->lower ? i : kb); l++)
+	t = t + *BLK(s, i, l) * x[l];
+      if (s->non_unit)
+	t = t / *BLK(s, i, i);
+      x[i] = t;
+    } else {
+      double t[2];
+
+      t[0] = x[2 * i];
+      t[1] = x[2 * i + 1];
+      for (l = s->lower ? 0 : i + 1; l < (s->lower ? i : kb); l++) {
+	a = BLK(s, i, l);
+	t[0] = t[0] + (a[0] * x[2 * l] - a[1] * x[2 * l + 1]);
+	t[1] = t[1] + (a[0] * x[2 * l + 1] + a[1] * x[2 * l]);
+      }
+      if (s->non_unit)
+	cdiv_d(t, BLK(s, i, i));
+      x[2 * i] = t[0];
+      x[2 * i + 1] = t[1];
+    }
+  }
+}
+
+static void diag_task(void *arg, int task, int worker)
+{
+  const struct trsm_job *s = (const struct trsm_job *) arg;
+  int j0 = task * BLAS_TRSM_DIAG_COLS;
+  int j1 = MIN(s->nq, j0 + BLAS_TRSM_DIAG_COLS);
+  int j;
+  FPU_FIX_DECL;
+
+  (void) worker;
+  FPU_FIX_START;
+  for (j = j0; j < j1; j++) {
+    long off = (long) s->w * j * s->p;
+
+    if (s->extra)
+      diag_dd(s, s->head + off, s->tail + off, s->corr + off);
+    else
+      diag_d(s, s->head + off);
+  }
+  FPU_FIX_STOP;
+}
+
+/* X(r0:r1, :) -= A(r0:r1, k0:k1) * X(k0:k1, :) by loops, in
+   double-double; used when the GEMM engine has no memory. */
+static void update_loops_dd(const struct trsm_job *s, int r0, int r1)
+{
+  double a[2], head_p, tail_p;
+  int i, j, l;
+
+  for (j = 0; j < s->nq; j++) {
+    double *head = s->head + (long) s->w * j * s->p;
+    double *tail = s->tail + (long) s->w * j * s->p;
+
+    for (i = r0; i < r1; i++) {
+      for (l = s->k0; l < s->k1; l++) {
+	a_elt(s, i, l, a);
+	if (s->w == 1) {
+	  blas_dd_mul_d(head[l], tail[l], a[0], &head_p, &tail_p);
+	  blas_dd_add_lazy(head[i], tail[i], -head_p, -tail_p,
+			   &head[i], &tail[i]);
+	} else {
+	  sub_cprod_dd(head + 2 * i, tail + 2 * i, a, head + 2 * l,
+		       tail + 2 * l);
+	}
+      }
+    }
+  }
+}
+
+/* dst(r0:r1, :) -= A(r0:r1, k0:k1) * src(k0:k1, :) by loops, in
+   double. */
+static void update_loops_d(const struct trsm_job *s, int r0, int r1,
+			   const double *src, double *dst)
+{
+  double a[2];
+  int i, j, l;
+
+  for (j = 0; j < s->nq; j++) {
+    const double *x = src + (long) s->w * j * s->p;
+    double *y = dst + (long) s->w * j * s->p;
+
+    for (i = r0; i < r1; i++) {
+      for (l = s->k0; l < s->k1; l++) {
+	a_elt(s, i, l, a);
+	if (s->w == 1) {
+	  y[i] = y[i] - a[0] * x[l];
+	} else {
+	  y[2 * i] = y[2 * i] - (a[0] * x[2 * l] - a[1] * x[2 * l + 1]);
+	  y[2 * i + 1] = y[2 * i + 1]
+	    - (a[0] * x[2 * l + 1] + a[1] * x[2 * l]);
+	}
+      }
+    }
+  }
+}
+
+/* The rows r0..r1 of X take in the diagonal block just solved. */
+static void update(const struct trsm_job *s, int r0, int r1)
+{
+  static const double minus_one[2] = { -1.0, 0.0 }, one[2] = { 1.0, 0.0 };
+  struct blas_gemm_operand a, x;
+  int kb = s->k1 - s->k0;
+  long w = s->w;
+
+  if (r0 >= r1)
+    return;
+  a = s->a;
+  a.p = elt_ptr(s->a.p, s->a.type,
+		(long) r0 * s->a.rs + (long) s->k0 * s->a.cs);
+
+  if (!s->extra) {
+    blas_gemm_operand_init(&x, s->head + w * s->k0, s->x_type,
+			   blas_colmajor, blas_no_trans, s->p);
+    if (!blas_gemm_engine_op(r1 - r0, s->nq, kb, minus_one, &a, &x, one,
+			     s->head + w * r0, s->x_type, 1, s->p,
+			     blas_prec_double))
+      update_loops_d(s, r0, r1, s->head, s->head);
+    return;
+  }
+
+  blas_gemm_operand_init(&x, s->head + w * s->k0, s->x_type,
+			 blas_colmajor, blas_no_trans, s->p);
+  if (!blas_gemm_engine_op_x2(r1 - r0, s->nq, kb, minus_one, &a, &x, one,
+			      s->head + w * r0, s->tail + w * r0,
+			      s->x_type, 1, s->p)) {
+    update_loops_dd(s, r0, r1);
+    return;
+  }
+  blas_gemm_operand_init(&x, s->tail + w * s->k0, s->x_type,
+			 blas_colmajor, blas_no_trans, s->p);
+  if (!blas_gemm_engine_op(r1 - r0, s->nq, kb, minus_one, &a, &x, one,
+			   s->corr + w * r0, s->x_type, 1, s->p,
+			   blas_prec_double))
+    update_loops_d(s, r0, r1, s->tail, s->corr);
+}
+
+static void solve(struct trsm_job *s)
+{
+  int ntasks = (s->nq + BLAS_TRSM_DIAG_COLS - 1) / BLAS_TRSM_DIAG_COLS;
+  int b, i, l;
+
+  for (b = 0; b < s->p; b += BLAS_TRSM_NB) {
+    if (s->lower) {
+      s->k0 = b;
+      s->k1 = MIN(s->p, b + BLAS_TRSM_NB);
+    } else {
+      s->k1 = s->p - b;
+      s->k0 = MAX(0, s->k1 - BLAS_TRSM_NB);
+    }
+    for (l = s->k0; l < s->k1; l++)
+      for (i = s->k0; i < s->k1; i++) {
+	double *a = BLK(s, i - s->k0, l - s->k0);
+
+	a_elt(s, i, l, a);
+	if (i != l) {
+	  a[0] = -a[0];
+	  if (s->w == 2)
+	    a[1] = -a[1];
+	}
+      }
+    blas_parallel_for(ntasks, blas_parallel_workers(ntasks), diag_task, s);
+    if (s->lower)
+      update(s, s->k1, s->p);
+    else
+      update(s, 0, s->k0);
+  }
+}
+
+int blas_trsm_engine(enum blas_order_type order, enum blas_side_type side,
+		     enum blas_uplo_type uplo, enum blas_trans_type trans,
+		     enum blas_diag_type diag, int m, int n,
+		     const void *alpha,
+		     const void *t, enum blas_gemm_elt_type t_type, int ldt,
+		     void *b, enum blas_gemm_elt_type b_type, int ldb,
+		     enum blas_prec_type prec)
+{
+  struct trsm_job s;
+  int left = (side == blas_left_side);
+  int b_single = (b_type == blas_gemm_elt_s || b_type == blas_gemm_elt_c);
+  int transposed, q, nrhs, i, j, jb;
+  long tr, tc, br, bc, bi, bj, len;
+  double alpha_v[2], v[2];
+  double *ws;
+  FPU_FIX_DECL;
+
+  /* T(r, c) and B(r, c) of the stored matrices. */
+  if (order == blas_colmajor) {
+    tr = br = 1;
+    tc = ldt;
+    bc = ldb;
+  } else {
+    tr = ldt;
+    br = ldb;
+    tc = bc = 1;
+  }
+
+  /* A(i, j) is op(T)(i, j) on the left and op(T)(j, i) on the right,
+     and X(i, j) is B(i, j) on the left and B(j, i) on the right. */
+  transposed = ((trans != blas_no_trans) == left);
+  s.a.p = t;
+  s.a.type = t_type;
+  s.a.rs = transposed ? tc : tr;
+  s.a.cs = transposed ? tr : tc;
+  s.a.conj = (trans == blas_conj_trans) && BLAS_GEMM_ELT_IS_COMPLEX(t_type);
+  s.a.shape = blas_gemm_general;
+  s.a.diag_conj = 0;
+  s.lower = ((uplo == blas_lower) != transposed);
+  s.non_unit = (diag == blas_non_unit_diag);
+  s.extra = (prec == blas_prec_extra);
+  s.p = left ? m : n;
+  q = left ? n : m;
+  bi = left ? br : bc;
+  bj = left ? bc : br;
+  if (BLAS_GEMM_ELT_IS_COMPLEX(b_type)) {
+    s.x_type = blas_gemm_elt_z;
+    s.w = 2;
+  } else {
+    s.x_type = blas_gemm_elt_d;
+    s.w = 1;
+  }
+  load_elt(alpha, b_type, 0, 0, alpha_v);
+
+  nrhs = MIN(q, BLAS_TRSM_NRHS);
+  len = (long) s.w * s.p * nrhs;
+  ws = (double *) blas_malloc(((s.extra ? 3 : 1) * len + (long) s.w *
+			       BLAS_TRSM_NB * BLAS_TRSM_NB) * sizeof(double));
+  if (ws == NULL)
+    return 0;
+  s.head = ws;
+  s.tail = s.extra ? ws + len : NULL;
+  s.corr = s.extra ? ws + 2 * len : NULL;
+  s.blk = ws + (s.extra ? 3 : 1) * len;
+
+  FPU_FIX_START;
+
+  for (jb = 0; jb < q; jb += nrhs) {
+    s.nq = MIN(nrhs, q - jb);
+
+    /* X <- alpha * B for this block of right-hand sides. */
+    for (j = 0; j < s.nq; j++) {
+      double *head = s.head + (long) s.w * j * s.p;
+      double *tail = s.extra ? s.tail + (long) s.w * j * s.p : NULL;
+
+      for (i = 0; i < s.p; i++) {
+	load_elt(b, b_type, i * bi + (jb + j) * bj, 0, v);
+	if (s.w == 1) {
+	  if (s.extra)
+	    blas_dd_two_prod(alpha_v[0], v[0], &head[i], &tail[i]);
+	  else
+	    head[i] = alpha_v[0] * v[0];
+	} else if (s.extra) {
+	  double head_t[2], tail_t[2];
+
+	  blas_dd_cmul(alpha_v[0], alpha_v[1], v[0], v[1], b_single,
+		       head_t, tail_t);
+	  head[2 * i] = head_t[0];
+	  head[2 * i + 1] = head_t[1];
+	  tail[2 * i] = tail_t[0];
+	  tail[2 * i + 1] = tail_t[1];
+	} else {
+	  head[2 * i] = alpha_v[0] * v[0] - alpha_v[1] * v[1];
+	  head[2 * i + 1] = alpha_v[0] * v[1] + alpha_v[1] * v[0];
+	}
+      }
+    }
+    if (s.extra)
+      memset(s.corr, 0, (size_t) s.w * s.p * s.nq * sizeof(double));
+
+    solve(&s);
+
+    /* B <- X, rounded. */
+    for (j = 0; j < s.nq; j++) {
+      const double *head = s.head + (long) s.w * j * s.p;
+
+      for (i = 0; i < s.p; i++) {
+	long off = i * bi + (jb + j) * bj;
+
+	switch (b_type) {
+	case blas_gemm_elt_s:
+	  ((float *) b)[off] = head[i];
+	  break;
+	case blas_gemm_elt_d:
+	  ((double *) b)[off] = head[i];
+	  break;
+	case blas_gemm_elt_c:
+	  ((float *) b)[2 * off] = head[2 * i];
+	  ((float *) b)[2 * off + 1] = head[2 * i + 1];
+	  break;
+	default:
+	  ((double *) b)[2 * off] = head[2 * i];
+	  ((double *) b)[2 * off + 1] = head[2 * i + 1];
+	  break;
+	}
+      }
+    }
+  }
+
+  FPU_FIX_STOP;
+  blas_free(ws);
+  return 1;
+}
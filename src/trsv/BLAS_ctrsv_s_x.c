@@ -312,6 +312,7 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
     }
     break;
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
 
     {
@@ -653,20 +654,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -677,20 +668,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -733,20 +714,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -757,20 +728,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -833,20 +794,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_temp3[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		      c2 = tail_a0 * dt;
 		      t1 = c11 + c2;
@@ -859,20 +810,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp2[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		      c2 = tail_a1 * dt;
 		      t1 = c11 + c2;
@@ -897,31 +838,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -931,31 +863,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -981,26 +904,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1023,26 +934,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1101,20 +1000,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1125,20 +1014,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1181,20 +1060,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1205,20 +1074,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1281,20 +1140,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_temp3[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		      c2 = tail_a0 * dt;
 		      t1 = c11 + c2;
@@ -1307,20 +1156,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp2[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		      c2 = tail_a1 * dt;
 		      t1 = c11 + c2;
@@ -1345,31 +1184,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1379,31 +1209,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1429,26 +1250,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1471,26 +1280,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1548,20 +1345,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -1572,20 +1359,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -1628,20 +1405,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -1652,20 +1419,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -1728,20 +1485,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_temp3[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		      c2 = tail_a0 * dt;
 		      t1 = c11 + c2;
@@ -1754,20 +1501,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp2[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		      c2 = tail_a1 * dt;
 		      t1 = c11 + c2;
@@ -1792,31 +1529,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1826,31 +1554,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1876,26 +1595,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1918,26 +1625,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1996,20 +1691,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		    c2 = tail_a0 * cd[0];
 		    t1 = c11 + c2;
@@ -2020,20 +1705,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		    c2 = tail_a1 * cd[1];
 		    t1 = c11 + c2;
@@ -2076,20 +1751,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = cd[0] * split;
-		    b1 = con - cd[0];
-		    b1 = con - b1;
-		    b2 = cd[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * cd[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		    c2 = tail_a1 * cd[0];
 		    t1 = c11 + c2;
@@ -2100,20 +1765,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = cd[1] * split;
-		    b1 = con - cd[1];
-		    b1 = con - b1;
-		    b2 = cd[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * cd[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		    c2 = tail_a0 * cd[1];
 		    t1 = c11 + c2;
@@ -2176,20 +1831,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_a1 = tail_temp3[1];
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, dt, c11);
 
 		      c2 = tail_a0 * dt;
 		      t1 = c11 + c2;
@@ -2202,20 +1847,10 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    tail_temp2[0] = tail_t;
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = dt * split;
-		      b1 = con - dt;
-		      b1 = con - b1;
-		      b2 = dt - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * dt;
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, dt, c11);
 
 		      c2 = tail_a1 * dt;
 		      t1 = c11 + c2;
@@ -2240,31 +1875,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -2274,31 +1900,22 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2324,26 +1941,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -2366,26 +1971,14 @@ void		BLAS_ctrsv_s_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
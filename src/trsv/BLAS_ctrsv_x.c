@@ -968,6 +968,7 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
     }
     break;
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
 
     {
@@ -1979,20 +1980,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -2003,20 +1994,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -2062,20 +2043,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -2086,20 +2057,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -2173,20 +2134,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -2197,20 +2148,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -2222,54 +2163,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -2280,20 +2199,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -2303,34 +2212,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -2348,34 +2245,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -2385,34 +2270,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -2465,26 +2338,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -2510,26 +2371,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -2569,20 +2418,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -2595,20 +2434,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -2639,19 +2468,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -2674,20 +2492,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -2730,26 +2538,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2788,13 +2587,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2844,20 +2639,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -2905,26 +2690,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2963,13 +2739,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3021,19 +2793,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -3056,20 +2817,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3112,26 +2863,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3170,13 +2912,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3226,20 +2964,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3287,26 +3015,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3345,13 +3064,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3415,20 +3130,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -3441,20 +3146,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -3510,20 +3205,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -3534,20 +3219,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -3593,20 +3268,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -3617,20 +3282,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -3704,20 +3359,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -3728,20 +3373,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -3753,54 +3388,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -3811,20 +3424,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -3834,34 +3437,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -3879,34 +3470,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -3916,34 +3495,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -3996,26 +3563,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -4041,26 +3596,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -4100,20 +3643,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -4126,20 +3659,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -4170,19 +3693,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -4205,20 +3717,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4261,26 +3763,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -4319,13 +3812,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4375,20 +3864,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4436,26 +3915,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -4494,13 +3964,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4552,19 +4018,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -4587,20 +4042,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4643,26 +4088,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -4701,13 +4137,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4757,20 +4189,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4818,26 +4240,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -4876,13 +4289,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4946,20 +4355,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -4972,20 +4371,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -5046,20 +4435,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -5070,20 +4449,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -5129,20 +4498,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -5153,20 +4512,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -5240,20 +4589,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -5264,20 +4603,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -5289,54 +4618,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -5347,20 +4654,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -5370,34 +4667,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -5415,34 +4700,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -5452,34 +4725,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -5532,26 +4793,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -5577,26 +4826,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -5636,20 +4873,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -5662,20 +4889,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -5706,19 +4923,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -5741,20 +4947,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5797,26 +4993,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5855,13 +5042,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5911,20 +5094,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5972,26 +5145,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6030,13 +5194,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6088,19 +5248,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -6123,20 +5272,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6179,26 +5318,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6237,13 +5367,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6293,20 +5419,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6354,26 +5470,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6412,13 +5519,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6482,20 +5585,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -6508,20 +5601,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -6576,20 +5659,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -6600,20 +5673,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -6659,20 +5722,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -6683,20 +5736,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -6770,20 +5813,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -6794,20 +5827,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -6819,54 +5842,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -6877,20 +5878,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -6900,34 +5891,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -6945,34 +5924,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -6982,34 +5949,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -7062,26 +6017,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -7107,26 +6050,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -7166,20 +6097,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -7192,20 +6113,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -7236,19 +6147,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -7271,20 +6171,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7327,26 +6217,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -7385,13 +6266,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -7441,20 +6318,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7502,26 +6369,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -7560,13 +6418,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -7618,19 +6472,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -7653,20 +6496,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7709,26 +6542,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -7767,13 +6591,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -7823,20 +6643,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7884,26 +6694,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -7942,13 +6743,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8012,20 +6809,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -8038,20 +6825,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -8111,20 +6888,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -8135,20 +6902,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -8194,20 +6951,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -8218,20 +6965,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -8305,20 +7042,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -8329,20 +7056,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -8354,54 +7071,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -8412,20 +7107,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -8435,34 +7120,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -8480,34 +7153,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -8517,34 +7178,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -8597,26 +7246,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -8642,26 +7279,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -8701,20 +7326,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -8727,20 +7342,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -8771,19 +7376,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -8806,20 +7400,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -8862,26 +7446,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8920,13 +7495,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8976,20 +7547,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9037,26 +7598,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9095,13 +7647,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9153,19 +7701,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -9188,20 +7725,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9244,26 +7771,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9302,13 +7820,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9358,20 +7872,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9419,26 +7923,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9477,13 +7972,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9547,20 +8038,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -9573,20 +8054,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -9642,20 +8113,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -9666,20 +8127,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -9725,20 +8176,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -9749,20 +8190,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -9836,20 +8267,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -9860,20 +8281,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -9885,54 +8296,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -9943,20 +8332,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -9966,34 +8345,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -10011,34 +8378,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -10048,34 +8403,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -10128,26 +8471,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -10173,26 +8504,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -10232,20 +8551,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -10258,20 +8567,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -10302,19 +8601,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -10337,20 +8625,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10393,26 +8671,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -10451,13 +8720,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -10507,20 +8772,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10568,26 +8823,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -10626,13 +8872,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -10684,19 +8926,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -10719,20 +8950,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10775,26 +8996,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -10833,13 +9045,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -10889,20 +9097,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10950,26 +9148,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11008,13 +9197,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11078,20 +9263,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -11104,20 +9279,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -11178,20 +9343,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -11202,20 +9357,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -11261,20 +9406,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -11285,20 +9420,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -11372,20 +9497,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -11396,20 +9511,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -11421,54 +9526,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -11479,20 +9562,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -11502,34 +9575,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -11547,34 +9608,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -11584,34 +9633,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -11664,26 +9701,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -11709,26 +9734,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -11768,20 +9781,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -11794,20 +9797,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -11838,19 +9831,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -11873,20 +9855,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -11929,26 +9901,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11987,13 +9950,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12043,20 +10002,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12104,26 +10053,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12162,13 +10102,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12220,19 +10156,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -12255,20 +10180,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12311,26 +10226,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12369,13 +10275,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12425,20 +10327,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12486,26 +10378,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12544,13 +10427,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12614,20 +10493,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -12640,20 +10509,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -12708,20 +10567,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 		      c2 = tail_a0 * cd[0];
 		      t1 = c11 + c2;
@@ -12732,20 +10581,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 		      c2 = tail_a1 * cd[1];
 		      t1 = c11 + c2;
@@ -12791,20 +10630,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = cd[0] * split;
-		      b1 = con - cd[0];
-		      b1 = con - b1;
-		      b2 = cd[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * cd[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 		      c2 = tail_a1 * cd[0];
 		      t1 = c11 + c2;
@@ -12815,20 +10644,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = cd[1] * split;
-		      b1 = con - cd[1];
-		      b1 = con - b1;
-		      b2 = cd[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * cd[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 		      c2 = tail_a0 * cd[1];
 		      t1 = c11 + c2;
@@ -12902,20 +10721,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -12926,20 +10735,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -12951,54 +10750,32 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -13009,20 +10786,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -13032,34 +10799,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -13077,34 +10832,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -13114,34 +10857,22 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -13194,26 +10925,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -13239,26 +10958,14 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -13298,20 +11005,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -13324,20 +11021,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -13368,19 +11055,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -13403,20 +11079,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -13459,26 +11125,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -13517,13 +11174,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -13573,20 +11226,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -13634,26 +11277,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -13692,13 +11326,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -13750,19 +11380,8 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -13785,20 +11404,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -13841,26 +11450,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -13899,13 +11499,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -13955,20 +11551,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -14016,26 +11602,17 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -14074,13 +11651,9 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -14144,20 +11717,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -14170,20 +11733,10 @@ void		BLAS_ctrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
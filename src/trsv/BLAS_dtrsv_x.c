@@ -1,6 +1,9 @@
 #include <math.h>
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_trsv_dd.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
 
 void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   		enum		blas_trans_type trans, enum blas_diag_type diag,
@@ -98,6 +101,7 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
 
     {
@@ -265,6 +269,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
     }
     break;
   case blas_prec_extra:
+    /* Blocked solve on a per-thread double-double copy of x. */
+    if (blas_trsv_dd_x(order, uplo, trans, diag, n, alpha, T, 0, ldt,
+		       x, 0, incx))
+      break;
     {
       FPU_FIX_DECL;
       FPU_FIX_START;
@@ -321,19 +329,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      /* multiply by alpha */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, alpha_i, c11);
 
 		c2 = tail_temp3 * alpha_i;
 		t1 = c11 + c2;
@@ -344,69 +343,61 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      }
 
 	      ix = (n - 1) * inc_intx;
-	      for (i = n - 1; i >= j + 1; i--) {
-		T_element = T_i[i * incT + j * ldt * incT];
-
-		head_temp3 = head_intx[ix];
-		tail_temp3 = tail_intx[ix];
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_temp3 * split;
-		  a11 = con - head_temp3;
-		  a11 = con - a11;
-		  a21 = head_temp3 - a11;
-		  con = T_element * split;
-		  b1 = con - T_element;
-		  b1 = con - b1;
-		  b2 = T_element - b1;
-
-		  c11 = head_temp3 * T_element;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_temp3 * T_element;
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_temp2 = t1 + t2;
-		  tail_temp2 = t2 - (head_temp2 - t1);
-		}
-		{
-		  double	  head_bt, tail_bt;
-		  head_bt = -head_temp2;
-		  tail_bt = -tail_temp2;
+	      if (blas_dd_vec_enabled()) {
+		double		head_dot, tail_dot;
+
+		blas_dot_dd_x_kernel(n - 1 - j,
+				     T_i + (j + 1) * incT + j * ldt * incT, 0,
+				     head_intx + j + 1, tail_intx + j + 1,
+				     &head_dot, &tail_dot);
+		blas_dd_add(head_temp1, tail_temp1, -head_dot, -tail_dot,
+			    &head_temp1, &tail_temp1);
+	      } else {
+		for (i = n - 1; i >= j + 1; i--) {
+		  T_element = T_i[i * incT + j * ldt * incT];
+
+		  head_temp3 = head_intx[ix];
+		  tail_temp3 = tail_intx[ix];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    /* Compute double-double = double-double * double. */
+		    double	  c11   , c21, c2, t1, t2;
 
-		    /* Add two hi words. */
-		    s1 = head_temp1 + head_bt;
-		    bv = s1 - head_temp1;
-		    s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_temp1 + tail_bt;
-		    bv = t1 - tail_temp1;
-		    t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
-
-		    s2 += t1;
+		    c11 = head_temp3 * T_element;
+		    c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    c2 = tail_temp3 * T_element;
+		    t1 = c11 + c2;
+		    t2 = (c2 - (t1 - c11)) + c21;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_temp1 = t1 + t2;
-		    tail_temp1 = t2 - (head_temp1 - t1);
+		    head_temp2 = t1 + t2;
+		    tail_temp2 = t2 - (head_temp2 - t1);
 		  }
-		}
-		ix -= inc_intx;
-	      }			/* for j<n */
+		  {
+		    double	  head_bt, tail_bt;
+		    head_bt = -head_temp2;
+		    tail_bt = -tail_temp2;
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_temp1 + head_bt;
+		      bv = s1 - head_temp1;
+		      s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_temp1 + tail_bt;
+
+		      /* Renormalize (s1, s2)  */
+		      head_temp1 = s1 + s2;
+		      tail_temp1 = s2 - (head_temp1 - s1);
+		    }
+		  }
+		  ix -= inc_intx;
+		}			/* for j<n */
+	      }
 
 	      /*
 	       * if the diagonal entry is not equal to one, then divide Xj by
@@ -421,25 +412,14 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_temp1 / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_temp1 - t12;
@@ -476,19 +456,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      /* multiply by alpha */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, alpha_i, c11);
 
 		c2 = tail_temp3 * alpha_i;
 		t1 = c11 + c2;
@@ -499,69 +470,60 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      }
 
 	      ix = 0;
-	      for (i = 0; i < j; i++) {
-		T_element = T_i[i * incT + j * ldt * incT];
-
-		head_temp3 = head_intx[ix];
-		tail_temp3 = tail_intx[ix];
-		{
-		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_temp3 * split;
-		  a11 = con - head_temp3;
-		  a11 = con - a11;
-		  a21 = head_temp3 - a11;
-		  con = T_element * split;
-		  b1 = con - T_element;
-		  b1 = con - b1;
-		  b2 = T_element - b1;
-
-		  c11 = head_temp3 * T_element;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
-
-		  c2 = tail_temp3 * T_element;
-		  t1 = c11 + c2;
-		  t2 = (c2 - (t1 - c11)) + c21;
-
-		  head_temp2 = t1 + t2;
-		  tail_temp2 = t2 - (head_temp2 - t1);
-		}
-		{
-		  double	  head_bt, tail_bt;
-		  head_bt = -head_temp2;
-		  tail_bt = -tail_temp2;
+	      if (blas_dd_vec_enabled()) {
+		double		head_dot, tail_dot;
+
+		blas_dot_dd_x_kernel(j, T_i + j * ldt * incT, 0,
+				     head_intx, tail_intx,
+				     &head_dot, &tail_dot);
+		blas_dd_add(head_temp1, tail_temp1, -head_dot, -tail_dot,
+			    &head_temp1, &tail_temp1);
+	      } else {
+		for (i = 0; i < j; i++) {
+		  T_element = T_i[i * incT + j * ldt * incT];
+
+		  head_temp3 = head_intx[ix];
+		  tail_temp3 = tail_intx[ix];
 		  {
-		    /* Compute double-double = double-double + double-double. */
-		    double	    bv;
-		    double	    s1  , s2, t1, t2;
-
-		    /* Add two hi words. */
-		    s1 = head_temp1 + head_bt;
-		    bv = s1 - head_temp1;
-		    s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
-
-		    /* Add two lo words. */
-		    t1 = tail_temp1 + tail_bt;
-		    bv = t1 - tail_temp1;
-		    t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
+		    /* Compute double-double = double-double * double. */
+		    double	  c11   , c21, c2, t1, t2;
 
-		    s2 += t1;
+		    c11 = head_temp3 * T_element;
+		    c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    c2 = tail_temp3 * T_element;
+		    t1 = c11 + c2;
+		    t2 = (c2 - (t1 - c11)) + c21;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_temp1 = t1 + t2;
-		    tail_temp1 = t2 - (head_temp1 - t1);
+		    head_temp2 = t1 + t2;
+		    tail_temp2 = t2 - (head_temp2 - t1);
 		  }
-		}
-		ix += inc_intx;
-	      }			/* for i<j */
+		  {
+		    double	  head_bt, tail_bt;
+		    head_bt = -head_temp2;
+		    tail_bt = -tail_temp2;
+		    {
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
+		      double	    bv;
+		      double	    s1  , s2;
+
+		      /* Add two hi words. */
+		      s1 = head_temp1 + head_bt;
+		      bv = s1 - head_temp1;
+		      s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
+
+		      /* Add the lo words to the error. */
+		      s2 += tail_temp1 + tail_bt;
+
+		      /* Renormalize (s1, s2)  */
+		      head_temp1 = s1 + s2;
+		      tail_temp1 = s2 - (head_temp1 - s1);
+		    }
+		  }
+		  ix += inc_intx;
+		}			/* for i<j */
+	      }
 
 	      /*
 	       * if the diagonal entry is not equal to one, then divide Xj by
@@ -576,25 +538,14 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_temp1 / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_temp1 - t12;
@@ -630,19 +581,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      /* multiply by alpha */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, alpha_i, c11);
 
 		c2 = tail_temp3 * alpha_i;
 		t1 = c11 + c2;
@@ -660,20 +602,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		tail_temp3 = tail_intx[ix];
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_temp3 * split;
-		  a11 = con - head_temp3;
-		  a11 = con - a11;
-		  a21 = head_temp3 - a11;
-		  con = T_element * split;
-		  b1 = con - T_element;
-		  b1 = con - b1;
-		  b2 = T_element - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_temp3 * T_element;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
 		  c2 = tail_temp3 * T_element;
 		  t1 = c11 + c2;
@@ -687,31 +619,22 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2;
 		  tail_bt = -tail_temp2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_temp1 + head_bt;
 		    bv = s1 - head_temp1;
 		    s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_temp1 + tail_bt;
-		    bv = t1 - tail_temp1;
-		    t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
-
-		    s2 += t1;
+		    /* Add the lo words to the error. */
+		    s2 += tail_temp1 + tail_bt;
 
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_temp1 = t1 + t2;
-		    tail_temp1 = t2 - (head_temp1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_temp1 = s1 + s2;
+		    tail_temp1 = s2 - (head_temp1 - s1);
 		  }
 		}
 		ix -= inc_intx;
@@ -730,25 +653,14 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_temp1 / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_temp1 - t12;
@@ -785,19 +697,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 	      /* multiply by alpha */
 	      {
 		/* Compute double-double = double-double * double. */
-		double		a11    , a21, b1, b2, c11, c21, c2, con, t1, t2;
-
-		con = head_temp3 * split;
-		a11 = con - head_temp3;
-		a11 = con - a11;
-		a21 = head_temp3 - a11;
-		con = alpha_i * split;
-		b1 = con - alpha_i;
-		b1 = con - b1;
-		b2 = alpha_i - b1;
+		double		c11    , c21, c2, t1, t2;
 
 		c11 = head_temp3 * alpha_i;
-		c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		c21 = BLAS_TWO_PROD_ERR(head_temp3, alpha_i, c11);
 
 		c2 = tail_temp3 * alpha_i;
 		t1 = c11 + c2;
@@ -815,20 +718,10 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		tail_temp3 = tail_intx[ix];
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_temp3 * split;
-		  a11 = con - head_temp3;
-		  a11 = con - a11;
-		  a21 = head_temp3 - a11;
-		  con = T_element * split;
-		  b1 = con - T_element;
-		  b1 = con - b1;
-		  b2 = T_element - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_temp3 * T_element;
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_temp3, T_element, c11);
 
 		  c2 = tail_temp3 * T_element;
 		  t1 = c11 + c2;
@@ -842,31 +735,22 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2;
 		  tail_bt = -tail_temp2;
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_temp1 + head_bt;
 		    bv = s1 - head_temp1;
 		    s2 = ((head_bt - bv) + (head_temp1 - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_temp1 + tail_bt;
-		    bv = t1 - tail_temp1;
-		    t2 = ((tail_bt - bv) + (tail_temp1 - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_temp1 + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_temp1 = t1 + t2;
-		    tail_temp1 = t2 - (head_temp1 - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_temp1 = s1 + s2;
+		    tail_temp1 = s2 - (head_temp1 - s1);
 		  }
 		}
 		ix += inc_intx;
@@ -885,25 +769,14 @@ void		BLAS_dtrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		   * Compute double-double = double-double / double, using a
 		   * Newton iteration scheme.
 		   */
-		  double	  b1    , b2, con, e, t1, t2, t11, t21, t12, t22;
+		  double	  e     , t1, t2, t11, t21, t12, t22;
 
 		  /* Compute a DP approximation to the quotient. */
 		  t1 = head_temp1 / T_element;
 
-		  /*
-		   * Split t1 and b into two parts with at most 26 bits each,
-		   * using the Dekker-Veltkamp method.
-		   */
-		  con = t1 * split;
-		  t11 = con - (con - t1);
-		  t21 = t1 - t11;
-		  con = T_element * split;
-		  b1 = con - (con - T_element);
-		  b2 = T_element - b1;
-
-		  /* Compute t1 * b using Dekker method. */
+		  /* Compute t1 * b exactly. */
 		  t12 = t1 * T_element;
-		  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		  t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		  /* Compute dda - (t12, t22) using Knuth trick. */
 		  t11 = head_temp1 - t12;
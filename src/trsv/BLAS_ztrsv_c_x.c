@@ -99,6 +99,7 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
 
     {
@@ -1060,20 +1061,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1084,20 +1075,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1140,20 +1121,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1164,20 +1135,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1247,20 +1208,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -1271,20 +1222,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -1296,54 +1237,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -1354,20 +1273,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -1377,34 +1286,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -1422,34 +1319,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -1459,34 +1344,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -1539,26 +1412,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -1584,26 +1445,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -1643,20 +1492,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -1669,20 +1508,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -1713,19 +1542,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -1748,20 +1566,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -1804,26 +1612,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -1862,13 +1661,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -1918,20 +1713,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -1979,26 +1764,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2037,13 +1813,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2095,19 +1867,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -2130,20 +1891,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -2186,26 +1937,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2244,13 +1986,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2300,20 +2038,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -2361,26 +2089,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2419,13 +2138,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2489,20 +2204,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -2515,20 +2220,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -2577,20 +2272,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2601,20 +2286,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2657,20 +2332,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2681,20 +2346,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2764,20 +2419,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -2788,20 +2433,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -2813,54 +2448,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -2871,20 +2484,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -2894,34 +2497,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -2939,34 +2530,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -2976,34 +2555,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -3056,26 +2623,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -3101,26 +2656,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -3160,20 +2703,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -3186,20 +2719,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -3230,19 +2753,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -3265,20 +2777,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3321,26 +2823,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3379,13 +2872,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3435,20 +2924,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3496,26 +2975,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3554,13 +3024,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3612,19 +3078,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -3647,20 +3102,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3703,26 +3148,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3761,13 +3197,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3817,20 +3249,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3878,26 +3300,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3936,13 +3349,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4006,20 +3415,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -4032,20 +3431,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -4099,20 +3488,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -4123,20 +3502,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4179,20 +3548,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -4203,20 +3562,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4286,20 +3635,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -4310,20 +3649,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -4335,54 +3664,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -4393,20 +3700,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -4416,34 +3713,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -4461,34 +3746,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -4498,34 +3771,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -4578,26 +3839,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -4623,26 +3872,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -4682,20 +3919,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -4708,20 +3935,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -4752,19 +3969,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -4787,20 +3993,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4843,26 +4039,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -4901,13 +4088,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4957,20 +4140,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5018,26 +4191,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5076,13 +4240,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5134,19 +4294,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -5169,20 +4318,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5225,26 +4364,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5283,13 +4413,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5339,20 +4465,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5400,26 +4516,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5458,13 +4565,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5528,20 +4631,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -5554,20 +4647,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -5615,20 +4698,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5639,20 +4712,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5695,20 +4758,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5719,20 +4772,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5802,20 +4845,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -5826,20 +4859,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -5851,54 +4874,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -5909,20 +4910,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -5932,34 +4923,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -5977,34 +4956,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -6014,34 +4981,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -6094,26 +5049,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -6139,26 +5082,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -6198,20 +5129,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -6224,20 +5145,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -6268,19 +5179,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -6303,20 +5203,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6359,26 +5249,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6417,13 +5298,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6473,20 +5350,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6534,26 +5401,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6592,13 +5450,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6650,19 +5504,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -6685,20 +5528,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6741,26 +5574,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6799,13 +5623,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6855,20 +5675,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6916,26 +5726,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6974,13 +5775,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -7044,20 +5841,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -7070,20 +5857,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -7136,20 +5913,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -7160,20 +5927,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7216,20 +5973,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -7240,20 +5987,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7323,20 +6060,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -7347,20 +6074,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -7372,54 +6089,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -7430,20 +6125,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -7453,34 +6138,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -7498,34 +6171,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -7535,34 +6196,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -7615,26 +6264,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -7660,26 +6297,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -7719,20 +6344,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -7745,20 +6360,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -7789,19 +6394,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -7824,20 +6418,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7880,26 +6464,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -7938,13 +6513,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -7994,20 +6565,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -8055,26 +6616,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8113,13 +6665,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8171,19 +6719,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -8206,20 +6743,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -8262,26 +6789,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8320,13 +6838,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8376,20 +6890,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -8437,26 +6941,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8495,13 +6990,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8565,20 +7056,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -8591,20 +7072,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -8653,20 +7124,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -8677,20 +7138,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -8733,20 +7184,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -8757,20 +7198,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -8840,20 +7271,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -8864,20 +7285,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -8889,54 +7300,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -8947,20 +7336,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -8970,34 +7349,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -9015,34 +7382,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -9052,34 +7407,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -9132,26 +7475,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -9177,26 +7508,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -9236,20 +7555,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -9262,20 +7571,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -9306,19 +7605,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -9341,20 +7629,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9397,26 +7675,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9455,13 +7724,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9511,20 +7776,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9572,26 +7827,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9630,13 +7876,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9688,19 +7930,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -9723,20 +7954,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9779,26 +8000,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9837,13 +8049,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9893,20 +8101,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9954,26 +8152,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -10012,13 +8201,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -10082,20 +8267,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -10108,20 +8283,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -10175,20 +8340,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -10199,20 +8354,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -10255,20 +8400,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -10279,20 +8414,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -10362,20 +8487,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -10386,20 +8501,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -10411,54 +8516,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -10469,20 +8552,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -10492,34 +8565,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -10537,34 +8598,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -10574,34 +8623,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -10654,26 +8691,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -10699,26 +8724,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -10758,20 +8771,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -10784,20 +8787,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -10828,19 +8821,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -10863,20 +8845,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10919,26 +8891,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -10977,13 +8940,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11033,20 +8992,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -11094,26 +9043,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11152,13 +9092,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11210,19 +9146,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -11245,20 +9170,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -11301,26 +9216,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11359,13 +9265,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11415,20 +9317,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -11476,26 +9368,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11534,13 +9417,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11604,20 +9483,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -11630,20 +9499,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -11691,20 +9550,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -11715,20 +9564,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -11771,20 +9610,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -11795,20 +9624,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -11878,20 +9697,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      /* real part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[0], c11);
 
 			c2 = tail_a0 * cd[0];
 			t1 = c11 + c2;
@@ -11902,20 +9711,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[1], c11);
 
 			c2 = tail_a1 * cd[1];
 			t1 = c11 + c2;
@@ -11927,54 +9726,32 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      head_t2 = -head_t2;
 		      tail_t2 = -tail_t2;
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
-
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[0] = head_t1;
 		      tail_temp2[0] = tail_t1;
 		      /* imaginary part */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = cd[0] * split;
-			b1 = con - cd[0];
-			b1 = con - b1;
-			b2 = cd[0] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * cd[0];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, cd[0], c11);
 
 			c2 = tail_a1 * cd[0];
 			t1 = c11 + c2;
@@ -11985,20 +9762,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = cd[1] * split;
-			b1 = con - cd[1];
-			b1 = con - b1;
-			b2 = cd[1] - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * cd[1];
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, cd[1], c11);
 
 			c2 = tail_a0 * cd[1];
 			t1 = c11 + c2;
@@ -12008,34 +9775,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_t2 = t2 - (head_t2 - t1);
 		      }
 		      {
-			/*
-			 * Compute double-double = double-double +
-			 * double-double.
-			 */
+			/* Compute double-double = double-double + double-double,
+			   renormalizing once. */
 			double		bv;
-			double		s1     , s2, t1, t2;
+			double		s1     , s2;
 
 			/* Add two hi words. */
 			s1 = head_t1 + head_t2;
 			bv = s1 - head_t1;
 			s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-			/* Add two lo words. */
-			t1 = tail_t1 + tail_t2;
-			bv = t1 - tail_t1;
-			t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-			s2 += t1;
-
-			/* Renormalize (s1, s2)  to  (t1, s2) */
-			t1 = s1 + s2;
-			s2 = s2 - (t1 - s1);
-
-			t2 += s2;
+			/* Add the lo words to the error. */
+			s2 += tail_t1 + tail_t2;
 
-			/* Renormalize (t1, t2)  */
-			head_t1 = t1 + t2;
-			tail_t1 = t2 - (head_t1 - t1);
+			/* Renormalize (s1, s2)  */
+			head_t1 = s1 + s2;
+			tail_t1 = s2 - (head_t1 - s1);
 		      }
 		      head_temp2[1] = head_t1;
 		      tail_temp2[1] = tail_t1;
@@ -12053,34 +9808,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -12090,34 +9833,22 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -12170,26 +9901,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -12215,26 +9934,14 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -12274,20 +9981,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -12300,20 +9997,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -12344,19 +10031,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[1];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -12379,20 +10055,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12435,26 +10101,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12493,13 +10150,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12549,20 +10202,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12610,26 +10253,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12668,13 +10302,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12726,19 +10356,8 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			double		dt = (double)T_element[0];
 			{
 			  /* Compute double_double = double * double. */
-			  double	  a1    , a2, b1, b2, con;
-
-			  con = r * split;
-			  a1 = con - r;
-			  a1 = con - a1;
-			  a2 = r - a1;
-			  con = dt * split;
-			  b1 = con - dt;
-			  b1 = con - b1;
-			  b2 = dt - b1;
-
 			  head_t = r * dt;
-			  tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			  tail_t = BLAS_TWO_PROD_ERR(r, dt, head_t);
 			}
 		      }
 		      {
@@ -12761,20 +10380,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12817,26 +10426,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12875,13 +10475,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12931,20 +10527,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12992,26 +10578,17 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -13050,13 +10627,9 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -13120,20 +10693,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -13146,20 +10709,10 @@ void		BLAS_ztrsv_c_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -99,6 +99,7 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
 
     {
@@ -383,20 +384,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -407,20 +398,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -463,20 +444,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -487,20 +458,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -560,20 +521,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element, c11);
 
 		    c2 = tail_a0 * T_element;
 		    t1 = c11 + c2;
@@ -586,20 +537,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element, c11);
 
 		    c2 = tail_a1 * T_element;
 		    t1 = c11 + c2;
@@ -623,31 +564,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -657,31 +589,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -707,26 +630,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -749,26 +660,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -823,20 +722,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -847,20 +736,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -903,20 +782,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -927,20 +796,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1000,20 +859,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element, c11);
 
 		    c2 = tail_a0 * T_element;
 		    t1 = c11 + c2;
@@ -1026,20 +875,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element, c11);
 
 		    c2 = tail_a1 * T_element;
 		    t1 = c11 + c2;
@@ -1063,31 +902,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1097,31 +927,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1147,26 +968,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1189,26 +998,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1262,20 +1059,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1286,20 +1073,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1342,20 +1119,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1366,20 +1133,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1439,20 +1196,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element, c11);
 
 		    c2 = tail_a0 * T_element;
 		    t1 = c11 + c2;
@@ -1465,20 +1212,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element, c11);
 
 		    c2 = tail_a1 * T_element;
 		    t1 = c11 + c2;
@@ -1502,31 +1239,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1536,31 +1264,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -1586,26 +1305,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1628,26 +1335,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -1702,20 +1397,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* real part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		  c2 = tail_a0 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1726,20 +1411,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		  c2 = tail_a1 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1782,20 +1457,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		/* imaginary part */
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a1 * split;
-		  a11 = con - head_a1;
-		  a11 = con - a11;
-		  a21 = head_a1 - a11;
-		  con = alpha_i[0] * split;
-		  b1 = con - alpha_i[0];
-		  b1 = con - b1;
-		  b2 = alpha_i[0] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a1 * alpha_i[0];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		  c2 = tail_a1 * alpha_i[0];
 		  t1 = c11 + c2;
@@ -1806,20 +1471,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		}
 		{
 		  /* Compute double-double = double-double * double. */
-		  double	  a11   , a21, b1, b2, c11, c21, c2, con, t1,
-		  		  t2;
-
-		  con = head_a0 * split;
-		  a11 = con - head_a0;
-		  a11 = con - a11;
-		  a21 = head_a0 - a11;
-		  con = alpha_i[1] * split;
-		  b1 = con - alpha_i[1];
-		  b1 = con - b1;
-		  b2 = alpha_i[1] - b1;
+		  double	  c11   , c21, c2, t1, t2;
 
 		  c11 = head_a0 * alpha_i[1];
-		  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		  c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		  c2 = tail_a0 * alpha_i[1];
 		  t1 = c11 + c2;
@@ -1879,20 +1534,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_a1 = tail_temp3[1];
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, T_element, c11);
 
 		    c2 = tail_a0 * T_element;
 		    t1 = c11 + c2;
@@ -1905,20 +1550,10 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  tail_temp2[0] = tail_t;
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = T_element * split;
-		    b1 = con - T_element;
-		    b1 = con - b1;
-		    b2 = T_element - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * T_element;
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, T_element, c11);
 
 		    c2 = tail_a1 * T_element;
 		    t1 = c11 + c2;
@@ -1942,31 +1577,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[0];
 		  tail_bt = -tail_temp2[0];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
-
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[0] = head_ct;
 		  tail_temp1[0] = tail_ct;
@@ -1976,31 +1602,22 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  head_bt = -head_temp2[1];
 		  tail_bt = -tail_temp2[1];
 		  {
-		    /* Compute double-double = double-double + double-double. */
+		    /* Compute double-double = double-double + double-double,
+		       renormalizing once. */
 		    double	    bv;
-		    double	    s1  , s2, t1, t2;
+		    double	    s1  , s2;
 
 		    /* Add two hi words. */
 		    s1 = head_at + head_bt;
 		    bv = s1 - head_at;
 		    s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		    /* Add two lo words. */
-		    t1 = tail_at + tail_bt;
-		    bv = t1 - tail_at;
-		    t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		    s2 += t1;
-
-		    /* Renormalize (s1, s2)  to  (t1, s2) */
-		    t1 = s1 + s2;
-		    s2 = s2 - (t1 - s1);
+		    /* Add the lo words to the error. */
+		    s2 += tail_at + tail_bt;
 
-		    t2 += s2;
-
-		    /* Renormalize (t1, t2)  */
-		    head_ct = t1 + t2;
-		    tail_ct = t2 - (head_ct - t1);
+		    /* Renormalize (s1, s2)  */
+		    head_ct = s1 + s2;
+		    tail_ct = s2 - (head_ct - s1);
 		  }
 		  head_temp1[1] = head_ct;
 		  tail_temp1[1] = tail_ct;
@@ -2026,26 +1643,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
@@ -2068,26 +1673,14 @@ void		BLAS_ztrsv_d_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		     * Compute double-double = double-double / double, using
 		     * a Newton iteration scheme.
 		     */
-		    double	    b1  , b2, con, e, t1, t2, t11, t21, t12,
-		    		    t22;
+		    double	    e   , t1, t2, t11, t21, t12, t22;
 
 		    /* Compute a DP approximation to the quotient. */
 		    t1 = head_a / T_element;
 
-		    /*
-		     * Split t1 and b into two parts with at most 26 bits
-		     * each, using the Dekker-Veltkamp method.
-		     */
-		    con = t1 * split;
-		    t11 = con - (con - t1);
-		    t21 = t1 - t11;
-		    con = T_element * split;
-		    b1 = con - (con - T_element);
-		    b2 = T_element - b1;
-
-		    /* Compute t1 * b using Dekker method. */
+		    /* Compute t1 * b exactly. */
 		    t12 = t1 * T_element;
-		    t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+		    t22 = BLAS_TWO_PROD_ERR(t1, T_element, t12);
 
 		    /* Compute dda - (t12, t22) using Knuth trick. */
 		    t11 = head_a - t12;
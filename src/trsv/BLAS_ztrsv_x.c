@@ -99,6 +99,7 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:
 
     {
@@ -1028,20 +1029,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1052,20 +1043,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1108,20 +1089,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -1132,20 +1103,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -1211,20 +1172,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -1235,20 +1186,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -1260,54 +1201,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -1318,20 +1237,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -1341,34 +1250,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -1385,34 +1282,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -1422,34 +1307,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -1503,26 +1376,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -1548,26 +1409,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -1607,20 +1456,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -1633,20 +1472,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -1675,19 +1504,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -1706,20 +1524,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -1762,26 +1570,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -1820,13 +1619,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -1876,20 +1671,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -1937,26 +1722,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -1995,13 +1771,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2051,19 +1823,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -2082,20 +1843,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -2138,26 +1889,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2196,13 +1938,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2252,20 +1990,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -2313,26 +2041,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -2371,13 +2090,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -2441,20 +2156,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -2467,20 +2172,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -2529,20 +2224,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2553,20 +2238,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2609,20 +2284,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -2633,20 +2298,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -2712,20 +2367,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -2736,20 +2381,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -2761,54 +2396,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -2819,20 +2432,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -2842,34 +2445,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -2886,34 +2477,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -2923,34 +2502,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -3004,26 +2571,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -3049,26 +2604,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -3108,20 +2651,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -3134,20 +2667,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -3176,19 +2699,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -3207,20 +2719,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3263,26 +2765,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3321,13 +2814,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3377,20 +2866,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3438,26 +2917,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3496,13 +2966,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3552,19 +3018,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -3583,20 +3038,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3639,26 +3084,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3697,13 +3133,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3753,20 +3185,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -3814,26 +3236,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -3872,13 +3285,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -3942,20 +3351,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -3968,20 +3367,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -4035,20 +3424,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -4059,20 +3438,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4115,20 +3484,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -4139,20 +3498,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -4218,20 +3567,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -4242,20 +3581,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -4267,54 +3596,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -4325,20 +3632,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -4348,34 +3645,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -4392,34 +3677,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -4429,34 +3702,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -4510,26 +3771,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -4555,26 +3804,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -4614,20 +3851,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -4640,20 +3867,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -4682,19 +3899,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -4713,20 +3919,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4769,26 +3965,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -4827,13 +4014,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -4883,20 +4066,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -4944,26 +4117,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5002,13 +4166,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5058,19 +4218,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -5089,20 +4238,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5145,26 +4284,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5203,13 +4333,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5259,20 +4385,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -5320,26 +4436,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -5378,13 +4485,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -5448,20 +4551,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -5474,20 +4567,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -5535,20 +4618,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5559,20 +4632,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5615,20 +4678,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -5639,20 +4692,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -5718,20 +4761,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -5742,20 +4775,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -5767,54 +4790,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -5825,20 +4826,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -5848,34 +4839,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -5892,34 +4871,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -5929,34 +4896,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -6010,26 +4965,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -6055,26 +4998,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -6114,20 +5045,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -6140,20 +5061,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -6182,19 +5093,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -6213,20 +5113,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6269,26 +5159,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6327,13 +5208,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6383,20 +5260,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6444,26 +5311,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6502,13 +5360,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6558,19 +5412,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -6589,20 +5432,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6645,26 +5478,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6703,13 +5527,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6759,20 +5579,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -6820,26 +5630,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -6878,13 +5679,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -6948,20 +5745,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -6974,20 +5761,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -7040,20 +5817,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -7064,20 +5831,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7120,20 +5877,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -7144,20 +5891,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -7223,20 +5960,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -7247,20 +5974,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -7272,54 +5989,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -7330,20 +6025,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -7353,34 +6038,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -7397,34 +6070,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -7434,34 +6095,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -7515,26 +6164,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -7560,26 +6197,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -7619,20 +6244,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -7645,20 +6260,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -7687,19 +6292,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -7718,20 +6312,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7774,26 +6358,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -7832,13 +6407,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -7888,20 +6459,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -7949,26 +6510,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8007,13 +6559,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8063,19 +6611,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -8094,20 +6631,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -8150,26 +6677,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8208,13 +6726,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8264,20 +6778,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -8325,26 +6829,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -8383,13 +6878,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -8453,20 +6944,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -8479,20 +6960,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -8541,20 +7012,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -8565,20 +7026,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -8621,20 +7072,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -8645,20 +7086,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -8724,20 +7155,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -8748,20 +7169,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -8773,54 +7184,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -8831,20 +7220,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -8854,34 +7233,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -8898,34 +7265,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -8935,34 +7290,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -9016,26 +7359,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -9061,26 +7392,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -9120,20 +7439,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -9146,20 +7455,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -9188,19 +7487,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -9219,20 +7507,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9275,26 +7553,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9333,13 +7602,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9389,20 +7654,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9450,26 +7705,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9508,13 +7754,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9564,19 +7806,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -9595,20 +7826,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9651,26 +7872,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9709,13 +7921,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9765,20 +7973,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -9826,26 +8024,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -9884,13 +8073,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -9954,20 +8139,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -9980,20 +8155,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -10047,20 +8212,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -10071,20 +8226,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -10127,20 +8272,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -10151,20 +8286,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -10230,20 +8355,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -10254,20 +8369,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -10279,54 +8384,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -10337,20 +8420,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -10360,34 +8433,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -10404,34 +8465,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -10441,34 +8490,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -10522,26 +8559,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -10567,26 +8592,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -10626,20 +8639,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -10652,20 +8655,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -10694,19 +8687,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -10725,20 +8707,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10781,26 +8753,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -10839,13 +8802,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -10895,20 +8854,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -10956,26 +8905,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11014,13 +8954,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11070,19 +9006,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -11101,20 +9026,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -11157,26 +9072,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11215,13 +9121,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11271,20 +9173,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -11332,26 +9224,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -11390,13 +9273,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -11460,20 +9339,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -11486,20 +9355,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
@@ -11547,20 +9406,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* real part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[0], c11);
 
 		    c2 = tail_a0 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -11571,20 +9420,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[1], c11);
 
 		    c2 = tail_a1 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -11627,20 +9466,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  /* imaginary part */
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a1 * split;
-		    a11 = con - head_a1;
-		    a11 = con - a11;
-		    a21 = head_a1 - a11;
-		    con = alpha_i[0] * split;
-		    b1 = con - alpha_i[0];
-		    b1 = con - b1;
-		    b2 = alpha_i[0] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a1 * alpha_i[0];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a1, alpha_i[0], c11);
 
 		    c2 = tail_a1 * alpha_i[0];
 		    t1 = c11 + c2;
@@ -11651,20 +9480,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		  }
 		  {
 		    /* Compute double-double = double-double * double. */
-		    double	    a11 , a21, b1, b2, c11, c21, c2, con, t1,
-		    		    t2;
-
-		    con = head_a0 * split;
-		    a11 = con - head_a0;
-		    a11 = con - a11;
-		    a21 = head_a0 - a11;
-		    con = alpha_i[1] * split;
-		    b1 = con - alpha_i[1];
-		    b1 = con - b1;
-		    b2 = alpha_i[1] - b1;
+		    double	    c11 , c21, c2, t1, t2;
 
 		    c11 = head_a0 * alpha_i[1];
-		    c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		    c21 = BLAS_TWO_PROD_ERR(head_a0, alpha_i[1], c11);
 
 		    c2 = tail_a0 * alpha_i[1];
 		    t1 = c11 + c2;
@@ -11730,20 +9549,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    /* real part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[0], c11);
 
 		      c2 = tail_a0 * T_element[0];
 		      t1 = c11 + c2;
@@ -11754,20 +9563,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[1], c11);
 
 		      c2 = tail_a1 * T_element[1];
 		      t1 = c11 + c2;
@@ -11779,54 +9578,32 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_t2 = -head_t2;
 		    tail_t2 = -tail_t2;
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[0] = head_t1;
 		    tail_temp2[0] = tail_t1;
 		    /* imaginary part */
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a1 * split;
-		      a11 = con - head_a1;
-		      a11 = con - a11;
-		      a21 = head_a1 - a11;
-		      con = T_element[0] * split;
-		      b1 = con - T_element[0];
-		      b1 = con - b1;
-		      b2 = T_element[0] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a1 * T_element[0];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a1, T_element[0], c11);
 
 		      c2 = tail_a1 * T_element[0];
 		      t1 = c11 + c2;
@@ -11837,20 +9614,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    }
 		    {
 		      /* Compute double-double = double-double * double. */
-		      double	      a11, a21, b1, b2, c11, c21, c2, con,
-		      		      t1     , t2;
-
-		      con = head_a0 * split;
-		      a11 = con - head_a0;
-		      a11 = con - a11;
-		      a21 = head_a0 - a11;
-		      con = T_element[1] * split;
-		      b1 = con - T_element[1];
-		      b1 = con - b1;
-		      b2 = T_element[1] - b1;
+		      double	      c11, c21, c2, t1, t2;
 
 		      c11 = head_a0 * T_element[1];
-		      c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+		      c21 = BLAS_TWO_PROD_ERR(head_a0, T_element[1], c11);
 
 		      c2 = tail_a0 * T_element[1];
 		      t1 = c11 + c2;
@@ -11860,34 +9627,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t2 = t2 - (head_t2 - t1);
 		    }
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_t1 + head_t2;
 		      bv = s1 - head_t1;
 		      s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_t1 + tail_t2;
-		      bv = t1 - tail_t1;
-		      t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_t1 + tail_t2;
 
-		      /* Renormalize (t1, t2)  */
-		      head_t1 = t1 + t2;
-		      tail_t1 = t2 - (head_t1 - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_t1 = s1 + s2;
+		      tail_t1 = s2 - (head_t1 - s1);
 		    }
 		    head_temp2[1] = head_t1;
 		    tail_temp2[1] = tail_t1;
@@ -11904,34 +9659,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[0];
 		    tail_bt = -tail_temp2[0];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      t2 += s2;
-
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[0] = head_ct;
 		    tail_temp1[0] = tail_ct;
@@ -11941,34 +9684,22 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		    head_bt = -head_temp2[1];
 		    tail_bt = -tail_temp2[1];
 		    {
-		      /*
-		       * Compute double-double = double-double +
-		       * double-double.
-		       */
+		      /* Compute double-double = double-double + double-double,
+		         renormalizing once. */
 		      double	      bv;
-		      double	      s1, s2, t1, t2;
+		      double	      s1, s2;
 
 		      /* Add two hi words. */
 		      s1 = head_at + head_bt;
 		      bv = s1 - head_at;
 		      s2 = ((head_bt - bv) + (head_at - (s1 - bv)));
 
-		      /* Add two lo words. */
-		      t1 = tail_at + tail_bt;
-		      bv = t1 - tail_at;
-		      t2 = ((tail_bt - bv) + (tail_at - (t1 - bv)));
-
-		      s2 += t1;
-
-		      /* Renormalize (s1, s2)  to  (t1, s2) */
-		      t1 = s1 + s2;
-		      s2 = s2 - (t1 - s1);
-
-		      t2 += s2;
+		      /* Add the lo words to the error. */
+		      s2 += tail_at + tail_bt;
 
-		      /* Renormalize (t1, t2)  */
-		      head_ct = t1 + t2;
-		      tail_ct = t2 - (head_ct - t1);
+		      /* Renormalize (s1, s2)  */
+		      head_ct = s1 + s2;
+		      tail_ct = s2 - (head_ct - s1);
 		    }
 		    head_temp1[1] = head_ct;
 		    tail_temp1[1] = tail_ct;
@@ -12022,26 +9753,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -12067,26 +9786,14 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			   * Compute double-double = double-double / double,
 			   * using a Newton iteration scheme.
 			   */
-			  double	  b1    , b2, con, e, t1, t2, t11, t21,
-			  		  t12        , t22;
+			  double	  e     , t1, t2, t11, t21, t12, t22;
 
 			  /* Compute a DP approximation to the quotient. */
 			  t1 = head_a / 16.0;
 
-			  /*
-			   * Split t1 and b into two parts with at most 26
-			   * bits each, using the Dekker-Veltkamp method.
-			   */
-			  con = t1 * split;
-			  t11 = con - (con - t1);
-			  t21 = t1 - t11;
-			  con = 16.0 * split;
-			  b1 = con - (con - 16.0);
-			  b2 = 16.0 - b1;
-
-			  /* Compute t1 * b using Dekker method. */
+			  /* Compute t1 * b exactly. */
 			  t12 = t1 * 16.0;
-			  t22 = (((t11 * b1 - t12) + t11 * b2) + t21 * b1) + t21 * b2;
+			  t22 = BLAS_TWO_PROD_ERR(t1, 16.0, t12);
 
 			  /* Compute dda - (t12, t22) using Knuth trick. */
 			  t11 = head_a - t12;
@@ -12126,20 +9833,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_a1 = tail_temp1[1];
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a0 * split;
-			  a11 = con - head_a0;
-			  a11 = con - a11;
-			  a21 = head_a0 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a0 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a0, s, c11);
 
 			  c2 = tail_a0 * s;
 			  t1 = c11 + c2;
@@ -12152,20 +9849,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 			tail_temp1[0] = tail_t;
 			{
 			  /* Compute double-double = double-double * double. */
-			  double	  a11   , a21, b1, b2, c11, c21, c2, con,
-			  		  t1         , t2;
-
-			  con = head_a1 * split;
-			  a11 = con - head_a1;
-			  a11 = con - a11;
-			  a21 = head_a1 - a11;
-			  con = s * split;
-			  b1 = con - s;
-			  b1 = con - b1;
-			  b2 = s - b1;
+			  double	  c11   , c21, c2, t1, t2;
 
 			  c11 = head_a1 * s;
-			  c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			  c21 = BLAS_TWO_PROD_ERR(head_a1, s, c11);
 
 			  c2 = tail_a1 * s;
 			  t1 = c11 + c2;
@@ -12194,19 +9881,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[1] / T_element[0];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[1] * split;
-			b1 = con - T_element[1];
-			b1 = con - b1;
-			b2 = T_element[1] - b1;
-
 			head_t = r * T_element[1];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[1], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -12225,20 +9901,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12281,26 +9947,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12339,13 +9996,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12395,20 +10048,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12456,26 +10099,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b - a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12514,13 +10148,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12570,19 +10200,8 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      r = T_element[0] / T_element[1];
 		      {
 			/* Compute double_double = double * double. */
-			double		a1     , a2, b1, b2, con;
-
-			con = r * split;
-			a1 = con - r;
-			a1 = con - a1;
-			a2 = r - a1;
-			con = T_element[0] * split;
-			b1 = con - T_element[0];
-			b1 = con - b1;
-			b2 = T_element[0] - b1;
-
 			head_t = r * T_element[0];
-			tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+			tail_t = BLAS_TWO_PROD_ERR(r, T_element[0], head_t);
 		      }
 		      {
 			/* Compute double-double = double-double + double. */
@@ -12601,20 +10220,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[0];	/* a */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12657,26 +10266,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* b + a*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12715,13 +10315,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12771,20 +10367,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_t1 = tail_temp1[1];	/* b */
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_t1 * split;
-			a11 = con - head_t1;
-			a11 = con - a11;
-			a21 = head_t1 - a11;
-			con = r * split;
-			b1 = con - r;
-			b1 = con - b1;
-			b2 = r - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_t1 * r;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_t1, r, c11);
 
 			c2 = tail_t1 * r;
 			t1 = c11 + c2;
@@ -12832,26 +10418,17 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      }		/* -a + b*r */
 		      {
 			double		q1     , q2, q3;
-			double		a1     , a2, b1, b2;
 			double		p1     , p2, c;
 			double		s1     , s2, v;
 			double		t1     , t2;
 			double		r1     , r2;
-			double		cona   , conb;
 
 			q1 = head_t2 / head_t;	/* approximate quotient */
 
 			/* Compute  q1 * b  */
-			cona = q1 * split;
-			conb = head_t * split;
-			a1 = cona - (cona - q1);
-			b1 = conb - (conb - head_t);
-			a2 = q1 - a1;
-			b2 = head_t - b1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q1 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q1, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q1 * tail_t;
@@ -12890,13 +10467,9 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 
 
 			/* Compute residual   r1 - q2 * b          */
-			cona = q2 * split;
-			a1 = cona - (cona - q2);
-			a2 = q2 - a1;
-
 			/* (p1, p2) is the product of high order terms. */
 			p1 = q2 * head_t;
-			p2 = (((a1 * b1 - p1) + a1 * b2) + a2 * b1) + a2 * b2;
+			p2 = BLAS_TWO_PROD_ERR(q2, head_t, p1);
 
 			/* Compute the low-order term */
 			c = q2 * tail_t;
@@ -12960,20 +10533,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_a1 = tail_q[1];
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a0 * split;
-			a11 = con - head_a0;
-			a11 = con - a11;
-			a21 = head_a0 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a0 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a0, S, c11);
 
 			c2 = tail_a0 * S;
 			t1 = c11 + c2;
@@ -12986,20 +10549,10 @@ void		BLAS_ztrsv_x(enum blas_order_type order, enum blas_uplo_type uplo,
 		      tail_temp1[0] = tail_t;
 		      {
 			/* Compute double-double = double-double * double. */
-			double		a11    , a21, b1, b2, c11, c21, c2, con,
-					t1           , t2;
-
-			con = head_a1 * split;
-			a11 = con - head_a1;
-			a11 = con - a11;
-			a21 = head_a1 - a11;
-			con = S * split;
-			b1 = con - S;
-			b1 = con - b1;
-			b2 = S - b1;
+			double		c11    , c21, c2, t1, t2;
 
 			c11 = head_a1 * S;
-			c21 = (((a11 * b1 - c11) + a11 * b2) + a21 * b1) + a21 * b2;
+			c21 = BLAS_TWO_PROD_ERR(head_a1, S, c11);
 
 			c2 = tail_a1 * S;
 			t1 = c11 + c2;
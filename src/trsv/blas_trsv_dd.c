@@ -0,0 +1,241 @@
+#include "blas_extended.h"
+#include "blas_extended_private.h"
+#include "blas_dd_private.h"
+#include "blas_dd_vec.h"
+#include "blas_threads.h"
+#include "blas_trsv_dd.h"
+
+/*
+ * Element (j, i) of op(T) is t[j*rs + i*cs], and it is zero unless
+ * |i - j| <= k (k = n - 1 for a full triangle).  'backward' solves the
+ * upper triangular case from the last entry up, otherwise the lower one
+ * from the first entry down.  Each step computes
+ *
+ *   x[j] <- (alpha * x[j] - SUM_i T(j, i) * x[i]) / T(j, j)
+ *
+ * over the entries i already solved, in double-double, splitting the
+ * sum into the panel of earlier blocks and the diagonal block.
+ */
+
+struct trsv_dd {
+  int n, k, backward;
+  const void *t;
+  int t_single, rs, cs;
+  int non_unit;
+  double alpha;
+  double *head_x, *tail_x;
+};
+
+static double t_elt(const struct trsv_dd *s, int j, int i)
+{
+  int off = j * s->rs + i * s->cs;
+
+  return s->t_single ? ((const float *) s->t)[off]
+    : ((const double *) s->t)[off];
+}
+
+static const void *t_ptr(const struct trsv_dd *s, int j, int i)
+{
+  int off = j * s->rs + i * s->cs;
+
+  return s->t_single ? (const void *) ((const float *) s->t + off)
+    : (const void *) ((const double *) s->t + off);
+}
+
+/* (head_u, tail_u)[j - j0] <- SUM T(j, i) * x[i] over i in [lo, hi) for
+   the rows j of the block [j0, j1), inside the band. */
+static void panel(const struct trsv_dd *s, int j0, int j1, int lo, int hi,
+		  double *head_u, double *tail_u)
+{
+  int i, j;
+
+  for (j = j0; j < j1; j++)
+    head_u[j - j0] = tail_u[j - j0] = 0.0;
+
+  if (s->rs == 1) {
+    /* Columns are contiguous: sweep runs of columns that share the same
+       rows in the band. */
+    i = lo;
+    while (i < hi) {
+      int r0 = MAX(j0, i - s->k), r1 = MIN(j1, i + s->k + 1);
+      int c = i + 1;
+
+      while (c < hi && MAX(j0, c - s->k) == r0
+	     && MIN(j1, c + s->k + 1) == r1)
+	c++;
+      if (r0 < r1)
+	blas_gemv_dd_cols_x_kernel(r1 - r0, c - i, t_ptr(s, r0, i),
+				   s->t_single, s->cs, s->head_x + i,
+				   s->tail_x + i, 0, head_u + r0 - j0,
+				   tail_u + r0 - j0);
+      i = c;
+    }
+  } else if (s->cs == 1) {
+    /* Rows are contiguous: one dot per row. */
+    for (j = j0; j < j1; j++) {
+      int c0 = MAX(lo, j - s->k), c1 = MIN(hi, j + s->k + 1);
+
+      if (c0 < c1)
+	blas_dot_dd_x_kernel(c1 - c0, t_ptr(s, j, c0), s->t_single,
+			     s->head_x + c0, s->tail_x + c0,
+			     &head_u[j - j0], &tail_u[j - j0]);
+    }
+  } else {
+    for (j = j0; j < j1; j++) {
+      int c0 = MAX(lo, j - s->k), c1 = MIN(hi, j + s->k + 1);
+
+      for (i = c0; i < c1; i++) {
+	double head_prod, tail_prod;
+
+	blas_dd_mul_d(s->head_x[i], s->tail_x[i], t_elt(s, j, i),
+		      &head_prod, &tail_prod);
+	blas_dd_add_lazy(head_u[j - j0], tail_u[j - j0], head_prod, tail_prod,
+			 &head_u[j - j0], &tail_u[j - j0]);
+      }
+    }
+  }
+}
+
+/* Solves x[j] for the entries of the block [j0, j1) in order, given the
+   panel sums u. */
+static void diag_block(const struct trsv_dd *s, int j0, int j1,
+		       const double *head_u, const double *tail_u)
+{
+  int jj, i;
+
+  for (jj = 0; jj < j1 - j0; jj++) {
+    int j = s->backward ? j1 - 1 - jj : j0 + jj;
+    int c0 = s->backward ? j + 1 : MAX(j0, j - s->k);
+    int c1 = s->backward ? MIN(j1, j + s->k + 1) : j;
+    double head_t, tail_t;
+
+    blas_dd_mul_d(s->head_x[j], s->tail_x[j], s->alpha, &head_t, &tail_t);
+    blas_dd_add(head_t, tail_t, -head_u[j - j0], -tail_u[j - j0],
+		&head_t, &tail_t);
+    for (i = c0; i < c1; i++) {
+      double head_prod, tail_prod;
+
+      blas_dd_mul_d(s->head_x[i], s->tail_x[i], t_elt(s, j, i),
+		    &head_prod, &tail_prod);
+      blas_dd_add_lazy(head_t, tail_t, -head_prod, -tail_prod,
+		       &head_t, &tail_t);
+    }
+    if (s->non_unit)
+      blas_dd_div_d(head_t, tail_t, t_elt(s, j, j), &head_t, &tail_t);
+    s->head_x[j] = head_t;
+    s->tail_x[j] = tail_t;
+  }
+}
+
+static void solve(const struct trsv_dd *s)
+{
+  double head_u[BLAS_TRSV_NB], tail_u[BLAS_TRSV_NB];
+  int b, j0, j1;
+
+  for (b = 0; b < s->n; b += BLAS_TRSV_NB) {
+    if (s->backward) {
+      j1 = s->n - b;
+      j0 = MAX(0, j1 - BLAS_TRSV_NB);
+      panel(s, j0, j1, j1, MIN(s->n, j1 + s->k), head_u, tail_u);
+    } else {
+      j0 = b;
+      j1 = MIN(s->n, j0 + BLAS_TRSV_NB);
+      panel(s, j0, j1, MAX(0, j0 - s->k), j0, head_u, tail_u);
+    }
+    diag_block(s, j0, j1, head_u, tail_u);
+  }
+}
+
+/* Runs the solve on a double-double copy of x.  A(r, c) of the stored
+   matrix is t[r*ar + c*ac]. */
+static int solve_x(struct trsv_dd *s, enum blas_uplo_type uplo,
+		   int transposed, int ar, int ac,
+		   void *x, int x_single, int incx)
+{
+  int i, ix;
+  FPU_FIX_DECL;
+
+  s->head_x = (double *) blas_thread_scratch(2 * (size_t) s->n *
+					     sizeof(double));
+  if (s->head_x == NULL)
+    return 0;
+  s->tail_x = s->head_x + s->n;
+
+  /* op(T)(j, i) is A(j, i), or A(i, j) when transposed. */
+  if (!transposed) {
+    s->rs = ar;
+    s->cs = ac;
+  } else {
+    s->rs = ac;
+    s->cs = ar;
+  }
+  s->backward = ((uplo == blas_upper) != transposed);
+
+  FPU_FIX_START;
+
+  ix = (incx < 0) ? (1 - s->n) * incx : 0;
+  for (i = 0; i < s->n; i++, ix += incx) {
+    s->head_x[i] = x_single ? ((float *) x)[ix] : ((double *) x)[ix];
+    s->tail_x[i] = 0.0;
+  }
+
+  solve(s);
+
+  ix = (incx < 0) ? (1 - s->n) * incx : 0;
+  for (i = 0; i < s->n; i++, ix += incx) {
+    if (x_single)
+      ((float *) x)[ix] = s->head_x[i];
+    else
+      ((double *) x)[ix] = s->head_x[i];
+  }
+
+  FPU_FIX_STOP;
+  return 1;
+}
+
+int blas_trsv_dd_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, enum blas_diag_type diag,
+		   int n, double alpha, const void *t, int t_single, int ldt,
+		   void *x, int x_single, int incx)
+{
+  struct trsv_dd s;
+  int transposed;
+
+  s.n = n;
+  s.k = n - 1;
+  s.t = t;
+  s.t_single = t_single;
+  s.non_unit = (diag == blas_non_unit_diag);
+  s.alpha = alpha;
+  transposed = (trans != blas_no_trans);
+  if (order == blas_colmajor)
+    return solve_x(&s, uplo, transposed, 1, ldt, x, x_single, incx);
+  return solve_x(&s, uplo, transposed, ldt, 1, x, x_single, incx);
+}
+
+int blas_tbsv_dd_x(enum blas_order_type order, enum blas_uplo_type uplo,
+		   enum blas_trans_type trans, enum blas_diag_type diag,
+		   int n, int k, double alpha, const void *t, int t_single,
+		   int ldt, void *x, int x_single, int incx)
+{
+  struct trsv_dd s;
+  int base, transposed;
+
+  /* Band storage keeps each diagonal at a fixed offset, so A(r, c) is
+     still affine in r and c: the column-major upper band has A(r, c) at
+     t[k + r + c*(ldt-1)], the lower one at t[r + c*(ldt-1)], and the
+     row-major bands are their transposes. */
+  base = ((order == blas_colmajor) == (uplo == blas_upper)) ? k : 0;
+  s.n = n;
+  s.k = k;
+  s.t = t_single ? (const void *) ((const float *) t + base)
+    : (const void *) ((const double *) t + base);
+  s.t_single = t_single;
+  s.non_unit = (diag == blas_non_unit_diag);
+  s.alpha = alpha;
+  /* As in the routines, blas_conj alone does not transpose. */
+  transposed = (trans == blas_trans || trans == blas_conj_trans);
+  if (order == blas_colmajor)
+    return solve_x(&s, uplo, transposed, 1, ldt - 1, x, x_single, incx);
+  return solve_x(&s, uplo, transposed, ldt - 1, 1, x, x_single, incx);
+}
@@ -117,6 +117,7 @@ void		BLAS_cwaxpby_c_s_x(int n, const void *alpha, const void *x, int incx,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , ix = 0, iy = 0, iw = 0;
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 
 void		BLAS_cwaxpby_x(int n, const void *alpha, const void *x, int incx,
 		     		const		void  *beta, const void *y, int incy, void *w,
@@ -119,6 +120,7 @@ void		BLAS_cwaxpby_x(int n, const void *alpha, const void *x, int incx,
       break;
     }
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , ix = 0, iy = 0, iw = 0;
@@ -224,172 +226,184 @@ void		BLAS_cwaxpby_x(int n, const void *alpha, const void *x, int incx,
       if (incw < 0)
 	iw = (-n + 1) * incw;
 
-      for (i = 0; i < n; ++i) {
-	x_ii[0] = x_i[ix];
-	x_ii[1] = x_i[ix + 1];
-	y_ii[0] = y_i[iy];
-	y_ii[1] = y_i[iy + 1];
-	{
-	  double	  head_e1, tail_e1;
-	  double	  d1;
-	  double	  d2;
-	  /* Real part */
-	  d1 = (double)alpha_i[0] * x_ii[0];
-	  d2 = (double)-alpha_i[1] * x_ii[1];
-	  {
-	    /* Compute double-double = double + double. */
-	    double	    e   , t1, t2;
-
-	    /* Knuth trick. */
-	    t1 = d1 + d2;
-	    e = t1 - d1;
-	    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-	    /* The result is t1 + t2, after normalization. */
-	    head_e1 = t1 + t2;
-	    tail_e1 = t2 - (head_e1 - t1);
-	  }
-	  head_tmpx[0] = head_e1;
-	  tail_tmpx[0] = tail_e1;
-	  /* imaginary part */
-	  d1 = (double)alpha_i[0] * x_ii[1];
-	  d2 = (double)alpha_i[1] * x_ii[0];
-	  {
-	    /* Compute double-double = double + double. */
-	    double	    e   , t1, t2;
-
-	    /* Knuth trick. */
-	    t1 = d1 + d2;
-	    e = t1 - d1;
-	    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-	    /* The result is t1 + t2, after normalization. */
-	    head_e1 = t1 + t2;
-	    tail_e1 = t2 - (head_e1 - t1);
-	  }
-	  head_tmpx[1] = head_e1;
-	  tail_tmpx[1] = tail_e1;
-	}			/* tmpx  = alpha * x[ix] */
-	{
-	  double	  head_e1, tail_e1;
-	  double	  d1;
-	  double	  d2;
-	  /* Real part */
-	  d1 = (double)beta_i[0] * y_ii[0];
-	  d2 = (double)-beta_i[1] * y_ii[1];
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 2 && incy == 2 && incw == 2 && blas_dd_vec_enabled()) {
+	double alpha_d[2], beta_d[2];
+
+	alpha_d[0] = alpha_i[0];
+	alpha_d[1] = alpha_i[1];
+	beta_d[0] = beta_i[0];
+	beta_d[1] = beta_i[1];
+	blas_waxpby_x_kernel(n, alpha_d, x_i, 1, beta_d, y_i, 1,
+			     w_i, 1, 1);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii[0] = x_i[ix];
+	  x_ii[1] = x_i[ix + 1];
+	  y_ii[0] = y_i[iy];
+	  y_ii[1] = y_i[iy + 1];
 	  {
-	    /* Compute double-double = double + double. */
-	    double	    e   , t1, t2;
-
-	    /* Knuth trick. */
-	    t1 = d1 + d2;
-	    e = t1 - d1;
-	    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-	    /* The result is t1 + t2, after normalization. */
-	    head_e1 = t1 + t2;
-	    tail_e1 = t2 - (head_e1 - t1);
-	  }
-	  head_tmpy[0] = head_e1;
-	  tail_tmpy[0] = tail_e1;
-	  /* imaginary part */
-	  d1 = (double)beta_i[0] * y_ii[1];
-	  d2 = (double)beta_i[1] * y_ii[0];
-	  {
-	    /* Compute double-double = double + double. */
-	    double	    e   , t1, t2;
-
-	    /* Knuth trick. */
-	    t1 = d1 + d2;
-	    e = t1 - d1;
-	    t2 = ((d2 - e) + (d1 - (t1 - e)));
-
-	    /* The result is t1 + t2, after normalization. */
-	    head_e1 = t1 + t2;
-	    tail_e1 = t2 - (head_e1 - t1);
-	  }
-	  head_tmpy[1] = head_e1;
-	  tail_tmpy[1] = tail_e1;
-	}			/* tmpy = beta * y[iy] */
-	{
-	  double	  head_t, tail_t;
-	  double	  head_a, tail_a;
-	  double	  head_b, tail_b;
-	  /* Real part */
-	  head_a = head_tmpy[0];
-	  tail_a = tail_tmpy[0];
-	  head_b = head_tmpx[0];
-	  tail_b = tail_tmpx[0];
+	    double	  head_e1, tail_e1;
+	    double	  d1;
+	    double	  d2;
+	    /* Real part */
+	    d1 = (double)alpha_i[0] * x_ii[0];
+	    d2 = (double)-alpha_i[1] * x_ii[1];
+	    {
+	      /* Compute double-double = double + double. */
+	      double	    e   , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = d1 + d2;
+	      e = t1 - d1;
+	      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_e1 = t1 + t2;
+	      tail_e1 = t2 - (head_e1 - t1);
+	    }
+	    head_tmpx[0] = head_e1;
+	    tail_tmpx[0] = tail_e1;
+	    /* imaginary part */
+	    d1 = (double)alpha_i[0] * x_ii[1];
+	    d2 = (double)alpha_i[1] * x_ii[0];
+	    {
+	      /* Compute double-double = double + double. */
+	      double	    e   , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = d1 + d2;
+	      e = t1 - d1;
+	      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_e1 = t1 + t2;
+	      tail_e1 = t2 - (head_e1 - t1);
+	    }
+	    head_tmpx[1] = head_e1;
+	    tail_tmpx[1] = tail_e1;
+	  }			/* tmpx  = alpha * x[ix] */
 	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_a + head_b;
-	    bv = s1 - head_a;
-	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
-	  }
-	  head_tmpy[0] = head_t;
-	  tail_tmpy[0] = tail_t;
-	  /* Imaginary part */
-	  head_a = head_tmpy[1];
-	  tail_a = tail_tmpy[1];
-	  head_b = head_tmpx[1];
-	  tail_b = tail_tmpx[1];
+	    double	  head_e1, tail_e1;
+	    double	  d1;
+	    double	  d2;
+	    /* Real part */
+	    d1 = (double)beta_i[0] * y_ii[0];
+	    d2 = (double)-beta_i[1] * y_ii[1];
+	    {
+	      /* Compute double-double = double + double. */
+	      double	    e   , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = d1 + d2;
+	      e = t1 - d1;
+	      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_e1 = t1 + t2;
+	      tail_e1 = t2 - (head_e1 - t1);
+	    }
+	    head_tmpy[0] = head_e1;
+	    tail_tmpy[0] = tail_e1;
+	    /* imaginary part */
+	    d1 = (double)beta_i[0] * y_ii[1];
+	    d2 = (double)beta_i[1] * y_ii[0];
+	    {
+	      /* Compute double-double = double + double. */
+	      double	    e   , t1, t2;
+
+	      /* Knuth trick. */
+	      t1 = d1 + d2;
+	      e = t1 - d1;
+	      t2 = ((d2 - e) + (d1 - (t1 - e)));
+
+	      /* The result is t1 + t2, after normalization. */
+	      head_e1 = t1 + t2;
+	      tail_e1 = t2 - (head_e1 - t1);
+	    }
+	    head_tmpy[1] = head_e1;
+	    tail_tmpy[1] = tail_e1;
+	  }			/* tmpy = beta * y[iy] */
 	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_a + head_b;
-	    bv = s1 - head_a;
-	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
+	    double	  head_t, tail_t;
+	    double	  head_a, tail_a;
+	    double	  head_b, tail_b;
+	    /* Real part */
+	    head_a = head_tmpy[0];
+	    tail_a = tail_tmpy[0];
+	    head_b = head_tmpx[0];
+	    tail_b = tail_tmpx[0];
+	    {
+	      /* Compute double-double = double-double + double-double. */
+	      double	    bv;
+	      double	    s1  , s2, t1, t2;
+
+	      /* Add two hi words. */
+	      s1 = head_a + head_b;
+	      bv = s1 - head_a;
+	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+	      /* Add two lo words. */
+	      t1 = tail_a + tail_b;
+	      bv = t1 - tail_a;
+	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+	      s2 += t1;
+
+	      /* Renormalize (s1, s2)  to  (t1, s2) */
+	      t1 = s1 + s2;
+	      s2 = s2 - (t1 - s1);
+
+	      t2 += s2;
+
+	      /* Renormalize (t1, t2)  */
+	      head_t = t1 + t2;
+	      tail_t = t2 - (head_t - t1);
+	    }
+	    head_tmpy[0] = head_t;
+	    tail_tmpy[0] = tail_t;
+	    /* Imaginary part */
+	    head_a = head_tmpy[1];
+	    tail_a = tail_tmpy[1];
+	    head_b = head_tmpx[1];
+	    tail_b = tail_tmpx[1];
+	    {
+	      /* Compute double-double = double-double + double-double. */
+	      double	    bv;
+	      double	    s1  , s2, t1, t2;
+
+	      /* Add two hi words. */
+	      s1 = head_a + head_b;
+	      bv = s1 - head_a;
+	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+
+	      /* Add two lo words. */
+	      t1 = tail_a + tail_b;
+	      bv = t1 - tail_a;
+	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+
+	      s2 += t1;
+
+	      /* Renormalize (s1, s2)  to  (t1, s2) */
+	      t1 = s1 + s2;
+	      s2 = s2 - (t1 - s1);
+
+	      t2 += s2;
+
+	      /* Renormalize (t1, t2)  */
+	      head_t = t1 + t2;
+	      tail_t = t2 - (head_t - t1);
+	    }
+	    head_tmpy[1] = head_t;
+	    tail_tmpy[1] = tail_t;
 	  }
-	  head_tmpy[1] = head_t;
-	  tail_tmpy[1] = tail_t;
-	}
-	w_i[iw] = head_tmpy[0];
-	w_i[iw + 1] = head_tmpy[1];
-	ix += incx;
-	iy += incy;
-	iw += incw;
-      }				/* endfor */
+	  w_i[iw] = head_tmpy[0];
+	  w_i[iw + 1] = head_tmpy[1];
+	  ix += incx;
+	  iy += incy;
+	  iw += incw;
+	}				/* endfor */
+      }
 
       FPU_FIX_STOP;
 
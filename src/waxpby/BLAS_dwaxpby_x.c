@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 
 void		BLAS_dwaxpby_x(int n, double alpha, const double *x, int incx,
 	    		double	beta  , const double *y, int incy, double *w,
@@ -54,6 +55,7 @@ void		BLAS_dwaxpby_x(int n, double alpha, const double *x, int incx,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , ix = 0, iy = 0, iw = 0;
@@ -146,73 +148,59 @@ void		BLAS_dwaxpby_x(int n, double alpha, const double *x, int incx,
       if (incw < 0)
 	iw = (-n + 1) * incw;
 
-      for (i = 0; i < n; ++i) {
-	x_ii = x_i[ix];
-	y_ii = y_i[iy];
-	{
-	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = alpha_i * split;
-	  a1 = con - alpha_i;
-	  a1 = con - a1;
-	  a2 = alpha_i - a1;
-	  con = x_ii * split;
-	  b1 = con - x_ii;
-	  b1 = con - b1;
-	  b2 = x_ii - b1;
-
-	  head_tmpx = alpha_i * x_ii;
-	  tail_tmpx = (((a1 * b1 - head_tmpx) + a1 * b2) + a2 * b1) + a2 * b2;
-	}			/* tmpx  = alpha * x[ix] */
-	{
-	  /* Compute double_double = double * double. */
-	  double	  a1    , a2, b1, b2, con;
-
-	  con = beta_i * split;
-	  a1 = con - beta_i;
-	  a1 = con - a1;
-	  a2 = beta_i - a1;
-	  con = y_ii * split;
-	  b1 = con - y_ii;
-	  b1 = con - b1;
-	  b2 = y_ii - b1;
-
-	  head_tmpy = beta_i * y_ii;
-	  tail_tmpy = (((a1 * b1 - head_tmpy) + a1 * b2) + a2 * b1) + a2 * b2;
-	}			/* tmpy = beta * y[iy] */
-	{
-	  /* Compute double-double = double-double + double-double. */
-	  double	  bv;
-	  double	  s1    , s2, t1, t2;
-
-	  /* Add two hi words. */
-	  s1 = head_tmpy + head_tmpx;
-	  bv = s1 - head_tmpy;
-	  s2 = ((head_tmpx - bv) + (head_tmpy - (s1 - bv)));
-
-	  /* Add two lo words. */
-	  t1 = tail_tmpy + tail_tmpx;
-	  bv = t1 - tail_tmpy;
-	  t2 = ((tail_tmpx - bv) + (tail_tmpy - (t1 - bv)));
-
-	  s2 += t1;
-
-	  /* Renormalize (s1, s2)  to  (t1, s2) */
-	  t1 = s1 + s2;
-	  s2 = s2 - (t1 - s1);
-
-	  t2 += s2;
-
-	  /* Renormalize (t1, t2)  */
-	  head_tmpy = t1 + t2;
-	  tail_tmpy = t2 - (head_tmpy - t1);
-	}
-	w_i[iw] = head_tmpy;
-	ix += incx;
-	iy += incy;
-	iw += incw;
-      }				/* endfor */
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 1 && incy == 1 && incw == 1 && blas_dd_vec_enabled()) {
+	double alpha_d = alpha_i, beta_d = beta_i;
+
+	blas_waxpby_x_kernel(n, &alpha_d, x_i, 0, &beta_d, y_i, 0,
+			     w_i, 0, 0);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii = x_i[ix];
+	  y_ii = y_i[iy];
+	  {
+	    /* Compute double_double = double * double. */
+	    head_tmpx = alpha_i * x_ii;
+	    tail_tmpx = BLAS_TWO_PROD_ERR(alpha_i, x_ii, head_tmpx);
+	  }			/* tmpx  = alpha * x[ix] */
+	  {
+	    /* Compute double_double = double * double. */
+	    head_tmpy = beta_i * y_ii;
+	    tail_tmpy = BLAS_TWO_PROD_ERR(beta_i, y_ii, head_tmpy);
+	  }			/* tmpy = beta * y[iy] */
+	  {
+	    /* Compute double-double = double-double + double-double. */
+	    double	  bv;
+	    double	  s1    , s2, t1, t2;
+
+	    /* Add two hi words. */
+	    s1 = head_tmpy + head_tmpx;
+	    bv = s1 - head_tmpy;
+	    s2 = ((head_tmpx - bv) + (head_tmpy - (s1 - bv)));
+
+	    /* Add two lo words. */
+	    t1 = tail_tmpy + tail_tmpx;
+	    bv = t1 - tail_tmpy;
+	    t2 = ((tail_tmpx - bv) + (tail_tmpy - (t1 - bv)));
+
+	    s2 += t1;
+
+	    /* Renormalize (s1, s2)  to  (t1, s2) */
+	    t1 = s1 + s2;
+	    s2 = s2 - (t1 - s1);
+
+	    t2 += s2;
+
+	    /* Renormalize (t1, t2)  */
+	    head_tmpy = t1 + t2;
+	    tail_tmpy = t2 - (head_tmpy - t1);
+	  }
+	  w_i[iw] = head_tmpy;
+	  ix += incx;
+	  iy += incy;
+	  iw += incw;
+	}				/* endfor */
+      }
 
       FPU_FIX_STOP;
 
@@ -1,5 +1,6 @@
 #include "blas_extended.h"
 #include "blas_extended_private.h"
+#include "blas_dd_vec.h"
 
 void		BLAS_zwaxpby_c_z_x(int n, const void *alpha, const void *x, int incx,
 			 		const		void  *beta, const void *y, int incy, void *w,
@@ -54,6 +55,7 @@ void		BLAS_zwaxpby_c_z_x(int n, const void *alpha, const void *x, int incx,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , ix = 0, iy = 0, iw = 0;
@@ -159,58 +161,135 @@ void		BLAS_zwaxpby_c_z_x(int n, const void *alpha, const void *x, int incx,
       if (incw < 0)
 	iw = (-n + 1) * incw;
 
-      for (i = 0; i < n; ++i) {
-	x_ii[0] = x_i[ix];
-	x_ii[1] = x_i[ix + 1];
-	y_ii[0] = y_i[iy];
-	y_ii[1] = y_i[iy + 1];
-	{
-	  double	  cd     [2];
-	  cd[0] = (double)x_ii[0];
-	  cd[1] = (double)x_ii[1];
+      /* Unit stride goes through the vector kernel. */
+      if (incx == 2 && incy == 2 && incw == 2 && blas_dd_vec_enabled()) {
+	double alpha_d[2], beta_d[2];
+
+	alpha_d[0] = alpha_i[0];
+	alpha_d[1] = alpha_i[1];
+	beta_d[0] = beta_i[0];
+	beta_d[1] = beta_i[1];
+	blas_waxpby_x_kernel(n, alpha_d, x_i, 1, beta_d, y_i, 0,
+			     w_i, 0, 1);
+      } else {
+	for (i = 0; i < n; ++i) {
+	  x_ii[0] = x_i[ix];
+	  x_ii[1] = x_i[ix + 1];
+	  y_ii[0] = y_i[iy];
+	  y_ii[1] = y_i[iy + 1];
+	  {
+	    double	  cd     [2];
+	    cd[0] = (double)x_ii[0];
+	    cd[1] = (double)x_ii[1];
+	    {
+	      /* Compute complex-extra = complex-double * complex-double. */
+	      double	    head_t1, tail_t1;
+	      double	    head_t2, tail_t2;
+	      /* Real part */
+	      {
+		/* Compute double_double = double * double. */
+		head_t1 = alpha_i[0] * cd[0];
+		tail_t1 = BLAS_TWO_PROD_ERR(alpha_i[0], cd[0], head_t1);
+	      }
+	      {
+		/* Compute double_double = double * double. */
+		head_t2 = alpha_i[1] * cd[1];
+		tail_t2 = BLAS_TWO_PROD_ERR(alpha_i[1], cd[1], head_t2);
+	      }
+	      head_t2 = -head_t2;
+	      tail_t2 = -tail_t2;
+	      {
+		/* Compute double-double = double-double + double-double. */
+		double	      bv;
+		double	      s1, s2, t1, t2;
+
+		/* Add two hi words. */
+		s1 = head_t1 + head_t2;
+		bv = s1 - head_t1;
+		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		/* Add two lo words. */
+		t1 = tail_t1 + tail_t2;
+		bv = t1 - tail_t1;
+		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		s2 += t1;
+
+		/* Renormalize (s1, s2)  to  (t1, s2) */
+		t1 = s1 + s2;
+		s2 = s2 - (t1 - s1);
+
+		t2 += s2;
+
+		/* Renormalize (t1, t2)  */
+		head_t1 = t1 + t2;
+		tail_t1 = t2 - (head_t1 - t1);
+	      }
+	      head_tmpx[0] = head_t1;
+	      tail_tmpx[0] = tail_t1;
+	      /* Imaginary part */
+	      {
+		/* Compute double_double = double * double. */
+		head_t1 = alpha_i[1] * cd[0];
+		tail_t1 = BLAS_TWO_PROD_ERR(alpha_i[1], cd[0], head_t1);
+	      }
+	      {
+		/* Compute double_double = double * double. */
+		head_t2 = alpha_i[0] * cd[1];
+		tail_t2 = BLAS_TWO_PROD_ERR(alpha_i[0], cd[1], head_t2);
+	      }
+	      {
+		/* Compute double-double = double-double + double-double. */
+		double	      bv;
+		double	      s1, s2, t1, t2;
+
+		/* Add two hi words. */
+		s1 = head_t1 + head_t2;
+		bv = s1 - head_t1;
+		s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
+
+		/* Add two lo words. */
+		t1 = tail_t1 + tail_t2;
+		bv = t1 - tail_t1;
+		t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
+
+		s2 += t1;
+
+		/* Renormalize (s1, s2)  to  (t1, s2) */
+		t1 = s1 + s2;
+		s2 = s2 - (t1 - s1);
+
+		t2 += s2;
+
+		/* Renormalize (t1, t2)  */
+		head_t1 = t1 + t2;
+		tail_t1 = t2 - (head_t1 - t1);
+	      }
+	      head_tmpx[1] = head_t1;
+	      tail_tmpx[1] = tail_t1;
+	    }
+	  }			/* tmpx  = alpha * x[ix] */
 	  {
 	    /* Compute complex-extra = complex-double * complex-double. */
-	    double	    head_t1, tail_t1;
-	    double	    head_t2, tail_t2;
+	    double	  head_t1, tail_t1;
+	    double	  head_t2, tail_t2;
 	    /* Real part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = alpha_i[0] * split;
-	      a1 = con - alpha_i[0];
-	      a1 = con - a1;
-	      a2 = alpha_i[0] - a1;
-	      con = cd[0] * split;
-	      b1 = con - cd[0];
-	      b1 = con - b1;
-	      b2 = cd[0] - b1;
-
-	      head_t1 = alpha_i[0] * cd[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t1 = beta_i[0] * y_ii[0];
+	      tail_t1 = BLAS_TWO_PROD_ERR(beta_i[0], y_ii[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = alpha_i[1] * split;
-	      a1 = con - alpha_i[1];
-	      a1 = con - a1;
-	      a2 = alpha_i[1] - a1;
-	      con = cd[1] * split;
-	      b1 = con - cd[1];
-	      b1 = con - b1;
-	      b2 = cd[1] - b1;
-
-	      head_t2 = alpha_i[1] * cd[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t2 = beta_i[1] * y_ii[1];
+	      tail_t2 = BLAS_TWO_PROD_ERR(beta_i[1], y_ii[1], head_t2);
 	    }
 	    head_t2 = -head_t2;
 	    tail_t2 = -tail_t2;
 	    {
 	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	    bv;
+	      double	    s1  , s2, t1, t2;
 
 	      /* Add two hi words. */
 	      s1 = head_t1 + head_t2;
@@ -234,45 +313,23 @@ void		BLAS_zwaxpby_c_z_x(int n, const void *alpha, const void *x, int incx,
 	      head_t1 = t1 + t2;
 	      tail_t1 = t2 - (head_t1 - t1);
 	    }
-	    head_tmpx[0] = head_t1;
-	    tail_tmpx[0] = tail_t1;
+	    head_tmpy[0] = head_t1;
+	    tail_tmpy[0] = tail_t1;
 	    /* Imaginary part */
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = alpha_i[1] * split;
-	      a1 = con - alpha_i[1];
-	      a1 = con - a1;
-	      a2 = alpha_i[1] - a1;
-	      con = cd[0] * split;
-	      b1 = con - cd[0];
-	      b1 = con - b1;
-	      b2 = cd[0] - b1;
-
-	      head_t1 = alpha_i[1] * cd[0];
-	      tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t1 = beta_i[1] * y_ii[0];
+	      tail_t1 = BLAS_TWO_PROD_ERR(beta_i[1], y_ii[0], head_t1);
 	    }
 	    {
 	      /* Compute double_double = double * double. */
-	      double	      a1, a2, b1, b2, con;
-
-	      con = alpha_i[0] * split;
-	      a1 = con - alpha_i[0];
-	      a1 = con - a1;
-	      a2 = alpha_i[0] - a1;
-	      con = cd[1] * split;
-	      b1 = con - cd[1];
-	      b1 = con - b1;
-	      b2 = cd[1] - b1;
-
-	      head_t2 = alpha_i[0] * cd[1];
-	      tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
+	      head_t2 = beta_i[0] * y_ii[1];
+	      tail_t2 = BLAS_TWO_PROD_ERR(beta_i[0], y_ii[1], head_t2);
 	    }
 	    {
 	      /* Compute double-double = double-double + double-double. */
-	      double	      bv;
-	      double	      s1, s2, t1, t2;
+	      double	    bv;
+	      double	    s1  , s2, t1, t2;
 
 	      /* Add two hi words. */
 	      s1 = head_t1 + head_t2;
@@ -296,220 +353,89 @@ void		BLAS_zwaxpby_c_z_x(int n, const void *alpha, const void *x, int incx,
 	      head_t1 = t1 + t2;
 	      tail_t1 = t2 - (head_t1 - t1);
 	    }
-	    head_tmpx[1] = head_t1;
-	    tail_tmpx[1] = tail_t1;
-	  }
-	}			/* tmpx  = alpha * x[ix] */
-	{
-	  /* Compute complex-extra = complex-double * complex-double. */
-	  double	  head_t1, tail_t1;
-	  double	  head_t2, tail_t2;
-	  /* Real part */
-	  {
-	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[0] * split;
-	    a1 = con - beta_i[0];
-	    a1 = con - a1;
-	    a2 = beta_i[0] - a1;
-	    con = y_ii[0] * split;
-	    b1 = con - y_ii[0];
-	    b1 = con - b1;
-	    b2 = y_ii[0] - b1;
-
-	    head_t1 = beta_i[0] * y_ii[0];
-	    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	  }
+	    head_tmpy[1] = head_t1;
+	    tail_tmpy[1] = tail_t1;
+	  }			/* tmpy = beta * y[iy] */
 	  {
-	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[1] * split;
-	    a1 = con - beta_i[1];
-	    a1 = con - a1;
-	    a2 = beta_i[1] - a1;
-	    con = y_ii[1] * split;
-	    b1 = con - y_ii[1];
-	    b1 = con - b1;
-	    b2 = y_ii[1] - b1;
-
-	    head_t2 = beta_i[1] * y_ii[1];
-	    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	  }
-	  head_t2 = -head_t2;
-	  tail_t2 = -tail_t2;
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_t1 + head_t2;
-	    bv = s1 - head_t1;
-	    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_t1 + tail_t2;
-	    bv = t1 - tail_t1;
-	    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t1 = t1 + t2;
-	    tail_t1 = t2 - (head_t1 - t1);
-	  }
-	  head_tmpy[0] = head_t1;
-	  tail_tmpy[0] = tail_t1;
-	  /* Imaginary part */
-	  {
-	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[1] * split;
-	    a1 = con - beta_i[1];
-	    a1 = con - a1;
-	    a2 = beta_i[1] - a1;
-	    con = y_ii[0] * split;
-	    b1 = con - y_ii[0];
-	    b1 = con - b1;
-	    b2 = y_ii[0] - b1;
-
-	    head_t1 = beta_i[1] * y_ii[0];
-	    tail_t1 = (((a1 * b1 - head_t1) + a1 * b2) + a2 * b1) + a2 * b2;
-	  }
-	  {
-	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = beta_i[0] * split;
-	    a1 = con - beta_i[0];
-	    a1 = con - a1;
-	    a2 = beta_i[0] - a1;
-	    con = y_ii[1] * split;
-	    b1 = con - y_ii[1];
-	    b1 = con - b1;
-	    b2 = y_ii[1] - b1;
-
-	    head_t2 = beta_i[0] * y_ii[1];
-	    tail_t2 = (((a1 * b1 - head_t2) + a1 * b2) + a2 * b1) + a2 * b2;
-	  }
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
-
-	    /* Add two hi words. */
-	    s1 = head_t1 + head_t2;
-	    bv = s1 - head_t1;
-	    s2 = ((head_t2 - bv) + (head_t1 - (s1 - bv)));
-
-	    /* Add two lo words. */
-	    t1 = tail_t1 + tail_t2;
-	    bv = t1 - tail_t1;
-	    t2 = ((tail_t2 - bv) + (tail_t1 - (t1 - bv)));
-
-	    s2 += t1;
-
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
-
-	    t2 += s2;
-
-	    /* Renormalize (t1, t2)  */
-	    head_t1 = t1 + t2;
-	    tail_t1 = t2 - (head_t1 - t1);
-	  }
-	  head_tmpy[1] = head_t1;
-	  tail_tmpy[1] = tail_t1;
-	}			/* tmpy = beta * y[iy] */
-	{
-	  double	  head_t, tail_t;
-	  double	  head_a, tail_a;
-	  double	  head_b, tail_b;
-	  /* Real part */
-	  head_a = head_tmpy[0];
-	  tail_a = tail_tmpy[0];
-	  head_b = head_tmpx[0];
-	  tail_b = tail_tmpx[0];
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
+	    double	  head_t, tail_t;
+	    double	  head_a, tail_a;
+	    double	  head_b, tail_b;
+	    /* Real part */
+	    head_a = head_tmpy[0];
+	    tail_a = tail_tmpy[0];
+	    head_b = head_tmpx[0];
+	    tail_b = tail_tmpx[0];
+	    {
+	      /* Compute double-double = double-double + double-double. */
+	      double	    bv;
+	      double	    s1  , s2, t1, t2;
 
-	    /* Add two hi words. */
-	    s1 = head_a + head_b;
-	    bv = s1 - head_a;
-	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      /* Add two hi words. */
+	      s1 = head_a + head_b;
+	      bv = s1 - head_a;
+	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      /* Add two lo words. */
+	      t1 = tail_a + tail_b;
+	      bv = t1 - tail_a;
+	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-	    s2 += t1;
+	      s2 += t1;
 
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
+	      /* Renormalize (s1, s2)  to  (t1, s2) */
+	      t1 = s1 + s2;
+	      s2 = s2 - (t1 - s1);
 
-	    t2 += s2;
+	      t2 += s2;
 
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
-	  }
-	  head_tmpy[0] = head_t;
-	  tail_tmpy[0] = tail_t;
-	  /* Imaginary part */
-	  head_a = head_tmpy[1];
-	  tail_a = tail_tmpy[1];
-	  head_b = head_tmpx[1];
-	  tail_b = tail_tmpx[1];
-	  {
-	    /* Compute double-double = double-double + double-double. */
-	    double	    bv;
-	    double	    s1  , s2, t1, t2;
+	      /* Renormalize (t1, t2)  */
+	      head_t = t1 + t2;
+	      tail_t = t2 - (head_t - t1);
+	    }
+	    head_tmpy[0] = head_t;
+	    tail_tmpy[0] = tail_t;
+	    /* Imaginary part */
+	    head_a = head_tmpy[1];
+	    tail_a = tail_tmpy[1];
+	    head_b = head_tmpx[1];
+	    tail_b = tail_tmpx[1];
+	    {
+	      /* Compute double-double = double-double + double-double. */
+	      double	    bv;
+	      double	    s1  , s2, t1, t2;
 
-	    /* Add two hi words. */
-	    s1 = head_a + head_b;
-	    bv = s1 - head_a;
-	    s2 = ((head_b - bv) + (head_a - (s1 - bv)));
+	      /* Add two hi words. */
+	      s1 = head_a + head_b;
+	      bv = s1 - head_a;
+	      s2 = ((head_b - bv) + (head_a - (s1 - bv)));
 
-	    /* Add two lo words. */
-	    t1 = tail_a + tail_b;
-	    bv = t1 - tail_a;
-	    t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
+	      /* Add two lo words. */
+	      t1 = tail_a + tail_b;
+	      bv = t1 - tail_a;
+	      t2 = ((tail_b - bv) + (tail_a - (t1 - bv)));
 
-	    s2 += t1;
+	      s2 += t1;
 
-	    /* Renormalize (s1, s2)  to  (t1, s2) */
-	    t1 = s1 + s2;
-	    s2 = s2 - (t1 - s1);
+	      /* Renormalize (s1, s2)  to  (t1, s2) */
+	      t1 = s1 + s2;
+	      s2 = s2 - (t1 - s1);
 
-	    t2 += s2;
+	      t2 += s2;
 
-	    /* Renormalize (t1, t2)  */
-	    head_t = t1 + t2;
-	    tail_t = t2 - (head_t - t1);
+	      /* Renormalize (t1, t2)  */
+	      head_t = t1 + t2;
+	      tail_t = t2 - (head_t - t1);
+	    }
+	    head_tmpy[1] = head_t;
+	    tail_tmpy[1] = tail_t;
 	  }
-	  head_tmpy[1] = head_t;
-	  tail_tmpy[1] = tail_t;
-	}
-	w_i[iw] = head_tmpy[0];
-	w_i[iw + 1] = head_tmpy[1];
-	ix += incx;
-	iy += incy;
-	iw += incw;
-      }				/* endfor */
+	  w_i[iw] = head_tmpy[0];
+	  w_i[iw + 1] = head_tmpy[1];
+	  ix += incx;
+	  iy += incy;
+	  iw += incw;
+	}				/* endfor */
+      }
 
       FPU_FIX_STOP;
 
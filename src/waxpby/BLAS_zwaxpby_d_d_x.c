@@ -54,6 +54,7 @@ void		BLAS_zwaxpby_d_d_x(int n, const void *alpha, const double *x, int incx,
   switch (prec) {
   case blas_prec_single:
   case blas_prec_double:
+  case blas_prec_reproducible:
   case blas_prec_indigenous:{
 
       int	      i    , ix = 0, iy = 0, iw = 0;
@@ -163,37 +164,15 @@ void		BLAS_zwaxpby_d_d_x(int n, const void *alpha, const double *x, int incx,
 	  double	  head_t, tail_t;
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = x_ii * split;
-	    a1 = con - x_ii;
-	    a1 = con - a1;
-	    a2 = x_ii - a1;
-	    con = alpha_i[0] * split;
-	    b1 = con - alpha_i[0];
-	    b1 = con - b1;
-	    b2 = alpha_i[0] - b1;
-
 	    head_t = x_ii * alpha_i[0];
-	    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t = BLAS_TWO_PROD_ERR(x_ii, alpha_i[0], head_t);
 	  }
 	  head_tmpx[0] = head_t;
 	  tail_tmpx[0] = tail_t;
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = x_ii * split;
-	    a1 = con - x_ii;
-	    a1 = con - a1;
-	    a2 = x_ii - a1;
-	    con = alpha_i[1] * split;
-	    b1 = con - alpha_i[1];
-	    b1 = con - b1;
-	    b2 = alpha_i[1] - b1;
-
 	    head_t = x_ii * alpha_i[1];
-	    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t = BLAS_TWO_PROD_ERR(x_ii, alpha_i[1], head_t);
 	  }
 	  head_tmpx[1] = head_t;
 	  tail_tmpx[1] = tail_t;
@@ -203,37 +182,15 @@ void		BLAS_zwaxpby_d_d_x(int n, const void *alpha, const double *x, int incx,
 	  double	  head_t, tail_t;
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = y_ii * split;
-	    a1 = con - y_ii;
-	    a1 = con - a1;
-	    a2 = y_ii - a1;
-	    con = beta_i[0] * split;
-	    b1 = con - beta_i[0];
-	    b1 = con - b1;
-	    b2 = beta_i[0] - b1;
-
 	    head_t = y_ii * beta_i[0];
-	    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t = BLAS_TWO_PROD_ERR(y_ii, beta_i[0], head_t);
 	  }
 	  head_tmpy[0] = head_t;
 	  tail_tmpy[0] = tail_t;
 	  {
 	    /* Compute double_double = double * double. */
-	    double	    a1  , a2, b1, b2, con;
-
-	    con = y_ii * split;
-	    a1 = con - y_ii;
-	    a1 = con - a1;
-	    a2 = y_ii - a1;
-	    con = beta_i[1] * split;
-	    b1 = con - beta_i[1];
-	    b1 = con - b1;
-	    b2 = beta_i[1] - b1;
-
 	    head_t = y_ii * beta_i[1];
-	    tail_t = (((a1 * b1 - head_t) + a1 * b2) + a2 * b1) + a2 * b2;
+	    tail_t = BLAS_TWO_PROD_ERR(y_ii, beta_i[1], head_t);
 	  }
 	  head_tmpy[1] = head_t;
 	  tail_tmpy[1] = tail_t;